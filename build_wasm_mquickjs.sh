@@ -32,8 +32,20 @@ echo ""
 # Step 1: Generate FreeButton stdlib headers (32-bit for ESP32)
 echo "Step 1: Generating FreeButton stdlib headers..."
 
-# Check if freebutton_stdlib executable exists
+# (Re)build the generator if it is missing or older than its sources
+GENERATOR_SOURCES="freebutton_stdlib.c mqjs_stdlib.c mquickjs_build.c mquickjs_build.h"
+need_generator=0
 if [ ! -f freebutton_stdlib ]; then
+    need_generator=1
+else
+    for f in $GENERATOR_SOURCES; do
+        if [ "$f" -nt freebutton_stdlib ]; then
+            need_generator=1
+        fi
+    done
+fi
+
+if [ $need_generator = 1 ]; then
     echo "Building freebutton_stdlib generator..."
 
     # Compile stdlib builder as host executable
@@ -68,13 +80,15 @@ SOURCES="
     freebutton_stubs_wasm.c
     freebutton_stdlib.c
     stdlib_export.c
+    mqjs_timer.c
+    mqjs_perf.c
 "
 
 # Export functions that will be called from JavaScript
-EXPORTED_FUNCTIONS='["_compile_js_to_bytecode", "_get_bytecode_buffer", "_get_error_message", "_get_bytecode_size", "_malloc", "_free"]'
+EXPORTED_FUNCTIONS='["_compile_js_to_bytecode", "_compile_js_to_compact_bytecode", "_get_bytecode_buffer", "_get_error_message", "_get_bytecode_size", "_compile_js_batch", "_get_batch_bytecode", "_get_batch_bytecode_size", "_get_batch_error_message", "_clear_compile_cache", "_malloc", "_free"]'
 
 # Export runtime methods needed by JavaScript wrapper
-EXPORTED_RUNTIME='["ccall", "cwrap", "HEAPU8", "UTF8ToString", "stringToUTF8"]'
+EXPORTED_RUNTIME='["ccall", "cwrap", "HEAPU8", "HEAPU32", "UTF8ToString", "stringToUTF8", "lengthBytesUTF8"]'
 
 echo "Compiling with Emscripten..."
 echo ""
@@ -317,6 +317,27 @@ static inline int from_hex(int c)
         return -1;
 }
 
+/* FNV-1a hash of a byte string. It is used both at build time and at
+   run time for the atom tables, so it must not be changed without
+   regenerating the stdlib tables. */
+static inline uint32_t hash_string8(const uint8_t *buf, size_t len)
+{
+    uint32_t h;
+    size_t i;
+    h = 0x811c9dc5;
+    for(i = 0; i < len; i++) {
+        h = (h ^ buf[i]) * 0x01000193;
+    }
+    return h;
+}
+
+/* slot of an atom in the ROM perfect hash table given its hash and
+   the displacement of its bucket */
+static inline uint32_t atom_hash_slot(uint32_t h, uint32_t d, int hash_bits)
+{
+    return ((h ^ d) * 0x9e3779b1) >> (32 - hash_bits);
+}
+
 static inline uint64_t float64_as_uint64(double d)
 {
     union {
@@ -40,7 +40,6 @@
    - test n_digits=101 instead of 100
    - simplify subnormal handling
    - reduce max memory usage
-   - free format: could add shortcut if exact result
    - use 64 bit limb_t when possible
    - use another algorithm for free format dtoa in base 10 (ryu ?)
 */
@@ -1081,6 +1080,107 @@ int js_dtoa_max_len(double d, int radix, int n_digits, int flags)
     return max_int(n, 9); /* also include NaN and [-]Infinity */
 }
 
+/* powers of ten which are exactly representable as float64 */
+static const double fast_pow10_table[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/* Fast path for the radix 10 free format. Integers below 2^53 are
+   converted directly. Otherwise, the smallest number of fractional
+   digits k <= 22 such that n = round(|d| * 10^k) < 2^53 and n / 10^k
+   == |d| is searched. Since n and 10^k are exact, the division is
+   correctly rounded, so n * 10^-k is the shortest decimal number
+   which converts back to d. If n - 1 or n + 1 also converts back to
+   d, the slow path is used to select the closest one. Return the
+   length (at most 24 characters) or -1 if js_dtoa() must use the slow
+   path. */
+int js_dtoa_fast(char *buf, double d, int radix, int n_digits, int flags)
+{
+    char digits[24];
+    uint64_t a, n;
+    double t, p10;
+    int k, P, E, i;
+    char *q;
+
+    if (radix != 10 || (flags & ~JS_DTOA_MINUS_ZERO) !=
+        (JS_DTOA_FORMAT_FREE | JS_DTOA_EXP_AUTO))
+        return -1;
+    a = float64_as_uint64(d);
+    q = buf;
+    if (((a >> 52) & 0x7ff) == 0x7ff) {
+        if ((a & (((uint64_t)1 << 52) - 1)) != 0) {
+            memcpy(q, "NaN", 3);
+            q += 3;
+        } else {
+            if (a >> 63)
+                *q++ = '-';
+            memcpy(q, "Infinity", 8);
+            q += 8;
+        }
+        goto done;
+    }
+    if (a >> 63) {
+        d = -d;
+        if (d != 0 || (flags & JS_DTOA_MINUS_ZERO))
+            *q++ = '-';
+    }
+    if (d < 0x1p53 && d == (double)(uint64_t)d) {
+        q += u64toa(q, (uint64_t)d);
+        goto done;
+    }
+    if (d >= 0x1p53 || d < 1e-22)
+        return -1;
+    for(k = 1; k < countof(fast_pow10_table); k++) {
+        p10 = fast_pow10_table[k];
+        t = d * p10;
+        if (t >= 0x1p53)
+            return -1;
+        if (t < 0.5)
+            continue;
+        n = (uint64_t)t;
+        /* exact subtraction */
+        if (t - (double)n >= 0.5)
+            n++;
+        if ((double)n / p10 == d)
+            goto found;
+    }
+    return -1;
+ found:
+    if ((double)(n - 1) / p10 == d || (double)(n + 1) / p10 == d)
+        return -1;
+    /* n is not a multiple of 10 because k is minimal */
+    P = u64toa(digits, n);
+    E = P - k;
+    if (E <= -6) {
+        *q++ = digits[0];
+        if (P > 1) {
+            *q++ = '.';
+            memcpy(q, digits + 1, P - 1);
+            q += P - 1;
+        }
+        *q++ = 'e';
+        *q++ = '-';
+        q += u32toa(q, 1 - E);
+    } else if (E <= 0) {
+        *q++ = '0';
+        *q++ = '.';
+        for(i = 0; i < -E; i++)
+            *q++ = '0';
+        memcpy(q, digits, P);
+        q += P;
+    } else {
+        memcpy(q, digits, E);
+        q += E;
+        *q++ = '.';
+        memcpy(q, digits + E, P - E);
+        q += P - E;
+    }
+ done:
+    *q = '\0';
+    return q - buf;
+}
+
 #if defined(__SANITIZE_ADDRESS__) && 0
 static void *dtoa_malloc(uint64_t **pptr, size_t size)
 {
@@ -1114,6 +1214,10 @@ int js_dtoa(char *buf, double d, int radix, int n_digits, int flags,
     mpb_t *tmp1, *mant_max;
     int fmt = flags & JS_DTOA_FORMAT_MASK;
 
+    l = js_dtoa_fast(buf, d, radix, n_digits, flags);
+    if (l >= 0)
+        return l;
+    
     tmp1 = dtoa_malloc(&mptr, sizeof(mpb_t) + sizeof(limb_t) * DBIGNUM_LEN_MAX);
     mant_max = dtoa_malloc(&mptr, sizeof(mpb_t) + sizeof(limb_t) * MANT_LEN_MAX);
     assert((mptr - tmp_mem->mem) <= sizeof(JSDTOATempMem) / sizeof(mptr[0]));
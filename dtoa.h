@@ -67,6 +67,10 @@ int js_dtoa_max_len(double d, int radix, int n_digits, int flags);
 /* return the string length */
 int js_dtoa(char *buf, double d, int radix, int n_digits, int flags,
             JSDTOATempMem *tmp_mem);
+/* same as js_dtoa() without temporary memory for the common short
+   numbers in radix 10 free format. Return -1 if js_dtoa() is
+   needed. 'buf' must be at least 25 bytes long. */
+int js_dtoa_fast(char *buf, double d, int radix, int n_digits, int flags);
 double js_atod(const char *str, const char **pnext, int radix, int flags,
                JSATODTempMem *tmp_mem);
 
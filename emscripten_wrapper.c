@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <emscripten.h>
+#include "cutils.h"
 #include "mquickjs.h"
 #include "mquickjs_priv.h"  /* For JS_VALUE_TO_PTR and JS_IsPtr macros */
 
@@ -27,6 +28,43 @@ static size_t bytecode_size = 0;
 // Error message buffer
 static char error_message[1024];
 
+// Heap of the compiler context. It is static so that the context
+// snapshot is always restored at the same address (no relocation).
+#define COMPILER_MEM_SIZE (128 * 1024)
+static uint8_t compiler_mem[COMPILER_MEM_SIZE];
+
+// Snapshot of a freshly initialized context (stdlib loaded)
+static uint8_t *compiler_snapshot = NULL;
+static size_t compiler_snapshot_len = 0;
+
+// Number of compiled outputs kept in the cache
+#define COMPILE_CACHE_SIZE 16
+
+/* Output of a compilation: bytecode or error message */
+typedef struct {
+    uint8_t *data;      // malloc'ed bytecode, NULL on error
+    int size;           // bytecode size, -1 on error
+    char *error;        // malloc'ed error message, NULL on success
+} CompileResult;
+
+/* Cache entry, keyed by the hash of the source and of the options */
+typedef struct {
+    uint32_t hash;
+    char *source;       // NULL if the entry is unused
+    size_t source_len;
+    uintptr_t target_addr;
+    int use_32bit;
+    uint32_t last_use;  // for LRU replacement
+    CompileResult result;
+} CompileCacheEntry;
+
+static CompileCacheEntry compile_cache[COMPILE_CACHE_SIZE];
+static uint32_t compile_cache_clock = 0;
+
+// Results of the last compile_js_batch() call
+static CompileResult *batch_results = NULL;
+static int batch_count = 0;
+
 /* ROM Atom Translation Table (v0x0002 bytecode) */
 typedef struct {
     uint32_t offset;
@@ -107,8 +145,67 @@ static int build_rom_atom_table(JSContext* ctx, JSBytecodeHeader* hdr, uint8_t*
     return rom_count;
 }
 
+static void snapshot_write(void *opaque, const void *buf, size_t len) {
+    uint8_t *new_buf = realloc(compiler_snapshot, compiler_snapshot_len + len);
+    if (!new_buf) {
+        *(int *)opaque = -1;
+        return;
+    }
+    memcpy(new_buf + compiler_snapshot_len, buf, len);
+    compiler_snapshot = new_buf;
+    compiler_snapshot_len += len;
+}
+
 /**
- * Compile JavaScript source to bytecode
+ * Create the compiler context
+ *
+ * The first call initializes a context with the stdlib and saves a
+ * snapshot of it. The next calls restore the snapshot, which is a
+ * copy of the initialized heap, instead of running the stdlib
+ * initialization again. A context cannot be reused directly because
+ * JS_PrepareBytecode() removes everything but the compiled code.
+ *
+ * @return New context or NULL if error
+ */
+static JSContext* compiler_new_context(void) {
+    JSContext *ctx;
+    int err = 0;
+
+    if (compiler_snapshot) {
+        ctx = JS_RestoreSnapshot(compiler_mem, sizeof(compiler_mem), &js_stdlib,
+                                 compiler_snapshot, compiler_snapshot_len);
+        if (ctx)
+            return ctx;
+        // Should not happen: fall back to a full initialization
+        free(compiler_snapshot);
+        compiler_snapshot = NULL;
+        compiler_snapshot_len = 0;
+    }
+
+    // Create NORMAL context with stdlib (so APIs like 'led' are available)
+    // ROM atoms WILL be created during compilation, but we'll use
+    // update_atoms=1 in JS_RelocateBytecode2 to replace them with embedded strings
+    ctx = JS_NewContext(compiler_mem, sizeof(compiler_mem), &js_stdlib);
+    if (!ctx)
+        return NULL;
+
+    if (JS_SaveSnapshot(ctx, snapshot_write, &err) || err) {
+        // Not fatal: the next calls will initialize the stdlib again
+        free(compiler_snapshot);
+        compiler_snapshot = NULL;
+        compiler_snapshot_len = 0;
+    } else {
+        printf("[WASM] Saved compiler context snapshot: %zu bytes\n",
+               compiler_snapshot_len);
+    }
+    return ctx;
+}
+
+/**
+ * Compile JavaScript source to bytecode (no cache)
+ *
+ * The output is written to bytecode_buffer / bytecode_size or
+ * error_message.
  *
  * @param source_code JavaScript source code (null-terminated)
  * @param source_len Length of source code
@@ -116,11 +213,9 @@ static int build_rom_atom_table(JSContext* ctx, JSBytecodeHeader* hdr, uint8_t*
  * @param use_32bit Generate 32-bit bytecode (for ESP32)
  * @return Bytecode size on success, -1 on error
  */
-EMSCRIPTEN_KEEPALIVE
-int compile_js_to_bytecode(const char* source_code, size_t source_len,
-                           uintptr_t target_addr, int use_32bit) {
+static int compile_source(const char* source_code, size_t source_len,
+                          uintptr_t target_addr, int use_32bit) {
     JSContext *ctx = NULL;
-    uint8_t mem_buf[128 * 1024]; // 128KB heap for compilation
     JSValue result;
     const uint8_t *data_buf;
     uint32_t data_len;
@@ -133,10 +228,7 @@ int compile_js_to_bytecode(const char* source_code, size_t source_len,
            JSW, use_32bit, (unsigned long)target_addr);
 #endif
 
-    // Create NORMAL context with stdlib (so APIs like 'led' are available)
-    // ROM atoms WILL be created during compilation, but we'll use
-    // update_atoms=1 in JS_RelocateBytecode2 to replace them with embedded strings
-    ctx = JS_NewContext(mem_buf, sizeof(mem_buf), &js_stdlib);
+    ctx = compiler_new_context();
     if (!ctx) {
         snprintf(error_message, sizeof(error_message), "Failed to create JS context");
         return -1;
@@ -337,6 +429,308 @@ int compile_js_to_bytecode(const char* source_code, size_t source_len,
     return (int)bytecode_size;
 }
 
+static void compile_result_free(CompileResult *res) {
+    free(res->data);
+    free(res->error);
+    res->data = NULL;
+    res->error = NULL;
+    res->size = -1;
+}
+
+/* Copy the output of compile_source() to 'res'. Return -1 if no memory. */
+static int compile_result_save(CompileResult *res, int size) {
+    res->data = NULL;
+    res->error = NULL;
+    res->size = size;
+    if (size >= 0) {
+        res->data = malloc(size > 0 ? size : 1);
+        if (!res->data)
+            return -1;
+        memcpy(res->data, bytecode_buffer, size);
+    } else {
+        res->error = strdup(error_message);
+        if (!res->error)
+            return -1;
+    }
+    return 0;
+}
+
+/* Return -1 if no memory */
+static int compile_result_copy(CompileResult *dst, const CompileResult *src) {
+    dst->data = NULL;
+    dst->error = NULL;
+    dst->size = src->size;
+    if (src->data) {
+        dst->data = malloc(src->size > 0 ? src->size : 1);
+        if (!dst->data)
+            return -1;
+        memcpy(dst->data, src->data, src->size);
+    }
+    if (src->error) {
+        dst->error = strdup(src->error);
+        if (!dst->error) {
+            free(dst->data);
+            dst->data = NULL;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t compile_cache_hash(const char* source_code, size_t source_len,
+                                   uintptr_t target_addr, int use_32bit) {
+    uint32_t h = hash_string8((const uint8_t *)source_code, source_len);
+    h = (h ^ (uint32_t)target_addr) * 0x01000193;
+    h = (h ^ (uint32_t)use_32bit) * 0x01000193;
+    return h;
+}
+
+/**
+ * Compile with the cache: the outputs (bytecode or error message) of
+ * the last COMPILE_CACHE_SIZE different sources are kept, so that
+ * recompiling an unchanged source is a lookup. The source itself is
+ * compared, so a hash collision cannot return the wrong bytecode.
+ *
+ * @return Cached result (valid until the next compilation) or NULL if
+ *         no memory
+ */
+static const CompileResult* compile_cached(const char* source_code, size_t source_len,
+                                           uintptr_t target_addr, int use_32bit) {
+    CompileCacheEntry *e, *victim;
+    uint32_t hash;
+    int i, size;
+
+    hash = compile_cache_hash(source_code, source_len, target_addr, use_32bit);
+    victim = &compile_cache[0];
+    for (i = 0; i < COMPILE_CACHE_SIZE; i++) {
+        e = &compile_cache[i];
+        if (e->source && e->hash == hash && e->source_len == source_len &&
+            e->target_addr == target_addr && e->use_32bit == use_32bit &&
+            memcmp(e->source, source_code, source_len) == 0) {
+            e->last_use = ++compile_cache_clock;
+            return &e->result;
+        }
+        // Replace an unused entry or the least recently used one
+        if (victim->source && (!e->source || e->last_use < victim->last_use))
+            victim = e;
+    }
+
+    size = compile_source(source_code, source_len, target_addr, use_32bit);
+
+    e = victim;
+    if (e->source) {
+        free(e->source);
+        e->source = NULL;
+        compile_result_free(&e->result);
+    }
+    e->source = malloc(source_len + 1);
+    if (!e->source)
+        return NULL;
+    memcpy(e->source, source_code, source_len);
+    e->source[source_len] = '\0';
+    if (compile_result_save(&e->result, size)) {
+        free(e->source);
+        e->source = NULL;
+        compile_result_free(&e->result);
+        return NULL;
+    }
+    e->hash = hash;
+    e->source_len = source_len;
+    e->target_addr = target_addr;
+    e->use_32bit = use_32bit;
+    e->last_use = ++compile_cache_clock;
+    return &e->result;
+}
+
+/**
+ * Compile JavaScript source to bytecode
+ *
+ * An unchanged source with the same options is not compiled again.
+ *
+ * @param source_code JavaScript source code (null-terminated)
+ * @param source_len Length of source code
+ * @param target_addr Target flash address for pre-relocation (0 = no relocation)
+ * @param use_32bit Generate 32-bit bytecode (for ESP32)
+ * @return Bytecode size on success, -1 on error
+ */
+EMSCRIPTEN_KEEPALIVE
+int compile_js_to_bytecode(const char* source_code, size_t source_len,
+                           uintptr_t target_addr, int use_32bit) {
+    const CompileResult *res;
+
+    res = compile_cached(source_code, source_len, target_addr, use_32bit);
+    if (!res) {
+        bytecode_size = 0;
+        snprintf(error_message, sizeof(error_message), "Out of memory");
+        return -1;
+    }
+    if (res->size < 0) {
+        bytecode_size = 0;
+        snprintf(error_message, sizeof(error_message), "%s", res->error);
+        return -1;
+    }
+    // The output of a cache miss is already in bytecode_buffer, but
+    // copying is simpler than tracking it
+    error_message[0] = '\0';
+    memcpy(bytecode_buffer, res->data, res->size);
+    bytecode_size = res->size;
+    return res->size;
+}
+
+/* Append to bytecode_buffer, the length is set to -1 if it is full */
+static void compact_write(void *opaque, const void *buf, size_t len) {
+    int *plen = opaque;
+    if (*plen < 0)
+        return;
+    if (len > MAX_BYTECODE_SIZE - *plen) {
+        *plen = -1;
+        return;
+    }
+    memcpy(bytecode_buffer + *plen, buf, len);
+    *plen += len;
+}
+
+/**
+ * Compile JavaScript source to the compact transport format
+ *
+ * The output does not depend on the word size, needs no relocation
+ * and is usually much smaller than the bytecode image, which makes it
+ * suitable for OTA updates. The device expands it in its heap with
+ * JS_LoadCompactBytecode(). The output is read with
+ * get_bytecode_buffer() and get_bytecode_size().
+ *
+ * @param source_code JavaScript source code (null-terminated)
+ * @param source_len Length of source code
+ * @return Size on success, -1 on error
+ */
+EMSCRIPTEN_KEEPALIVE
+int compile_js_to_compact_bytecode(const char* source_code, size_t source_len) {
+    JSContext *ctx;
+    JSValue result;
+    JSCStringBuf buf;
+    const char *str;
+    int len = 0;
+
+    bytecode_size = 0;
+    error_message[0] = '\0';
+    ctx = compiler_new_context();
+    if (!ctx) {
+        snprintf(error_message, sizeof(error_message), "Failed to create JS context");
+        return -1;
+    }
+    result = JS_Parse(ctx, source_code, source_len, "<input>", 0);
+    if (JS_IsException(result) ||
+        JS_WriteCompactBytecode(ctx, result, compact_write, &len)) {
+        str = JS_ToCString(ctx, JS_GetException(ctx), &buf);
+        snprintf(error_message, sizeof(error_message), "%s",
+                 str ? str : "Compilation failed");
+        JS_FreeContext(ctx);
+        return -1;
+    }
+    JS_FreeContext(ctx);
+    if (len < 0) {
+        snprintf(error_message, sizeof(error_message), "Bytecode too large");
+        return -1;
+    }
+    bytecode_size = len;
+    return len;
+}
+
+static void batch_results_free(void) {
+    int i;
+    for (i = 0; i < batch_count; i++)
+        compile_result_free(&batch_results[i]);
+    free(batch_results);
+    batch_results = NULL;
+    batch_count = 0;
+}
+
+/**
+ * Compile several files in one call
+ *
+ * Each file is compiled independently (separate bytecode image) and
+ * goes through the cache, so in a project only the edited files are
+ * compiled again. The results are read with get_batch_bytecode(),
+ * get_batch_bytecode_size() and get_batch_error_message(). They stay
+ * valid until the next compile_js_batch() call.
+ *
+ * @param count Number of files
+ * @param sources Array of 'count' source pointers
+ * @param source_lens Array of 'count' source lengths
+ * @param target_addr Target flash address for pre-relocation (0 = no relocation)
+ * @param use_32bit Generate 32-bit bytecode (for ESP32)
+ * @return Number of files which failed to compile, -1 if out of memory
+ */
+EMSCRIPTEN_KEEPALIVE
+int compile_js_batch(int count, const char** sources, const size_t* source_lens,
+                     uintptr_t target_addr, int use_32bit) {
+    const CompileResult *res;
+    int i, failed = 0;
+
+    batch_results_free();
+    if (count <= 0)
+        return 0;
+    batch_results = calloc(count, sizeof(batch_results[0]));
+    if (!batch_results)
+        return -1;
+    batch_count = count;
+    for (i = 0; i < count; i++) {
+        batch_results[i].size = -1;
+        res = compile_cached(sources[i], source_lens[i], target_addr, use_32bit);
+        if (!res || compile_result_copy(&batch_results[i], res)) {
+            batch_results_free();
+            return -1;
+        }
+        if (res->size < 0)
+            failed++;
+    }
+    return failed;
+}
+
+/**
+ * Get pointer to the bytecode of file 'index' of the last batch
+ * (NULL if it failed to compile)
+ */
+EMSCRIPTEN_KEEPALIVE
+uint8_t* get_batch_bytecode(int index) {
+    if (index < 0 || index >= batch_count)
+        return NULL;
+    return batch_results[index].data;
+}
+
+/**
+ * Get bytecode size of file 'index' of the last batch (-1 on error)
+ */
+EMSCRIPTEN_KEEPALIVE
+int get_batch_bytecode_size(int index) {
+    if (index < 0 || index >= batch_count)
+        return -1;
+    return batch_results[index].size;
+}
+
+/**
+ * Get error message of file 'index' of the last batch ("" on success)
+ */
+EMSCRIPTEN_KEEPALIVE
+const char* get_batch_error_message(int index) {
+    if (index < 0 || index >= batch_count || !batch_results[index].error)
+        return "";
+    return batch_results[index].error;
+}
+
+/**
+ * Free the cached compilation outputs
+ */
+EMSCRIPTEN_KEEPALIVE
+void clear_compile_cache() {
+    int i;
+    for (i = 0; i < COMPILE_CACHE_SIZE; i++) {
+        free(compile_cache[i].source);
+        compile_cache[i].source = NULL;
+        compile_result_free(&compile_cache[i].result);
+    }
+}
+
 /**
  * Get pointer to compiled bytecode
  * Call after successful compile_js_to_bytecode()
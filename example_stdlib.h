@@ -0,0 +1,3225 @@
+/* this file is automatically generated - do not edit */
+
+#include "mquickjs_priv.h"
+
+static const uint64_t __attribute((aligned(64))) js_stdlib_table[] = {
+  /* atom_table */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "null" (offset=0) */
+  0x000000006c6c756e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "false" (offset=2) */
+  0x00000065736c6166,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "true" (offset=4) */
+  0x0000000065757274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "if" (offset=6) */
+  0x0000000000006669,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "else" (offset=8) */
+  0x0000000065736c65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "return" (offset=10) */
+  0x00006e7275746572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "var" (offset=12) */
+  0x0000000000726176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "this" (offset=14) */
+  0x0000000073696874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "delete" (offset=16) */
+  0x00006574656c6564,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "void" (offset=18) */
+  0x0000000064696f76,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "typeof" (offset=20) */
+  0x0000666f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "new" (offset=22) */
+  0x000000000077656e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "in" (offset=24) */
+  0x0000000000006e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "instanceof" (offset=26) */
+  0x65636e6174736e69,
+  0x000000000000666f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "do" (offset=29) */
+  0x0000000000006f64,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "while" (offset=31) */
+  0x000000656c696877,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "for" (offset=33) */
+  0x0000000000726f66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "break" (offset=35) */
+  0x0000006b61657262,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "continue" (offset=37) */
+  0x65756e69746e6f63,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "switch" (offset=40) */
+  0x0000686374697773,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "case" (offset=42) */
+  0x0000000065736163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "default" (offset=44) */
+  0x00746c7561666564,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "throw" (offset=46) */
+  0x000000776f726874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "try" (offset=48) */
+  0x0000000000797274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "catch" (offset=50) */
+  0x0000006863746163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "finally" (offset=52) */
+  0x00796c6c616e6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "function" (offset=54) */
+  0x6e6f6974636e7566,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "debugger" (offset=57) */
+  0x7265676775626564,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "with" (offset=60) */
+  0x0000000068746977,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "class" (offset=62) */
+  0x0000007373616c63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "const" (offset=64) */
+  0x00000074736e6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "enum" (offset=66) */
+  0x000000006d756e65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "export" (offset=68) */
+  0x000074726f707865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "extends" (offset=70) */
+  0x0073646e65747865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "import" (offset=72) */
+  0x000074726f706d69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "super" (offset=74) */
+  0x0000007265707573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "implements" (offset=76) */
+  0x6e656d656c706d69,
+  0x0000000000007374,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "interface" (offset=79) */
+  0x6361667265746e69,
+  0x0000000000000065,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "let" (offset=82) */
+  0x000000000074656c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "package" (offset=84) */
+  0x006567616b636170,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "private" (offset=86) */
+  0x0065746176697270,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "protected" (offset=88) */
+  0x65746365746f7270,
+  0x0000000000000064,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "public" (offset=91) */
+  0x000063696c627570,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "static" (offset=93) */
+  0x0000636974617473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "yield" (offset=95) */
+  0x000000646c656979,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (0 << (JS_MTAG_BITS + 3)), /* "" (offset=97) */
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "toString" (offset=99) */
+  0x676e697274536f74,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "valueOf" (offset=102) */
+  0x00664f65756c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "number" (offset=104) */
+  0x00007265626d756e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "object" (offset=106) */
+  0x00007463656a626f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "undefined" (offset=108) */
+  0x656e696665646e75,
+  0x0000000000000064,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "string" (offset=111) */
+  0x0000676e69727473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "boolean" (offset=113) */
+  0x006e61656c6f6f62,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "<ret>" (offset=115) */
+  0x0000003e7465723c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "<eval>" (offset=117) */
+  0x00003e6c6176653c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "eval" (offset=119) */
+  0x000000006c617665,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "arguments" (offset=121) */
+  0x746e656d75677261,
+  0x0000000000000073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "value" (offset=124) */
+  0x00000065756c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "get" (offset=126) */
+  0x0000000000746567,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "set" (offset=128) */
+  0x0000000000746573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "prototype" (offset=130) */
+  0x7079746f746f7270,
+  0x0000000000000065,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "constructor" (offset=133) */
+  0x63757274736e6f63,
+  0x0000000000726f74,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "length" (offset=136) */
+  0x00006874676e656c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "target" (offset=138) */
+  0x0000746567726174,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "of" (offset=140) */
+  0x000000000000666f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "NaN" (offset=142) */
+  0x00000000004e614e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "Infinity" (offset=144) */
+  0x7974696e69666e49,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "-Infinity" (offset=147) */
+  0x74696e69666e492d,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "name" (offset=150) */
+  0x00000000656d616e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "Error" (offset=152) */
+  0x000000726f727245,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "__proto__" (offset=154) */
+  0x5f6f746f72705f5f,
+  0x000000000000005f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "index" (offset=157) */
+  0x0000007865646e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "input" (offset=159) */
+  0x0000007475706e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "bound" (offset=161) */
+  0x000000646e756f62,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (22 << (JS_MTAG_BITS + 3)), /* "rectangle_closure_test" (offset=163) */
+  0x6c676e6174636572,
+  0x7275736f6c635f65,
+  0x0000747365745f65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "Object" (offset=167) */
+  0x00007463656a624f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "defineProperty" (offset=169) */
+  0x7250656e69666564,
+  0x000079747265706f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "getPrototypeOf" (offset=172) */
+  0x6f746f7250746567,
+  0x0000664f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "setPrototypeOf" (offset=175) */
+  0x6f746f7250746573,
+  0x0000664f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "create" (offset=178) */
+  0x0000657461657263,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "keys" (offset=180) */
+  0x000000007379656b,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "hasOwnProperty" (offset=182) */
+  0x72506e774f736168,
+  0x000079747265706f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "Function" (offset=185) */
+  0x6e6f6974636e7546,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "get prototype" (offset=188) */
+  0x746f727020746567,
+  0x000000657079746f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "set prototype" (offset=191) */
+  0x746f727020746573,
+  0x000000657079746f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "call" (offset=194) */
+  0x000000006c6c6163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "apply" (offset=196) */
+  0x000000796c707061,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "bind" (offset=198) */
+  0x00000000646e6962,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get length" (offset=200) */
+  0x676e656c20746567,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "get name" (offset=203) */
+  0x656d616e20746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "Number" (offset=206) */
+  0x00007265626d754e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "parseInt" (offset=208) */
+  0x746e496573726170,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "parseFloat" (offset=211) */
+  0x6f6c466573726170,
+  0x0000000000007461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "MAX_VALUE" (offset=214) */
+  0x554c41565f58414d,
+  0x0000000000000045,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "MIN_VALUE" (offset=217) */
+  0x554c41565f4e494d,
+  0x0000000000000045,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "NEGATIVE_INFINITY" (offset=220) */
+  0x455649544147454e,
+  0x54494e49464e495f,
+  0x0000000000000059,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "POSITIVE_INFINITY" (offset=224) */
+  0x4556495449534f50,
+  0x54494e49464e495f,
+  0x0000000000000059,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "EPSILON" (offset=228) */
+  0x004e4f4c49535045,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (16 << (JS_MTAG_BITS + 3)), /* "MAX_SAFE_INTEGER" (offset=230) */
+  0x454641535f58414d,
+  0x52454745544e495f,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (16 << (JS_MTAG_BITS + 3)), /* "MIN_SAFE_INTEGER" (offset=234) */
+  0x454641535f4e494d,
+  0x52454745544e495f,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "toExponential" (offset=238) */
+  0x656e6f7078456f74,
+  0x0000006c6169746e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "toFixed" (offset=241) */
+  0x0064657869466f74,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toPrecision" (offset=243) */
+  0x7369636572506f74,
+  0x00000000006e6f69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "Boolean" (offset=246) */
+  0x006e61656c6f6f42,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "String" (offset=248) */
+  0x0000676e69727453,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "fromCharCode" (offset=250) */
+  0x726168436d6f7266,
+  0x0000000065646f43,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "fromCodePoint" (offset=253) */
+  0x65646f436d6f7266,
+  0x000000746e696f50,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "set length" (offset=256) */
+  0x676e656c20746573,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "charAt" (offset=259) */
+  0x0000744172616863,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "charCodeAt" (offset=261) */
+  0x65646f4372616863,
+  0x0000000000007441,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "codePointAt" (offset=264) */
+  0x6e696f5065646f63,
+  0x0000000000744174,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "slice" (offset=267) */
+  0x0000006563696c73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "substring" (offset=269) */
+  0x6e69727473627573,
+  0x0000000000000067,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "concat" (offset=272) */
+  0x00007461636e6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "indexOf" (offset=274) */
+  0x00664f7865646e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "lastIndexOf" (offset=276) */
+  0x65646e497473616c,
+  0x0000000000664f78,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "match" (offset=279) */
+  0x000000686374616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "replace" (offset=281) */
+  0x006563616c706572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "replaceAll" (offset=283) */
+  0x416563616c706572,
+  0x0000000000006c6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "search" (offset=286) */
+  0x0000686372616573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "split" (offset=288) */
+  0x00000074696c7073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toLowerCase" (offset=290) */
+  0x437265776f4c6f74,
+  0x0000000000657361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toUpperCase" (offset=293) */
+  0x4372657070556f74,
+  0x0000000000657361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "trim" (offset=296) */
+  0x000000006d697274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "trimEnd" (offset=298) */
+  0x00646e456d697274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "trimStart" (offset=300) */
+  0x726174536d697274,
+  0x0000000000000074,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "repeat" (offset=303) */
+  0x0000746165706572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "Array" (offset=305) */
+  0x0000007961727241,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "isArray" (offset=307) */
+  0x0079617272417369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "push" (offset=309) */
+  0x0000000068737570,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pop" (offset=311) */
+  0x0000000000706f70,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "join" (offset=313) */
+  0x000000006e696f6a,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "reverse" (offset=315) */
+  0x0065737265766572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "shift" (offset=317) */
+  0x0000007466696873,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "splice" (offset=319) */
+  0x00006563696c7073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "unshift" (offset=321) */
+  0x0074666968736e75,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "every" (offset=323) */
+  0x0000007972657665,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "some" (offset=325) */
+  0x00000000656d6f73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "forEach" (offset=327) */
+  0x0068636145726f66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "map" (offset=329) */
+  0x000000000070616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "filter" (offset=331) */
+  0x00007265746c6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "reduce" (offset=333) */
+  0x0000656375646572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "reduceRight" (offset=335) */
+  0x6952656375646572,
+  0x0000000000746867,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sort" (offset=338) */
+  0x0000000074726f73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Math" (offset=340) */
+  0x000000006874614d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "min" (offset=342) */
+  0x00000000006e696d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "max" (offset=344) */
+  0x000000000078616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sign" (offset=346) */
+  0x000000006e676973,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "abs" (offset=348) */
+  0x0000000000736261,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "floor" (offset=350) */
+  0x000000726f6f6c66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "ceil" (offset=352) */
+  0x000000006c696563,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "round" (offset=354) */
+  0x000000646e756f72,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sqrt" (offset=356) */
+  0x0000000074727173,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (1 << (JS_MTAG_BITS + 3)), /* "E" (offset=358) */
+  0x0000000000000045,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "LN10" (offset=360) */
+  0x0000000030314e4c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "LN2" (offset=362) */
+  0x0000000000324e4c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "LOG2E" (offset=364) */
+  0x0000004532474f4c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "LOG10E" (offset=366) */
+  0x0000453031474f4c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "PI" (offset=368) */
+  0x0000000000004950,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "SQRT1_2" (offset=370) */
+  0x00325f3154525153,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "SQRT2" (offset=372) */
+  0x0000003254525153,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "sin" (offset=374) */
+  0x00000000006e6973,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "cos" (offset=376) */
+  0x0000000000736f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "tan" (offset=378) */
+  0x00000000006e6174,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "asin" (offset=380) */
+  0x000000006e697361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "acos" (offset=382) */
+  0x00000000736f6361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "atan" (offset=384) */
+  0x000000006e617461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "atan2" (offset=386) */
+  0x000000326e617461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "exp" (offset=388) */
+  0x0000000000707865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "log" (offset=390) */
+  0x0000000000676f6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pow" (offset=392) */
+  0x0000000000776f70,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "random" (offset=394) */
+  0x00006d6f646e6172,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "imul" (offset=396) */
+  0x000000006c756d69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "clz32" (offset=398) */
+  0x00000032337a6c63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "fround" (offset=400) */
+  0x0000646e756f7266,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "trunc" (offset=402) */
+  0x000000636e757274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "log2" (offset=404) */
+  0x0000000032676f6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "log10" (offset=406) */
+  0x0000003031676f6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "idiv" (offset=408) */
+  0x0000000076696469,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "fxmul" (offset=410) */
+  0x0000006c756d7866,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "fxdiv" (offset=412) */
+  0x0000007669647866,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Date" (offset=414) */
+  0x0000000065746144,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "now" (offset=416) */
+  0x0000000000776f6e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "JSON" (offset=418) */
+  0x000000004e4f534a,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "parse" (offset=420) */
+  0x0000006573726170,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "stringify" (offset=422) */
+  0x6669676e69727473,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "JSONParser" (offset=425) */
+  0x737261504e4f534a,
+  0x0000000000007265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "write" (offset=428) */
+  0x0000006574697277,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "end" (offset=430) */
+  0x0000000000646e65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "RegExp" (offset=432) */
+  0x0000707845676552,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "lastIndex" (offset=434) */
+  0x65646e497473616c,
+  0x0000000000000078,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "get lastIndex" (offset=437) */
+  0x7473616c20746567,
+  0x0000007865646e49,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "set lastIndex" (offset=440) */
+  0x7473616c20746573,
+  0x0000007865646e49,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "source" (offset=443) */
+  0x0000656372756f73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get source" (offset=445) */
+  0x72756f7320746567,
+  0x0000000000006563,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "flags" (offset=448) */
+  0x0000007367616c66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get flags" (offset=450) */
+  0x67616c6620746567,
+  0x0000000000000073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "exec" (offset=453) */
+  0x0000000063657865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "test" (offset=455) */
+  0x0000000074736574,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "message" (offset=457) */
+  0x006567617373656d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "get message" (offset=459) */
+  0x7373656d20746567,
+  0x0000000000656761,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "stack" (offset=462) */
+  0x0000006b63617473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get stack" (offset=464) */
+  0x6361747320746567,
+  0x000000000000006b,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "EvalError" (offset=467) */
+  0x6f7272456c617645,
+  0x0000000000000072,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "RangeError" (offset=470) */
+  0x72724565676e6152,
+  0x000000000000726f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "ReferenceError" (offset=473) */
+  0x636e657265666552,
+  0x0000726f72724565,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "SyntaxError" (offset=476) */
+  0x72457861746e7953,
+  0x0000000000726f72,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "TypeError" (offset=479) */
+  0x6f72724565707954,
+  0x0000000000000072,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "URIError" (offset=482) */
+  0x726f727245495255,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "InternalError" (offset=485) */
+  0x6c616e7265746e49,
+  0x000000726f727245,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "ArrayBuffer" (offset=488) */
+  0x6675427961727241,
+  0x0000000000726566,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteLength" (offset=491) */
+  0x676e654c65747962,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteLength" (offset=494) */
+  0x6574796220746567,
+  0x00006874676e654c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "Uint8ClampedArray" (offset=497) */
+  0x616c4338746e6955,
+  0x617272416465706d,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "TypedArray" (offset=501) */
+  0x7272416465707954,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteOffset" (offset=504) */
+  0x7366664f65747962,
+  0x0000000000007465,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteOffset" (offset=507) */
+  0x6574796220746567,
+  0x000074657366664f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "buffer" (offset=510) */
+  0x0000726566667562,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get buffer" (offset=512) */
+  0x6666756220746567,
+  0x0000000000007265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "subarray" (offset=515) */
+  0x7961727261627573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "fill" (offset=518) */
+  0x000000006c6c6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "copyWithin" (offset=520) */
+  0x6874695779706f63,
+  0x0000000000006e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "sum" (offset=523) */
+  0x00000000006d7573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "dot" (offset=525) */
+  0x0000000000746f64,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "BYTES_PER_ELEMENT" (offset=527) */
+  0x45505f5345545942,
+  0x4e454d454c455f52,
+  0x0000000000000054,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "Int8Array" (offset=531) */
+  0x6172724138746e49,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Uint8Array" (offset=534) */
+  0x72724138746e6955,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int16Array" (offset=537) */
+  0x7272413631746e49,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint16Array" (offset=540) */
+  0x72413631746e6955,
+  0x0000000000796172,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int32Array" (offset=543) */
+  0x7272413233746e49,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint32Array" (offset=546) */
+  0x72413233746e6955,
+  0x0000000000796172,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float32Array" (offset=549) */
+  0x41323374616f6c46,
+  0x0000000079617272,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float64Array" (offset=552) */
+  0x41343674616f6c46,
+  0x0000000079617272,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "DataView" (offset=555) */
+  0x7765695661746144,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "getInt8" (offset=558) */
+  0x0038746e49746567,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "setInt8" (offset=560) */
+  0x0038746e49746573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getUint8" (offset=562) */
+  0x38746e6955746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setUint8" (offset=565) */
+  0x38746e6955746573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getInt16" (offset=568) */
+  0x3631746e49746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setInt16" (offset=571) */
+  0x3631746e49746573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "getUint16" (offset=574) */
+  0x31746e6955746567,
+  0x0000000000000036,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "setUint16" (offset=577) */
+  0x31746e6955746573,
+  0x0000000000000036,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getInt32" (offset=580) */
+  0x3233746e49746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setInt32" (offset=583) */
+  0x3233746e49746573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "getUint32" (offset=586) */
+  0x33746e6955746567,
+  0x0000000000000032,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "setUint32" (offset=589) */
+  0x33746e6955746573,
+  0x0000000000000032,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getFloat32" (offset=592) */
+  0x74616f6c46746567,
+  0x0000000000003233,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setFloat32" (offset=595) */
+  0x74616f6c46746573,
+  0x0000000000003233,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getFloat64" (offset=598) */
+  0x74616f6c46746567,
+  0x0000000000003436,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setFloat64" (offset=601) */
+  0x74616f6c46746573,
+  0x0000000000003436,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "isNaN" (offset=604) */
+  0x0000004e614e7369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "isFinite" (offset=606) */
+  0x6574696e69467369,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "globalThis" (offset=609) */
+  0x68546c61626f6c67,
+  0x0000000000007369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "console" (offset=612) */
+  0x00656c6f736e6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "performance" (offset=614) */
+  0x616d726f66726570,
+  0x000000000065636e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "print" (offset=617) */
+  0x000000746e697270,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "Rectangle" (offset=619) */
+  0x6c676e6174636552,
+  0x0000000000000065,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getClosure" (offset=622) */
+  0x75736f6c43746567,
+  0x0000000000006572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (1 << (JS_MTAG_BITS + 3)), /* "x" (offset=625) */
+  0x0000000000000078,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "get x" (offset=627) */
+  0x0000007820746567,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (1 << (JS_MTAG_BITS + 3)), /* "y" (offset=629) */
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "get y" (offset=631) */
+  0x0000007920746567,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (15 << (JS_MTAG_BITS + 3)), /* "FilledRectangle" (offset=633) */
+  0x655264656c6c6946,
+  0x00656c676e617463,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "color" (offset=636) */
+  0x000000726f6c6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get color" (offset=638) */
+  0x6f6c6f6320746567,
+  0x0000000000000072,
+
+  /* sorted atom table (offset=641) */
+  JS_VALUE_ARRAY_HEADER(265),
+  JS_ROM_VALUE(97), /* empty */
+  JS_ROM_VALUE(147), /* _Infinity */
+  JS_ROM_VALUE(117), /* _eval_ */
+  JS_ROM_VALUE(115), /* _ret_ */
+  JS_ROM_VALUE(305), /* Array */
+  JS_ROM_VALUE(488), /* ArrayBuffer */
+  JS_ROM_VALUE(527), /* BYTES_PER_ELEMENT */
+  JS_ROM_VALUE(246), /* Boolean */
+  JS_ROM_VALUE(555), /* DataView */
+  JS_ROM_VALUE(414), /* Date */
+  JS_ROM_VALUE(358), /* E */
+  JS_ROM_VALUE(228), /* EPSILON */
+  JS_ROM_VALUE(152), /* Error */
+  JS_ROM_VALUE(467), /* EvalError */
+  JS_ROM_VALUE(633), /* FilledRectangle */
+  JS_ROM_VALUE(549), /* Float32Array */
+  JS_ROM_VALUE(552), /* Float64Array */
+  JS_ROM_VALUE(185), /* Function */
+  JS_ROM_VALUE(144), /* Infinity */
+  JS_ROM_VALUE(537), /* Int16Array */
+  JS_ROM_VALUE(543), /* Int32Array */
+  JS_ROM_VALUE(531), /* Int8Array */
+  JS_ROM_VALUE(485), /* InternalError */
+  JS_ROM_VALUE(418), /* JSON */
+  JS_ROM_VALUE(425), /* JSONParser */
+  JS_ROM_VALUE(360), /* LN10 */
+  JS_ROM_VALUE(362), /* LN2 */
+  JS_ROM_VALUE(366), /* LOG10E */
+  JS_ROM_VALUE(364), /* LOG2E */
+  JS_ROM_VALUE(230), /* MAX_SAFE_INTEGER */
+  JS_ROM_VALUE(214), /* MAX_VALUE */
+  JS_ROM_VALUE(234), /* MIN_SAFE_INTEGER */
+  JS_ROM_VALUE(217), /* MIN_VALUE */
+  JS_ROM_VALUE(340), /* Math */
+  JS_ROM_VALUE(220), /* NEGATIVE_INFINITY */
+  JS_ROM_VALUE(142), /* NaN */
+  JS_ROM_VALUE(206), /* Number */
+  JS_ROM_VALUE(167), /* Object */
+  JS_ROM_VALUE(368), /* PI */
+  JS_ROM_VALUE(224), /* POSITIVE_INFINITY */
+  JS_ROM_VALUE(470), /* RangeError */
+  JS_ROM_VALUE(619), /* Rectangle */
+  JS_ROM_VALUE(473), /* ReferenceError */
+  JS_ROM_VALUE(432), /* RegExp */
+  JS_ROM_VALUE(370), /* SQRT1_2 */
+  JS_ROM_VALUE(372), /* SQRT2 */
+  JS_ROM_VALUE(248), /* String */
+  JS_ROM_VALUE(476), /* SyntaxError */
+  JS_ROM_VALUE(479), /* TypeError */
+  JS_ROM_VALUE(501), /* TypedArray */
+  JS_ROM_VALUE(482), /* URIError */
+  JS_ROM_VALUE(540), /* Uint16Array */
+  JS_ROM_VALUE(546), /* Uint32Array */
+  JS_ROM_VALUE(534), /* Uint8Array */
+  JS_ROM_VALUE(497), /* Uint8ClampedArray */
+  JS_ROM_VALUE(154), /* __proto__ */
+  JS_ROM_VALUE(348), /* abs */
+  JS_ROM_VALUE(382), /* acos */
+  JS_ROM_VALUE(196), /* apply */
+  JS_ROM_VALUE(121), /* arguments */
+  JS_ROM_VALUE(380), /* asin */
+  JS_ROM_VALUE(384), /* atan */
+  JS_ROM_VALUE(386), /* atan2 */
+  JS_ROM_VALUE(198), /* bind */
+  JS_ROM_VALUE(113), /* boolean */
+  JS_ROM_VALUE(161), /* bound */
+  JS_ROM_VALUE(35), /* break */
+  JS_ROM_VALUE(510), /* buffer */
+  JS_ROM_VALUE(491), /* byteLength */
+  JS_ROM_VALUE(504), /* byteOffset */
+  JS_ROM_VALUE(194), /* call */
+  JS_ROM_VALUE(42), /* case */
+  JS_ROM_VALUE(50), /* catch */
+  JS_ROM_VALUE(352), /* ceil */
+  JS_ROM_VALUE(259), /* charAt */
+  JS_ROM_VALUE(261), /* charCodeAt */
+  JS_ROM_VALUE(62), /* class */
+  JS_ROM_VALUE(398), /* clz32 */
+  JS_ROM_VALUE(264), /* codePointAt */
+  JS_ROM_VALUE(636), /* color */
+  JS_ROM_VALUE(272), /* concat */
+  JS_ROM_VALUE(612), /* console */
+  JS_ROM_VALUE(64), /* const */
+  JS_ROM_VALUE(133), /* constructor */
+  JS_ROM_VALUE(37), /* continue */
+  JS_ROM_VALUE(520), /* copyWithin */
+  JS_ROM_VALUE(376), /* cos */
+  JS_ROM_VALUE(178), /* create */
+  JS_ROM_VALUE(57), /* debugger */
+  JS_ROM_VALUE(44), /* default */
+  JS_ROM_VALUE(169), /* defineProperty */
+  JS_ROM_VALUE(16), /* delete */
+  JS_ROM_VALUE(29), /* do */
+  JS_ROM_VALUE(525), /* dot */
+  JS_ROM_VALUE(8), /* else */
+  JS_ROM_VALUE(430), /* end */
+  JS_ROM_VALUE(66), /* enum */
+  JS_ROM_VALUE(119), /* eval */
+  JS_ROM_VALUE(323), /* every */
+  JS_ROM_VALUE(453), /* exec */
+  JS_ROM_VALUE(388), /* exp */
+  JS_ROM_VALUE(68), /* export */
+  JS_ROM_VALUE(70), /* extends */
+  JS_ROM_VALUE(2), /* false */
+  JS_ROM_VALUE(518), /* fill */
+  JS_ROM_VALUE(331), /* filter */
+  JS_ROM_VALUE(52), /* finally */
+  JS_ROM_VALUE(448), /* flags */
+  JS_ROM_VALUE(350), /* floor */
+  JS_ROM_VALUE(33), /* for */
+  JS_ROM_VALUE(327), /* forEach */
+  JS_ROM_VALUE(250), /* fromCharCode */
+  JS_ROM_VALUE(253), /* fromCodePoint */
+  JS_ROM_VALUE(400), /* fround */
+  JS_ROM_VALUE(54), /* function */
+  JS_ROM_VALUE(412), /* fxdiv */
+  JS_ROM_VALUE(410), /* fxmul */
+  JS_ROM_VALUE(126), /* get */
+  JS_ROM_VALUE(512), /* get buffer */
+  JS_ROM_VALUE(494), /* get byteLength */
+  JS_ROM_VALUE(507), /* get byteOffset */
+  JS_ROM_VALUE(638), /* get color */
+  JS_ROM_VALUE(450), /* get flags */
+  JS_ROM_VALUE(437), /* get lastIndex */
+  JS_ROM_VALUE(200), /* get length */
+  JS_ROM_VALUE(459), /* get message */
+  JS_ROM_VALUE(203), /* get name */
+  JS_ROM_VALUE(188), /* get prototype */
+  JS_ROM_VALUE(445), /* get source */
+  JS_ROM_VALUE(464), /* get stack */
+  JS_ROM_VALUE(627), /* get x */
+  JS_ROM_VALUE(631), /* get y */
+  JS_ROM_VALUE(622), /* getClosure */
+  JS_ROM_VALUE(592), /* getFloat32 */
+  JS_ROM_VALUE(598), /* getFloat64 */
+  JS_ROM_VALUE(568), /* getInt16 */
+  JS_ROM_VALUE(580), /* getInt32 */
+  JS_ROM_VALUE(558), /* getInt8 */
+  JS_ROM_VALUE(172), /* getPrototypeOf */
+  JS_ROM_VALUE(574), /* getUint16 */
+  JS_ROM_VALUE(586), /* getUint32 */
+  JS_ROM_VALUE(562), /* getUint8 */
+  JS_ROM_VALUE(609), /* globalThis */
+  JS_ROM_VALUE(182), /* hasOwnProperty */
+  JS_ROM_VALUE(408), /* idiv */
+  JS_ROM_VALUE(6), /* if */
+  JS_ROM_VALUE(76), /* implements */
+  JS_ROM_VALUE(72), /* import */
+  JS_ROM_VALUE(396), /* imul */
+  JS_ROM_VALUE(24), /* in */
+  JS_ROM_VALUE(157), /* index */
+  JS_ROM_VALUE(274), /* indexOf */
+  JS_ROM_VALUE(159), /* input */
+  JS_ROM_VALUE(26), /* instanceof */
+  JS_ROM_VALUE(79), /* interface */
+  JS_ROM_VALUE(307), /* isArray */
+  JS_ROM_VALUE(606), /* isFinite */
+  JS_ROM_VALUE(604), /* isNaN */
+  JS_ROM_VALUE(313), /* join */
+  JS_ROM_VALUE(180), /* keys */
+  JS_ROM_VALUE(434), /* lastIndex */
+  JS_ROM_VALUE(276), /* lastIndexOf */
+  JS_ROM_VALUE(136), /* length */
+  JS_ROM_VALUE(82), /* let */
+  JS_ROM_VALUE(390), /* log */
+  JS_ROM_VALUE(406), /* log10 */
+  JS_ROM_VALUE(404), /* log2 */
+  JS_ROM_VALUE(329), /* map */
+  JS_ROM_VALUE(279), /* match */
+  JS_ROM_VALUE(344), /* max */
+  JS_ROM_VALUE(457), /* message */
+  JS_ROM_VALUE(342), /* min */
+  JS_ROM_VALUE(150), /* name */
+  JS_ROM_VALUE(22), /* new */
+  JS_ROM_VALUE(416), /* now */
+  JS_ROM_VALUE(0), /* null */
+  JS_ROM_VALUE(104), /* number */
+  JS_ROM_VALUE(106), /* object */
+  JS_ROM_VALUE(140), /* of */
+  JS_ROM_VALUE(84), /* package */
+  JS_ROM_VALUE(420), /* parse */
+  JS_ROM_VALUE(211), /* parseFloat */
+  JS_ROM_VALUE(208), /* parseInt */
+  JS_ROM_VALUE(614), /* performance */
+  JS_ROM_VALUE(311), /* pop */
+  JS_ROM_VALUE(392), /* pow */
+  JS_ROM_VALUE(617), /* print */
+  JS_ROM_VALUE(86), /* private */
+  JS_ROM_VALUE(88), /* protected */
+  JS_ROM_VALUE(130), /* prototype */
+  JS_ROM_VALUE(91), /* public */
+  JS_ROM_VALUE(309), /* push */
+  JS_ROM_VALUE(394), /* random */
+  JS_ROM_VALUE(163), /* rectangle_closure_test */
+  JS_ROM_VALUE(333), /* reduce */
+  JS_ROM_VALUE(335), /* reduceRight */
+  JS_ROM_VALUE(303), /* repeat */
+  JS_ROM_VALUE(281), /* replace */
+  JS_ROM_VALUE(283), /* replaceAll */
+  JS_ROM_VALUE(10), /* return */
+  JS_ROM_VALUE(315), /* reverse */
+  JS_ROM_VALUE(354), /* round */
+  JS_ROM_VALUE(286), /* search */
+  JS_ROM_VALUE(128), /* set */
+  JS_ROM_VALUE(440), /* set lastIndex */
+  JS_ROM_VALUE(256), /* set length */
+  JS_ROM_VALUE(191), /* set prototype */
+  JS_ROM_VALUE(595), /* setFloat32 */
+  JS_ROM_VALUE(601), /* setFloat64 */
+  JS_ROM_VALUE(571), /* setInt16 */
+  JS_ROM_VALUE(583), /* setInt32 */
+  JS_ROM_VALUE(560), /* setInt8 */
+  JS_ROM_VALUE(175), /* setPrototypeOf */
+  JS_ROM_VALUE(577), /* setUint16 */
+  JS_ROM_VALUE(589), /* setUint32 */
+  JS_ROM_VALUE(565), /* setUint8 */
+  JS_ROM_VALUE(317), /* shift */
+  JS_ROM_VALUE(346), /* sign */
+  JS_ROM_VALUE(374), /* sin */
+  JS_ROM_VALUE(267), /* slice */
+  JS_ROM_VALUE(325), /* some */
+  JS_ROM_VALUE(338), /* sort */
+  JS_ROM_VALUE(443), /* source */
+  JS_ROM_VALUE(319), /* splice */
+  JS_ROM_VALUE(288), /* split */
+  JS_ROM_VALUE(356), /* sqrt */
+  JS_ROM_VALUE(462), /* stack */
+  JS_ROM_VALUE(93), /* static */
+  JS_ROM_VALUE(111), /* string */
+  JS_ROM_VALUE(422), /* stringify */
+  JS_ROM_VALUE(515), /* subarray */
+  JS_ROM_VALUE(269), /* substring */
+  JS_ROM_VALUE(523), /* sum */
+  JS_ROM_VALUE(74), /* super */
+  JS_ROM_VALUE(40), /* switch */
+  JS_ROM_VALUE(378), /* tan */
+  JS_ROM_VALUE(138), /* target */
+  JS_ROM_VALUE(455), /* test */
+  JS_ROM_VALUE(14), /* this */
+  JS_ROM_VALUE(46), /* throw */
+  JS_ROM_VALUE(238), /* toExponential */
+  JS_ROM_VALUE(241), /* toFixed */
+  JS_ROM_VALUE(290), /* toLowerCase */
+  JS_ROM_VALUE(243), /* toPrecision */
+  JS_ROM_VALUE(99), /* toString */
+  JS_ROM_VALUE(293), /* toUpperCase */
+  JS_ROM_VALUE(296), /* trim */
+  JS_ROM_VALUE(298), /* trimEnd */
+  JS_ROM_VALUE(300), /* trimStart */
+  JS_ROM_VALUE(4), /* true */
+  JS_ROM_VALUE(402), /* trunc */
+  JS_ROM_VALUE(48), /* try */
+  JS_ROM_VALUE(20), /* typeof */
+  JS_ROM_VALUE(108), /* undefined */
+  JS_ROM_VALUE(321), /* unshift */
+  JS_ROM_VALUE(124), /* value */
+  JS_ROM_VALUE(102), /* valueOf */
+  JS_ROM_VALUE(12), /* var */
+  JS_ROM_VALUE(18), /* void */
+  JS_ROM_VALUE(31), /* while */
+  JS_ROM_VALUE(60), /* with */
+  JS_ROM_VALUE(428), /* write */
+  JS_ROM_VALUE(625), /* x */
+  JS_ROM_VALUE(629), /* y */
+  JS_ROM_VALUE(95), /* yield */
+
+  /* properties (offset=907) */
+  JS_VALUE_ARRAY_HEADER(24),
+  6 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  6 << 1,
+  18 << 1,
+  12 << 1,
+  21 << 1,
+  JS_ROM_VALUE(169) /* defineProperty */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 3),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(172) /* getPrototypeOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 4),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(175) /* setPrototypeOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 5),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(178) /* create */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 6),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(180) /* keys */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 7),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_OBJECT << 1,
+  (15 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=932) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  4 << 1,
+  JS_ROM_VALUE(182) /* hasOwnProperty */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 8),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 9),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_OBJECT - 1) << 1,
+  (7 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=946) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(907),
+  2,
+  JS_ROM_VALUE(932),
+  JS_NULL,
+
+  /* properties (offset=951) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_CLOSURE << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=958) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 11),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 12),
+
+  /* getset (offset=961) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 13),
+  JS_UNDEFINED,
+
+  /* getset (offset=964) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 14),
+  JS_UNDEFINED,
+
+  /* properties (offset=967) */
+  JS_VALUE_ARRAY_HEADER(30),
+  8 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  27 << 1,
+  21 << 1,
+  18 << 1,
+  24 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_ROM_VALUE(958),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(194) /* call */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 15),
+  (6 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(196) /* apply */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 16),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(198) /* bind */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 17),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 18),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(961),
+  (12 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(964),
+  (15 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_CLOSURE - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=998) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(951),
+  10,
+  JS_ROM_VALUE(967),
+  JS_NULL,
+
+  /* float64 (offset=1003) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7fefffffffffffff,
+
+  /* float64 (offset=1005) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x0000000000000001,
+
+  /* float64 (offset=1007) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff8000000000000,
+
+  /* float64 (offset=1009) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0xfff0000000000000,
+
+  /* float64 (offset=1011) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff0000000000000,
+
+  /* float64 (offset=1013) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3cb0000000000000,
+
+  /* float64 (offset=1015) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x433fffffffffffff,
+
+  /* float64 (offset=1017) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0xc33fffffffffffff,
+
+  /* properties (offset=1019) */
+  JS_VALUE_ARRAY_HEADER(43),
+  11 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  19 << 1,
+  28 << 1,
+  13 << 1,
+  40 << 1,
+  0 << 1,
+  31 << 1,
+  0 << 1,
+  34 << 1,
+  JS_ROM_VALUE(208) /* parseInt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 20),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(211) /* parseFloat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 21),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(214) /* MAX_VALUE */,
+  JS_ROM_VALUE(1003),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(217) /* MIN_VALUE */,
+  JS_ROM_VALUE(1005),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(142) /* NaN */,
+  JS_ROM_VALUE(1007),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(220) /* NEGATIVE_INFINITY */,
+  JS_ROM_VALUE(1009),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(224) /* POSITIVE_INFINITY */,
+  JS_ROM_VALUE(1011),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(228) /* EPSILON */,
+  JS_ROM_VALUE(1013),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(230) /* MAX_SAFE_INTEGER */,
+  JS_ROM_VALUE(1015),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(234) /* MIN_SAFE_INTEGER */,
+  JS_ROM_VALUE(1017),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_NUMBER << 1,
+  (37 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1063) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  18 << 1,
+  0 << 1,
+  15 << 1,
+  6 << 1,
+  JS_ROM_VALUE(238) /* toExponential */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 22),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(241) /* toFixed */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 23),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(243) /* toPrecision */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 24),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 25),
+  (12 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_NUMBER - 1) << 1,
+  (9 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1085) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1019),
+  19,
+  JS_ROM_VALUE(1063),
+  JS_NULL,
+
+  /* properties (offset=1090) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_BOOLEAN << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1097) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_BOOLEAN - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1104) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1090),
+  26,
+  JS_ROM_VALUE(1097),
+  JS_NULL,
+
+  /* properties (offset=1109) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  7 << 1,
+  10 << 1,
+  JS_ROM_VALUE(250) /* fromCharCode */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 28),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(253) /* fromCodePoint */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 29),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_STRING << 1,
+  (4 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1123) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 30),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 31),
+
+  /* properties (offset=1126) */
+  JS_VALUE_ARRAY_HEADER(76),
+  22 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  40 << 1,
+  58 << 1,
+  67 << 1,
+  61 << 1,
+  73 << 1,
+  64 << 1,
+  70 << 1,
+  46 << 1,
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1123),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(259) /* charAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 32),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(261) /* charCodeAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 33),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(264) /* codePointAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 34),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(267) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 35),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(269) /* substring */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 36),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(272) /* concat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 37),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(274) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 38),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(276) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 39),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(279) /* match */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 40),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(281) /* replace */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 41),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(283) /* replaceAll */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 42),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(286) /* search */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 43),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(288) /* split */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 44),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(290) /* toLowerCase */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 45),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(293) /* toUpperCase */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 46),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(296) /* trim */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 47),
+  (49 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(298) /* trimEnd */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 48),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(300) /* trimStart */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 49),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 50),
+  (43 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(303) /* repeat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 51),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_STRING - 1) << 1,
+  (55 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1203) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1109),
+  27,
+  JS_ROM_VALUE(1126),
+  JS_NULL,
+
+  /* properties (offset=1208) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(307) /* isArray */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 53),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1218) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 54),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 55),
+
+  /* properties (offset=1221) */
+  JS_VALUE_ARRAY_HEADER(79),
+  23 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  58 << 1,
+  13 << 1,
+  61 << 1,
+  73 << 1,
+  76 << 1,
+  46 << 1,
+  67 << 1,
+  0 << 1,
+  JS_ROM_VALUE(272) /* concat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 56),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1218),
+  (10 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(309) /* push */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 57),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(311) /* pop */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 58),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(313) /* join */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 59),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 60),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(315) /* reverse */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 61),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(317) /* shift */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 62),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(267) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 63),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(319) /* splice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 64),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(321) /* unshift */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 65),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(274) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 66),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(276) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 67),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(323) /* every */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 68),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(325) /* some */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 69),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(327) /* forEach */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 70),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(329) /* map */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 71),
+  (40 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(331) /* filter */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 72),
+  (49 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(333) /* reduce */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 73),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(335) /* reduceRight */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 74),
+  (55 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(333) /* reduce */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 73),
+  (64 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(338) /* sort */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 75),
+  (43 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ARRAY - 1) << 1,
+  (70 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1301) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1208),
+  52,
+  JS_ROM_VALUE(1221),
+  JS_NULL,
+
+  /* float64 (offset=1306) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x4005bf0a8b145769,
+
+  /* float64 (offset=1308) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x40026bb1bbb55516,
+
+  /* float64 (offset=1310) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3fe62e42fefa39ef,
+
+  /* float64 (offset=1312) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3ff71547652b82fe,
+
+  /* float64 (offset=1314) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3fdbcb7b1526e50e,
+
+  /* float64 (offset=1316) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x400921fb54442d18,
+
+  /* float64 (offset=1318) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3fe6a09e667f3bcd,
+
+  /* float64 (offset=1320) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3ff6a09e667f3bcd,
+
+  /* properties (offset=1322) */
+  JS_VALUE_ARRAY_HEADER(118),
+  36 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  0 << 1,
+  109 << 1,
+  0 << 1,
+  112 << 1,
+  34 << 1,
+  115 << 1,
+  0 << 1,
+  106 << 1,
+  JS_ROM_VALUE(342) /* min */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 76),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(344) /* max */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 77),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(346) /* sign */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 78),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(348) /* abs */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 79),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(350) /* floor */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 80),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(352) /* ceil */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 81),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(354) /* round */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 82),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(356) /* sqrt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 83),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_STRING_CHAR, 69) /* E */,
+  JS_ROM_VALUE(1306),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(360) /* LN10 */,
+  JS_ROM_VALUE(1308),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(362) /* LN2 */,
+  JS_ROM_VALUE(1310),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(364) /* LOG2E */,
+  JS_ROM_VALUE(1312),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(366) /* LOG10E */,
+  JS_ROM_VALUE(1314),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(368) /* PI */,
+  JS_ROM_VALUE(1316),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(370) /* SQRT1_2 */,
+  JS_ROM_VALUE(1318),
+  (40 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(372) /* SQRT2 */,
+  JS_ROM_VALUE(1320),
+  (43 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(374) /* sin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 84),
+  (46 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(376) /* cos */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 85),
+  (49 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(378) /* tan */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 86),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(380) /* asin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 87),
+  (55 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(382) /* acos */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 88),
+  (58 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(384) /* atan */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 89),
+  (61 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(386) /* atan2 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 90),
+  (64 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(388) /* exp */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 91),
+  (67 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(390) /* log */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 92),
+  (70 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(392) /* pow */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 93),
+  (73 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(394) /* random */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 94),
+  (76 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(396) /* imul */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 95),
+  (79 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(398) /* clz32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 96),
+  (82 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(400) /* fround */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 97),
+  (85 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(402) /* trunc */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 98),
+  (88 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(404) /* log2 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 99),
+  (91 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(406) /* log10 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 100),
+  (94 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(408) /* idiv */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 101),
+  (97 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(410) /* fxmul */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 102),
+  (100 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(412) /* fxdiv */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 103),
+  (103 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=1441) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1322),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=1446) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(416) /* now */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 105),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_DATE << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1456) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_DATE - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1463) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1446),
+  104,
+  JS_ROM_VALUE(1456),
+  JS_NULL,
+
+  /* properties (offset=1468) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(420) /* parse */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 106),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(422) /* stringify */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 107),
+  (3 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=1478) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1468),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=1483) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_JSON_PARSER << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1490) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  7 << 1,
+  JS_ROM_VALUE(428) /* write */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 109),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(430) /* end */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 110),
+  (4 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_JSON_PARSER - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1504) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1483),
+  108,
+  JS_ROM_VALUE(1490),
+  JS_NULL,
+
+  /* properties (offset=1509) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_REGEXP << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1516) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 112),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 113),
+
+  /* getset (offset=1519) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 114),
+  JS_UNDEFINED,
+
+  /* getset (offset=1522) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 115),
+  JS_UNDEFINED,
+
+  /* properties (offset=1525) */
+  JS_VALUE_ARRAY_HEADER(24),
+  6 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  21 << 1,
+  12 << 1,
+  18 << 1,
+  6 << 1,
+  JS_ROM_VALUE(434) /* lastIndex */,
+  JS_ROM_VALUE(1516),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(443) /* source */,
+  JS_ROM_VALUE(1519),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(448) /* flags */,
+  JS_ROM_VALUE(1522),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(453) /* exec */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 116),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(455) /* test */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 117),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_REGEXP - 1) << 1,
+  (15 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1550) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1509),
+  111,
+  JS_ROM_VALUE(1525),
+  JS_NULL,
+
+  /* properties (offset=1555) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1562) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 119),
+  JS_UNDEFINED,
+
+  /* getset (offset=1565) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 120),
+  JS_UNDEFINED,
+
+  /* properties (offset=1568) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  18 << 1,
+  0 << 1,
+  6 << 1,
+  15 << 1,
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 121),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(152) /* Error */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(457) /* message */,
+  JS_ROM_VALUE(1562),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(462) /* stack */,
+  JS_ROM_VALUE(1565),
+  (9 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ERROR - 1) << 1,
+  (12 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1590) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1555),
+  118,
+  JS_ROM_VALUE(1568),
+  JS_NULL,
+
+  /* properties (offset=1595) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_EVAL_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1602) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(467) /* EvalError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_EVAL_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1612) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1595),
+  122,
+  JS_ROM_VALUE(1602),
+  JS_ROM_VALUE(1590),
+
+  /* properties (offset=1617) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_RANGE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1624) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(470) /* RangeError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_RANGE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1634) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1617),
+  123,
+  JS_ROM_VALUE(1624),
+  JS_ROM_VALUE(1590),
+
+  /* properties (offset=1639) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_REFERENCE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1646) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(473) /* ReferenceError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_REFERENCE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1656) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1639),
+  124,
+  JS_ROM_VALUE(1646),
+  JS_ROM_VALUE(1590),
+
+  /* properties (offset=1661) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_SYNTAX_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1668) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(476) /* SyntaxError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_SYNTAX_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1678) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1661),
+  125,
+  JS_ROM_VALUE(1668),
+  JS_ROM_VALUE(1590),
+
+  /* properties (offset=1683) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_TYPE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1690) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(479) /* TypeError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_TYPE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1700) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1683),
+  126,
+  JS_ROM_VALUE(1690),
+  JS_ROM_VALUE(1590),
+
+  /* properties (offset=1705) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_URI_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1712) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(482) /* URIError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_URI_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1722) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1705),
+  127,
+  JS_ROM_VALUE(1712),
+  JS_ROM_VALUE(1590),
+
+  /* properties (offset=1727) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INTERNAL_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1734) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(485) /* InternalError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INTERNAL_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1744) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1727),
+  128,
+  JS_ROM_VALUE(1734),
+  JS_ROM_VALUE(1590),
+
+  /* properties (offset=1749) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ARRAY_BUFFER << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1756) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 130),
+  JS_UNDEFINED,
+
+  /* properties (offset=1759) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(491) /* byteLength */,
+  JS_ROM_VALUE(1756),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ARRAY_BUFFER - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1769) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1749),
+  129,
+  JS_ROM_VALUE(1759),
+  JS_NULL,
+
+  /* properties (offset=1774) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_TYPED_ARRAY << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1781) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 132),
+  JS_UNDEFINED,
+
+  /* getset (offset=1784) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 133),
+  JS_UNDEFINED,
+
+  /* getset (offset=1787) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 134),
+  JS_UNDEFINED,
+
+  /* getset (offset=1790) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 135),
+  JS_UNDEFINED,
+
+  /* properties (offset=1793) */
+  JS_VALUE_ARRAY_HEADER(64),
+  18 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  22 << 1,
+  55 << 1,
+  49 << 1,
+  40 << 1,
+  61 << 1,
+  43 << 1,
+  0 << 1,
+  52 << 1,
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1781),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(491) /* byteLength */,
+  JS_ROM_VALUE(1784),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(504) /* byteOffset */,
+  JS_ROM_VALUE(1787),
+  (10 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(510) /* buffer */,
+  JS_ROM_VALUE(1790),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(313) /* join */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 59),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 60),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(515) /* subarray */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 136),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(128) /* set */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 137),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(518) /* fill */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 138),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(520) /* copyWithin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 139),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(274) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 140),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(276) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 141),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(267) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 142),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(523) /* sum */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 143),
+  (46 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(342) /* min */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 144),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(344) /* max */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 145),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(525) /* dot */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 146),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_TYPED_ARRAY - 1) << 1,
+  (58 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1858) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1774),
+  131,
+  JS_ROM_VALUE(1793),
+  JS_NULL,
+
+  /* properties (offset=1863) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT8C_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1873) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT8C_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1883) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1863),
+  147,
+  JS_ROM_VALUE(1873),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=1888) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT8_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1898) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT8_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1908) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1888),
+  148,
+  JS_ROM_VALUE(1898),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=1913) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT8_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1923) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT8_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1933) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1913),
+  149,
+  JS_ROM_VALUE(1923),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=1938) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT16_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1948) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT16_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1958) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1938),
+  150,
+  JS_ROM_VALUE(1948),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=1963) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT16_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1973) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT16_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1983) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1963),
+  151,
+  JS_ROM_VALUE(1973),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=1988) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1998) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2008) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1988),
+  152,
+  JS_ROM_VALUE(1998),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=2013) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=2023) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2033) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2013),
+  153,
+  JS_ROM_VALUE(2023),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=2038) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_FLOAT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=2048) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_FLOAT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2058) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2038),
+  154,
+  JS_ROM_VALUE(2048),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=2063) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  8 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_FLOAT64_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=2073) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(527) /* BYTES_PER_ELEMENT */,
+  8 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_FLOAT64_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2083) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2063),
+  155,
+  JS_ROM_VALUE(2073),
+  JS_ROM_VALUE(1858),
+
+  /* properties (offset=2088) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_DATA_VIEW << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=2095) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 157),
+  JS_UNDEFINED,
+
+  /* getset (offset=2098) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 158),
+  JS_UNDEFINED,
+
+  /* getset (offset=2101) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 159),
+  JS_UNDEFINED,
+
+  /* properties (offset=2104) */
+  JS_VALUE_ARRAY_HEADER(70),
+  20 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  64 << 1,
+  55 << 1,
+  58 << 1,
+  49 << 1,
+  67 << 1,
+  43 << 1,
+  46 << 1,
+  61 << 1,
+  JS_ROM_VALUE(491) /* byteLength */,
+  JS_ROM_VALUE(2095),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(504) /* byteOffset */,
+  JS_ROM_VALUE(2098),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(510) /* buffer */,
+  JS_ROM_VALUE(2101),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(558) /* getInt8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 160),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(560) /* setInt8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 161),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(562) /* getUint8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 162),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(565) /* setUint8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 163),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(568) /* getInt16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 164),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(571) /* setInt16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 165),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(574) /* getUint16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 166),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(577) /* setUint16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 167),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(580) /* getInt32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 168),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(583) /* setInt32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 169),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(586) /* getUint32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 170),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(589) /* setUint32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 171),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(592) /* getFloat32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 172),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(595) /* setFloat32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 173),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(598) /* getFloat64 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 174),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(601) /* setFloat64 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 175),
+  (40 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_DATA_VIEW - 1) << 1,
+  (52 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2175) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2088),
+  156,
+  JS_ROM_VALUE(2104),
+  JS_NULL,
+
+  /* float64 (offset=2180) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff0000000000000,
+
+  /* float64 (offset=2182) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff8000000000000,
+
+  /* properties (offset=2184) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(390) /* log */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 176),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2191) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2184),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=2196) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(416) /* now */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 177),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2203) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2196),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=2208) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  0 << 1,
+  10 << 1,
+  JS_ROM_VALUE(622) /* getClosure */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 179),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(194) /* call */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 180),
+  (4 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_RECTANGLE << 1,
+  (7 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=2222) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 181),
+  JS_UNDEFINED,
+
+  /* getset (offset=2225) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 182),
+  JS_UNDEFINED,
+
+  /* properties (offset=2228) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  0 << 1,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_STRING_CHAR, 120) /* x */,
+  JS_ROM_VALUE(2222),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_STRING_CHAR, 121) /* y */,
+  JS_ROM_VALUE(2225),
+  (4 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_RECTANGLE - 1) << 1,
+  (7 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2242) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2208),
+  178,
+  JS_ROM_VALUE(2228),
+  JS_NULL,
+
+  /* properties (offset=2247) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_FILLED_RECTANGLE << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=2254) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 184),
+  JS_UNDEFINED,
+
+  /* properties (offset=2257) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(636) /* color */,
+  JS_ROM_VALUE(2254),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_FILLED_RECTANGLE - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2267) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2247),
+  183,
+  JS_ROM_VALUE(2257),
+  JS_ROM_VALUE(2242),
+
+  /* global object properties (offset=2272) */
+  JS_VALUE_ARRAY_HEADER(88),
+  JS_ROM_VALUE(167) /* Object */,
+  JS_ROM_VALUE(946),
+  JS_ROM_VALUE(185) /* Function */,
+  JS_ROM_VALUE(998),
+  JS_ROM_VALUE(206) /* Number */,
+  JS_ROM_VALUE(1085),
+  JS_ROM_VALUE(246) /* Boolean */,
+  JS_ROM_VALUE(1104),
+  JS_ROM_VALUE(248) /* String */,
+  JS_ROM_VALUE(1203),
+  JS_ROM_VALUE(305) /* Array */,
+  JS_ROM_VALUE(1301),
+  JS_ROM_VALUE(340) /* Math */,
+  JS_ROM_VALUE(1441),
+  JS_ROM_VALUE(414) /* Date */,
+  JS_ROM_VALUE(1463),
+  JS_ROM_VALUE(418) /* JSON */,
+  JS_ROM_VALUE(1478),
+  JS_ROM_VALUE(425) /* JSONParser */,
+  JS_ROM_VALUE(1504),
+  JS_ROM_VALUE(432) /* RegExp */,
+  JS_ROM_VALUE(1550),
+  JS_ROM_VALUE(152) /* Error */,
+  JS_ROM_VALUE(1590),
+  JS_ROM_VALUE(467) /* EvalError */,
+  JS_ROM_VALUE(1612),
+  JS_ROM_VALUE(470) /* RangeError */,
+  JS_ROM_VALUE(1634),
+  JS_ROM_VALUE(473) /* ReferenceError */,
+  JS_ROM_VALUE(1656),
+  JS_ROM_VALUE(476) /* SyntaxError */,
+  JS_ROM_VALUE(1678),
+  JS_ROM_VALUE(479) /* TypeError */,
+  JS_ROM_VALUE(1700),
+  JS_ROM_VALUE(482) /* URIError */,
+  JS_ROM_VALUE(1722),
+  JS_ROM_VALUE(485) /* InternalError */,
+  JS_ROM_VALUE(1744),
+  JS_ROM_VALUE(488) /* ArrayBuffer */,
+  JS_ROM_VALUE(1769),
+  JS_ROM_VALUE(497) /* Uint8ClampedArray */,
+  JS_ROM_VALUE(1883),
+  JS_ROM_VALUE(531) /* Int8Array */,
+  JS_ROM_VALUE(1908),
+  JS_ROM_VALUE(534) /* Uint8Array */,
+  JS_ROM_VALUE(1933),
+  JS_ROM_VALUE(537) /* Int16Array */,
+  JS_ROM_VALUE(1958),
+  JS_ROM_VALUE(540) /* Uint16Array */,
+  JS_ROM_VALUE(1983),
+  JS_ROM_VALUE(543) /* Int32Array */,
+  JS_ROM_VALUE(2008),
+  JS_ROM_VALUE(546) /* Uint32Array */,
+  JS_ROM_VALUE(2033),
+  JS_ROM_VALUE(549) /* Float32Array */,
+  JS_ROM_VALUE(2058),
+  JS_ROM_VALUE(552) /* Float64Array */,
+  JS_ROM_VALUE(2083),
+  JS_ROM_VALUE(555) /* DataView */,
+  JS_ROM_VALUE(2175),
+  JS_ROM_VALUE(208) /* parseInt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 20),
+  JS_ROM_VALUE(211) /* parseFloat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 21),
+  JS_ROM_VALUE(119) /* eval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 185),
+  JS_ROM_VALUE(604) /* isNaN */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 186),
+  JS_ROM_VALUE(606) /* isFinite */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 187),
+  JS_ROM_VALUE(144) /* Infinity */,
+  JS_ROM_VALUE(2180),
+  JS_ROM_VALUE(142) /* NaN */,
+  JS_ROM_VALUE(2182),
+  JS_ROM_VALUE(108) /* undefined */,
+  JS_UNDEFINED,
+  JS_ROM_VALUE(609) /* globalThis */,
+  JS_NULL,
+  JS_ROM_VALUE(612) /* console */,
+  JS_ROM_VALUE(2191),
+  JS_ROM_VALUE(614) /* performance */,
+  JS_ROM_VALUE(2203),
+  JS_ROM_VALUE(617) /* print */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 188),
+  JS_ROM_VALUE(619) /* Rectangle */,
+  JS_ROM_VALUE(2242),
+  JS_ROM_VALUE(633) /* FilledRectangle */,
+  JS_ROM_VALUE(2267),
+};
+
+static const uint16_t js_atom_hash_table[] = {
+  /* bucket displacements */
+  0, 1, 1, 1, 10, 0, 1, 2, 1, 0, 0, 0, 1, 0, 0, 4,
+  2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 1,
+  0, 0, 0, 1, 0, 2, 3, 4, 0, 4, 1, 1, 0, 2, 0, 1,
+  1, 0, 1, 4, 1, 0, 2, 0, 1, 0, 4, 0, 0, 0, 2, 0,
+  1, 1, 0, 3, 0, 5, 0, 7, 0, 0, 0, 1, 0, 0, 1, 0,
+  0, 1, 0, 3, 2, 0, 0, 0, 0, 0, 1, 4, 0, 3, 2, 0,
+  1, 0, 1, 1, 2, 0, 0, 2, 0, 2, 1, 1, 0, 0, 0, 1,
+  0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 3, 1, 1, 2, 0, 6,
+  /* sorted atom table index of each slot */
+  65535, 65535, 148, 65535, 61, 65535, 69, 47, 131, 65535, 65535, 65535, 248, 220, 65535, 65535,
+  115, 65535, 52, 158, 65535, 65535, 65535, 101, 160, 65535, 65535, 109, 199, 164, 65535, 63,
+  65535, 249, 11, 65535, 88, 65535, 65535, 65535, 30, 28, 65535, 32, 74, 65535, 161, 65535,
+  10, 221, 133, 235, 166, 65535, 187, 65535, 65535, 65535, 65535, 65535, 137, 65535, 97, 65535,
+  179, 65535, 162, 65535, 65535, 65535, 65535, 65535, 65535, 217, 65535, 233, 65535, 227, 211, 193,
+  65535, 65535, 65535, 56, 262, 192, 122, 136, 254, 236, 65535, 106, 65535, 147, 65535, 0,
+  65535, 203, 21, 145, 65535, 65535, 65535, 123, 197, 65535, 65535, 23, 144, 65535, 175, 168,
+  252, 26, 181, 65535, 135, 65535, 7, 224, 92, 258, 65535, 65535, 65535, 66, 65535, 65535,
+  257, 65535, 65535, 246, 263, 4, 65535, 134, 65535, 65535, 65535, 65535, 65535, 232, 225, 65535,
+  65535, 71, 65535, 201, 65535, 152, 65535, 65535, 65535, 182, 169, 65535, 65535, 99, 65535, 65535,
+  195, 65535, 65535, 65535, 253, 65535, 65535, 65535, 65535, 202, 20, 154, 165, 200, 65535, 65535,
+  65535, 104, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 116, 177, 65535, 89, 15, 167,
+  111, 223, 65535, 218, 184, 65535, 114, 65535, 65535, 40, 239, 173, 65535, 50, 189, 65535,
+  19, 41, 65535, 65535, 119, 65535, 65535, 198, 65535, 156, 141, 65535, 65535, 65535, 205, 53,
+  126, 65535, 65535, 65535, 222, 231, 65535, 107, 65535, 65535, 65535, 157, 190, 65535, 65535, 113,
+  65535, 65535, 112, 33, 98, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 244, 65535, 65535, 251,
+  5, 250, 65535, 65535, 194, 65535, 138, 14, 94, 65535, 206, 65535, 65535, 65535, 65535, 65535,
+  54, 65535, 229, 65535, 65535, 234, 65535, 87, 209, 176, 142, 65535, 93, 78, 65535, 65535,
+  25, 39, 191, 65535, 2, 27, 22, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 146, 124,
+  178, 65535, 208, 65, 49, 120, 226, 60, 42, 48, 65535, 65535, 51, 65535, 80, 125,
+  82, 105, 65535, 65535, 127, 65535, 65535, 65535, 139, 65535, 260, 149, 65535, 65535, 65535, 207,
+  6, 65535, 65535, 65535, 150, 55, 96, 171, 65535, 214, 73, 256, 65535, 24, 65535, 65535,
+  172, 129, 65535, 79, 196, 185, 64, 65535, 65535, 100, 65535, 259, 65535, 65535, 163, 43,
+  212, 18, 31, 44, 65535, 65535, 65535, 65535, 215, 81, 65535, 117, 72, 261, 65535, 65535,
+  65535, 90, 245, 58, 45, 228, 65535, 210, 159, 132, 85, 153, 65535, 130, 183, 65535,
+  238, 65535, 108, 12, 29, 65535, 65535, 65535, 65535, 8, 3, 242, 65535, 170, 83, 65535,
+  36, 65535, 67, 1, 174, 65535, 57, 95, 65535, 204, 65535, 77, 180, 65535, 59, 65535,
+  240, 70, 155, 62, 37, 65535, 9, 140, 65535, 65535, 65535, 188, 13, 65535, 65535, 65535,
+  65535, 65535, 65535, 247, 255, 65535, 237, 65535, 65535, 75, 65535, 121, 84, 143, 91, 65535,
+  65535, 65535, 65535, 213, 65535, 46, 65535, 219, 65535, 128, 65535, 35, 186, 16, 151, 65535,
+  118, 34, 65535, 65535, 65535, 241, 65535, 65535, 264, 86, 65535, 65535, 216, 65535, 65535, 65535,
+  65535, 102, 68, 65535, 76, 17, 65535, 38, 65535, 230, 110, 243, 65535, 65535, 65535, 103,
+};
+
+static const JSCFunctionDef js_c_function_table[] = {
+  { { .generic_params = js_function_bound },
+    JS_ROM_VALUE(161) /* bound */,
+    JS_CFUNC_generic_params, 0, 0 },
+  { { .generic_params = js_rectangle_closure_test },
+    JS_ROM_VALUE(163) /* rectangle_closure_test */,
+    JS_CFUNC_generic_params, 0, 0 },
+  { { .constructor = js_object_constructor },
+    JS_ROM_VALUE(167) /* Object */,
+    JS_CFUNC_constructor, 1, JS_CLASS_OBJECT },
+  { { .generic = js_object_defineProperty },
+    JS_ROM_VALUE(169) /* defineProperty */,
+    JS_CFUNC_generic, 3, 0 },
+  { { .generic = js_object_getPrototypeOf },
+    JS_ROM_VALUE(172) /* getPrototypeOf */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_setPrototypeOf },
+    JS_ROM_VALUE(175) /* setPrototypeOf */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_object_create },
+    JS_ROM_VALUE(178) /* create */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_object_keys },
+    JS_ROM_VALUE(180) /* keys */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_hasOwnProperty },
+    JS_ROM_VALUE(182) /* hasOwnProperty */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_function_constructor },
+    JS_ROM_VALUE(185) /* Function */,
+    JS_CFUNC_constructor, 1, JS_CLASS_CLOSURE },
+  { { .generic = js_function_get_prototype },
+    JS_ROM_VALUE(188) /* get prototype */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_function_set_prototype },
+    JS_ROM_VALUE(191) /* set prototype */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_function_get_length_name },
+    JS_ROM_VALUE(200) /* get length */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_function_get_length_name },
+    JS_ROM_VALUE(203) /* get name */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_function_call },
+    JS_ROM_VALUE(194) /* call */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_function_apply },
+    JS_ROM_VALUE(196) /* apply */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_function_bind },
+    JS_ROM_VALUE(198) /* bind */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_function_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_number_constructor },
+    JS_ROM_VALUE(206) /* Number */,
+    JS_CFUNC_constructor, 1, JS_CLASS_NUMBER },
+  { { .generic = js_number_parseInt },
+    JS_ROM_VALUE(208) /* parseInt */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_number_parseFloat },
+    JS_ROM_VALUE(211) /* parseFloat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toExponential },
+    JS_ROM_VALUE(238) /* toExponential */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toFixed },
+    JS_ROM_VALUE(241) /* toFixed */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toPrecision },
+    JS_ROM_VALUE(243) /* toPrecision */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor = js_boolean_constructor },
+    JS_ROM_VALUE(246) /* Boolean */,
+    JS_CFUNC_constructor, 1, JS_CLASS_BOOLEAN },
+  { { .constructor = js_string_constructor },
+    JS_ROM_VALUE(248) /* String */,
+    JS_CFUNC_constructor, 1, JS_CLASS_STRING },
+  { { .generic_magic = js_string_fromCharCode },
+    JS_ROM_VALUE(250) /* fromCharCode */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_string_fromCharCode },
+    JS_ROM_VALUE(253) /* fromCodePoint */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_string_get_length },
+    JS_ROM_VALUE(200) /* get length */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_string_set_length },
+    JS_ROM_VALUE(256) /* set length */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(259) /* charAt */,
+    JS_CFUNC_generic_magic, 1, magic_charAt },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(261) /* charCodeAt */,
+    JS_CFUNC_generic_magic, 1, magic_charCodeAt },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(264) /* codePointAt */,
+    JS_CFUNC_generic_magic, 1, magic_codePointAt },
+  { { .generic = js_string_slice },
+    JS_ROM_VALUE(267) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_string_substring },
+    JS_ROM_VALUE(269) /* substring */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_string_concat },
+    JS_ROM_VALUE(272) /* concat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_indexOf },
+    JS_ROM_VALUE(274) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_string_indexOf },
+    JS_ROM_VALUE(276) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_string_match },
+    JS_ROM_VALUE(279) /* match */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_replace },
+    JS_ROM_VALUE(281) /* replace */,
+    JS_CFUNC_generic_magic, 2, 0 },
+  { { .generic_magic = js_string_replace },
+    JS_ROM_VALUE(283) /* replaceAll */,
+    JS_CFUNC_generic_magic, 2, 1 },
+  { { .generic = js_string_search },
+    JS_ROM_VALUE(286) /* search */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_string_split },
+    JS_ROM_VALUE(288) /* split */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_string_toLowerCase },
+    JS_ROM_VALUE(290) /* toLowerCase */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_string_toLowerCase },
+    JS_ROM_VALUE(293) /* toUpperCase */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(296) /* trim */,
+    JS_CFUNC_generic_magic, 0, 3 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(298) /* trimEnd */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(300) /* trimStart */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_string_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_string_repeat },
+    JS_ROM_VALUE(303) /* repeat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor = js_array_constructor },
+    JS_ROM_VALUE(305) /* Array */,
+    JS_CFUNC_constructor, 1, JS_CLASS_ARRAY },
+  { { .generic = js_array_isArray },
+    JS_ROM_VALUE(307) /* isArray */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_get_length },
+    JS_ROM_VALUE(200) /* get length */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_set_length },
+    JS_ROM_VALUE(256) /* set length */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_concat },
+    JS_ROM_VALUE(272) /* concat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_array_push },
+    JS_ROM_VALUE(309) /* push */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic = js_array_pop },
+    JS_ROM_VALUE(311) /* pop */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_join },
+    JS_ROM_VALUE(313) /* join */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_reverse },
+    JS_ROM_VALUE(315) /* reverse */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_shift },
+    JS_ROM_VALUE(317) /* shift */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_slice },
+    JS_ROM_VALUE(267) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_array_splice },
+    JS_ROM_VALUE(319) /* splice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_array_push },
+    JS_ROM_VALUE(321) /* unshift */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic_magic = js_array_indexOf },
+    JS_ROM_VALUE(274) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_array_indexOf },
+    JS_ROM_VALUE(276) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(323) /* every */,
+    JS_CFUNC_generic_magic, 1, js_special_every },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(325) /* some */,
+    JS_CFUNC_generic_magic, 1, js_special_some },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(327) /* forEach */,
+    JS_CFUNC_generic_magic, 1, js_special_forEach },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(329) /* map */,
+    JS_CFUNC_generic_magic, 1, js_special_map },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(331) /* filter */,
+    JS_CFUNC_generic_magic, 1, js_special_filter },
+  { { .generic_magic = js_array_reduce },
+    JS_ROM_VALUE(333) /* reduce */,
+    JS_CFUNC_generic_magic, 1, js_special_reduce },
+  { { .generic_magic = js_array_reduce },
+    JS_ROM_VALUE(335) /* reduceRight */,
+    JS_CFUNC_generic_magic, 1, js_special_reduceRight },
+  { { .generic = js_array_sort },
+    JS_ROM_VALUE(338) /* sort */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_math_min_max },
+    JS_ROM_VALUE(342) /* min */,
+    JS_CFUNC_generic_magic, 2, 0 },
+  { { .generic_magic = js_math_min_max },
+    JS_ROM_VALUE(344) /* max */,
+    JS_CFUNC_generic_magic, 2, 1 },
+  { { .f_f = js_math_sign },
+    JS_ROM_VALUE(346) /* sign */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_fabs },
+    JS_ROM_VALUE(348) /* abs */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_floor },
+    JS_ROM_VALUE(350) /* floor */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_ceil },
+    JS_ROM_VALUE(352) /* ceil */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_round_inf },
+    JS_ROM_VALUE(354) /* round */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_sqrt },
+    JS_ROM_VALUE(356) /* sqrt */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_sin },
+    JS_ROM_VALUE(374) /* sin */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_cos },
+    JS_ROM_VALUE(376) /* cos */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_tan },
+    JS_ROM_VALUE(378) /* tan */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_asin },
+    JS_ROM_VALUE(380) /* asin */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_acos },
+    JS_ROM_VALUE(382) /* acos */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_atan },
+    JS_ROM_VALUE(384) /* atan */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_ff = js_atan2 },
+    JS_ROM_VALUE(386) /* atan2 */,
+    JS_CFUNC_f_ff, 2, 0 },
+  { { .f_f = js_exp },
+    JS_ROM_VALUE(388) /* exp */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_log },
+    JS_ROM_VALUE(390) /* log */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_ff = js_pow },
+    JS_ROM_VALUE(392) /* pow */,
+    JS_CFUNC_f_ff, 2, 0 },
+  { { .generic = js_math_random },
+    JS_ROM_VALUE(394) /* random */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .i_ii = js_math_imul },
+    JS_ROM_VALUE(396) /* imul */,
+    JS_CFUNC_i_ii, 2, 0 },
+  { { .generic = js_math_clz32 },
+    JS_ROM_VALUE(398) /* clz32 */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .f_f = js_math_fround },
+    JS_ROM_VALUE(400) /* fround */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_trunc },
+    JS_ROM_VALUE(402) /* trunc */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_log2 },
+    JS_ROM_VALUE(404) /* log2 */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_log10 },
+    JS_ROM_VALUE(406) /* log10 */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .i_ii = js_math_idiv },
+    JS_ROM_VALUE(408) /* idiv */,
+    JS_CFUNC_i_ii, 2, 0 },
+  { { .i_iii = js_math_fxmul },
+    JS_ROM_VALUE(410) /* fxmul */,
+    JS_CFUNC_i_iii, 3, 0 },
+  { { .i_iii = js_math_fxdiv },
+    JS_ROM_VALUE(412) /* fxdiv */,
+    JS_CFUNC_i_iii, 3, 0 },
+  { { .constructor = js_date_constructor },
+    JS_ROM_VALUE(414) /* Date */,
+    JS_CFUNC_constructor, 7, JS_CLASS_DATE },
+  { { .generic = js_date_now },
+    JS_ROM_VALUE(416) /* now */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_json_parse },
+    JS_ROM_VALUE(420) /* parse */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_json_stringify },
+    JS_ROM_VALUE(422) /* stringify */,
+    JS_CFUNC_generic, 3, 0 },
+  { { .constructor = js_json_parser_constructor },
+    JS_ROM_VALUE(425) /* JSONParser */,
+    JS_CFUNC_constructor, 2, JS_CLASS_JSON_PARSER },
+  { { .generic = js_json_parser_write_chunk },
+    JS_ROM_VALUE(428) /* write */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_json_parser_end_input },
+    JS_ROM_VALUE(430) /* end */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_regexp_constructor },
+    JS_ROM_VALUE(432) /* RegExp */,
+    JS_CFUNC_constructor, 2, JS_CLASS_REGEXP },
+  { { .generic = js_regexp_get_lastIndex },
+    JS_ROM_VALUE(437) /* get lastIndex */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_regexp_set_lastIndex },
+    JS_ROM_VALUE(440) /* set lastIndex */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_regexp_get_source },
+    JS_ROM_VALUE(445) /* get source */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_regexp_get_flags },
+    JS_ROM_VALUE(450) /* get flags */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic_magic = js_regexp_exec },
+    JS_ROM_VALUE(453) /* exec */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_regexp_exec },
+    JS_ROM_VALUE(455) /* test */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(152) /* Error */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_ERROR },
+  { { .generic_magic = js_error_get_message },
+    JS_ROM_VALUE(459) /* get message */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_error_get_message },
+    JS_ROM_VALUE(464) /* get stack */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_error_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(467) /* EvalError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_EVAL_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(470) /* RangeError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_RANGE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(473) /* ReferenceError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_REFERENCE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(476) /* SyntaxError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_SYNTAX_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(479) /* TypeError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_TYPE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(482) /* URIError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_URI_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(485) /* InternalError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_INTERNAL_ERROR },
+  { { .constructor = js_array_buffer_constructor },
+    JS_ROM_VALUE(488) /* ArrayBuffer */,
+    JS_CFUNC_constructor, 1, JS_CLASS_ARRAY_BUFFER },
+  { { .generic = js_array_buffer_get_byteLength },
+    JS_ROM_VALUE(494) /* get byteLength */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_typed_array_base_constructor },
+    JS_ROM_VALUE(501) /* TypedArray */,
+    JS_CFUNC_constructor, 0, JS_CLASS_TYPED_ARRAY },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(200) /* get length */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(494) /* get byteLength */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(507) /* get byteOffset */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(512) /* get buffer */,
+    JS_CFUNC_generic_magic, 0, 3 },
+  { { .generic = js_typed_array_subarray },
+    JS_ROM_VALUE(515) /* subarray */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_typed_array_set },
+    JS_ROM_VALUE(128) /* set */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_typed_array_fill },
+    JS_ROM_VALUE(518) /* fill */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_typed_array_copyWithin },
+    JS_ROM_VALUE(520) /* copyWithin */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_typed_array_indexOf },
+    JS_ROM_VALUE(274) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_typed_array_indexOf },
+    JS_ROM_VALUE(276) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_typed_array_slice },
+    JS_ROM_VALUE(267) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_typed_array_sum },
+    JS_ROM_VALUE(523) /* sum */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic_magic = js_typed_array_min_max },
+    JS_ROM_VALUE(342) /* min */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_typed_array_min_max },
+    JS_ROM_VALUE(344) /* max */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_typed_array_dot },
+    JS_ROM_VALUE(525) /* dot */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(497) /* Uint8ClampedArray */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT8C_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(531) /* Int8Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT8_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(534) /* Uint8Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT8_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(537) /* Int16Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT16_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(540) /* Uint16Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT16_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(543) /* Int32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(546) /* Uint32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(549) /* Float32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_FLOAT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(552) /* Float64Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_FLOAT64_ARRAY },
+  { { .constructor = js_dataview_constructor },
+    JS_ROM_VALUE(555) /* DataView */,
+    JS_CFUNC_constructor, 3, JS_CLASS_DATA_VIEW },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(494) /* get byteLength */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(507) /* get byteOffset */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(512) /* get buffer */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(558) /* getInt8 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT8_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(560) /* setInt8 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT8_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(562) /* getUint8 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT8_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(565) /* setUint8 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT8_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(568) /* getInt16 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT16_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(571) /* setInt16 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT16_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(574) /* getUint16 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT16_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(577) /* setUint16 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT16_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(580) /* getInt32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(583) /* setInt32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(586) /* getUint32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(589) /* setUint32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(592) /* getFloat32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_FLOAT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(595) /* setFloat32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_FLOAT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(598) /* getFloat64 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_FLOAT64_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(601) /* setFloat64 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_FLOAT64_ARRAY },
+  { { .generic = js_print },
+    JS_ROM_VALUE(390) /* log */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_performance_now },
+    JS_ROM_VALUE(416) /* now */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_rectangle_constructor },
+    JS_ROM_VALUE(619) /* Rectangle */,
+    JS_CFUNC_constructor, 2, JS_CLASS_RECTANGLE },
+  { { .generic = js_rectangle_getClosure },
+    JS_ROM_VALUE(622) /* getClosure */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_rectangle_call },
+    JS_ROM_VALUE(194) /* call */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_rectangle_get_x },
+    JS_ROM_VALUE(627) /* get x */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_rectangle_get_y },
+    JS_ROM_VALUE(631) /* get y */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_filled_rectangle_constructor },
+    JS_ROM_VALUE(633) /* FilledRectangle */,
+    JS_CFUNC_constructor, 3, JS_CLASS_FILLED_RECTANGLE },
+  { { .generic = js_filled_rectangle_get_color },
+    JS_ROM_VALUE(638) /* get color */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_global_eval },
+    JS_ROM_VALUE(119) /* eval */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_global_isNaN },
+    JS_ROM_VALUE(604) /* isNaN */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_global_isFinite },
+    JS_ROM_VALUE(606) /* isFinite */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_print },
+    JS_ROM_VALUE(617) /* print */,
+    JS_CFUNC_generic, 1, 0 },
+};
+
+#ifndef JS_CLASS_COUNT
+#define JS_CLASS_COUNT JS_CLASS_USER /* total number of classes */
+#endif
+
+static const JSCFinalizer js_c_finalizer_table[JS_CLASS_COUNT - JS_CLASS_USER] = {
+  [JS_CLASS_RECTANGLE - JS_CLASS_USER] = js_rectangle_finalizer,
+  [JS_CLASS_FILLED_RECTANGLE - JS_CLASS_USER] = js_filled_rectangle_finalizer,
+};
+
+const JSSTDLibraryDef js_stdlib = {
+  js_stdlib_table,
+  js_c_function_table,
+  js_c_finalizer_table,
+  2361,
+  64,
+  641,
+  2272,
+  JS_CLASS_COUNT,
+  js_atom_hash_table,
+  9,
+  7,
+};
+
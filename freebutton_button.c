@@ -19,6 +19,8 @@
 
 // Import the hardware abstraction layer (ESP32 only)
 #ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "../../src/scripting/button_hardware.h"
 #else
 // Host build stubs for generator
@@ -46,25 +48,63 @@ static struct {
 } js_button_callbacks[MAX_BUTTONS] = {{NULL, {JS_UNDEFINED, NULL}, {JS_UNDEFINED, NULL}, {JS_UNDEFINED, NULL}, 0, 0, 0}};
 
 /*
- * C callback wrappers - these are called from the hardware layer
- * and invoke the JavaScript callbacks
+ * Button events
+ *
+ * The hardware layer posts the events into a ring from its own task (or
+ * an interrupt handler). The JavaScript callbacks are called on the task
+ * running the context by JS_RunPendingJobs(), so a burst of events costs
+ * a single wakeup and JS_Call() is never made from another task.
  */
 
-static void js_button_click_wrapper(int position) {
-    // Positions are 1-based (1-8)
-    if (position < 1 || position > MAX_BUTTONS) return;
+// Ring size in bytes, each event uses 8 bytes
+#ifndef BUTTON_EVENT_RING_SIZE
+#define BUTTON_EVENT_RING_SIZE 256
+#endif
 
-    int idx = position - 1;  // Convert to 0-based array index
-    if (!js_button_callbacks[idx].clickAllocated) return;
+enum {
+    BUTTON_EVENT_CLICK,
+    BUTTON_EVENT_LONG_PRESS,
+    BUTTON_EVENT_RELEASE,
+};
 
-    JSContext *ctx = js_button_callbacks[idx].ctx;
-    JSGCRef *callback = &js_button_callbacks[idx].clickCallback;
+typedef struct {
+    uint8_t type;
+    uint8_t idx;    // 0-based button index
+} ButtonEvent;
 
-    if (!ctx) return;
+static uint32_t js_button_event_buf[BUTTON_EVENT_RING_SIZE / 4];
+static JSEventRing js_button_event_ring;
+static volatile int js_button_event_ready;
+#ifdef ESP_PLATFORM
+static TaskHandle_t js_button_event_task;
+#endif
+
+// Called on the JavaScript task for each posted event
+static int js_button_event_handler(JSContext *ctx, void *opaque, const uint8_t *data, size_t len) {
+    const ButtonEvent *ev = (const ButtonEvent *)data;
+    JSGCRef *callback;
+    int allocated;
+
+    switch (ev->type) {
+    case BUTTON_EVENT_CLICK:
+        callback = &js_button_callbacks[ev->idx].clickCallback;
+        allocated = js_button_callbacks[ev->idx].clickAllocated;
+        break;
+    case BUTTON_EVENT_LONG_PRESS:
+        callback = &js_button_callbacks[ev->idx].longPressCallback;
+        allocated = js_button_callbacks[ev->idx].longPressAllocated;
+        break;
+    default:
+        callback = &js_button_callbacks[ev->idx].releaseCallback;
+        allocated = js_button_callbacks[ev->idx].releaseAllocated;
+        break;
+    }
+    if (!allocated || js_button_callbacks[ev->idx].ctx != ctx)
+        return 0;
 
     // Check stack space (2 slots: function + this)
     if (JS_StackCheck(ctx, 2))
-        return;
+        return 0;
 
     // Push function and this
     JS_PushArg(ctx, callback->val);
@@ -73,60 +113,60 @@ static void js_button_click_wrapper(int position) {
     // Call the function
     JSValue result = JS_Call(ctx, 0);
 
-    // Check for exceptions but don't exit - just log
+    // Check for exceptions but don't stop the event processing
     if (JS_IsException(result)) {
         // Exception occurred - could add logging here
     }
+    return 0;
 }
 
-static void js_button_long_press_wrapper(int position) {
-    // Positions are 1-based (1-8)
-    if (position < 1 || position > MAX_BUTTONS) return;
-
-    int idx = position - 1;  // Convert to 0-based array index
-    if (!js_button_callbacks[idx].longPressAllocated) return;
-
-    JSContext *ctx = js_button_callbacks[idx].ctx;
-    JSGCRef *callback = &js_button_callbacks[idx].longPressCallback;
+// Attach the event ring to the context registering a callback
+static void js_button_events_attach(JSContext *ctx) {
+    if (!js_button_event_ready) {
+        JS_InitEventRing(&js_button_event_ring, js_button_event_buf,
+                         sizeof(js_button_event_buf), js_button_event_handler, NULL);
+    }
+#ifdef ESP_PLATFORM
+    js_button_event_task = xTaskGetCurrentTaskHandle();
+#endif
+    JS_AddEventRing(ctx, &js_button_event_ring);
+    js_button_event_ready = 1;
+}
 
-    if (!ctx) return;
+/*
+ * C callback wrappers - these are called from the hardware layer
+ * and queue the event for the JavaScript task
+ */
 
-    if (JS_StackCheck(ctx, 2))
+static void js_button_post_event(int type, int position) {
+    // Positions are 1-based (1-8)
+    if (position < 1 || position > MAX_BUTTONS || !js_button_event_ready)
         return;
 
-    JS_PushArg(ctx, callback->val);
-    JS_PushArg(ctx, JS_NULL);
+    ButtonEvent ev = { .type = type, .idx = position - 1 };
 
-    JSValue result = JS_Call(ctx, 0);
-
-    if (JS_IsException(result)) {
-        // Exception occurred
+    // The event is dropped if the ring is full. The JavaScript task is
+    // only woken up when it may have emptied the ring.
+    if (JS_PostEvent(&js_button_event_ring, &ev, sizeof(ev)) > 0) {
+#ifdef ESP_PLATFORM
+        if (xPortInIsrContext())
+            vTaskNotifyGiveFromISR(js_button_event_task, NULL);
+        else
+            xTaskNotifyGive(js_button_event_task);
+#endif
     }
 }
 
-static void js_button_release_wrapper(int position) {
-    // Positions are 1-based (1-8)
-    if (position < 1 || position > MAX_BUTTONS) return;
-
-    int idx = position - 1;  // Convert to 0-based array index
-    if (!js_button_callbacks[idx].releaseAllocated) return;
-
-    JSContext *ctx = js_button_callbacks[idx].ctx;
-    JSGCRef *callback = &js_button_callbacks[idx].releaseCallback;
-
-    if (!ctx) return;
-
-    if (JS_StackCheck(ctx, 2))
-        return;
-
-    JS_PushArg(ctx, callback->val);
-    JS_PushArg(ctx, JS_NULL);
+static void js_button_click_wrapper(int position) {
+    js_button_post_event(BUTTON_EVENT_CLICK, position);
+}
 
-    JSValue result = JS_Call(ctx, 0);
+static void js_button_long_press_wrapper(int position) {
+    js_button_post_event(BUTTON_EVENT_LONG_PRESS, position);
+}
 
-    if (JS_IsException(result)) {
-        // Exception occurred
-    }
+static void js_button_release_wrapper(int position) {
+    js_button_post_event(BUTTON_EVENT_RELEASE, position);
 }
 
 /*
@@ -246,6 +286,7 @@ JSValue js_freebutton_button_onClick(JSContext *ctx, JSValue *this_val, int argc
 
     // Store the callback using GC reference
     js_button_callbacks[idx].ctx = ctx;
+    js_button_events_attach(ctx);
     JSValue *pfunc = JS_AddGCRef(ctx, &js_button_callbacks[idx].clickCallback);
     *pfunc = argv[1];
     js_button_callbacks[idx].clickAllocated = 1;
@@ -294,6 +335,7 @@ JSValue js_freebutton_button_onLongPress(JSContext *ctx, JSValue *this_val, int
 
     // Store the callback using GC reference
     js_button_callbacks[idx].ctx = ctx;
+    js_button_events_attach(ctx);
     JSValue *pfunc = JS_AddGCRef(ctx, &js_button_callbacks[idx].longPressCallback);
     *pfunc = argv[1];
     js_button_callbacks[idx].longPressAllocated = 1;
@@ -342,6 +384,7 @@ JSValue js_freebutton_button_onRelease(JSContext *ctx, JSValue *this_val, int ar
 
     // Store the callback using GC reference
     js_button_callbacks[idx].ctx = ctx;
+    js_button_events_attach(ctx);
     JSValue *pfunc = JS_AddGCRef(ctx, &js_button_callbacks[idx].releaseCallback);
     *pfunc = argv[1];
     js_button_callbacks[idx].releaseAllocated = 1;
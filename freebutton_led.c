@@ -9,6 +9,12 @@
  *   led.off(position)                 - Turn LED off at position
  *   led.setColor(position, r, g, b)   - Set LED RGB color
  *   led.count()                       - Get number of available LEDs
+ *   led.show(data)                    - Set all LEDs from a Uint8Array (GRB)
+ *
+ * If CONFIG_FREEBUTTON_LED_GPIO is defined, led.show() sends the whole
+ * frame through the double buffered WS2812 RMT driver of mqjs_led.c
+ * (which must then be linked in). Otherwise it falls back to one HAL
+ * call per LED.
  */
 
 // IMPORTANT: Include mquickjs.h FIRST to establish proper type definitions
@@ -16,16 +22,46 @@
 #include "mquickjs.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <stdbool.h>
 
 // Import the hardware abstraction layer (ESP32 only)
 #ifdef ESP_PLATFORM
 #include "../../src/scripting/led_hardware.h"
+#ifdef CONFIG_FREEBUTTON_LED_GPIO
+#include "mqjs_led.h"
+#endif
 #else
 // Host build stubs for generator
 static inline int led_hw_get_count(void) { return 0; }
 static inline int led_hw_set_color(int pos, uint8_t r, uint8_t g, uint8_t b) { return 0; }
 #endif
 
+// Bulk HAL entry point: send 'count' LEDs (3 bytes each in GRB order)
+#if defined(ESP_PLATFORM) && defined(CONFIG_FREEBUTTON_LED_GPIO)
+static int led_hw_show(const uint8_t *grb, int count)
+{
+    static bool initialized = false;
+
+    if (!initialized) {
+        if (mqjs_led_frame_init(CONFIG_FREEBUTTON_LED_GPIO) < 0)
+            return -1;
+        initialized = true;
+    }
+    // The frame is copied to the device buffer which is not being sent
+    return mqjs_led_frame_show(grb, (size_t)count * 3);
+}
+#else
+static int led_hw_show(const uint8_t *grb, int count)
+{
+    for (int i = 0; i < count; i++) {
+        if (led_hw_set_color(i, grb[i * 3 + 1], grb[i * 3], grb[i * 3 + 2]) < 0)
+            return -1;
+    }
+    return 0;
+}
+#endif
+
 /*
  * JavaScript bindings
  */
@@ -128,3 +164,28 @@ JSValue js_freebutton_led_setColor(JSContext *ctx, JSValue *this_val, int argc,
 
     return JS_UNDEFINED;
 }
+
+/**
+ * @jsapi led.show
+ * @description Set all LEDs from one frame buffer in a single call
+ * @param {Uint8Array} data - 3 bytes per LED in GRB order, same layout as the mqjs led.show()
+ * @returns {number} Number of LEDs updated
+ */
+JSValue js_freebutton_led_show(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    size_t len;
+    const uint8_t *data = JS_GetTypedArray(ctx, &len, argv[0], JS_CLASS_UINT8_ARRAY);
+    if (!data)
+        data = JS_GetTypedArray(ctx, &len, argv[0], JS_CLASS_UINT8C_ARRAY);
+    if (!data)
+        return JS_ThrowTypeError(ctx, "led.show() requires a Uint8Array");
+
+    int count = len / 3;
+    int max = led_hw_get_count();
+    if (count > max)
+        count = max;
+    if (led_hw_show(data, count) < 0)
+        return JS_ThrowInternalError(ctx, "failed to send the LED frame");
+
+    return JS_NewInt32(ctx, count);
+}
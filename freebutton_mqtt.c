@@ -6,6 +6,7 @@
  *
  * JavaScript API:
  *   mqtt.publish(brokerId, topic, payload[, qos, retain])  - Publish message
+ *   mqtt.publishJSON(brokerId, topic, value[, qos, retain]) - Publish value as JSON
  *   mqtt.subscribe(brokerId, topic, callback[, qos])       - Subscribe to topic
  *   mqtt.unsubscribe(brokerId, topic)                      - Unsubscribe from topic
  *   mqtt.onConnect(brokerId, callback)                     - Register connect callback
@@ -18,16 +19,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 #include "mquickjs.h"
 
 // ESP32-specific includes
 #ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "esp_log.h"
 #include "../../src/scripting/mqtt_binding.h"
 static const char *MQTT_JS_TAG = "MqttJS";
 #else
 // Host build stubs for generator
-#include <stdbool.h>
 #define ESP_LOGI(tag, ...)
 #define ESP_LOGE(tag, ...)
 #define ESP_LOGW(tag, ...)
@@ -42,130 +45,249 @@ static inline void mqtt_binding_register_connect_callback(void (*cb)(uint8_t)) {
 static inline void mqtt_binding_register_disconnect_callback(void (*cb)(uint8_t)) {}
 #endif
 
-// Maximum subscriptions per broker
 #define MAX_BROKERS 2
-#define MAX_SUBSCRIPTIONS_PER_BROKER 8
 
-// Storage for JavaScript callbacks using JSGCRef for GC protection
+// Matches collected on the C stack before spilling to the heap
+#define MQTT_MATCH_LOCAL_SIZE 16
+
+// Storage for JavaScript callbacks using JSGCRef for GC protection. A
+// subscription is referenced by the trie node of its filter and by every
+// dispatch in flight, so a callback may unsubscribe (itself or others)
+// while a message is being delivered.
 typedef struct {
-    JSContext *ctx;
     JSGCRef callback;
-    char *topic;
-    int allocated;
+    int active;
+    int ref_count;
 } MqttSubscription;
 
+// One level of a topic filter. Siblings are chained through 'next', the
+// wildcard levels "+" and "#" are stored as ordinary nodes.
+typedef struct MqttTopicNode {
+    struct MqttTopicNode *next;
+    struct MqttTopicNode *children;
+    MqttSubscription *sub;          // subscription whose filter ends here
+    char level[];
+} MqttTopicNode;
+
 typedef struct {
     JSContext *ctx;
     JSGCRef connectCallback;
     JSGCRef disconnectCallback;
     int connectAllocated;
     int disconnectAllocated;
-    MqttSubscription subscriptions[MAX_SUBSCRIPTIONS_PER_BROKER];
+    MqttTopicNode *topics;          // first level of the subscription trie
 } BrokerCallbacks;
 
 static BrokerCallbacks js_mqtt_brokers[MAX_BROKERS] = {0};
 
+typedef struct {
+    MqttSubscription **tab;
+    int count;
+    int size;
+    MqttSubscription *local[MQTT_MATCH_LOCAL_SIZE];
+} MqttMatchList;
+
 /*
- * Helper: Find subscription slot for a topic
+ * Helper: Length of the topic level starting at 's'
  */
-static MqttSubscription* find_subscription(uint8_t brokerId, const char* topic) {
-    if (brokerId >= MAX_BROKERS || !topic)
-        return NULL;
+static size_t mqtt_level_len(const char *s) {
+    const char *p = strchr(s, '/');
+    return p ? (size_t)(p - s) : strlen(s);
+}
 
-    BrokerCallbacks *broker = &js_mqtt_brokers[brokerId];
-    for (int i = 0; i < MAX_SUBSCRIPTIONS_PER_BROKER; i++) {
-        if (broker->subscriptions[i].allocated &&
-            broker->subscriptions[i].topic &&
-            strcmp(broker->subscriptions[i].topic, topic) == 0) {
-            return &broker->subscriptions[i];
+static bool mqtt_level_is(const MqttTopicNode *node, const char *level, size_t len) {
+    return strncmp(node->level, level, len) == 0 && node->level[len] == '\0';
+}
+
+/*
+ * Helper: Check a topic filter ('+' and '#' must occupy a whole level,
+ * '#' must be the last one)
+ */
+static bool mqtt_filter_is_valid(const char *filter) {
+    if (*filter == '\0')
+        return false;
+    for (;;) {
+        size_t len = mqtt_level_len(filter);
+        for (size_t i = 0; i < len; i++) {
+            if ((filter[i] == '+' || filter[i] == '#') && len != 1)
+                return false;
         }
+        if (filter[len] == '\0')
+            return true;
+        if (filter[0] == '#')
+            return false;
+        filter += len + 1;
     }
-    return NULL;
 }
 
 /*
- * Helper: Find free subscription slot
+ * Helper: Find or create the trie node of a topic filter
  */
-static MqttSubscription* alloc_subscription(uint8_t brokerId) {
-    if (brokerId >= MAX_BROKERS)
-        return NULL;
-
-    BrokerCallbacks *broker = &js_mqtt_brokers[brokerId];
-    for (int i = 0; i < MAX_SUBSCRIPTIONS_PER_BROKER; i++) {
-        if (!broker->subscriptions[i].allocated) {
-            return &broker->subscriptions[i];
+static MqttTopicNode* mqtt_topic_insert(MqttTopicNode **plist, const char *filter) {
+    for (;;) {
+        size_t len = mqtt_level_len(filter);
+        MqttTopicNode *node;
+
+        for (node = *plist; node; node = node->next) {
+            if (mqtt_level_is(node, filter, len))
+                break;
+        }
+        if (!node) {
+            node = calloc(1, sizeof(*node) + len + 1);
+            if (!node)
+                return NULL;
+            memcpy(node->level, filter, len);
+            node->next = *plist;
+            *plist = node;
         }
+        if (filter[len] == '\0')
+            return node;
+        filter += len + 1;
+        plist = &node->children;
     }
-    return NULL;
 }
 
 /*
- * C callback wrapper - called from the hardware layer when MQTT message arrives
- * and invokes the JavaScript callback
+ * Helper: Detach the subscription of a topic filter and free the nodes
+ * left empty on its path. Returns NULL if the filter has no subscription.
  */
-static void js_mqtt_message_wrapper(uint8_t brokerId, const char* topic, const char* payload, size_t length) {
-    if (brokerId >= MAX_BROKERS)
-        return;
+static MqttSubscription* mqtt_topic_remove(MqttTopicNode **plist, const char *filter) {
+    size_t len = mqtt_level_len(filter);
+    MqttTopicNode **pnode, *node;
+    MqttSubscription *sub;
+
+    for (pnode = plist; (node = *pnode) != NULL; pnode = &node->next) {
+        if (mqtt_level_is(node, filter, len))
+            break;
+    }
+    if (!node)
+        return NULL;
 
-    BrokerCallbacks *broker = &js_mqtt_brokers[brokerId];
+    if (filter[len] == '\0') {
+        sub = node->sub;
+        node->sub = NULL;
+    } else {
+        sub = mqtt_topic_remove(&node->children, filter + len + 1);
+    }
 
-    // Find matching subscription(s) - support wildcards by checking all subscriptions
-    for (int i = 0; i < MAX_SUBSCRIPTIONS_PER_BROKER; i++) {
-        MqttSubscription *sub = &broker->subscriptions[i];
+    if (!node->sub && !node->children) {
+        *pnode = node->next;
+        free(node);
+    }
+    return sub;
+}
 
-        if (!sub->allocated || !sub->ctx)
+static void mqtt_subscription_unref(MqttSubscription *sub) {
+    if (--sub->ref_count == 0)
+        free(sub);
+}
+
+static void mqtt_match_add(MqttMatchList *m, MqttSubscription *sub) {
+    if (!sub)
+        return;
+    if (m->count >= m->size) {
+        int new_size = m->size * 2;
+        MqttSubscription **tab;
+        if (m->tab == m->local) {
+            tab = malloc(sizeof(*tab) * new_size);
+            if (tab)
+                memcpy(tab, m->local, sizeof(*tab) * m->count);
+        } else {
+            tab = realloc(m->tab, sizeof(*tab) * new_size);
+        }
+        if (!tab) {
+            ESP_LOGW(MQTT_JS_TAG, "Out of memory dispatching MQTT message");
+            return;
+        }
+        m->tab = tab;
+        m->size = new_size;
+    }
+    sub->ref_count++;
+    m->tab[m->count++] = sub;
+}
+
+/*
+ * Helper: Collect the subscriptions whose filter matches 'topic' in one
+ * walk of the trie. Each filter has a single node, so no subscription is
+ * collected twice.
+ */
+static void mqtt_topic_match(MqttTopicNode *list, const char *topic, bool first_level, MqttMatchList *m) {
+    size_t len = mqtt_level_len(topic);
+    bool last_level = (topic[len] == '\0');
+    // Wildcards at the first level don't match topics starting with '$'
+    bool wildcards = !(first_level && topic[0] == '$');
+
+    for (MqttTopicNode *node = list; node; node = node->next) {
+        if (mqtt_level_is(node, "#", 1)) {
+            if (wildcards)
+                mqtt_match_add(m, node->sub);
+            continue;
+        }
+        if (mqtt_level_is(node, "+", 1)) {
+            if (!wildcards)
+                continue;
+        } else if (!mqtt_level_is(node, topic, len)) {
             continue;
+        }
 
-        // Simple topic matching (exact match for now, wildcard support can be added)
-        // For production, implement MQTT wildcard matching (+ and #)
-        int matches = (strcmp(sub->topic, topic) == 0);
-
-        // Check for wildcard matches
-        if (!matches) {
-            // Support for # wildcard (multi-level)
-            size_t topic_len = strlen(sub->topic);
-            if (topic_len > 0 && sub->topic[topic_len - 1] == '#') {
-                // Check if topic starts with the prefix before #
-                size_t prefix_len = topic_len - 1;
-                if (prefix_len > 0 && sub->topic[prefix_len - 1] == '/')
-                    prefix_len--;
-                matches = (strncmp(sub->topic, topic, prefix_len) == 0);
+        if (last_level) {
+            mqtt_match_add(m, node->sub);
+            // "a/#" also matches the parent level "a"
+            for (MqttTopicNode *child = node->children; child; child = child->next) {
+                if (mqtt_level_is(child, "#", 1))
+                    mqtt_match_add(m, child->sub);
             }
+        } else {
+            mqtt_topic_match(node->children, topic + len + 1, false, m);
         }
+    }
+}
 
-        if (!matches)
-            continue;
+/*
+ * Deliver a message to the JavaScript callbacks of all matching
+ * subscriptions (JavaScript task)
+ */
+static void js_mqtt_dispatch_message(JSContext *ctx, uint8_t brokerId, const char* topic, const char* payload, size_t length) {
+    BrokerCallbacks *broker = &js_mqtt_brokers[brokerId];
+    MqttMatchList m;
 
-        JSContext *ctx = sub->ctx;
+    if (broker->ctx != ctx)
+        return;
 
-        // Stack check FIRST (3 slots: 2 args + function + this)
-        if (JS_StackCheck(ctx, 4))
+    m.tab = m.local;
+    m.count = 0;
+    m.size = MQTT_MATCH_LOCAL_SIZE;
+    mqtt_topic_match(broker->topics, topic, true, &m);
+    if (m.count == 0)
+        return;
+
+    // The arguments are shared by all callbacks and must survive their GCs
+    JSGCRef topic_ref, payload_ref;
+    JSValue *ptopic = JS_PushGCRef(ctx, &topic_ref);
+    JSValue *ppayload = JS_PushGCRef(ctx, &payload_ref);
+    *ptopic = JS_NewString(ctx, topic);
+    *ppayload = JS_NewStringLen(ctx, payload, length);
+
+    for (int i = 0; i < m.count; i++) {
+        MqttSubscription *sub = m.tab[i];
+
+        // Skip subscriptions removed by an earlier callback
+        if (!sub->active)
             continue;
 
+        // Stack check FIRST (4 slots: 2 args + function + this)
+        if (JS_StackCheck(ctx, 4))
+            break;
+
         // Verify callback is still a function
         if (!JS_IsFunction(ctx, sub->callback.val))
             continue;
 
-        // Create arguments
-        JSValue topicArg = JS_NewString(ctx, topic);
-        JSValue payloadArg;
-
-        // Create payload string (ensure null-terminated)
-        char *payload_str = (char*)malloc(length + 1);
-        if (payload_str) {
-            memcpy(payload_str, payload, length);
-            payload_str[length] = '\0';
-            payloadArg = JS_NewString(ctx, payload_str);
-            free(payload_str);
-        } else {
-            payloadArg = JS_NewString(ctx, "");
-        }
-
         // REVERSE ORDER: args (right to left), function, this
-        JS_PushArg(ctx, payloadArg);     // Arg 2 (payload)
-        JS_PushArg(ctx, topicArg);       // Arg 1 (topic)
+        JS_PushArg(ctx, *ppayload);          // Arg 2 (payload)
+        JS_PushArg(ctx, *ptopic);            // Arg 1 (topic)
         JS_PushArg(ctx, sub->callback.val);  // Function
-        JS_PushArg(ctx, JS_NULL);        // This
+        JS_PushArg(ctx, JS_NULL);            // This
 
         JSValue result = JS_Call(ctx, 2);  // 2 arguments
 
@@ -181,22 +303,25 @@ static void js_mqtt_message_wrapper(uint8_t brokerId, const char* topic, const c
             }
         }
     }
+
+    JS_PopGCRef(ctx, &payload_ref);
+    JS_PopGCRef(ctx, &topic_ref);
+
+    for (int i = 0; i < m.count; i++)
+        mqtt_subscription_unref(m.tab[i]);
+    if (m.tab != m.local)
+        free(m.tab);
 }
 
 /*
- * C callback wrapper - called when broker connects
+ * Call the connect callback of a broker (JavaScript task)
  */
-static void js_mqtt_connect_wrapper(uint8_t brokerId) {
-    if (brokerId >= MAX_BROKERS)
-        return;
-
+static void js_mqtt_dispatch_connect(JSContext *ctx, uint8_t brokerId) {
     BrokerCallbacks *broker = &js_mqtt_brokers[brokerId];
 
-    if (!broker->connectAllocated || !broker->ctx)
+    if (!broker->connectAllocated || broker->ctx != ctx)
         return;
 
-    JSContext *ctx = broker->ctx;
-
     if (JS_StackCheck(ctx, 3))
         return;
 
@@ -225,19 +350,14 @@ static void js_mqtt_connect_wrapper(uint8_t brokerId) {
 }
 
 /*
- * C callback wrapper - called when broker disconnects
+ * Call the disconnect callback of a broker (JavaScript task)
  */
-static void js_mqtt_disconnect_wrapper(uint8_t brokerId) {
-    if (brokerId >= MAX_BROKERS)
-        return;
-
+static void js_mqtt_dispatch_disconnect(JSContext *ctx, uint8_t brokerId) {
     BrokerCallbacks *broker = &js_mqtt_brokers[brokerId];
 
-    if (!broker->disconnectAllocated || !broker->ctx)
+    if (!broker->disconnectAllocated || broker->ctx != ctx)
         return;
 
-    JSContext *ctx = broker->ctx;
-
     if (JS_StackCheck(ctx, 3))
         return;
 
@@ -265,6 +385,123 @@ static void js_mqtt_disconnect_wrapper(uint8_t brokerId) {
     }
 }
 
+/*
+ * MQTT events
+ *
+ * The binding layer calls the wrappers below from the MQTT task. They
+ * only copy the event into a ring, the JavaScript callbacks are called
+ * on the task running the context by JS_RunPendingJobs(). A burst of
+ * messages costs a single wakeup and JS_Call() is never made from
+ * another task.
+ */
+
+// Ring size in bytes. A message uses its topic and payload lengths
+// plus 16 bytes, larger messages are dropped.
+#ifndef MQTT_EVENT_RING_SIZE
+#define MQTT_EVENT_RING_SIZE 4096
+#endif
+
+enum {
+    MQTT_EVENT_MESSAGE,
+    MQTT_EVENT_CONNECT,
+    MQTT_EVENT_DISCONNECT,
+};
+
+// Followed by the topic (with its terminating NUL) and the payload
+typedef struct {
+    uint32_t payload_len;
+    uint16_t topic_len;
+    uint8_t type;
+    uint8_t brokerId;
+} MqttEvent;
+
+static uint32_t js_mqtt_event_buf[MQTT_EVENT_RING_SIZE / 4];
+static JSEventRing js_mqtt_event_ring;
+static volatile int js_mqtt_event_ready;
+#ifdef ESP_PLATFORM
+static TaskHandle_t js_mqtt_event_task;
+#endif
+
+// Called on the JavaScript task for each posted event
+static int js_mqtt_event_handler(JSContext *ctx, void *opaque, const uint8_t *data, size_t len) {
+    const MqttEvent *ev = (const MqttEvent *)data;
+    const char *topic = (const char *)(ev + 1);
+
+    switch (ev->type) {
+    case MQTT_EVENT_MESSAGE:
+        js_mqtt_dispatch_message(ctx, ev->brokerId, topic, topic + ev->topic_len + 1, ev->payload_len);
+        break;
+    case MQTT_EVENT_CONNECT:
+        js_mqtt_dispatch_connect(ctx, ev->brokerId);
+        break;
+    default:
+        js_mqtt_dispatch_disconnect(ctx, ev->brokerId);
+        break;
+    }
+    // Exceptions are logged by the dispatch functions
+    return 0;
+}
+
+// Attach the event ring to the context registering a callback
+static void js_mqtt_events_attach(JSContext *ctx) {
+    if (!js_mqtt_event_ready) {
+        JS_InitEventRing(&js_mqtt_event_ring, js_mqtt_event_buf,
+                         sizeof(js_mqtt_event_buf), js_mqtt_event_handler, NULL);
+    }
+#ifdef ESP_PLATFORM
+    js_mqtt_event_task = xTaskGetCurrentTaskHandle();
+#endif
+    JS_AddEventRing(ctx, &js_mqtt_event_ring);
+    js_mqtt_event_ready = 1;
+}
+
+static void js_mqtt_post_event(int type, uint8_t brokerId, const char *topic, const char *payload, size_t length) {
+    if (brokerId >= MAX_BROKERS || !js_mqtt_event_ready)
+        return;
+
+    size_t topic_len = topic ? strlen(topic) : 0;
+    if (topic_len > UINT16_MAX) {
+        ESP_LOGW(MQTT_JS_TAG, "MQTT topic too long, message dropped");
+        return;
+    }
+    uint8_t *p = JS_ReserveEvent(&js_mqtt_event_ring, sizeof(MqttEvent) + topic_len + 1 + length);
+    if (!p) {
+        ESP_LOGW(MQTT_JS_TAG, "MQTT event queue full, event dropped");
+        return;
+    }
+    MqttEvent *ev = (MqttEvent *)p;
+    ev->payload_len = length;
+    ev->topic_len = topic_len;
+    ev->type = type;
+    ev->brokerId = brokerId;
+    p += sizeof(MqttEvent);
+    memcpy(p, topic ? topic : "", topic_len + 1);
+    if (length)
+        memcpy(p + topic_len + 1, payload, length);
+
+    // The JavaScript task is only woken up when it may have emptied the ring
+    if (JS_CommitEvent(&js_mqtt_event_ring)) {
+#ifdef ESP_PLATFORM
+        xTaskNotifyGive(js_mqtt_event_task);
+#endif
+    }
+}
+
+/*
+ * C callback wrappers - called from the binding layer
+ */
+static void js_mqtt_message_wrapper(uint8_t brokerId, const char* topic, const char* payload, size_t length) {
+    js_mqtt_post_event(MQTT_EVENT_MESSAGE, brokerId, topic, payload, length);
+}
+
+static void js_mqtt_connect_wrapper(uint8_t brokerId) {
+    js_mqtt_post_event(MQTT_EVENT_CONNECT, brokerId, NULL, NULL, 0);
+}
+
+static void js_mqtt_disconnect_wrapper(uint8_t brokerId) {
+    js_mqtt_post_event(MQTT_EVENT_DISCONNECT, brokerId, NULL, NULL, 0);
+}
+
 /*
  * JavaScript bindings
  */
@@ -349,7 +586,6 @@ JSValue js_freebutton_mqtt_publish(JSContext *ctx, JSValue *this_val, int argc,
     (void)this_val;
 
     int brokerId = 0;
-    JSCStringBuf topic_buf, payload_buf;
     const char *topic, *payload;
     int qos = 0;
     int retain = 0;
@@ -358,11 +594,13 @@ JSValue js_freebutton_mqtt_publish(JSContext *ctx, JSValue *this_val, int argc,
         if (JS_ToInt32(ctx, &brokerId, argv[0]))
             return JS_EXCEPTION;
 
-        topic = JS_ToCString(ctx, argv[1], &topic_buf);
+        // Temporary copies: converting the next arguments may run the
+        // GC, which moves the JS strings
+        topic = JS_ToTempCString(ctx, NULL, argv[1]);
         if (!topic)
             return JS_EXCEPTION;
 
-        payload = JS_ToCString(ctx, argv[2], &payload_buf);
+        payload = JS_ToTempCString(ctx, NULL, argv[2]);
         if (!payload)
             return JS_EXCEPTION;
 
@@ -386,6 +624,106 @@ JSValue js_freebutton_mqtt_publish(JSContext *ctx, JSValue *this_val, int argc,
     return JS_UNDEFINED;
 }
 
+// Growable buffer in the C heap receiving the JSON text
+typedef struct {
+    char *buf;
+    size_t len;
+    size_t size;
+    int failed;
+} MqttJsonBuf;
+
+static void mqtt_json_write(void *opaque, const void *data, size_t len)
+{
+    MqttJsonBuf *b = opaque;
+
+    if (b->failed)
+        return;
+    // Keep room for the trailing NUL
+    if (b->len + len + 1 > b->size) {
+        size_t new_size = b->size + b->size / 2;
+        if (new_size < b->len + len + 1)
+            new_size = b->len + len + 1;
+        if (new_size < 128)
+            new_size = 128;
+        char *new_buf = realloc(b->buf, new_size);
+        if (!new_buf) {
+            b->failed = 1;
+            return;
+        }
+        b->buf = new_buf;
+        b->size = new_size;
+    }
+    memcpy(b->buf + b->len, data, len);
+    b->len += len;
+}
+
+/**
+ * @jsapi mqtt.publishJSON
+ * @description Publish a value serialized as JSON. The text is built
+ * directly in a C buffer instead of a JavaScript string, so no copy of the
+ * payload is made in the JavaScript heap.
+ * @param {number} brokerId - Broker ID
+ * @param {string} topic - MQTT topic
+ * @param {*} value - Value to serialize with JSON.stringify() semantics
+ * @param {number} qos - Quality of Service level (0-2) [optional]
+ * @param {number} retain - Retain flag (0 or 1) [optional]
+ * @returns {void}
+ */
+JSValue js_freebutton_mqtt_publishJSON(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    (void)this_val;
+
+    int brokerId = 0;
+    JSCStringBuf topic_buf;
+    const char *topic;
+    int qos = 0;
+    int retain = 0;
+    MqttJsonBuf json = {0};
+
+    if (argc < 3)
+        return JS_ThrowTypeError(ctx, "mqtt.publishJSON() requires brokerId, topic, and value arguments");
+
+    if (JS_ToInt32(ctx, &brokerId, argv[0]))
+        return JS_EXCEPTION;
+    if (argc >= 4) {
+        if (JS_ToInt32(ctx, &qos, argv[3]))
+            return JS_EXCEPTION;
+    }
+    if (argc >= 5) {
+        if (JS_ToInt32(ctx, &retain, argv[4]))
+            return JS_EXCEPTION;
+    }
+
+    if (JS_StringifyToSink(ctx, argv[2], mqtt_json_write, &json)) {
+        free(json.buf);
+        return JS_EXCEPTION;
+    }
+    if (json.failed) {
+        free(json.buf);
+        return JS_ThrowInternalError(ctx, "out of memory for MQTT payload");
+    }
+    if (!json.buf) {
+        // nothing was written
+        return JS_UNDEFINED;
+    }
+    json.buf[json.len] = '\0';
+
+    // The topic is converted last: its buffer may point into the JS heap,
+    // which can move during the serialization
+    topic = JS_ToCString(ctx, argv[1], &topic_buf);
+    if (!topic) {
+        free(json.buf);
+        return JS_EXCEPTION;
+    }
+
+    int ret = mqtt_binding_publish((uint8_t)brokerId, topic, json.buf, qos, retain);
+    free(json.buf);
+    if (ret < 0)
+        return JS_ThrowInternalError(ctx, "failed to publish MQTT message");
+
+    return JS_UNDEFINED;
+}
+
 /**
  * @jsapi mqtt.subscribe
  * @description Subscribe to MQTT topic with callback
@@ -429,35 +767,41 @@ JSValue js_freebutton_mqtt_subscribe(JSContext *ctx, JSValue *this_val, int argc
         return JS_ThrowRangeError(ctx, "broker ID %d out of range (0-%d)", brokerId, MAX_BROKERS - 1);
     }
 
+    if (!mqtt_filter_is_valid(topic)) {
+        return JS_ThrowRangeError(ctx, "invalid MQTT topic filter '%s'", topic);
+    }
+
+    BrokerCallbacks *broker = &js_mqtt_brokers[brokerId];
+
+    // Find or create the trie node of this filter
+    MqttTopicNode *node = mqtt_topic_insert(&broker->topics, topic);
+    if (!node) {
+        mqtt_topic_remove(&broker->topics, topic);
+        return JS_ThrowInternalError(ctx, "out of memory allocating MQTT subscription");
+    }
+
     // Check if already subscribed to this topic
-    MqttSubscription* existing = find_subscription((uint8_t)brokerId, topic);
-    if (existing) {
+    if (node->sub) {
         // Update callback
-        JS_DeleteGCRef(ctx, &existing->callback);
-        JSValue *pfunc = JS_AddGCRef(ctx, &existing->callback);
-        *pfunc = argv[2];
+        node->sub->callback.val = argv[2];
         ESP_LOGI(MQTT_JS_TAG, "Updated subscription for broker %d topic %s", brokerId, topic);
         return JS_UNDEFINED;
     }
 
-    // Allocate new subscription slot
-    MqttSubscription* sub = alloc_subscription((uint8_t)brokerId);
+    MqttSubscription *sub = calloc(1, sizeof(*sub));
     if (!sub) {
-        return JS_ThrowInternalError(ctx, "too many MQTT subscriptions for broker %d", brokerId);
-    }
-
-    // Dynamically allocate topic string (memory efficient)
-    sub->topic = strdup(topic);
-    if (!sub->topic) {
-        // Out of memory - fail gracefully
-        return JS_ThrowInternalError(ctx, "out of memory allocating topic string");
+        mqtt_topic_remove(&broker->topics, topic);
+        return JS_ThrowInternalError(ctx, "out of memory allocating MQTT subscription");
     }
 
     // Store the callback using GC reference
-    sub->ctx = ctx;
     JSValue *pfunc = JS_AddGCRef(ctx, &sub->callback);
     *pfunc = argv[2];
-    sub->allocated = 1;
+    sub->active = 1;
+    sub->ref_count = 1;
+    node->sub = sub;
+    broker->ctx = ctx;
+    js_mqtt_events_attach(ctx);
 
     // Register binding layer callbacks (only once)
     static int callbacks_registered = 0;
@@ -470,8 +814,10 @@ JSValue js_freebutton_mqtt_subscribe(JSContext *ctx, JSValue *this_val, int argc
 
     // Subscribe through binding layer
     if (mqtt_binding_subscribe((uint8_t)brokerId, topic, qos) < 0) {
+        mqtt_topic_remove(&broker->topics, topic);
         JS_DeleteGCRef(ctx, &sub->callback);
-        sub->allocated = 0;
+        sub->active = 0;
+        mqtt_subscription_unref(sub);
         return JS_ThrowInternalError(ctx, "failed to subscribe to MQTT topic");
     }
 
@@ -505,19 +851,17 @@ JSValue js_freebutton_mqtt_unsubscribe(JSContext *ctx, JSValue *this_val, int ar
         return JS_ThrowTypeError(ctx, "mqtt.unsubscribe() requires brokerId and topic arguments");
     }
 
-    // Find and free subscription
-    MqttSubscription* sub = find_subscription((uint8_t)brokerId, topic);
-    if (sub) {
-        // Free dynamically allocated topic string
-        if (sub->topic) {
-            free(sub->topic);
-            sub->topic = NULL;
-        }
+    if (brokerId < 0 || brokerId >= MAX_BROKERS) {
+        return JS_ThrowRangeError(ctx, "broker ID %d out of range (0-%d)", brokerId, MAX_BROKERS - 1);
+    }
 
+    // Detach and free subscription (a dispatch in flight keeps it alive)
+    MqttSubscription* sub = mqtt_topic_remove(&js_mqtt_brokers[brokerId].topics, topic);
+    if (sub) {
         // Free JavaScript callback reference
         JS_DeleteGCRef(ctx, &sub->callback);
-        sub->allocated = 0;
-        sub->ctx = NULL;
+        sub->active = 0;
+        mqtt_subscription_unref(sub);
     }
 
     // Unsubscribe through binding layer
@@ -565,6 +909,7 @@ JSValue js_freebutton_mqtt_onConnect(JSContext *ctx, JSValue *this_val, int argc
 
     // Store the callback
     broker->ctx = ctx;
+    js_mqtt_events_attach(ctx);
     JSValue *pfunc = JS_AddGCRef(ctx, &broker->connectCallback);
     *pfunc = argv[1];
     broker->connectAllocated = 1;
@@ -609,6 +954,7 @@ JSValue js_freebutton_mqtt_onDisconnect(JSContext *ctx, JSValue *this_val, int a
 
     // Store the callback
     broker->ctx = ctx;
+    js_mqtt_events_attach(ctx);
     JSValue *pfunc = JS_AddGCRef(ctx, &broker->disconnectCallback);
     *pfunc = argv[1];
     broker->disconnectAllocated = 1;
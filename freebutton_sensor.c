@@ -10,15 +10,26 @@
  *   sensor.getInfo(sensorId)      - Get sensor information object
  *   sensor.getAll()               - Get array of all sensor information
  *   sensor.count()                - Get number of available sensors
+ *   sensor.readInto(values[, ids]) - Read sensor values into a Float32Array
+ *   sensor.startSampling(ids, periodMs[, frames]) - Sample into a C ring buffer
+ *   sensor.drain(values)          - Copy the sampled frames into a Float32Array
+ *   sensor.stopSampling()         - Stop sampling, return the dropped frames
+ *
+ * readInto(), drain() and the sampler do not allocate in the JS heap,
+ * so polling sensors at a high rate does not trigger garbage collections.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "mquickjs.h"
 
 // ESP32-specific includes
 #ifdef ESP_PLATFORM
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "../../src/scripting/sensor_binding.h"
 static const char *TAG = "SensorJS";
 #else
@@ -39,6 +50,9 @@ static inline void sensor_hw_register_change_callback(int id, void (*cb)(int, fl
 // Maximum number of sensors (must match sensor_binding.cpp)
 #define MAX_SENSORS 8
 
+// Default number of frames of the sampling ring buffer
+#define SENSOR_SAMPLE_FRAMES 64
+
 // Storage for JavaScript onChange callbacks using JSGCRef for GC protection
 static struct {
     JSContext *ctx;
@@ -46,6 +60,125 @@ static struct {
     int allocated;
 } js_sensor_callbacks[MAX_SENSORS] = {{NULL, {JS_UNDEFINED, NULL}, 0}};
 
+// Sampling ring buffer: a frame holds one value per sampled sensor.
+// The timer callback is the single producer and sensor.drain() the
+// single consumer, 'head' and 'tail' are free running frame counters.
+// 'frames' is a power of two so that the counters can be masked and stay
+// in order when they wrap around at 2^32.
+static struct {
+    int ids[MAX_SENSORS];
+    int idCount;
+    float *buf;
+    uint32_t bufSize; // allocated values, kept between sampling runs
+    uint32_t frames;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t dropped;
+    int running; // read by the timer callback
+    int busy; // set while the timer callback runs
+#ifdef ESP_PLATFORM
+    esp_timer_handle_t timer;
+#endif
+} js_sensor_sampler;
+
+/*
+ * Timer callback: read all the sampled sensors into the next frame.
+ * The frame is dropped if JS did not drain the buffer in time.
+ */
+static void js_sensor_sample(void *arg) {
+    // 'busy' is set before 'running' is read and js_sensor_sampler_stop()
+    // does the opposite, so either the sampler is not touched or the
+    // stop waits for the end of the callback
+    __atomic_store_n(&js_sensor_sampler.busy, 1, __ATOMIC_SEQ_CST);
+    if (!__atomic_load_n(&js_sensor_sampler.running, __ATOMIC_SEQ_CST))
+        goto done;
+
+    uint32_t head = js_sensor_sampler.head;
+    uint32_t tail = __atomic_load_n(&js_sensor_sampler.tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= js_sensor_sampler.frames) {
+        js_sensor_sampler.dropped++;
+        goto done;
+    }
+
+    float *frame = js_sensor_sampler.buf +
+        (head & (js_sensor_sampler.frames - 1)) * js_sensor_sampler.idCount;
+    for (int i = 0; i < js_sensor_sampler.idCount; i++)
+        frame[i] = sensor_hw_get_value(js_sensor_sampler.ids[i]);
+
+    __atomic_store_n(&js_sensor_sampler.head, head + 1, __ATOMIC_RELEASE);
+done:
+    __atomic_store_n(&js_sensor_sampler.busy, 0, __ATOMIC_RELEASE);
+}
+
+static int js_sensor_timer_start(uint32_t periodMs) {
+#ifdef ESP_PLATFORM
+    if (!js_sensor_sampler.timer) {
+        const esp_timer_create_args_t args = {
+            .callback = js_sensor_sample,
+            .name = "sensor_sample",
+        };
+        if (esp_timer_create(&args, &js_sensor_sampler.timer) != ESP_OK)
+            return -1;
+    }
+    if (esp_timer_start_periodic(js_sensor_sampler.timer, (uint64_t)periodMs * 1000) != ESP_OK)
+        return -1;
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+static void js_sensor_timer_stop(void) {
+#ifdef ESP_PLATFORM
+    esp_timer_stop(js_sensor_sampler.timer);
+#endif
+}
+
+/*
+ * Stop the sampling. esp_timer_stop() does not wait for a callback
+ * which is already running, so wait for it before the sampler state
+ * or the buffer can be modified.
+ */
+static void js_sensor_sampler_stop(void) {
+    if (!js_sensor_sampler.running)
+        return;
+    __atomic_store_n(&js_sensor_sampler.running, 0, __ATOMIC_SEQ_CST);
+    js_sensor_timer_stop();
+    while (__atomic_load_n(&js_sensor_sampler.busy, __ATOMIC_SEQ_CST)) {
+#ifdef ESP_PLATFORM
+        vTaskDelay(1);
+#endif
+    }
+}
+
+/*
+ * Read a sensor ID list (array-like object) into 'ids'. All the sensors
+ * are used if 'val' is undefined. Return the number of IDs or -1 if
+ * exception.
+ */
+static int js_sensor_get_ids(JSContext *ctx, int *ids, JSValue val) {
+    JSValue v;
+    int count;
+
+    if (JS_IsUndefined(val))
+        return sensor_hw_get_all_ids(ids, MAX_SENSORS);
+
+    v = JS_GetPropertyStr(ctx, val, "length");
+    if (JS_IsException(v) || JS_ToInt32(ctx, &count, v))
+        return -1;
+    if (count < 0 || count > MAX_SENSORS) {
+        JS_ThrowRangeError(ctx, "at most %d sensor IDs", MAX_SENSORS);
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        v = JS_GetPropertyUint32(ctx, val, i);
+        if (JS_IsException(v) || JS_ToInt32(ctx, &ids[i], v))
+            return -1;
+    }
+    return count;
+}
+
 /*
  * C callback wrapper - called from the hardware layer
  * and invokes the JavaScript callback
@@ -264,4 +397,150 @@ JSValue js_freebutton_sensor_onChange(JSContext *ctx, JSValue *this_val, int arg
     sensor_hw_register_change_callback(sensorId, js_sensor_change_wrapper);
 
     return JS_UNDEFINED;
-}
\ No newline at end of file
+}
+
+/**
+ * @jsapi sensor.readInto
+ * @description Read the current value of several sensors without allocating
+ * @param {Float32Array} values - Receives one value per sensor
+ * @param {number[]} [ids] - Sensor IDs (default: all sensors)
+ * @returns {number} Number of values written
+ */
+JSValue js_freebutton_sensor_readInto(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    int ids[MAX_SENSORS];
+    int count;
+    size_t len;
+    float *values;
+
+    count = js_sensor_get_ids(ctx, ids, argc >= 2 ? argv[1] : JS_UNDEFINED);
+    if (count < 0)
+        return JS_EXCEPTION;
+
+    // Get the data pointer last: it moves when the JS heap is compacted
+    values = JS_GetTypedArray(ctx, &len, argv[0], JS_CLASS_FLOAT32_ARRAY);
+    if (!values)
+        return JS_ThrowTypeError(ctx, "sensor.readInto() requires a Float32Array");
+
+    if ((size_t)count > len)
+        count = len;
+    for (int i = 0; i < count; i++)
+        values[i] = sensor_hw_get_value(ids[i]);
+
+    return JS_NewInt32(ctx, count);
+}
+
+/**
+ * @jsapi sensor.startSampling
+ * @description Sample sensors at a fixed rate into a C-side ring buffer
+ * @param {number[]} ids - Sensor IDs, one value per ID in each frame
+ * @param {number} periodMs - Sampling period in milliseconds
+ * @param {number} [frames=64] - Ring buffer size in frames (rounded up to a power of two)
+ * @returns {void}
+ */
+JSValue js_freebutton_sensor_startSampling(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    int ids[MAX_SENSORS];
+    int count, periodMs, frames = SENSOR_SAMPLE_FRAMES;
+
+    if (argc < 2)
+        return JS_ThrowTypeError(ctx, "sensor.startSampling() requires ids and periodMs arguments");
+    count = js_sensor_get_ids(ctx, ids, argv[0]);
+    if (count < 0)
+        return JS_EXCEPTION;
+    if (count == 0)
+        return JS_ThrowRangeError(ctx, "no sensor to sample");
+    if (JS_ToInt32(ctx, &periodMs, argv[1]))
+        return JS_EXCEPTION;
+    if (periodMs <= 0)
+        return JS_ThrowRangeError(ctx, "invalid sampling period");
+    if (argc >= 3 && !JS_IsUndefined(argv[2])) {
+        if (JS_ToInt32(ctx, &frames, argv[2]))
+            return JS_EXCEPTION;
+        // the buffer size in bytes must fit in 32 bits once rounded up
+        if (frames <= 0 || (uint32_t)frames > UINT32_MAX / sizeof(float) / MAX_SENSORS / 2)
+            return JS_ThrowRangeError(ctx, "invalid number of frames");
+    }
+
+    // round up to a power of two (no overflow, frames < 2^26)
+    uint32_t f = (uint32_t)frames - 1;
+    f |= f >> 1;
+    f |= f >> 2;
+    f |= f >> 4;
+    f |= f >> 8;
+    f |= f >> 16;
+    frames = f + 1;
+
+    js_sensor_sampler_stop();
+
+    // The buffer is only grown so that it is reused between sampling runs
+    uint32_t size = (uint32_t)frames * count;
+    if (size > js_sensor_sampler.bufSize) {
+        float *buf = malloc(size * sizeof(float));
+        if (!buf)
+            return JS_ThrowOutOfMemory(ctx);
+        free(js_sensor_sampler.buf);
+        js_sensor_sampler.buf = buf;
+        js_sensor_sampler.bufSize = size;
+    }
+
+    memcpy(js_sensor_sampler.ids, ids, count * sizeof(ids[0]));
+    js_sensor_sampler.idCount = count;
+    js_sensor_sampler.frames = frames;
+    js_sensor_sampler.head = 0;
+    js_sensor_sampler.tail = 0;
+    js_sensor_sampler.dropped = 0;
+
+    __atomic_store_n(&js_sensor_sampler.running, 1, __ATOMIC_SEQ_CST);
+    if (js_sensor_timer_start(periodMs)) {
+        js_sensor_sampler.running = 0;
+        return JS_ThrowInternalError(ctx, "could not start the sampling timer");
+    }
+    ESP_LOGI(TAG, "Sampling %d sensors every %d ms", count, periodMs);
+
+    return JS_UNDEFINED;
+}
+
+/**
+ * @jsapi sensor.drain
+ * @description Copy the sampled frames (oldest first) without allocating
+ * @param {Float32Array} values - Receives the frames one after the other
+ * @returns {number} Number of frames copied
+ */
+JSValue js_freebutton_sensor_drain(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    size_t len;
+    float *values = JS_GetTypedArray(ctx, &len, argv[0], JS_CLASS_FLOAT32_ARRAY);
+    if (!values)
+        return JS_ThrowTypeError(ctx, "sensor.drain() requires a Float32Array");
+
+    int idCount = js_sensor_sampler.idCount;
+    if (idCount == 0)
+        return JS_NewInt32(ctx, 0);
+
+    uint32_t tail = js_sensor_sampler.tail;
+    uint32_t head = __atomic_load_n(&js_sensor_sampler.head, __ATOMIC_ACQUIRE);
+    uint32_t n = head - tail;
+    if (n > len / idCount)
+        n = len / idCount;
+
+    for (uint32_t i = 0; i < n; i++) {
+        const float *frame = js_sensor_sampler.buf +
+            ((tail + i) & (js_sensor_sampler.frames - 1)) * idCount;
+        memcpy(values + i * idCount, frame, idCount * sizeof(float));
+    }
+
+    __atomic_store_n(&js_sensor_sampler.tail, tail + n, __ATOMIC_RELEASE);
+    return JS_NewInt32(ctx, n);
+}
+
+/**
+ * @jsapi sensor.stopSampling
+ * @description Stop the sampling timer (the frames can still be drained)
+ * @returns {number} Number of frames dropped because the buffer was full
+ */
+JSValue js_freebutton_sensor_stopSampling(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    js_sensor_sampler_stop();
+    return JS_NewUint32(ctx, js_sensor_sampler.dropped);
+}
@@ -26,6 +26,7 @@
  *   led.on(position)                 - Turn LED white at position
  *   led.off(position)                - Turn LED off at position
  *   led.setColor(position, r, g, b)  - Set LED RGB color (0-255)
+ *   led.show(data)                   - Set all LEDs from a Uint8Array (GRB)
  *
  * The actual function implementations are in freebutton_led.c which is
  * compiled separately as part of the ESP32 firmware build. The JS_CFUNC_DEF
@@ -36,6 +37,7 @@ static const JSPropDef js_freebutton_led[] = {
     JS_CFUNC_DEF("on", 1, js_freebutton_led_on),
     JS_CFUNC_DEF("off", 1, js_freebutton_led_off),
     JS_CFUNC_DEF("setColor", 4, js_freebutton_led_setColor),
+    JS_CFUNC_DEF("show", 1, js_freebutton_led_show),
     JS_PROP_END,
 };
 
@@ -79,6 +81,10 @@ static const JSClassDef js_freebutton_button_obj =
  *   sensor.getInfo(sensorId)     - Get sensor information object
  *   sensor.getAll()              - Get array of all sensor information
  *   sensor.onChange(sensorId, callback) - Register change event handler
+ *   sensor.readInto(values[, ids]) - Read sensor values into a Float32Array
+ *   sensor.startSampling(ids, periodMs[, frames]) - Sample into a C ring buffer
+ *   sensor.drain(values)         - Copy the sampled frames into a Float32Array
+ *   sensor.stopSampling()        - Stop sampling, return the dropped frames
  *
  * The actual function implementations are in freebutton_sensor.c which is
  * compiled separately as part of the ESP32 firmware build.
@@ -90,6 +96,10 @@ static const JSPropDef js_freebutton_sensor[] = {
     JS_CFUNC_DEF("getInfo", 1, js_freebutton_sensor_getInfo),
     JS_CFUNC_DEF("getAll", 0, js_freebutton_sensor_getAll),
     JS_CFUNC_DEF("onChange", 2, js_freebutton_sensor_onChange),
+    JS_CFUNC_DEF("readInto", 2, js_freebutton_sensor_readInto),
+    JS_CFUNC_DEF("startSampling", 3, js_freebutton_sensor_startSampling),
+    JS_CFUNC_DEF("drain", 1, js_freebutton_sensor_drain),
+    JS_CFUNC_DEF("stopSampling", 0, js_freebutton_sensor_stopSampling),
     JS_PROP_END,
 };
 
@@ -101,6 +111,7 @@ static const JSClassDef js_freebutton_sensor_obj =
  *
  * JavaScript bindings for MQTT publish/subscribe:
  *   mqtt.publish(brokerId, topic, payload[, qos, retain])  - Publish message
+ *   mqtt.publishJSON(brokerId, topic, value[, qos, retain]) - Publish value as JSON
  *   mqtt.subscribe(brokerId, topic, callback[, qos])       - Subscribe to topic
  *   mqtt.unsubscribe(brokerId, topic)                      - Unsubscribe from topic
  *   mqtt.onConnect(brokerId, callback)                     - Register connect callback
@@ -117,6 +128,7 @@ static const JSPropDef js_freebutton_mqtt[] = {
     JS_CFUNC_DEF("getBrokerName", 1, js_freebutton_mqtt_getBrokerName),
     JS_CFUNC_DEF("isConnected", 1, js_freebutton_mqtt_isConnected),
     JS_CFUNC_DEF("publish", 5, js_freebutton_mqtt_publish),
+    JS_CFUNC_DEF("publishJSON", 5, js_freebutton_mqtt_publishJSON),
     JS_CFUNC_DEF("subscribe", 4, js_freebutton_mqtt_subscribe),
     JS_CFUNC_DEF("unsubscribe", 2, js_freebutton_mqtt_unsubscribe),
     JS_CFUNC_DEF("onConnect", 2, js_freebutton_mqtt_onConnect),
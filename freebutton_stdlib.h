@@ -428,692 +428,884 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   0x6d697274,
   0x72617453,
   0x00000074,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "Array" (offset=424) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "repeat" (offset=424) */
+  0x65706572,
+  0x00007461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "Array" (offset=427) */
   0x61727241,
   0x00000079,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "isArray" (offset=427) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "isArray" (offset=430) */
   0x72417369,
   0x00796172,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "push" (offset=430) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "push" (offset=433) */
   0x68737570,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pop" (offset=433) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pop" (offset=436) */
   0x00706f70,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "join" (offset=435) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "join" (offset=438) */
   0x6e696f6a,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "reverse" (offset=438) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "reverse" (offset=441) */
   0x65766572,
   0x00657372,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "shift" (offset=441) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "shift" (offset=444) */
   0x66696873,
   0x00000074,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "splice" (offset=444) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "splice" (offset=447) */
   0x696c7073,
   0x00006563,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "unshift" (offset=447) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "unshift" (offset=450) */
   0x68736e75,
   0x00746669,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "every" (offset=450) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "every" (offset=453) */
   0x72657665,
   0x00000079,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "some" (offset=453) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "some" (offset=456) */
   0x656d6f73,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "forEach" (offset=456) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "forEach" (offset=459) */
   0x45726f66,
   0x00686361,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "map" (offset=459) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "map" (offset=462) */
   0x0070616d,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "filter" (offset=461) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "filter" (offset=464) */
   0x746c6966,
   0x00007265,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "reduce" (offset=464) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "reduce" (offset=467) */
   0x75646572,
   0x00006563,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "reduceRight" (offset=467) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "reduceRight" (offset=470) */
   0x75646572,
   0x69526563,
   0x00746867,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sort" (offset=471) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sort" (offset=474) */
   0x74726f73,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Math" (offset=474) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Math" (offset=477) */
   0x6874614d,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "min" (offset=477) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "min" (offset=480) */
   0x006e696d,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "max" (offset=479) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "max" (offset=482) */
   0x0078616d,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sign" (offset=481) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sign" (offset=484) */
   0x6e676973,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "abs" (offset=484) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "abs" (offset=487) */
   0x00736261,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "floor" (offset=486) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "floor" (offset=489) */
   0x6f6f6c66,
   0x00000072,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "ceil" (offset=489) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "ceil" (offset=492) */
   0x6c696563,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "round" (offset=492) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "round" (offset=495) */
   0x6e756f72,
   0x00000064,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sqrt" (offset=495) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sqrt" (offset=498) */
   0x74727173,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (1 << (JS_MTAG_BITS + 3)), /* "E" (offset=498) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (1 << (JS_MTAG_BITS + 3)), /* "E" (offset=501) */
   0x00000045,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "LN10" (offset=500) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "LN10" (offset=503) */
   0x30314e4c,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "LN2" (offset=503) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "LN2" (offset=506) */
   0x00324e4c,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "LOG2E" (offset=505) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "LOG2E" (offset=508) */
   0x32474f4c,
   0x00000045,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "LOG10E" (offset=508) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "LOG10E" (offset=511) */
   0x31474f4c,
   0x00004530,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "PI" (offset=511) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "PI" (offset=514) */
   0x00004950,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "SQRT1_2" (offset=513) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "SQRT1_2" (offset=516) */
   0x54525153,
   0x00325f31,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "SQRT2" (offset=516) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "SQRT2" (offset=519) */
   0x54525153,
   0x00000032,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "sin" (offset=519) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "sin" (offset=522) */
   0x006e6973,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "cos" (offset=521) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "cos" (offset=524) */
   0x00736f63,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "tan" (offset=523) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "tan" (offset=526) */
   0x006e6174,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "asin" (offset=525) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "asin" (offset=528) */
   0x6e697361,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "acos" (offset=528) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "acos" (offset=531) */
   0x736f6361,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "atan" (offset=531) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "atan" (offset=534) */
   0x6e617461,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "atan2" (offset=534) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "atan2" (offset=537) */
   0x6e617461,
   0x00000032,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "exp" (offset=537) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "exp" (offset=540) */
   0x00707865,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "log" (offset=539) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "log" (offset=542) */
   0x00676f6c,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pow" (offset=541) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pow" (offset=544) */
   0x00776f70,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "random" (offset=543) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "random" (offset=546) */
   0x646e6172,
   0x00006d6f,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "imul" (offset=546) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "imul" (offset=549) */
   0x6c756d69,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "clz32" (offset=549) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "clz32" (offset=552) */
   0x337a6c63,
   0x00000032,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "fround" (offset=552) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "fround" (offset=555) */
   0x756f7266,
   0x0000646e,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "trunc" (offset=555) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "trunc" (offset=558) */
   0x6e757274,
   0x00000063,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "log2" (offset=558) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "log2" (offset=561) */
   0x32676f6c,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "log10" (offset=561) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "log10" (offset=564) */
   0x31676f6c,
   0x00000030,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Date" (offset=564) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "idiv" (offset=567) */
+  0x76696469,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "fxmul" (offset=570) */
+  0x756d7866,
+  0x0000006c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "fxdiv" (offset=573) */
+  0x69647866,
+  0x00000076,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Date" (offset=576) */
   0x65746144,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "now" (offset=567) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "now" (offset=579) */
   0x00776f6e,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "JSON" (offset=569) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "JSON" (offset=581) */
   0x4e4f534a,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "parse" (offset=572) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "parse" (offset=584) */
   0x73726170,
   0x00000065,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "stringify" (offset=575) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "stringify" (offset=587) */
   0x69727473,
   0x6669676e,
   0x00000079,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "RegExp" (offset=579) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "JSONParser" (offset=591) */
+  0x4e4f534a,
+  0x73726150,
+  0x00007265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "write" (offset=595) */
+  0x74697277,
+  0x00000065,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "end" (offset=598) */
+  0x00646e65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "RegExp" (offset=600) */
   0x45676552,
   0x00007078,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "lastIndex" (offset=582) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "lastIndex" (offset=603) */
   0x7473616c,
   0x65646e49,
   0x00000078,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "get lastIndex" (offset=586) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "get lastIndex" (offset=607) */
   0x20746567,
   0x7473616c,
   0x65646e49,
   0x00000078,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "set lastIndex" (offset=591) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "set lastIndex" (offset=612) */
   0x20746573,
   0x7473616c,
   0x65646e49,
   0x00000078,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "source" (offset=596) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "source" (offset=617) */
   0x72756f73,
   0x00006563,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get source" (offset=599) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get source" (offset=620) */
   0x20746567,
   0x72756f73,
   0x00006563,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "flags" (offset=603) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "flags" (offset=624) */
   0x67616c66,
   0x00000073,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get flags" (offset=606) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get flags" (offset=627) */
   0x20746567,
   0x67616c66,
   0x00000073,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "exec" (offset=610) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "exec" (offset=631) */
   0x63657865,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "test" (offset=613) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "test" (offset=634) */
   0x74736574,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "message" (offset=616) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "message" (offset=637) */
   0x7373656d,
   0x00656761,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "get message" (offset=619) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "get message" (offset=640) */
   0x20746567,
   0x7373656d,
   0x00656761,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "stack" (offset=623) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "stack" (offset=644) */
   0x63617473,
   0x0000006b,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get stack" (offset=626) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get stack" (offset=647) */
   0x20746567,
   0x63617473,
   0x0000006b,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "EvalError" (offset=630) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "EvalError" (offset=651) */
   0x6c617645,
   0x6f727245,
   0x00000072,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "RangeError" (offset=634) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "RangeError" (offset=655) */
   0x676e6152,
   0x72724565,
   0x0000726f,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "ReferenceError" (offset=638) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "ReferenceError" (offset=659) */
   0x65666552,
   0x636e6572,
   0x72724565,
   0x0000726f,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "SyntaxError" (offset=643) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "SyntaxError" (offset=664) */
   0x746e7953,
   0x72457861,
   0x00726f72,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "TypeError" (offset=647) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "TypeError" (offset=668) */
   0x65707954,
   0x6f727245,
   0x00000072,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "URIError" (offset=651) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "URIError" (offset=672) */
   0x45495255,
   0x726f7272,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "InternalError" (offset=655) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "InternalError" (offset=676) */
   0x65746e49,
   0x6c616e72,
   0x6f727245,
   0x00000072,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "ArrayBuffer" (offset=660) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "ArrayBuffer" (offset=681) */
   0x61727241,
   0x66754279,
   0x00726566,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteLength" (offset=664) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteLength" (offset=685) */
   0x65747962,
   0x676e654c,
   0x00006874,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteLength" (offset=668) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteLength" (offset=689) */
   0x20746567,
   0x65747962,
   0x676e654c,
   0x00006874,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "Uint8ClampedArray" (offset=673) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "Uint8ClampedArray" (offset=694) */
   0x746e6955,
   0x616c4338,
   0x6465706d,
   0x61727241,
   0x00000079,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "TypedArray" (offset=679) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "TypedArray" (offset=700) */
   0x65707954,
   0x72724164,
   0x00007961,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteOffset" (offset=683) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteOffset" (offset=704) */
   0x65747962,
   0x7366664f,
   0x00007465,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteOffset" (offset=687) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteOffset" (offset=708) */
   0x20746567,
   0x65747962,
   0x7366664f,
   0x00007465,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "buffer" (offset=692) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "buffer" (offset=713) */
   0x66667562,
   0x00007265,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get buffer" (offset=695) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get buffer" (offset=716) */
   0x20746567,
   0x66667562,
   0x00007265,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "subarray" (offset=699) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "subarray" (offset=720) */
   0x61627573,
   0x79617272,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "BYTES_PER_ELEMENT" (offset=703) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "fill" (offset=724) */
+  0x6c6c6966,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "copyWithin" (offset=727) */
+  0x79706f63,
+  0x68746957,
+  0x00006e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "sum" (offset=731) */
+  0x006d7573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "dot" (offset=733) */
+  0x00746f64,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "BYTES_PER_ELEMENT" (offset=735) */
   0x45545942,
   0x45505f53,
   0x4c455f52,
   0x4e454d45,
   0x00000054,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "Int8Array" (offset=709) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "Int8Array" (offset=741) */
   0x38746e49,
   0x61727241,
   0x00000079,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Uint8Array" (offset=713) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Uint8Array" (offset=745) */
   0x746e6955,
   0x72724138,
   0x00007961,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int16Array" (offset=717) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int16Array" (offset=749) */
   0x31746e49,
   0x72724136,
   0x00007961,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint16Array" (offset=721) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint16Array" (offset=753) */
   0x746e6955,
   0x72413631,
   0x00796172,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int32Array" (offset=725) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int32Array" (offset=757) */
   0x33746e49,
   0x72724132,
   0x00007961,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint32Array" (offset=729) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint32Array" (offset=761) */
   0x746e6955,
   0x72413233,
   0x00796172,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float32Array" (offset=733) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float32Array" (offset=765) */
   0x616f6c46,
   0x41323374,
   0x79617272,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float64Array" (offset=738) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float64Array" (offset=770) */
   0x616f6c46,
   0x41343674,
   0x79617272,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "isNaN" (offset=743) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "DataView" (offset=775) */
+  0x61746144,
+  0x77656956,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "getInt8" (offset=779) */
+  0x49746567,
+  0x0038746e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "setInt8" (offset=782) */
+  0x49746573,
+  0x0038746e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getUint8" (offset=785) */
+  0x55746567,
+  0x38746e69,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setUint8" (offset=789) */
+  0x55746573,
+  0x38746e69,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getInt16" (offset=793) */
+  0x49746567,
+  0x3631746e,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setInt16" (offset=797) */
+  0x49746573,
+  0x3631746e,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "getUint16" (offset=801) */
+  0x55746567,
+  0x31746e69,
+  0x00000036,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "setUint16" (offset=805) */
+  0x55746573,
+  0x31746e69,
+  0x00000036,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getInt32" (offset=809) */
+  0x49746567,
+  0x3233746e,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setInt32" (offset=813) */
+  0x49746573,
+  0x3233746e,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "getUint32" (offset=817) */
+  0x55746567,
+  0x33746e69,
+  0x00000032,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "setUint32" (offset=821) */
+  0x55746573,
+  0x33746e69,
+  0x00000032,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getFloat32" (offset=825) */
+  0x46746567,
+  0x74616f6c,
+  0x00003233,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setFloat32" (offset=829) */
+  0x46746573,
+  0x74616f6c,
+  0x00003233,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getFloat64" (offset=833) */
+  0x46746567,
+  0x74616f6c,
+  0x00003436,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setFloat64" (offset=837) */
+  0x46746573,
+  0x74616f6c,
+  0x00003436,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "isNaN" (offset=841) */
   0x614e7369,
   0x0000004e,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "isFinite" (offset=746) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "isFinite" (offset=844) */
   0x69467369,
   0x6574696e,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "globalThis" (offset=750) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "globalThis" (offset=848) */
   0x626f6c67,
   0x68546c61,
   0x00007369,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "console" (offset=754) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "console" (offset=852) */
   0x736e6f63,
   0x00656c6f,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "performance" (offset=757) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "performance" (offset=855) */
   0x66726570,
   0x616d726f,
   0x0065636e,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "led" (offset=761) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "memory" (offset=859) */
+  0x6f6d656d,
+  0x00007972,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "resetMemory" (offset=862) */
+  0x65736572,
+  0x6d654d74,
+  0x0079726f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "heapProfile" (offset=866) */
+  0x70616568,
+  0x666f7250,
+  0x00656c69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "heapReport" (offset=870) */
+  0x70616568,
+  0x6f706552,
+  0x00007472,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "led" (offset=874) */
   0x0064656c,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "count" (offset=763) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "count" (offset=876) */
   0x6e756f63,
   0x00000074,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "on" (offset=766) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "on" (offset=879) */
   0x00006e6f,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "off" (offset=768) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "off" (offset=881) */
   0x0066666f,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setColor" (offset=770) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setColor" (offset=883) */
   0x43746573,
   0x726f6c6f,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "button" (offset=774) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "show" (offset=887) */
+  0x776f6873,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "button" (offset=890) */
   0x74747562,
   0x00006e6f,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setLabel" (offset=777) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setLabel" (offset=893) */
   0x4c746573,
   0x6c656261,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "setTopLabel" (offset=781) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "setTopLabel" (offset=897) */
   0x54746573,
   0x614c706f,
   0x006c6562,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "onClick" (offset=785) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "onClick" (offset=901) */
   0x6c436e6f,
   0x006b6369,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "onLongPress" (offset=788) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "onLongPress" (offset=904) */
   0x6f4c6e6f,
   0x7250676e,
   0x00737365,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "onRelease" (offset=792) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "onRelease" (offset=908) */
   0x65526e6f,
   0x7361656c,
   0x00000065,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "sensor" (offset=796) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "sensor" (offset=912) */
   0x736e6573,
   0x0000726f,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getValue" (offset=799) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getValue" (offset=915) */
   0x56746567,
   0x65756c61,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "getType" (offset=803) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "getType" (offset=919) */
   0x54746567,
   0x00657079,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "getInfo" (offset=806) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "getInfo" (offset=922) */
   0x49746567,
   0x006f666e,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "getAll" (offset=809) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "getAll" (offset=925) */
   0x41746567,
   0x00006c6c,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "onChange" (offset=812) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "onChange" (offset=928) */
   0x68436e6f,
   0x65676e61,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "mqtt" (offset=816) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "readInto" (offset=932) */
+  0x64616572,
+  0x6f746e49,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "startSampling" (offset=936) */
+  0x72617473,
+  0x6d615374,
+  0x6e696c70,
+  0x00000067,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "drain" (offset=941) */
+  0x69617264,
+  0x0000006e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "stopSampling" (offset=944) */
+  0x706f7473,
+  0x706d6153,
+  0x676e696c,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "mqtt" (offset=949) */
   0x7474716d,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "getBrokerCount" (offset=819) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "getBrokerCount" (offset=952) */
   0x42746567,
   0x656b6f72,
   0x756f4372,
   0x0000746e,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "getBrokerName" (offset=824) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "getBrokerName" (offset=957) */
   0x42746567,
   0x656b6f72,
   0x6d614e72,
   0x00000065,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "isConnected" (offset=829) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "isConnected" (offset=962) */
   0x6f437369,
   0x63656e6e,
   0x00646574,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "publish" (offset=833) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "publish" (offset=966) */
   0x6c627570,
   0x00687369,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "subscribe" (offset=836) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "publishJSON" (offset=969) */
+  0x6c627570,
+  0x4a687369,
+  0x004e4f53,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "subscribe" (offset=973) */
   0x73627573,
   0x62697263,
   0x00000065,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "unsubscribe" (offset=840) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "unsubscribe" (offset=977) */
   0x75736e75,
   0x72637362,
   0x00656269,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "onConnect" (offset=844) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "onConnect" (offset=981) */
   0x6f436e6f,
   0x63656e6e,
   0x00000074,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "onDisconnect" (offset=848) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "onDisconnect" (offset=985) */
   0x69446e6f,
   0x6e6f6373,
   0x7463656e,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "print" (offset=853) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "print" (offset=990) */
   0x6e697270,
   0x00000074,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "gc" (offset=856) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "gc" (offset=993) */
   0x00006367,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "load" (offset=858) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "load" (offset=995) */
   0x64616f6c,
   0x00000000,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "loadMapped" (offset=861) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "loadMapped" (offset=998) */
   0x64616f6c,
   0x7070614d,
   0x00006465,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setTimeout" (offset=865) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (16 << (JS_MTAG_BITS + 3)), /* "loadUserBytecode" (offset=1002) */
+  0x64616f6c,
+  0x72657355,
+  0x65747942,
+  0x65646f63,
+  0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setTimeout" (offset=1008) */
   0x54746573,
   0x6f656d69,
   0x00007475,
-  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "clearTimeout" (offset=869) */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "clearTimeout" (offset=1012) */
   0x61656c63,
   0x6d695472,
   0x74756f65,
   0x00000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "setInterval" (offset=1017) */
+  0x49746573,
+  0x7265746e,
+  0x006c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "clearInterval" (offset=1021) */
+  0x61656c63,
+  0x746e4972,
+  0x61767265,
+  0x0000006c,
 
-  /* sorted atom table (offset=874) */
-  JS_VALUE_ARRAY_HEADER(258),
+  /* sorted atom table (offset=1026) */
+  JS_VALUE_ARRAY_HEADER(299),
   JS_ROM_VALUE(134), /* empty */
   JS_ROM_VALUE(201), /* _Infinity */
   JS_ROM_VALUE(162), /* _eval_ */
   JS_ROM_VALUE(159), /* _ret_ */
-  JS_ROM_VALUE(424), /* Array */
-  JS_ROM_VALUE(660), /* ArrayBuffer */
-  JS_ROM_VALUE(703), /* BYTES_PER_ELEMENT */
+  JS_ROM_VALUE(427), /* Array */
+  JS_ROM_VALUE(681), /* ArrayBuffer */
+  JS_ROM_VALUE(735), /* BYTES_PER_ELEMENT */
   JS_ROM_VALUE(342), /* Boolean */
-  JS_ROM_VALUE(564), /* Date */
-  JS_ROM_VALUE(498), /* E */
+  JS_ROM_VALUE(775), /* DataView */
+  JS_ROM_VALUE(576), /* Date */
+  JS_ROM_VALUE(501), /* E */
   JS_ROM_VALUE(315), /* EPSILON */
   JS_ROM_VALUE(208), /* Error */
-  JS_ROM_VALUE(630), /* EvalError */
-  JS_ROM_VALUE(733), /* Float32Array */
-  JS_ROM_VALUE(738), /* Float64Array */
+  JS_ROM_VALUE(651), /* EvalError */
+  JS_ROM_VALUE(765), /* Float32Array */
+  JS_ROM_VALUE(770), /* Float64Array */
   JS_ROM_VALUE(253), /* Function */
   JS_ROM_VALUE(197), /* Infinity */
-  JS_ROM_VALUE(717), /* Int16Array */
-  JS_ROM_VALUE(725), /* Int32Array */
-  JS_ROM_VALUE(709), /* Int8Array */
-  JS_ROM_VALUE(655), /* InternalError */
-  JS_ROM_VALUE(569), /* JSON */
-  JS_ROM_VALUE(500), /* LN10 */
-  JS_ROM_VALUE(503), /* LN2 */
-  JS_ROM_VALUE(508), /* LOG10E */
-  JS_ROM_VALUE(505), /* LOG2E */
+  JS_ROM_VALUE(749), /* Int16Array */
+  JS_ROM_VALUE(757), /* Int32Array */
+  JS_ROM_VALUE(741), /* Int8Array */
+  JS_ROM_VALUE(676), /* InternalError */
+  JS_ROM_VALUE(581), /* JSON */
+  JS_ROM_VALUE(591), /* JSONParser */
+  JS_ROM_VALUE(503), /* LN10 */
+  JS_ROM_VALUE(506), /* LN2 */
+  JS_ROM_VALUE(511), /* LOG10E */
+  JS_ROM_VALUE(508), /* LOG2E */
   JS_ROM_VALUE(318), /* MAX_SAFE_INTEGER */
   JS_ROM_VALUE(295), /* MAX_VALUE */
   JS_ROM_VALUE(324), /* MIN_SAFE_INTEGER */
   JS_ROM_VALUE(299), /* MIN_VALUE */
-  JS_ROM_VALUE(474), /* Math */
+  JS_ROM_VALUE(477), /* Math */
   JS_ROM_VALUE(303), /* NEGATIVE_INFINITY */
   JS_ROM_VALUE(195), /* NaN */
   JS_ROM_VALUE(284), /* Number */
   JS_ROM_VALUE(224), /* Object */
-  JS_ROM_VALUE(511), /* PI */
+  JS_ROM_VALUE(514), /* PI */
   JS_ROM_VALUE(309), /* POSITIVE_INFINITY */
-  JS_ROM_VALUE(634), /* RangeError */
-  JS_ROM_VALUE(638), /* ReferenceError */
-  JS_ROM_VALUE(579), /* RegExp */
-  JS_ROM_VALUE(513), /* SQRT1_2 */
-  JS_ROM_VALUE(516), /* SQRT2 */
+  JS_ROM_VALUE(655), /* RangeError */
+  JS_ROM_VALUE(659), /* ReferenceError */
+  JS_ROM_VALUE(600), /* RegExp */
+  JS_ROM_VALUE(516), /* SQRT1_2 */
+  JS_ROM_VALUE(519), /* SQRT2 */
   JS_ROM_VALUE(345), /* String */
-  JS_ROM_VALUE(643), /* SyntaxError */
-  JS_ROM_VALUE(647), /* TypeError */
-  JS_ROM_VALUE(679), /* TypedArray */
-  JS_ROM_VALUE(651), /* URIError */
-  JS_ROM_VALUE(721), /* Uint16Array */
-  JS_ROM_VALUE(729), /* Uint32Array */
-  JS_ROM_VALUE(713), /* Uint8Array */
-  JS_ROM_VALUE(673), /* Uint8ClampedArray */
+  JS_ROM_VALUE(664), /* SyntaxError */
+  JS_ROM_VALUE(668), /* TypeError */
+  JS_ROM_VALUE(700), /* TypedArray */
+  JS_ROM_VALUE(672), /* URIError */
+  JS_ROM_VALUE(753), /* Uint16Array */
+  JS_ROM_VALUE(761), /* Uint32Array */
+  JS_ROM_VALUE(745), /* Uint8Array */
+  JS_ROM_VALUE(694), /* Uint8ClampedArray */
   JS_ROM_VALUE(211), /* __proto__ */
-  JS_ROM_VALUE(484), /* abs */
-  JS_ROM_VALUE(528), /* acos */
+  JS_ROM_VALUE(487), /* abs */
+  JS_ROM_VALUE(531), /* acos */
   JS_ROM_VALUE(270), /* apply */
   JS_ROM_VALUE(168), /* arguments */
-  JS_ROM_VALUE(525), /* asin */
-  JS_ROM_VALUE(531), /* atan */
-  JS_ROM_VALUE(534), /* atan2 */
+  JS_ROM_VALUE(528), /* asin */
+  JS_ROM_VALUE(534), /* atan */
+  JS_ROM_VALUE(537), /* atan2 */
   JS_ROM_VALUE(273), /* bind */
   JS_ROM_VALUE(156), /* boolean */
   JS_ROM_VALUE(221), /* bound */
   JS_ROM_VALUE(46), /* break */
-  JS_ROM_VALUE(692), /* buffer */
-  JS_ROM_VALUE(774), /* button */
-  JS_ROM_VALUE(664), /* byteLength */
-  JS_ROM_VALUE(683), /* byteOffset */
+  JS_ROM_VALUE(713), /* buffer */
+  JS_ROM_VALUE(890), /* button */
+  JS_ROM_VALUE(685), /* byteLength */
+  JS_ROM_VALUE(704), /* byteOffset */
   JS_ROM_VALUE(267), /* call */
   JS_ROM_VALUE(56), /* case */
   JS_ROM_VALUE(67), /* catch */
-  JS_ROM_VALUE(489), /* ceil */
+  JS_ROM_VALUE(492), /* ceil */
   JS_ROM_VALUE(362), /* charAt */
   JS_ROM_VALUE(365), /* charCodeAt */
   JS_ROM_VALUE(84), /* class */
-  JS_ROM_VALUE(869), /* clearTimeout */
-  JS_ROM_VALUE(549), /* clz32 */
+  JS_ROM_VALUE(1021), /* clearInterval */
+  JS_ROM_VALUE(1012), /* clearTimeout */
+  JS_ROM_VALUE(552), /* clz32 */
   JS_ROM_VALUE(369), /* codePointAt */
   JS_ROM_VALUE(380), /* concat */
-  JS_ROM_VALUE(754), /* console */
+  JS_ROM_VALUE(852), /* console */
   JS_ROM_VALUE(87), /* const */
   JS_ROM_VALUE(183), /* constructor */
   JS_ROM_VALUE(49), /* continue */
-  JS_ROM_VALUE(521), /* cos */
-  JS_ROM_VALUE(763), /* count */
+  JS_ROM_VALUE(727), /* copyWithin */
+  JS_ROM_VALUE(524), /* cos */
+  JS_ROM_VALUE(876), /* count */
   JS_ROM_VALUE(242), /* create */
   JS_ROM_VALUE(77), /* debugger */
   JS_ROM_VALUE(59), /* default */
   JS_ROM_VALUE(227), /* defineProperty */
   JS_ROM_VALUE(22), /* delete */
   JS_ROM_VALUE(39), /* do */
+  JS_ROM_VALUE(733), /* dot */
+  JS_ROM_VALUE(941), /* drain */
   JS_ROM_VALUE(11), /* else */
+  JS_ROM_VALUE(598), /* end */
   JS_ROM_VALUE(90), /* enum */
   JS_ROM_VALUE(165), /* eval */
-  JS_ROM_VALUE(450), /* every */
-  JS_ROM_VALUE(610), /* exec */
-  JS_ROM_VALUE(537), /* exp */
+  JS_ROM_VALUE(453), /* every */
+  JS_ROM_VALUE(631), /* exec */
+  JS_ROM_VALUE(540), /* exp */
   JS_ROM_VALUE(93), /* export */
   JS_ROM_VALUE(96), /* extends */
   JS_ROM_VALUE(3), /* false */
-  JS_ROM_VALUE(461), /* filter */
+  JS_ROM_VALUE(724), /* fill */
+  JS_ROM_VALUE(464), /* filter */
   JS_ROM_VALUE(70), /* finally */
-  JS_ROM_VALUE(603), /* flags */
-  JS_ROM_VALUE(486), /* floor */
+  JS_ROM_VALUE(624), /* flags */
+  JS_ROM_VALUE(489), /* floor */
   JS_ROM_VALUE(44), /* for */
-  JS_ROM_VALUE(456), /* forEach */
+  JS_ROM_VALUE(459), /* forEach */
   JS_ROM_VALUE(348), /* fromCharCode */
   JS_ROM_VALUE(353), /* fromCodePoint */
-  JS_ROM_VALUE(552), /* fround */
+  JS_ROM_VALUE(555), /* fround */
   JS_ROM_VALUE(73), /* function */
-  JS_ROM_VALUE(856), /* gc */
+  JS_ROM_VALUE(573), /* fxdiv */
+  JS_ROM_VALUE(570), /* fxmul */
+  JS_ROM_VALUE(993), /* gc */
   JS_ROM_VALUE(175), /* get */
-  JS_ROM_VALUE(695), /* get buffer */
-  JS_ROM_VALUE(668), /* get byteLength */
-  JS_ROM_VALUE(687), /* get byteOffset */
-  JS_ROM_VALUE(606), /* get flags */
-  JS_ROM_VALUE(586), /* get lastIndex */
+  JS_ROM_VALUE(716), /* get buffer */
+  JS_ROM_VALUE(689), /* get byteLength */
+  JS_ROM_VALUE(708), /* get byteOffset */
+  JS_ROM_VALUE(627), /* get flags */
+  JS_ROM_VALUE(607), /* get lastIndex */
   JS_ROM_VALUE(276), /* get length */
-  JS_ROM_VALUE(619), /* get message */
+  JS_ROM_VALUE(640), /* get message */
   JS_ROM_VALUE(280), /* get name */
   JS_ROM_VALUE(257), /* get prototype */
-  JS_ROM_VALUE(599), /* get source */
-  JS_ROM_VALUE(626), /* get stack */
-  JS_ROM_VALUE(809), /* getAll */
-  JS_ROM_VALUE(819), /* getBrokerCount */
-  JS_ROM_VALUE(824), /* getBrokerName */
-  JS_ROM_VALUE(806), /* getInfo */
+  JS_ROM_VALUE(620), /* get source */
+  JS_ROM_VALUE(647), /* get stack */
+  JS_ROM_VALUE(925), /* getAll */
+  JS_ROM_VALUE(952), /* getBrokerCount */
+  JS_ROM_VALUE(957), /* getBrokerName */
+  JS_ROM_VALUE(825), /* getFloat32 */
+  JS_ROM_VALUE(833), /* getFloat64 */
+  JS_ROM_VALUE(922), /* getInfo */
+  JS_ROM_VALUE(793), /* getInt16 */
+  JS_ROM_VALUE(809), /* getInt32 */
+  JS_ROM_VALUE(779), /* getInt8 */
   JS_ROM_VALUE(232), /* getPrototypeOf */
-  JS_ROM_VALUE(803), /* getType */
-  JS_ROM_VALUE(799), /* getValue */
-  JS_ROM_VALUE(750), /* globalThis */
+  JS_ROM_VALUE(919), /* getType */
+  JS_ROM_VALUE(801), /* getUint16 */
+  JS_ROM_VALUE(817), /* getUint32 */
+  JS_ROM_VALUE(785), /* getUint8 */
+  JS_ROM_VALUE(915), /* getValue */
+  JS_ROM_VALUE(848), /* globalThis */
   JS_ROM_VALUE(248), /* hasOwnProperty */
+  JS_ROM_VALUE(866), /* heapProfile */
+  JS_ROM_VALUE(870), /* heapReport */
+  JS_ROM_VALUE(567), /* idiv */
   JS_ROM_VALUE(9), /* if */
   JS_ROM_VALUE(105), /* implements */
   JS_ROM_VALUE(99), /* import */
-  JS_ROM_VALUE(546), /* imul */
+  JS_ROM_VALUE(549), /* imul */
   JS_ROM_VALUE(33), /* in */
   JS_ROM_VALUE(215), /* index */
   JS_ROM_VALUE(383), /* indexOf */
   JS_ROM_VALUE(218), /* input */
   JS_ROM_VALUE(35), /* instanceof */
   JS_ROM_VALUE(109), /* interface */
-  JS_ROM_VALUE(427), /* isArray */
-  JS_ROM_VALUE(829), /* isConnected */
-  JS_ROM_VALUE(746), /* isFinite */
-  JS_ROM_VALUE(743), /* isNaN */
-  JS_ROM_VALUE(435), /* join */
+  JS_ROM_VALUE(430), /* isArray */
+  JS_ROM_VALUE(962), /* isConnected */
+  JS_ROM_VALUE(844), /* isFinite */
+  JS_ROM_VALUE(841), /* isNaN */
+  JS_ROM_VALUE(438), /* join */
   JS_ROM_VALUE(245), /* keys */
-  JS_ROM_VALUE(582), /* lastIndex */
+  JS_ROM_VALUE(603), /* lastIndex */
   JS_ROM_VALUE(386), /* lastIndexOf */
-  JS_ROM_VALUE(761), /* led */
+  JS_ROM_VALUE(874), /* led */
   JS_ROM_VALUE(187), /* length */
   JS_ROM_VALUE(113), /* let */
-  JS_ROM_VALUE(858), /* load */
-  JS_ROM_VALUE(861), /* loadMapped */
-  JS_ROM_VALUE(539), /* log */
-  JS_ROM_VALUE(561), /* log10 */
-  JS_ROM_VALUE(558), /* log2 */
-  JS_ROM_VALUE(459), /* map */
+  JS_ROM_VALUE(995), /* load */
+  JS_ROM_VALUE(998), /* loadMapped */
+  JS_ROM_VALUE(1002), /* loadUserBytecode */
+  JS_ROM_VALUE(542), /* log */
+  JS_ROM_VALUE(564), /* log10 */
+  JS_ROM_VALUE(561), /* log2 */
+  JS_ROM_VALUE(462), /* map */
   JS_ROM_VALUE(390), /* match */
-  JS_ROM_VALUE(479), /* max */
-  JS_ROM_VALUE(616), /* message */
-  JS_ROM_VALUE(477), /* min */
-  JS_ROM_VALUE(816), /* mqtt */
+  JS_ROM_VALUE(482), /* max */
+  JS_ROM_VALUE(859), /* memory */
+  JS_ROM_VALUE(637), /* message */
+  JS_ROM_VALUE(480), /* min */
+  JS_ROM_VALUE(949), /* mqtt */
   JS_ROM_VALUE(205), /* name */
   JS_ROM_VALUE(31), /* new */
-  JS_ROM_VALUE(567), /* now */
+  JS_ROM_VALUE(579), /* now */
   JS_ROM_VALUE(0), /* null */
   JS_ROM_VALUE(143), /* number */
   JS_ROM_VALUE(146), /* object */
   JS_ROM_VALUE(193), /* of */
-  JS_ROM_VALUE(768), /* off */
-  JS_ROM_VALUE(766), /* on */
-  JS_ROM_VALUE(812), /* onChange */
-  JS_ROM_VALUE(785), /* onClick */
-  JS_ROM_VALUE(844), /* onConnect */
-  JS_ROM_VALUE(848), /* onDisconnect */
-  JS_ROM_VALUE(788), /* onLongPress */
-  JS_ROM_VALUE(792), /* onRelease */
+  JS_ROM_VALUE(881), /* off */
+  JS_ROM_VALUE(879), /* on */
+  JS_ROM_VALUE(928), /* onChange */
+  JS_ROM_VALUE(901), /* onClick */
+  JS_ROM_VALUE(981), /* onConnect */
+  JS_ROM_VALUE(985), /* onDisconnect */
+  JS_ROM_VALUE(904), /* onLongPress */
+  JS_ROM_VALUE(908), /* onRelease */
   JS_ROM_VALUE(115), /* package */
-  JS_ROM_VALUE(572), /* parse */
+  JS_ROM_VALUE(584), /* parse */
   JS_ROM_VALUE(291), /* parseFloat */
   JS_ROM_VALUE(287), /* parseInt */
-  JS_ROM_VALUE(757), /* performance */
-  JS_ROM_VALUE(433), /* pop */
-  JS_ROM_VALUE(541), /* pow */
-  JS_ROM_VALUE(853), /* print */
+  JS_ROM_VALUE(855), /* performance */
+  JS_ROM_VALUE(436), /* pop */
+  JS_ROM_VALUE(544), /* pow */
+  JS_ROM_VALUE(990), /* print */
   JS_ROM_VALUE(118), /* private */
   JS_ROM_VALUE(121), /* protected */
   JS_ROM_VALUE(179), /* prototype */
   JS_ROM_VALUE(125), /* public */
-  JS_ROM_VALUE(833), /* publish */
-  JS_ROM_VALUE(430), /* push */
-  JS_ROM_VALUE(543), /* random */
-  JS_ROM_VALUE(464), /* reduce */
-  JS_ROM_VALUE(467), /* reduceRight */
+  JS_ROM_VALUE(966), /* publish */
+  JS_ROM_VALUE(969), /* publishJSON */
+  JS_ROM_VALUE(433), /* push */
+  JS_ROM_VALUE(546), /* random */
+  JS_ROM_VALUE(932), /* readInto */
+  JS_ROM_VALUE(467), /* reduce */
+  JS_ROM_VALUE(470), /* reduceRight */
+  JS_ROM_VALUE(424), /* repeat */
   JS_ROM_VALUE(393), /* replace */
   JS_ROM_VALUE(396), /* replaceAll */
+  JS_ROM_VALUE(862), /* resetMemory */
   JS_ROM_VALUE(14), /* return */
-  JS_ROM_VALUE(438), /* reverse */
-  JS_ROM_VALUE(492), /* round */
+  JS_ROM_VALUE(441), /* reverse */
+  JS_ROM_VALUE(495), /* round */
   JS_ROM_VALUE(400), /* search */
-  JS_ROM_VALUE(796), /* sensor */
+  JS_ROM_VALUE(912), /* sensor */
   JS_ROM_VALUE(177), /* set */
-  JS_ROM_VALUE(591), /* set lastIndex */
+  JS_ROM_VALUE(612), /* set lastIndex */
   JS_ROM_VALUE(358), /* set length */
   JS_ROM_VALUE(262), /* set prototype */
-  JS_ROM_VALUE(770), /* setColor */
-  JS_ROM_VALUE(777), /* setLabel */
+  JS_ROM_VALUE(883), /* setColor */
+  JS_ROM_VALUE(829), /* setFloat32 */
+  JS_ROM_VALUE(837), /* setFloat64 */
+  JS_ROM_VALUE(797), /* setInt16 */
+  JS_ROM_VALUE(813), /* setInt32 */
+  JS_ROM_VALUE(782), /* setInt8 */
+  JS_ROM_VALUE(1017), /* setInterval */
+  JS_ROM_VALUE(893), /* setLabel */
   JS_ROM_VALUE(237), /* setPrototypeOf */
-  JS_ROM_VALUE(865), /* setTimeout */
-  JS_ROM_VALUE(781), /* setTopLabel */
-  JS_ROM_VALUE(441), /* shift */
-  JS_ROM_VALUE(481), /* sign */
-  JS_ROM_VALUE(519), /* sin */
+  JS_ROM_VALUE(1008), /* setTimeout */
+  JS_ROM_VALUE(897), /* setTopLabel */
+  JS_ROM_VALUE(805), /* setUint16 */
+  JS_ROM_VALUE(821), /* setUint32 */
+  JS_ROM_VALUE(789), /* setUint8 */
+  JS_ROM_VALUE(444), /* shift */
+  JS_ROM_VALUE(887), /* show */
+  JS_ROM_VALUE(484), /* sign */
+  JS_ROM_VALUE(522), /* sin */
   JS_ROM_VALUE(373), /* slice */
-  JS_ROM_VALUE(453), /* some */
-  JS_ROM_VALUE(471), /* sort */
-  JS_ROM_VALUE(596), /* source */
-  JS_ROM_VALUE(444), /* splice */
+  JS_ROM_VALUE(456), /* some */
+  JS_ROM_VALUE(474), /* sort */
+  JS_ROM_VALUE(617), /* source */
+  JS_ROM_VALUE(447), /* splice */
   JS_ROM_VALUE(403), /* split */
-  JS_ROM_VALUE(495), /* sqrt */
-  JS_ROM_VALUE(623), /* stack */
+  JS_ROM_VALUE(498), /* sqrt */
+  JS_ROM_VALUE(644), /* stack */
+  JS_ROM_VALUE(936), /* startSampling */
   JS_ROM_VALUE(128), /* static */
+  JS_ROM_VALUE(944), /* stopSampling */
   JS_ROM_VALUE(153), /* string */
-  JS_ROM_VALUE(575), /* stringify */
-  JS_ROM_VALUE(699), /* subarray */
-  JS_ROM_VALUE(836), /* subscribe */
+  JS_ROM_VALUE(587), /* stringify */
+  JS_ROM_VALUE(720), /* subarray */
+  JS_ROM_VALUE(973), /* subscribe */
   JS_ROM_VALUE(376), /* substring */
+  JS_ROM_VALUE(731), /* sum */
   JS_ROM_VALUE(102), /* super */
   JS_ROM_VALUE(53), /* switch */
-  JS_ROM_VALUE(523), /* tan */
+  JS_ROM_VALUE(526), /* tan */
   JS_ROM_VALUE(190), /* target */
-  JS_ROM_VALUE(613), /* test */
+  JS_ROM_VALUE(634), /* test */
   JS_ROM_VALUE(19), /* this */
   JS_ROM_VALUE(62), /* throw */
   JS_ROM_VALUE(330), /* toExponential */
@@ -1126,21 +1318,22 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(417), /* trimEnd */
   JS_ROM_VALUE(420), /* trimStart */
   JS_ROM_VALUE(6), /* true */
-  JS_ROM_VALUE(555), /* trunc */
+  JS_ROM_VALUE(558), /* trunc */
   JS_ROM_VALUE(65), /* try */
   JS_ROM_VALUE(28), /* typeof */
   JS_ROM_VALUE(149), /* undefined */
-  JS_ROM_VALUE(447), /* unshift */
-  JS_ROM_VALUE(840), /* unsubscribe */
+  JS_ROM_VALUE(450), /* unshift */
+  JS_ROM_VALUE(977), /* unsubscribe */
   JS_ROM_VALUE(172), /* value */
   JS_ROM_VALUE(140), /* valueOf */
   JS_ROM_VALUE(17), /* var */
   JS_ROM_VALUE(25), /* void */
   JS_ROM_VALUE(41), /* while */
   JS_ROM_VALUE(81), /* with */
+  JS_ROM_VALUE(595), /* write */
   JS_ROM_VALUE(131), /* yield */
 
-  /* properties (offset=1133) */
+  /* properties (offset=1326) */
   JS_VALUE_ARRAY_HEADER(24),
   6 << 1, /* n_props */
   3 << 1, /* hash_mask */
@@ -1166,7 +1359,7 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_OBJECT << 1,
   (6 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1158) */
+  /* properties (offset=1351) */
   JS_VALUE_ARRAY_HEADER(13),
   3 << 1, /* n_props */
   1 << 1, /* hash_mask */
@@ -1181,14 +1374,14 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_OBJECT - 1) << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1172) */
+  /* class (offset=1365) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1133),
+  JS_ROM_VALUE(1326),
   1,
-  JS_ROM_VALUE(1158),
+  JS_ROM_VALUE(1351),
   JS_NULL,
 
-  /* properties (offset=1177) */
+  /* properties (offset=1370) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1196,22 +1389,22 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_CLOSURE << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* getset (offset=1184) */
+  /* getset (offset=1377) */
   JS_VALUE_ARRAY_HEADER(2),
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 10),
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 11),
 
-  /* getset (offset=1187) */
+  /* getset (offset=1380) */
   JS_VALUE_ARRAY_HEADER(2),
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 12),
   JS_UNDEFINED,
 
-  /* getset (offset=1190) */
+  /* getset (offset=1383) */
   JS_VALUE_ARRAY_HEADER(2),
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 13),
   JS_UNDEFINED,
 
-  /* properties (offset=1193) */
+  /* properties (offset=1386) */
   JS_VALUE_ARRAY_HEADER(30),
   8 << 1, /* n_props */
   3 << 1, /* hash_mask */
@@ -1220,7 +1413,7 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   27 << 1,
   12 << 1,
   JS_ROM_VALUE(179) /* prototype */,
-  JS_ROM_VALUE(1184),
+  JS_ROM_VALUE(1377),
   (0 << 1) | (JS_PROP_GETSET << 30),
   JS_ROM_VALUE(267) /* call */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 14),
@@ -1235,62 +1428,62 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 17),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(187) /* length */,
-  JS_ROM_VALUE(1187),
+  JS_ROM_VALUE(1380),
   (9 << 1) | (JS_PROP_GETSET << 30),
   JS_ROM_VALUE(205) /* name */,
-  JS_ROM_VALUE(1190),
+  JS_ROM_VALUE(1383),
   (15 << 1) | (JS_PROP_GETSET << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_CLOSURE - 1) << 1,
   (21 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1224) */
+  /* class (offset=1417) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1177),
+  JS_ROM_VALUE(1370),
   9,
-  JS_ROM_VALUE(1193),
+  JS_ROM_VALUE(1386),
   JS_NULL,
 
-  /* float64 (offset=1229) */
+  /* float64 (offset=1422) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0xffffffff,
   0x7fefffff,
 
-  /* float64 (offset=1232) */
+  /* float64 (offset=1425) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x00000001,
   0x00000000,
 
-  /* float64 (offset=1235) */
+  /* float64 (offset=1428) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x00000000,
   0x7ff80000,
 
-  /* float64 (offset=1238) */
+  /* float64 (offset=1431) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x00000000,
   0xfff00000,
 
-  /* float64 (offset=1241) */
+  /* float64 (offset=1434) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x00000000,
   0x7ff00000,
 
-  /* float64 (offset=1244) */
+  /* float64 (offset=1437) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x00000000,
   0x3cb00000,
 
-  /* float64 (offset=1247) */
+  /* float64 (offset=1440) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0xffffffff,
   0x433fffff,
 
-  /* float64 (offset=1250) */
+  /* float64 (offset=1443) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0xffffffff,
   0xc33fffff,
 
-  /* properties (offset=1253) */
+  /* properties (offset=1446) */
   JS_VALUE_ARRAY_HEADER(43),
   11 << 1, /* n_props */
   7 << 1, /* hash_mask */
@@ -1309,33 +1502,33 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 20),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(295) /* MAX_VALUE */,
-  JS_ROM_VALUE(1229),
+  JS_ROM_VALUE(1422),
   (10 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(299) /* MIN_VALUE */,
-  JS_ROM_VALUE(1232),
+  JS_ROM_VALUE(1425),
   (13 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(195) /* NaN */,
-  JS_ROM_VALUE(1235),
+  JS_ROM_VALUE(1428),
   (19 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(303) /* NEGATIVE_INFINITY */,
-  JS_ROM_VALUE(1238),
+  JS_ROM_VALUE(1431),
   (16 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(309) /* POSITIVE_INFINITY */,
-  JS_ROM_VALUE(1241),
+  JS_ROM_VALUE(1434),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(315) /* EPSILON */,
-  JS_ROM_VALUE(1244),
+  JS_ROM_VALUE(1437),
   (22 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(318) /* MAX_SAFE_INTEGER */,
-  JS_ROM_VALUE(1247),
+  JS_ROM_VALUE(1440),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(324) /* MIN_SAFE_INTEGER */,
-  JS_ROM_VALUE(1250),
+  JS_ROM_VALUE(1443),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_NUMBER << 1,
   (31 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1297) */
+  /* properties (offset=1490) */
   JS_VALUE_ARRAY_HEADER(21),
   5 << 1, /* n_props */
   3 << 1, /* hash_mask */
@@ -1358,14 +1551,14 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_NUMBER - 1) << 1,
   (9 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1319) */
+  /* class (offset=1512) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1253),
+  JS_ROM_VALUE(1446),
   18,
-  JS_ROM_VALUE(1297),
+  JS_ROM_VALUE(1490),
   JS_NULL,
 
-  /* properties (offset=1324) */
+  /* properties (offset=1517) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1373,7 +1566,7 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_BOOLEAN << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1331) */
+  /* properties (offset=1524) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1381,14 +1574,14 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_BOOLEAN - 1) << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1338) */
+  /* class (offset=1531) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1324),
+  JS_ROM_VALUE(1517),
   25,
-  JS_ROM_VALUE(1331),
+  JS_ROM_VALUE(1524),
   JS_NULL,
 
-  /* properties (offset=1343) */
+  /* properties (offset=1536) */
   JS_VALUE_ARRAY_HEADER(13),
   3 << 1, /* n_props */
   1 << 1, /* hash_mask */
@@ -1403,14 +1596,14 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_STRING << 1,
   (7 << 1) | (JS_PROP_SPECIAL << 30),
-  /* getset (offset=1357) */
+  /* getset (offset=1550) */
   JS_VALUE_ARRAY_HEADER(2),
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 29),
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 30),
 
-  /* properties (offset=1360) */
-  JS_VALUE_ARRAY_HEADER(81),
-  21 << 1, /* n_props */
+  /* properties (offset=1553) */
+  JS_VALUE_ARRAY_HEADER(84),
+  22 << 1, /* n_props */
   15 << 1, /* hash_mask */
   69 << 1,
   54 << 1,
@@ -1418,10 +1611,10 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   42 << 1,
   30 << 1,
   72 << 1,
-  78 << 1,
+  81 << 1,
   60 << 1,
   48 << 1,
-  75 << 1,
+  78 << 1,
   18 << 1,
   63 << 1,
   24 << 1,
@@ -1429,7 +1622,7 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   39 << 1,
   66 << 1,
   JS_ROM_VALUE(187) /* length */,
-  JS_ROM_VALUE(1357),
+  JS_ROM_VALUE(1550),
   (0 << 1) | (JS_PROP_GETSET << 30),
   JS_ROM_VALUE(362) /* charAt */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 31),
@@ -1488,306 +1681,318 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(136) /* toString */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 49),
   (33 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(424) /* repeat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 50),
+  (75 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_STRING - 1) << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1442) */
+  /* class (offset=1638) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1343),
+  JS_ROM_VALUE(1536),
   26,
-  JS_ROM_VALUE(1360),
+  JS_ROM_VALUE(1553),
   JS_NULL,
 
-  /* properties (offset=1447) */
+  /* properties (offset=1643) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(427) /* isArray */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 51),
+  JS_ROM_VALUE(430) /* isArray */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 52),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* getset (offset=1457) */
+  /* getset (offset=1653) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 52),
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 53),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 54),
 
-  /* properties (offset=1460) */
+  /* properties (offset=1656) */
   JS_VALUE_ARRAY_HEADER(87),
   23 << 1, /* n_props */
   15 << 1, /* hash_mask */
-  27 << 1,
+  24 << 1,
+  69 << 1,
   78 << 1,
-  75 << 1,
+  54 << 1,
   57 << 1,
-  60 << 1,
-  0 << 1,
+  27 << 1,
   84 << 1,
+  75 << 1,
   36 << 1,
-  39 << 1,
+  60 << 1,
   63 << 1,
-  66 << 1,
+  81 << 1,
   0 << 1,
-  69 << 1,
-  45 << 1,
+  39 << 1,
   51 << 1,
-  24 << 1,
+  66 << 1,
   JS_ROM_VALUE(380) /* concat */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 54),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 55),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(187) /* length */,
-  JS_ROM_VALUE(1457),
+  JS_ROM_VALUE(1653),
   (0 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(430) /* push */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 55),
-  (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(433) /* pop */,
+  JS_ROM_VALUE(433) /* push */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 56),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(435) /* join */,
+  JS_ROM_VALUE(436) /* pop */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 57),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(136) /* toString */,
+  JS_ROM_VALUE(438) /* join */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 58),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(438) /* reverse */,
+  JS_ROM_VALUE(136) /* toString */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 59),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(441) /* shift */,
+  JS_ROM_VALUE(441) /* reverse */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 60),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(373) /* slice */,
+  JS_ROM_VALUE(444) /* shift */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 61),
-  (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(444) /* splice */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 62),
   (18 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(447) /* unshift */,
+  JS_ROM_VALUE(373) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 62),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(447) /* splice */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 63),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(383) /* indexOf */,
+  JS_ROM_VALUE(450) /* unshift */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 64),
-  (48 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(386) /* lastIndexOf */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 65),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(450) /* every */,
+  JS_ROM_VALUE(383) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 65),
+  (45 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(386) /* lastIndexOf */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 66),
-  (54 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(453) /* some */,
+  (48 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(453) /* every */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 67),
   (42 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(456) /* forEach */,
+  JS_ROM_VALUE(456) /* some */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 68),
   (33 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(459) /* map */,
+  JS_ROM_VALUE(459) /* forEach */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 69),
   (21 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(461) /* filter */,
+  JS_ROM_VALUE(462) /* map */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 70),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(464) /* reduce */,
+  JS_ROM_VALUE(464) /* filter */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 71),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(467) /* reduceRight */,
+  JS_ROM_VALUE(467) /* reduce */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 72),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(470) /* reduceRight */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 73),
   (30 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(464) /* reduce */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 71),
+  JS_ROM_VALUE(467) /* reduce */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 72),
   (72 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(471) /* sort */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 73),
+  JS_ROM_VALUE(474) /* sort */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 74),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_ARRAY - 1) << 1,
-  (81 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1548) */
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1744) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1447),
-  50,
-  JS_ROM_VALUE(1460),
+  JS_ROM_VALUE(1643),
+  51,
+  JS_ROM_VALUE(1656),
   JS_NULL,
 
-  /* float64 (offset=1553) */
+  /* float64 (offset=1749) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x8b145769,
   0x4005bf0a,
 
-  /* float64 (offset=1556) */
+  /* float64 (offset=1752) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0xbbb55516,
   0x40026bb1,
 
-  /* float64 (offset=1559) */
+  /* float64 (offset=1755) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0xfefa39ef,
   0x3fe62e42,
 
-  /* float64 (offset=1562) */
+  /* float64 (offset=1758) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x652b82fe,
   0x3ff71547,
 
-  /* float64 (offset=1565) */
+  /* float64 (offset=1761) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x1526e50e,
   0x3fdbcb7b,
 
-  /* float64 (offset=1568) */
+  /* float64 (offset=1764) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x54442d18,
   0x400921fb,
 
-  /* float64 (offset=1571) */
+  /* float64 (offset=1767) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x667f3bcd,
   0x3fe6a09e,
 
-  /* float64 (offset=1574) */
+  /* float64 (offset=1770) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x667f3bcd,
   0x3ff6a09e,
 
-  /* properties (offset=1577) */
-  JS_VALUE_ARRAY_HEADER(117),
-  33 << 1, /* n_props */
+  /* properties (offset=1773) */
+  JS_VALUE_ARRAY_HEADER(126),
+  36 << 1, /* n_props */
   15 << 1, /* hash_mask */
-  114 << 1,
+  111 << 1,
+  93 << 1,
   78 << 1,
-  81 << 1,
+  96 << 1,
   99 << 1,
-  102 << 1,
-  63 << 1,
-  66 << 1,
+  114 << 1,
+  117 << 1,
+  81 << 1,
   84 << 1,
-  87 << 1,
+  102 << 1,
   105 << 1,
-  108 << 1,
-  0 << 1,
-  93 << 1,
+  120 << 1,
+  123 << 1,
+  87 << 1,
   54 << 1,
-  96 << 1,
-  111 << 1,
-  JS_ROM_VALUE(477) /* min */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 74),
-  (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(479) /* max */,
+  108 << 1,
+  JS_ROM_VALUE(480) /* min */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 75),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(481) /* sign */,
+  JS_ROM_VALUE(482) /* max */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 76),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(484) /* abs */,
+  JS_ROM_VALUE(484) /* sign */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 77),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(486) /* floor */,
+  JS_ROM_VALUE(487) /* abs */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 78),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(489) /* ceil */,
+  JS_ROM_VALUE(489) /* floor */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 79),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(492) /* round */,
+  JS_ROM_VALUE(492) /* ceil */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 80),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(495) /* sqrt */,
+  JS_ROM_VALUE(495) /* round */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 81),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(498) /* sqrt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 82),
   (21 << 1) | (JS_PROP_NORMAL << 30),
   JS_VALUE_MAKE_SPECIAL(JS_TAG_STRING_CHAR, 69) /* E */,
-  JS_ROM_VALUE(1553),
-  (36 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(500) /* LN10 */,
-  JS_ROM_VALUE(1556),
+  JS_ROM_VALUE(1749),
+  (33 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(503) /* LN10 */,
+  JS_ROM_VALUE(1752),
   (27 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(503) /* LN2 */,
-  JS_ROM_VALUE(1559),
+  JS_ROM_VALUE(506) /* LN2 */,
+  JS_ROM_VALUE(1755),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(505) /* LOG2E */,
-  JS_ROM_VALUE(1562),
-  (33 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(508) /* LOG10E */,
-  JS_ROM_VALUE(1565),
+  JS_ROM_VALUE(508) /* LOG2E */,
+  JS_ROM_VALUE(1758),
   (42 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(511) /* PI */,
-  JS_ROM_VALUE(1568),
+  JS_ROM_VALUE(511) /* LOG10E */,
+  JS_ROM_VALUE(1761),
+  (36 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(514) /* PI */,
+  JS_ROM_VALUE(1764),
   (39 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(513) /* SQRT1_2 */,
-  JS_ROM_VALUE(1571),
+  JS_ROM_VALUE(516) /* SQRT1_2 */,
+  JS_ROM_VALUE(1767),
   (24 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(516) /* SQRT2 */,
-  JS_ROM_VALUE(1574),
+  JS_ROM_VALUE(519) /* SQRT2 */,
+  JS_ROM_VALUE(1770),
   (45 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(519) /* sin */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 82),
-  (48 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(521) /* cos */,
+  JS_ROM_VALUE(522) /* sin */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 83),
-  (51 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(523) /* tan */,
+  (48 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(524) /* cos */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 84),
-  (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(525) /* asin */,
+  (51 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(526) /* tan */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 85),
-  (18 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(528) /* acos */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 86),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(531) /* atan */,
+  JS_ROM_VALUE(528) /* asin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 86),
+  (18 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(531) /* acos */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 87),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(534) /* atan2 */,
+  JS_ROM_VALUE(534) /* atan */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 88),
-  (30 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(537) /* exp */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(537) /* atan2 */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 89),
-  (69 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(539) /* log */,
+  (30 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(540) /* exp */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 90),
-  (72 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(541) /* pow */,
+  (69 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(542) /* log */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 91),
-  (75 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(543) /* random */,
+  (72 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(544) /* pow */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 92),
-  (57 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(546) /* imul */,
+  (75 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(546) /* random */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 93),
-  (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(549) /* clz32 */,
+  (57 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(549) /* imul */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 94),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(552) /* fround */,
+  JS_ROM_VALUE(552) /* clz32 */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 95),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(555) /* trunc */,
+  JS_ROM_VALUE(555) /* fround */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 96),
-  (90 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(558) /* log2 */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 97),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(561) /* log10 */,
+  JS_ROM_VALUE(558) /* trunc */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 97),
+  (90 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(561) /* log2 */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 98),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(564) /* log10 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 99),
   (60 << 1) | (JS_PROP_NORMAL << 30),
-  /* class (offset=1695) */
+  JS_ROM_VALUE(567) /* idiv */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 100),
+  (63 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(570) /* fxmul */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 101),
+  (66 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(573) /* fxdiv */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 102),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=1900) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1577),
+  JS_ROM_VALUE(1773),
   -1,
   JS_NULL,
   JS_NULL,
 
-  /* properties (offset=1700) */
+  /* properties (offset=1905) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(567) /* now */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 100),
+  JS_ROM_VALUE(579) /* now */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 104),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_DATE << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1710) */
+  /* properties (offset=1915) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1795,32 +2000,62 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_DATE - 1) << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1717) */
+  /* class (offset=1922) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1700),
-  99,
-  JS_ROM_VALUE(1710),
+  JS_ROM_VALUE(1905),
+  103,
+  JS_ROM_VALUE(1915),
   JS_NULL,
 
-  /* properties (offset=1722) */
+  /* properties (offset=1927) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(572) /* parse */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 101),
+  JS_ROM_VALUE(584) /* parse */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 105),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(575) /* stringify */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 102),
+  JS_ROM_VALUE(587) /* stringify */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 106),
   (3 << 1) | (JS_PROP_NORMAL << 30),
-  /* class (offset=1732) */
+  /* class (offset=1937) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1722),
+  JS_ROM_VALUE(1927),
   -1,
   JS_NULL,
   JS_NULL,
 
-  /* properties (offset=1737) */
+  /* properties (offset=1942) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(179) /* prototype */,
+  JS_CLASS_JSON_PARSER << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1949) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  7 << 1,
+  JS_ROM_VALUE(595) /* write */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 108),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(598) /* end */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 109),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(183) /* constructor */,
+  (uint32_t)(-JS_CLASS_JSON_PARSER - 1) << 1,
+  (4 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1963) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1942),
+  107,
+  JS_ROM_VALUE(1949),
+  JS_NULL,
+
+  /* properties (offset=1968) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1828,55 +2063,55 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_REGEXP << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* getset (offset=1744) */
+  /* getset (offset=1975) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 104),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 105),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 111),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 112),
 
-  /* getset (offset=1747) */
+  /* getset (offset=1978) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 106),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 113),
   JS_UNDEFINED,
 
-  /* getset (offset=1750) */
+  /* getset (offset=1981) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 107),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 114),
   JS_UNDEFINED,
 
-  /* properties (offset=1753) */
+  /* properties (offset=1984) */
   JS_VALUE_ARRAY_HEADER(24),
   6 << 1, /* n_props */
   3 << 1, /* hash_mask */
-  18 << 1,
   9 << 1,
+  12 << 1,
   21 << 1,
-  15 << 1,
-  JS_ROM_VALUE(582) /* lastIndex */,
-  JS_ROM_VALUE(1744),
+  18 << 1,
+  JS_ROM_VALUE(603) /* lastIndex */,
+  JS_ROM_VALUE(1975),
   (0 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(596) /* source */,
-  JS_ROM_VALUE(1747),
+  JS_ROM_VALUE(617) /* source */,
+  JS_ROM_VALUE(1978),
   (0 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(603) /* flags */,
-  JS_ROM_VALUE(1750),
+  JS_ROM_VALUE(624) /* flags */,
+  JS_ROM_VALUE(1981),
   (0 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(610) /* exec */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 108),
+  JS_ROM_VALUE(631) /* exec */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 115),
   (6 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(613) /* test */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 109),
+  JS_ROM_VALUE(634) /* test */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 116),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_REGEXP - 1) << 1,
-  (12 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1778) */
+  (15 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2009) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1737),
-  103,
-  JS_ROM_VALUE(1753),
+  JS_ROM_VALUE(1968),
+  110,
+  JS_ROM_VALUE(1984),
   JS_NULL,
 
-  /* properties (offset=1783) */
+  /* properties (offset=2014) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1884,47 +2119,47 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_ERROR << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* getset (offset=1790) */
+  /* getset (offset=2021) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 111),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 118),
   JS_UNDEFINED,
 
-  /* getset (offset=1793) */
+  /* getset (offset=2024) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 112),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 119),
   JS_UNDEFINED,
 
-  /* properties (offset=1796) */
+  /* properties (offset=2027) */
   JS_VALUE_ARRAY_HEADER(21),
   5 << 1, /* n_props */
   3 << 1, /* hash_mask */
-  9 << 1,
   12 << 1,
+  15 << 1,
   18 << 1,
   0 << 1,
   JS_ROM_VALUE(136) /* toString */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 113),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 120),
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(205) /* name */,
   JS_ROM_VALUE(208) /* Error */,
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(616) /* message */,
-  JS_ROM_VALUE(1790),
+  JS_ROM_VALUE(637) /* message */,
+  JS_ROM_VALUE(2021),
+  (9 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(644) /* stack */,
+  JS_ROM_VALUE(2024),
   (6 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(623) /* stack */,
-  JS_ROM_VALUE(1793),
-  (0 << 1) | (JS_PROP_GETSET << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_ERROR - 1) << 1,
-  (15 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1818) */
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2049) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1783),
-  110,
-  JS_ROM_VALUE(1796),
+  JS_ROM_VALUE(2014),
+  117,
+  JS_ROM_VALUE(2027),
   JS_NULL,
 
-  /* properties (offset=1823) */
+  /* properties (offset=2054) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1932,25 +2167,25 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_EVAL_ERROR << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1830) */
+  /* properties (offset=2061) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
   JS_ROM_VALUE(205) /* name */,
-  JS_ROM_VALUE(630) /* EvalError */,
+  JS_ROM_VALUE(651) /* EvalError */,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_EVAL_ERROR - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1840) */
+  /* class (offset=2071) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1823),
-  114,
-  JS_ROM_VALUE(1830),
-  JS_ROM_VALUE(1818),
+  JS_ROM_VALUE(2054),
+  121,
+  JS_ROM_VALUE(2061),
+  JS_ROM_VALUE(2049),
 
-  /* properties (offset=1845) */
+  /* properties (offset=2076) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1958,25 +2193,25 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_RANGE_ERROR << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1852) */
+  /* properties (offset=2083) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
   JS_ROM_VALUE(205) /* name */,
-  JS_ROM_VALUE(634) /* RangeError */,
+  JS_ROM_VALUE(655) /* RangeError */,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_RANGE_ERROR - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1862) */
+  /* class (offset=2093) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1845),
-  115,
-  JS_ROM_VALUE(1852),
-  JS_ROM_VALUE(1818),
+  JS_ROM_VALUE(2076),
+  122,
+  JS_ROM_VALUE(2083),
+  JS_ROM_VALUE(2049),
 
-  /* properties (offset=1867) */
+  /* properties (offset=2098) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -1984,25 +2219,25 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_REFERENCE_ERROR << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1874) */
+  /* properties (offset=2105) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
   JS_ROM_VALUE(205) /* name */,
-  JS_ROM_VALUE(638) /* ReferenceError */,
+  JS_ROM_VALUE(659) /* ReferenceError */,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_REFERENCE_ERROR - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1884) */
+  /* class (offset=2115) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1867),
-  116,
-  JS_ROM_VALUE(1874),
-  JS_ROM_VALUE(1818),
+  JS_ROM_VALUE(2098),
+  123,
+  JS_ROM_VALUE(2105),
+  JS_ROM_VALUE(2049),
 
-  /* properties (offset=1889) */
+  /* properties (offset=2120) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -2010,25 +2245,25 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_SYNTAX_ERROR << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1896) */
+  /* properties (offset=2127) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
   JS_ROM_VALUE(205) /* name */,
-  JS_ROM_VALUE(643) /* SyntaxError */,
+  JS_ROM_VALUE(664) /* SyntaxError */,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_SYNTAX_ERROR - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1906) */
+  /* class (offset=2137) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1889),
-  117,
-  JS_ROM_VALUE(1896),
-  JS_ROM_VALUE(1818),
+  JS_ROM_VALUE(2120),
+  124,
+  JS_ROM_VALUE(2127),
+  JS_ROM_VALUE(2049),
 
-  /* properties (offset=1911) */
+  /* properties (offset=2142) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -2036,25 +2271,25 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_TYPE_ERROR << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1918) */
+  /* properties (offset=2149) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
   JS_ROM_VALUE(205) /* name */,
-  JS_ROM_VALUE(647) /* TypeError */,
+  JS_ROM_VALUE(668) /* TypeError */,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_TYPE_ERROR - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1928) */
+  /* class (offset=2159) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1911),
-  118,
-  JS_ROM_VALUE(1918),
-  JS_ROM_VALUE(1818),
+  JS_ROM_VALUE(2142),
+  125,
+  JS_ROM_VALUE(2149),
+  JS_ROM_VALUE(2049),
 
-  /* properties (offset=1933) */
+  /* properties (offset=2164) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -2062,25 +2297,25 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_URI_ERROR << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1940) */
+  /* properties (offset=2171) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
   JS_ROM_VALUE(205) /* name */,
-  JS_ROM_VALUE(651) /* URIError */,
+  JS_ROM_VALUE(672) /* URIError */,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_URI_ERROR - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1950) */
+  /* class (offset=2181) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1933),
-  119,
-  JS_ROM_VALUE(1940),
-  JS_ROM_VALUE(1818),
+  JS_ROM_VALUE(2164),
+  126,
+  JS_ROM_VALUE(2171),
+  JS_ROM_VALUE(2049),
 
-  /* properties (offset=1955) */
+  /* properties (offset=2186) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -2088,25 +2323,25 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_INTERNAL_ERROR << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=1962) */
+  /* properties (offset=2193) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
   JS_ROM_VALUE(205) /* name */,
-  JS_ROM_VALUE(655) /* InternalError */,
+  JS_ROM_VALUE(676) /* InternalError */,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_INTERNAL_ERROR - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1972) */
+  /* class (offset=2203) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1955),
-  120,
-  JS_ROM_VALUE(1962),
-  JS_ROM_VALUE(1818),
+  JS_ROM_VALUE(2186),
+  127,
+  JS_ROM_VALUE(2193),
+  JS_ROM_VALUE(2049),
 
-  /* properties (offset=1977) */
+  /* properties (offset=2208) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -2114,30 +2349,30 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_ARRAY_BUFFER << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* getset (offset=1984) */
+  /* getset (offset=2215) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 122),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 129),
   JS_UNDEFINED,
 
-  /* properties (offset=1987) */
+  /* properties (offset=2218) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(664) /* byteLength */,
-  JS_ROM_VALUE(1984),
+  JS_ROM_VALUE(685) /* byteLength */,
+  JS_ROM_VALUE(2215),
   (0 << 1) | (JS_PROP_GETSET << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_ARRAY_BUFFER - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=1997) */
+  /* class (offset=2228) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(1977),
-  121,
-  JS_ROM_VALUE(1987),
+  JS_ROM_VALUE(2208),
+  128,
+  JS_ROM_VALUE(2218),
   JS_NULL,
 
-  /* properties (offset=2002) */
+  /* properties (offset=2233) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
@@ -2145,603 +2380,846 @@ static const uint32_t __attribute((aligned(64))) js_stdlib_table[] = {
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_TYPED_ARRAY << 1,
   (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* getset (offset=2009) */
+  /* getset (offset=2240) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 124),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 131),
   JS_UNDEFINED,
 
-  /* getset (offset=2012) */
+  /* getset (offset=2243) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 125),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 132),
   JS_UNDEFINED,
 
-  /* getset (offset=2015) */
+  /* getset (offset=2246) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 126),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 133),
   JS_UNDEFINED,
 
-  /* getset (offset=2018) */
+  /* getset (offset=2249) */
   JS_VALUE_ARRAY_HEADER(2),
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 127),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 134),
   JS_UNDEFINED,
 
-  /* properties (offset=2021) */
-  JS_VALUE_ARRAY_HEADER(37),
-  9 << 1, /* n_props */
-  7 << 1, /* hash_mask */
-  31 << 1,
-  25 << 1,
-  28 << 1,
+  /* properties (offset=2252) */
+  JS_VALUE_ARRAY_HEADER(72),
+  18 << 1, /* n_props */
+  15 << 1, /* hash_mask */
+  39 << 1,
+  60 << 1,
   0 << 1,
+  63 << 1,
+  54 << 1,
+  42 << 1,
+  69 << 1,
+  30 << 1,
+  27 << 1,
+  33 << 1,
+  57 << 1,
   0 << 1,
-  19 << 1,
-  34 << 1,
+  66 << 1,
+  0 << 1,
+  48 << 1,
   0 << 1,
   JS_ROM_VALUE(187) /* length */,
-  JS_ROM_VALUE(2009),
+  JS_ROM_VALUE(2240),
   (0 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(664) /* byteLength */,
-  JS_ROM_VALUE(2012),
+  JS_ROM_VALUE(685) /* byteLength */,
+  JS_ROM_VALUE(2243),
   (0 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(683) /* byteOffset */,
-  JS_ROM_VALUE(2015),
-  (10 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(692) /* buffer */,
-  JS_ROM_VALUE(2018),
+  JS_ROM_VALUE(704) /* byteOffset */,
+  JS_ROM_VALUE(2246),
   (0 << 1) | (JS_PROP_GETSET << 30),
-  JS_ROM_VALUE(435) /* join */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 57),
-  (16 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(136) /* toString */,
+  JS_ROM_VALUE(713) /* buffer */,
+  JS_ROM_VALUE(2249),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(438) /* join */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 58),
-  (13 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(699) /* subarray */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 128),
-  (22 << 1) | (JS_PROP_NORMAL << 30),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(136) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 59),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(720) /* subarray */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 135),
+  (24 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(177) /* set */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 129),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 136),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(724) /* fill */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 137),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(727) /* copyWithin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 138),
   (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(383) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 139),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(386) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 140),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(373) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 141),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(731) /* sum */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 142),
+  (18 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(480) /* min */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 143),
+  (36 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(482) /* max */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 144),
+  (51 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(733) /* dot */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 145),
+  (21 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_TYPED_ARRAY - 1) << 1,
-  (0 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2059) */
+  (45 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2325) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2002),
-  123,
-  JS_ROM_VALUE(2021),
+  JS_ROM_VALUE(2233),
+  130,
+  JS_ROM_VALUE(2252),
   JS_NULL,
 
-  /* properties (offset=2064) */
+  /* properties (offset=2330) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   1 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_UINT8C_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2074) */
+  /* properties (offset=2340) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   1 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_UINT8C_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2084) */
+  /* class (offset=2350) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2064),
-  130,
-  JS_ROM_VALUE(2074),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2330),
+  146,
+  JS_ROM_VALUE(2340),
+  JS_ROM_VALUE(2325),
 
-  /* properties (offset=2089) */
+  /* properties (offset=2355) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   1 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_INT8_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2099) */
+  /* properties (offset=2365) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   1 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_INT8_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2109) */
+  /* class (offset=2375) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2089),
-  131,
-  JS_ROM_VALUE(2099),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2355),
+  147,
+  JS_ROM_VALUE(2365),
+  JS_ROM_VALUE(2325),
 
-  /* properties (offset=2114) */
+  /* properties (offset=2380) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   1 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_UINT8_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2124) */
+  /* properties (offset=2390) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   1 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_UINT8_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2134) */
+  /* class (offset=2400) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2114),
-  132,
-  JS_ROM_VALUE(2124),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2380),
+  148,
+  JS_ROM_VALUE(2390),
+  JS_ROM_VALUE(2325),
 
-  /* properties (offset=2139) */
+  /* properties (offset=2405) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   2 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_INT16_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2149) */
+  /* properties (offset=2415) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   2 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_INT16_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2159) */
+  /* class (offset=2425) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2139),
-  133,
-  JS_ROM_VALUE(2149),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2405),
+  149,
+  JS_ROM_VALUE(2415),
+  JS_ROM_VALUE(2325),
 
-  /* properties (offset=2164) */
+  /* properties (offset=2430) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   2 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_UINT16_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2174) */
+  /* properties (offset=2440) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   2 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_UINT16_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2184) */
+  /* class (offset=2450) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2164),
-  134,
-  JS_ROM_VALUE(2174),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2430),
+  150,
+  JS_ROM_VALUE(2440),
+  JS_ROM_VALUE(2325),
 
-  /* properties (offset=2189) */
+  /* properties (offset=2455) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   4 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_INT32_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2199) */
+  /* properties (offset=2465) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   4 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_INT32_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2209) */
+  /* class (offset=2475) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2189),
-  135,
-  JS_ROM_VALUE(2199),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2455),
+  151,
+  JS_ROM_VALUE(2465),
+  JS_ROM_VALUE(2325),
 
-  /* properties (offset=2214) */
+  /* properties (offset=2480) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   4 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_UINT32_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2224) */
+  /* properties (offset=2490) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   4 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_UINT32_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2234) */
+  /* class (offset=2500) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2214),
-  136,
-  JS_ROM_VALUE(2224),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2480),
+  152,
+  JS_ROM_VALUE(2490),
+  JS_ROM_VALUE(2325),
 
-  /* properties (offset=2239) */
+  /* properties (offset=2505) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   4 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_FLOAT32_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2249) */
+  /* properties (offset=2515) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   4 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_FLOAT32_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2259) */
+  /* class (offset=2525) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2239),
-  137,
-  JS_ROM_VALUE(2249),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2505),
+  153,
+  JS_ROM_VALUE(2515),
+  JS_ROM_VALUE(2325),
 
-  /* properties (offset=2264) */
+  /* properties (offset=2530) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   8 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(179) /* prototype */,
   JS_CLASS_FLOAT64_ARRAY << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* properties (offset=2274) */
+  /* properties (offset=2540) */
   JS_VALUE_ARRAY_HEADER(9),
   2 << 1, /* n_props */
   0 << 1, /* hash_mask */
   6 << 1,
-  JS_ROM_VALUE(703) /* BYTES_PER_ELEMENT */,
+  JS_ROM_VALUE(735) /* BYTES_PER_ELEMENT */,
   8 << 1,
   (0 << 1) | (JS_PROP_NORMAL << 30),
   JS_ROM_VALUE(183) /* constructor */,
   (uint32_t)(-JS_CLASS_FLOAT64_ARRAY - 1) << 1,
   (3 << 1) | (JS_PROP_SPECIAL << 30),
-  /* class (offset=2284) */
+  /* class (offset=2550) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2530),
+  154,
+  JS_ROM_VALUE(2540),
+  JS_ROM_VALUE(2325),
+
+  /* properties (offset=2555) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(179) /* prototype */,
+  JS_CLASS_DATA_VIEW << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=2562) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 156),
+  JS_UNDEFINED,
+
+  /* getset (offset=2565) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 157),
+  JS_UNDEFINED,
+
+  /* getset (offset=2568) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 158),
+  JS_UNDEFINED,
+
+  /* properties (offset=2571) */
+  JS_VALUE_ARRAY_HEADER(78),
+  20 << 1, /* n_props */
+  15 << 1, /* hash_mask */
+  69 << 1,
+  21 << 1,
+  0 << 1,
+  0 << 1,
+  72 << 1,
+  0 << 1,
+  75 << 1,
+  0 << 1,
+  63 << 1,
+  0 << 1,
+  27 << 1,
+  0 << 1,
+  66 << 1,
+  0 << 1,
+  0 << 1,
+  30 << 1,
+  JS_ROM_VALUE(685) /* byteLength */,
+  JS_ROM_VALUE(2562),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(704) /* byteOffset */,
+  JS_ROM_VALUE(2565),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(713) /* buffer */,
+  JS_ROM_VALUE(2568),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(779) /* getInt8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 159),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(782) /* setInt8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 160),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(785) /* getUint8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 161),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(789) /* setUint8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 162),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(793) /* getInt16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 163),
+  (24 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(797) /* setInt16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 164),
+  (18 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(801) /* getUint16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 165),
+  (33 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(805) /* setUint16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 166),
+  (36 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(809) /* getInt32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 167),
+  (39 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(813) /* setInt32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 168),
+  (42 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(817) /* getUint32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 169),
+  (45 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(821) /* setUint32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 170),
+  (48 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(825) /* getFloat32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 171),
+  (51 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(829) /* setFloat32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 172),
+  (54 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(833) /* getFloat64 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 173),
+  (57 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(837) /* setFloat64 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 174),
+  (60 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(183) /* constructor */,
+  (uint32_t)(-JS_CLASS_DATA_VIEW - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2650) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2264),
-  138,
-  JS_ROM_VALUE(2274),
-  JS_ROM_VALUE(2059),
+  JS_ROM_VALUE(2555),
+  155,
+  JS_ROM_VALUE(2571),
+  JS_NULL,
 
-  /* float64 (offset=2289) */
+  /* float64 (offset=2655) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x00000000,
   0x7ff00000,
 
-  /* float64 (offset=2292) */
+  /* float64 (offset=2658) */
   JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
   0x00000000,
   0x7ff80000,
 
-  /* properties (offset=2295) */
+  /* properties (offset=2661) */
   JS_VALUE_ARRAY_HEADER(6),
   1 << 1, /* n_props */
   0 << 1, /* hash_mask */
   3 << 1,
-  JS_ROM_VALUE(539) /* log */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 139),
+  JS_ROM_VALUE(542) /* log */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 175),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  /* class (offset=2302) */
+  /* class (offset=2668) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2295),
+  JS_ROM_VALUE(2661),
   -1,
   JS_NULL,
   JS_NULL,
 
-  /* properties (offset=2307) */
-  JS_VALUE_ARRAY_HEADER(6),
-  1 << 1, /* n_props */
-  0 << 1, /* hash_mask */
-  3 << 1,
-  JS_ROM_VALUE(567) /* now */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 140),
+  /* properties (offset=2673) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  0 << 1,
+  0 << 1,
+  9 << 1,
+  18 << 1,
+  JS_ROM_VALUE(579) /* now */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 176),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  /* class (offset=2314) */
+  JS_ROM_VALUE(859) /* memory */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 177),
+  (6 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(862) /* resetMemory */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 178),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(866) /* heapProfile */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 179),
+  (12 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(870) /* heapReport */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 180),
+  (15 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2695) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2307),
+  JS_ROM_VALUE(2673),
   -1,
   JS_NULL,
   JS_NULL,
 
-  /* properties (offset=2319) */
-  JS_VALUE_ARRAY_HEADER(16),
-  4 << 1, /* n_props */
-  1 << 1, /* hash_mask */
-  4 << 1,
-  13 << 1,
-  JS_ROM_VALUE(763) /* count */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 141),
+  /* properties (offset=2700) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  12 << 1,
+  6 << 1,
+  18 << 1,
+  0 << 1,
+  JS_ROM_VALUE(876) /* count */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 181),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(766) /* on */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 142),
+  JS_ROM_VALUE(879) /* on */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 182),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(768) /* off */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 143),
-  (7 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(770) /* setColor */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 144),
-  (10 << 1) | (JS_PROP_NORMAL << 30),
-  /* class (offset=2336) */
+  JS_ROM_VALUE(881) /* off */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 183),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(883) /* setColor */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 184),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(887) /* show */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 185),
+  (15 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2722) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2319),
+  JS_ROM_VALUE(2700),
   -1,
   JS_NULL,
   JS_NULL,
 
-  /* properties (offset=2341) */
+  /* properties (offset=2727) */
   JS_VALUE_ARRAY_HEADER(24),
   6 << 1, /* n_props */
   3 << 1, /* hash_mask */
   15 << 1,
   21 << 1,
-  6 << 1,
   0 << 1,
-  JS_ROM_VALUE(763) /* count */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 145),
+  0 << 1,
+  JS_ROM_VALUE(876) /* count */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 186),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(777) /* setLabel */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 146),
+  JS_ROM_VALUE(893) /* setLabel */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 187),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(781) /* setTopLabel */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 147),
+  JS_ROM_VALUE(897) /* setTopLabel */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 188),
   (9 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(785) /* onClick */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 148),
+  JS_ROM_VALUE(901) /* onClick */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 189),
   (12 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(788) /* onLongPress */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 149),
-  (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(792) /* onRelease */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 150),
+  JS_ROM_VALUE(904) /* onLongPress */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 190),
+  (6 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(908) /* onRelease */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 191),
   (18 << 1) | (JS_PROP_NORMAL << 30),
-  /* class (offset=2366) */
+  /* class (offset=2752) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2341),
+  JS_ROM_VALUE(2727),
   -1,
   JS_NULL,
   JS_NULL,
 
-  /* properties (offset=2371) */
-  JS_VALUE_ARRAY_HEADER(24),
-  6 << 1, /* n_props */
-  3 << 1, /* hash_mask */
-  18 << 1,
-  21 << 1,
-  12 << 1,
-  15 << 1,
-  JS_ROM_VALUE(763) /* count */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 151),
+  /* properties (offset=2757) */
+  JS_VALUE_ARRAY_HEADER(40),
+  10 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  0 << 1,
+  37 << 1,
+  13 << 1,
+  19 << 1,
+  34 << 1,
+  28 << 1,
+  16 << 1,
+  0 << 1,
+  JS_ROM_VALUE(876) /* count */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 192),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(799) /* getValue */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 152),
-  (6 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(803) /* getType */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 153),
-  (9 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(806) /* getInfo */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 154),
+  JS_ROM_VALUE(915) /* getValue */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 193),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(809) /* getAll */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 155),
+  JS_ROM_VALUE(919) /* getType */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 194),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(812) /* onChange */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 156),
+  JS_ROM_VALUE(922) /* getInfo */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 195),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(925) /* getAll */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 196),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  /* class (offset=2396) */
+  JS_ROM_VALUE(928) /* onChange */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 197),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(932) /* readInto */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 198),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(936) /* startSampling */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 199),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(941) /* drain */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 200),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(944) /* stopSampling */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 201),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2798) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2371),
+  JS_ROM_VALUE(2757),
   -1,
   JS_NULL,
   JS_NULL,
 
-  /* properties (offset=2401) */
-  JS_VALUE_ARRAY_HEADER(30),
-  8 << 1, /* n_props */
-  3 << 1, /* hash_mask */
-  15 << 1,
-  27 << 1,
-  6 << 1,
+  /* properties (offset=2803) */
+  JS_VALUE_ARRAY_HEADER(37),
+  9 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  34 << 1,
+  10 << 1,
   0 << 1,
-  JS_ROM_VALUE(819) /* getBrokerCount */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 157),
+  16 << 1,
+  31 << 1,
+  0 << 1,
+  0 << 1,
+  19 << 1,
+  JS_ROM_VALUE(952) /* getBrokerCount */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 202),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(824) /* getBrokerName */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 158),
+  JS_ROM_VALUE(957) /* getBrokerName */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 203),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(829) /* isConnected */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 159),
+  JS_ROM_VALUE(962) /* isConnected */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 204),
   (0 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(833) /* publish */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 160),
-  (12 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(836) /* subscribe */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 161),
-  (9 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(840) /* unsubscribe */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 162),
-  (18 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(844) /* onConnect */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 163),
-  (21 << 1) | (JS_PROP_NORMAL << 30),
-  JS_ROM_VALUE(848) /* onDisconnect */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 164),
-  (24 << 1) | (JS_PROP_NORMAL << 30),
-  /* class (offset=2432) */
+  JS_ROM_VALUE(966) /* publish */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 205),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(969) /* publishJSON */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 206),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(973) /* subscribe */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 207),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(977) /* unsubscribe */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 208),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(981) /* onConnect */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 209),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(985) /* onDisconnect */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 210),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2841) */
   JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
-  JS_ROM_VALUE(2401),
+  JS_ROM_VALUE(2803),
   -1,
   JS_NULL,
   JS_NULL,
 
-  /* global object properties (offset=2437) */
-  JS_VALUE_ARRAY_HEADER(98),
+  /* global object properties (offset=2846) */
+  JS_VALUE_ARRAY_HEADER(108),
   JS_ROM_VALUE(224) /* Object */,
-  JS_ROM_VALUE(1172),
+  JS_ROM_VALUE(1365),
   JS_ROM_VALUE(253) /* Function */,
-  JS_ROM_VALUE(1224),
+  JS_ROM_VALUE(1417),
   JS_ROM_VALUE(284) /* Number */,
-  JS_ROM_VALUE(1319),
+  JS_ROM_VALUE(1512),
   JS_ROM_VALUE(342) /* Boolean */,
-  JS_ROM_VALUE(1338),
+  JS_ROM_VALUE(1531),
   JS_ROM_VALUE(345) /* String */,
-  JS_ROM_VALUE(1442),
-  JS_ROM_VALUE(424) /* Array */,
-  JS_ROM_VALUE(1548),
-  JS_ROM_VALUE(474) /* Math */,
-  JS_ROM_VALUE(1695),
-  JS_ROM_VALUE(564) /* Date */,
-  JS_ROM_VALUE(1717),
-  JS_ROM_VALUE(569) /* JSON */,
-  JS_ROM_VALUE(1732),
-  JS_ROM_VALUE(579) /* RegExp */,
-  JS_ROM_VALUE(1778),
+  JS_ROM_VALUE(1638),
+  JS_ROM_VALUE(427) /* Array */,
+  JS_ROM_VALUE(1744),
+  JS_ROM_VALUE(477) /* Math */,
+  JS_ROM_VALUE(1900),
+  JS_ROM_VALUE(576) /* Date */,
+  JS_ROM_VALUE(1922),
+  JS_ROM_VALUE(581) /* JSON */,
+  JS_ROM_VALUE(1937),
+  JS_ROM_VALUE(591) /* JSONParser */,
+  JS_ROM_VALUE(1963),
+  JS_ROM_VALUE(600) /* RegExp */,
+  JS_ROM_VALUE(2009),
   JS_ROM_VALUE(208) /* Error */,
-  JS_ROM_VALUE(1818),
-  JS_ROM_VALUE(630) /* EvalError */,
-  JS_ROM_VALUE(1840),
-  JS_ROM_VALUE(634) /* RangeError */,
-  JS_ROM_VALUE(1862),
-  JS_ROM_VALUE(638) /* ReferenceError */,
-  JS_ROM_VALUE(1884),
-  JS_ROM_VALUE(643) /* SyntaxError */,
-  JS_ROM_VALUE(1906),
-  JS_ROM_VALUE(647) /* TypeError */,
-  JS_ROM_VALUE(1928),
-  JS_ROM_VALUE(651) /* URIError */,
-  JS_ROM_VALUE(1950),
-  JS_ROM_VALUE(655) /* InternalError */,
-  JS_ROM_VALUE(1972),
-  JS_ROM_VALUE(660) /* ArrayBuffer */,
-  JS_ROM_VALUE(1997),
-  JS_ROM_VALUE(673) /* Uint8ClampedArray */,
-  JS_ROM_VALUE(2084),
-  JS_ROM_VALUE(709) /* Int8Array */,
-  JS_ROM_VALUE(2109),
-  JS_ROM_VALUE(713) /* Uint8Array */,
-  JS_ROM_VALUE(2134),
-  JS_ROM_VALUE(717) /* Int16Array */,
+  JS_ROM_VALUE(2049),
+  JS_ROM_VALUE(651) /* EvalError */,
+  JS_ROM_VALUE(2071),
+  JS_ROM_VALUE(655) /* RangeError */,
+  JS_ROM_VALUE(2093),
+  JS_ROM_VALUE(659) /* ReferenceError */,
+  JS_ROM_VALUE(2115),
+  JS_ROM_VALUE(664) /* SyntaxError */,
+  JS_ROM_VALUE(2137),
+  JS_ROM_VALUE(668) /* TypeError */,
   JS_ROM_VALUE(2159),
-  JS_ROM_VALUE(721) /* Uint16Array */,
-  JS_ROM_VALUE(2184),
-  JS_ROM_VALUE(725) /* Int32Array */,
-  JS_ROM_VALUE(2209),
-  JS_ROM_VALUE(729) /* Uint32Array */,
-  JS_ROM_VALUE(2234),
-  JS_ROM_VALUE(733) /* Float32Array */,
-  JS_ROM_VALUE(2259),
-  JS_ROM_VALUE(738) /* Float64Array */,
-  JS_ROM_VALUE(2284),
+  JS_ROM_VALUE(672) /* URIError */,
+  JS_ROM_VALUE(2181),
+  JS_ROM_VALUE(676) /* InternalError */,
+  JS_ROM_VALUE(2203),
+  JS_ROM_VALUE(681) /* ArrayBuffer */,
+  JS_ROM_VALUE(2228),
+  JS_ROM_VALUE(694) /* Uint8ClampedArray */,
+  JS_ROM_VALUE(2350),
+  JS_ROM_VALUE(741) /* Int8Array */,
+  JS_ROM_VALUE(2375),
+  JS_ROM_VALUE(745) /* Uint8Array */,
+  JS_ROM_VALUE(2400),
+  JS_ROM_VALUE(749) /* Int16Array */,
+  JS_ROM_VALUE(2425),
+  JS_ROM_VALUE(753) /* Uint16Array */,
+  JS_ROM_VALUE(2450),
+  JS_ROM_VALUE(757) /* Int32Array */,
+  JS_ROM_VALUE(2475),
+  JS_ROM_VALUE(761) /* Uint32Array */,
+  JS_ROM_VALUE(2500),
+  JS_ROM_VALUE(765) /* Float32Array */,
+  JS_ROM_VALUE(2525),
+  JS_ROM_VALUE(770) /* Float64Array */,
+  JS_ROM_VALUE(2550),
+  JS_ROM_VALUE(775) /* DataView */,
+  JS_ROM_VALUE(2650),
   JS_ROM_VALUE(287) /* parseInt */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 19),
   JS_ROM_VALUE(291) /* parseFloat */,
   JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 20),
   JS_ROM_VALUE(165) /* eval */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 165),
-  JS_ROM_VALUE(743) /* isNaN */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 166),
-  JS_ROM_VALUE(746) /* isFinite */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 167),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 211),
+  JS_ROM_VALUE(841) /* isNaN */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 212),
+  JS_ROM_VALUE(844) /* isFinite */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 213),
   JS_ROM_VALUE(197) /* Infinity */,
-  JS_ROM_VALUE(2289),
+  JS_ROM_VALUE(2655),
   JS_ROM_VALUE(195) /* NaN */,
-  JS_ROM_VALUE(2292),
+  JS_ROM_VALUE(2658),
   JS_ROM_VALUE(149) /* undefined */,
   JS_UNDEFINED,
-  JS_ROM_VALUE(750) /* globalThis */,
+  JS_ROM_VALUE(848) /* globalThis */,
   JS_NULL,
-  JS_ROM_VALUE(754) /* console */,
-  JS_ROM_VALUE(2302),
-  JS_ROM_VALUE(757) /* performance */,
-  JS_ROM_VALUE(2314),
-  JS_ROM_VALUE(761) /* led */,
-  JS_ROM_VALUE(2336),
-  JS_ROM_VALUE(774) /* button */,
-  JS_ROM_VALUE(2366),
-  JS_ROM_VALUE(796) /* sensor */,
-  JS_ROM_VALUE(2396),
-  JS_ROM_VALUE(816) /* mqtt */,
-  JS_ROM_VALUE(2432),
-  JS_ROM_VALUE(853) /* print */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 168),
-  JS_ROM_VALUE(856) /* gc */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 169),
-  JS_ROM_VALUE(858) /* load */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 170),
-  JS_ROM_VALUE(861) /* loadMapped */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 171),
-  JS_ROM_VALUE(865) /* setTimeout */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 172),
-  JS_ROM_VALUE(869) /* clearTimeout */,
-  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 173),
+  JS_ROM_VALUE(852) /* console */,
+  JS_ROM_VALUE(2668),
+  JS_ROM_VALUE(855) /* performance */,
+  JS_ROM_VALUE(2695),
+  JS_ROM_VALUE(874) /* led */,
+  JS_ROM_VALUE(2722),
+  JS_ROM_VALUE(890) /* button */,
+  JS_ROM_VALUE(2752),
+  JS_ROM_VALUE(912) /* sensor */,
+  JS_ROM_VALUE(2798),
+  JS_ROM_VALUE(949) /* mqtt */,
+  JS_ROM_VALUE(2841),
+  JS_ROM_VALUE(990) /* print */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 214),
+  JS_ROM_VALUE(993) /* gc */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 215),
+  JS_ROM_VALUE(995) /* load */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 216),
+  JS_ROM_VALUE(998) /* loadMapped */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 217),
+  JS_ROM_VALUE(1002) /* loadUserBytecode */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 218),
+  JS_ROM_VALUE(1008) /* setTimeout */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 219),
+  JS_ROM_VALUE(1012) /* clearTimeout */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 220),
+  JS_ROM_VALUE(1017) /* setInterval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 221),
+  JS_ROM_VALUE(1021) /* clearInterval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 222),
+};
+
+static const uint16_t js_atom_hash_table[] = {
+  /* bucket displacements */
+  0, 1, 2, 6, 0, 0, 1, 0, 0, 0, 2, 0, 3, 0, 0, 4,
+  2, 0, 0, 0, 0, 4, 1, 0, 1, 0, 0, 0, 0, 1, 0, 2,
+  0, 0, 0, 0, 0, 2, 0, 2, 1, 3, 1, 1, 0, 0, 0, 1,
+  3, 0, 2, 3, 1, 0, 4, 0, 1, 0, 4, 0, 3, 0, 3, 0,
+  1, 2, 0, 1, 0, 5, 0, 6, 0, 0, 0, 1, 1, 0, 0, 7,
+  1, 0, 0, 4, 7, 0, 0, 0, 10, 0, 1, 4, 4, 1, 2, 7,
+  1, 0, 5, 0, 2, 5, 1, 12, 0, 19, 1, 0, 2, 0, 0, 1,
+  0, 0, 0, 20, 5, 0, 0, 3, 12, 6, 0, 0, 1, 8, 0, 2,
+  /* sorted atom table index of each slot */
+  65535, 206, 65535, 65535, 59, 65535, 261, 45, 65535, 65535, 214, 65535, 124, 252, 65535, 79,
+  117, 65535, 50, 65535, 6, 164, 229, 65535, 168, 65535, 65535, 111, 224, 72, 65535, 61,
+  65535, 266, 65535, 65535, 89, 202, 65535, 258, 29, 27, 65535, 65535, 73, 65535, 169, 295,
+  10, 85, 2, 270, 178, 65535, 30, 65535, 65535, 198, 77, 65535, 140, 65535, 99, 134,
+  65535, 65535, 37, 65535, 65535, 65535, 65535, 194, 65535, 249, 173, 65535, 155, 260, 65535, 64,
+  65535, 65535, 65535, 54, 236, 219, 143, 147, 242, 271, 65535, 65535, 65535, 9, 65535, 0,
+  170, 145, 65535, 152, 65535, 65535, 65535, 125, 65535, 55, 65535, 44, 65535, 65535, 189, 218,
+  287, 25, 57, 278, 58, 265, 31, 65535, 93, 65535, 38, 65535, 65535, 65535, 26, 65535,
+  16, 65535, 65535, 281, 65535, 4, 65535, 136, 65535, 65535, 65535, 297, 65535, 175, 65535, 65535,
+  65535, 70, 259, 226, 65535, 105, 268, 65535, 100, 204, 181, 65535, 186, 65535, 199, 88,
+  208, 112, 65535, 289, 65535, 102, 65535, 65535, 154, 215, 19, 172, 65535, 225, 13, 209,
+  65535, 106, 65535, 200, 150, 104, 160, 65535, 71, 65535, 166, 191, 132, 90, 14, 179,
+  113, 255, 65535, 250, 65535, 87, 116, 133, 217, 39, 274, 187, 65535, 48, 211, 65535,
+  18, 65535, 223, 285, 122, 65535, 65535, 222, 65535, 65535, 65535, 65535, 65535, 65535, 231, 65,
+  128, 221, 80, 65535, 22, 75, 65535, 109, 65535, 65535, 65535, 165, 212, 275, 65535, 115,
+  65535, 65535, 114, 32, 227, 195, 83, 241, 65535, 65535, 65535, 65535, 279, 65535, 139, 286,
+  5, 65535, 185, 65535, 248, 65535, 141, 65535, 96, 65535, 232, 65535, 65535, 65535, 65535, 65535,
+  52, 65535, 263, 251, 65535, 269, 65535, 65535, 34, 190, 65535, 158, 94, 288, 65535, 65535,
+  24, 65535, 65535, 65535, 161, 177, 21, 65535, 65535, 247, 65535, 65535, 65535, 65535, 65535, 126,
+  192, 65535, 235, 63, 47, 123, 203, 65535, 40, 46, 33, 65535, 49, 142, 239, 65535,
+  149, 65535, 65535, 65535, 129, 65535, 65535, 216, 283, 65535, 65535, 156, 193, 65535, 65535, 234,
+  171, 65535, 65535, 65535, 157, 53, 98, 184, 51, 245, 176, 292, 240, 238, 230, 210,
+  78, 131, 65535, 65535, 220, 207, 62, 65535, 65535, 65535, 65535, 65535, 119, 65535, 253, 41,
+  103, 17, 65535, 42, 65535, 65535, 65535, 65535, 246, 81, 254, 120, 76, 201, 65535, 65535,
+  264, 15, 280, 56, 65535, 262, 65535, 237, 167, 65535, 127, 82, 107, 20, 205, 65535,
+  273, 213, 182, 12, 28, 163, 146, 108, 272, 8, 3, 277, 65535, 183, 228, 65535,
+  35, 65535, 65535, 1, 196, 244, 65535, 97, 65535, 68, 65535, 101, 180, 65535, 243, 290,
+  138, 95, 162, 256, 36, 65535, 65535, 144, 65535, 135, 65535, 65535, 293, 65535, 65535, 65535,
+  65535, 65535, 65535, 282, 291, 11, 65535, 197, 233, 74, 267, 65535, 84, 148, 92, 7,
+  65535, 159, 294, 66, 296, 65535, 23, 151, 65535, 130, 65535, 65535, 110, 137, 65535, 65535,
+  121, 65535, 65535, 65535, 65535, 276, 65535, 257, 298, 86, 65535, 65535, 65535, 65535, 188, 65535,
+  65535, 153, 67, 284, 65535, 174, 65535, 118, 65535, 91, 65535, 65535, 69, 43, 60, 65535,
 };
 
 static const JSCFunctionDef js_c_function_table[] = {
@@ -2895,11 +3373,14 @@ static const JSCFunctionDef js_c_function_table[] = {
   { { .generic = js_string_toString },
     JS_ROM_VALUE(136) /* toString */,
     JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_string_repeat },
+    JS_ROM_VALUE(424) /* repeat */,
+    JS_CFUNC_generic, 1, 0 },
   { { .constructor = js_array_constructor },
-    JS_ROM_VALUE(424) /* Array */,
+    JS_ROM_VALUE(427) /* Array */,
     JS_CFUNC_constructor, 1, JS_CLASS_ARRAY },
   { { .generic = js_array_isArray },
-    JS_ROM_VALUE(427) /* isArray */,
+    JS_ROM_VALUE(430) /* isArray */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_array_get_length },
     JS_ROM_VALUE(276) /* get length */,
@@ -2911,31 +3392,31 @@ static const JSCFunctionDef js_c_function_table[] = {
     JS_ROM_VALUE(380) /* concat */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic_magic = js_array_push },
-    JS_ROM_VALUE(430) /* push */,
+    JS_ROM_VALUE(433) /* push */,
     JS_CFUNC_generic_magic, 1, 0 },
   { { .generic = js_array_pop },
-    JS_ROM_VALUE(433) /* pop */,
+    JS_ROM_VALUE(436) /* pop */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_array_join },
-    JS_ROM_VALUE(435) /* join */,
+    JS_ROM_VALUE(438) /* join */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_array_toString },
     JS_ROM_VALUE(136) /* toString */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_array_reverse },
-    JS_ROM_VALUE(438) /* reverse */,
+    JS_ROM_VALUE(441) /* reverse */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_array_shift },
-    JS_ROM_VALUE(441) /* shift */,
+    JS_ROM_VALUE(444) /* shift */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_array_slice },
     JS_ROM_VALUE(373) /* slice */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_array_splice },
-    JS_ROM_VALUE(444) /* splice */,
+    JS_ROM_VALUE(447) /* splice */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic_magic = js_array_push },
-    JS_ROM_VALUE(447) /* unshift */,
+    JS_ROM_VALUE(450) /* unshift */,
     JS_CFUNC_generic_magic, 1, 1 },
   { { .generic_magic = js_array_indexOf },
     JS_ROM_VALUE(383) /* indexOf */,
@@ -2944,328 +3425,472 @@ static const JSCFunctionDef js_c_function_table[] = {
     JS_ROM_VALUE(386) /* lastIndexOf */,
     JS_CFUNC_generic_magic, 1, 1 },
   { { .generic_magic = js_array_every },
-    JS_ROM_VALUE(450) /* every */,
+    JS_ROM_VALUE(453) /* every */,
     JS_CFUNC_generic_magic, 1, js_special_every },
   { { .generic_magic = js_array_every },
-    JS_ROM_VALUE(453) /* some */,
+    JS_ROM_VALUE(456) /* some */,
     JS_CFUNC_generic_magic, 1, js_special_some },
   { { .generic_magic = js_array_every },
-    JS_ROM_VALUE(456) /* forEach */,
+    JS_ROM_VALUE(459) /* forEach */,
     JS_CFUNC_generic_magic, 1, js_special_forEach },
   { { .generic_magic = js_array_every },
-    JS_ROM_VALUE(459) /* map */,
+    JS_ROM_VALUE(462) /* map */,
     JS_CFUNC_generic_magic, 1, js_special_map },
   { { .generic_magic = js_array_every },
-    JS_ROM_VALUE(461) /* filter */,
+    JS_ROM_VALUE(464) /* filter */,
     JS_CFUNC_generic_magic, 1, js_special_filter },
   { { .generic_magic = js_array_reduce },
-    JS_ROM_VALUE(464) /* reduce */,
+    JS_ROM_VALUE(467) /* reduce */,
     JS_CFUNC_generic_magic, 1, js_special_reduce },
   { { .generic_magic = js_array_reduce },
-    JS_ROM_VALUE(467) /* reduceRight */,
+    JS_ROM_VALUE(470) /* reduceRight */,
     JS_CFUNC_generic_magic, 1, js_special_reduceRight },
   { { .generic = js_array_sort },
-    JS_ROM_VALUE(471) /* sort */,
+    JS_ROM_VALUE(474) /* sort */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic_magic = js_math_min_max },
-    JS_ROM_VALUE(477) /* min */,
+    JS_ROM_VALUE(480) /* min */,
     JS_CFUNC_generic_magic, 2, 0 },
   { { .generic_magic = js_math_min_max },
-    JS_ROM_VALUE(479) /* max */,
+    JS_ROM_VALUE(482) /* max */,
     JS_CFUNC_generic_magic, 2, 1 },
   { { .f_f = js_math_sign },
-    JS_ROM_VALUE(481) /* sign */,
+    JS_ROM_VALUE(484) /* sign */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_fabs },
-    JS_ROM_VALUE(484) /* abs */,
+    JS_ROM_VALUE(487) /* abs */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_floor },
-    JS_ROM_VALUE(486) /* floor */,
+    JS_ROM_VALUE(489) /* floor */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_ceil },
-    JS_ROM_VALUE(489) /* ceil */,
+    JS_ROM_VALUE(492) /* ceil */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_round_inf },
-    JS_ROM_VALUE(492) /* round */,
+    JS_ROM_VALUE(495) /* round */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_sqrt },
-    JS_ROM_VALUE(495) /* sqrt */,
+    JS_ROM_VALUE(498) /* sqrt */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_sin },
-    JS_ROM_VALUE(519) /* sin */,
+    JS_ROM_VALUE(522) /* sin */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_cos },
-    JS_ROM_VALUE(521) /* cos */,
+    JS_ROM_VALUE(524) /* cos */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_tan },
-    JS_ROM_VALUE(523) /* tan */,
+    JS_ROM_VALUE(526) /* tan */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_asin },
-    JS_ROM_VALUE(525) /* asin */,
+    JS_ROM_VALUE(528) /* asin */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_acos },
-    JS_ROM_VALUE(528) /* acos */,
+    JS_ROM_VALUE(531) /* acos */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_atan },
-    JS_ROM_VALUE(531) /* atan */,
+    JS_ROM_VALUE(534) /* atan */,
     JS_CFUNC_f_f, 1, 0 },
-  { { .generic = js_math_atan2 },
-    JS_ROM_VALUE(534) /* atan2 */,
-    JS_CFUNC_generic, 2, 0 },
+  { { .f_ff = js_atan2 },
+    JS_ROM_VALUE(537) /* atan2 */,
+    JS_CFUNC_f_ff, 2, 0 },
   { { .f_f = js_exp },
-    JS_ROM_VALUE(537) /* exp */,
+    JS_ROM_VALUE(540) /* exp */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_log },
-    JS_ROM_VALUE(539) /* log */,
+    JS_ROM_VALUE(542) /* log */,
     JS_CFUNC_f_f, 1, 0 },
-  { { .generic = js_math_pow },
-    JS_ROM_VALUE(541) /* pow */,
-    JS_CFUNC_generic, 2, 0 },
+  { { .f_ff = js_pow },
+    JS_ROM_VALUE(544) /* pow */,
+    JS_CFUNC_f_ff, 2, 0 },
   { { .generic = js_math_random },
-    JS_ROM_VALUE(543) /* random */,
+    JS_ROM_VALUE(546) /* random */,
     JS_CFUNC_generic, 0, 0 },
-  { { .generic = js_math_imul },
-    JS_ROM_VALUE(546) /* imul */,
-    JS_CFUNC_generic, 2, 0 },
+  { { .i_ii = js_math_imul },
+    JS_ROM_VALUE(549) /* imul */,
+    JS_CFUNC_i_ii, 2, 0 },
   { { .generic = js_math_clz32 },
-    JS_ROM_VALUE(549) /* clz32 */,
+    JS_ROM_VALUE(552) /* clz32 */,
     JS_CFUNC_generic, 1, 0 },
   { { .f_f = js_math_fround },
-    JS_ROM_VALUE(552) /* fround */,
+    JS_ROM_VALUE(555) /* fround */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_trunc },
-    JS_ROM_VALUE(555) /* trunc */,
+    JS_ROM_VALUE(558) /* trunc */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_log2 },
-    JS_ROM_VALUE(558) /* log2 */,
+    JS_ROM_VALUE(561) /* log2 */,
     JS_CFUNC_f_f, 1, 0 },
   { { .f_f = js_log10 },
-    JS_ROM_VALUE(561) /* log10 */,
+    JS_ROM_VALUE(564) /* log10 */,
     JS_CFUNC_f_f, 1, 0 },
+  { { .i_ii = js_math_idiv },
+    JS_ROM_VALUE(567) /* idiv */,
+    JS_CFUNC_i_ii, 2, 0 },
+  { { .i_iii = js_math_fxmul },
+    JS_ROM_VALUE(570) /* fxmul */,
+    JS_CFUNC_i_iii, 3, 0 },
+  { { .i_iii = js_math_fxdiv },
+    JS_ROM_VALUE(573) /* fxdiv */,
+    JS_CFUNC_i_iii, 3, 0 },
   { { .constructor = js_date_constructor },
-    JS_ROM_VALUE(564) /* Date */,
+    JS_ROM_VALUE(576) /* Date */,
     JS_CFUNC_constructor, 7, JS_CLASS_DATE },
   { { .generic = js_date_now },
-    JS_ROM_VALUE(567) /* now */,
+    JS_ROM_VALUE(579) /* now */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_json_parse },
-    JS_ROM_VALUE(572) /* parse */,
+    JS_ROM_VALUE(584) /* parse */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_json_stringify },
-    JS_ROM_VALUE(575) /* stringify */,
+    JS_ROM_VALUE(587) /* stringify */,
     JS_CFUNC_generic, 3, 0 },
+  { { .constructor = js_json_parser_constructor },
+    JS_ROM_VALUE(591) /* JSONParser */,
+    JS_CFUNC_constructor, 2, JS_CLASS_JSON_PARSER },
+  { { .generic = js_json_parser_write_chunk },
+    JS_ROM_VALUE(595) /* write */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_json_parser_end_input },
+    JS_ROM_VALUE(598) /* end */,
+    JS_CFUNC_generic, 0, 0 },
   { { .constructor = js_regexp_constructor },
-    JS_ROM_VALUE(579) /* RegExp */,
+    JS_ROM_VALUE(600) /* RegExp */,
     JS_CFUNC_constructor, 2, JS_CLASS_REGEXP },
   { { .generic = js_regexp_get_lastIndex },
-    JS_ROM_VALUE(586) /* get lastIndex */,
+    JS_ROM_VALUE(607) /* get lastIndex */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_regexp_set_lastIndex },
-    JS_ROM_VALUE(591) /* set lastIndex */,
+    JS_ROM_VALUE(612) /* set lastIndex */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_regexp_get_source },
-    JS_ROM_VALUE(599) /* get source */,
+    JS_ROM_VALUE(620) /* get source */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_regexp_get_flags },
-    JS_ROM_VALUE(606) /* get flags */,
+    JS_ROM_VALUE(627) /* get flags */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic_magic = js_regexp_exec },
-    JS_ROM_VALUE(610) /* exec */,
+    JS_ROM_VALUE(631) /* exec */,
     JS_CFUNC_generic_magic, 1, 0 },
   { { .generic_magic = js_regexp_exec },
-    JS_ROM_VALUE(613) /* test */,
+    JS_ROM_VALUE(634) /* test */,
     JS_CFUNC_generic_magic, 1, 1 },
   { { .constructor_magic = js_error_constructor },
     JS_ROM_VALUE(208) /* Error */,
     JS_CFUNC_constructor_magic, 1, JS_CLASS_ERROR },
   { { .generic_magic = js_error_get_message },
-    JS_ROM_VALUE(619) /* get message */,
+    JS_ROM_VALUE(640) /* get message */,
     JS_CFUNC_generic_magic, 0, 0 },
   { { .generic_magic = js_error_get_message },
-    JS_ROM_VALUE(626) /* get stack */,
+    JS_ROM_VALUE(647) /* get stack */,
     JS_CFUNC_generic_magic, 0, 1 },
   { { .generic = js_error_toString },
     JS_ROM_VALUE(136) /* toString */,
     JS_CFUNC_generic, 0, 0 },
   { { .constructor_magic = js_error_constructor },
-    JS_ROM_VALUE(630) /* EvalError */,
+    JS_ROM_VALUE(651) /* EvalError */,
     JS_CFUNC_constructor_magic, 1, JS_CLASS_EVAL_ERROR },
   { { .constructor_magic = js_error_constructor },
-    JS_ROM_VALUE(634) /* RangeError */,
+    JS_ROM_VALUE(655) /* RangeError */,
     JS_CFUNC_constructor_magic, 1, JS_CLASS_RANGE_ERROR },
   { { .constructor_magic = js_error_constructor },
-    JS_ROM_VALUE(638) /* ReferenceError */,
+    JS_ROM_VALUE(659) /* ReferenceError */,
     JS_CFUNC_constructor_magic, 1, JS_CLASS_REFERENCE_ERROR },
   { { .constructor_magic = js_error_constructor },
-    JS_ROM_VALUE(643) /* SyntaxError */,
+    JS_ROM_VALUE(664) /* SyntaxError */,
     JS_CFUNC_constructor_magic, 1, JS_CLASS_SYNTAX_ERROR },
   { { .constructor_magic = js_error_constructor },
-    JS_ROM_VALUE(647) /* TypeError */,
+    JS_ROM_VALUE(668) /* TypeError */,
     JS_CFUNC_constructor_magic, 1, JS_CLASS_TYPE_ERROR },
   { { .constructor_magic = js_error_constructor },
-    JS_ROM_VALUE(651) /* URIError */,
+    JS_ROM_VALUE(672) /* URIError */,
     JS_CFUNC_constructor_magic, 1, JS_CLASS_URI_ERROR },
   { { .constructor_magic = js_error_constructor },
-    JS_ROM_VALUE(655) /* InternalError */,
+    JS_ROM_VALUE(676) /* InternalError */,
     JS_CFUNC_constructor_magic, 1, JS_CLASS_INTERNAL_ERROR },
   { { .constructor = js_array_buffer_constructor },
-    JS_ROM_VALUE(660) /* ArrayBuffer */,
+    JS_ROM_VALUE(681) /* ArrayBuffer */,
     JS_CFUNC_constructor, 1, JS_CLASS_ARRAY_BUFFER },
   { { .generic = js_array_buffer_get_byteLength },
-    JS_ROM_VALUE(668) /* get byteLength */,
+    JS_ROM_VALUE(689) /* get byteLength */,
     JS_CFUNC_generic, 0, 0 },
   { { .constructor = js_typed_array_base_constructor },
-    JS_ROM_VALUE(679) /* TypedArray */,
+    JS_ROM_VALUE(700) /* TypedArray */,
     JS_CFUNC_constructor, 0, JS_CLASS_TYPED_ARRAY },
   { { .generic_magic = js_typed_array_get_length },
     JS_ROM_VALUE(276) /* get length */,
     JS_CFUNC_generic_magic, 0, 0 },
   { { .generic_magic = js_typed_array_get_length },
-    JS_ROM_VALUE(668) /* get byteLength */,
+    JS_ROM_VALUE(689) /* get byteLength */,
     JS_CFUNC_generic_magic, 0, 1 },
   { { .generic_magic = js_typed_array_get_length },
-    JS_ROM_VALUE(687) /* get byteOffset */,
+    JS_ROM_VALUE(708) /* get byteOffset */,
     JS_CFUNC_generic_magic, 0, 2 },
   { { .generic_magic = js_typed_array_get_length },
-    JS_ROM_VALUE(695) /* get buffer */,
+    JS_ROM_VALUE(716) /* get buffer */,
     JS_CFUNC_generic_magic, 0, 3 },
   { { .generic = js_typed_array_subarray },
-    JS_ROM_VALUE(699) /* subarray */,
+    JS_ROM_VALUE(720) /* subarray */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_typed_array_set },
     JS_ROM_VALUE(177) /* set */,
     JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_typed_array_fill },
+    JS_ROM_VALUE(724) /* fill */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_typed_array_copyWithin },
+    JS_ROM_VALUE(727) /* copyWithin */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_typed_array_indexOf },
+    JS_ROM_VALUE(383) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_typed_array_indexOf },
+    JS_ROM_VALUE(386) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_typed_array_slice },
+    JS_ROM_VALUE(373) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_typed_array_sum },
+    JS_ROM_VALUE(731) /* sum */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic_magic = js_typed_array_min_max },
+    JS_ROM_VALUE(480) /* min */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_typed_array_min_max },
+    JS_ROM_VALUE(482) /* max */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_typed_array_dot },
+    JS_ROM_VALUE(733) /* dot */,
+    JS_CFUNC_generic, 1, 0 },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(673) /* Uint8ClampedArray */,
+    JS_ROM_VALUE(694) /* Uint8ClampedArray */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT8C_ARRAY },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(709) /* Int8Array */,
+    JS_ROM_VALUE(741) /* Int8Array */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_INT8_ARRAY },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(713) /* Uint8Array */,
+    JS_ROM_VALUE(745) /* Uint8Array */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT8_ARRAY },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(717) /* Int16Array */,
+    JS_ROM_VALUE(749) /* Int16Array */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_INT16_ARRAY },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(721) /* Uint16Array */,
+    JS_ROM_VALUE(753) /* Uint16Array */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT16_ARRAY },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(725) /* Int32Array */,
+    JS_ROM_VALUE(757) /* Int32Array */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_INT32_ARRAY },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(729) /* Uint32Array */,
+    JS_ROM_VALUE(761) /* Uint32Array */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT32_ARRAY },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(733) /* Float32Array */,
+    JS_ROM_VALUE(765) /* Float32Array */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_FLOAT32_ARRAY },
   { { .constructor_magic = js_typed_array_constructor },
-    JS_ROM_VALUE(738) /* Float64Array */,
+    JS_ROM_VALUE(770) /* Float64Array */,
     JS_CFUNC_constructor_magic, 3, JS_CLASS_FLOAT64_ARRAY },
+  { { .constructor = js_dataview_constructor },
+    JS_ROM_VALUE(775) /* DataView */,
+    JS_CFUNC_constructor, 3, JS_CLASS_DATA_VIEW },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(689) /* get byteLength */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(708) /* get byteOffset */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(716) /* get buffer */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(779) /* getInt8 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT8_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(782) /* setInt8 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT8_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(785) /* getUint8 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT8_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(789) /* setUint8 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT8_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(793) /* getInt16 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT16_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(797) /* setInt16 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT16_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(801) /* getUint16 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT16_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(805) /* setUint16 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT16_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(809) /* getInt32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(813) /* setInt32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(817) /* getUint32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(821) /* setUint32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(825) /* getFloat32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_FLOAT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(829) /* setFloat32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_FLOAT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(833) /* getFloat64 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_FLOAT64_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(837) /* setFloat64 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_FLOAT64_ARRAY },
   { { .generic = js_print },
-    JS_ROM_VALUE(539) /* log */,
+    JS_ROM_VALUE(542) /* log */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_performance_now },
-    JS_ROM_VALUE(567) /* now */,
+    JS_ROM_VALUE(579) /* now */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_performance_memory },
+    JS_ROM_VALUE(859) /* memory */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_performance_resetMemory },
+    JS_ROM_VALUE(862) /* resetMemory */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_performance_heapProfile },
+    JS_ROM_VALUE(866) /* heapProfile */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_performance_heapReport },
+    JS_ROM_VALUE(870) /* heapReport */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_freebutton_led_count },
-    JS_ROM_VALUE(763) /* count */,
+    JS_ROM_VALUE(876) /* count */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_freebutton_led_on },
-    JS_ROM_VALUE(766) /* on */,
+    JS_ROM_VALUE(879) /* on */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_freebutton_led_off },
-    JS_ROM_VALUE(768) /* off */,
+    JS_ROM_VALUE(881) /* off */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_freebutton_led_setColor },
-    JS_ROM_VALUE(770) /* setColor */,
+    JS_ROM_VALUE(883) /* setColor */,
     JS_CFUNC_generic, 4, 0 },
+  { { .generic = js_freebutton_led_show },
+    JS_ROM_VALUE(887) /* show */,
+    JS_CFUNC_generic, 1, 0 },
   { { .generic = js_freebutton_button_count },
-    JS_ROM_VALUE(763) /* count */,
+    JS_ROM_VALUE(876) /* count */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_freebutton_button_setLabel },
-    JS_ROM_VALUE(777) /* setLabel */,
+    JS_ROM_VALUE(893) /* setLabel */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_freebutton_button_setTopLabel },
-    JS_ROM_VALUE(781) /* setTopLabel */,
+    JS_ROM_VALUE(897) /* setTopLabel */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_freebutton_button_onClick },
-    JS_ROM_VALUE(785) /* onClick */,
+    JS_ROM_VALUE(901) /* onClick */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_freebutton_button_onLongPress },
-    JS_ROM_VALUE(788) /* onLongPress */,
+    JS_ROM_VALUE(904) /* onLongPress */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_freebutton_button_onRelease },
-    JS_ROM_VALUE(792) /* onRelease */,
+    JS_ROM_VALUE(908) /* onRelease */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_freebutton_sensor_count },
-    JS_ROM_VALUE(763) /* count */,
+    JS_ROM_VALUE(876) /* count */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_freebutton_sensor_getValue },
-    JS_ROM_VALUE(799) /* getValue */,
+    JS_ROM_VALUE(915) /* getValue */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_freebutton_sensor_getType },
-    JS_ROM_VALUE(803) /* getType */,
+    JS_ROM_VALUE(919) /* getType */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_freebutton_sensor_getInfo },
-    JS_ROM_VALUE(806) /* getInfo */,
+    JS_ROM_VALUE(922) /* getInfo */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_freebutton_sensor_getAll },
-    JS_ROM_VALUE(809) /* getAll */,
+    JS_ROM_VALUE(925) /* getAll */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_freebutton_sensor_onChange },
-    JS_ROM_VALUE(812) /* onChange */,
+    JS_ROM_VALUE(928) /* onChange */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_freebutton_sensor_readInto },
+    JS_ROM_VALUE(932) /* readInto */,
     JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_freebutton_sensor_startSampling },
+    JS_ROM_VALUE(936) /* startSampling */,
+    JS_CFUNC_generic, 3, 0 },
+  { { .generic = js_freebutton_sensor_drain },
+    JS_ROM_VALUE(941) /* drain */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_freebutton_sensor_stopSampling },
+    JS_ROM_VALUE(944) /* stopSampling */,
+    JS_CFUNC_generic, 0, 0 },
   { { .generic = js_freebutton_mqtt_getBrokerCount },
-    JS_ROM_VALUE(819) /* getBrokerCount */,
+    JS_ROM_VALUE(952) /* getBrokerCount */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_freebutton_mqtt_getBrokerName },
-    JS_ROM_VALUE(824) /* getBrokerName */,
+    JS_ROM_VALUE(957) /* getBrokerName */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_freebutton_mqtt_isConnected },
-    JS_ROM_VALUE(829) /* isConnected */,
+    JS_ROM_VALUE(962) /* isConnected */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_freebutton_mqtt_publish },
-    JS_ROM_VALUE(833) /* publish */,
+    JS_ROM_VALUE(966) /* publish */,
+    JS_CFUNC_generic, 5, 0 },
+  { { .generic = js_freebutton_mqtt_publishJSON },
+    JS_ROM_VALUE(969) /* publishJSON */,
     JS_CFUNC_generic, 5, 0 },
   { { .generic = js_freebutton_mqtt_subscribe },
-    JS_ROM_VALUE(836) /* subscribe */,
+    JS_ROM_VALUE(973) /* subscribe */,
     JS_CFUNC_generic, 4, 0 },
   { { .generic = js_freebutton_mqtt_unsubscribe },
-    JS_ROM_VALUE(840) /* unsubscribe */,
+    JS_ROM_VALUE(977) /* unsubscribe */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_freebutton_mqtt_onConnect },
-    JS_ROM_VALUE(844) /* onConnect */,
+    JS_ROM_VALUE(981) /* onConnect */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_freebutton_mqtt_onDisconnect },
-    JS_ROM_VALUE(848) /* onDisconnect */,
+    JS_ROM_VALUE(985) /* onDisconnect */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_global_eval },
     JS_ROM_VALUE(165) /* eval */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_global_isNaN },
-    JS_ROM_VALUE(743) /* isNaN */,
+    JS_ROM_VALUE(841) /* isNaN */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_global_isFinite },
-    JS_ROM_VALUE(746) /* isFinite */,
+    JS_ROM_VALUE(844) /* isFinite */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_print },
-    JS_ROM_VALUE(853) /* print */,
+    JS_ROM_VALUE(990) /* print */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_gc },
-    JS_ROM_VALUE(856) /* gc */,
+    JS_ROM_VALUE(993) /* gc */,
     JS_CFUNC_generic, 0, 0 },
   { { .generic = js_load },
-    JS_ROM_VALUE(858) /* load */,
+    JS_ROM_VALUE(995) /* load */,
     JS_CFUNC_generic, 1, 0 },
   { { .generic = js_loadMapped },
-    JS_ROM_VALUE(861) /* loadMapped */,
+    JS_ROM_VALUE(998) /* loadMapped */,
     JS_CFUNC_generic, 3, 0 },
+  { { .generic = js_loadUserBytecode },
+    JS_ROM_VALUE(1002) /* loadUserBytecode */,
+    JS_CFUNC_generic, 1, 0 },
   { { .generic = js_setTimeout },
-    JS_ROM_VALUE(865) /* setTimeout */,
+    JS_ROM_VALUE(1008) /* setTimeout */,
     JS_CFUNC_generic, 2, 0 },
   { { .generic = js_clearTimeout },
-    JS_ROM_VALUE(869) /* clearTimeout */,
+    JS_ROM_VALUE(1012) /* clearTimeout */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_setInterval },
+    JS_ROM_VALUE(1017) /* setInterval */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_clearTimeout },
+    JS_ROM_VALUE(1021) /* clearInterval */,
     JS_CFUNC_generic, 1, 0 },
 };
 
@@ -3280,10 +3905,13 @@ const JSSTDLibraryDef js_stdlib = {
   js_stdlib_table,
   js_c_function_table,
   js_c_finalizer_table,
-  2536,
+  2955,
   64,
-  874,
-  2437,
+  1026,
+  2846,
   JS_CLASS_COUNT,
+  js_atom_hash_table,
+  9,
+  7,
 };
 
@@ -37,6 +37,10 @@ JSValue js_freebutton_led_setColor(JSContext *ctx, JSValue *this_val, int argc,
     return JS_UNDEFINED;
 }
 
+JSValue js_freebutton_led_show(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
+    return JS_NewInt32(ctx, 0);
+}
+
 /*
  * Button API Stubs
  */
@@ -93,6 +97,22 @@ JSValue js_freebutton_sensor_onChange(JSContext *ctx, JSValue *this_val, int arg
     return JS_UNDEFINED;
 }
 
+JSValue js_freebutton_sensor_readInto(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
+    return JS_NewInt32(ctx, 0);
+}
+
+JSValue js_freebutton_sensor_startSampling(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
+    return JS_UNDEFINED;
+}
+
+JSValue js_freebutton_sensor_drain(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
+    return JS_NewInt32(ctx, 0);
+}
+
+JSValue js_freebutton_sensor_stopSampling(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
+    return JS_NewInt32(ctx, 0);
+}
+
 /*
  * MQTT API Stubs
  */
@@ -113,6 +133,10 @@ JSValue js_freebutton_mqtt_publish(JSContext *ctx, JSValue *this_val, int argc,
     return JS_UNDEFINED;
 }
 
+JSValue js_freebutton_mqtt_publishJSON(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
+    return JS_UNDEFINED;
+}
+
 JSValue js_freebutton_mqtt_subscribe(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
     return JS_UNDEFINED;
 }
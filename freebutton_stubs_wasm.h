@@ -10,11 +10,12 @@
 
 #include "mquickjs.h"
 
-// Standard library functions (from stdlib_export.c)
+// Standard library functions (from stdlib_export.c and mqjs_timer.c)
 JSValue js_gc(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_load(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_setTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_clearTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_setInterval(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_date_now(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_print(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_performance_now(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
@@ -25,6 +26,7 @@ JSValue js_freebutton_led_count(JSContext *ctx, JSValue *this_val, int argc, JSV
 JSValue js_freebutton_led_on(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_led_off(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_led_setColor(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_led_show(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 
 // Button API declarations
 JSValue js_freebutton_button_count(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
@@ -41,12 +43,17 @@ JSValue js_freebutton_sensor_getType(JSContext *ctx, JSValue *this_val, int argc
 JSValue js_freebutton_sensor_getInfo(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_sensor_getAll(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_sensor_onChange(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_readInto(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_startSampling(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_drain(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_stopSampling(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 
 // MQTT API declarations
 JSValue js_freebutton_mqtt_getBrokerCount(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_mqtt_getBrokerName(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_mqtt_isConnected(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_mqtt_publish(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_publishJSON(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_mqtt_subscribe(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_mqtt_unsubscribe(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_mqtt_onConnect(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
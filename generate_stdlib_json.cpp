@@ -505,6 +505,10 @@ public:
         extern const JSPropDef js_json[];
         classes["JSON"] = emitClass("JSON", js_json, nullptr);
 
+        // JSONParser class (incremental parser, has prototype methods)
+        extern const JSPropDef js_json_parser_proto[];
+        classes["JSONParser"] = emitClass("JSONParser", nullptr, js_json_parser_proto);
+
         // Boolean class (constructor only, no static/proto methods we can extract)
         classes["Boolean"] = emitClass("Boolean", nullptr, nullptr);
 
@@ -520,6 +524,10 @@ public:
         extern const JSPropDef js_regexp_proto[];
         classes["RegExp"] = emitClass("RegExp", nullptr, js_regexp_proto);
 
+        // DataView class (has prototype methods)
+        extern const JSPropDef js_dataview_proto[];
+        classes["DataView"] = emitClass("DataView", nullptr, js_dataview_proto);
+
         // Error class (has prototype methods)
         extern const JSPropDef js_error_proto[];
         classes["Error"] = emitClass("Error", nullptr, js_error_proto);
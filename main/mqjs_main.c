@@ -4,6 +4,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "mquickjs.h"
 /* js_stdlib is defined in mqjs_stdlib.h within mqjs.c */
@@ -26,6 +27,12 @@ static void esp_js_log_func(void *opaque, const void *buf, size_t buf_len)
     fwrite(buf, 1, buf_len, stdout);
 }
 
+/* used to measure the GC pauses (see JS_GetMemoryStats()) */
+static int64_t esp_js_clock_us(JSContext *ctx, void *opaque)
+{
+    return esp_timer_get_time();
+}
+
 void app_main(void)
 {
     static uint8_t js_mem[MQJS_MEM_SIZE];
@@ -48,6 +55,7 @@ void app_main(void)
 
     /* Set log function so JS_PrintValueF works (used by print()) */
     JS_SetLogFunc(ctx, esp_js_log_func);
+    JS_SetClockFunc(ctx, esp_js_clock_us);
 
     gettimeofday(&tv, NULL);
     JS_SetRandomSeed(ctx, ((uint64_t)tv.tv_sec << 32) | tv.tv_usec);
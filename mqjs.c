@@ -34,6 +34,11 @@
 #include <sys/time.h>
 #include <math.h>
 #include <fcntl.h>
+#if !defined(ESP_PLATFORM) && !defined(_WIN32)
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#endif
 #ifdef ESP_PLATFORM
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -103,6 +108,9 @@ static JSValue js_performance_now(JSContext *ctx, JSValue *this_val, int argc, J
     return JS_NewInt64(ctx, get_time_ms());
 }
 
+/* performance.memory() and the heap profiler are in mqjs_perf.c */
+#include "mqjs_perf.h"
+
 /* LED functions are in mqjs_led.c */
 #include "mqjs_led.h"
 
@@ -110,12 +118,12 @@ static JSValue js_performance_now(JSContext *ctx, JSValue *this_val, int argc, J
 static JSValue js_load(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
 {
     const char *filename;
-    JSCStringBuf buf_str;
     uint8_t *buf;
     int buf_len;
     JSValue ret;
     
-    filename = JS_ToCString(ctx, argv[0], &buf_str);
+    /* JS_Eval() allocates, so 'filename' must not be in the JS heap */
+    filename = JS_ToTempCString(ctx, NULL, argv[0]);
     if (!filename)
         return JS_EXCEPTION;
     buf = load_file(filename, &buf_len);
@@ -125,108 +133,69 @@ static JSValue js_load(JSContext *ctx, JSValue *this_val, int argc, JSValue *arg
     return ret;
 }
 
-/* timers */
-typedef struct {
-    BOOL allocated;
-    JSGCRef func;
-    int64_t timeout; /* in ms */
-} JSTimer;
-
-#define MAX_TIMERS 16
-
-static JSTimer js_timer_list[MAX_TIMERS];
-
-static JSValue js_setTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+/* readFile(filename): return the content of a text file as a string */
+static JSValue js_readFile(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
 {
-    JSTimer *th;
-    int delay, i;
-    JSValue *pfunc;
-    
-    if (!JS_IsFunction(ctx, argv[0]))
-        return JS_ThrowTypeError(ctx, "not a function");
-    if (JS_ToInt32(ctx, &delay, argv[1]))
+    const char *filename;
+    uint8_t *buf;
+    FILE *f;
+    long buf_len;
+    JSValue ret;
+
+    filename = JS_ToTempCString(ctx, NULL, argv[0]);
+    if (!filename)
         return JS_EXCEPTION;
-    for(i = 0; i < MAX_TIMERS; i++) {
-        th = &js_timer_list[i];
-        if (!th->allocated) {
-            pfunc = JS_AddGCRef(ctx, &th->func);
-            *pfunc = argv[0];
-            th->timeout = get_time_ms() + delay;
-            th->allocated = TRUE;
-            return JS_NewInt32(ctx, i);
-        }
+    f = fopen(filename, "rb");
+    if (!f)
+        return JS_ThrowTypeError(ctx, "%s: cannot open file", filename);
+    fseek(f, 0, SEEK_END);
+    buf_len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(max_int(buf_len, 1));
+    if (!buf) {
+        fclose(f);
+        return JS_ThrowOutOfMemory(ctx);
     }
-    return JS_ThrowInternalError(ctx, "too many timers");
+    buf_len = fread(buf, 1, buf_len, f);
+    fclose(f);
+    /* JS_NewStringLen() allocates, so 'buf' must not be in the JS heap */
+    ret = JS_NewStringLen(ctx, (const char *)buf, buf_len);
+    free(buf);
+    return ret;
 }
 
-static JSValue js_clearTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
-{
-    int timer_id;
-    JSTimer *th;
+/* setTimeout() and setInterval() are in mqjs_timer.c */
+#include "mqjs_timer.h"
 
-    if (JS_ToInt32(ctx, &timer_id, argv[0]))
-        return JS_EXCEPTION;
-    if (timer_id >= 0 && timer_id < MAX_TIMERS) {
-        th = &js_timer_list[timer_id];
-        if (th->allocated) {
-            JS_DeleteGCRef(ctx, &th->func);
-            th->allocated = FALSE;
-        }
-    }
-    return JS_UNDEFINED;
-}
+/* startWorker() and postMessage() are in mqjs_worker.c */
+#include "mqjs_worker.h"
 
 static void run_timers(JSContext *ctx)
 {
-    int64_t min_delay, delay, cur_time;
-    BOOL has_timer;
-    int i;
-    JSTimer *th;
+    int64_t delay;
 #ifndef ESP_PLATFORM
     struct timespec ts;
 #endif
 
     for(;;) {
-        min_delay = 1000;
-        cur_time = get_time_ms();
-        has_timer = FALSE;
-        for(i = 0; i < MAX_TIMERS; i++) {
-            th = &js_timer_list[i];
-            if (th->allocated) {
-                has_timer = TRUE;
-                delay = th->timeout - cur_time;
-                if (delay <= 0) {
-                    JSValue ret;
-                    /* the timer expired */
-                    if (JS_StackCheck(ctx, 2))
-                        goto fail;
-                    JS_PushArg(ctx, th->func.val); /* func name */
-                    JS_PushArg(ctx, JS_NULL); /* this */
-                    
-                    JS_DeleteGCRef(ctx, &th->func);
-                    th->allocated = FALSE;
-                    
-                    ret = JS_Call(ctx, 0);
-                    if (JS_IsException(ret)) {
-                    fail:
-                        dump_error(ctx);
-                        exit(1);
-                    }
-                    min_delay = 0;
-                    break;
-                } else if (delay < min_delay) {
-                    min_delay = delay;
-                }
-            }
+        delay = JS_ProcessTimers(ctx);
+        if (delay == -2) {
+            dump_error(ctx);
+            exit(1);
         }
-        if (!has_timer)
+        if (delay < 0)
             break;
-        if (min_delay > 0) {
+        if (delay > 0) {
+            /* use the idle time to collect the garbage */
+            if (JS_GCIdle(ctx))
+                continue;
 #ifdef ESP_PLATFORM
-            vTaskDelay(pdMS_TO_TICKS(min_delay));
+            /* a task notification (e.g. JS_CommitEvent() returning
+               TRUE) ends the wait early */
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(delay));
 #else
-            ts.tv_sec = min_delay / 1000;
-            ts.tv_nsec = (min_delay % 1000) * 1000000;
+            ts.tv_sec = delay / 1000;
+            ts.tv_nsec = (delay % 1000) * 1000000;
             nanosleep(&ts, NULL);
 #endif
         }
@@ -278,6 +247,11 @@ static void js_log_func(void *opaque, const void *buf, size_t buf_len)
 {
     fwrite(buf, 1, buf_len, js_log_err_flag ? stderr : stdout);
 }
+
+static void write_file_func(void *opaque, const void *buf, size_t buf_len)
+{
+    fwrite(buf, 1, buf_len, opaque);
+}
 #endif
 
 static void dump_error(JSContext *ctx)
@@ -340,6 +314,34 @@ static int eval_buf(JSContext *ctx, const char *eval_str, const char *filename,
 }
 
 #ifndef ESP_PLATFORM
+/* JS_LoadBytecode() uses the bytecode in place and the timers, jobs
+   and workers may still run it after eval_file() returns, so the
+   buffers are only freed after JS_FreeContext() */
+static uint8_t **bytecode_bufs;
+static int bytecode_bufs_len;
+
+static void keep_bytecode_buf(uint8_t *buf)
+{
+    uint8_t **new_bufs;
+    new_bufs = realloc(bytecode_bufs, sizeof(bytecode_bufs[0]) * (bytecode_bufs_len + 1));
+    if (!new_bufs) {
+        fprintf(stderr, "Could not allocate memory\n");
+        exit(1);
+    }
+    bytecode_bufs = new_bufs;
+    bytecode_bufs[bytecode_bufs_len++] = buf;
+}
+
+static void free_bytecode_bufs(void)
+{
+    int i;
+    for(i = 0; i < bytecode_bufs_len; i++)
+        free(bytecode_bufs[i]);
+    free(bytecode_bufs);
+    bytecode_bufs = NULL;
+    bytecode_bufs_len = 0;
+}
+
 static int eval_file(JSContext *ctx, const char *filename,
                      int argc, const char **argv, int parse_flags,
                      BOOL allow_bytecode)
@@ -355,6 +357,10 @@ static int eval_file(JSContext *ctx, const char *filename,
             exit(1);
         }
         val = JS_LoadBytecode(ctx, buf);
+        keep_bytecode_buf(buf);
+        buf = NULL;
+    } else if (allow_bytecode && JS_IsCompactBytecode(buf, buf_len)) {
+        val = JS_LoadCompactBytecode(ctx, buf, buf_len);
     } else {
         val = JS_Parse(ctx, (char *)buf, buf_len, filename, parse_flags);
     }
@@ -395,8 +401,10 @@ static int eval_file(JSContext *ctx, const char *filename,
 #endif
 
 #ifndef ESP_PLATFORM
-static void compile_file(const char *filename, const char *outfilename,
-                         size_t mem_size, int dump_memory, int parse_flags, BOOL force_32bit)
+/* return 0 if OK, -1 if error */
+static int compile_file(const char *filename, const char *outfilename,
+                        size_t mem_size, int dump_memory, int parse_flags, BOOL force_32bit,
+                        BOOL compact)
 {
     uint8_t *mem_buf;
     JSContext *ctx;
@@ -424,11 +432,35 @@ static void compile_file(const char *filename, const char *outfilename,
 
     eval_str = (char *)load_file(filename, NULL);
 
-    val = JS_Parse(ctx, eval_str, strlen(eval_str), filename, parse_flags);
+    /* the bytecode files are always fully compiled */
+    val = JS_Parse(ctx, eval_str, strlen(eval_str), filename,
+                   parse_flags & ~JS_EVAL_LAZY);
     free(eval_str);
     if (JS_IsException(val)) {
         dump_error(ctx);
-        return;
+        JS_FreeContext(ctx);
+        free(mem_buf);
+        return -1;
+    }
+
+    if (compact) {
+        /* the compact format does not depend on the word size */
+        f = fopen(outfilename, "wb");
+        if (!f) {
+            perror(outfilename);
+            exit(1);
+        }
+        if (JS_WriteCompactBytecode(ctx, val, write_file_func, f)) {
+            dump_error(ctx);
+            fclose(f);
+            JS_FreeContext(ctx);
+            free(mem_buf);
+            return -1;
+        }
+        fclose(f);
+        JS_FreeContext(ctx);
+        free(mem_buf);
+        return 0;
     }
 
 #if JSW == 8 
@@ -463,7 +495,125 @@ static void compile_file(const char *filename, const char *outfilename,
     
     JS_FreeContext(ctx);
     free(mem_buf);
+    return 0;
+}
+
+/* print the names used by the scripts or bytecode files, for
+   "mqjs_stdlib -u". Return 0 if OK, -1 if error */
+static int dump_names(int file_count, const char **files, size_t mem_size,
+                      int parse_flags, BOOL allow_bytecode)
+{
+    uint8_t *mem_buf, *buf;
+    JSContext *ctx;
+    JSValue val;
+    int i, buf_len, ret;
+    
+    mem_buf = malloc(mem_size);
+    ctx = JS_NewContext(mem_buf, mem_size, &js_stdlib);
+    JS_SetLogFunc(ctx, js_log_func);
+    ret = 0;
+    for(i = 0; i < file_count && ret == 0; i++) {
+        buf = load_file(files[i], &buf_len);
+        if (allow_bytecode && JS_IsBytecode(buf, buf_len)) {
+            if (JS_RelocateBytecode(ctx, buf, buf_len)) {
+                fprintf(stderr, "Could not relocate bytecode\n");
+                exit(1);
+            }
+            val = JS_LoadBytecode(ctx, buf);
+            /* the ROM atoms of the bytecode stay registered */
+            keep_bytecode_buf(buf);
+            buf = NULL;
+        } else if (allow_bytecode && JS_IsCompactBytecode(buf, buf_len)) {
+            val = JS_LoadCompactBytecode(ctx, buf, buf_len);
+        } else {
+            val = JS_Parse(ctx, (char *)buf, buf_len, files[i],
+                           parse_flags & ~JS_EVAL_LAZY);
+        }
+        if (JS_IsException(val)) {
+            dump_error(ctx);
+            ret = -1;
+        } else {
+            JS_DumpBytecodeNames(ctx, val, write_file_func, stdout);
+        }
+        free(buf);
+    }
+    JS_FreeContext(ctx);
+    free(mem_buf);
+    free_bytecode_bufs();
+    return ret;
+}
+
+#ifndef _WIN32
+/* Run each file in its own process with at most 'n_jobs' processes
+   at a time. Processes are used because the timers and the profiler
+   are global. Return the index of the file to process in the child
+   processes or -1 in the parent process once all the files are
+   processed, with the number of failed files in '*pfailed'. */
+static int spawn_jobs(int n_jobs, int n_files, const char **files,
+                      int *pfailed)
+{
+    pid_t *pids, pid;
+    int i, j, n_running, status, failed;
+
+    pids = malloc(sizeof(pids[0]) * n_files);
+    n_running = 0;
+    failed = 0;
+    fflush(stdout);
+    fflush(stderr);
+    for(i = 0; i < n_files || n_running > 0;) {
+        if (i < n_files && n_running < n_jobs) {
+            pid = fork();
+            if (pid < 0) {
+                perror("fork");
+                exit(1);
+            }
+            if (pid == 0) {
+                free(pids);
+                return i;
+            }
+            pids[i++] = pid;
+            n_running++;
+        } else {
+            pid = wait(&status);
+            if (pid < 0) {
+                perror("wait");
+                exit(1);
+            }
+            n_running--;
+            for(j = 0; j < i && pids[j] != pid; j++)
+                continue;
+            if (WIFSIGNALED(status)) {
+                fprintf(stderr, "%s: killed by signal %d\n", files[j],
+                        WTERMSIG(status));
+                failed++;
+            } else if (WEXITSTATUS(status) != 0) {
+                fprintf(stderr, "%s: failed\n", files[j]);
+                failed++;
+            }
+        }
+    }
+    free(pids);
+    *pfailed = failed;
+    return -1;
 }
+
+/* return 'out_dir'/'filename' without directory and with the
+   extension replaced by ".jsc" */
+static char *get_job_output_filename(const char *out_dir, const char *filename)
+{
+    const char *base, *ext;
+    char *buf;
+    int len;
+
+    base = strrchr(filename, '/');
+    base = base ? base + 1 : filename;
+    ext = strrchr(base, '.');
+    len = ext ? ext - base : strlen(base);
+    buf = malloc(strlen(out_dir) + len + 6);
+    sprintf(buf, "%s/%.*s.jsc", out_dir, len, base);
+    return buf;
+}
+#endif /* !_WIN32 */
 #endif
 
 /* repl */
@@ -575,10 +725,104 @@ static int term_get_color(int *plen, const char *buf, int pos, int buf_len)
     *plen = len;
     return color;
 }
+
+/* Sampling profiler: the call stack is sampled each time the
+   interrupt handler is called (every JS_INTERRUPT_COUNTER_INIT
+   calls or backward jumps) and the samples are aggregated as
+   collapsed stacks which can be given to flamegraph.pl. */
+
+#define PROFILE_MAX_FRAMES 64
+#define PROFILE_HASH_SIZE  1024
+
+typedef struct ProfileEntry {
+    struct ProfileEntry *hash_next;
+    uint32_t hash;
+    uint64_t count;
+    char stack[0];
+} ProfileEntry;
+
+static const char *profile_filename;
+static ProfileEntry *profile_hash[PROFILE_HASH_SIZE];
+
+static void profile_sample(JSContext *ctx)
+{
+    JSStackFrame tab[PROFILE_MAX_FRAMES];
+    char buf[4096], *q, *buf_end;
+    JSStackFrame *sf;
+    ProfileEntry *pe, **ppe;
+    uint32_t h;
+    int n, i, len;
+
+    n = JS_GetStackFrames(ctx, tab, countof(tab));
+    if (n == 0)
+        return;
+    /* the outermost frame comes first */
+    q = buf;
+    buf_end = buf + sizeof(buf);
+    for(i = n - 1; i >= 0; i--) {
+        sf = &tab[i];
+        if (sf->filename) {
+            len = snprintf(q, buf_end - q, "%s (%s:%d)%s",
+                           sf->func_name ? sf->func_name : "<anonymous>",
+                           sf->filename, sf->line_num, i != 0 ? ";" : "");
+        } else {
+            len = snprintf(q, buf_end - q, "%s (native)%s",
+                           sf->func_name ? sf->func_name : "<anonymous>",
+                           i != 0 ? ";" : "");
+        }
+        if (len >= buf_end - q)
+            return; /* stack too deep: ignore the sample */
+        q += len;
+    }
+    len = q - buf;
+
+    h = hash_string8((uint8_t *)buf, len);
+    ppe = &profile_hash[h % PROFILE_HASH_SIZE];
+    for(pe = *ppe; pe != NULL; pe = pe->hash_next) {
+        if (pe->hash == h && !strcmp(pe->stack, buf)) {
+            pe->count++;
+            return;
+        }
+    }
+    pe = malloc(sizeof(*pe) + len + 1);
+    if (!pe)
+        return;
+    pe->hash = h;
+    pe->count = 1;
+    memcpy(pe->stack, buf, len + 1);
+    pe->hash_next = *ppe;
+    *ppe = pe;
+}
+
+static void profile_dump(void)
+{
+    ProfileEntry *pe, *pe_next;
+    FILE *f;
+    int i;
+
+    f = fopen(profile_filename, "w");
+    if (!f) {
+        perror(profile_filename);
+        return;
+    }
+    for(i = 0; i < PROFILE_HASH_SIZE; i++) {
+        for(pe = profile_hash[i]; pe != NULL; pe = pe_next) {
+            pe_next = pe->hash_next;
+            fprintf(f, "%s %" PRIu64 "\n", pe->stack, pe->count);
+            free(pe);
+        }
+        profile_hash[i] = NULL;
+    }
+    fclose(f);
+}
 #endif /* !ESP_PLATFORM */
 
 static int js_interrupt_handler(JSContext *ctx, void *opaque)
 {
+#ifndef ESP_PLATFORM
+    if (profile_filename)
+        profile_sample(ctx);
+#endif
     return readline_is_interrupted();
 }
 
@@ -715,10 +959,20 @@ static void help(void)
            "-I  --include file    include an additional file\n"
            "-d  --dump            dump the memory usage stats\n"
            "    --memory-limit n  limit the memory usage to 'n' bytes\n"
+           "    --profile FILE    write the sampled call stacks to FILE\n"
            "--no-column           no column number in debug information\n"
+           "    --lazy            compile the nested functions at their first call\n"
            "-o FILE               save the bytecode to FILE\n"
            "-m32                  force 32 bit bytecode output (use with -o)\n"
-           "-b  --allow-bytecode  allow bytecode in input file\n");
+           "    --compact         compact bytecode output (use with -o)\n"
+           "-b  --allow-bytecode  allow bytecode in input file\n"
+           "    --dump-names      print the names used by the input files\n"
+#ifndef _WIN32
+           "-j  --jobs N          run or compile (with -o DIR) each file in one of\n"
+           "                      N parallel processes (0 = number of CPUs)\n"
+#endif
+           "    --snapshot FILE   restore the context from the snapshot FILE\n"
+           "    --save-snapshot FILE save the context to FILE before exiting\n");
     exit(1);
 }
 
@@ -730,18 +984,24 @@ int main(int argc, const char **argv)
     int interactive = 0;
     const char *expr = NULL;
     const char *out_filename = NULL;
+    char *job_out_filename = NULL;
+    const char *snapshot_filename = NULL;
+    const char *save_snapshot_filename = NULL;
     const char *include_list[32];
     int include_count = 0;
     uint8_t *mem_buf;
     JSContext *ctx;
     int i, parse_flags;
-    BOOL force_32bit, allow_bytecode;
+    BOOL force_32bit, allow_bytecode, names_only, compact;
+    int n_jobs = -1;
     
     mem_size = 16 << 20;
     dump_memory = 0;
     parse_flags = 0;
     force_32bit = FALSE;
+    compact = FALSE;
     allow_bytecode = FALSE;
+    names_only = FALSE;
     
     /* cannot use getopt because we want to pass the command line to
        the script */
@@ -836,20 +1096,64 @@ int main(int argc, const char **argv)
                 include_list[include_count++] = argv[optind++];
                 continue;
             }
+            if (!strcmp(longopt, "profile")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting filename");
+                    exit(1);
+                }
+                profile_filename = argv[optind++];
+                continue;
+            }
+            if (!strcmp(longopt, "snapshot") ||
+                !strcmp(longopt, "save-snapshot")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting filename");
+                    exit(1);
+                }
+                if (!strcmp(longopt, "snapshot"))
+                    snapshot_filename = argv[optind++];
+                else
+                    save_snapshot_filename = argv[optind++];
+                continue;
+            }
             if (!strcmp(longopt, "no-column")) {
                 parse_flags |= JS_EVAL_STRIP_COL;
                 continue;
             }
+            if (!strcmp(longopt, "lazy")) {
+                parse_flags |= JS_EVAL_LAZY;
+                continue;
+            }
             if (opt == 'm' && !strcmp(arg, "32")) {
                 /* XXX: using a long option is not consistent here */
                 force_32bit = TRUE;
                 arg += strlen(arg);
                 continue;
             }
+            if (!strcmp(longopt, "compact")) {
+                compact = TRUE;
+                continue;
+            }
             if (opt == 'b' || !strcmp(longopt, "allow-bytecode")) {
                 allow_bytecode = TRUE;
                 continue;
             }
+            if (!strcmp(longopt, "dump-names")) {
+                names_only = TRUE;
+                continue;
+            }
+#ifndef _WIN32
+            if (opt == 'j' || !strcmp(longopt, "jobs")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting number of jobs");
+                    exit(1);
+                }
+                n_jobs = atoi(argv[optind++]);
+                if (n_jobs <= 0)
+                    n_jobs = sysconf(_SC_NPROCESSORS_ONLN);
+                continue;
+            }
+#endif
             if (opt) {
                 fprintf(stderr, "qjs: unknown option '-%c'\n", opt);
             } else {
@@ -859,17 +1163,74 @@ int main(int argc, const char **argv)
         }
     }
 
+    if (names_only) {
+        if (optind >= argc) {
+            fprintf(stderr, "expecting input filenames\n");
+            exit(1);
+        }
+        return (dump_names(argc - optind, argv + optind, mem_size,
+                           parse_flags, allow_bytecode) != 0);
+    }
+
+#ifndef _WIN32
+    if (n_jobs > 0) {
+        int failed = 0;
+        if (optind >= argc) {
+            fprintf(stderr, "expecting input filenames\n");
+            exit(1);
+        }
+        if (expr || interactive || snapshot_filename || save_snapshot_filename) {
+            fprintf(stderr, "--jobs only runs or compiles files\n");
+            exit(1);
+        }
+        if (out_filename && mkdir(out_filename, 0777) < 0 && errno != EEXIST) {
+            perror(out_filename);
+            exit(1);
+        }
+        i = spawn_jobs(n_jobs, argc - optind, argv + optind, &failed);
+        if (i < 0)
+            return (failed != 0);
+        /* child process: the file is run without arguments */
+        argv[optind] = argv[optind + i];
+        argc = optind + 1;
+        if (out_filename) {
+            job_out_filename = get_job_output_filename(out_filename, argv[optind]);
+            out_filename = job_out_filename;
+        }
+    }
+#endif
+
     if (out_filename) {
         if (optind >= argc) {
             fprintf(stderr, "expecting input filename\n");
             exit(1);
         }
-        compile_file(argv[optind], out_filename, mem_size, dump_memory,
-                     parse_flags, force_32bit);
+        i = compile_file(argv[optind], out_filename, mem_size, dump_memory,
+                         parse_flags, force_32bit, compact);
+        free(job_out_filename);
+        if (i)
+            return 1;
     } else {
         mem_buf = malloc(mem_size);
-        ctx = JS_NewContext(mem_buf, mem_size, &js_stdlib);
+        if (snapshot_filename) {
+            uint8_t *buf;
+            int buf_len;
+            buf = load_file(snapshot_filename, &buf_len);
+            ctx = JS_RestoreSnapshot(mem_buf, mem_size, &js_stdlib, buf, buf_len);
+            free(buf);
+            if (!ctx) {
+                fprintf(stderr, "%s: invalid snapshot\n", snapshot_filename);
+                exit(1);
+            }
+        } else {
+            ctx = JS_NewContext(mem_buf, mem_size, &js_stdlib);
+        }
         JS_SetLogFunc(ctx, js_log_func);
+        JS_SetClockFunc(ctx, js_perf_clock_us);
+        if (profile_filename) {
+            JS_SetInterruptHandler(ctx, js_interrupt_handler);
+            atexit(profile_dump);
+        }
         {
             struct timeval tv;
             gettimeofday(&tv, NULL);
@@ -887,7 +1248,8 @@ int main(int argc, const char **argv)
             if (eval_buf(ctx, expr, "<cmdline>", FALSE, parse_flags | JS_EVAL_REPL))
                 goto fail;
         } else if (optind >= argc) {
-            interactive = 1;
+            if (!save_snapshot_filename)
+                interactive = 1;
         } else {
             if (eval_file(ctx, argv[optind], argc - optind, argv + optind,
                           parse_flags, allow_bytecode)) {
@@ -901,16 +1263,33 @@ int main(int argc, const char **argv)
             run_timers(ctx);
         }
         
+        if (save_snapshot_filename) {
+            FILE *f;
+            f = fopen(save_snapshot_filename, "wb");
+            if (!f) {
+                perror(save_snapshot_filename);
+                goto fail;
+            }
+            if (JS_SaveSnapshot(ctx, write_file_func, f)) {
+                fclose(f);
+                dump_error(ctx);
+                goto fail;
+            }
+            fclose(f);
+        }
+
         if (dump_memory)
             JS_DumpMemory(ctx, (dump_memory >= 2));
         
         JS_FreeContext(ctx);
         free(mem_buf);
+        free_bytecode_bufs();
     }
     return 0;
  fail:
     JS_FreeContext(ctx);
     free(mem_buf);
+    free_bytecode_bufs();
     return 1;
 }
 #endif /* !ESP_PLATFORM */
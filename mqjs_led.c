@@ -7,11 +7,28 @@
  *   led.rgb(r, g, b)  - Set LED color (0-255)
  *   led.on()          - Turn LED on (restores last color)
  *   led.off()         - Turn LED off (remembers color)
+ *   led.strip(count)  - Allocate two frame buffers for a strip of 'count'
+ *                       LEDs, return them as an array of two ArrayBuffers
+ *   led.show(data)    - Send a frame (Uint8Array or ArrayBuffer, 3 bytes
+ *                       per LED in GRB order) to the strip
+ *
+ * A frame stored in one of the led.strip() buffers is transmitted
+ * without copy. Any other frame is copied to the buffer which is not
+ * being transmitted. led.show() only waits for the previous frame, so
+ * the next frame can be prepared in the other buffer during the
+ * transmission. It returns the index of the buffer to fill next.
+ *
+ * C API (e.g. for the FreeButton led.show()):
+ *   mqjs_led_frame_init(gpio)      - Initialize the strip on a GPIO
+ *   mqjs_led_frame_show(grb, len)  - Copy a frame to one of two device
+ *                                    buffers and start sending it
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "mquickjs.h"
+#include "mqjs_led.h"
 
 #ifdef ESP_PLATFORM
 #include "freertos/FreeRTOS.h"
@@ -33,6 +50,11 @@ static rmt_channel_handle_t led_rmt_chan = NULL;
 static rmt_encoder_handle_t led_rmt_encoder = NULL;
 static int led_gpio_pin = -1;
 static uint8_t led_saved_r = 64, led_saved_g = 64, led_saved_b = 64;
+/* number of frames queued and sent (the latter is updated by the RMT
+   interrupt), so that a buffer can be reused as soon as its frame is
+   sent, even if the next frame is still in the queue */
+static uint32_t led_tx_count;
+static uint32_t led_tx_done_count;
 
 /* WS2812 encoder */
 typedef struct {
@@ -86,6 +108,13 @@ static esp_err_t ws2812_delete(rmt_encoder_t *encoder) {
     return ESP_OK;
 }
 
+static bool led_tx_done_cb(rmt_channel_handle_t chan,
+                           const rmt_tx_done_event_data_t *edata, void *user_ctx)
+{
+    __atomic_store_n(&led_tx_done_count, led_tx_done_count + 1, __ATOMIC_RELEASE);
+    return false;
+}
+
 static int led_hw_init(int gpio_pin)
 {
     esp_err_t ret;
@@ -155,7 +184,12 @@ static int led_hw_init(int gpio_pin)
     ws->reset_code = (rmt_symbol_word_t){ .level0 = 0, .duration0 = 280, .level1 = 0, .duration1 = 280 };
     led_rmt_encoder = &ws->base;
     
-    ret = rmt_enable(led_rmt_chan);
+    led_tx_count = 0;
+    led_tx_done_count = 0;
+    rmt_tx_event_callbacks_t cbs = { .on_trans_done = led_tx_done_cb };
+    ret = rmt_tx_register_event_callbacks(led_rmt_chan, &cbs, NULL);
+    if (ret == ESP_OK)
+        ret = rmt_enable(led_rmt_chan);
     if (ret != ESP_OK) {
         led_rmt_encoder->del(led_rmt_encoder);
         led_rmt_encoder = NULL;
@@ -179,10 +213,46 @@ static void led_hw_set(uint8_t r, uint8_t g, uint8_t b)
     /* WS2812 uses GRB order */
     uint8_t grb[3] = { g, r, b };
     rmt_transmit_config_t tx_cfg = { .loop_count = 0 };
-    rmt_transmit(led_rmt_chan, led_rmt_encoder, grb, sizeof(grb), &tx_cfg);
+    if (rmt_transmit(led_rmt_chan, led_rmt_encoder, grb, sizeof(grb), &tx_cfg) == ESP_OK)
+        led_tx_count++;
     rmt_tx_wait_all_done(led_rmt_chan, portMAX_DELAY);
 }
 
+/* wait until the previous frame is sent */
+static void led_hw_wait(void)
+{
+    if (led_rmt_chan)
+        rmt_tx_wait_all_done(led_rmt_chan, portMAX_DELAY);
+}
+
+/* wait until the frame number 'seq' (see led_hw_show()) is sent */
+static void led_hw_wait_frame(uint32_t seq)
+{
+    if (led_rmt_chan &&
+        (int32_t)(__atomic_load_n(&led_tx_done_count, __ATOMIC_ACQUIRE) - seq) < 0) {
+        /* the RMT driver can only wait for the whole queue */
+        rmt_tx_wait_all_done(led_rmt_chan, portMAX_DELAY);
+    }
+}
+
+/* start sending a frame. 'buf' must stay unchanged until
+   led_hw_wait_frame() of the returned frame number returns. Return 0
+   if error. */
+static uint32_t led_hw_show(const uint8_t *buf, size_t len)
+{
+    if (!led_rmt_chan) {
+        ESP_LOGW(TAG, "LED not initialized - call led.init(gpio) first");
+        return 0;
+    }
+    rmt_transmit_config_t tx_cfg = { .loop_count = 0 };
+    if (rmt_transmit(led_rmt_chan, led_rmt_encoder, buf, len, &tx_cfg) != ESP_OK)
+        return 0;
+    /* frame numbers start at 1 */
+    if (++led_tx_count == 0)
+        led_tx_count = 1;
+    return led_tx_count;
+}
+
 #else
 /* Stub for non-ESP builds */
 static int led_gpio_pin = -1;
@@ -201,8 +271,77 @@ static void led_hw_set(uint8_t r, uint8_t g, uint8_t b) {
     }
     printf("[LED] rgb(%d, %d, %d) on GPIO %d\n", r, g, b, led_gpio_pin);
 }
+
+static void led_hw_wait(void) {
+}
+
+static void led_hw_wait_frame(uint32_t seq) {
+}
+
+static uint32_t led_hw_show(const uint8_t *buf, size_t len) {
+    if (led_gpio_pin < 0) {
+        printf("[LED] not initialized - call led.init(gpio) first\n");
+        return 0;
+    }
+    printf("[LED] show(%d LEDs) on GPIO %d\n", (int)(len / 3), led_gpio_pin);
+    return 1;
+}
 #endif
 
+/* LED strip frame buffers. The memory is owned by the two external
+   ArrayBuffers so that it stays valid as long as JS references them. */
+static JSContext *led_strip_ctx;
+static JSGCRef led_strip_refs[2];
+static uint8_t *led_strip_buf[2];
+static size_t led_strip_size; /* bytes per frame */
+static int led_strip_back; /* index of the buffer to fill next */
+static uint32_t led_strip_seq[2]; /* last frame sent from each buffer */
+
+static void led_strip_free(JSContext *ctx, void *opaque, void *ptr)
+{
+    free(ptr);
+}
+
+/* allocate the two frame buffers. Return -1 if exception. */
+static int led_strip_alloc(JSContext *ctx, size_t size)
+{
+    JSValue *pbuf;
+    uint8_t *buf;
+    int i;
+
+    /* the previous buffers may still be transmitted */
+    led_hw_wait();
+    if (led_strip_ctx == ctx) {
+        JS_DeleteGCRef(ctx, &led_strip_refs[1]);
+        JS_DeleteGCRef(ctx, &led_strip_refs[0]);
+    }
+    led_strip_ctx = NULL;
+    for(i = 0; i < 2; i++) {
+        pbuf = JS_AddGCRef(ctx, &led_strip_refs[i]);
+        buf = calloc(1, size);
+        if (!buf) {
+            JS_ThrowOutOfMemory(ctx);
+            goto fail;
+        }
+        *pbuf = JS_NewArrayBufferExternal(ctx, buf, size, led_strip_free, NULL);
+        if (JS_IsException(*pbuf)) {
+            free(buf);
+            goto fail;
+        }
+        led_strip_buf[i] = buf;
+    }
+    led_strip_ctx = ctx;
+    led_strip_size = size;
+    led_strip_back = 0;
+    led_strip_seq[0] = led_strip_seq[1] = 0;
+    return 0;
+ fail:
+    /* the buffer of a created ArrayBuffer is freed by the GC */
+    while (i >= 0)
+        JS_DeleteGCRef(ctx, &led_strip_refs[i--]);
+    return -1;
+}
+
 /*
  * JavaScript bindings
  */
@@ -219,14 +358,10 @@ JSValue js_led_init(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
     return JS_UNDEFINED;
 }
 
-/* led.rgb(r, g, b) - Set LED color */
-JSValue js_led_rgb(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+/* led.rgb(r, g, b) - Set LED color. Typed signature (v_iii): the
+   arguments are converted to int32 by the interpreter */
+void js_led_rgb(int r, int g, int b)
 {
-    int r = 255, g = 255, b = 255;
-    if (argc >= 1) JS_ToInt32(ctx, &r, argv[0]);
-    if (argc >= 2) JS_ToInt32(ctx, &g, argv[1]);
-    if (argc >= 3) JS_ToInt32(ctx, &b, argv[2]);
-    
     /* Clamp to 0-255 */
     r = (r < 0) ? 0 : (r > 255) ? 255 : r;
     g = (g < 0) ? 0 : (g > 255) ? 255 : g;
@@ -234,7 +369,6 @@ JSValue js_led_rgb(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
     
     led_saved_r = r; led_saved_g = g; led_saved_b = b;
     led_hw_set(r, g, b);
-    return JS_UNDEFINED;
 }
 
 /* led.on() - Turn LED on with saved color */
@@ -251,3 +385,128 @@ JSValue js_led_off(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
     return JS_UNDEFINED;
 }
 
+/* led.strip(count) - Allocate the frame buffers for 'count' LEDs */
+JSValue js_led_strip(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    JSValue arr;
+    int count, i;
+
+    if (JS_ToInt32(ctx, &count, argv[0]))
+        return JS_EXCEPTION;
+    if (count <= 0 || count > 4096)
+        return JS_ThrowRangeError(ctx, "invalid LED count");
+    if (led_strip_alloc(ctx, count * 3))
+        return JS_EXCEPTION;
+    arr = JS_NewArray(ctx, 2);
+    if (JS_IsException(arr))
+        return arr;
+    for(i = 0; i < 2; i++)
+        JS_SetPropertyUint32(ctx, arr, i, led_strip_refs[i].val);
+    return arr;
+}
+
+/* led.show(data) - Send a frame, return the index of the next buffer */
+JSValue js_led_show(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    uint8_t *data;
+    size_t len;
+    uint32_t seq;
+    int i;
+
+    data = JS_GetTypedArray(ctx, &len, argv[0], JS_CLASS_UINT8_ARRAY);
+    if (!data)
+        data = JS_GetTypedArray(ctx, &len, argv[0], JS_CLASS_UINT8C_ARRAY);
+    if (!data)
+        data = JS_GetArrayBuffer(ctx, &len, argv[0]);
+    if (!data)
+        return JS_ThrowTypeError(ctx, "expecting a Uint8Array");
+    len -= len % 3;
+    if (len == 0)
+        return JS_ThrowRangeError(ctx, "empty frame");
+
+    if (led_strip_ctx != ctx || len > led_strip_size) {
+        /* implicit strip allocation, 'data' may move */
+        if (led_strip_alloc(ctx, len))
+            return JS_EXCEPTION;
+        data = JS_GetTypedArray(ctx, &len, argv[0], JS_CLASS_UINT8_ARRAY);
+        if (!data)
+            data = JS_GetTypedArray(ctx, &len, argv[0], JS_CLASS_UINT8C_ARRAY);
+        if (!data)
+            data = JS_GetArrayBuffer(ctx, &len, argv[0]);
+        len -= len % 3;
+    }
+
+    for(i = 0; i < 2; i++) {
+        if (data >= led_strip_buf[i] &&
+            data + len <= led_strip_buf[i] + led_strip_size)
+            break;
+    }
+    if (i == 2) {
+        /* the JS heap may be compacted during the transmission */
+        i = led_strip_back;
+        led_hw_wait_frame(led_strip_seq[i]);
+        memcpy(led_strip_buf[i], data, len);
+        data = led_strip_buf[i];
+    } else {
+        /* the previous frame must be sent before its buffer is reused */
+        led_hw_wait_frame(led_strip_seq[i]);
+    }
+    seq = led_hw_show(data, len);
+    if (!seq)
+        return JS_ThrowInternalError(ctx, "failed to send the LED frame");
+    led_strip_seq[i] = seq;
+    led_strip_back = 1 - i;
+    return JS_NewInt32(ctx, led_strip_back);
+}
+
+/*
+ * C API
+ */
+
+/* device side frame buffers of mqjs_led_frame_show() */
+static uint8_t *led_frame_buf[2];
+static uint32_t led_frame_seq[2];
+static size_t led_frame_size;
+static int led_frame_back;
+
+/* Initialize the strip on 'gpio_pin'. Return -1 if error. */
+int mqjs_led_frame_init(int gpio_pin)
+{
+    led_hw_wait();
+    led_frame_seq[0] = led_frame_seq[1] = 0;
+    return led_hw_init(gpio_pin);
+}
+
+/* Send a frame of 'len' bytes (3 bytes per LED in GRB order) to the
+   strip. 'grb' is copied, so it can be modified as soon as the
+   function returns. Only the transmission of the previous frame from
+   the same device buffer is waited for. Return -1 if error. */
+int mqjs_led_frame_show(const uint8_t *grb, size_t len)
+{
+    uint8_t *buf;
+    uint32_t seq;
+    int i;
+
+    len -= len % 3;
+    if (len == 0)
+        return 0;
+    if (len > led_frame_size) {
+        led_hw_wait();
+        for(i = 0; i < 2; i++) {
+            buf = realloc(led_frame_buf[i], len);
+            if (!buf)
+                return -1;
+            led_frame_buf[i] = buf;
+        }
+        led_frame_size = len;
+    }
+    i = led_frame_back;
+    led_hw_wait_frame(led_frame_seq[i]);
+    memcpy(led_frame_buf[i], grb, len);
+    seq = led_hw_show(led_frame_buf[i], len);
+    if (!seq)
+        return -1;
+    led_frame_seq[i] = seq;
+    led_frame_back = 1 - i;
+    return 0;
+}
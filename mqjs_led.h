@@ -9,9 +9,15 @@
 
 /* JavaScript binding functions */
 JSValue js_led_init(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
-JSValue js_led_rgb(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+void js_led_rgb(int r, int g, int b);
 JSValue js_led_on(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_led_off(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_led_strip(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_led_show(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+
+/* C API: double buffered frame output through the WS2812 RMT encoder */
+int mqjs_led_frame_init(int gpio_pin);
+int mqjs_led_frame_show(const uint8_t *grb, size_t len);
 
 #endif /* MQJS_LED_H */
 
@@ -0,0 +1,195 @@
+/*
+ * MicroQuickJS performance helpers
+ * performance.memory / heap profiler bindings shared by mqjs and the firmware
+ *
+ * JavaScript API:
+ *   performance.memory()            - Heap and GC statistics as an object
+ *   performance.resetMemory()       - Reset the peak and GC statistics
+ *   performance.heapProfile(enable[, buf_size])
+ *                                   - Start or stop the allocation profiler
+ *   performance.heapReport([max_sites])
+ *                                   - Heap profile report as a string
+ *
+ * The GC pause statistics are only collected if the embedder installs
+ * js_perf_clock_us() (or another clock) with JS_SetClockFunc().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <sys/time.h>
+#include "cutils.h"
+#include "mquickjs.h"
+#include "mqjs_perf.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#endif
+
+int64_t js_perf_clock_us(JSContext *ctx, void *opaque)
+{
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+/* heap and GC statistics since the start or the last
+   performance.resetMemory() */
+JSValue js_performance_memory(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    static const char * const names[] = {
+        "heapSize", "heapSizeMax", "stackSizeMax", "freeSizeMin",
+        "gcCount", "gcMinorCount", "gcReclaimed", "gcPauseTotal",
+        "gcPauseMax",
+    };
+    JSMemoryStats stats;
+    int64_t tab[countof(names)];
+    JSGCRef obj_ref;
+    JSValue *pobj, val, ret;
+    int i;
+
+    JS_GetMemoryStats(ctx, &stats);
+    tab[0] = stats.heap_size;
+    tab[1] = stats.heap_size_max;
+    tab[2] = stats.stack_size_max;
+    tab[3] = stats.free_size_min;
+    tab[4] = stats.gc.count;
+    tab[5] = stats.gc.minor_count;
+    tab[6] = stats.gc.reclaimed_total;
+    tab[7] = stats.gc.pause_total;
+    tab[8] = stats.gc.pause_max;
+
+    pobj = JS_PushGCRef(ctx, &obj_ref);
+    ret = JS_EXCEPTION;
+    *pobj = JS_NewObject(ctx);
+    if (JS_IsException(*pobj))
+        goto done;
+    for(i = 0; i < countof(names); i++) {
+        val = JS_NewInt64(ctx, tab[i]);
+        if (JS_IsException(val) ||
+            JS_IsException(JS_SetPropertyStr(ctx, *pobj, names[i], val)))
+            goto done;
+    }
+    ret = *pobj;
+ done:
+    JS_PopGCRef(ctx, &obj_ref);
+    return ret;
+}
+
+JSValue js_performance_resetMemory(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    JS_ResetMemoryStats(ctx);
+    return JS_UNDEFINED;
+}
+
+#ifndef MQJS_HEAP_PROFILE_SIZE
+#define MQJS_HEAP_PROFILE_SIZE (16 * 1024)
+#endif
+
+/* heap profiler buffers (main context and worker) */
+static struct {
+    JSContext *ctx;
+    void *buf;
+} js_heap_profile_bufs[2];
+
+/* performance.heapProfile(enable[, buf_size]): start or stop
+   recording the allocation sites */
+JSValue js_performance_heapProfile(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    int i, enable, buf_size;
+    void *buf;
+
+    if (JS_ToInt32Sat(ctx, &enable, argv[0]))
+        return JS_EXCEPTION;
+    buf_size = MQJS_HEAP_PROFILE_SIZE;
+    if (argc > 1 && !JS_IsUndefined(argv[1])) {
+        if (JS_ToInt32Sat(ctx, &buf_size, argv[1]))
+            return JS_EXCEPTION;
+        if (buf_size <= 0)
+            return JS_ThrowRangeError(ctx, "invalid buffer size");
+    }
+    JS_EnableHeapProfile(ctx, NULL, 0);
+    for(i = 0; i < countof(js_heap_profile_bufs); i++) {
+        if (js_heap_profile_bufs[i].ctx == ctx) {
+            free(js_heap_profile_bufs[i].buf);
+            js_heap_profile_bufs[i].ctx = NULL;
+            js_heap_profile_bufs[i].buf = NULL;
+        }
+    }
+    if (!enable)
+        return JS_UNDEFINED;
+    for(i = 0; i < countof(js_heap_profile_bufs); i++) {
+        if (!js_heap_profile_bufs[i].ctx)
+            break;
+    }
+    if (i == countof(js_heap_profile_bufs))
+        return JS_ThrowInternalError(ctx, "too many heap profiles");
+    buf = malloc(buf_size);
+    if (!buf)
+        return JS_ThrowOutOfMemory(ctx);
+    if (JS_EnableHeapProfile(ctx, buf, buf_size)) {
+        free(buf);
+        return JS_ThrowInternalError(ctx, "heap profiler not available or buffer too small");
+    }
+    js_heap_profile_bufs[i].ctx = ctx;
+    js_heap_profile_bufs[i].buf = buf;
+    return JS_UNDEFINED;
+}
+
+typedef struct {
+    char *buf;
+    size_t len;
+    size_t size;
+    BOOL out_of_memory;
+} ReportBuf;
+
+static void report_buf_write(void *opaque, const void *data, size_t len)
+{
+    ReportBuf *rb = opaque;
+    size_t new_size;
+    char *new_buf;
+
+    if (rb->out_of_memory)
+        return;
+    if (rb->len + len > rb->size) {
+        new_size = max_size_t(rb->len + len, rb->size * 3 / 2 + 256);
+        new_buf = realloc(rb->buf, new_size);
+        if (!new_buf) {
+            rb->out_of_memory = TRUE;
+            return;
+        }
+        rb->buf = new_buf;
+        rb->size = new_size;
+    }
+    memcpy(rb->buf + rb->len, data, len);
+    rb->len += len;
+}
+
+/* performance.heapReport([max_sites]): return the heap profile
+   report as a string, e.g. to print or publish it */
+JSValue js_performance_heapReport(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    ReportBuf rb;
+    JSValue ret;
+    int max_sites;
+
+    max_sites = 10;
+    if (argc > 0 && !JS_IsUndefined(argv[0])) {
+        if (JS_ToInt32Sat(ctx, &max_sites, argv[0]))
+            return JS_EXCEPTION;
+    }
+    memset(&rb, 0, sizeof(rb));
+    JS_DumpHeapProfile(ctx, max_sites, report_buf_write, &rb);
+    if (rb.out_of_memory) {
+        free(rb.buf);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    ret = JS_NewStringLen(ctx, rb.buf ? rb.buf : "", rb.len);
+    free(rb.buf);
+    return ret;
+}
@@ -0,0 +1,19 @@
+/*
+ * MicroQuickJS performance helpers
+ * performance.memory / heap profiler bindings shared by mqjs and the firmware
+ */
+#ifndef MQJS_PERF_H
+#define MQJS_PERF_H
+
+#include "mquickjs.h"
+
+/* clock for JS_SetClockFunc() used to measure the GC pauses */
+int64_t js_perf_clock_us(JSContext *ctx, void *opaque);
+
+/* JavaScript binding functions */
+JSValue js_performance_memory(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_performance_resetMemory(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_performance_heapProfile(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_performance_heapReport(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+
+#endif /* MQJS_PERF_H */
@@ -212,19 +212,24 @@ static const JSPropDef js_math[] = {
     JS_CFUNC_SPECIAL_DEF("asin", 1, f_f, js_asin ),
     JS_CFUNC_SPECIAL_DEF("acos", 1, f_f, js_acos ),
     JS_CFUNC_SPECIAL_DEF("atan", 1, f_f, js_atan ),
-    JS_CFUNC_DEF("atan2", 2, js_math_atan2 ),
+    JS_CFUNC_SPECIAL_DEF("atan2", 2, f_ff, js_atan2 ),
     JS_CFUNC_SPECIAL_DEF("exp", 1, f_f, js_exp ),
     JS_CFUNC_SPECIAL_DEF("log", 1, f_f, js_log ),
-    JS_CFUNC_DEF("pow", 2, js_math_pow ),
+    JS_CFUNC_SPECIAL_DEF("pow", 2, f_ff, js_pow ),
     JS_CFUNC_DEF("random", 0, js_math_random ),
 
     /* some ES6 functions */
-    JS_CFUNC_DEF("imul", 2, js_math_imul ),
+    JS_CFUNC_SPECIAL_DEF("imul", 2, i_ii, js_math_imul ),
     JS_CFUNC_DEF("clz32", 1, js_math_clz32 ),
     JS_CFUNC_SPECIAL_DEF("fround", 1, f_f, js_math_fround ),
     JS_CFUNC_SPECIAL_DEF("trunc", 1, f_f, js_trunc ),
     JS_CFUNC_SPECIAL_DEF("log2", 1, f_f, js_log2 ),
     JS_CFUNC_SPECIAL_DEF("log10", 1, f_f, js_log10 ),
+
+    /* non-standard integer and fixed point helpers */
+    JS_CFUNC_SPECIAL_DEF("idiv", 2, i_ii, js_math_idiv ),
+    JS_CFUNC_SPECIAL_DEF("fxmul", 3, i_iii, js_math_fxmul ),
+    JS_CFUNC_SPECIAL_DEF("fxdiv", 3, i_iii, js_math_fxdiv ),
     
     JS_PROP_END,
 };
@@ -232,6 +237,15 @@ static const JSPropDef js_math[] = {
 static const JSClassDef js_math_obj =
     JS_OBJECT_DEF("Math", js_math);
 
+static const JSPropDef js_json_parser_proto[] = {
+    JS_CFUNC_DEF("write", 1, js_json_parser_write_chunk ),
+    JS_CFUNC_DEF("end", 0, js_json_parser_end_input ),
+    JS_PROP_END,
+};
+
+static const JSClassDef js_json_parser_class =
+    JS_CLASS_DEF("JSONParser", 2, js_json_parser_constructor, JS_CLASS_JSON_PARSER, NULL, js_json_parser_proto, NULL, NULL);
+
 static const JSPropDef js_json[] = {
     JS_CFUNC_DEF("parse", 2, js_json_parse ),
     JS_CFUNC_DEF("stringify", 3, js_json_stringify ),
@@ -259,6 +273,16 @@ static const JSPropDef js_typed_array_base_proto[] = {
     JS_CFUNC_DEF("toString", 0, js_array_toString ),
     JS_CFUNC_DEF("subarray", 2, js_typed_array_subarray ),
     JS_CFUNC_DEF("set", 1, js_typed_array_set ),
+    JS_CFUNC_DEF("fill", 1, js_typed_array_fill ),
+    JS_CFUNC_DEF("copyWithin", 2, js_typed_array_copyWithin ),
+    JS_CFUNC_MAGIC_DEF("indexOf", 1, js_typed_array_indexOf, 0 ),
+    JS_CFUNC_MAGIC_DEF("lastIndexOf", 1, js_typed_array_indexOf, 1 ),
+    JS_CFUNC_DEF("slice", 2, js_typed_array_slice ),
+    /* non standard */
+    JS_CFUNC_DEF("sum", 0, js_typed_array_sum ),
+    JS_CFUNC_MAGIC_DEF("min", 0, js_typed_array_min_max, 0 ),
+    JS_CFUNC_MAGIC_DEF("max", 0, js_typed_array_min_max, 1 ),
+    JS_CFUNC_DEF("dot", 1, js_typed_array_dot ),
     JS_PROP_END,
 };
 
@@ -287,6 +311,28 @@ TA_DEF(Uint32Array, JS_CLASS_UINT32_ARRAY, 4)
 TA_DEF(Float32Array, JS_CLASS_FLOAT32_ARRAY, 4)
 TA_DEF(Float64Array, JS_CLASS_FLOAT64_ARRAY, 8)
 
+#define DV_DEF(name, class_name)\
+    JS_CFUNC_MAGIC_DEF("get" #name, 1, js_dataview_getValue, class_name ),\
+    JS_CFUNC_MAGIC_DEF("set" #name, 2, js_dataview_setValue, class_name )
+
+static const JSPropDef js_dataview_proto[] = {
+    JS_CGETSET_MAGIC_DEF("byteLength", js_dataview_get_length, NULL, 0 ),
+    JS_CGETSET_MAGIC_DEF("byteOffset", js_dataview_get_length, NULL, 1 ),
+    JS_CGETSET_MAGIC_DEF("buffer", js_dataview_get_length, NULL, 2 ),
+    DV_DEF(Int8, JS_CLASS_INT8_ARRAY),
+    DV_DEF(Uint8, JS_CLASS_UINT8_ARRAY),
+    DV_DEF(Int16, JS_CLASS_INT16_ARRAY),
+    DV_DEF(Uint16, JS_CLASS_UINT16_ARRAY),
+    DV_DEF(Int32, JS_CLASS_INT32_ARRAY),
+    DV_DEF(Uint32, JS_CLASS_UINT32_ARRAY),
+    DV_DEF(Float32, JS_CLASS_FLOAT32_ARRAY),
+    DV_DEF(Float64, JS_CLASS_FLOAT64_ARRAY),
+    JS_PROP_END,
+};
+
+static const JSClassDef js_dataview_class =
+    JS_CLASS_DEF("DataView", 3, js_dataview_constructor, JS_CLASS_DATA_VIEW, NULL, js_dataview_proto, NULL, NULL);
+
 /* regexp */
 
 static const JSPropDef js_regexp_proto[] = {
@@ -321,6 +367,12 @@ static const JSClassDef js_console_obj =
 
 static const JSPropDef js_performance[] = {
     JS_CFUNC_DEF("now", 0, js_performance_now),
+#ifndef CONFIG_CLASS_EXAMPLE
+    JS_CFUNC_DEF("memory", 0, js_performance_memory),
+    JS_CFUNC_DEF("resetMemory", 0, js_performance_resetMemory),
+    JS_CFUNC_DEF("heapProfile", 1, js_performance_heapProfile),
+    JS_CFUNC_DEF("heapReport", 0, js_performance_heapReport),
+#endif
     JS_PROP_END,
 };
 static const JSClassDef js_performance_obj =
@@ -330,9 +382,11 @@ static const JSClassDef js_performance_obj =
 /* LED control for ESP32 - init(gpio) sets pin, rgb() sets color, on()/off() control state */
 static const JSPropDef js_led[] = {
     JS_CFUNC_DEF("init", 1, js_led_init),
-    JS_CFUNC_DEF("rgb", 3, js_led_rgb),
+    JS_CFUNC_SPECIAL_DEF("rgb", 3, v_iii, js_led_rgb),
     JS_CFUNC_DEF("on", 0, js_led_on),
     JS_CFUNC_DEF("off", 0, js_led_off),
+    JS_CFUNC_DEF("strip", 1, js_led_strip),
+    JS_CFUNC_DEF("show", 1, js_led_show),
     JS_PROP_END,
 };
 static const JSClassDef js_led_obj =
@@ -349,6 +403,7 @@ static const JSPropDef js_global_object[] = {
     JS_PROP_CLASS_DEF("Math", &js_math_obj),
     JS_PROP_CLASS_DEF("Date", &js_date_class),
     JS_PROP_CLASS_DEF("JSON", &js_json_obj),
+    JS_PROP_CLASS_DEF("JSONParser", &js_json_parser_class),
     JS_PROP_CLASS_DEF("RegExp", &js_regexp_class),
 
     JS_PROP_CLASS_DEF("Error", &js_error_class),
@@ -370,6 +425,7 @@ static const JSPropDef js_global_object[] = {
     JS_PROP_CLASS_DEF("Uint32Array", &js_Uint32Array_class),
     JS_PROP_CLASS_DEF("Float32Array", &js_Float32Array_class),
     JS_PROP_CLASS_DEF("Float64Array", &js_Float64Array_class),
+    JS_PROP_CLASS_DEF("DataView", &js_dataview_class),
 
     JS_CFUNC_DEF("parseInt", 2, js_number_parseInt ),
     JS_CFUNC_DEF("parseFloat", 1, js_number_parseFloat ),
@@ -407,10 +463,19 @@ static const JSPropDef js_global_object[] = {
 #else
     JS_CFUNC_DEF("gc", 0, js_gc),
     JS_CFUNC_DEF("load", 1, js_load),
+#ifdef CONFIG_READ_FILE
+    JS_CFUNC_DEF("readFile", 1, js_readFile),
+#endif
     JS_CFUNC_DEF("loadMapped", 3, js_loadMapped),
     JS_CFUNC_DEF("loadUserBytecode", 1, js_loadUserBytecode),
     JS_CFUNC_DEF("setTimeout", 2, js_setTimeout),
     JS_CFUNC_DEF("clearTimeout", 1, js_clearTimeout),
+    JS_CFUNC_DEF("setInterval", 2, js_setInterval),
+    JS_CFUNC_DEF("clearInterval", 1, js_clearTimeout),
+#ifdef CONFIG_WORKER
+    JS_CFUNC_DEF("startWorker", 1, js_startWorker),
+    JS_CFUNC_DEF("postMessage", 1, js_postMessage),
+#endif
 #endif
     JS_PROP_END,
 };
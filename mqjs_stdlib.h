@@ -0,0 +1,3295 @@
+/* this file is automatically generated - do not edit */
+
+#include "mquickjs_priv.h"
+
+static const uint64_t __attribute((aligned(64))) js_stdlib_table[] = {
+  /* atom_table */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "null" (offset=0) */
+  0x000000006c6c756e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "false" (offset=2) */
+  0x00000065736c6166,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "true" (offset=4) */
+  0x0000000065757274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "if" (offset=6) */
+  0x0000000000006669,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "else" (offset=8) */
+  0x0000000065736c65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "return" (offset=10) */
+  0x00006e7275746572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "var" (offset=12) */
+  0x0000000000726176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "this" (offset=14) */
+  0x0000000073696874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "delete" (offset=16) */
+  0x00006574656c6564,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "void" (offset=18) */
+  0x0000000064696f76,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "typeof" (offset=20) */
+  0x0000666f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "new" (offset=22) */
+  0x000000000077656e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "in" (offset=24) */
+  0x0000000000006e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "instanceof" (offset=26) */
+  0x65636e6174736e69,
+  0x000000000000666f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "do" (offset=29) */
+  0x0000000000006f64,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "while" (offset=31) */
+  0x000000656c696877,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "for" (offset=33) */
+  0x0000000000726f66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "break" (offset=35) */
+  0x0000006b61657262,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "continue" (offset=37) */
+  0x65756e69746e6f63,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "switch" (offset=40) */
+  0x0000686374697773,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "case" (offset=42) */
+  0x0000000065736163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "default" (offset=44) */
+  0x00746c7561666564,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "throw" (offset=46) */
+  0x000000776f726874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "try" (offset=48) */
+  0x0000000000797274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "catch" (offset=50) */
+  0x0000006863746163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "finally" (offset=52) */
+  0x00796c6c616e6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "function" (offset=54) */
+  0x6e6f6974636e7566,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "debugger" (offset=57) */
+  0x7265676775626564,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "with" (offset=60) */
+  0x0000000068746977,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "class" (offset=62) */
+  0x0000007373616c63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "const" (offset=64) */
+  0x00000074736e6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "enum" (offset=66) */
+  0x000000006d756e65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "export" (offset=68) */
+  0x000074726f707865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "extends" (offset=70) */
+  0x0073646e65747865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "import" (offset=72) */
+  0x000074726f706d69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "super" (offset=74) */
+  0x0000007265707573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "implements" (offset=76) */
+  0x6e656d656c706d69,
+  0x0000000000007374,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "interface" (offset=79) */
+  0x6361667265746e69,
+  0x0000000000000065,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "let" (offset=82) */
+  0x000000000074656c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "package" (offset=84) */
+  0x006567616b636170,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "private" (offset=86) */
+  0x0065746176697270,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "protected" (offset=88) */
+  0x65746365746f7270,
+  0x0000000000000064,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "public" (offset=91) */
+  0x000063696c627570,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "static" (offset=93) */
+  0x0000636974617473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "yield" (offset=95) */
+  0x000000646c656979,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (0 << (JS_MTAG_BITS + 3)), /* "" (offset=97) */
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "toString" (offset=99) */
+  0x676e697274536f74,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "valueOf" (offset=102) */
+  0x00664f65756c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "number" (offset=104) */
+  0x00007265626d756e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "object" (offset=106) */
+  0x00007463656a626f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "undefined" (offset=108) */
+  0x656e696665646e75,
+  0x0000000000000064,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "string" (offset=111) */
+  0x0000676e69727473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "boolean" (offset=113) */
+  0x006e61656c6f6f62,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "<ret>" (offset=115) */
+  0x0000003e7465723c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "<eval>" (offset=117) */
+  0x00003e6c6176653c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "eval" (offset=119) */
+  0x000000006c617665,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "arguments" (offset=121) */
+  0x746e656d75677261,
+  0x0000000000000073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "value" (offset=124) */
+  0x00000065756c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "get" (offset=126) */
+  0x0000000000746567,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "set" (offset=128) */
+  0x0000000000746573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "prototype" (offset=130) */
+  0x7079746f746f7270,
+  0x0000000000000065,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "constructor" (offset=133) */
+  0x63757274736e6f63,
+  0x0000000000726f74,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "length" (offset=136) */
+  0x00006874676e656c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "target" (offset=138) */
+  0x0000746567726174,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "of" (offset=140) */
+  0x000000000000666f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "NaN" (offset=142) */
+  0x00000000004e614e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "Infinity" (offset=144) */
+  0x7974696e69666e49,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "-Infinity" (offset=147) */
+  0x74696e69666e492d,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "name" (offset=150) */
+  0x00000000656d616e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "Error" (offset=152) */
+  0x000000726f727245,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "__proto__" (offset=154) */
+  0x5f6f746f72705f5f,
+  0x000000000000005f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "index" (offset=157) */
+  0x0000007865646e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "input" (offset=159) */
+  0x0000007475706e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "bound" (offset=161) */
+  0x000000646e756f62,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "Object" (offset=163) */
+  0x00007463656a624f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "defineProperty" (offset=165) */
+  0x7250656e69666564,
+  0x000079747265706f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "getPrototypeOf" (offset=168) */
+  0x6f746f7250746567,
+  0x0000664f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "setPrototypeOf" (offset=171) */
+  0x6f746f7250746573,
+  0x0000664f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "create" (offset=174) */
+  0x0000657461657263,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "keys" (offset=176) */
+  0x000000007379656b,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "hasOwnProperty" (offset=178) */
+  0x72506e774f736168,
+  0x000079747265706f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "Function" (offset=181) */
+  0x6e6f6974636e7546,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "get prototype" (offset=184) */
+  0x746f727020746567,
+  0x000000657079746f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "set prototype" (offset=187) */
+  0x746f727020746573,
+  0x000000657079746f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "call" (offset=190) */
+  0x000000006c6c6163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "apply" (offset=192) */
+  0x000000796c707061,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "bind" (offset=194) */
+  0x00000000646e6962,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get length" (offset=196) */
+  0x676e656c20746567,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "get name" (offset=199) */
+  0x656d616e20746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "Number" (offset=202) */
+  0x00007265626d754e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "parseInt" (offset=204) */
+  0x746e496573726170,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "parseFloat" (offset=207) */
+  0x6f6c466573726170,
+  0x0000000000007461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "MAX_VALUE" (offset=210) */
+  0x554c41565f58414d,
+  0x0000000000000045,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "MIN_VALUE" (offset=213) */
+  0x554c41565f4e494d,
+  0x0000000000000045,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "NEGATIVE_INFINITY" (offset=216) */
+  0x455649544147454e,
+  0x54494e49464e495f,
+  0x0000000000000059,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "POSITIVE_INFINITY" (offset=220) */
+  0x4556495449534f50,
+  0x54494e49464e495f,
+  0x0000000000000059,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "EPSILON" (offset=224) */
+  0x004e4f4c49535045,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (16 << (JS_MTAG_BITS + 3)), /* "MAX_SAFE_INTEGER" (offset=226) */
+  0x454641535f58414d,
+  0x52454745544e495f,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (16 << (JS_MTAG_BITS + 3)), /* "MIN_SAFE_INTEGER" (offset=230) */
+  0x454641535f4e494d,
+  0x52454745544e495f,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "toExponential" (offset=234) */
+  0x656e6f7078456f74,
+  0x0000006c6169746e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "toFixed" (offset=237) */
+  0x0064657869466f74,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toPrecision" (offset=239) */
+  0x7369636572506f74,
+  0x00000000006e6f69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "Boolean" (offset=242) */
+  0x006e61656c6f6f42,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "String" (offset=244) */
+  0x0000676e69727453,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "fromCharCode" (offset=246) */
+  0x726168436d6f7266,
+  0x0000000065646f43,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "fromCodePoint" (offset=249) */
+  0x65646f436d6f7266,
+  0x000000746e696f50,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "set length" (offset=252) */
+  0x676e656c20746573,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "charAt" (offset=255) */
+  0x0000744172616863,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "charCodeAt" (offset=257) */
+  0x65646f4372616863,
+  0x0000000000007441,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "codePointAt" (offset=260) */
+  0x6e696f5065646f63,
+  0x0000000000744174,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "slice" (offset=263) */
+  0x0000006563696c73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "substring" (offset=265) */
+  0x6e69727473627573,
+  0x0000000000000067,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "concat" (offset=268) */
+  0x00007461636e6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "indexOf" (offset=270) */
+  0x00664f7865646e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "lastIndexOf" (offset=272) */
+  0x65646e497473616c,
+  0x0000000000664f78,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "match" (offset=275) */
+  0x000000686374616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "replace" (offset=277) */
+  0x006563616c706572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "replaceAll" (offset=279) */
+  0x416563616c706572,
+  0x0000000000006c6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "search" (offset=282) */
+  0x0000686372616573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "split" (offset=284) */
+  0x00000074696c7073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toLowerCase" (offset=286) */
+  0x437265776f4c6f74,
+  0x0000000000657361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toUpperCase" (offset=289) */
+  0x4372657070556f74,
+  0x0000000000657361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "trim" (offset=292) */
+  0x000000006d697274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "trimEnd" (offset=294) */
+  0x00646e456d697274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "trimStart" (offset=296) */
+  0x726174536d697274,
+  0x0000000000000074,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "repeat" (offset=299) */
+  0x0000746165706572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "Array" (offset=301) */
+  0x0000007961727241,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "isArray" (offset=303) */
+  0x0079617272417369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "push" (offset=305) */
+  0x0000000068737570,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pop" (offset=307) */
+  0x0000000000706f70,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "join" (offset=309) */
+  0x000000006e696f6a,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "reverse" (offset=311) */
+  0x0065737265766572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "shift" (offset=313) */
+  0x0000007466696873,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "splice" (offset=315) */
+  0x00006563696c7073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "unshift" (offset=317) */
+  0x0074666968736e75,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "every" (offset=319) */
+  0x0000007972657665,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "some" (offset=321) */
+  0x00000000656d6f73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "forEach" (offset=323) */
+  0x0068636145726f66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "map" (offset=325) */
+  0x000000000070616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "filter" (offset=327) */
+  0x00007265746c6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "reduce" (offset=329) */
+  0x0000656375646572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "reduceRight" (offset=331) */
+  0x6952656375646572,
+  0x0000000000746867,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sort" (offset=334) */
+  0x0000000074726f73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Math" (offset=336) */
+  0x000000006874614d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "min" (offset=338) */
+  0x00000000006e696d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "max" (offset=340) */
+  0x000000000078616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sign" (offset=342) */
+  0x000000006e676973,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "abs" (offset=344) */
+  0x0000000000736261,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "floor" (offset=346) */
+  0x000000726f6f6c66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "ceil" (offset=348) */
+  0x000000006c696563,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "round" (offset=350) */
+  0x000000646e756f72,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sqrt" (offset=352) */
+  0x0000000074727173,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (1 << (JS_MTAG_BITS + 3)), /* "E" (offset=354) */
+  0x0000000000000045,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "LN10" (offset=356) */
+  0x0000000030314e4c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "LN2" (offset=358) */
+  0x0000000000324e4c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "LOG2E" (offset=360) */
+  0x0000004532474f4c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "LOG10E" (offset=362) */
+  0x0000453031474f4c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "PI" (offset=364) */
+  0x0000000000004950,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "SQRT1_2" (offset=366) */
+  0x00325f3154525153,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "SQRT2" (offset=368) */
+  0x0000003254525153,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "sin" (offset=370) */
+  0x00000000006e6973,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "cos" (offset=372) */
+  0x0000000000736f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "tan" (offset=374) */
+  0x00000000006e6174,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "asin" (offset=376) */
+  0x000000006e697361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "acos" (offset=378) */
+  0x00000000736f6361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "atan" (offset=380) */
+  0x000000006e617461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "atan2" (offset=382) */
+  0x000000326e617461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "exp" (offset=384) */
+  0x0000000000707865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "log" (offset=386) */
+  0x0000000000676f6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pow" (offset=388) */
+  0x0000000000776f70,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "random" (offset=390) */
+  0x00006d6f646e6172,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "imul" (offset=392) */
+  0x000000006c756d69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "clz32" (offset=394) */
+  0x00000032337a6c63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "fround" (offset=396) */
+  0x0000646e756f7266,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "trunc" (offset=398) */
+  0x000000636e757274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "log2" (offset=400) */
+  0x0000000032676f6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "log10" (offset=402) */
+  0x0000003031676f6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "idiv" (offset=404) */
+  0x0000000076696469,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "fxmul" (offset=406) */
+  0x0000006c756d7866,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "fxdiv" (offset=408) */
+  0x0000007669647866,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Date" (offset=410) */
+  0x0000000065746144,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "now" (offset=412) */
+  0x0000000000776f6e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "JSON" (offset=414) */
+  0x000000004e4f534a,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "parse" (offset=416) */
+  0x0000006573726170,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "stringify" (offset=418) */
+  0x6669676e69727473,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "JSONParser" (offset=421) */
+  0x737261504e4f534a,
+  0x0000000000007265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "write" (offset=424) */
+  0x0000006574697277,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "end" (offset=426) */
+  0x0000000000646e65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "RegExp" (offset=428) */
+  0x0000707845676552,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "lastIndex" (offset=430) */
+  0x65646e497473616c,
+  0x0000000000000078,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "get lastIndex" (offset=433) */
+  0x7473616c20746567,
+  0x0000007865646e49,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "set lastIndex" (offset=436) */
+  0x7473616c20746573,
+  0x0000007865646e49,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "source" (offset=439) */
+  0x0000656372756f73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get source" (offset=441) */
+  0x72756f7320746567,
+  0x0000000000006563,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "flags" (offset=444) */
+  0x0000007367616c66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get flags" (offset=446) */
+  0x67616c6620746567,
+  0x0000000000000073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "exec" (offset=449) */
+  0x0000000063657865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "test" (offset=451) */
+  0x0000000074736574,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "message" (offset=453) */
+  0x006567617373656d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "get message" (offset=455) */
+  0x7373656d20746567,
+  0x0000000000656761,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "stack" (offset=458) */
+  0x0000006b63617473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get stack" (offset=460) */
+  0x6361747320746567,
+  0x000000000000006b,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "EvalError" (offset=463) */
+  0x6f7272456c617645,
+  0x0000000000000072,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "RangeError" (offset=466) */
+  0x72724565676e6152,
+  0x000000000000726f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "ReferenceError" (offset=469) */
+  0x636e657265666552,
+  0x0000726f72724565,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "SyntaxError" (offset=472) */
+  0x72457861746e7953,
+  0x0000000000726f72,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "TypeError" (offset=475) */
+  0x6f72724565707954,
+  0x0000000000000072,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "URIError" (offset=478) */
+  0x726f727245495255,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "InternalError" (offset=481) */
+  0x6c616e7265746e49,
+  0x000000726f727245,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "ArrayBuffer" (offset=484) */
+  0x6675427961727241,
+  0x0000000000726566,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteLength" (offset=487) */
+  0x676e654c65747962,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteLength" (offset=490) */
+  0x6574796220746567,
+  0x00006874676e654c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "Uint8ClampedArray" (offset=493) */
+  0x616c4338746e6955,
+  0x617272416465706d,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "TypedArray" (offset=497) */
+  0x7272416465707954,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteOffset" (offset=500) */
+  0x7366664f65747962,
+  0x0000000000007465,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteOffset" (offset=503) */
+  0x6574796220746567,
+  0x000074657366664f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "buffer" (offset=506) */
+  0x0000726566667562,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get buffer" (offset=508) */
+  0x6666756220746567,
+  0x0000000000007265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "subarray" (offset=511) */
+  0x7961727261627573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "fill" (offset=514) */
+  0x000000006c6c6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "copyWithin" (offset=516) */
+  0x6874695779706f63,
+  0x0000000000006e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "sum" (offset=519) */
+  0x00000000006d7573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "dot" (offset=521) */
+  0x0000000000746f64,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "BYTES_PER_ELEMENT" (offset=523) */
+  0x45505f5345545942,
+  0x4e454d454c455f52,
+  0x0000000000000054,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "Int8Array" (offset=527) */
+  0x6172724138746e49,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Uint8Array" (offset=530) */
+  0x72724138746e6955,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int16Array" (offset=533) */
+  0x7272413631746e49,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint16Array" (offset=536) */
+  0x72413631746e6955,
+  0x0000000000796172,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int32Array" (offset=539) */
+  0x7272413233746e49,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint32Array" (offset=542) */
+  0x72413233746e6955,
+  0x0000000000796172,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float32Array" (offset=545) */
+  0x41323374616f6c46,
+  0x0000000079617272,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float64Array" (offset=548) */
+  0x41343674616f6c46,
+  0x0000000079617272,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "DataView" (offset=551) */
+  0x7765695661746144,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "getInt8" (offset=554) */
+  0x0038746e49746567,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "setInt8" (offset=556) */
+  0x0038746e49746573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getUint8" (offset=558) */
+  0x38746e6955746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setUint8" (offset=561) */
+  0x38746e6955746573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getInt16" (offset=564) */
+  0x3631746e49746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setInt16" (offset=567) */
+  0x3631746e49746573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "getUint16" (offset=570) */
+  0x31746e6955746567,
+  0x0000000000000036,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "setUint16" (offset=573) */
+  0x31746e6955746573,
+  0x0000000000000036,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getInt32" (offset=576) */
+  0x3233746e49746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setInt32" (offset=579) */
+  0x3233746e49746573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "getUint32" (offset=582) */
+  0x33746e6955746567,
+  0x0000000000000032,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "setUint32" (offset=585) */
+  0x33746e6955746573,
+  0x0000000000000032,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getFloat32" (offset=588) */
+  0x74616f6c46746567,
+  0x0000000000003233,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setFloat32" (offset=591) */
+  0x74616f6c46746573,
+  0x0000000000003233,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getFloat64" (offset=594) */
+  0x74616f6c46746567,
+  0x0000000000003436,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setFloat64" (offset=597) */
+  0x74616f6c46746573,
+  0x0000000000003436,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "isNaN" (offset=600) */
+  0x0000004e614e7369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "isFinite" (offset=602) */
+  0x6574696e69467369,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "globalThis" (offset=605) */
+  0x68546c61626f6c67,
+  0x0000000000007369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "console" (offset=608) */
+  0x00656c6f736e6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "performance" (offset=610) */
+  0x616d726f66726570,
+  0x000000000065636e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "memory" (offset=613) */
+  0x000079726f6d656d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "resetMemory" (offset=615) */
+  0x6d654d7465736572,
+  0x000000000079726f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "heapProfile" (offset=618) */
+  0x666f725070616568,
+  0x0000000000656c69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "heapReport" (offset=621) */
+  0x6f70655270616568,
+  0x0000000000007472,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "led" (offset=624) */
+  0x000000000064656c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "init" (offset=626) */
+  0x0000000074696e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "rgb" (offset=628) */
+  0x0000000000626772,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "on" (offset=630) */
+  0x0000000000006e6f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "off" (offset=632) */
+  0x000000000066666f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "strip" (offset=634) */
+  0x0000007069727473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "show" (offset=636) */
+  0x00000000776f6873,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "print" (offset=638) */
+  0x000000746e697270,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "gc" (offset=640) */
+  0x0000000000006367,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "load" (offset=642) */
+  0x0000000064616f6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "readFile" (offset=644) */
+  0x656c694664616572,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "loadMapped" (offset=647) */
+  0x7070614d64616f6c,
+  0x0000000000006465,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (16 << (JS_MTAG_BITS + 3)), /* "loadUserBytecode" (offset=650) */
+  0x7265735564616f6c,
+  0x65646f6365747942,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setTimeout" (offset=654) */
+  0x6f656d6954746573,
+  0x0000000000007475,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "clearTimeout" (offset=657) */
+  0x6d69547261656c63,
+  0x0000000074756f65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "setInterval" (offset=660) */
+  0x7265746e49746573,
+  0x00000000006c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "clearInterval" (offset=663) */
+  0x746e497261656c63,
+  0x0000006c61767265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "startWorker" (offset=666) */
+  0x726f577472617473,
+  0x000000000072656b,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "postMessage" (offset=669) */
+  0x7373654d74736f70,
+  0x0000000000656761,
+
+  /* sorted atom table (offset=672) */
+  JS_VALUE_ARRAY_HEADER(277),
+  JS_ROM_VALUE(97), /* empty */
+  JS_ROM_VALUE(147), /* _Infinity */
+  JS_ROM_VALUE(117), /* _eval_ */
+  JS_ROM_VALUE(115), /* _ret_ */
+  JS_ROM_VALUE(301), /* Array */
+  JS_ROM_VALUE(484), /* ArrayBuffer */
+  JS_ROM_VALUE(523), /* BYTES_PER_ELEMENT */
+  JS_ROM_VALUE(242), /* Boolean */
+  JS_ROM_VALUE(551), /* DataView */
+  JS_ROM_VALUE(410), /* Date */
+  JS_ROM_VALUE(354), /* E */
+  JS_ROM_VALUE(224), /* EPSILON */
+  JS_ROM_VALUE(152), /* Error */
+  JS_ROM_VALUE(463), /* EvalError */
+  JS_ROM_VALUE(545), /* Float32Array */
+  JS_ROM_VALUE(548), /* Float64Array */
+  JS_ROM_VALUE(181), /* Function */
+  JS_ROM_VALUE(144), /* Infinity */
+  JS_ROM_VALUE(533), /* Int16Array */
+  JS_ROM_VALUE(539), /* Int32Array */
+  JS_ROM_VALUE(527), /* Int8Array */
+  JS_ROM_VALUE(481), /* InternalError */
+  JS_ROM_VALUE(414), /* JSON */
+  JS_ROM_VALUE(421), /* JSONParser */
+  JS_ROM_VALUE(356), /* LN10 */
+  JS_ROM_VALUE(358), /* LN2 */
+  JS_ROM_VALUE(362), /* LOG10E */
+  JS_ROM_VALUE(360), /* LOG2E */
+  JS_ROM_VALUE(226), /* MAX_SAFE_INTEGER */
+  JS_ROM_VALUE(210), /* MAX_VALUE */
+  JS_ROM_VALUE(230), /* MIN_SAFE_INTEGER */
+  JS_ROM_VALUE(213), /* MIN_VALUE */
+  JS_ROM_VALUE(336), /* Math */
+  JS_ROM_VALUE(216), /* NEGATIVE_INFINITY */
+  JS_ROM_VALUE(142), /* NaN */
+  JS_ROM_VALUE(202), /* Number */
+  JS_ROM_VALUE(163), /* Object */
+  JS_ROM_VALUE(364), /* PI */
+  JS_ROM_VALUE(220), /* POSITIVE_INFINITY */
+  JS_ROM_VALUE(466), /* RangeError */
+  JS_ROM_VALUE(469), /* ReferenceError */
+  JS_ROM_VALUE(428), /* RegExp */
+  JS_ROM_VALUE(366), /* SQRT1_2 */
+  JS_ROM_VALUE(368), /* SQRT2 */
+  JS_ROM_VALUE(244), /* String */
+  JS_ROM_VALUE(472), /* SyntaxError */
+  JS_ROM_VALUE(475), /* TypeError */
+  JS_ROM_VALUE(497), /* TypedArray */
+  JS_ROM_VALUE(478), /* URIError */
+  JS_ROM_VALUE(536), /* Uint16Array */
+  JS_ROM_VALUE(542), /* Uint32Array */
+  JS_ROM_VALUE(530), /* Uint8Array */
+  JS_ROM_VALUE(493), /* Uint8ClampedArray */
+  JS_ROM_VALUE(154), /* __proto__ */
+  JS_ROM_VALUE(344), /* abs */
+  JS_ROM_VALUE(378), /* acos */
+  JS_ROM_VALUE(192), /* apply */
+  JS_ROM_VALUE(121), /* arguments */
+  JS_ROM_VALUE(376), /* asin */
+  JS_ROM_VALUE(380), /* atan */
+  JS_ROM_VALUE(382), /* atan2 */
+  JS_ROM_VALUE(194), /* bind */
+  JS_ROM_VALUE(113), /* boolean */
+  JS_ROM_VALUE(161), /* bound */
+  JS_ROM_VALUE(35), /* break */
+  JS_ROM_VALUE(506), /* buffer */
+  JS_ROM_VALUE(487), /* byteLength */
+  JS_ROM_VALUE(500), /* byteOffset */
+  JS_ROM_VALUE(190), /* call */
+  JS_ROM_VALUE(42), /* case */
+  JS_ROM_VALUE(50), /* catch */
+  JS_ROM_VALUE(348), /* ceil */
+  JS_ROM_VALUE(255), /* charAt */
+  JS_ROM_VALUE(257), /* charCodeAt */
+  JS_ROM_VALUE(62), /* class */
+  JS_ROM_VALUE(663), /* clearInterval */
+  JS_ROM_VALUE(657), /* clearTimeout */
+  JS_ROM_VALUE(394), /* clz32 */
+  JS_ROM_VALUE(260), /* codePointAt */
+  JS_ROM_VALUE(268), /* concat */
+  JS_ROM_VALUE(608), /* console */
+  JS_ROM_VALUE(64), /* const */
+  JS_ROM_VALUE(133), /* constructor */
+  JS_ROM_VALUE(37), /* continue */
+  JS_ROM_VALUE(516), /* copyWithin */
+  JS_ROM_VALUE(372), /* cos */
+  JS_ROM_VALUE(174), /* create */
+  JS_ROM_VALUE(57), /* debugger */
+  JS_ROM_VALUE(44), /* default */
+  JS_ROM_VALUE(165), /* defineProperty */
+  JS_ROM_VALUE(16), /* delete */
+  JS_ROM_VALUE(29), /* do */
+  JS_ROM_VALUE(521), /* dot */
+  JS_ROM_VALUE(8), /* else */
+  JS_ROM_VALUE(426), /* end */
+  JS_ROM_VALUE(66), /* enum */
+  JS_ROM_VALUE(119), /* eval */
+  JS_ROM_VALUE(319), /* every */
+  JS_ROM_VALUE(449), /* exec */
+  JS_ROM_VALUE(384), /* exp */
+  JS_ROM_VALUE(68), /* export */
+  JS_ROM_VALUE(70), /* extends */
+  JS_ROM_VALUE(2), /* false */
+  JS_ROM_VALUE(514), /* fill */
+  JS_ROM_VALUE(327), /* filter */
+  JS_ROM_VALUE(52), /* finally */
+  JS_ROM_VALUE(444), /* flags */
+  JS_ROM_VALUE(346), /* floor */
+  JS_ROM_VALUE(33), /* for */
+  JS_ROM_VALUE(323), /* forEach */
+  JS_ROM_VALUE(246), /* fromCharCode */
+  JS_ROM_VALUE(249), /* fromCodePoint */
+  JS_ROM_VALUE(396), /* fround */
+  JS_ROM_VALUE(54), /* function */
+  JS_ROM_VALUE(408), /* fxdiv */
+  JS_ROM_VALUE(406), /* fxmul */
+  JS_ROM_VALUE(640), /* gc */
+  JS_ROM_VALUE(126), /* get */
+  JS_ROM_VALUE(508), /* get buffer */
+  JS_ROM_VALUE(490), /* get byteLength */
+  JS_ROM_VALUE(503), /* get byteOffset */
+  JS_ROM_VALUE(446), /* get flags */
+  JS_ROM_VALUE(433), /* get lastIndex */
+  JS_ROM_VALUE(196), /* get length */
+  JS_ROM_VALUE(455), /* get message */
+  JS_ROM_VALUE(199), /* get name */
+  JS_ROM_VALUE(184), /* get prototype */
+  JS_ROM_VALUE(441), /* get source */
+  JS_ROM_VALUE(460), /* get stack */
+  JS_ROM_VALUE(588), /* getFloat32 */
+  JS_ROM_VALUE(594), /* getFloat64 */
+  JS_ROM_VALUE(564), /* getInt16 */
+  JS_ROM_VALUE(576), /* getInt32 */
+  JS_ROM_VALUE(554), /* getInt8 */
+  JS_ROM_VALUE(168), /* getPrototypeOf */
+  JS_ROM_VALUE(570), /* getUint16 */
+  JS_ROM_VALUE(582), /* getUint32 */
+  JS_ROM_VALUE(558), /* getUint8 */
+  JS_ROM_VALUE(605), /* globalThis */
+  JS_ROM_VALUE(178), /* hasOwnProperty */
+  JS_ROM_VALUE(618), /* heapProfile */
+  JS_ROM_VALUE(621), /* heapReport */
+  JS_ROM_VALUE(404), /* idiv */
+  JS_ROM_VALUE(6), /* if */
+  JS_ROM_VALUE(76), /* implements */
+  JS_ROM_VALUE(72), /* import */
+  JS_ROM_VALUE(392), /* imul */
+  JS_ROM_VALUE(24), /* in */
+  JS_ROM_VALUE(157), /* index */
+  JS_ROM_VALUE(270), /* indexOf */
+  JS_ROM_VALUE(626), /* init */
+  JS_ROM_VALUE(159), /* input */
+  JS_ROM_VALUE(26), /* instanceof */
+  JS_ROM_VALUE(79), /* interface */
+  JS_ROM_VALUE(303), /* isArray */
+  JS_ROM_VALUE(602), /* isFinite */
+  JS_ROM_VALUE(600), /* isNaN */
+  JS_ROM_VALUE(309), /* join */
+  JS_ROM_VALUE(176), /* keys */
+  JS_ROM_VALUE(430), /* lastIndex */
+  JS_ROM_VALUE(272), /* lastIndexOf */
+  JS_ROM_VALUE(624), /* led */
+  JS_ROM_VALUE(136), /* length */
+  JS_ROM_VALUE(82), /* let */
+  JS_ROM_VALUE(642), /* load */
+  JS_ROM_VALUE(647), /* loadMapped */
+  JS_ROM_VALUE(650), /* loadUserBytecode */
+  JS_ROM_VALUE(386), /* log */
+  JS_ROM_VALUE(402), /* log10 */
+  JS_ROM_VALUE(400), /* log2 */
+  JS_ROM_VALUE(325), /* map */
+  JS_ROM_VALUE(275), /* match */
+  JS_ROM_VALUE(340), /* max */
+  JS_ROM_VALUE(613), /* memory */
+  JS_ROM_VALUE(453), /* message */
+  JS_ROM_VALUE(338), /* min */
+  JS_ROM_VALUE(150), /* name */
+  JS_ROM_VALUE(22), /* new */
+  JS_ROM_VALUE(412), /* now */
+  JS_ROM_VALUE(0), /* null */
+  JS_ROM_VALUE(104), /* number */
+  JS_ROM_VALUE(106), /* object */
+  JS_ROM_VALUE(140), /* of */
+  JS_ROM_VALUE(632), /* off */
+  JS_ROM_VALUE(630), /* on */
+  JS_ROM_VALUE(84), /* package */
+  JS_ROM_VALUE(416), /* parse */
+  JS_ROM_VALUE(207), /* parseFloat */
+  JS_ROM_VALUE(204), /* parseInt */
+  JS_ROM_VALUE(610), /* performance */
+  JS_ROM_VALUE(307), /* pop */
+  JS_ROM_VALUE(669), /* postMessage */
+  JS_ROM_VALUE(388), /* pow */
+  JS_ROM_VALUE(638), /* print */
+  JS_ROM_VALUE(86), /* private */
+  JS_ROM_VALUE(88), /* protected */
+  JS_ROM_VALUE(130), /* prototype */
+  JS_ROM_VALUE(91), /* public */
+  JS_ROM_VALUE(305), /* push */
+  JS_ROM_VALUE(390), /* random */
+  JS_ROM_VALUE(644), /* readFile */
+  JS_ROM_VALUE(329), /* reduce */
+  JS_ROM_VALUE(331), /* reduceRight */
+  JS_ROM_VALUE(299), /* repeat */
+  JS_ROM_VALUE(277), /* replace */
+  JS_ROM_VALUE(279), /* replaceAll */
+  JS_ROM_VALUE(615), /* resetMemory */
+  JS_ROM_VALUE(10), /* return */
+  JS_ROM_VALUE(311), /* reverse */
+  JS_ROM_VALUE(628), /* rgb */
+  JS_ROM_VALUE(350), /* round */
+  JS_ROM_VALUE(282), /* search */
+  JS_ROM_VALUE(128), /* set */
+  JS_ROM_VALUE(436), /* set lastIndex */
+  JS_ROM_VALUE(252), /* set length */
+  JS_ROM_VALUE(187), /* set prototype */
+  JS_ROM_VALUE(591), /* setFloat32 */
+  JS_ROM_VALUE(597), /* setFloat64 */
+  JS_ROM_VALUE(567), /* setInt16 */
+  JS_ROM_VALUE(579), /* setInt32 */
+  JS_ROM_VALUE(556), /* setInt8 */
+  JS_ROM_VALUE(660), /* setInterval */
+  JS_ROM_VALUE(171), /* setPrototypeOf */
+  JS_ROM_VALUE(654), /* setTimeout */
+  JS_ROM_VALUE(573), /* setUint16 */
+  JS_ROM_VALUE(585), /* setUint32 */
+  JS_ROM_VALUE(561), /* setUint8 */
+  JS_ROM_VALUE(313), /* shift */
+  JS_ROM_VALUE(636), /* show */
+  JS_ROM_VALUE(342), /* sign */
+  JS_ROM_VALUE(370), /* sin */
+  JS_ROM_VALUE(263), /* slice */
+  JS_ROM_VALUE(321), /* some */
+  JS_ROM_VALUE(334), /* sort */
+  JS_ROM_VALUE(439), /* source */
+  JS_ROM_VALUE(315), /* splice */
+  JS_ROM_VALUE(284), /* split */
+  JS_ROM_VALUE(352), /* sqrt */
+  JS_ROM_VALUE(458), /* stack */
+  JS_ROM_VALUE(666), /* startWorker */
+  JS_ROM_VALUE(93), /* static */
+  JS_ROM_VALUE(111), /* string */
+  JS_ROM_VALUE(418), /* stringify */
+  JS_ROM_VALUE(634), /* strip */
+  JS_ROM_VALUE(511), /* subarray */
+  JS_ROM_VALUE(265), /* substring */
+  JS_ROM_VALUE(519), /* sum */
+  JS_ROM_VALUE(74), /* super */
+  JS_ROM_VALUE(40), /* switch */
+  JS_ROM_VALUE(374), /* tan */
+  JS_ROM_VALUE(138), /* target */
+  JS_ROM_VALUE(451), /* test */
+  JS_ROM_VALUE(14), /* this */
+  JS_ROM_VALUE(46), /* throw */
+  JS_ROM_VALUE(234), /* toExponential */
+  JS_ROM_VALUE(237), /* toFixed */
+  JS_ROM_VALUE(286), /* toLowerCase */
+  JS_ROM_VALUE(239), /* toPrecision */
+  JS_ROM_VALUE(99), /* toString */
+  JS_ROM_VALUE(289), /* toUpperCase */
+  JS_ROM_VALUE(292), /* trim */
+  JS_ROM_VALUE(294), /* trimEnd */
+  JS_ROM_VALUE(296), /* trimStart */
+  JS_ROM_VALUE(4), /* true */
+  JS_ROM_VALUE(398), /* trunc */
+  JS_ROM_VALUE(48), /* try */
+  JS_ROM_VALUE(20), /* typeof */
+  JS_ROM_VALUE(108), /* undefined */
+  JS_ROM_VALUE(317), /* unshift */
+  JS_ROM_VALUE(124), /* value */
+  JS_ROM_VALUE(102), /* valueOf */
+  JS_ROM_VALUE(12), /* var */
+  JS_ROM_VALUE(18), /* void */
+  JS_ROM_VALUE(31), /* while */
+  JS_ROM_VALUE(60), /* with */
+  JS_ROM_VALUE(424), /* write */
+  JS_ROM_VALUE(95), /* yield */
+
+  /* properties (offset=950) */
+  JS_VALUE_ARRAY_HEADER(24),
+  6 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  6 << 1,
+  18 << 1,
+  12 << 1,
+  21 << 1,
+  JS_ROM_VALUE(165) /* defineProperty */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 2),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(168) /* getPrototypeOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 3),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(171) /* setPrototypeOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 4),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(174) /* create */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 5),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(176) /* keys */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 6),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_OBJECT << 1,
+  (15 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=975) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  4 << 1,
+  JS_ROM_VALUE(178) /* hasOwnProperty */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 7),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 8),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_OBJECT - 1) << 1,
+  (7 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=989) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(950),
+  1,
+  JS_ROM_VALUE(975),
+  JS_NULL,
+
+  /* properties (offset=994) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_CLOSURE << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1001) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 10),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 11),
+
+  /* getset (offset=1004) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 12),
+  JS_UNDEFINED,
+
+  /* getset (offset=1007) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 13),
+  JS_UNDEFINED,
+
+  /* properties (offset=1010) */
+  JS_VALUE_ARRAY_HEADER(30),
+  8 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  27 << 1,
+  21 << 1,
+  18 << 1,
+  24 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_ROM_VALUE(1001),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(190) /* call */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 14),
+  (6 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(192) /* apply */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 15),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(194) /* bind */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 16),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 17),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1004),
+  (12 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(1007),
+  (15 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_CLOSURE - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1041) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(994),
+  9,
+  JS_ROM_VALUE(1010),
+  JS_NULL,
+
+  /* float64 (offset=1046) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7fefffffffffffff,
+
+  /* float64 (offset=1048) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x0000000000000001,
+
+  /* float64 (offset=1050) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff8000000000000,
+
+  /* float64 (offset=1052) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0xfff0000000000000,
+
+  /* float64 (offset=1054) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff0000000000000,
+
+  /* float64 (offset=1056) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3cb0000000000000,
+
+  /* float64 (offset=1058) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x433fffffffffffff,
+
+  /* float64 (offset=1060) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0xc33fffffffffffff,
+
+  /* properties (offset=1062) */
+  JS_VALUE_ARRAY_HEADER(43),
+  11 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  0 << 1,
+  31 << 1,
+  0 << 1,
+  40 << 1,
+  19 << 1,
+  28 << 1,
+  13 << 1,
+  37 << 1,
+  JS_ROM_VALUE(204) /* parseInt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 19),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(207) /* parseFloat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 20),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(210) /* MAX_VALUE */,
+  JS_ROM_VALUE(1046),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(213) /* MIN_VALUE */,
+  JS_ROM_VALUE(1048),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(142) /* NaN */,
+  JS_ROM_VALUE(1050),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(216) /* NEGATIVE_INFINITY */,
+  JS_ROM_VALUE(1052),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(220) /* POSITIVE_INFINITY */,
+  JS_ROM_VALUE(1054),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(224) /* EPSILON */,
+  JS_ROM_VALUE(1056),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(226) /* MAX_SAFE_INTEGER */,
+  JS_ROM_VALUE(1058),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(230) /* MIN_SAFE_INTEGER */,
+  JS_ROM_VALUE(1060),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_NUMBER << 1,
+  (34 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1106) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  18 << 1,
+  0 << 1,
+  15 << 1,
+  6 << 1,
+  JS_ROM_VALUE(234) /* toExponential */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 21),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(237) /* toFixed */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 22),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(239) /* toPrecision */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 23),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 24),
+  (12 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_NUMBER - 1) << 1,
+  (9 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1128) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1062),
+  18,
+  JS_ROM_VALUE(1106),
+  JS_NULL,
+
+  /* properties (offset=1133) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_BOOLEAN << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1140) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_BOOLEAN - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1147) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1133),
+  25,
+  JS_ROM_VALUE(1140),
+  JS_NULL,
+
+  /* properties (offset=1152) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  7 << 1,
+  10 << 1,
+  JS_ROM_VALUE(246) /* fromCharCode */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 27),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(249) /* fromCodePoint */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 28),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_STRING << 1,
+  (4 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1166) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 29),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 30),
+
+  /* properties (offset=1169) */
+  JS_VALUE_ARRAY_HEADER(76),
+  22 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  55 << 1,
+  64 << 1,
+  70 << 1,
+  46 << 1,
+  73 << 1,
+  58 << 1,
+  43 << 1,
+  61 << 1,
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1166),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(255) /* charAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 31),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(257) /* charCodeAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 32),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(260) /* codePointAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 33),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(263) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 34),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(265) /* substring */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 35),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(268) /* concat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 36),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(270) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 37),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(272) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 38),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(275) /* match */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 39),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(277) /* replace */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 40),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(279) /* replaceAll */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 41),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(282) /* search */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 42),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(284) /* split */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 43),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(286) /* toLowerCase */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 44),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(289) /* toUpperCase */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 45),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(292) /* trim */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 46),
+  (49 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(294) /* trimEnd */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 47),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(296) /* trimStart */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 48),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 49),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(299) /* repeat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 50),
+  (67 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_STRING - 1) << 1,
+  (40 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1246) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1152),
+  26,
+  JS_ROM_VALUE(1169),
+  JS_NULL,
+
+  /* properties (offset=1251) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(303) /* isArray */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 52),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1261) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 53),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 54),
+
+  /* properties (offset=1264) */
+  JS_VALUE_ARRAY_HEADER(79),
+  23 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  70 << 1,
+  46 << 1,
+  67 << 1,
+  0 << 1,
+  76 << 1,
+  10 << 1,
+  61 << 1,
+  73 << 1,
+  JS_ROM_VALUE(268) /* concat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 55),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1261),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(305) /* push */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 56),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(307) /* pop */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 57),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(309) /* join */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 58),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 59),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(311) /* reverse */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 60),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(313) /* shift */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 61),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(263) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 62),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(315) /* splice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 63),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(317) /* unshift */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 64),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(270) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 65),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(272) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 66),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(319) /* every */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 67),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(321) /* some */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 68),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(323) /* forEach */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 69),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(325) /* map */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 70),
+  (40 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(327) /* filter */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 71),
+  (49 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(329) /* reduce */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 72),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(331) /* reduceRight */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 73),
+  (55 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(329) /* reduce */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 72),
+  (64 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(334) /* sort */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 74),
+  (43 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ARRAY - 1) << 1,
+  (58 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1344) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1251),
+  51,
+  JS_ROM_VALUE(1264),
+  JS_NULL,
+
+  /* float64 (offset=1349) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x4005bf0a8b145769,
+
+  /* float64 (offset=1351) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x40026bb1bbb55516,
+
+  /* float64 (offset=1353) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3fe62e42fefa39ef,
+
+  /* float64 (offset=1355) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3ff71547652b82fe,
+
+  /* float64 (offset=1357) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3fdbcb7b1526e50e,
+
+  /* float64 (offset=1359) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x400921fb54442d18,
+
+  /* float64 (offset=1361) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3fe6a09e667f3bcd,
+
+  /* float64 (offset=1363) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x3ff6a09e667f3bcd,
+
+  /* properties (offset=1365) */
+  JS_VALUE_ARRAY_HEADER(118),
+  36 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  0 << 1,
+  115 << 1,
+  0 << 1,
+  106 << 1,
+  34 << 1,
+  109 << 1,
+  0 << 1,
+  112 << 1,
+  JS_ROM_VALUE(338) /* min */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 75),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(340) /* max */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 76),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(342) /* sign */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 77),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(344) /* abs */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 78),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(346) /* floor */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 79),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(348) /* ceil */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 80),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(350) /* round */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 81),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(352) /* sqrt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 82),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_STRING_CHAR, 69) /* E */,
+  JS_ROM_VALUE(1349),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(356) /* LN10 */,
+  JS_ROM_VALUE(1351),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(358) /* LN2 */,
+  JS_ROM_VALUE(1353),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(360) /* LOG2E */,
+  JS_ROM_VALUE(1355),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(362) /* LOG10E */,
+  JS_ROM_VALUE(1357),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(364) /* PI */,
+  JS_ROM_VALUE(1359),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(366) /* SQRT1_2 */,
+  JS_ROM_VALUE(1361),
+  (40 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(368) /* SQRT2 */,
+  JS_ROM_VALUE(1363),
+  (43 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(370) /* sin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 83),
+  (46 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(372) /* cos */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 84),
+  (49 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(374) /* tan */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 85),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(376) /* asin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 86),
+  (55 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(378) /* acos */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 87),
+  (58 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(380) /* atan */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 88),
+  (61 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(382) /* atan2 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 89),
+  (64 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(384) /* exp */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 90),
+  (67 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(386) /* log */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 91),
+  (70 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(388) /* pow */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 92),
+  (73 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(390) /* random */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 93),
+  (76 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(392) /* imul */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 94),
+  (79 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(394) /* clz32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 95),
+  (82 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(396) /* fround */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 96),
+  (85 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(398) /* trunc */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 97),
+  (88 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(400) /* log2 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 98),
+  (91 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(402) /* log10 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 99),
+  (94 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(404) /* idiv */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 100),
+  (97 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(406) /* fxmul */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 101),
+  (100 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(408) /* fxdiv */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 102),
+  (103 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=1484) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1365),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=1489) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(412) /* now */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 104),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_DATE << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1499) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_DATE - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1506) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1489),
+  103,
+  JS_ROM_VALUE(1499),
+  JS_NULL,
+
+  /* properties (offset=1511) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(416) /* parse */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 105),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(418) /* stringify */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 106),
+  (3 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=1521) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1511),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=1526) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_JSON_PARSER << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1533) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  7 << 1,
+  JS_ROM_VALUE(424) /* write */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 108),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(426) /* end */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 109),
+  (4 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_JSON_PARSER - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1547) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1526),
+  107,
+  JS_ROM_VALUE(1533),
+  JS_NULL,
+
+  /* properties (offset=1552) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_REGEXP << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1559) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 111),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 112),
+
+  /* getset (offset=1562) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 113),
+  JS_UNDEFINED,
+
+  /* getset (offset=1565) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 114),
+  JS_UNDEFINED,
+
+  /* properties (offset=1568) */
+  JS_VALUE_ARRAY_HEADER(24),
+  6 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  21 << 1,
+  12 << 1,
+  18 << 1,
+  6 << 1,
+  JS_ROM_VALUE(430) /* lastIndex */,
+  JS_ROM_VALUE(1559),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(439) /* source */,
+  JS_ROM_VALUE(1562),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(444) /* flags */,
+  JS_ROM_VALUE(1565),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(449) /* exec */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 115),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(451) /* test */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 116),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_REGEXP - 1) << 1,
+  (15 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1593) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1552),
+  110,
+  JS_ROM_VALUE(1568),
+  JS_NULL,
+
+  /* properties (offset=1598) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1605) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 118),
+  JS_UNDEFINED,
+
+  /* getset (offset=1608) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 119),
+  JS_UNDEFINED,
+
+  /* properties (offset=1611) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  18 << 1,
+  0 << 1,
+  6 << 1,
+  15 << 1,
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 120),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(152) /* Error */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(453) /* message */,
+  JS_ROM_VALUE(1605),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(458) /* stack */,
+  JS_ROM_VALUE(1608),
+  (9 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ERROR - 1) << 1,
+  (12 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1633) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1598),
+  117,
+  JS_ROM_VALUE(1611),
+  JS_NULL,
+
+  /* properties (offset=1638) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_EVAL_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1645) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(463) /* EvalError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_EVAL_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1655) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1638),
+  121,
+  JS_ROM_VALUE(1645),
+  JS_ROM_VALUE(1633),
+
+  /* properties (offset=1660) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_RANGE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1667) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(466) /* RangeError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_RANGE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1677) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1660),
+  122,
+  JS_ROM_VALUE(1667),
+  JS_ROM_VALUE(1633),
+
+  /* properties (offset=1682) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_REFERENCE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1689) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(469) /* ReferenceError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_REFERENCE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1699) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1682),
+  123,
+  JS_ROM_VALUE(1689),
+  JS_ROM_VALUE(1633),
+
+  /* properties (offset=1704) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_SYNTAX_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1711) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(472) /* SyntaxError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_SYNTAX_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1721) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1704),
+  124,
+  JS_ROM_VALUE(1711),
+  JS_ROM_VALUE(1633),
+
+  /* properties (offset=1726) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_TYPE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1733) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(475) /* TypeError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_TYPE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1743) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1726),
+  125,
+  JS_ROM_VALUE(1733),
+  JS_ROM_VALUE(1633),
+
+  /* properties (offset=1748) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_URI_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1755) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(478) /* URIError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_URI_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1765) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1748),
+  126,
+  JS_ROM_VALUE(1755),
+  JS_ROM_VALUE(1633),
+
+  /* properties (offset=1770) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INTERNAL_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1777) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(481) /* InternalError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INTERNAL_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1787) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1770),
+  127,
+  JS_ROM_VALUE(1777),
+  JS_ROM_VALUE(1633),
+
+  /* properties (offset=1792) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ARRAY_BUFFER << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1799) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 129),
+  JS_UNDEFINED,
+
+  /* properties (offset=1802) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(487) /* byteLength */,
+  JS_ROM_VALUE(1799),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ARRAY_BUFFER - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1812) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1792),
+  128,
+  JS_ROM_VALUE(1802),
+  JS_NULL,
+
+  /* properties (offset=1817) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_TYPED_ARRAY << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1824) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 131),
+  JS_UNDEFINED,
+
+  /* getset (offset=1827) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 132),
+  JS_UNDEFINED,
+
+  /* getset (offset=1830) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 133),
+  JS_UNDEFINED,
+
+  /* getset (offset=1833) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 134),
+  JS_UNDEFINED,
+
+  /* properties (offset=1836) */
+  JS_VALUE_ARRAY_HEADER(64),
+  18 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  58 << 1,
+  43 << 1,
+  25 << 1,
+  52 << 1,
+  61 << 1,
+  55 << 1,
+  49 << 1,
+  40 << 1,
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1824),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(487) /* byteLength */,
+  JS_ROM_VALUE(1827),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(500) /* byteOffset */,
+  JS_ROM_VALUE(1830),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(506) /* buffer */,
+  JS_ROM_VALUE(1833),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(309) /* join */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 58),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 59),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(511) /* subarray */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 135),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(128) /* set */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 136),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(514) /* fill */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 137),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(516) /* copyWithin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 138),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(270) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 139),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(272) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 140),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(263) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 141),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(519) /* sum */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 142),
+  (46 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(338) /* min */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 143),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(340) /* max */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 144),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(521) /* dot */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 145),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_TYPED_ARRAY - 1) << 1,
+  (22 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1901) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1817),
+  130,
+  JS_ROM_VALUE(1836),
+  JS_NULL,
+
+  /* properties (offset=1906) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT8C_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1916) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT8C_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1926) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1906),
+  146,
+  JS_ROM_VALUE(1916),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=1931) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT8_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1941) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT8_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1951) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1931),
+  147,
+  JS_ROM_VALUE(1941),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=1956) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT8_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1966) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT8_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1976) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1956),
+  148,
+  JS_ROM_VALUE(1966),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=1981) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT16_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1991) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT16_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2001) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1981),
+  149,
+  JS_ROM_VALUE(1991),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=2006) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT16_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=2016) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT16_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2026) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2006),
+  150,
+  JS_ROM_VALUE(2016),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=2031) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=2041) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2051) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2031),
+  151,
+  JS_ROM_VALUE(2041),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=2056) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=2066) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2076) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2056),
+  152,
+  JS_ROM_VALUE(2066),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=2081) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_FLOAT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=2091) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_FLOAT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2101) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2081),
+  153,
+  JS_ROM_VALUE(2091),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=2106) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  8 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_FLOAT64_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=2116) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(523) /* BYTES_PER_ELEMENT */,
+  8 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_FLOAT64_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2126) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2106),
+  154,
+  JS_ROM_VALUE(2116),
+  JS_ROM_VALUE(1901),
+
+  /* properties (offset=2131) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_DATA_VIEW << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=2138) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 156),
+  JS_UNDEFINED,
+
+  /* getset (offset=2141) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 157),
+  JS_UNDEFINED,
+
+  /* getset (offset=2144) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 158),
+  JS_UNDEFINED,
+
+  /* properties (offset=2147) */
+  JS_VALUE_ARRAY_HEADER(70),
+  20 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  52 << 1,
+  43 << 1,
+  46 << 1,
+  61 << 1,
+  67 << 1,
+  55 << 1,
+  58 << 1,
+  49 << 1,
+  JS_ROM_VALUE(487) /* byteLength */,
+  JS_ROM_VALUE(2138),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(500) /* byteOffset */,
+  JS_ROM_VALUE(2141),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(506) /* buffer */,
+  JS_ROM_VALUE(2144),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(554) /* getInt8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 159),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(556) /* setInt8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 160),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(558) /* getUint8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 161),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(561) /* setUint8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 162),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(564) /* getInt16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 163),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(567) /* setInt16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 164),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(570) /* getUint16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 165),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(573) /* setUint16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 166),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(576) /* getInt32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 167),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(579) /* setInt32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 168),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(582) /* getUint32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 169),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(585) /* setUint32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 170),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(588) /* getFloat32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 171),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(591) /* setFloat32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 172),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(594) /* getFloat64 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 173),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(597) /* setFloat64 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 174),
+  (40 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_DATA_VIEW - 1) << 1,
+  (64 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=2218) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2131),
+  155,
+  JS_ROM_VALUE(2147),
+  JS_NULL,
+
+  /* float64 (offset=2223) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff0000000000000,
+
+  /* float64 (offset=2225) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff8000000000000,
+
+  /* properties (offset=2227) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(386) /* log */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 175),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2234) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2227),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=2239) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  18 << 1,
+  6 << 1,
+  12 << 1,
+  15 << 1,
+  JS_ROM_VALUE(412) /* now */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 176),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(613) /* memory */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 177),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(615) /* resetMemory */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 178),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(618) /* heapProfile */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 179),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(621) /* heapReport */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 180),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2261) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2239),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=2266) */
+  JS_VALUE_ARRAY_HEADER(24),
+  6 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  0 << 1,
+  21 << 1,
+  0 << 1,
+  18 << 1,
+  JS_ROM_VALUE(626) /* init */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 181),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(628) /* rgb */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 182),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(630) /* on */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 183),
+  (6 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(632) /* off */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 184),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(634) /* strip */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 185),
+  (12 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(636) /* show */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 186),
+  (15 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=2291) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(2266),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* global object properties (offset=2296) */
+  JS_VALUE_ARRAY_HEADER(108),
+  JS_ROM_VALUE(163) /* Object */,
+  JS_ROM_VALUE(989),
+  JS_ROM_VALUE(181) /* Function */,
+  JS_ROM_VALUE(1041),
+  JS_ROM_VALUE(202) /* Number */,
+  JS_ROM_VALUE(1128),
+  JS_ROM_VALUE(242) /* Boolean */,
+  JS_ROM_VALUE(1147),
+  JS_ROM_VALUE(244) /* String */,
+  JS_ROM_VALUE(1246),
+  JS_ROM_VALUE(301) /* Array */,
+  JS_ROM_VALUE(1344),
+  JS_ROM_VALUE(336) /* Math */,
+  JS_ROM_VALUE(1484),
+  JS_ROM_VALUE(410) /* Date */,
+  JS_ROM_VALUE(1506),
+  JS_ROM_VALUE(414) /* JSON */,
+  JS_ROM_VALUE(1521),
+  JS_ROM_VALUE(421) /* JSONParser */,
+  JS_ROM_VALUE(1547),
+  JS_ROM_VALUE(428) /* RegExp */,
+  JS_ROM_VALUE(1593),
+  JS_ROM_VALUE(152) /* Error */,
+  JS_ROM_VALUE(1633),
+  JS_ROM_VALUE(463) /* EvalError */,
+  JS_ROM_VALUE(1655),
+  JS_ROM_VALUE(466) /* RangeError */,
+  JS_ROM_VALUE(1677),
+  JS_ROM_VALUE(469) /* ReferenceError */,
+  JS_ROM_VALUE(1699),
+  JS_ROM_VALUE(472) /* SyntaxError */,
+  JS_ROM_VALUE(1721),
+  JS_ROM_VALUE(475) /* TypeError */,
+  JS_ROM_VALUE(1743),
+  JS_ROM_VALUE(478) /* URIError */,
+  JS_ROM_VALUE(1765),
+  JS_ROM_VALUE(481) /* InternalError */,
+  JS_ROM_VALUE(1787),
+  JS_ROM_VALUE(484) /* ArrayBuffer */,
+  JS_ROM_VALUE(1812),
+  JS_ROM_VALUE(493) /* Uint8ClampedArray */,
+  JS_ROM_VALUE(1926),
+  JS_ROM_VALUE(527) /* Int8Array */,
+  JS_ROM_VALUE(1951),
+  JS_ROM_VALUE(530) /* Uint8Array */,
+  JS_ROM_VALUE(1976),
+  JS_ROM_VALUE(533) /* Int16Array */,
+  JS_ROM_VALUE(2001),
+  JS_ROM_VALUE(536) /* Uint16Array */,
+  JS_ROM_VALUE(2026),
+  JS_ROM_VALUE(539) /* Int32Array */,
+  JS_ROM_VALUE(2051),
+  JS_ROM_VALUE(542) /* Uint32Array */,
+  JS_ROM_VALUE(2076),
+  JS_ROM_VALUE(545) /* Float32Array */,
+  JS_ROM_VALUE(2101),
+  JS_ROM_VALUE(548) /* Float64Array */,
+  JS_ROM_VALUE(2126),
+  JS_ROM_VALUE(551) /* DataView */,
+  JS_ROM_VALUE(2218),
+  JS_ROM_VALUE(204) /* parseInt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 19),
+  JS_ROM_VALUE(207) /* parseFloat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 20),
+  JS_ROM_VALUE(119) /* eval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 187),
+  JS_ROM_VALUE(600) /* isNaN */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 188),
+  JS_ROM_VALUE(602) /* isFinite */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 189),
+  JS_ROM_VALUE(144) /* Infinity */,
+  JS_ROM_VALUE(2223),
+  JS_ROM_VALUE(142) /* NaN */,
+  JS_ROM_VALUE(2225),
+  JS_ROM_VALUE(108) /* undefined */,
+  JS_UNDEFINED,
+  JS_ROM_VALUE(605) /* globalThis */,
+  JS_NULL,
+  JS_ROM_VALUE(608) /* console */,
+  JS_ROM_VALUE(2234),
+  JS_ROM_VALUE(610) /* performance */,
+  JS_ROM_VALUE(2261),
+  JS_ROM_VALUE(624) /* led */,
+  JS_ROM_VALUE(2291),
+  JS_ROM_VALUE(638) /* print */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 190),
+  JS_ROM_VALUE(640) /* gc */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 191),
+  JS_ROM_VALUE(642) /* load */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 192),
+  JS_ROM_VALUE(644) /* readFile */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 193),
+  JS_ROM_VALUE(647) /* loadMapped */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 194),
+  JS_ROM_VALUE(650) /* loadUserBytecode */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 195),
+  JS_ROM_VALUE(654) /* setTimeout */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 196),
+  JS_ROM_VALUE(657) /* clearTimeout */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 197),
+  JS_ROM_VALUE(660) /* setInterval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 198),
+  JS_ROM_VALUE(663) /* clearInterval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 199),
+  JS_ROM_VALUE(666) /* startWorker */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 200),
+  JS_ROM_VALUE(669) /* postMessage */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 201),
+};
+
+static const uint16_t js_atom_hash_table[] = {
+  /* bucket displacements */
+  0, 1, 2, 0, 0, 3, 1, 0, 3, 1, 2, 0, 5, 0, 2, 4,
+  15, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 6, 4, 1, 1,
+  0, 0, 0, 1, 0, 2, 3, 3, 1, 4, 1, 1, 0, 0, 0, 1,
+  1, 0, 1, 4, 1, 0, 2, 0, 1, 0, 4, 0, 0, 3, 2, 0,
+  1, 2, 0, 0, 0, 5, 1, 2, 1, 0, 0, 1, 1, 0, 0, 0,
+  4, 0, 0, 1, 2, 0, 0, 0, 0, 0, 1, 4, 0, 2, 1, 0,
+  1, 0, 4, 1, 3, 3, 1, 3, 1, 7, 5, 1, 0, 0, 0, 0,
+  0, 1, 6, 3, 0, 0, 0, 0, 12, 2, 4, 2, 1, 4, 0, 0,
+  /* sorted atom table index of each slot */
+  65535, 65535, 84, 65535, 59, 65535, 65535, 45, 126, 34, 199, 65535, 262, 132, 206, 65535,
+  65535, 65535, 50, 65535, 65535, 65535, 65535, 100, 65535, 65535, 65535, 227, 207, 204, 65535, 61,
+  22, 245, 65535, 65535, 65535, 65535, 65535, 107, 29, 27, 65535, 31, 72, 108, 65535, 273,
+  10, 65535, 129, 249, 169, 65535, 65535, 65535, 65535, 65535, 76, 65535, 133, 264, 96, 65535,
+  216, 65535, 243, 134, 65535, 65535, 65535, 215, 65535, 229, 65535, 247, 146, 240, 220, 64,
+  195, 65535, 65535, 54, 86, 193, 121, 12, 223, 267, 65535, 65535, 65535, 145, 198, 0,
+  161, 137, 21, 143, 65535, 65535, 65, 122, 65535, 65535, 65535, 23, 182, 75, 179, 171,
+  266, 25, 88, 65535, 254, 65535, 7, 236, 91, 272, 65535, 65535, 65535, 65535, 65535, 65535,
+  271, 65535, 65535, 260, 65535, 65535, 265, 78, 147, 65535, 65535, 65535, 73, 166, 237, 65535,
+  65535, 69, 53, 210, 65535, 150, 65535, 65535, 97, 188, 172, 65535, 176, 98, 65535, 65535,
+  238, 65535, 131, 268, 65535, 99, 65535, 160, 24, 211, 19, 153, 168, 20, 65535, 65535,
+  65535, 65535, 65535, 65535, 141, 101, 65535, 11, 70, 65535, 115, 181, 65535, 89, 14, 170,
+  110, 235, 65535, 230, 65535, 65535, 113, 65535, 140, 39, 253, 177, 65535, 48, 196, 65535,
+  18, 232, 65535, 65535, 119, 65535, 65535, 205, 65535, 155, 174, 65535, 65535, 65535, 214, 51,
+  125, 65535, 65535, 65535, 234, 213, 65535, 106, 65535, 65535, 65535, 65535, 197, 65535, 65535, 112,
+  65535, 65535, 111, 32, 65535, 65535, 65535, 222, 65535, 65535, 65535, 65535, 258, 65535, 65535, 274,
+  65535, 65535, 251, 65535, 185, 162, 200, 65535, 93, 65535, 139, 65535, 65535, 65535, 65535, 65535,
+  52, 209, 5, 231, 65535, 127, 65535, 65535, 218, 180, 138, 65535, 92, 65535, 65535, 65535,
+  65535, 38, 255, 65535, 65535, 26, 13, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 144, 123,
+  142, 65535, 217, 63, 47, 120, 187, 58, 40, 46, 65535, 65535, 49, 65535, 221, 124,
+  81, 104, 65535, 65535, 194, 65535, 65535, 65535, 135, 65535, 65535, 130, 183, 114, 65535, 228,
+  6, 65535, 65535, 65535, 148, 159, 95, 175, 151, 225, 167, 270, 65535, 263, 74, 65535,
+  77, 128, 65535, 65535, 203, 192, 62, 65535, 65535, 65535, 65535, 65535, 9, 65535, 233, 41,
+  85, 17, 65535, 42, 65535, 164, 65535, 65535, 226, 80, 65535, 117, 191, 275, 65535, 65535,
+  65535, 15, 259, 56, 65535, 241, 65535, 219, 158, 65535, 65535, 242, 65535, 65535, 189, 65535,
+  252, 65535, 173, 65535, 28, 250, 65535, 105, 65535, 8, 3, 256, 163, 212, 82, 65535,
+  35, 65535, 65535, 1, 178, 224, 55, 94, 65535, 67, 65535, 16, 186, 65535, 57, 65535,
+  109, 68, 154, 60, 36, 65535, 190, 136, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 4, 261, 269, 65535, 65535, 201, 65535, 157, 246, 65535, 83, 65535, 90, 65535,
+  65535, 65535, 71, 79, 65535, 44, 152, 65535, 248, 87, 65535, 239, 202, 156, 149, 65535,
+  118, 33, 65535, 65535, 65535, 116, 65535, 2, 276, 208, 65535, 30, 65535, 65535, 103, 65535,
+  65535, 65535, 66, 65535, 65535, 165, 65535, 37, 65535, 244, 65535, 257, 184, 43, 65535, 102,
+};
+
+static const JSCFunctionDef js_c_function_table[] = {
+  { { .generic_params = js_function_bound },
+    JS_ROM_VALUE(161) /* bound */,
+    JS_CFUNC_generic_params, 0, 0 },
+  { { .constructor = js_object_constructor },
+    JS_ROM_VALUE(163) /* Object */,
+    JS_CFUNC_constructor, 1, JS_CLASS_OBJECT },
+  { { .generic = js_object_defineProperty },
+    JS_ROM_VALUE(165) /* defineProperty */,
+    JS_CFUNC_generic, 3, 0 },
+  { { .generic = js_object_getPrototypeOf },
+    JS_ROM_VALUE(168) /* getPrototypeOf */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_setPrototypeOf },
+    JS_ROM_VALUE(171) /* setPrototypeOf */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_object_create },
+    JS_ROM_VALUE(174) /* create */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_object_keys },
+    JS_ROM_VALUE(176) /* keys */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_hasOwnProperty },
+    JS_ROM_VALUE(178) /* hasOwnProperty */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_function_constructor },
+    JS_ROM_VALUE(181) /* Function */,
+    JS_CFUNC_constructor, 1, JS_CLASS_CLOSURE },
+  { { .generic = js_function_get_prototype },
+    JS_ROM_VALUE(184) /* get prototype */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_function_set_prototype },
+    JS_ROM_VALUE(187) /* set prototype */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_function_get_length_name },
+    JS_ROM_VALUE(196) /* get length */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_function_get_length_name },
+    JS_ROM_VALUE(199) /* get name */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_function_call },
+    JS_ROM_VALUE(190) /* call */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_function_apply },
+    JS_ROM_VALUE(192) /* apply */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_function_bind },
+    JS_ROM_VALUE(194) /* bind */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_function_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_number_constructor },
+    JS_ROM_VALUE(202) /* Number */,
+    JS_CFUNC_constructor, 1, JS_CLASS_NUMBER },
+  { { .generic = js_number_parseInt },
+    JS_ROM_VALUE(204) /* parseInt */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_number_parseFloat },
+    JS_ROM_VALUE(207) /* parseFloat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toExponential },
+    JS_ROM_VALUE(234) /* toExponential */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toFixed },
+    JS_ROM_VALUE(237) /* toFixed */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toPrecision },
+    JS_ROM_VALUE(239) /* toPrecision */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor = js_boolean_constructor },
+    JS_ROM_VALUE(242) /* Boolean */,
+    JS_CFUNC_constructor, 1, JS_CLASS_BOOLEAN },
+  { { .constructor = js_string_constructor },
+    JS_ROM_VALUE(244) /* String */,
+    JS_CFUNC_constructor, 1, JS_CLASS_STRING },
+  { { .generic_magic = js_string_fromCharCode },
+    JS_ROM_VALUE(246) /* fromCharCode */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_string_fromCharCode },
+    JS_ROM_VALUE(249) /* fromCodePoint */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_string_get_length },
+    JS_ROM_VALUE(196) /* get length */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_string_set_length },
+    JS_ROM_VALUE(252) /* set length */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(255) /* charAt */,
+    JS_CFUNC_generic_magic, 1, magic_charAt },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(257) /* charCodeAt */,
+    JS_CFUNC_generic_magic, 1, magic_charCodeAt },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(260) /* codePointAt */,
+    JS_CFUNC_generic_magic, 1, magic_codePointAt },
+  { { .generic = js_string_slice },
+    JS_ROM_VALUE(263) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_string_substring },
+    JS_ROM_VALUE(265) /* substring */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_string_concat },
+    JS_ROM_VALUE(268) /* concat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_indexOf },
+    JS_ROM_VALUE(270) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_string_indexOf },
+    JS_ROM_VALUE(272) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_string_match },
+    JS_ROM_VALUE(275) /* match */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_replace },
+    JS_ROM_VALUE(277) /* replace */,
+    JS_CFUNC_generic_magic, 2, 0 },
+  { { .generic_magic = js_string_replace },
+    JS_ROM_VALUE(279) /* replaceAll */,
+    JS_CFUNC_generic_magic, 2, 1 },
+  { { .generic = js_string_search },
+    JS_ROM_VALUE(282) /* search */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_string_split },
+    JS_ROM_VALUE(284) /* split */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_string_toLowerCase },
+    JS_ROM_VALUE(286) /* toLowerCase */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_string_toLowerCase },
+    JS_ROM_VALUE(289) /* toUpperCase */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(292) /* trim */,
+    JS_CFUNC_generic_magic, 0, 3 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(294) /* trimEnd */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(296) /* trimStart */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_string_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_string_repeat },
+    JS_ROM_VALUE(299) /* repeat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor = js_array_constructor },
+    JS_ROM_VALUE(301) /* Array */,
+    JS_CFUNC_constructor, 1, JS_CLASS_ARRAY },
+  { { .generic = js_array_isArray },
+    JS_ROM_VALUE(303) /* isArray */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_get_length },
+    JS_ROM_VALUE(196) /* get length */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_set_length },
+    JS_ROM_VALUE(252) /* set length */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_concat },
+    JS_ROM_VALUE(268) /* concat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_array_push },
+    JS_ROM_VALUE(305) /* push */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic = js_array_pop },
+    JS_ROM_VALUE(307) /* pop */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_join },
+    JS_ROM_VALUE(309) /* join */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_reverse },
+    JS_ROM_VALUE(311) /* reverse */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_shift },
+    JS_ROM_VALUE(313) /* shift */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_slice },
+    JS_ROM_VALUE(263) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_array_splice },
+    JS_ROM_VALUE(315) /* splice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_array_push },
+    JS_ROM_VALUE(317) /* unshift */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic_magic = js_array_indexOf },
+    JS_ROM_VALUE(270) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_array_indexOf },
+    JS_ROM_VALUE(272) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(319) /* every */,
+    JS_CFUNC_generic_magic, 1, js_special_every },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(321) /* some */,
+    JS_CFUNC_generic_magic, 1, js_special_some },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(323) /* forEach */,
+    JS_CFUNC_generic_magic, 1, js_special_forEach },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(325) /* map */,
+    JS_CFUNC_generic_magic, 1, js_special_map },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(327) /* filter */,
+    JS_CFUNC_generic_magic, 1, js_special_filter },
+  { { .generic_magic = js_array_reduce },
+    JS_ROM_VALUE(329) /* reduce */,
+    JS_CFUNC_generic_magic, 1, js_special_reduce },
+  { { .generic_magic = js_array_reduce },
+    JS_ROM_VALUE(331) /* reduceRight */,
+    JS_CFUNC_generic_magic, 1, js_special_reduceRight },
+  { { .generic = js_array_sort },
+    JS_ROM_VALUE(334) /* sort */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_math_min_max },
+    JS_ROM_VALUE(338) /* min */,
+    JS_CFUNC_generic_magic, 2, 0 },
+  { { .generic_magic = js_math_min_max },
+    JS_ROM_VALUE(340) /* max */,
+    JS_CFUNC_generic_magic, 2, 1 },
+  { { .f_f = js_math_sign },
+    JS_ROM_VALUE(342) /* sign */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_fabs },
+    JS_ROM_VALUE(344) /* abs */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_floor },
+    JS_ROM_VALUE(346) /* floor */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_ceil },
+    JS_ROM_VALUE(348) /* ceil */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_round_inf },
+    JS_ROM_VALUE(350) /* round */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_sqrt },
+    JS_ROM_VALUE(352) /* sqrt */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_sin },
+    JS_ROM_VALUE(370) /* sin */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_cos },
+    JS_ROM_VALUE(372) /* cos */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_tan },
+    JS_ROM_VALUE(374) /* tan */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_asin },
+    JS_ROM_VALUE(376) /* asin */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_acos },
+    JS_ROM_VALUE(378) /* acos */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_atan },
+    JS_ROM_VALUE(380) /* atan */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_ff = js_atan2 },
+    JS_ROM_VALUE(382) /* atan2 */,
+    JS_CFUNC_f_ff, 2, 0 },
+  { { .f_f = js_exp },
+    JS_ROM_VALUE(384) /* exp */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_log },
+    JS_ROM_VALUE(386) /* log */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_ff = js_pow },
+    JS_ROM_VALUE(388) /* pow */,
+    JS_CFUNC_f_ff, 2, 0 },
+  { { .generic = js_math_random },
+    JS_ROM_VALUE(390) /* random */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .i_ii = js_math_imul },
+    JS_ROM_VALUE(392) /* imul */,
+    JS_CFUNC_i_ii, 2, 0 },
+  { { .generic = js_math_clz32 },
+    JS_ROM_VALUE(394) /* clz32 */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .f_f = js_math_fround },
+    JS_ROM_VALUE(396) /* fround */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_trunc },
+    JS_ROM_VALUE(398) /* trunc */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_log2 },
+    JS_ROM_VALUE(400) /* log2 */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_log10 },
+    JS_ROM_VALUE(402) /* log10 */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .i_ii = js_math_idiv },
+    JS_ROM_VALUE(404) /* idiv */,
+    JS_CFUNC_i_ii, 2, 0 },
+  { { .i_iii = js_math_fxmul },
+    JS_ROM_VALUE(406) /* fxmul */,
+    JS_CFUNC_i_iii, 3, 0 },
+  { { .i_iii = js_math_fxdiv },
+    JS_ROM_VALUE(408) /* fxdiv */,
+    JS_CFUNC_i_iii, 3, 0 },
+  { { .constructor = js_date_constructor },
+    JS_ROM_VALUE(410) /* Date */,
+    JS_CFUNC_constructor, 7, JS_CLASS_DATE },
+  { { .generic = js_date_now },
+    JS_ROM_VALUE(412) /* now */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_json_parse },
+    JS_ROM_VALUE(416) /* parse */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_json_stringify },
+    JS_ROM_VALUE(418) /* stringify */,
+    JS_CFUNC_generic, 3, 0 },
+  { { .constructor = js_json_parser_constructor },
+    JS_ROM_VALUE(421) /* JSONParser */,
+    JS_CFUNC_constructor, 2, JS_CLASS_JSON_PARSER },
+  { { .generic = js_json_parser_write_chunk },
+    JS_ROM_VALUE(424) /* write */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_json_parser_end_input },
+    JS_ROM_VALUE(426) /* end */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_regexp_constructor },
+    JS_ROM_VALUE(428) /* RegExp */,
+    JS_CFUNC_constructor, 2, JS_CLASS_REGEXP },
+  { { .generic = js_regexp_get_lastIndex },
+    JS_ROM_VALUE(433) /* get lastIndex */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_regexp_set_lastIndex },
+    JS_ROM_VALUE(436) /* set lastIndex */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_regexp_get_source },
+    JS_ROM_VALUE(441) /* get source */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_regexp_get_flags },
+    JS_ROM_VALUE(446) /* get flags */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic_magic = js_regexp_exec },
+    JS_ROM_VALUE(449) /* exec */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_regexp_exec },
+    JS_ROM_VALUE(451) /* test */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(152) /* Error */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_ERROR },
+  { { .generic_magic = js_error_get_message },
+    JS_ROM_VALUE(455) /* get message */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_error_get_message },
+    JS_ROM_VALUE(460) /* get stack */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_error_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(463) /* EvalError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_EVAL_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(466) /* RangeError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_RANGE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(469) /* ReferenceError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_REFERENCE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(472) /* SyntaxError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_SYNTAX_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(475) /* TypeError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_TYPE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(478) /* URIError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_URI_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(481) /* InternalError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_INTERNAL_ERROR },
+  { { .constructor = js_array_buffer_constructor },
+    JS_ROM_VALUE(484) /* ArrayBuffer */,
+    JS_CFUNC_constructor, 1, JS_CLASS_ARRAY_BUFFER },
+  { { .generic = js_array_buffer_get_byteLength },
+    JS_ROM_VALUE(490) /* get byteLength */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_typed_array_base_constructor },
+    JS_ROM_VALUE(497) /* TypedArray */,
+    JS_CFUNC_constructor, 0, JS_CLASS_TYPED_ARRAY },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(196) /* get length */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(490) /* get byteLength */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(503) /* get byteOffset */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(508) /* get buffer */,
+    JS_CFUNC_generic_magic, 0, 3 },
+  { { .generic = js_typed_array_subarray },
+    JS_ROM_VALUE(511) /* subarray */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_typed_array_set },
+    JS_ROM_VALUE(128) /* set */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_typed_array_fill },
+    JS_ROM_VALUE(514) /* fill */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_typed_array_copyWithin },
+    JS_ROM_VALUE(516) /* copyWithin */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_typed_array_indexOf },
+    JS_ROM_VALUE(270) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_typed_array_indexOf },
+    JS_ROM_VALUE(272) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_typed_array_slice },
+    JS_ROM_VALUE(263) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_typed_array_sum },
+    JS_ROM_VALUE(519) /* sum */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic_magic = js_typed_array_min_max },
+    JS_ROM_VALUE(338) /* min */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_typed_array_min_max },
+    JS_ROM_VALUE(340) /* max */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_typed_array_dot },
+    JS_ROM_VALUE(521) /* dot */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(493) /* Uint8ClampedArray */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT8C_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(527) /* Int8Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT8_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(530) /* Uint8Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT8_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(533) /* Int16Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT16_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(536) /* Uint16Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT16_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(539) /* Int32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(542) /* Uint32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(545) /* Float32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_FLOAT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(548) /* Float64Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_FLOAT64_ARRAY },
+  { { .constructor = js_dataview_constructor },
+    JS_ROM_VALUE(551) /* DataView */,
+    JS_CFUNC_constructor, 3, JS_CLASS_DATA_VIEW },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(490) /* get byteLength */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(503) /* get byteOffset */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(508) /* get buffer */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(554) /* getInt8 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT8_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(556) /* setInt8 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT8_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(558) /* getUint8 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT8_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(561) /* setUint8 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT8_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(564) /* getInt16 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT16_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(567) /* setInt16 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT16_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(570) /* getUint16 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT16_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(573) /* setUint16 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT16_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(576) /* getInt32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(579) /* setInt32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(582) /* getUint32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(585) /* setUint32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(588) /* getFloat32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_FLOAT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(591) /* setFloat32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_FLOAT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(594) /* getFloat64 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_FLOAT64_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(597) /* setFloat64 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_FLOAT64_ARRAY },
+  { { .generic = js_print },
+    JS_ROM_VALUE(386) /* log */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_performance_now },
+    JS_ROM_VALUE(412) /* now */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_performance_memory },
+    JS_ROM_VALUE(613) /* memory */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_performance_resetMemory },
+    JS_ROM_VALUE(615) /* resetMemory */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_performance_heapProfile },
+    JS_ROM_VALUE(618) /* heapProfile */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_performance_heapReport },
+    JS_ROM_VALUE(621) /* heapReport */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_led_init },
+    JS_ROM_VALUE(626) /* init */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .v_iii = js_led_rgb },
+    JS_ROM_VALUE(628) /* rgb */,
+    JS_CFUNC_v_iii, 3, 0 },
+  { { .generic = js_led_on },
+    JS_ROM_VALUE(630) /* on */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_led_off },
+    JS_ROM_VALUE(632) /* off */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_led_strip },
+    JS_ROM_VALUE(634) /* strip */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_led_show },
+    JS_ROM_VALUE(636) /* show */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_global_eval },
+    JS_ROM_VALUE(119) /* eval */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_global_isNaN },
+    JS_ROM_VALUE(600) /* isNaN */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_global_isFinite },
+    JS_ROM_VALUE(602) /* isFinite */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_print },
+    JS_ROM_VALUE(638) /* print */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_gc },
+    JS_ROM_VALUE(640) /* gc */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_load },
+    JS_ROM_VALUE(642) /* load */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_readFile },
+    JS_ROM_VALUE(644) /* readFile */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_loadMapped },
+    JS_ROM_VALUE(647) /* loadMapped */,
+    JS_CFUNC_generic, 3, 0 },
+  { { .generic = js_loadUserBytecode },
+    JS_ROM_VALUE(650) /* loadUserBytecode */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_setTimeout },
+    JS_ROM_VALUE(654) /* setTimeout */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_clearTimeout },
+    JS_ROM_VALUE(657) /* clearTimeout */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_setInterval },
+    JS_ROM_VALUE(660) /* setInterval */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_clearTimeout },
+    JS_ROM_VALUE(663) /* clearInterval */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_startWorker },
+    JS_ROM_VALUE(666) /* startWorker */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_postMessage },
+    JS_ROM_VALUE(669) /* postMessage */,
+    JS_CFUNC_generic, 1, 0 },
+};
+
+#ifndef JS_CLASS_COUNT
+#define JS_CLASS_COUNT JS_CLASS_USER /* total number of classes */
+#endif
+
+static const JSCFinalizer js_c_finalizer_table[JS_CLASS_COUNT - JS_CLASS_USER] = {
+};
+
+const JSSTDLibraryDef js_stdlib = {
+  js_stdlib_table,
+  js_c_function_table,
+  js_c_finalizer_table,
+  2405,
+  64,
+  672,
+  2296,
+  JS_CLASS_COUNT,
+  js_atom_hash_table,
+  9,
+  7,
+};
+
@@ -0,0 +1,361 @@
+/*
+ * MicroQuickJS timers
+ * setTimeout / setInterval queue shared by mqjs and the firmware
+ *
+ * JavaScript API:
+ *   setTimeout(func, delay)   - Call func once after delay ms, return an id
+ *   setInterval(func, delay)  - Call func every delay ms, return an id
+ *   clearTimeout(id)          - Cancel a timer (also exported as clearInterval)
+ *
+ * The pending timers are kept in a binary min-heap ordered by deadline
+ * so that insertion and cancellation are O(log n) and the next
+ * deadline is always at the root. The callbacks are stored in a single
+ * JS array indexed by the timer slot, so the number of GC references
+ * does not depend on the number of timers.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <time.h>
+#include <sys/time.h>
+#include "cutils.h"
+#include "mquickjs.h"
+#include "mqjs_timer.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#endif
+
+/* timer ids are (generation << 16) | (slot + 1) so that a stale id
+   never cancels a timer which reused its slot */
+#define TIMER_SLOT_BITS 16
+#define TIMER_SLOT_MAX  ((1 << TIMER_SLOT_BITS) - 1)
+#define TIMER_GEN_MASK  0x7fff
+
+typedef struct {
+    int64_t timeout; /* deadline in ms */
+    int interval; /* period in ms, < 0 for a one-shot timer */
+    uint32_t seq; /* scheduling order, used to break ties */
+    int heap_idx; /* position in the heap, -1 if the slot is free */
+    int next_free;
+    uint16_t gen;
+} JSTimer;
+
+typedef struct {
+    JSContext *ctx; /* NULL until the first timer is created */
+    JSContextFreeHook free_hook; /* resets the queue in JS_FreeContext() */
+    JSGCRef funcs; /* JS array of the callbacks, indexed by slot */
+    JSTimer *slots;
+    int *heap; /* slot indexes */
+    int slot_count;
+    int slot_size;
+    int heap_count;
+    int first_free;
+    uint32_t seq;
+} JSTimerQueue;
+
+/* one queue per thread: each task (e.g. the worker of mqjs_worker.c)
+   runs its own context */
+static __thread JSTimerQueue js_timer_queue;
+
+static int64_t timer_get_time_ms(void)
+{
+#if defined(ESP_PLATFORM)
+    return esp_timer_get_time() / 1000;
+#elif defined(__linux__) || defined(__APPLE__)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000 + (tv.tv_usec / 1000);
+#endif
+}
+
+/* return TRUE if slot 'a' must run before slot 'b' */
+static int timer_less(JSTimerQueue *tq, int a, int b)
+{
+    JSTimer *ta = &tq->slots[a], *tb = &tq->slots[b];
+    if (ta->timeout != tb->timeout)
+        return ta->timeout < tb->timeout;
+    return (int32_t)(ta->seq - tb->seq) < 0;
+}
+
+static void timer_heap_set(JSTimerQueue *tq, int pos, int slot)
+{
+    tq->heap[pos] = slot;
+    tq->slots[slot].heap_idx = pos;
+}
+
+static void timer_sift_up(JSTimerQueue *tq, int pos)
+{
+    int slot, parent;
+    slot = tq->heap[pos];
+    while (pos > 0) {
+        parent = (pos - 1) / 2;
+        if (!timer_less(tq, slot, tq->heap[parent]))
+            break;
+        timer_heap_set(tq, pos, tq->heap[parent]);
+        pos = parent;
+    }
+    timer_heap_set(tq, pos, slot);
+}
+
+static void timer_sift_down(JSTimerQueue *tq, int pos)
+{
+    int slot, child;
+    slot = tq->heap[pos];
+    for(;;) {
+        child = 2 * pos + 1;
+        if (child >= tq->heap_count)
+            break;
+        if (child + 1 < tq->heap_count &&
+            timer_less(tq, tq->heap[child + 1], tq->heap[child]))
+            child++;
+        if (!timer_less(tq, tq->heap[child], slot))
+            break;
+        timer_heap_set(tq, pos, tq->heap[child]);
+        pos = child;
+    }
+    timer_heap_set(tq, pos, slot);
+}
+
+static void timer_heap_insert(JSTimerQueue *tq, int slot)
+{
+    tq->slots[slot].seq = tq->seq++;
+    timer_heap_set(tq, tq->heap_count++, slot);
+    timer_sift_up(tq, tq->heap_count - 1);
+}
+
+static void timer_heap_remove(JSTimerQueue *tq, int slot)
+{
+    int pos, last;
+    pos = tq->slots[slot].heap_idx;
+    last = tq->heap[--tq->heap_count];
+    if (pos != tq->heap_count) {
+        timer_heap_set(tq, pos, last);
+        timer_sift_down(tq, pos);
+        timer_sift_up(tq, tq->slots[last].heap_idx);
+    }
+    tq->slots[slot].heap_idx = -1;
+}
+
+static void timer_queue_reset(JSTimerQueue *tq)
+{
+    free(tq->slots);
+    free(tq->heap);
+    tq->slots = NULL;
+    tq->heap = NULL;
+    tq->slot_count = 0;
+    tq->slot_size = 0;
+    tq->heap_count = 0;
+    tq->first_free = -1;
+    tq->ctx = NULL;
+}
+
+/* the timers are dropped when their context is freed */
+static void timer_queue_free_hook(JSContext *ctx, JSContextFreeHook *hook)
+{
+    JSTimerQueue *tq = container_of(hook, JSTimerQueue, free_hook);
+    JS_DeleteGCRef(ctx, &tq->funcs);
+    timer_queue_reset(tq);
+}
+
+static int timer_queue_init(JSContext *ctx, JSTimerQueue *tq)
+{
+    JSValue *pfuncs;
+
+    if (tq->ctx == ctx)
+        return 0;
+    /* a single context per thread can have timers */
+    if (tq->ctx) {
+        JS_ThrowInternalError(ctx, "timers are used by another context");
+        return -1;
+    }
+    timer_queue_reset(tq);
+    pfuncs = JS_AddGCRef(ctx, &tq->funcs);
+    *pfuncs = JS_NewArray(ctx, 0);
+    if (JS_IsException(*pfuncs)) {
+        JS_DeleteGCRef(ctx, &tq->funcs);
+        return -1;
+    }
+    tq->ctx = ctx;
+    tq->free_hook.func = timer_queue_free_hook;
+    JS_AddContextFreeHook(ctx, &tq->free_hook);
+    return 0;
+}
+
+/* return the new slot index or -1 if no memory */
+static int timer_alloc_slot(JSTimerQueue *tq)
+{
+    int slot, new_size;
+    JSTimer *new_slots;
+    int *new_heap;
+
+    if (tq->first_free >= 0) {
+        slot = tq->first_free;
+        tq->first_free = tq->slots[slot].next_free;
+        return slot;
+    }
+    if (tq->slot_count >= TIMER_SLOT_MAX)
+        return -1;
+    if (tq->slot_count >= tq->slot_size) {
+        new_size = max_int(8, tq->slot_size * 3 / 2);
+        if (new_size > TIMER_SLOT_MAX)
+            new_size = TIMER_SLOT_MAX;
+        new_slots = realloc(tq->slots, sizeof(tq->slots[0]) * new_size);
+        if (!new_slots)
+            return -1;
+        tq->slots = new_slots;
+        new_heap = realloc(tq->heap, sizeof(tq->heap[0]) * new_size);
+        if (!new_heap)
+            return -1;
+        tq->heap = new_heap;
+        tq->slot_size = new_size;
+    }
+    slot = tq->slot_count++;
+    tq->slots[slot].gen = 0;
+    tq->slots[slot].heap_idx = -1;
+    return slot;
+}
+
+static void timer_free_slot(JSContext *ctx, JSTimerQueue *tq, int slot)
+{
+    JSTimer *th = &tq->slots[slot];
+    if (th->heap_idx >= 0)
+        timer_heap_remove(tq, slot);
+    th->gen = (th->gen + 1) & TIMER_GEN_MASK;
+    th->next_free = tq->first_free;
+    tq->first_free = slot;
+    /* release the callback (cannot fail: the array element exists) */
+    JS_SetPropertyUint32(ctx, tq->funcs.val, slot, JS_UNDEFINED);
+}
+
+static JSValue js_timer_create(JSContext *ctx, JSValue *argv, BOOL is_interval)
+{
+    JSTimerQueue *tq = &js_timer_queue;
+    JSTimer *th;
+    JSValue ret;
+    int delay, slot;
+
+    if (!JS_IsFunction(ctx, argv[0]))
+        return JS_ThrowTypeError(ctx, "not a function");
+    if (JS_ToInt32(ctx, &delay, argv[1]))
+        return JS_EXCEPTION;
+    if (delay < 0)
+        delay = 0;
+    if (timer_queue_init(ctx, tq))
+        return JS_EXCEPTION;
+    slot = timer_alloc_slot(tq);
+    if (slot < 0)
+        return JS_ThrowInternalError(ctx, "too many timers");
+    ret = JS_SetPropertyUint32(ctx, tq->funcs.val, slot, argv[0]);
+    if (JS_IsException(ret)) {
+        th = &tq->slots[slot];
+        th->next_free = tq->first_free;
+        tq->first_free = slot;
+        return ret;
+    }
+    th = &tq->slots[slot];
+    th->timeout = timer_get_time_ms() + delay;
+    /* a zero period would never let the caller sleep */
+    th->interval = is_interval ? max_int(delay, 1) : -1;
+    timer_heap_insert(tq, slot);
+    return JS_NewInt32(ctx, ((int)th->gen << TIMER_SLOT_BITS) | (slot + 1));
+}
+
+JSValue js_setTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    return js_timer_create(ctx, argv, FALSE);
+}
+
+JSValue js_setInterval(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    return js_timer_create(ctx, argv, TRUE);
+}
+
+JSValue js_clearTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    JSTimerQueue *tq = &js_timer_queue;
+    int timer_id, slot;
+
+    if (JS_ToInt32(ctx, &timer_id, argv[0]))
+        return JS_EXCEPTION;
+    if (tq->ctx != ctx)
+        return JS_UNDEFINED;
+    slot = (timer_id & TIMER_SLOT_MAX) - 1;
+    if (slot >= 0 && slot < tq->slot_count &&
+        tq->slots[slot].heap_idx >= 0 &&
+        tq->slots[slot].gen == ((timer_id >> TIMER_SLOT_BITS) & TIMER_GEN_MASK)) {
+        timer_free_slot(ctx, tq, slot);
+    }
+    return JS_UNDEFINED;
+}
+
+static int64_t timer_next_delay(JSTimerQueue *tq, int64_t cur_time)
+{
+    int64_t delay;
+    if (tq->heap_count == 0)
+        return -1;
+    delay = tq->slots[tq->heap[0]].timeout - cur_time;
+    return max_int64(delay, 0);
+}
+
+int64_t JS_GetNextTimerDelay(JSContext *ctx)
+{
+    JSTimerQueue *tq = &js_timer_queue;
+    if (tq->ctx != ctx)
+        return -1;
+    return timer_next_delay(tq, timer_get_time_ms());
+}
+
+int64_t JS_ProcessTimers(JSContext *ctx)
+{
+    JSTimerQueue *tq = &js_timer_queue;
+    JSTimer *th;
+    JSValue func, ret;
+    int64_t cur_time;
+    uint32_t seq_limit;
+    int slot;
+
+    if (JS_RunPendingJobs(ctx, 0) < 0)
+        return -2;
+    if (tq->ctx != ctx)
+        return JS_IsJobPending(ctx) ? 0 : -1;
+    cur_time = timer_get_time_ms();
+    /* the timers scheduled by the callbacks run at the next call */
+    seq_limit = tq->seq;
+    while (tq->heap_count > 0) {
+        slot = tq->heap[0];
+        th = &tq->slots[slot];
+        if (th->timeout > cur_time || (int32_t)(th->seq - seq_limit) >= 0)
+            break;
+        if (JS_StackCheck(ctx, 2))
+            return -2;
+        func = JS_GetPropertyUint32(ctx, tq->funcs.val, slot);
+        JS_PushArg(ctx, func);
+        JS_PushArg(ctx, JS_NULL); /* this */
+
+        /* the queue is updated before the call so that the callback
+           can clear or reschedule timers, including itself */
+        th = &tq->slots[slot];
+        if (th->interval >= 0) {
+            timer_heap_remove(tq, slot);
+            th->timeout += th->interval;
+            if (th->timeout <= cur_time)
+                th->timeout = cur_time + th->interval; /* skip missed ticks */
+            timer_heap_insert(tq, slot);
+        } else {
+            timer_free_slot(ctx, tq, slot);
+        }
+
+        ret = JS_Call(ctx, 0);
+        if (JS_IsException(ret))
+            return -2;
+    }
+    if (JS_IsJobPending(ctx))
+        return 0;
+    return timer_next_delay(tq, timer_get_time_ms());
+}
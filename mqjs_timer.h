@@ -0,0 +1,15 @@
+/*
+ * MicroQuickJS timers
+ * setTimeout / setInterval queue shared by mqjs and the firmware
+ */
+#ifndef MQJS_TIMER_H
+#define MQJS_TIMER_H
+
+#include "mquickjs.h"
+
+/* JavaScript binding functions */
+JSValue js_setTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_setInterval(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_clearTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+
+#endif /* MQJS_TIMER_H */
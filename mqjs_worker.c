@@ -0,0 +1,364 @@
+/*
+ * MicroQuickJS worker
+ * Second isolated context on its own task (pinned to the other core
+ * on ESP32) exchanging JSON messages with the main context
+ *
+ * JavaScript API:
+ *   startWorker(source)  - Start the worker context running 'source'
+ *                          (main context only, at most one worker)
+ *   postMessage(value)   - Send JSON.stringify(value) to the other context
+ *   globalThis.onmessage = f - f(value) is called for each received message
+ *
+ * Each context has its own heap and runs on its own task, so the two
+ * contexts never share JS values. A message is serialized by the sender
+ * and copied into a single producer, single consumer JSEventRing owned
+ * by the receiver, which parses it when it runs its pending jobs
+ * (JS_ProcessTimers()). The receiving task is only woken up when its
+ * ring was empty.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cutils.h"
+#include "mquickjs.h"
+#include "mqjs_worker.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#else
+#include <errno.h>
+#include <time.h>
+#include <sys/time.h>
+#include <pthread.h>
+#endif
+
+#ifndef MQJS_WORKER_MEM_SIZE
+#define MQJS_WORKER_MEM_SIZE (64 * 1024)
+#endif
+/* size of the message ring of each context */
+#ifndef MQJS_WORKER_RING_SIZE
+#define MQJS_WORKER_RING_SIZE (8 * 1024)
+#endif
+#ifndef MQJS_WORKER_CORE
+#define MQJS_WORKER_CORE 1
+#endif
+#ifdef ESP_PLATFORM
+/* single core chips (ESP32-C3, C6, H2...) only have core 0 */
+#define WORKER_CORE min_int(MQJS_WORKER_CORE, portNUM_PROCESSORS - 1)
+#endif
+#ifndef MQJS_WORKER_STACK_SIZE
+#define MQJS_WORKER_STACK_SIZE 8192
+#endif
+#ifndef MQJS_WORKER_PRIORITY
+#define MQJS_WORKER_PRIORITY 5
+#endif
+
+/* stdlib of the REPL (mqjs_stdlib.h in mqjs.c) */
+extern const JSSTDLibraryDef js_stdlib;
+
+typedef struct {
+    JSContext *ctx; /* NULL until the context is started */
+    JSEventRing ring; /* messages sent to this context */
+    uint32_t ring_buf[MQJS_WORKER_RING_SIZE / 4];
+#ifdef ESP_PLATFORM
+    TaskHandle_t task;
+#else
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    BOOL signaled;
+#endif
+} JSWorkerEndpoint;
+
+/* 0 = main context, 1 = worker */
+static JSWorkerEndpoint js_worker_ep[2];
+static BOOL js_worker_started;
+static char *js_worker_source;
+static size_t js_worker_source_len;
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t size;
+    BOOL out_of_memory;
+} JSMessageBuf;
+
+static JSWorkerEndpoint *worker_get_endpoint(JSContext *ctx)
+{
+    if (!js_worker_started)
+        return NULL;
+    if (js_worker_ep[0].ctx == ctx)
+        return &js_worker_ep[0];
+    if (js_worker_ep[1].ctx == ctx)
+        return &js_worker_ep[1];
+    return NULL;
+}
+
+static void worker_wakeup(JSWorkerEndpoint *ep)
+{
+#ifdef ESP_PLATFORM
+    if (ep->task)
+        xTaskNotifyGive(ep->task);
+#else
+    pthread_mutex_lock(&ep->lock);
+    ep->signaled = TRUE;
+    pthread_cond_signal(&ep->cond);
+    pthread_mutex_unlock(&ep->lock);
+#endif
+}
+
+/* wait for a message or at most 'delay' ms (forever if delay < 0) */
+static void worker_wait(JSWorkerEndpoint *ep, int64_t delay)
+{
+#ifdef ESP_PLATFORM
+    ulTaskNotifyTake(pdTRUE, delay < 0 ? portMAX_DELAY : pdMS_TO_TICKS(delay));
+#else
+    struct timespec ts;
+    struct timeval tv;
+    int64_t ns;
+
+    pthread_mutex_lock(&ep->lock);
+    if (delay < 0) {
+        while (!ep->signaled)
+            pthread_cond_wait(&ep->cond, &ep->lock);
+    } else {
+        gettimeofday(&tv, NULL);
+        ns = (int64_t)tv.tv_usec * 1000 + delay * 1000000;
+        ts.tv_sec = tv.tv_sec + ns / 1000000000;
+        ts.tv_nsec = ns % 1000000000;
+        while (!ep->signaled) {
+            if (pthread_cond_timedwait(&ep->cond, &ep->lock, &ts) == ETIMEDOUT)
+                break;
+        }
+    }
+    ep->signaled = FALSE;
+    pthread_mutex_unlock(&ep->lock);
+#endif
+}
+
+static void worker_dump_error(JSContext *ctx)
+{
+    JSValue obj;
+    obj = JS_GetException(ctx);
+    fprintf(stderr, "worker: ");
+    JS_PrintValueF(ctx, obj, JS_DUMP_LONG);
+    fprintf(stderr, "\n");
+}
+
+static void worker_log_func(void *opaque, const void *buf, size_t buf_len)
+{
+    fwrite(buf, 1, buf_len, stderr);
+}
+
+/* parse a received message and give it to onmessage() */
+static int worker_message_handler(JSContext *ctx, void *opaque,
+                                  const uint8_t *data, size_t len)
+{
+    JSGCRef parser_ref, msg_ref;
+    JSValue *pparser, *pmsg, func;
+    int ret;
+
+    pparser = JS_PushGCRef(ctx, &parser_ref);
+    pmsg = JS_PushGCRef(ctx, &msg_ref);
+    ret = -1;
+    /* an empty message is sent for values without a JSON
+       representation */
+    if (len != 0) {
+        *pparser = JS_NewJSONParser(ctx, JS_UNDEFINED, 1);
+        if (JS_IsException(*pparser))
+            goto done;
+        if (JS_WriteJSONParser(ctx, *pparser, data, len))
+            goto done;
+        *pmsg = JS_EndJSONParser(ctx, *pparser);
+        if (JS_IsException(*pmsg))
+            goto done;
+    }
+    /* may trigger a GC, so done before reading 'func' */
+    if (JS_StackCheck(ctx, 3))
+        goto done;
+    func = JS_GetPropertyStr(ctx, JS_GetGlobalObject(ctx), "onmessage");
+    if (JS_IsException(func))
+        goto done;
+    if (JS_IsFunction(ctx, func)) {
+        JS_PushArg(ctx, *pmsg);
+        JS_PushArg(ctx, func);
+        JS_PushArg(ctx, JS_NULL); /* this */
+        if (JS_IsException(JS_Call(ctx, 1)))
+            goto done;
+    }
+    ret = 0;
+ done:
+    JS_PopGCRef(ctx, &msg_ref);
+    JS_PopGCRef(ctx, &parser_ref);
+    return ret;
+}
+
+static void worker_endpoint_init(JSWorkerEndpoint *ep)
+{
+    JS_InitEventRing(&ep->ring, ep->ring_buf, sizeof(ep->ring_buf),
+                     worker_message_handler, NULL);
+#ifndef ESP_PLATFORM
+    pthread_mutex_init(&ep->lock, NULL);
+    pthread_cond_init(&ep->cond, NULL);
+    ep->signaled = FALSE;
+#endif
+}
+
+static void worker_run(void)
+{
+    JSWorkerEndpoint *ep = &js_worker_ep[1];
+    JSContext *ctx;
+    uint8_t *mem_buf;
+    JSValue val;
+    int64_t delay;
+
+    mem_buf = malloc(MQJS_WORKER_MEM_SIZE);
+    if (!mem_buf) {
+        fprintf(stderr, "worker: not enough memory\n");
+        return;
+    }
+    ctx = JS_NewContext(mem_buf, MQJS_WORKER_MEM_SIZE, &js_stdlib);
+    JS_SetLogFunc(ctx, worker_log_func);
+    JS_AddEventRing(ctx, &ep->ring);
+    ep->ctx = ctx;
+
+    val = JS_Eval(ctx, js_worker_source, js_worker_source_len, "<worker>", 0);
+    free(js_worker_source);
+    js_worker_source = NULL;
+    if (JS_IsException(val))
+        worker_dump_error(ctx);
+
+    /* the worker lives as long as the application */
+    for(;;) {
+        delay = JS_ProcessTimers(ctx);
+        if (delay == -2) {
+            worker_dump_error(ctx);
+            continue;
+        }
+        if (delay != 0)
+            worker_wait(ep, delay);
+    }
+}
+
+#ifdef ESP_PLATFORM
+static void worker_task(void *arg)
+{
+    worker_run();
+    vTaskDelete(NULL);
+}
+#else
+static void *worker_thread(void *arg)
+{
+    worker_run();
+    return NULL;
+}
+#endif
+
+int mqjs_worker_start(JSContext *ctx, const char *source, size_t len)
+{
+    if (js_worker_started)
+        return -1;
+    js_worker_source = malloc(len + 1);
+    if (!js_worker_source)
+        return -1;
+    memcpy(js_worker_source, source, len);
+    js_worker_source[len] = '\0';
+    js_worker_source_len = len;
+
+    worker_endpoint_init(&js_worker_ep[0]);
+    worker_endpoint_init(&js_worker_ep[1]);
+    js_worker_ep[0].ctx = ctx;
+    JS_AddEventRing(ctx, &js_worker_ep[0].ring);
+    js_worker_started = TRUE;
+#ifdef ESP_PLATFORM
+    js_worker_ep[0].task = xTaskGetCurrentTaskHandle();
+    if (xTaskCreatePinnedToCore(worker_task, "mqjs_worker",
+                                MQJS_WORKER_STACK_SIZE, NULL,
+                                MQJS_WORKER_PRIORITY, &js_worker_ep[1].task,
+                                WORKER_CORE) != pdPASS)
+        goto fail;
+#else
+    {
+        pthread_t tid;
+        if (pthread_create(&tid, NULL, worker_thread, NULL))
+            goto fail;
+        pthread_detach(tid);
+    }
+#endif
+    return 0;
+ fail:
+    JS_RemoveEventRing(ctx, &js_worker_ep[0].ring);
+    js_worker_ep[0].ctx = NULL;
+    js_worker_started = FALSE;
+    free(js_worker_source);
+    js_worker_source = NULL;
+    return -1;
+}
+
+JSValue js_startWorker(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    JSCStringBuf buf;
+    const char *source;
+    size_t len;
+
+    if (js_worker_started)
+        return JS_ThrowInternalError(ctx, "worker already started");
+    source = JS_ToCStringLen(ctx, &len, argv[0], &buf);
+    if (!source)
+        return JS_EXCEPTION;
+    if (mqjs_worker_start(ctx, source, len))
+        return JS_ThrowInternalError(ctx, "could not start the worker");
+    return JS_UNDEFINED;
+}
+
+static void message_buf_write(void *opaque, const void *data, size_t len)
+{
+    JSMessageBuf *mb = opaque;
+    size_t new_size;
+    uint8_t *new_buf;
+
+    if (mb->out_of_memory)
+        return;
+    if (mb->len + len > mb->size) {
+        new_size = max_size_t(mb->len + len, mb->size * 3 / 2 + 64);
+        new_buf = realloc(mb->buf, new_size);
+        if (!new_buf) {
+            mb->out_of_memory = TRUE;
+            return;
+        }
+        mb->buf = new_buf;
+        mb->size = new_size;
+    }
+    memcpy(mb->buf + mb->len, data, len);
+    mb->len += len;
+}
+
+JSValue js_postMessage(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv)
+{
+    JSWorkerEndpoint *ep, *peer;
+    JSMessageBuf mb;
+    int ret;
+
+    ep = worker_get_endpoint(ctx);
+    if (!ep)
+        return JS_ThrowInternalError(ctx, "no worker");
+    peer = &js_worker_ep[1 - (ep - js_worker_ep)];
+
+    memset(&mb, 0, sizeof(mb));
+    if (JS_StringifyToSink(ctx, argv[0], message_buf_write, &mb)) {
+        free(mb.buf);
+        return JS_EXCEPTION;
+    }
+    if (mb.out_of_memory) {
+        free(mb.buf);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    ret = JS_PostEvent(&peer->ring, mb.buf, mb.len);
+    free(mb.buf);
+    if (ret < 0)
+        return JS_ThrowRangeError(ctx, "message queue full");
+    if (ret > 0)
+        worker_wakeup(peer);
+    return JS_UNDEFINED;
+}
@@ -0,0 +1,20 @@
+/*
+ * MicroQuickJS worker
+ * Second isolated context on its own task (pinned to the other core
+ * on ESP32) exchanging JSON messages with the main context
+ */
+#ifndef MQJS_WORKER_H
+#define MQJS_WORKER_H
+
+#include "mquickjs.h"
+
+/* Start the worker context and evaluate 'source' in it. Must be
+   called from the task running 'ctx', which becomes the main
+   context. Return 0 if OK, -1 if error. */
+int mqjs_worker_start(JSContext *ctx, const char *source, size_t len);
+
+/* JavaScript binding functions */
+JSValue js_startWorker(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_postMessage(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+
+#endif /* MQJS_WORKER_H */
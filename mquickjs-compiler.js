@@ -94,6 +94,114 @@ class MQuickJSCompiler {
         }
     }
 
+    /**
+     * Compile JavaScript source to the compact transport format
+     *
+     * The output is smaller than the bytecode image and does not
+     * depend on the target address or word size. The device expands
+     * it in RAM when loading it.
+     *
+     * @param {string} sourceCode - JavaScript source code
+     * @returns {Promise<Uint8Array>} - Compact bytecode
+     * @throws {Error} - Compilation error with message
+     */
+    async compileCompact(sourceCode) {
+        if (!this.ready) {
+            await this.init();
+        }
+
+        const sourceLen = sourceCode.length;
+        const sourcePtr = this.module._malloc(sourceLen + 1);
+
+        try {
+            this.module.stringToUTF8(sourceCode, sourcePtr, sourceLen + 1);
+
+            const result = this.module._compile_js_to_compact_bytecode(sourcePtr, sourceLen);
+            if (result < 0) {
+                const errorPtr = this.module._get_error_message();
+                throw new Error(this.module.UTF8ToString(errorPtr));
+            }
+
+            const bytecodePtr = this.module._get_bytecode_buffer();
+            const bytecodeSize = this.module._get_bytecode_size();
+            const bytecode = new Uint8Array(bytecodeSize);
+            bytecode.set(this.module.HEAPU8.subarray(bytecodePtr, bytecodePtr + bytecodeSize));
+            return bytecode;
+        } finally {
+            this.module._free(sourcePtr);
+        }
+    }
+
+    /**
+     * Compile several JavaScript files in one call
+     *
+     * Each file gives a separate bytecode image. The compiler keeps the
+     * outputs of the recently compiled sources, so only the files which
+     * changed since the previous call are compiled again.
+     *
+     * @param {string[]} sources - JavaScript source codes
+     * @param {object} options - Compilation options (see compile())
+     * @returns {Promise<Array<{bytecode: Uint8Array|null, error: string|null}>>}
+     */
+    async compileBatch(sources, options = {}) {
+        if (!this.ready) {
+            await this.init();
+        }
+
+        const targetAddr = options.targetAddr || 0;
+        const use32Bit = options.use32Bit !== false; // Default true
+        const count = sources.length;
+        const ptrs = [];
+
+        // Arrays of source pointers and lengths (32-bit WASM pointers)
+        const ptrArray = this.module._malloc(count * 4);
+        const lenArray = this.module._malloc(count * 4);
+
+        try {
+            for (let i = 0; i < count; i++) {
+                const size = this.module.lengthBytesUTF8(sources[i]);
+                const ptr = this.module._malloc(size + 1);
+                ptrs.push(ptr);
+                this.module.stringToUTF8(sources[i], ptr, size + 1);
+                this.module.HEAPU32[(ptrArray >> 2) + i] = ptr;
+                this.module.HEAPU32[(lenArray >> 2) + i] = size;
+            }
+
+            const result = this.module._compile_js_batch(
+                count,
+                ptrArray,
+                lenArray,
+                targetAddr,
+                use32Bit ? 1 : 0
+            );
+            if (result < 0) {
+                throw new Error('Out of memory');
+            }
+
+            const outputs = [];
+            for (let i = 0; i < count; i++) {
+                const size = this.module._get_batch_bytecode_size(i);
+                if (size < 0) {
+                    const errorPtr = this.module._get_batch_error_message(i);
+                    outputs.push({ bytecode: null, error: this.module.UTF8ToString(errorPtr) });
+                } else {
+                    const bytecodePtr = this.module._get_batch_bytecode(i);
+                    const bytecode = new Uint8Array(size);
+                    bytecode.set(this.module.HEAPU8.subarray(bytecodePtr, bytecodePtr + size));
+                    outputs.push({ bytecode: bytecode, error: null });
+                }
+            }
+            return outputs;
+
+        } finally {
+            for (const ptr of ptrs) {
+                this.module._free(ptr);
+            }
+            this.module._free(ptrArray);
+            this.module._free(lenArray);
+        }
+    }
+
     /**
      * Validate JavaScript syntax without generating full bytecode
      *
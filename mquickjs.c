@@ -106,7 +106,7 @@ typedef struct {
 #if JSW == 8
 #define JS_STRING_LEN_MAX 0x7ffffffe
 #else
-#define JS_STRING_LEN_MAX ((1 << (32 - JS_MTAG_BITS - 3)) - 1)
+#define JS_STRING_LEN_MAX ((1 << (32 - JS_MTAG_BITS - 4)) - 1)
 #endif
 
 typedef struct {
@@ -116,7 +116,11 @@ typedef struct {
     /* true if the string content represents a number, only meaningful
        is is_unique = true */
     JSWord is_numeric: 1;
-    JSWord len: JS_MB_PAD(JS_MTAG_BITS + 3);
+    JSWord len: JS_MB_PAD(JS_MTAG_BITS + 4);
+    /* true if the content is not stored in 'buf' but in a rope buffer
+       (see js_rope_concat()). Last bit so that the layout of the
+       other fields is unchanged. */
+    JSWord is_rope: 1;
     uint8_t buf[];
 } JSString;
 
@@ -133,6 +137,37 @@ typedef struct {
     uint8_t buf[];
 } JSByteArray;
 
+/* Rope strings: when a long string is built by repeated
+   concatenations, its characters are stored in an append-only rope
+   buffer (a byte array) and the JSString only contains a reference to
+   it. The string ending at the end of the buffer may be extended
+   without copying, so that 's += x' takes an amortized linear time
+   instead of a quadratic one. The other strings sharing the buffer
+   only see their own prefix of it, hence are not modified. Unlike
+   the flat strings, the characters of a rope string are not always
+   followed by a '\0'. */
+#define JS_ROPE_MIN_LEN 64 /* minimum length of a rope string */
+
+typedef struct {
+    uint32_t len; /* number of used bytes */
+    uint8_t buf[]; /* buf[len] = '\0' */
+} JSRopeBuffer;
+
+static inline JSRopeBuffer *js_get_rope_buffer(const JSString *p)
+{
+    JSByteArray *arr = JS_VALUE_TO_PTR(*(JSValue *)p->buf);
+    return (JSRopeBuffer *)arr->buf;
+}
+
+/* return the characters of a string */
+static inline uint8_t *js_string_buf(const JSString *p)
+{
+    if (unlikely(p->is_rope))
+        return js_get_rope_buffer(p)->buf;
+    else
+        return (uint8_t *)p->buf;
+}
+
 #define JS_VALUE_ARRAY_SIZE_MAX ((1 << (32 - JS_MTAG_BITS)) - 1)
 
 typedef struct {
@@ -181,12 +216,58 @@ typedef struct JSROMClass {
 
 #define N_ROM_ATOM_TABLES_MAX 2
 
+/* CONFIG_THREADED_DISPATCH: the interpreter jumps directly from an
+   opcode to the next one with a label table (GCC labels as values)
+   instead of going through the switch. */
+#if defined(CONFIG_THREADED_DISPATCH) && defined(__GNUC__) && \
+    !defined(DUMP_EXEC) && !defined(DUMP_OPCODE_STATS)
+#define USE_THREADED_DISPATCH
+#endif
+
+/* count the executed opcodes and opcode pairs and dump them in
+   JS_FreeContext() */
+//#define DUMP_OPCODE_STATS
+
 /* must be large enough to have a negligible runtime cost and small
    enough to call the interrupt callback often. */
 #define JS_INTERRUPT_COUNTER_INIT 10000
 
-#define JS_STRING_POS_CACHE_SIZE 2
+/* number of entries of the UTF-8 to UTF-16 string position cache */
+#ifndef JS_STRING_POS_CACHE_SIZE
+#define JS_STRING_POS_CACHE_SIZE 8
+#endif
 #define JS_STRING_POS_CACHE_MIN_LEN 16 
+/* a new cache entry is used for a string when the nearest one is
+   further than this distance, so that a long string accessed at
+   several places gets several entries */
+#define JS_STRING_POS_CACHE_MAX_DIST 256
+
+/* number of entries of the get_field/put_field inline caches (must
+   be a power of two) */
+#ifndef JS_FIELD_CACHE_SIZE
+#define JS_FIELD_CACHE_SIZE 32
+#endif
+
+/* number of entries of the shape cache (must be a power of two, 0 to
+   disable the shape sharing) */
+#ifndef JS_SHAPE_CACHE_SIZE
+#define JS_SHAPE_CACHE_SIZE 16
+#endif
+/* maximum number of properties of a shaped object */
+#define JS_SHAPE_PROP_COUNT_MAX 64
+
+/* number of entries of the cache of the regexp byte code compiled by
+   the RegExp constructor (0 to disable) */
+#ifndef JS_REGEXP_CACHE_SIZE
+#define JS_REGEXP_CACHE_SIZE 4
+#endif
+
+/* maximum number of old blocks recorded by the write barrier between
+   two GCs. When more blocks are modified, the next minor GC scans all
+   the old blocks. */
+#ifndef JS_REMEMBERED_SET_SIZE
+#define JS_REMEMBERED_SET_SIZE 64
+#endif
 
 typedef enum {
     POS_TYPE_UTF8,
@@ -198,8 +279,75 @@ typedef struct {
                     contains at least JS_STRING_POS_CACHE_MIN_LEN
                     bytes and is a non ascii string */
     uint32_t str_pos[2]; /* 0 = UTF-8 pos (in bytes), 1 = UTF-16 pos */
+    uint32_t last_use; /* for the LRU replacement */
 } JSStringPosCacheEntry;
 
+typedef struct {
+    JSValue source; /* weak reference: string or JS_NULL */
+    JSValue byte_code; /* weak reference: JSByteArray or JS_NULL */
+    uint32_t last_use;
+} JSRegExpCacheEntry;
+
+/* Inline cache entry for OP_get_field/OP_put_field. The entry is
+   selected from the address of the opcode. It is self validating: a
+   hit only requires that the property table of the object (its shape
+   for shaped objects) is 'props', that its hash table has the same
+   size and that the property at offset 'prop_ofs' has the searched
+   key, so no invalidation is needed when properties are modified or
+   when the GC moves the objects. */
+typedef struct {
+    JSValue props; /* not a GC root: only compared to live property tables */
+    JSValue hash_mask; /* short int */
+    uint32_t prop_ofs; /* offset of the property in 'props' */
+} JSFieldCacheEntry;
+
+/* header of a JS_TempAlloc() block. The blocks are in the stack but
+   do not contain values, so the GC skips them. */
+typedef struct JSTempBlock {
+    struct JSTempBlock *prev; /* higher block, NULL if none */
+    uint32_t len; /* length in JSValues, including the header */
+} JSTempBlock;
+
+#define JS_TEMP_BLOCK_HDR_LEN ((sizeof(JSTempBlock) + JSW - 1) / JSW)
+
+#ifdef CONFIG_HEAP_PROFILE
+/* number of allocation sites recorded by the heap profiler. The
+   allocations from the other sites are accounted to site 0. */
+#ifndef JS_HEAP_PROFILE_SITES
+#define JS_HEAP_PROFILE_SITES 128
+#endif
+#define JS_HEAP_PROFILE_HASH_SIZE (2 * JS_HEAP_PROFILE_SITES) /* power of 2 */
+
+typedef struct {
+    JSValue func_bytecode; /* GC root. JS_NULL if native code */
+    int pc; /* -1 for site 0 */
+    /* only used in JS_DumpHeapProfile() */
+    int line_num;
+    uint32_t size;
+    uint32_t count;
+} JSHeapProfileSite;
+
+typedef struct {
+    uint32_t offset; /* offset of the memory block from heap_base */
+    uint32_t site; /* index in 'sites' */
+} JSHeapProfileRecord;
+
+/* stored in the buffer given to JS_EnableHeapProfile() */
+typedef struct JSHeapProfile {
+    int sites_len;
+    JSHeapProfileSite sites[JS_HEAP_PROFILE_SITES];
+    /* index + 1 in 'sites', rebuilt after each GC because the GC
+       moves the function bytecodes */
+    uint16_t hash[JS_HEAP_PROFILE_HASH_SIZE];
+    uint32_t records_lost; /* not recorded because 'records' was full */
+    uint32_t records_len;
+    uint32_t records_size;
+    /* one record per memory block allocated since the start of the
+       profiling, sorted by offset */
+    JSHeapProfileRecord records[];
+} JSHeapProfile;
+#endif
+
 struct JSContext {
     /* memory map:
        Stack
@@ -210,36 +358,82 @@ struct JSContext {
     uint8_t *heap_base;
     uint8_t *heap_free; /* first free area */
     uint8_t *stack_top;
+    /* the blocks below 'gc_base' are not collected by the current GC
+       (equal to heap_base except during a minor GC) */
+    uint8_t *gc_base;
+    uint8_t *young_start; /* start of the blocks allocated since the last GC */
+#ifdef CONFIG_GC_NURSERY
+    /* number of old blocks referencing young blocks found during a
+       minor GC, -1 if too many. They are stored at heap_free. */
+    int gc_remembered_len;
+    /* old blocks where a reference to a young block was stored since
+       the last GC (see js_write_barrier()). Greater than
+       JS_REMEMBERED_SET_SIZE if the set overflowed. */
+    int remembered_set_len;
+    void *remembered_set[JS_REMEMBERED_SET_SIZE];
+    /* TRUE if the last minor GC left too little memory for the next
+       young generation: the next GC is a full one */
+    BOOL gc_full_pending;
+#ifdef DEBUG_GC
+    int debug_gc_count;
+#endif
+#endif
     JSValue *stack_bottom; /* sp must always be higher than stack_bottom */
     JSValue *sp; /* current stack pointer */
     JSValue *fp; /* current frame pointer, stack_top if none */
+    struct JSTempBlock *temp_blocks; /* JS_TempAlloc() blocks in the
+                                        stack, lowest address first */
+#ifdef CONFIG_HEAP_PROFILE
+    struct JSHeapProfile *heap_profile; /* NULL if not profiling */
+#endif
     uint32_t min_free_size; /* min free size between heap_free and the
                                bottom of the stack */
     BOOL in_out_of_memory : 8; /* != 0 if generating the out of memory object */
     uint8_t n_rom_atom_tables;
-    uint8_t string_pos_cache_counter; /* used for string_pos_cache[] update */
     uint16_t class_count; /* number of classes including user classes */
     int16_t interrupt_counter;
     BOOL current_exception_is_uncatchable : 8;
     struct JSParseState *parse_state; /* != NULL during JS_Eval() */
     int unique_strings_len;
+    BOOL unique_strings_sorted : 8; /* unique_strings is a sorted array
+                                       instead of a hash table */
+    uint8_t atom_hash_bits; /* see JSSTDLibraryDef */
+    uint8_t atom_bucket_bits;
     int js_call_rec_count; /* number of recursing JS_Call() */
     JSGCRef *top_gc_ref; /* used to reference temporary GC roots (stack top) */
     JSGCRef *last_gc_ref; /* used to reference temporary GC roots (list) */
     const JSWord *atom_table; /* constant atom table */
     /* 'n_rom_atom_tables' atom tables from code loaded from rom */
     const JSValueArray *rom_atom_tables[N_ROM_ATOM_TABLES_MAX];
+    const uint16_t *atom_hash_table; /* perfect hash of rom_atom_tables[0] or NULL */
     const JSCFunctionDef *c_function_table;
     const JSCFinalizer *c_finalizer_table;
     uint64_t random_state;
     JSInterruptHandler *interrupt_handler;
+    JSClockFunc *clock_func; /* used to measure the GC pauses */
+    uint32_t heap_size_max; /* high-water mark of the heap size */
+    uint32_t stack_size_max; /* high-water mark of the stack size */
+    uint32_t free_size_min; /* low-water mark of the free memory */
+    JSGCStats gc_stats;
     JSWriteFunc *write_func; /* for the various dump functions */
     void *opaque;
+    JSEventRing *event_rings; /* rings drained by JS_RunPendingJobs() */
+    JSContextFreeHook *free_hooks; /* called by JS_FreeContext() */
     JSValue *class_obj; /* same as class_proto + class_count */
+    uint32_t string_pos_cache_clock; /* used for string_pos_cache[] update */
     JSStringPosCacheEntry string_pos_cache[JS_STRING_POS_CACHE_SIZE];
+    JSFieldCacheEntry get_field_cache[JS_FIELD_CACHE_SIZE];
+    JSFieldCacheEntry put_field_cache[JS_FIELD_CACHE_SIZE];
+#if JS_SHAPE_CACHE_SIZE > 0
+    JSValue shape_cache[JS_SHAPE_CACHE_SIZE]; /* weak references to shapes */
+#endif
+#if JS_REGEXP_CACHE_SIZE > 0
+    uint32_t regexp_cache_clock;
+    JSRegExpCacheEntry regexp_cache[JS_REGEXP_CACHE_SIZE];
+#endif
                                            
     /* must only contain JSValue from this point (see JS_GC()) */
-    JSValue unique_strings; /* JSValueArray of sorted strings or JS_NULL */
+    JSValue unique_strings; /* JSValueArray hash table of strings or JS_NULL */
     
     JSValue current_exception; /* currently pending exception, must
                                   come after unique_strings */
@@ -249,6 +443,8 @@ struct JSContext {
     JSValue empty_props; /* empty prop list, for objects with no properties */
     JSValue global_obj;
     JSValue minus_zero; /* minus zero float64 value */
+    JSValue job_first; /* JSValueArray [next, func, args...] or JS_NULL */
+    JSValue job_last;
     JSValue class_proto[]; /* prototype for each class (class_count
                               element, then class_count elements for
                               class_obj */
@@ -297,13 +493,20 @@ typedef struct {
 } JSErrorData;
     
 typedef struct {
-    JSValue byte_buffer; /* JSByteBuffer */
+    JSValue byte_buffer; /* JSByteBuffer or JS_NULL if external */
+    /* the following fields are only present for external buffers
+       (extra_size > 1) */
+    uint8_t *buf;
+    uint32_t len;
+    JSFreeArrayBufferDataFunc *free_func;
+    void *opaque;
 } JSArrayBuffer;
 
+/* also used for DataView */
 typedef struct {
     JSValue buffer; /* corresponding array buffer */
-    uint32_t len; /* in elements */
-    uint32_t offset; /* in elements */
+    uint32_t len; /* in elements (bytes for DataView) */
+    uint32_t offset; /* in elements (bytes for DataView) */
 } JSTypedArray;
 
 typedef struct {
@@ -312,6 +515,19 @@ typedef struct {
     int last_index;
 } JSRegExp;
 
+typedef struct {
+    JSValue stack; /* JSValueArray: (container, key or index) per open level */
+    JSValue token; /* JSByteArray: pending string, number or literal */
+    JSValue callback; /* function or JS_UNDEFINED */
+    JSValue result;
+    uint8_t state;
+    uint8_t is_busy; /* TRUE while write() is running */
+    uint16_t emit_depth; /* depth of the values given to the callback */
+    int depth; /* number of open arrays and objects */
+    int token_len;
+    uint32_t pos; /* number of bytes consumed, for the error messages */
+} JSJSONParser;
+
 typedef struct {
     void *opaque;
 } JSObjectUserData;
@@ -327,6 +543,10 @@ struct JSObject {
        hash_mask (= hash_size - 1)
        hash_table[hash_size] (0 = end of list or offset in array)
        JSProperty props[]
+       
+       or, for a shaped object (see js_object_share_shape()):
+       shape (property table whose values are the value indexes)
+       values[prop_count]
     */
     JSValue props;
     /* number of additional fields depends on the object */
@@ -338,6 +558,7 @@ struct JSObject {
         JSArrayBuffer array_buffer;
         JSTypedArray typed_array;
         JSRegExp regexp;
+        JSJSONParser json_parser;
         JSObjectUserData user;
     } u;
 };
@@ -353,7 +574,7 @@ typedef struct JSFunctionBytecode {
 
     JSValue func_name; /* JS_NULL if anonymous function */
     JSValue byte_code; /* JS_NULL if the function is not parsed yet */
-    JSValue cpool; /* constant pool */
+    JSValue cpool; /* constant pool (source string if not parsed yet) */
     JSValue vars; /* only for debug */
     JSValue ext_vars; /* records of (var_name, var_kind (2 bits) var_idx (16 bits)) */
     uint16_t stack_size; /* maximum stack size */
@@ -364,9 +585,11 @@ typedef struct JSFunctionBytecode {
 } JSFunctionBytecode;
 
 static JSValue js_resize_value_array(JSContext *ctx, JSValue val, int new_size);
+static int js_compile_lazy_function(JSContext *ctx, JSValue bfunc);
 static int get_mblock_size(const void *ptr);
 static JSValue JS_NewObjectProtoClass(JSContext *ctx, JSValue proto, int class_id, int extra_size);
 static void js_shrink_byte_array(JSContext *ctx, JSValue *pval, int new_size);
+static void js_array_buffer_finalizer(JSContext *ctx, JSObject *p);
 static void build_backtrace(JSContext *ctx, JSValue error_obj,
                             const char *filename, int line_num, int col_num, int skip_level);
 static JSValue JS_ToPropertyKey(JSContext *ctx, JSValue val);
@@ -377,6 +600,15 @@ static int JS_ToUint8Clamp(JSContext *ctx, int *pres, JSValue val);
 static JSValue js_set_prototype_internal(JSContext *ctx, JSValue obj, JSValue proto);
 static JSValue js_resize_byte_array(JSContext *ctx, JSValue val, int new_size);
 static JSValueArray *js_alloc_props(JSContext *ctx, int n);
+static JSValueArray *js_alloc_value_array(JSContext *ctx, int init_base, int new_size);
+static void js_shrink_value_array(JSContext *ctx, JSValue *pval, int new_size);
+static void rqsort_idx(size_t nmemb,
+                       int (*cmp)(size_t, size_t, void *),
+                       void (*swap)(size_t, size_t, void *),
+                       void *opaque);
+#ifdef DUMP_OPCODE_STATS
+static void dump_opcode_stats(JSContext *ctx);
+#endif
 
 typedef enum OPCodeFormat {
 #define FMT(f) OP_FMT_ ## f,
@@ -398,7 +630,7 @@ typedef enum OPCodeEnum {
 } OPCodeEnum;
 
 typedef struct {
-#ifdef DUMP_BYTECODE
+#if defined(DUMP_BYTECODE) || defined(DUMP_OPCODE_STATS)
     const char *name;
 #endif
     uint8_t size; /* in bytes */
@@ -411,7 +643,7 @@ typedef struct {
 
 static __maybe_unused const JSOpCode opcode_info[OP_COUNT] = {
 #define FMT(f)
-#ifdef DUMP_BYTECODE
+#if defined(DUMP_BYTECODE) || defined(DUMP_OPCODE_STATS)
 #define DEF(id, size, n_pop, n_push, f) { #id, size, n_pop, n_push, OP_FMT_ ## f },
 #else
 #define DEF(id, size, n_pop, n_push, f) { size, n_pop, n_push, OP_FMT_ ## f },
@@ -495,17 +727,69 @@ static int js_get_mtag(void *ptr)
     return ((JSMemBlockHeader *)ptr)->mtag;
 }
 
+/* JS_GCIdle() does nothing if less than 1/2^JS_GC_IDLE_MIN_LOG2 of the
+   memory was allocated since the last GC */
+#ifndef JS_GC_IDLE_MIN_LOG2
+#define JS_GC_IDLE_MIN_LOG2 3
+#endif
+
+#ifdef CONFIG_GC_NURSERY
+/* a full GC is done instead of a minor one if the young generation
+   is smaller than 1/2^JS_GC_NURSERY_MIN_LOG2 of the memory */
+#ifndef JS_GC_NURSERY_MIN_LOG2
+#define JS_GC_NURSERY_MIN_LOG2 2
+#endif
+
+static void JS_GCMinor(JSContext *ctx);
+#endif
+
+#ifdef CONFIG_HEAP_PROFILE
+static void js_heap_profile_record(JSContext *ctx, void *ptr);
+#endif
+
 static int check_free_mem(JSContext *ctx, JSValue *stack_bottom, uint32_t size)
 {
 #ifdef DEBUG_GC
     assert(ctx->sp >= stack_bottom);
     /* don't start the GC before dummy_block is allocated */
     if (JS_IsPtr(ctx->dummy_block)) {
+#ifdef CONFIG_GC_NURSERY
+        /* alternate the minor and major collections */
+        if (ctx->debug_gc_count++ & 1)
+            JS_GCMinor(ctx);
+        else
+#endif
         JS_GC(ctx);
     }
 #endif
     if (((uint8_t *)stack_bottom - ctx->heap_free) < size + ctx->min_free_size) {
+#ifdef CONFIG_GC_NURSERY
+        uint32_t nursery_min_size, young_size, free_size;
+        /* try a minor collection first. A full collection is done
+           instead if the young generation is too small to free a
+           significant amount of memory, if freeing all of it would
+           not leave enough memory for the next young generation or if
+           the last minor collection asked for it. Both collections
+           are only done in a row when the young blocks that survived
+           leave no room for the allocation. */
+        nursery_min_size = (ctx->stack_top - ctx->heap_base) >> JS_GC_NURSERY_MIN_LOG2;
+        young_size = ctx->heap_free - ctx->young_start;
+        free_size = (uint8_t *)stack_bottom - ctx->heap_free;
+        if (!ctx->gc_full_pending &&
+            young_size >= nursery_min_size &&
+            free_size + young_size >= size + ctx->min_free_size + nursery_min_size) {
+            JS_GCMinor(ctx);
+            free_size = (uint8_t *)stack_bottom - ctx->heap_free;
+            if (free_size < size + ctx->min_free_size)
+                JS_GC(ctx);
+            else if (free_size < size + ctx->min_free_size + nursery_min_size)
+                ctx->gc_full_pending = TRUE;
+        } else {
+            JS_GC(ctx);
+        }
+#else
         JS_GC(ctx);
+#endif
         if (((uint8_t *)stack_bottom - ctx->heap_free) < size + ctx->min_free_size) {
             JS_ThrowOutOfMemory(ctx);
             return -1;
@@ -514,6 +798,13 @@ static int check_free_mem(JSContext *ctx, JSValue *stack_bottom, uint32_t size)
     return 0;
 }
 
+static inline void update_free_size_min(JSContext *ctx)
+{
+    uint32_t free_size = (uint8_t *)ctx->stack_bottom - ctx->heap_free;
+    if (free_size < ctx->free_size_min)
+        ctx->free_size_min = free_size;
+}
+
 /* check that 'len' values can be pushed on the stack. Return 0 if OK,
    -1 if not enough space. May trigger a GC(). */
 int JS_StackCheck(JSContext *ctx, uint32_t len)
@@ -525,6 +816,9 @@ int JS_StackCheck(JSContext *ctx, uint32_t len)
     if (check_free_mem(ctx, new_stack_bottom, len * sizeof(JSValue)))
         return -1;
     ctx->stack_bottom = new_stack_bottom;
+    if ((ctx->stack_top - (uint8_t *)new_stack_bottom) > ctx->stack_size_max)
+        ctx->stack_size_max = ctx->stack_top - (uint8_t *)new_stack_bottom;
+    update_free_size_min(ctx);
     return 0;
 }
 
@@ -541,10 +835,15 @@ static void *js_malloc(JSContext *ctx, uint32_t size, int mtag)
     
     p = (JSMemBlockHeader *)ctx->heap_free;
     ctx->heap_free += size;
+    update_free_size_min(ctx);
 
     p->mtag = mtag;
     p->gc_mark = 0;
     p->dummy = 0;
+#ifdef CONFIG_HEAP_PROFILE
+    if (unlikely(ctx->heap_profile != NULL))
+        js_heap_profile_record(ctx, p);
+#endif
     return p;
 }
 
@@ -568,8 +867,14 @@ static void js_free(JSContext *ctx, void *ptr)
         return;
     ptr1 = ptr;
     ptr1 += get_mblock_size(ptr1);
-    if (ptr1 == ctx->heap_free)
+    if (ptr1 == ctx->heap_free) {
+        if ((ctx->heap_free - ctx->heap_base) > ctx->heap_size_max)
+            ctx->heap_size_max = ctx->heap_free - ctx->heap_base;
         ctx->heap_free = ptr;
+        /* a block must not straddle the young generation start */
+        if (ctx->heap_free < ctx->young_start)
+            ctx->young_start = ctx->heap_free;
+    }
 }
 
 /* 'size' is in bytes and must be multiple of JSW and > 0 */
@@ -605,6 +910,65 @@ static void *js_shrink(JSContext *ctx, void *ptr, uint32_t new_size)
     return ptr;
 }
 
+#ifdef CONFIG_GC_NURSERY
+/* add the old block 'ptr' to the remembered set. The GC marks are
+   only used during a GC, so the mark of an old block indicates that
+   it is already in the set. */
+static no_inline void js_remember_block(JSContext *ctx, void *ptr)
+{
+    JSMemBlockHeader *mb = ptr;
+    if (mb->gc_mark)
+        return;
+    if (ctx->remembered_set_len >= JS_REMEMBERED_SET_SIZE) {
+        ctx->remembered_set_len = JS_REMEMBERED_SET_SIZE + 1;
+        return;
+    }
+    mb->gc_mark = 1;
+    ctx->remembered_set[ctx->remembered_set_len++] = ptr;
+}
+
+/* Write barrier: must be called when 'val' is stored in the memory
+   block 'ptr', except if 'ptr' was just allocated. A minor GC only
+   scans the old blocks in which a young block reference was
+   stored. */
+static force_inline void js_write_barrier(JSContext *ctx, void *ptr, JSValue val)
+{
+    if (JS_IsPtr(val) &&
+        (uintptr_t)((uint8_t *)JS_VALUE_TO_PTR(val) - ctx->young_start) <
+        (uintptr_t)(ctx->heap_free - ctx->young_start) &&
+        (uintptr_t)((uint8_t *)ptr - ctx->heap_base) <
+        (uintptr_t)(ctx->young_start - ctx->heap_base)) {
+        js_remember_block(ctx, ptr);
+    }
+}
+
+/* clear the marks of the remembered blocks before a GC. The set
+   itself is kept until the end of a minor GC. The blocks above
+   'young_start' were freed by js_free(). */
+static void js_clear_remembered_marks(JSContext *ctx)
+{
+    JSMemBlockHeader *mb;
+    int i, n;
+
+    n = min_int(ctx->remembered_set_len, JS_REMEMBERED_SET_SIZE);
+    for(i = 0; i < n; i++) {
+        mb = ctx->remembered_set[i];
+        if ((uint8_t *)mb < ctx->young_start)
+            mb->gc_mark = 0;
+    }
+}
+#else
+static inline void js_write_barrier(JSContext *ctx, void *ptr, JSValue val)
+{
+}
+#endif
+
+/* write barrier for a store into a property value of 'p' */
+static inline void js_prop_write_barrier(JSContext *ctx, JSObject *p, JSValue val)
+{
+    js_write_barrier(ctx, JS_VALUE_TO_PTR(p->props), val);
+}
+
 JSValue JS_Throw(JSContext *ctx, JSValue obj)
 {
     ctx->current_exception = obj;
@@ -811,7 +1175,7 @@ static void js_vprintf(JSWriteFunc *write_func, void *opaque, const char *fmt, v
                     case JS_MTAG_STRING:
                         {
                             JSString *p = ptr;
-                            buf = (char *)p->buf;
+                            buf = (char *)js_string_buf(p);
                             len = p->len;
                         }
                         break;
@@ -1149,6 +1513,25 @@ static JSObject *js_get_object_class(JSContext *ctx, JSValue val, int class_id)
     }
 }
 
+/* 'p' is an ArrayBuffer object */
+static inline uint8_t *js_array_buffer_get_buf(JSObject *p)
+{
+    JSByteArray *arr;
+    if (unlikely(p->u.array_buffer.byte_buffer == JS_NULL))
+        return p->u.array_buffer.buf;
+    arr = JS_VALUE_TO_PTR(p->u.array_buffer.byte_buffer);
+    return arr->buf;
+}
+
+static inline uint32_t js_array_buffer_get_len(JSObject *p)
+{
+    JSByteArray *arr;
+    if (unlikely(p->u.array_buffer.byte_buffer == JS_NULL))
+        return p->u.array_buffer.len;
+    arr = JS_VALUE_TO_PTR(p->u.array_buffer.byte_buffer);
+    return arr->size;
+}
+
 BOOL JS_IsFunction(JSContext *ctx, JSValue val)
 {
     if (!JS_IsPtr(val)) {
@@ -1229,6 +1612,7 @@ static JSString *js_alloc_string(JSContext *ctx, uint32_t buf_len)
     p->is_ascii = FALSE;
     p->is_numeric = FALSE;
     p->len = buf_len;
+    p->is_rope = FALSE;
     p->buf[buf_len] = '\0';
     return p;
 }
@@ -1275,6 +1659,7 @@ static JSString *get_string_ptr(JSContext *ctx, JSStringCharBuf *buf,
         JSString *p = (JSString *)buf;
         p->is_unique = FALSE;
         p->is_ascii = JS_VALUE_GET_SPECIAL_VALUE(val) <= 0x7f;
+        p->is_rope = FALSE;
         p->len = get_short_string(p->buf, val);
         return p;
     } else {
@@ -1282,6 +1667,24 @@ static JSString *get_string_ptr(JSContext *ctx, JSStringCharBuf *buf,
     }
 }
 
+/* return a flat copy of the rope string 'val' */
+static JSValue js_rope_flatten(JSContext *ctx, JSValue val)
+{
+    JSString *p, *p1;
+    JSGCRef val_ref;
+
+    JS_PUSH_VALUE(ctx, val);
+    p = JS_VALUE_TO_PTR(val);
+    p1 = js_alloc_string(ctx, p->len);
+    JS_POP_VALUE(ctx, val);
+    if (!p1)
+        return JS_EXCEPTION;
+    p = JS_VALUE_TO_PTR(val);
+    p1->is_ascii = p->is_ascii;
+    memcpy(p1->buf, js_string_buf(p), p->len);
+    return JS_VALUE_FROM_PTR(p1);
+}
+
 static JSValue js_sub_string_utf8(JSContext *ctx, JSValue val,
                                   uint32_t start0, uint32_t end0)
 {
@@ -1302,7 +1705,7 @@ static JSValue js_sub_string_utf8(JSContext *ctx, JSValue val,
     end = end0 >> 1;
     len = end - start;
     p1 = get_string_ptr(ctx, &buf, val);
-    ptr = p1->buf;
+    ptr = js_string_buf(p1);
     if (!start_surrogate && !end_surrogate && utf8_char_len(ptr[start]) == len) {
         c = utf8_get(ptr + start, &clen);
         return JS_NewStringChar(c);
@@ -1314,7 +1717,7 @@ static JSValue js_sub_string_utf8(JSContext *ctx, JSValue val,
     if (!p)
         return JS_EXCEPTION;
     p1 = get_string_ptr(ctx, &buf, val);
-    ptr = p1->buf;
+    ptr = js_string_buf(p1);
     if (unlikely(start_surrogate || end_surrogate)) {
         uint8_t *q = p->buf;
         p->is_ascii = FALSE;
@@ -1389,6 +1792,7 @@ static JSValue js_byte_array_to_string(JSContext *ctx, JSValue val, int len, BOO
         p->is_unique = FALSE;
         p->is_numeric = FALSE;
         p->len = len;
+        p->is_rope = FALSE;
         return val;
     }
 }
@@ -1429,8 +1833,9 @@ static __maybe_unused void dump_string_pos_cache(JSContext *ctx)
             printf("<empty>\n");
         } else {
             JSString *p = JS_VALUE_TO_PTR(ce->str);
-            printf(" utf8_pos=%" PRIu32 "/%d utf16_pos=%" PRIu32 "\n",
-                   ce->str_pos[POS_TYPE_UTF8], (int)p->len, ce->str_pos[POS_TYPE_UTF16]);
+            printf(" utf8_pos=%" PRIu32 "/%d utf16_pos=%" PRIu32 " last_use=%" PRIu32 "\n",
+                   ce->str_pos[POS_TYPE_UTF8], (int)p->len, ce->str_pos[POS_TYPE_UTF16],
+                   ce->last_use);
         }
     }
 }
@@ -1444,6 +1849,7 @@ static uint32_t js_string_convert_pos(JSContext *ctx, JSValue val, uint32_t pos,
 {
     JSStringCharBuf buf;
     JSString *p;
+    const uint8_t *ptr;
     size_t i, clen, len, start;
     uint32_t d_min, d, j;
     JSStringPosCacheEntry *ce, *ce1;
@@ -1451,6 +1857,7 @@ static uint32_t js_string_convert_pos(JSContext *ctx, JSValue val, uint32_t pos,
     int ce_idx;
 
     p = get_string_ptr(ctx, &buf, val);
+    ptr = js_string_buf(p);
     len = p->len;
     if (p->is_ascii) {
         if (pos_type == POS_TYPE_UTF8)
@@ -1485,15 +1892,26 @@ static uint32_t js_string_convert_pos(JSContext *ctx, JSValue val, uint32_t pos,
             }
         }
     }
-    if (!ce) {
-        /* "random" replacement */
-        ce = &ctx->string_pos_cache[ctx->string_pos_cache_counter];
-        if (++ctx->string_pos_cache_counter == JS_STRING_POS_CACHE_SIZE)
-            ctx->string_pos_cache_counter = 0;
+    if (!ce || d_min > JS_STRING_POS_CACHE_MAX_DIST) {
+        /* replace the least recently used entry. The empty entries
+           have last_use = 0. */
+        ce1 = &ctx->string_pos_cache[0];
+        for(ce_idx = 1; ce_idx < JS_STRING_POS_CACHE_SIZE; ce_idx++) {
+            if (ctx->string_pos_cache[ce_idx].last_use < ce1->last_use)
+                ce1 = &ctx->string_pos_cache[ce_idx];
+        }
+        if (ce) {
+            /* start from the nearest entry of the same string */
+            ce1->str_pos[POS_TYPE_UTF8] = ce->str_pos[POS_TYPE_UTF8];
+            ce1->str_pos[POS_TYPE_UTF16] = ce->str_pos[POS_TYPE_UTF16];
+        } else {
+            ce1->str_pos[POS_TYPE_UTF8] = 0;
+            ce1->str_pos[POS_TYPE_UTF16] = 0;
+        }
+        ce = ce1;
         ce->str = val;
-        ce->str_pos[POS_TYPE_UTF8] = 0;
-        ce->str_pos[POS_TYPE_UTF16] = 0;
     }
+    ce->last_use = ++ctx->string_pos_cache_clock;
     
     i = ce->str_pos[POS_TYPE_UTF8];
     j = ce->str_pos[POS_TYPE_UTF16];
@@ -1509,8 +1927,8 @@ static uint32_t js_string_convert_pos(JSContext *ctx, JSValue val, uint32_t pos,
         for(; i < len; i += clen) {
             if (j == limit)
                 break;
-            clen = utf8_char_len(p->buf[i]);
-            if (clen == 4 && is_valid_len4_utf8(p->buf + i)) {
+            clen = utf8_char_len(ptr[i]);
+            if (clen == 4 && is_valid_len4_utf8(ptr + i)) {
                 if ((j + 1) == limit) {
                     surrogate_flag = 1;
                     break;
@@ -1532,10 +1950,10 @@ static uint32_t js_string_convert_pos(JSContext *ctx, JSValue val, uint32_t pos,
         while (i > start) {
             size_t i0 = i;
             i--;
-            while ((p->buf[i] & 0xc0) == 0x80)
+            while ((ptr[i] & 0xc0) == 0x80)
                 i--;
             clen = i0 - i;
-            if (clen == 4 && is_valid_len4_utf8(p->buf + i)) {
+            if (clen == 4 && is_valid_len4_utf8(ptr + i)) {
                 j -= 2;
                 if ((j + 1) == limit) {
                     surrogate_flag = 1;
@@ -1584,6 +2002,10 @@ typedef struct {
     JSGCRef buffer_ref; /* string, JSByteBuffer or JS_EXCEPTION */
     int len; /* current string length (in bytes) */
     BOOL is_ascii;
+    /* if not NULL, the bytes are sent to write_func() instead of
+       being accumulated */
+    JSWriteFunc *write_func;
+    void *opaque;
 } StringBuffer;
 
 /* return 0 if OK, -1 in case of exception (exception possible if len > 0) */
@@ -1591,6 +2013,7 @@ static int string_buffer_push(JSContext *ctx, StringBuffer *s, int len)
 {
     s->len = 0;
     s->is_ascii = TRUE;
+    s->write_func = NULL;
     if (len > 0) {
         JSByteArray *arr;
         arr = js_alloc_byte_array(ctx, len);
@@ -1605,6 +2028,20 @@ static int string_buffer_push(JSContext *ctx, StringBuffer *s, int len)
     return 0;
 }
 
+/* no allocation is done. string_buffer_pop() returns JS_UNDEFINED or
+   JS_EXCEPTION */
+static void string_buffer_push_sink(JSContext *ctx, StringBuffer *s,
+                                    JSWriteFunc *write_func, void *opaque)
+{
+    s->len = 0;
+    s->is_ascii = TRUE;
+    s->write_func = write_func;
+    s->opaque = opaque;
+    s->buffer_ref.val = JS_NULL;
+    s->buffer_ref.prev = ctx->top_gc_ref;
+    ctx->top_gc_ref = &s->buffer_ref;
+}
+
 /* val2 must be a string. Return 0 if OK, -1 in case of exception */
 static int string_buffer_concat_str(JSContext *ctx, StringBuffer *s, JSValue val2)
 {
@@ -1621,6 +2058,11 @@ static int string_buffer_concat_str(JSContext *ctx, StringBuffer *s, JSValue val
     len2 = p2->len;
     if (len2 == 0)
         return 0;
+    if (s->write_func) {
+        s->write_func(s->opaque, js_string_buf(p2), len2);
+        s->len += len2;
+        return 0;
+    }
     if (JS_IsString(ctx, s->buffer_ref.val)) {
         p1 = get_string_ptr(ctx, &buf1, s->buffer_ref.val);
         len1 = p1->len;
@@ -1658,19 +2100,19 @@ static int string_buffer_concat_str(JSContext *ctx, StringBuffer *s, JSValue val
         if (val1 != JS_NULL) {
             p1 = get_string_ptr(ctx, &buf1, val1);
             s->is_ascii = p1->is_ascii;
-            memcpy(arr->buf, p1->buf, len1);
+            memcpy(arr->buf, js_string_buf(p1), len1);
         }
         p2 = get_string_ptr(ctx, &buf2, val2);
     }
     
     q = arr->buf + len1;
-    if (len2 >= 3 && unlikely(is_utf8_right_surrogate(p2->buf)) &&
+    if (len2 >= 3 && unlikely(is_utf8_right_surrogate(js_string_buf(p2))) &&
         len1 >= 3 && is_utf8_left_surrogate(q - 3)) {
         size_t clen;
         int c;
         /* contract the two surrogates to 4 bytes */
         c = (utf8_get(q - 3, &clen) & 0x3ff) << 10;
-        c |= (utf8_get(p2->buf, &clen) & 0x3ff);
+        c |= (utf8_get(js_string_buf(p2), &clen) & 0x3ff);
         c += 0x10000;
         len -= 2;
         len2 -= 3;
@@ -1678,7 +2120,7 @@ static int string_buffer_concat_str(JSContext *ctx, StringBuffer *s, JSValue val
         q += unicode_to_utf8(q, c);
         s->is_ascii = FALSE;
     }
-    memcpy(q, p2->buf + p2->len - len2, len2);
+    memcpy(q, js_string_buf(p2) + p2->len - len2, len2);
     s->len = len;
     s->is_ascii &= p2->is_ascii;
     return 0;
@@ -1742,8 +2184,10 @@ static int string_buffer_puts(JSContext *ctx, StringBuffer *s, const char *str)
 static JSValue string_buffer_pop(JSContext *ctx, StringBuffer *s)
 {
     JSValue res;
-    if (JS_IsException(s->buffer_ref.val) ||
-        JS_IsString(ctx, s->buffer_ref.val)) {
+    if (s->write_func) {
+        res = JS_IsException(s->buffer_ref.val) ? JS_EXCEPTION : JS_UNDEFINED;
+    } else if (JS_IsException(s->buffer_ref.val) ||
+               JS_IsString(ctx, s->buffer_ref.val)) {
         res = s->buffer_ref.val;
     } else {
         if (s->len != 0) {
@@ -1757,15 +2201,113 @@ static JSValue string_buffer_pop(JSContext *ctx, StringBuffer *s)
     return res;
 }
 
+/* val1 and val2 must be non empty strings and their concatenation
+   must not contain a surrogate pair to merge. */
+static JSValue js_rope_concat(JSContext *ctx, JSValue val1, JSValue val2)
+{
+    JSStringCharBuf buf1, buf2;
+    JSString *p1, *p2, *r;
+    JSByteArray *arr;
+    JSRopeBuffer *rb;
+    JSValue rope_buf, res;
+    JSGCRef val1_ref, val2_ref, rope_buf_ref, res_ref;
+    uint32_t len1, len2, len, size;
+    BOOL is_ascii;
+    
+    p1 = get_string_ptr(ctx, &buf1, val1);
+    p2 = get_string_ptr(ctx, &buf2, val2);
+    len1 = p1->len;
+    len2 = p2->len;
+    len = len1 + len2;
+    if (len > JS_STRING_LEN_MAX)
+        return JS_ThrowInternalError(ctx, "string too long");
+    is_ascii = p1->is_ascii & p2->is_ascii;
+
+    /* exact size unless 'val1' is a rope being extended */
+    size = len + 1;
+    if (p1->is_rope) {
+        rope_buf = *(JSValue *)p1->buf;
+        arr = JS_VALUE_TO_PTR(rope_buf);
+        rb = (JSRopeBuffer *)arr->buf;
+        if (rb->len == len1) {
+            if (sizeof(JSRopeBuffer) + len + 1 <= arr->size) {
+                /* in place append: the characters are added before
+                   the string is allocated so that the GC does not
+                   trim them (see gc_trim_rope_buffer()). 'val2' may
+                   be a prefix of the same buffer. */
+                memmove(rb->buf + len1, js_string_buf(p2), len2);
+                rb->buf[len] = '\0';
+                rb->len = len;
+                JS_PUSH_VALUE(ctx, rope_buf);
+                r = js_malloc(ctx, sizeof(JSString) + sizeof(JSValue), JS_MTAG_STRING);
+                JS_POP_VALUE(ctx, rope_buf);
+                if (!r)
+                    return JS_EXCEPTION;
+                goto done;
+            }
+            /* new buffer with 50% of free space */
+            size = len + len / 2 + 1;
+            if (size > JS_BYTE_ARRAY_SIZE_MAX - sizeof(JSRopeBuffer))
+                size = len + 1; /* js_alloc_byte_array() fails if still too large */
+        }
+    }
+
+    /* the string is allocated just before its buffer so that the GC
+       can make it flat if it is the only user of the buffer */
+    JS_PUSH_VALUE(ctx, val1);
+    JS_PUSH_VALUE(ctx, val2);
+    r = js_alloc_string(ctx, 0);
+    if (!r) {
+        arr = NULL;
+    } else {
+        res = JS_VALUE_FROM_PTR(r);
+        JS_PUSH_VALUE(ctx, res);
+        arr = js_alloc_byte_array(ctx, sizeof(JSRopeBuffer) + size);
+        JS_POP_VALUE(ctx, res);
+    }
+    JS_POP_VALUE(ctx, val2);
+    JS_POP_VALUE(ctx, val1);
+    if (!arr)
+        return JS_EXCEPTION;
+    r = JS_VALUE_TO_PTR(res);
+    rb = (JSRopeBuffer *)arr->buf;
+    p1 = get_string_ptr(ctx, &buf1, val1);
+    p2 = get_string_ptr(ctx, &buf2, val2);
+    memcpy(rb->buf, js_string_buf(p1), len1);
+    memcpy(rb->buf + len1, js_string_buf(p2), len2);
+    rb->buf[len] = '\0';
+    rb->len = len;
+    rope_buf = JS_VALUE_FROM_PTR(arr);
+ done:
+    r->is_unique = FALSE;
+    r->is_ascii = is_ascii;
+    r->is_numeric = FALSE;
+    r->len = len;
+    r->is_rope = TRUE;
+    *(JSValue *)r->buf = rope_buf;
+    js_write_barrier(ctx, r, rope_buf);
+    return JS_VALUE_FROM_PTR(r);
+}
+
 /* val1 and val2 must be strings or exception */
 static JSValue JS_ConcatString(JSContext *ctx, JSValue val1, JSValue val2)
 {
     StringBuffer b_s, *b = &b_s;
+    JSStringCharBuf buf1, buf2;
+    JSString *p1, *p2;
 
     if (JS_IsException(val1) ||
         JS_IsException(val2))
         return JS_EXCEPTION;
 
+    p1 = get_string_ptr(ctx, &buf1, val1);
+    p2 = get_string_ptr(ctx, &buf2, val2);
+    if (p1->len != 0 && p2->len != 0 &&
+        (p1->len + p2->len) >= JS_ROPE_MIN_LEN &&
+        !(p2->len >= 3 && is_utf8_right_surrogate(js_string_buf(p2)))) {
+        return js_rope_concat(ctx, val1, val2);
+    }
+
     string_buffer_push(ctx, b, 0);
     string_buffer_concat_str(ctx, b, val1); /* no memory allocation */
     string_buffer_concat_str(ctx, b, val2);
@@ -1781,7 +2323,7 @@ static BOOL js_string_eq(JSContext *ctx, JSValue val1, JSValue val2)
     p2 = get_string_ptr(ctx, &buf2, val2);
     if (p1->len != p2->len)
         return FALSE;
-    return !memcmp(p1->buf, p2->buf, p1->len);
+    return !memcmp(js_string_buf(p1), js_string_buf(p2), p1->len);
 }
 
 /* Return the unicode character containing the byte at position
@@ -1799,20 +2341,23 @@ static int js_string_compare(JSContext *ctx, JSValue val1, JSValue val2)
     JSStringCharBuf buf1, buf2;
     int len, i, res;
     JSString *p1, *p2;
+    const uint8_t *ptr1, *ptr2;
     
     p1 = get_string_ptr(ctx, &buf1, val1);
     p2 = get_string_ptr(ctx, &buf2, val2);
+    ptr1 = js_string_buf(p1);
+    ptr2 = js_string_buf(p2);
     len = min_int(p1->len, p2->len);
     for(i = 0; i < len; i++) {
-        if (p1->buf[i] != p2->buf[i])
+        if (ptr1[i] != ptr2[i])
             break;
     }
     if (i != len) {
         int c1, c2;
         /* if valid UTF-8, the strings cannot be equal at this point */
         /* Note: UTF-16 does not preserve unicode order like UTF-8 */
-        c1 = string_get_cp(p1->buf + i);
-        c2 = string_get_cp(p2->buf + i);
+        c1 = string_get_cp(ptr1 + i);
+        c2 = string_get_cp(ptr2 + i);
         if ((c1 < 0x10000 && c2 < 0x10000) ||
             (c1 >= 0x10000 && c2 >= 0x10000)) {
             if (c1 < c2)
@@ -1876,7 +2421,7 @@ static int string_getcp(JSContext *ctx, JSValue str, uint32_t utf16_pos, BOOL is
     p = get_string_ptr(ctx, &buf, str);
     if (utf8_pos >= p->len)
         return -1;
-    c = utf8_get(p->buf + utf8_pos, &clen);
+    c = utf8_get(js_string_buf(p) + utf8_pos, &clen);
     if (c < 0x10000 || (!surrogate_flag && is_codepoint)) {
         return c;
     } else {
@@ -1981,15 +2526,105 @@ static JSValue find_atom(JSContext *ctx, int *pidx, const JSValueArray *arr, int
     return JS_NULL;
 }
 
+static inline uint32_t js_atom_hash(const JSString *p)
+{
+    return hash_string8(js_string_buf(p), p->len);
+}
+
+static inline BOOL js_atom_equal(const JSString *p1, JSValue val2)
+{
+    const JSString *p2 = JS_VALUE_TO_PTR(val2);
+    return (p1->len == p2->len && !memcmp(js_string_buf(p1), p2->buf, p1->len));
+}
+
+/* lookup in the perfect hash table of the stdlib atoms. Return
+   JS_NULL if not found. */
+static JSValue find_rom_atom_hashed(JSContext *ctx, const JSString *p, uint32_t h)
+{
+    const uint16_t *tab = ctx->atom_hash_table;
+    const JSValueArray *arr = ctx->rom_atom_tables[0];
+    uint32_t d, idx;
+
+    d = tab[h & ((1 << ctx->atom_bucket_bits) - 1)];
+    idx = tab[(1 << ctx->atom_bucket_bits) +
+              atom_hash_slot(h, d, ctx->atom_hash_bits)];
+    if (idx != 0xffff && js_atom_equal(p, arr->arr[idx]))
+        return arr->arr[idx];
+    return JS_NULL;
+}
+
+/* The RAM unique strings are stored in an open addressing hash table
+   with linear probing. Its size is a power of two and the empty slots
+   contain JS_NULL. Before saving the bytecode, the table is converted
+   to a sorted array (see js_sort_unique_strings()). */
+#define JS_UNIQUE_STRINGS_MIN_SIZE 16
+
+/* return the slot of 'p' or of the first empty slot */
+static int find_unique_string_slot(const JSValueArray *arr, const JSString *p,
+                                   uint32_t h)
+{
+    uint32_t mask, i;
+    JSValue val;
+
+    mask = arr->size - 1;
+    i = h & mask;
+    for(;;) {
+        val = arr->arr[i];
+        if (val == JS_NULL || js_atom_equal(p, val))
+            return i;
+        i = (i + 1) & mask;
+    }
+}
+
+/* table size so that the load factor is at most 3/4 */
+static int get_unique_strings_size(int len)
+{
+    int size;
+    size = JS_UNIQUE_STRINGS_MIN_SIZE;
+    while (size * 3 < len * 4)
+        size *= 2;
+    return size;
+}
+
+/* rebuild the unique string table with 'new_size' slots. The table
+   may be in sorted form. */
+static int js_resize_unique_strings(JSContext *ctx, int new_size)
+{
+    JSValueArray *arr, *new_arr;
+    JSString *p;
+    JSValue val;
+    int i;
+
+    new_arr = js_alloc_value_array(ctx, 0, new_size);
+    if (!new_arr)
+        return -1;
+    for(i = 0; i < new_size; i++)
+        new_arr->arr[i] = JS_NULL;
+    if (ctx->unique_strings != JS_NULL) {
+        arr = JS_VALUE_TO_PTR(ctx->unique_strings);
+        for(i = 0; i < arr->size; i++) {
+            val = arr->arr[i];
+            if (val != JS_NULL) {
+                p = JS_VALUE_TO_PTR(val);
+                new_arr->arr[find_unique_string_slot(new_arr, p, js_atom_hash(p))] = val;
+            }
+        }
+        js_free(ctx, arr); /* in case it is the last allocated block */
+    }
+    ctx->unique_strings = JS_VALUE_FROM_PTR(new_arr);
+    ctx->unique_strings_sorted = FALSE;
+    return 0;
+}
+
 /* if 'val' is not a string, it is returned */
-/* XXX: use hash table */
 static JSValue JS_MakeUniqueString(JSContext *ctx, JSValue val)
 {
     JSString *p;
-    int a, is_numeric, i;
+    int a, is_numeric, i, size, new_size;
+    uint32_t h;
     JSValueArray *arr;
     const JSValueArray *arr1;
-    JSValue val1, new_tab;
+    JSValue val1;
     JSGCRef val_ref;
     
     if (!JS_IsPtr(val))
@@ -1998,8 +2633,16 @@ static JSValue JS_MakeUniqueString(JSContext *ctx, JSValue val)
     if (p->mtag != JS_MTAG_STRING || p->is_unique)
         return val;
 
-    /* not unique: find it in the ROM or RAM sorted unique string table */
-    for(i = 0; i < ctx->n_rom_atom_tables; i++) {
+    /* not unique: find it in the ROM or RAM unique string tables */
+    h = js_atom_hash(p);
+    i = 0;
+    if (ctx->atom_hash_table) {
+        val1 = find_rom_atom_hashed(ctx, p, h);
+        if (!JS_IsNull(val1))
+            return val1;
+        i = 1;
+    }
+    for(; i < ctx->n_rom_atom_tables; i++) {
         arr1 = ctx->rom_atom_tables[i];
         if (arr1) {
             val1 = find_atom(ctx, &a, arr1, arr1->size, val); 
@@ -2008,62 +2651,155 @@ static JSValue JS_MakeUniqueString(JSContext *ctx, JSValue val)
         }
     }
     
-    arr = JS_VALUE_TO_PTR( ctx->unique_strings);
-    val1 = find_atom(ctx, &a, arr, ctx->unique_strings_len, val); 
-    if (!JS_IsNull(val1))
-        return val1;
+    if (ctx->unique_strings != JS_NULL) {
+        arr = JS_VALUE_TO_PTR(ctx->unique_strings);
+        if (ctx->unique_strings_sorted) {
+            val1 = find_atom(ctx, &a, arr, ctx->unique_strings_len, val);
+            if (!JS_IsNull(val1))
+                return val1;
+        } else {
+            val1 = arr->arr[find_unique_string_slot(arr, p, h)];
+            if (!JS_IsNull(val1))
+                return val1;
+        }
+    }
     
+    if (p->is_rope) {
+        /* the unique strings are always flat */
+        val = js_rope_flatten(ctx, val);
+        if (JS_IsException(val))
+            return JS_EXCEPTION;
+    }
+
     JS_PUSH_VALUE(ctx, val);
     is_numeric = js_is_numeric_string(ctx, val);
     JS_POP_VALUE(ctx, val);
     if (is_numeric < 0)
         return JS_EXCEPTION;
     
-    /* not found: add it in the table */
-    JS_PUSH_VALUE(ctx, val);
-    new_tab = js_resize_value_array(ctx, ctx->unique_strings,
-                                 ctx->unique_strings_len + 1);
-    JS_POP_VALUE(ctx, val);
-    if (JS_IsException(new_tab))
-        return JS_EXCEPTION;
-    ctx->unique_strings = new_tab;
-    arr = JS_VALUE_TO_PTR( ctx->unique_strings);
-    memmove(&arr->arr[a + 1], &arr->arr[a],
-            sizeof(arr->arr[0]) * (ctx->unique_strings_len - a));
-    arr->arr[a] = val;
+    /* not found: add it in the table. It is also shrunk here because
+       the GC only removes the dead entries. */
+    if (ctx->unique_strings == JS_NULL) {
+        size = 0;
+    } else {
+        arr = JS_VALUE_TO_PTR(ctx->unique_strings);
+        size = arr->size;
+    }
+    new_size = get_unique_strings_size(ctx->unique_strings_len + 1);
+    if (new_size > size || new_size * 4 <= size || ctx->unique_strings_sorted) {
+        int ret;
+        JS_PUSH_VALUE(ctx, val);
+        ret = js_resize_unique_strings(ctx, new_size);
+        JS_POP_VALUE(ctx, val);
+        if (ret)
+            return JS_EXCEPTION;
+    }
+    arr = JS_VALUE_TO_PTR(ctx->unique_strings);
     p = JS_VALUE_TO_PTR(val);
+    arr->arr[find_unique_string_slot(arr, p, h)] = val;
     p->is_unique = TRUE;
     p->is_numeric = is_numeric;
     ctx->unique_strings_len++;
     return val;
 }
 
-static int JS_ToBool(JSContext *ctx, JSValue val)
+/* remove the unique string at slot 'i' in the hash table (backward
+   shift deletion). No allocation is done. */
+static void js_unique_strings_delete(JSValueArray *arr, uint32_t i)
 {
-    if (JS_IsInt(val)) {
-        return JS_VALUE_GET_INT(val) != 0;
-    } else
-#ifdef JS_USE_SHORT_FLOAT
-    if (JS_IsShortFloat(val)) {
-        double d;
-        d = js_get_short_float(val);
-        return !isnan(d) && d != 0;
-    } else
-#endif
-    if (!JS_IsPtr(val)) {
-        switch(JS_VALUE_GET_SPECIAL_TAG(val)) {
-        case JS_TAG_BOOL:
-        case JS_TAG_NULL:
-        case JS_TAG_UNDEFINED:
-            return JS_VALUE_GET_SPECIAL_VALUE(val);
-        case JS_TAG_SHORT_FUNC:
-        case JS_TAG_STRING_CHAR:
-            return TRUE;
-        default:
-            return FALSE;
-        }
-    } else {
-        JSMemBlockHeader *h = JS_VALUE_TO_PTR(val);
+    uint32_t mask, j, k;
+    JSValue val;
+
+    mask = arr->size - 1;
+    j = i;
+    for(;;) {
+        arr->arr[i] = JS_NULL;
+        for(;;) {
+            j = (j + 1) & mask;
+            val = arr->arr[j];
+            if (val == JS_NULL)
+                return;
+            k = js_atom_hash(JS_VALUE_TO_PTR(val)) & mask;
+            /* the entry can be moved to 'i' if its home slot 'k' is
+               not cyclically in ]i, j] */
+            if (i <= j) {
+                if (k <= i || k > j)
+                    break;
+            } else {
+                if (k <= i && k > j)
+                    break;
+            }
+        }
+        arr->arr[i] = val;
+        i = j;
+    }
+}
+
+static int js_unique_strings_sort_cmp(size_t i1, size_t i2, void *opaque)
+{
+    JSContext *ctx = opaque;
+    JSValueArray *arr = JS_VALUE_TO_PTR(ctx->unique_strings);
+    return js_string_compare(ctx, arr->arr[i1], arr->arr[i2]);
+}
+
+static void js_unique_strings_sort_swap(size_t i1, size_t i2, void *opaque)
+{
+    JSContext *ctx = opaque;
+    JSValueArray *arr = JS_VALUE_TO_PTR(ctx->unique_strings);
+    JSValue tmp;
+    tmp = arr->arr[i1];
+    arr->arr[i1] = arr->arr[i2];
+    arr->arr[i2] = tmp;
+}
+
+/* convert the unique string table to a sorted array as expected by
+   the bytecode loader. No allocation is done. */
+static void js_sort_unique_strings(JSContext *ctx)
+{
+    JSValueArray *arr;
+    int i, j;
+
+    if (ctx->unique_strings == JS_NULL || ctx->unique_strings_sorted)
+        return;
+    arr = JS_VALUE_TO_PTR(ctx->unique_strings);
+    j = 0;
+    for(i = 0; i < arr->size; i++) {
+        if (arr->arr[i] != JS_NULL)
+            arr->arr[j++] = arr->arr[i];
+    }
+    assert(j == ctx->unique_strings_len);
+    js_shrink_value_array(ctx, &ctx->unique_strings, j);
+    if (j != 0)
+        rqsort_idx(j, js_unique_strings_sort_cmp, js_unique_strings_sort_swap, ctx);
+    ctx->unique_strings_sorted = TRUE;
+}
+
+static int JS_ToBool(JSContext *ctx, JSValue val)
+{
+    if (JS_IsInt(val)) {
+        return JS_VALUE_GET_INT(val) != 0;
+    } else
+#ifdef JS_USE_SHORT_FLOAT
+    if (JS_IsShortFloat(val)) {
+        double d;
+        d = js_get_short_float(val);
+        return !isnan(d) && d != 0;
+    } else
+#endif
+    if (!JS_IsPtr(val)) {
+        switch(JS_VALUE_GET_SPECIAL_TAG(val)) {
+        case JS_TAG_BOOL:
+        case JS_TAG_NULL:
+        case JS_TAG_UNDEFINED:
+            return JS_VALUE_GET_SPECIAL_VALUE(val);
+        case JS_TAG_SHORT_FUNC:
+        case JS_TAG_STRING_CHAR:
+            return TRUE;
+        default:
+            return FALSE;
+        }
+    } else {
+        JSMemBlockHeader *h = JS_VALUE_TO_PTR(val);
         switch(h->mtag) {
         case JS_MTAG_STRING:
             {
@@ -2099,7 +2835,14 @@ const char *JS_ToCStringLen(JSContext *ctx, size_t *plen, JSValue val,
     } else {
         JSString *r;
         r = JS_VALUE_TO_PTR(val);
-        p = (const char *)r->buf;
+        if (r->is_rope && js_get_rope_buffer(r)->len != r->len) {
+            /* not zero terminated */
+            val = js_rope_flatten(ctx, val);
+            if (JS_IsException(val))
+                return NULL;
+            r = JS_VALUE_TO_PTR(val);
+        }
+        p = (const char *)js_string_buf(r);
         len = r->len;
     }
     if (plen)
@@ -2112,6 +2855,73 @@ const char *JS_ToCString(JSContext *ctx, JSValue val, JSCStringBuf *buf)
     return JS_ToCStringLen(ctx, NULL, val, buf);
 }
 
+void *JS_TempAlloc(JSContext *ctx, size_t size)
+{
+    JSTempBlock *tb;
+    uint32_t len;
+
+    /* the block is freed when the C function returns */
+    if (ctx->fp == (JSValue *)ctx->stack_top) {
+        JS_ThrowInternalError(ctx, "JS_TempAlloc: not in a C function");
+        return NULL;
+    }
+    if (size > (size_t)(ctx->stack_top - ctx->heap_base)) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
+    len = (size + JSW - 1) / JSW + JS_TEMP_BLOCK_HDR_LEN;
+    if (JS_StackCheck(ctx, len))
+        return NULL;
+    ctx->sp -= len;
+    tb = (JSTempBlock *)ctx->sp;
+    tb->prev = ctx->temp_blocks;
+    tb->len = len;
+    ctx->temp_blocks = tb;
+    return ctx->sp + JS_TEMP_BLOCK_HDR_LEN;
+}
+
+/* free the blocks allocated by the C function of frame 'fp' */
+static void js_temp_free(JSContext *ctx, JSValue *fp)
+{
+    while (ctx->temp_blocks != NULL && (JSValue *)ctx->temp_blocks < fp)
+        ctx->temp_blocks = ctx->temp_blocks->prev;
+}
+
+const char *JS_ToTempCString(JSContext *ctx, size_t *plen, JSValue val)
+{
+    JSGCRef str_ref;
+    JSValue *pstr;
+    JSCStringBuf buf;
+    const char *p;
+    char *q = NULL;
+    size_t len;
+
+    pstr = JS_PushGCRef(ctx, &str_ref);
+    *pstr = JS_ToString(ctx, val);
+    if (JS_IsException(*pstr))
+        goto done;
+    if (JS_VALUE_GET_SPECIAL_TAG(*pstr) == JS_TAG_STRING_CHAR)
+        len = get_short_string(buf.buf, *pstr);
+    else
+        len = ((JSString *)JS_VALUE_TO_PTR(*pstr))->len;
+    q = JS_TempAlloc(ctx, len + 1);
+    if (!q)
+        goto done;
+    /* may flatten a rope, but 'q' is not moved by the GC */
+    p = JS_ToCStringLen(ctx, NULL, *pstr, &buf);
+    if (!p) {
+        q = NULL;
+        goto done;
+    }
+    memcpy(q, p, len);
+    q[len] = '\0';
+    if (plen)
+        *plen = len;
+ done:
+    JS_PopGCRef(ctx, &str_ref);
+    return q;
+}
+
 JSValue JS_GetException(JSContext *ctx)
 {
     JSValue obj;
@@ -2146,7 +2956,7 @@ static inline BOOL is_num_string(JSContext *ctx, int32_t *pval, JSValue val)
     p1 = get_string_ptr(ctx, &buf, val);
     if (p1->len == 0 || p1->len > 11 || !p1->is_ascii)
         return FALSE;
-    p = p1->buf;
+    p = js_string_buf(p1);
     p_end = p + p1->len;
     c = *p++;
     is_neg = 0;
@@ -2404,6 +3214,7 @@ JSValue JS_NewObjectPrealloc(JSContext *ctx, int n)
         return JS_EXCEPTION;
     p = JS_VALUE_TO_PTR(obj);
     p->props = JS_VALUE_FROM_PTR(arr);
+    js_write_barrier(ctx, p, p->props);
     return obj;
 }
 
@@ -2428,6 +3239,7 @@ JSValue JS_NewArray(JSContext *ctx, int initial_len)
             return JS_EXCEPTION;
         p = JS_VALUE_TO_PTR(val);
         p->u.array.tab = JS_VALUE_FROM_PTR(arr);
+        js_write_barrier(ctx, p, p->u.array.tab);
         p->u.array.len = initial_len;
     }
     return val;
@@ -2438,7 +3250,38 @@ static inline uint32_t hash_prop(JSValue prop)
     return (prop / JSW) ^ (prop % JSW); /* XXX: improve */
 }
 
-/* return NULL if not found */
+/* A shaped object stores its property values in a JSValueArray whose
+   first element is the shape (a property table shared with the other
+   objects having the same keys) instead of a property table. */
+static inline BOOL js_props_is_shaped(JSValueArray *arr)
+{
+    return JS_IsPtr(arr->arr[0]);
+}
+
+/* return the property table of 'p' */
+static force_inline JSValueArray *get_prop_table(JSObject *p)
+{
+    JSValueArray *arr;
+    arr = JS_VALUE_TO_PTR(p->props);
+    if (unlikely(js_props_is_shaped(arr)))
+        arr = JS_VALUE_TO_PTR(arr->arr[0]);
+    return arr;
+}
+
+/* return the address of the value of the JS_PROP_NORMAL property 'pr'
+   of 'p' */
+static force_inline JSValue *get_prop_value_ptr(JSObject *p, JSProperty *pr)
+{
+    JSValueArray *arr;
+    arr = JS_VALUE_TO_PTR(p->props);
+    if (unlikely(js_props_is_shaped(arr)))
+        return &arr->arr[1 + JS_VALUE_GET_INT(pr->value)];
+    else
+        return &pr->value;
+}
+
+/* return NULL if not found. For shaped objects, the value must be
+   accessed with get_prop_value_ptr(). */
 static force_inline JSProperty *find_own_property_inlined(JSContext *ctx,
                                                           JSObject *p, JSValue prop)
 {
@@ -2446,7 +3289,7 @@ static force_inline JSProperty *find_own_property_inlined(JSContext *ctx,
     JSProperty *pr;
     uint32_t hash_mask, h, idx;
     
-    arr = JS_VALUE_TO_PTR(p->props);
+    arr = get_prop_table(p);
     hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
     h = hash_prop(prop) & hash_mask;
     idx = arr->arr[2 + h]; /* JSValue, hence idx * 2 */
@@ -2465,6 +3308,43 @@ static inline JSProperty *find_own_property(JSContext *ctx,
     return find_own_property_inlined(ctx, p, prop);
 }
 
+static force_inline JSFieldCacheEntry *get_field_cache_entry(JSFieldCacheEntry *tab,
+                                                             const uint8_t *pc)
+{
+    return &tab[(uintptr_t)pc & (JS_FIELD_CACHE_SIZE - 1)];
+}
+
+/* return the address of the property value or NULL if the cache
+   entry does not match */
+static force_inline JSValue *field_cache_find(JSFieldCacheEntry *ce,
+                                              JSObject *p, JSValue prop)
+{
+    JSValueArray *arr;
+    JSProperty *pr;
+
+    arr = get_prop_table(p);
+    if (JS_VALUE_FROM_PTR(arr) != ce->props)
+        return NULL;
+    if (unlikely(arr->arr[1] != ce->hash_mask ||
+                 ce->prop_ofs + 3 > arr->size))
+        return NULL;
+    pr = (JSProperty *)&arr->arr[ce->prop_ofs];
+    if (unlikely(pr->key != prop || pr->prop_type != JS_PROP_NORMAL))
+        return NULL;
+    return get_prop_value_ptr(p, pr);
+}
+
+/* 'pr' must be a JS_PROP_NORMAL property of 'p' */
+static void field_cache_update(JSFieldCacheEntry *ce, JSObject *p,
+                               JSProperty *pr)
+{
+    JSValueArray *arr;
+    arr = get_prop_table(p);
+    ce->props = JS_VALUE_FROM_PTR(arr);
+    ce->hash_mask = arr->arr[1];
+    ce->prop_ofs = (JSValue *)pr - arr->arr;
+}
+
 static JSValue get_special_prop(JSContext *ctx, JSValue val)
 {
     int idx;
@@ -2550,31 +3430,29 @@ static JSValue JS_GetPropertyInternal(JSContext *ctx, JSValue obj, JSValue prop,
                    p->class_id <= JS_CLASS_FLOAT64_ARRAY) {
             if (JS_IsInt(prop)) {
                 uint32_t idx = JS_VALUE_GET_INT(prop);
-                JSObject *pbuffer;
-                JSByteArray *arr;
+                uint8_t *buf;
                 if (idx < p->u.typed_array.len) {
                     idx += p->u.typed_array.offset;
-                    pbuffer = JS_VALUE_TO_PTR(p->u.typed_array.buffer);
-                    arr = JS_VALUE_TO_PTR(pbuffer->u.array_buffer.byte_buffer);
+                    buf = js_array_buffer_get_buf(JS_VALUE_TO_PTR(p->u.typed_array.buffer));
                     switch(p->class_id) {
                     default:
                     case JS_CLASS_UINT8C_ARRAY:
                     case JS_CLASS_UINT8_ARRAY:
-                        return JS_NewShortInt(*((uint8_t *)arr->buf + idx));
+                        return JS_NewShortInt(*((uint8_t *)buf + idx));
                     case JS_CLASS_INT8_ARRAY:
-                        return JS_NewShortInt(*((int8_t *)arr->buf + idx));
+                        return JS_NewShortInt(*((int8_t *)buf + idx));
                     case JS_CLASS_INT16_ARRAY:
-                        return JS_NewShortInt(*((int16_t *)arr->buf + idx));
+                        return JS_NewShortInt(*((int16_t *)buf + idx));
                     case JS_CLASS_UINT16_ARRAY:
-                        return JS_NewShortInt(*((uint16_t *)arr->buf + idx));
+                        return JS_NewShortInt(*((uint16_t *)buf + idx));
                     case JS_CLASS_INT32_ARRAY:
-                        return JS_NewInt32(ctx, *((int32_t *)arr->buf + idx));
+                        return JS_NewInt32(ctx, *((int32_t *)buf + idx));
                     case JS_CLASS_UINT32_ARRAY:
-                        return JS_NewUint32(ctx, *((uint32_t *)arr->buf + idx));
+                        return JS_NewUint32(ctx, *((uint32_t *)buf + idx));
                     case JS_CLASS_FLOAT32_ARRAY:
-                        return JS_NewFloat64(ctx, *((float *)arr->buf + idx));
+                        return JS_NewFloat64(ctx, *((float *)buf + idx));
                     case JS_CLASS_FLOAT64_ARRAY:
-                        return JS_NewFloat64(ctx, *((double *)arr->buf + idx));
+                        return JS_NewFloat64(ctx, *((double *)buf + idx));
                     }
                 }
             } else if (JS_IsNumericProperty(ctx, prop)) {
@@ -2585,7 +3463,7 @@ static JSValue JS_GetPropertyInternal(JSContext *ctx, JSValue obj, JSValue prop,
         pr = find_own_property(ctx, p, prop);
         if (pr) {
             if (likely(pr->prop_type == JS_PROP_NORMAL)) {
-                return pr->value;
+                return *get_prop_value_ptr(p, pr);
             } else if (pr->prop_type == JS_PROP_VARREF) {
                 JSVarRef *pv = JS_VALUE_TO_PTR(pr->value);
                 /* always detached */
@@ -2716,13 +3594,44 @@ static JSValueArray *js_alloc_props(JSContext *ctx, int n)
     return arr;
 }
                           
+#ifdef CONFIG_GC_NURSERY
+/* return TRUE if one of the keys of 'p' is in the young generation */
+static BOOL js_props_has_young_key(JSContext *ctx, JSObject *p)
+{
+    JSValueArray *arr;
+    int prop_count, hash_mask, i, j, idx;
+    JSProperty *pr;
+
+    arr = get_prop_table(p);
+    if (JS_IS_ROM_PTR(ctx, arr))
+        return FALSE;
+    hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
+    if (hash_mask == 0)
+        return FALSE; /* no need to rehash if single hash entry */
+    prop_count = JS_VALUE_GET_INT(arr->arr[0]);
+    for(i = 0, j = 0; j < prop_count; i++) {
+        idx = 2 + (hash_mask + 1) + 3 * i;
+        pr = (JSProperty *)&arr->arr[idx];
+        if (pr->key != JS_UNINITIALIZED) {
+            if (JS_IsPtr(pr->key) &&
+                (uint8_t *)JS_VALUE_TO_PTR(pr->key) >= ctx->gc_base &&
+                !JS_IS_ROM_PTR(ctx, JS_VALUE_TO_PTR(pr->key)))
+                return TRUE;
+            j++;
+        }
+    }
+    return FALSE;
+}
+#endif
+
 static void js_rehash_props(JSContext *ctx, JSObject *p, BOOL gc_rehash)
 {
     JSValueArray *arr;
     int prop_count, hash_mask, h, idx, i, j;
     JSProperty *pr;
 
-    arr = JS_VALUE_TO_PTR(p->props);
+    /* the shapes are rehashed once per object using them */
+    arr = get_prop_table(p);
     if (JS_IS_ROM_PTR(ctx, arr))
         return;
     hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
@@ -2789,7 +3698,174 @@ static void js_compact_props(JSContext *ctx, JSObject *p)
    js_rehash_props(ctx, p, FALSE);
 }
 
-/* if the existing properties are in ROM, copy them to RAM. Return non zero if error */
+/* Shapes: a plain object whose properties are all normal and which
+   was built at once (object literal or JSON.parse()) shares its
+   property table with the other objects having the same keys in the
+   same order. The shared table (the shape) contains the index of each
+   value instead of the value. Shapes are never modified: any change
+   in the property list converts the object back to a normal property
+   table (see js_update_props()). */
+
+/* convert a shaped object to an object with its own property
+   table. Return non zero if exception. */
+static int js_object_unshare_shape(JSContext *ctx, JSValue obj)
+{
+    JSObject *p;
+    JSValueArray *arr, *sh, *arr1;
+    JSProperty *pr;
+    int i, prop_count, hash_mask;
+    JSGCRef obj_ref;
+
+    p = JS_VALUE_TO_PTR(obj);
+    sh = get_prop_table(p);
+    JS_PUSH_VALUE(ctx, obj);
+    arr1 = js_alloc_value_array(ctx, 0, sh->size);
+    JS_POP_VALUE(ctx, obj);
+    if (!arr1)
+        return -1;
+    p = JS_VALUE_TO_PTR(obj);
+    arr = JS_VALUE_TO_PTR(p->props);
+    sh = JS_VALUE_TO_PTR(arr->arr[0]);
+    memcpy(arr1->arr, sh->arr, sh->size * sizeof(JSValue));
+    prop_count = JS_VALUE_GET_INT(arr1->arr[0]);
+    hash_mask = JS_VALUE_GET_INT(arr1->arr[1]);
+    for(i = 0; i < prop_count; i++) {
+        pr = (JSProperty *)&arr1->arr[2 + (hash_mask + 1) + 3 * i];
+        pr->value = arr->arr[1 + JS_VALUE_GET_INT(pr->value)];
+    }
+    p->props = JS_VALUE_FROM_PTR(arr1);
+    js_write_barrier(ctx, p, p->props);
+    return 0;
+}
+
+#if JS_SHAPE_CACHE_SIZE > 0
+
+/* 'arr' is a property table without deleted properties */
+static uint32_t get_shape_hash(JSValueArray *arr)
+{
+    int prop_count, hash_mask, i;
+    JSProperty *pr;
+    uint32_t h;
+    
+    prop_count = JS_VALUE_GET_INT(arr->arr[0]);
+    hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
+    h = prop_count;
+    for(i = 0; i < prop_count; i++) {
+        pr = (JSProperty *)&arr->arr[2 + (hash_mask + 1) + 3 * i];
+        h = h * 263 + hash_prop(pr->key);
+    }
+    return h ^ (h >> 16);
+}
+
+/* return TRUE if 'arr1' and 'arr2' have the same keys in the same order */
+static BOOL shape_equal(JSValueArray *arr1, JSValueArray *arr2)
+{
+    int prop_count, hash_mask1, hash_mask2, i;
+    JSProperty *pr1, *pr2;
+
+    prop_count = JS_VALUE_GET_INT(arr1->arr[0]);
+    if (prop_count != JS_VALUE_GET_INT(arr2->arr[0]))
+        return FALSE;
+    hash_mask1 = JS_VALUE_GET_INT(arr1->arr[1]);
+    hash_mask2 = JS_VALUE_GET_INT(arr2->arr[1]);
+    for(i = 0; i < prop_count; i++) {
+        pr1 = (JSProperty *)&arr1->arr[2 + (hash_mask1 + 1) + 3 * i];
+        pr2 = (JSProperty *)&arr2->arr[2 + (hash_mask2 + 1) + 3 * i];
+        if (pr1->key != pr2->key)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* Share the property table of 'obj' if possible. The value array is
+   built in place of the existing property table. Return non zero if
+   exception. */
+static int js_object_share_shape(JSContext *ctx, JSValue obj)
+{
+    JSObject *p;
+    JSValueArray *arr, *sh;
+    JSProperty *pr;
+    JSValue *pshape;
+    int prop_count, hash_mask, base, i;
+    JSGCRef obj_ref;
+
+    p = JS_VALUE_TO_PTR(obj);
+    if (p->class_id != JS_CLASS_OBJECT)
+        return 0;
+    arr = JS_VALUE_TO_PTR(p->props);
+    if (JS_IS_ROM_PTR(ctx, arr) || js_props_is_shaped(arr))
+        return 0;
+    prop_count = JS_VALUE_GET_INT(arr->arr[0]);
+    hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
+    base = 2 + hash_mask + 1;
+    /* the property table must be full and without deleted properties */
+    if (prop_count == 0 || prop_count > JS_SHAPE_PROP_COUNT_MAX ||
+        arr->size != base + 3 * prop_count)
+        return 0;
+    for(i = 0; i < prop_count; i++) {
+        pr = (JSProperty *)&arr->arr[base + 3 * i];
+        if (pr->prop_type != JS_PROP_NORMAL)
+            return 0;
+    }
+    
+    pshape = &ctx->shape_cache[get_shape_hash(arr) & (JS_SHAPE_CACHE_SIZE - 1)];
+    if (!JS_IsPtr(*pshape) || !shape_equal(JS_VALUE_TO_PTR(*pshape), arr)) {
+        /* create a new shape */
+        JS_PUSH_VALUE(ctx, obj);
+        sh = js_alloc_value_array(ctx, 0, arr->size);
+        JS_POP_VALUE(ctx, obj);
+        if (!sh)
+            return -1;
+        p = JS_VALUE_TO_PTR(obj);
+        arr = JS_VALUE_TO_PTR(p->props);
+        memcpy(sh->arr, arr->arr, arr->size * sizeof(JSValue));
+        for(i = 0; i < prop_count; i++) {
+            pr = (JSProperty *)&sh->arr[base + 3 * i];
+            pr->value = JS_NewShortInt(i);
+        }
+        *pshape = JS_VALUE_FROM_PTR(sh);
+    }
+
+    /* the values are moved to lower indexes, so no overlap is possible */
+    for(i = 0; i < prop_count; i++)
+        arr->arr[1 + i] = arr->arr[base + 3 * i + 1];
+    arr->arr[0] = *pshape;
+    js_write_barrier(ctx, arr, arr->arr[0]);
+    /* the object is also recorded so that a minor GC rehashes the
+       shape (see gc_compact_heap()) */
+    js_write_barrier(ctx, p, arr->arr[0]);
+    js_shrink_value_array(ctx, &p->props, 1 + prop_count);
+    return 0;
+}
+
+/* the shape hashes depend on the key addresses */
+static void js_shape_cache_rehash(JSContext *ctx)
+{
+    JSValue tab[JS_SHAPE_CACHE_SIZE];
+    int i, h;
+    
+    memcpy(tab, ctx->shape_cache, sizeof(tab));
+    for(i = 0; i < JS_SHAPE_CACHE_SIZE; i++)
+        ctx->shape_cache[i] = JS_NULL;
+    for(i = 0; i < JS_SHAPE_CACHE_SIZE; i++) {
+        if (JS_IsPtr(tab[i])) {
+            h = get_shape_hash(JS_VALUE_TO_PTR(tab[i])) & (JS_SHAPE_CACHE_SIZE - 1);
+            ctx->shape_cache[h] = tab[i];
+        }
+    }
+}
+
+#else
+
+static int js_object_share_shape(JSContext *ctx, JSValue obj)
+{
+    return 0;
+}
+
+#endif /* JS_SHAPE_CACHE_SIZE > 0 */
+
+/* if the existing properties are in ROM or if the object is shaped,
+   copy them to a RAM property table. Return non zero if error */
 static int js_update_props(JSContext *ctx, JSValue obj)
 {
     JSObject *p;
@@ -2800,6 +3876,8 @@ static int js_update_props(JSContext *ctx, JSValue obj)
     
     p = JS_VALUE_TO_PTR(obj);
     arr = JS_VALUE_TO_PTR(p->props);
+    if (js_props_is_shaped(arr))
+        return js_object_unshare_shape(ctx, obj);
     if (!JS_IS_ROM_PTR(ctx, arr))
         return 0;
     JS_PUSH_VALUE(ctx, obj);
@@ -2825,6 +3903,7 @@ static int js_update_props(JSContext *ctx, JSValue obj)
     
     p = JS_VALUE_TO_PTR(obj);
     p->props = JS_VALUE_FROM_PTR(arr1);
+    js_write_barrier(ctx, p, p->props);
     return 0;
 }
 
@@ -2874,6 +3953,7 @@ static JSProperty *js_create_property(JSContext *ctx, JSValue obj,
                 return NULL;
             p = JS_VALUE_TO_PTR(obj);
             p->props = JS_VALUE_FROM_PTR(arr);
+            js_write_barrier(ctx, p, p->props);
             first_free = 3;
         } else {
             first_free = arr->size;
@@ -2894,6 +3974,7 @@ static JSProperty *js_create_property(JSContext *ctx, JSValue obj,
                 return NULL;
             p = JS_VALUE_TO_PTR(obj);
             p->props = new_props;
+            js_write_barrier(ctx, p, new_props);
             arr = JS_VALUE_TO_PTR(p->props);
             if (new_hash_mask != hash_mask) {
                 /* rebuild the hash table */
@@ -2915,6 +3996,10 @@ static JSProperty *js_create_property(JSContext *ctx, JSValue obj,
 
     pr = (JSProperty *)&arr->arr[first_free];
     pr->key = prop;
+    js_write_barrier(ctx, arr, prop);
+    /* the object is also recorded so that a minor GC rehashes its
+       properties (see gc_compact_heap()) */
+    js_write_barrier(ctx, p, prop);
     pr->value = JS_UNDEFINED;
     pr->prop_type = JS_PROP_NORMAL;
     h = hash_prop(prop) & hash_mask;
@@ -2968,9 +4053,11 @@ static JSValue JS_DefinePropertyInternal(JSContext *ctx, JSValue obj,
             if (flags & JS_DEF_PROP_HAS_VALUE) {
                 if (pr->prop_type == JS_PROP_NORMAL) {
                     pr->value = val;
+                    js_prop_write_barrier(ctx, JS_VALUE_TO_PTR(obj), val);
                 } else if (pr->prop_type == JS_PROP_VARREF) {
                     JSVarRef *pv = JS_VALUE_TO_PTR(pr->value);
                     pv->u.value = val;
+                    js_write_barrier(ctx, pv, val);
                 } else {
                     goto error_modify;
                 }
@@ -2999,12 +4086,17 @@ static JSValue JS_DefinePropertyInternal(JSContext *ctx, JSValue obj,
                     arr2->arr[0] = arr->arr[0];
                     arr2->arr[1] = arr->arr[1];
                     pr->value = JS_VALUE_FROM_PTR(arr2);
+                    js_prop_write_barrier(ctx, JS_VALUE_TO_PTR(obj), pr->value);
                     arr = arr2;
                 }
-                if (flags & JS_DEF_PROP_HAS_GET)
+                if (flags & JS_DEF_PROP_HAS_GET) {
                     arr->arr[0] = val;
-                if (flags & JS_DEF_PROP_HAS_SET)
+                    js_write_barrier(ctx, arr, val);
+                }
+                if (flags & JS_DEF_PROP_HAS_SET) {
                     arr->arr[1] = setter;
+                    js_write_barrier(ctx, arr, setter);
+                }
             }
             goto done;
         }
@@ -3052,6 +4144,7 @@ static JSValue JS_DefinePropertyInternal(JSContext *ctx, JSValue obj,
         return JS_EXCEPTION;
     pr->prop_type = prop_type;
     pr->value = val;
+    js_prop_write_barrier(ctx, JS_VALUE_TO_PTR(obj), val);
  done:
     if (flags & JS_DEF_PROP_RET_VAL) {
         return pr->value;
@@ -3166,6 +4259,7 @@ static JSValue JS_SetPropertyInternal(JSContext *ctx, JSValue this_obj,
             if (idx < p->u.array.len) {
                 arr = JS_VALUE_TO_PTR(p->u.array.tab);
                 arr->arr[idx] = val;
+                js_write_barrier(ctx, arr, val);
                 return JS_UNDEFINED;
             } else if (idx == p->u.array.len) {
                 JSValue new_tab;
@@ -3180,8 +4274,10 @@ static JSValue JS_SetPropertyInternal(JSContext *ctx, JSValue this_obj,
                     return JS_EXCEPTION;
                 p = JS_VALUE_TO_PTR(this_obj);
                 p->u.array.tab = new_tab;
+                js_write_barrier(ctx, p, new_tab);
                 arr = JS_VALUE_TO_PTR(p->u.array.tab);
                 arr->arr[idx] = val;
+                js_write_barrier(ctx, arr, val);
                 p->u.array.len++;
                 return JS_UNDEFINED;
             } else {
@@ -3196,8 +4292,7 @@ static JSValue JS_SetPropertyInternal(JSContext *ctx, JSValue this_obj,
             uint32_t idx = JS_VALUE_GET_INT(prop);
             int v, conv_ret;
             double d;
-            JSObject *pbuffer;
-            JSByteArray *arr;
+            uint8_t *buf;
             JSGCRef val_ref, this_obj_ref;
 
             JS_PUSH_VALUE(ctx, this_obj);
@@ -3223,28 +4318,27 @@ static JSValue JS_SetPropertyInternal(JSContext *ctx, JSValue this_obj,
             if (idx >= p->u.typed_array.len)
                 goto invalid_array_subscript;
             idx += p->u.typed_array.offset;
-            pbuffer = JS_VALUE_TO_PTR(p->u.typed_array.buffer);
-            arr = JS_VALUE_TO_PTR(pbuffer->u.array_buffer.byte_buffer);
+            buf = js_array_buffer_get_buf(JS_VALUE_TO_PTR(p->u.typed_array.buffer));
             switch(p->class_id) {
             default:
             case JS_CLASS_UINT8C_ARRAY:
             case JS_CLASS_INT8_ARRAY:
             case JS_CLASS_UINT8_ARRAY:
-                *((uint8_t *)arr->buf + idx) = v;
+                *((uint8_t *)buf + idx) = v;
                 break;
             case JS_CLASS_INT16_ARRAY:
             case JS_CLASS_UINT16_ARRAY:
-                *((uint16_t *)arr->buf + idx) = v;
+                *((uint16_t *)buf + idx) = v;
                 break;
             case JS_CLASS_INT32_ARRAY:
             case JS_CLASS_UINT32_ARRAY:
-                *((uint32_t *)arr->buf + idx) = v;
+                *((uint32_t *)buf + idx) = v;
                 break;
             case JS_CLASS_FLOAT32_ARRAY:
-                *((float *)arr->buf + idx) = d;
+                *((float *)buf + idx) = d;
                 break;
             case JS_CLASS_FLOAT64_ARRAY:
-                *((double *)arr->buf + idx) = d;
+                *((double *)buf + idx) = d;
                 break;
             }
             return JS_UNDEFINED;
@@ -3260,12 +4354,14 @@ static JSValue JS_SetPropertyInternal(JSContext *ctx, JSValue this_obj,
         if (likely(pr->prop_type == JS_PROP_NORMAL)) {
             if (unlikely(JS_IS_ROM_PTR(ctx, pr)))
                 goto convert_to_ram;
-            pr->value = val;
+            *get_prop_value_ptr(p, pr) = val;
+            js_prop_write_barrier(ctx, p, val);
             return JS_UNDEFINED;
         } else if (pr->prop_type == JS_PROP_VARREF) {
             JSVarRef *pv = JS_VALUE_TO_PTR(pr->value);
             /* always detached */
             pv->u.value = val;
+            js_write_barrier(ctx, pv, val);
             return JS_UNDEFINED;
         } else if (pr->prop_type == JS_PROP_SPECIAL) {
             JSGCRef val_ref, prop_ref, this_obj_ref;
@@ -3394,6 +4490,19 @@ static JSValue JS_DeleteProperty(JSContext *ctx, JSValue this_obj,
         return JS_TRUE;
 
     arr = JS_VALUE_TO_PTR(p->props);
+    if (js_props_is_shaped(arr)) {
+        int ret;
+        /* a shaped property table has no hash table */
+        if (!find_own_property(ctx, p, prop))
+            return JS_TRUE;
+        JS_PUSH_VALUE(ctx, this_obj);
+        ret = js_update_props(ctx, this_obj);
+        JS_POP_VALUE(ctx, this_obj);
+        if (ret)
+            return JS_EXCEPTION;
+        p = JS_VALUE_TO_PTR(this_obj);
+        arr = JS_VALUE_TO_PTR(p->props);
+    }
     hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
     h = hash_prop(prop) & hash_mask;
     idx = JS_VALUE_GET_INT(arr->arr[2 + h]);
@@ -3532,13 +4641,11 @@ static void dummy_write_func(void *opaque, const void *buf, size_t buf_len)
     //    fwrite(buf, 1, buf_len, stdout);
 }
 
-/* if prepare_compilation is true, the context will be used to compile
-   to a binary file. It is not expected to be used in the embedded
-   version */
-JSContext *JS_NewContext2(void *mem_start, size_t mem_size, const JSSTDLibraryDef *stdlib_def, BOOL prepare_compilation)
+/* initialize the context fields. No memory block is allocated */
+static JSContext *js_init_context(void *mem_start, size_t mem_size,
+                                  const JSSTDLibraryDef *stdlib_def)
 {
     JSContext *ctx;
-    JSValueArray *arr;
     int i, mem_align;
 
 #ifdef JS_PTR64
@@ -3556,7 +4663,10 @@ JSContext *JS_NewContext2(void *mem_start, size_t mem_size, const JSSTDLibraryDe
     ctx->class_obj = ctx->class_proto + ctx->class_count;
     ctx->heap_base = (void *)(ctx->class_proto + 2 * ctx->class_count);
     ctx->heap_free = ctx->heap_base;
+    ctx->gc_base = ctx->heap_base;
+    ctx->young_start = ctx->heap_base;
     ctx->stack_top = mem_start + mem_size;
+    ctx->free_size_min = ctx->stack_top - ctx->heap_base;
     ctx->sp = (JSValue *)ctx->stack_top;
     ctx->stack_bottom = ctx->sp;
     ctx->fp = ctx->sp;
@@ -3569,7 +4679,47 @@ JSContext *JS_NewContext2(void *mem_start, size_t mem_size, const JSSTDLibraryDe
     ctx->write_func = dummy_write_func;
     for(i = 0; i < JS_STRING_POS_CACHE_SIZE; i++)
         ctx->string_pos_cache[i].str = JS_NULL;
+#if JS_SHAPE_CACHE_SIZE > 0
+    for(i = 0; i < JS_SHAPE_CACHE_SIZE; i++)
+        ctx->shape_cache[i] = JS_NULL;
+#endif
+#if JS_REGEXP_CACHE_SIZE > 0
+    for(i = 0; i < JS_REGEXP_CACHE_SIZE; i++) {
+        ctx->regexp_cache[i].source = JS_NULL;
+        ctx->regexp_cache[i].byte_code = JS_NULL;
+    }
+#endif
+    ctx->current_exception = JS_UNDEFINED;
+    ctx->job_first = JS_NULL;
+    ctx->job_last = JS_NULL;
+    return ctx;
+}
+
+static void js_init_rom_atoms(JSContext *ctx, const JSSTDLibraryDef *stdlib_def)
+{
+    ctx->atom_table = stdlib_def->stdlib_table;
+    ctx->rom_atom_tables[0] = (JSValueArray *)(stdlib_def->stdlib_table +
+                                               stdlib_def->sorted_atoms_offset);
+    ctx->n_rom_atom_tables = 1;
+    if (stdlib_def->atom_hash_table) {
+        ctx->atom_hash_table = stdlib_def->atom_hash_table;
+        ctx->atom_hash_bits = stdlib_def->atom_hash_bits;
+        ctx->atom_bucket_bits = stdlib_def->atom_bucket_bits;
+    }
+    ctx->c_function_table = stdlib_def->c_function_table;
+    ctx->c_finalizer_table = stdlib_def->c_finalizer_table;
+}
+
+/* if prepare_compilation is true, the context will be used to compile
+   to a binary file. It is not expected to be used in the embedded
+   version */
+JSContext *JS_NewContext2(void *mem_start, size_t mem_size, const JSSTDLibraryDef *stdlib_def, BOOL prepare_compilation)
+{
+    JSContext *ctx;
+    JSValueArray *arr;
+    int i;
 
+    ctx = js_init_context(mem_start, mem_size, stdlib_def);
     if (prepare_compilation) {
         int atom_table_len;
         JSValueArray *arr, *arr1;
@@ -3597,19 +4747,14 @@ JSContext *JS_NewContext2(void *mem_start, size_t mem_size, const JSSTDLibraryDe
             arr->arr[i] = JS_VALUE_FROM_PTR(ptr);
         }
         ctx->unique_strings_len = arr1->size;
+        /* converted to a hash table at the first insertion */
+        ctx->unique_strings_sorted = TRUE;
     } else {
-        ctx->atom_table = stdlib_def->stdlib_table;
-        ctx->rom_atom_tables[0] = (JSValueArray *)(stdlib_def->stdlib_table +
-                                                   stdlib_def->sorted_atoms_offset);
-        ctx->n_rom_atom_tables = 1;
-        ctx->c_function_table = stdlib_def->c_function_table;
-        ctx->c_finalizer_table = stdlib_def->c_finalizer_table;
+        js_init_rom_atoms(ctx, stdlib_def);
         ctx->unique_strings = JS_NULL;
         ctx->unique_strings_len = 0;
     }
     
-    
-    ctx->current_exception = JS_UNDEFINED;
 #ifdef DEBUG_GC
     /* set the dummy block at the start of the memory */
     {
@@ -3656,6 +4801,16 @@ void JS_FreeContext(JSContext *ctx)
     int size;
     JSObject *p;
     
+#ifdef DUMP_OPCODE_STATS
+    dump_opcode_stats(ctx);
+#endif
+    /* each hook is detached before it is called */
+    while (ctx->free_hooks != NULL) {
+        JSContextFreeHook *hook = ctx->free_hooks;
+        ctx->free_hooks = hook->link;
+        hook->link = NULL;
+        hook->func(ctx, hook);
+    }
     ptr = ctx->heap_base;
     while (ptr < ctx->heap_free) {
         size = get_mblock_size(ptr);
@@ -3663,11 +4818,37 @@ void JS_FreeContext(JSContext *ctx)
         if (p->mtag == JS_MTAG_OBJECT && p->class_id >= JS_CLASS_USER &&
             ctx->c_finalizer_table[p->class_id - JS_CLASS_USER] != NULL) {
             ctx->c_finalizer_table[p->class_id - JS_CLASS_USER](ctx, p->u.user.opaque);
+        } else if (p->mtag == JS_MTAG_OBJECT &&
+                   p->class_id == JS_CLASS_ARRAY_BUFFER) {
+            js_array_buffer_finalizer(ctx, p);
         }
         ptr += size;
     }
 }
 
+void JS_AddContextFreeHook(JSContext *ctx, JSContextFreeHook *hook)
+{
+    JSContextFreeHook *hook1;
+    for(hook1 = ctx->free_hooks; hook1 != NULL; hook1 = hook1->link) {
+        if (hook1 == hook)
+            return;
+    }
+    hook->link = ctx->free_hooks;
+    ctx->free_hooks = hook;
+}
+
+void JS_RemoveContextFreeHook(JSContext *ctx, JSContextFreeHook *hook)
+{
+    JSContextFreeHook **phook;
+    for(phook = &ctx->free_hooks; *phook != NULL; phook = &(*phook)->link) {
+        if (*phook == hook) {
+            *phook = hook->link;
+            hook->link = NULL;
+            break;
+        }
+    }
+}
+
 void JS_SetContextOpaque(JSContext *ctx, void *opaque)
 {
     ctx->opaque = opaque;
@@ -3678,6 +4859,11 @@ void JS_SetInterruptHandler(JSContext *ctx, JSInterruptHandler *interrupt_handle
     ctx->interrupt_handler = interrupt_handler;
 }
 
+void JS_SetClockFunc(JSContext *ctx, JSClockFunc *clock_func)
+{
+    ctx->clock_func = clock_func;
+}
+
 void JS_SetLogFunc(JSContext *ctx, JSWriteFunc *write_func)
 {
     ctx->write_func = write_func;
@@ -3946,12 +5132,14 @@ static int find_line_col(int *pcol_num, JSFunctionBytecode *b, uint32_t pc)
     while (pos < arr->size) {
         get_pc2line(&line_num, &col_num, pc2line->buf, pc2line->size,
                     &pc2line_pos, b->has_column);
-        if (pos == pc) {
+        op = arr->buf[pos];
+        pos += opcode_info[op].size;
+        /* 'pc' may point inside the instruction when the frame is
+           sampled after a jump */
+        if (pc < pos) {
             *pcol_num = col_num;
             return line_num;
         }
-        op = arr->buf[pos];
-        pos += opcode_info[op].size;
     }
  fail:
     *pcol_num = 0;
@@ -4031,6 +5219,36 @@ static void build_backtrace(JSContext *ctx, JSValue error_obj,
     JS_POP_VALUE(ctx, error_obj);
     p1 = JS_VALUE_TO_PTR(error_obj);
     p1->u.error.stack = stack_str;
+    js_write_barrier(ctx, p1, stack_str);
+}
+
+int JS_GetStackFrames(JSContext *ctx, JSStackFrame *tab, int max_frames)
+{
+    JSValue *fp;
+    JSStackFrame *sf;
+    JSFunctionBytecode *b;
+    int n, pc;
+
+    n = 0;
+    fp = ctx->fp;
+    while (fp != (JSValue *)ctx->stack_top && n < max_frames) {
+        sf = &tab[n++];
+        sf->func_name = get_func_name(ctx, fp[FRAME_OFFSET_FUNC_OBJ],
+                                      &sf->func_name_buf, &b);
+        if (sf->func_name && sf->func_name[0] == '\0')
+            sf->func_name = NULL;
+        if (b) {
+            sf->filename = JS_ToCString(ctx, b->filename, &sf->filename_buf);
+            pc = JS_VALUE_GET_INT(fp[FRAME_OFFSET_CUR_PC]) - 1;
+            sf->line_num = find_line_col(&sf->col_num, b, pc);
+        } else {
+            sf->filename = NULL;
+            sf->line_num = 0;
+            sf->col_num = 0;
+        }
+        fp = VALUE_TO_SP(ctx, fp[FRAME_OFFSET_SAVED_FP]);
+    }
+    return n;
 }
 
 #define HINT_STRING  0
@@ -4087,7 +5305,13 @@ static JSValue js_dtoa2(JSContext *ctx, double d, int radix, int n_digits, int f
     JSValue str;
     JSGCRef str_ref;
     JSByteArray *tmp_arr, *p;
+    char buf[32];
 
+    /* no temporary memory is needed for the common cases */
+    len = js_dtoa_fast(buf, d, radix, n_digits, flags);
+    if (len >= 0)
+        return JS_NewStringLen(ctx, buf, len);
+    
     len_max = js_dtoa_max_len(d, radix, n_digits, flags);
     p = js_alloc_byte_array(ctx, len_max + 1);
     if (!p)
@@ -4227,6 +5451,16 @@ static int js_atod1(JSContext *ctx, double *pres, JSValue val,
         return 0;
     }
     
+    p = JS_VALUE_TO_PTR(val);
+    if (p->is_rope) {
+        /* js_atod() needs a zero terminated string */
+        val = js_rope_flatten(ctx, val);
+        if (JS_IsException(val)) {
+            *pres = NAN;
+            return -1;
+        }
+    }
+
     JS_PUSH_VALUE(ctx, val);
     tmp_arr = js_alloc_byte_array(ctx, sizeof(JSATODTempMem));
     JS_POP_VALUE(ctx, val);
@@ -4950,6 +6184,7 @@ static JSValue js_closure(JSContext *ctx, JSValue bfunc, JSValue *fp)
                 return val;
             p = JS_VALUE_TO_PTR(closure);
             p->u.closure.var_refs[i] = val;
+            js_write_barrier(ctx, p, val);
         }
     }
     return closure;
@@ -5067,6 +6302,242 @@ static JSValue __js_poll_interrupt(JSContext *ctx)
         }                                               \
     } while(0)
 
+#ifdef DUMP_OPCODE_STATS
+/* Per-opcode execution statistics. They are shared by all the
+   contexts and dumped by JS_FreeContext(). The cycles of an opcode
+   are the cycles elapsed until the next opcode is dispatched, so
+   they include the C functions it calls. */
+
+typedef struct {
+    uint64_t count;
+    uint64_t cycles;
+} JSOpCodeStats;
+
+#define OPCODE_STATS_TOP_PAIRS 32
+
+static JSOpCodeStats opcode_stats[OP_COUNT];
+static uint32_t opcode_pair_count[OP_COUNT][OP_COUNT];
+static int opcode_stats_last_op = -1;
+static uint32_t opcode_stats_last_time;
+
+/* only the low 32 bits are used */
+static inline uint32_t js_get_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t v;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#elif defined(__XTENSA__)
+    uint32_t v;
+    __asm__ volatile("rsr %0, ccount" : "=a"(v));
+    return v;
+#else
+    return 0;
+#endif
+}
+
+static void opcode_stats_update(int opcode)
+{
+    uint32_t t;
+    t = js_get_cycles();
+    if (opcode_stats_last_op >= 0) {
+        opcode_stats[opcode_stats_last_op].cycles += t - opcode_stats_last_time;
+        opcode_pair_count[opcode_stats_last_op][opcode]++;
+    }
+    opcode_stats[opcode].count++;
+    opcode_stats_last_op = opcode;
+    opcode_stats_last_time = t;
+}
+
+/* called when leaving the interpreter */
+static void opcode_stats_end(void)
+{
+    if (opcode_stats_last_op >= 0) {
+        opcode_stats[opcode_stats_last_op].cycles +=
+            js_get_cycles() - opcode_stats_last_time;
+        opcode_stats_last_op = -1;
+    }
+}
+
+static int opcode_stats_cmp(size_t i1, size_t i2, void *opaque)
+{
+    uint8_t *tab = opaque;
+    uint64_t c1 = opcode_stats[tab[i1]].count;
+    uint64_t c2 = opcode_stats[tab[i2]].count;
+    return (c1 < c2) - (c1 > c2);
+}
+
+static void opcode_stats_swap(size_t i1, size_t i2, void *opaque)
+{
+    uint8_t *tab = opaque, tmp;
+    tmp = tab[i1];
+    tab[i1] = tab[i2];
+    tab[i2] = tmp;
+}
+
+static void dump_opcode_stats(JSContext *ctx)
+{
+    uint8_t tab[OP_COUNT];
+    uint16_t top_pairs[OPCODE_STATS_TOP_PAIRS][2];
+    uint64_t count_tot, cycles_tot;
+    uint32_t c;
+    int i, j, k, n, n_pairs;
+
+    n = 0;
+    count_tot = 0;
+    cycles_tot = 0;
+    for(i = 0; i < OP_COUNT; i++) {
+        if (opcode_stats[i].count != 0) {
+            tab[n++] = i;
+            count_tot += opcode_stats[i].count;
+            cycles_tot += opcode_stats[i].cycles;
+        }
+    }
+    if (count_tot == 0)
+        return;
+    rqsort_idx(n, opcode_stats_cmp, opcode_stats_swap, tab);
+
+    /* js_printf() has no floating point support */
+    js_printf(ctx, "%-20s %12s %7s %14s %7s %8s\n",
+              "OPCODE", "COUNT", "%", "CYCLES", "%", "CYC/OP");
+    for(i = 0; i < n; i++) {
+        JSOpCodeStats *s = &opcode_stats[tab[i]];
+        uint32_t p1, p2, r;
+        p1 = s->count * 10000 / count_tot;
+        p2 = cycles_tot ? s->cycles * 10000 / cycles_tot : 0;
+        r = s->cycles * 10 / s->count;
+        js_printf(ctx, "%-20s %12" PRIu64 " %4u.%02u %14" PRIu64 " %4u.%02u %6u.%u\n",
+                  opcode_info[tab[i]].name, s->count, p1 / 100, p1 % 100,
+                  s->cycles, p2 / 100, p2 % 100, r / 10, r % 10);
+    }
+    js_printf(ctx, "%-20s %12" PRIu64 " %7s %14" PRIu64 "\n\n",
+              "total", count_tot, "", cycles_tot);
+
+    /* keep the most frequent pairs sorted by decreasing count */
+    n_pairs = 0;
+    for(i = 0; i < OP_COUNT; i++) {
+        for(j = 0; j < OP_COUNT; j++) {
+            c = opcode_pair_count[i][j];
+            if (c == 0)
+                continue;
+            for(k = n_pairs; k > 0; k--) {
+                if (opcode_pair_count[top_pairs[k - 1][0]][top_pairs[k - 1][1]] >= c)
+                    break;
+                if (k < OPCODE_STATS_TOP_PAIRS) {
+                    top_pairs[k][0] = top_pairs[k - 1][0];
+                    top_pairs[k][1] = top_pairs[k - 1][1];
+                }
+            }
+            if (k < OPCODE_STATS_TOP_PAIRS) {
+                top_pairs[k][0] = i;
+                top_pairs[k][1] = j;
+                if (n_pairs < OPCODE_STATS_TOP_PAIRS)
+                    n_pairs++;
+            }
+        }
+    }
+    js_printf(ctx, "%-41s %12s %7s\n", "OPCODE PAIR", "COUNT", "%");
+    for(k = 0; k < n_pairs; k++) {
+        uint32_t p1;
+        i = top_pairs[k][0];
+        j = top_pairs[k][1];
+        c = opcode_pair_count[i][j];
+        p1 = (uint64_t)c * 10000 / count_tot;
+        js_printf(ctx, "%-20s %-20s %12u %4u.%02u\n",
+                  opcode_info[i].name, opcode_info[j].name,
+                  c, p1 / 100, p1 % 100);
+    }
+
+    memset(opcode_stats, 0, sizeof(opcode_stats));
+    memset(opcode_pair_count, 0, sizeof(opcode_pair_count));
+}
+#endif /* DUMP_OPCODE_STATS */
+
+/* Return the definition of 'func_obj' if it is a C function with a
+   typed signature, NULL otherwise. */
+static const JSCFunctionDef *js_get_typed_cfunction_def(JSContext *ctx,
+                                                        JSValue func_obj)
+{
+    const JSCFunctionDef *fd;
+    JSObject *p;
+
+    if (!JS_IsPtr(func_obj)) {
+        if (JS_VALUE_GET_SPECIAL_TAG(func_obj) != JS_TAG_SHORT_FUNC)
+            return NULL;
+        fd = &ctx->c_function_table[JS_VALUE_GET_SPECIAL_VALUE(func_obj)];
+    } else {
+        p = JS_VALUE_TO_PTR(func_obj);
+        if (p->mtag != JS_MTAG_OBJECT || p->class_id != JS_CLASS_C_FUNCTION)
+            return NULL;
+        fd = &ctx->c_function_table[p->u.cfunc.idx];
+    }
+    if (fd->def_type < JS_CFUNC_f_f)
+        return NULL;
+    return fd;
+}
+
+/* Return TRUE if the 'argc' arguments in 'sp' (last argument first)
+   can be given to the typed C function 'fd' without creating a
+   frame. */
+static BOOL js_typed_cfunction_check_args(JSContext *ctx, const JSCFunctionDef *fd,
+                                          JSValue *sp, int argc)
+{
+    int i;
+    if (argc < fd->arg_count)
+        return FALSE;
+    /* the conversions cannot call JS code if the arguments are numbers */
+    for(i = 0; i < fd->arg_count; i++) {
+        if (!JS_IsNumber(ctx, sp[argc - 1 - i]))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* Return the definition of the function called by OP_call or
+   OP_call_method if it has a typed signature and if its arguments are
+   all numbers, so that it can be called without creating a frame. 'sp'
+   points to the last argument. Return NULL otherwise. */
+static const JSCFunctionDef *js_get_typed_cfunction(JSContext *ctx, JSValue *sp,
+                                                    int argc)
+{
+    const JSCFunctionDef *fd;
+
+    fd = js_get_typed_cfunction_def(ctx, sp[argc]);
+    if (!fd || !js_typed_cfunction_check_args(ctx, fd, sp, argc))
+        return NULL;
+    return fd;
+}
+
+/* call a function returned by js_get_typed_cfunction(). Only the
+   result can trigger a GC. */
+static JSValue js_call_typed_cfunction(JSContext *ctx, const JSCFunctionDef *fd,
+                                       JSValue *sp, int argc)
+{
+    int a[3], i;
+    double d[2];
+
+    switch(fd->def_type) {
+    case JS_CFUNC_f_f:
+        JS_ToNumber(ctx, &d[0], sp[argc - 1]);
+        return JS_NewFloat64(ctx, fd->func.f_f(d[0]));
+    case JS_CFUNC_f_ff:
+        for(i = 0; i < 2; i++)
+            JS_ToNumber(ctx, &d[i], sp[argc - 1 - i]);
+        return JS_NewFloat64(ctx, fd->func.f_ff(d[0], d[1]));
+    default:
+        for(i = 0; i < fd->arg_count; i++)
+            JS_ToInt32(ctx, &a[i], sp[argc - 1 - i]);
+        if (fd->def_type == JS_CFUNC_i_ii)
+            return JS_NewInt32(ctx, fd->func.i_ii(a[0], a[1]));
+        if (fd->def_type == JS_CFUNC_i_iii)
+            return JS_NewInt32(ctx, fd->func.i_iii(a[0], a[1], a[2]));
+        fd->func.v_iii(a[0], a[1], a[2]);
+        return JS_UNDEFINED;
+    }
+}
+
 /* must use JS_StackCheck() before using it */
 void JS_PushArg(JSContext *ctx, JSValue val)
 {
@@ -5092,6 +6563,7 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
     /* temporary variables */
     int opcode = OP_invalid, i;
     JSFunctionBytecode *b;
+    int64_t ir;
 #ifdef JS_USE_SHORT_FLOAT
     double dr;
 #endif
@@ -5107,12 +6579,34 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
     pc = NULL;
     goto function_call;
 
+#ifdef USE_THREADED_DISPATCH
+    {
+        /* the opcodes without CASE() are handled by DEFAULT */
+        static const void * const dispatch_table[256] = {
+            [0 ... 255] = &&case_default,
+#define FMT(f)
+#define DEF(id, size, n_pop, n_push, f) [OP_ ## id] = &&case_OP_ ## id,
+#define def(id, size, n_pop, n_push, f)
+#include "mquickjs_opcode.h"
+#undef def
+#undef DEF
+#undef FMT
+        };
+        
+#define CASE(op)        case op: case_ ## op
+#define DEFAULT         default: case_default
+#define BREAK           goto *dispatch_table[opcode = *pc++]
+#else
 #define CASE(op)        case op
 #define DEFAULT         default
 #define BREAK           break
+#endif
     
     for(;;) {
         opcode = *pc++;
+#ifdef DUMP_OPCODE_STATS
+        opcode_stats_update(opcode);
+#endif
 #ifdef DUMP_EXEC
         {
             JSByteArray *arr;
@@ -5333,6 +6827,21 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
             goto global_function_call;
         CASE(OP_call):
             call_flags = get_u16(pc);
+            {
+                const JSCFunctionDef *fd;
+                fd = js_get_typed_cfunction(ctx, sp, call_flags);
+                if (fd) {
+                    SAVE();
+                    val = js_call_typed_cfunction(ctx, fd, sp, call_flags);
+                    RESTORE();
+                    sp += call_flags; /* pop the arguments */
+                    sp[0] = val;
+                    if (unlikely(JS_IsException(val)))
+                        goto exception;
+                    pc += 2;
+                    BREAK;
+                }
+            }
         global_function_call:
             js_reverse_val(sp, (call_flags & FRAME_CF_ARGC_MASK) + 1);
             *--sp = JS_UNDEFINED;
@@ -5345,6 +6854,21 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                 JSByteArray *byte_code;
                 
                 call_flags = get_u16(pc);
+                {
+                    const JSCFunctionDef *fd;
+                    fd = js_get_typed_cfunction(ctx, sp, call_flags);
+                    if (fd) {
+                        SAVE();
+                        val = js_call_typed_cfunction(ctx, fd, sp, call_flags);
+                        RESTORE();
+                        sp += call_flags + 1; /* pop the arguments and 'this' */
+                        sp[0] = val;
+                        if (unlikely(JS_IsException(val)))
+                            goto exception;
+                        pc += 2;
+                        BREAK;
+                    }
+                }
 
                 n = (call_flags & FRAME_CF_ARGC_MASK) + 2;
                 js_reverse_val(sp, n);
@@ -5439,14 +6963,53 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                                 if (JS_ToNumber(ctx, &d, fp[FRAME_OFFSET_ARG0])) {
                                     val = JS_EXCEPTION;
                                 } else {
-                                    d = fd->func.f_f(d);
+                                    val = JS_NewFloat64(ctx, fd->func.f_f(d));
+                                }
+                            }
+                            break;
+                        case JS_CFUNC_f_ff:
+                            {
+                                double d1, d2;
+                                if (JS_ToNumber(ctx, &d1, fp[FRAME_OFFSET_ARG0]) ||
+                                    JS_ToNumber(ctx, &d2, fp[FRAME_OFFSET_ARG0 + 1])) {
+                                    val = JS_EXCEPTION;
+                                } else {
+                                    val = JS_NewFloat64(ctx, fd->func.f_ff(d1, d2));
+                                }
+                            }
+                            break;
+                        case JS_CFUNC_i_ii:
+                            {
+                                int a1, a2;
+                                if (JS_ToInt32(ctx, &a1, fp[FRAME_OFFSET_ARG0]) ||
+                                    JS_ToInt32(ctx, &a2, fp[FRAME_OFFSET_ARG0 + 1])) {
+                                    val = JS_EXCEPTION;
+                                } else {
+                                    val = JS_NewInt32(ctx, fd->func.i_ii(a1, a2));
+                                }
+                            }
+                            break;
+                        case JS_CFUNC_i_iii:
+                        case JS_CFUNC_v_iii:
+                            {
+                                int a1, a2, a3;
+                                if (JS_ToInt32(ctx, &a1, fp[FRAME_OFFSET_ARG0]) ||
+                                    JS_ToInt32(ctx, &a2, fp[FRAME_OFFSET_ARG0 + 1]) ||
+                                    JS_ToInt32(ctx, &a3, fp[FRAME_OFFSET_ARG0 + 2])) {
+                                    val = JS_EXCEPTION;
+                                } else if (fd->def_type == JS_CFUNC_i_iii) {
+                                    val = JS_NewInt32(ctx, fd->func.i_iii(a1, a2, a3));
+                                } else {
+                                    fd->func.v_iii(a1, a2, a3);
+                                    val = JS_UNDEFINED;
                                 }
-                                val = JS_NewFloat64(ctx, d);
                             }
                             break;
                         default:
                             assert(0);
                         }
+                        if (unlikely(ctx->temp_blocks != NULL))
+                            js_temp_free(ctx, fp);
                         if (JS_IsExceptionOrTailCall(val) &&
                             JS_VALUE_GET_SPECIAL_VALUE(val) >= JS_EX_CALL) {
                             JSValue *fp1, *sp1;
@@ -5483,6 +7046,19 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                             p = JS_VALUE_TO_PTR(func_obj);
                         }
                         b = JS_VALUE_TO_PTR(p->u.closure.func_bytecode);
+                        if (unlikely(b->byte_code == JS_NULL)) {
+                            /* first call of a function parsed with
+                               JS_EVAL_LAZY */
+                            ctx->sp = sp;
+                            ctx->fp = fp;
+                            if (js_compile_lazy_function(ctx, p->u.closure.func_bytecode)) {
+                                val = JS_EXCEPTION;
+                                goto call_exception;
+                            }
+                            func_obj = sp[FRAME_OFFSET_FUNC_OBJ];
+                            p = JS_VALUE_TO_PTR(func_obj);
+                            b = JS_VALUE_TO_PTR(p->u.closure.func_bytecode);
+                        }
                         if (b->vars != JS_NULL) {
                             JSValueArray *vars = JS_VALUE_TO_PTR(b->vars);
                             n_vars = vars->size - b->arg_count;
@@ -5613,6 +7189,7 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                     assert(!pv->is_detached);
                     pv->u.value = *pv->u.pvalue;
                     pv->is_detached = TRUE;
+                    js_write_barrier(ctx, pv, pv->u.value);
                     /* shrink 'pv' */
                     set_free_block((uint8_t *)pv + sizeof(JSVarRef) - sizeof(JSValue), sizeof(JSValue));
                 }
@@ -5747,6 +7324,51 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
         CASE(OP_put_arg1): fp[FRAME_OFFSET_ARG0 + 1] = *sp++; BREAK;
         CASE(OP_put_arg2): fp[FRAME_OFFSET_ARG0 + 2] = *sp++; BREAK;
         CASE(OP_put_arg3): fp[FRAME_OFFSET_ARG0 + 3] = *sp++; BREAK;
+
+            /* superinstructions: the following opcodes are still
+               present in the bytecode */
+        CASE(OP_get_loc0_get_field):
+        CASE(OP_get_loc1_get_field):
+        CASE(OP_get_loc2_get_field):
+        CASE(OP_get_loc3_get_field):
+            *--sp = fp[FRAME_OFFSET_VAR0 - (opcode - OP_get_loc0_get_field)];
+            pc++; /* skip OP_get_field */
+            goto get_field_common;
+        CASE(OP_get_arg0_get_field):
+        CASE(OP_get_arg1_get_field):
+        CASE(OP_get_arg2_get_field):
+        CASE(OP_get_arg3_get_field):
+            *--sp = fp[FRAME_OFFSET_ARG0 + (opcode - OP_get_arg0_get_field)];
+            pc++; /* skip OP_get_field */
+            goto get_field_common;
+        CASE(OP_inc_loc0):
+        CASE(OP_inc_loc1):
+        CASE(OP_inc_loc2):
+        CASE(OP_inc_loc3):
+            {
+                JSValue *pv = &fp[FRAME_OFFSET_VAR0 - (opcode - OP_inc_loc0)];
+                if (likely(JS_IsInt(*pv) &&
+                           JS_VALUE_GET_INT(*pv) != JS_SHORTINT_MAX)) {
+                    *pv = JS_NewShortInt(JS_VALUE_GET_INT(*pv) + 1);
+                    pc += 2; /* skip OP_inc and OP_put_locN */
+                } else {
+                    /* slow case: execute OP_inc and OP_put_locN */
+                    *--sp = *pv;
+                }
+            }
+            BREAK;
+        CASE(OP_inc_loc8):
+            {
+                JSValue *pv = &fp[FRAME_OFFSET_VAR0 - *pc++];
+                if (likely(JS_IsInt(*pv) &&
+                           JS_VALUE_GET_INT(*pv) != JS_SHORTINT_MAX)) {
+                    *pv = JS_NewShortInt(JS_VALUE_GET_INT(*pv) + 1);
+                    pc += 3; /* skip OP_inc and OP_put_loc8 */
+                } else {
+                    *--sp = *pv;
+                }
+            }
+            BREAK;
             
         CASE(OP_get_var_ref):
         CASE(OP_get_var_ref_nocheck):
@@ -5796,6 +7418,7 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                     goto exception;
                 }
                 *pval = *sp++;
+                js_write_barrier(ctx, pv, *pval);
                 pc += 2;
             }
             BREAK;
@@ -5844,12 +7467,22 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                     /* fast case */
                     JSObject *p = JS_VALUE_TO_PTR(obj);
                     JSProperty *pr;
+                    JSFieldCacheEntry *ce;
+                    JSValue *pval;
                     if (unlikely(p->mtag != JS_MTAG_OBJECT))
                         goto get_field_slow;
+                    ce = get_field_cache_entry(ctx->get_field_cache, pc);
                     for(;;) {
+                        /* the cache entry records the object of the
+                           prototype chain where the property was
+                           last found */
+                        pval = field_cache_find(ce, p, prop);
+                        if (pval) {
+                            val = *pval;
+                            break;
+                        }
                         /* no array check is necessary because 'prop' is
                            guaranteed not to be a numeric property */
-                        /* XXX: slow due to short ints */
                         pr = find_own_property_inlined(ctx, p, prop);
                         if (pr) {
                             if (unlikely(pr->prop_type != JS_PROP_NORMAL)) {
@@ -5857,7 +7490,8 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                                    object */
                                 goto get_field_slow;
                             } else {
-                                val = pr->value;
+                                field_cache_update(ce, p, pr);
+                                val = *get_prop_value_ptr(p, pr);
                                 break;
                             }
                         }
@@ -5943,20 +7577,30 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                     /* fast case */
                     JSObject *p = JS_VALUE_TO_PTR(obj);
                     JSProperty *pr;
+                    JSFieldCacheEntry *ce;
+                    JSValue *pval;
                     if (unlikely(p->mtag != JS_MTAG_OBJECT))
                         goto put_field_slow;
-                    /* no array check is necessary because 'prop' is
-                       guaranteed not to be a numeric property */
-                    /* XXX: slow due to short ints */
-                    pr = find_own_property_inlined(ctx, p, prop);
-                    if (unlikely(!pr))
-                        goto put_field_slow;
-                    if (unlikely(pr->prop_type != JS_PROP_NORMAL))
-                        goto put_field_slow;
-                    /* XXX: slow */
-                    if (unlikely(JS_IS_ROM_PTR(ctx, pr)))
-                        goto put_field_slow;
-                    pr->value = sp[0];
+                    /* only RAM properties are recorded in the put
+                       cache, so no ROM test is needed on a hit */
+                    ce = get_field_cache_entry(ctx->put_field_cache, pc);
+                    pval = field_cache_find(ce, p, prop);
+                    if (!pval) {
+                        /* no array check is necessary because 'prop' is
+                           guaranteed not to be a numeric property */
+                        pr = find_own_property_inlined(ctx, p, prop);
+                        if (unlikely(!pr))
+                            goto put_field_slow;
+                        if (unlikely(pr->prop_type != JS_PROP_NORMAL))
+                            goto put_field_slow;
+                        /* XXX: slow */
+                        if (unlikely(JS_IS_ROM_PTR(ctx, pr)))
+                            goto put_field_slow;
+                        field_cache_update(ce, p, pr);
+                        pval = get_prop_value_ptr(p, pr);
+                    }
+                    *pval = sp[0];
+                    js_prop_write_barrier(ctx, p, sp[0]);
                     sp += 2;
                 } else {
                 put_field_slow:
@@ -6051,6 +7695,7 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                     } else {
                         arr->arr[idx] = sp[0];
                     }
+                    js_write_barrier(ctx, arr, sp[0]);
                     sp += 3;
                 } else {
                 put_array_el_slow:
@@ -6089,6 +7734,11 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                 SAVE();
                 if (opcode == OP_define_field) {
                     val = JS_DefinePropertyValue(ctx, sp[1], prop, sp[0]);
+                    /* share the shape once the object literal is
+                       complete i.e. its property table is full */
+                    if (!JS_IsException(val) &&
+                        js_object_share_shape(ctx, sp[1]))
+                        val = JS_EXCEPTION;
                 } else if (opcode == OP_define_getter)
                     val = JS_DefinePropertyGetSet(ctx, sp[1], prop, sp[0], JS_UNDEFINED, JS_DEF_PROP_HAS_GET);
                 else
@@ -6121,8 +7771,11 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                 op2 = sp[0];
                 if (likely(JS_VALUE_IS_BOTH_INT(op1, op2))) {
                     int r;
-                    if (unlikely(__builtin_add_overflow((int)op1, (int)op2, &r)))
-                        goto add_slow;
+                    if (unlikely(__builtin_add_overflow((int)op1, (int)op2, &r))) {
+                        ir = (int64_t)JS_VALUE_GET_INT(op1) + JS_VALUE_GET_INT(op2);
+                        sp++;
+                        goto int64_result;
+                    }
                     sp[1] = (uint32_t)r;
                 } else 
 #ifdef JS_USE_SHORT_FLOAT
@@ -6136,7 +7789,6 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                 } else
 #endif
                 {
-                add_slow:
                     SAVE();
                     val = js_add_slow(ctx);
                     RESTORE();
@@ -6154,8 +7806,11 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                 op2 = sp[0];
                 if (likely(JS_VALUE_IS_BOTH_INT(op1, op2))) {
                     int r;
-                    if (unlikely(__builtin_sub_overflow((int)op1, (int)op2, &r)))
-                        goto binary_arith_slow;
+                    if (unlikely(__builtin_sub_overflow((int)op1, (int)op2, &r))) {
+                        ir = (int64_t)JS_VALUE_GET_INT(op1) - JS_VALUE_GET_INT(op2);
+                        sp++;
+                        goto int64_result;
+                    }
                     sp[1] = (uint32_t)r;
                 } else
 #ifdef JS_USE_SHORT_FLOAT
@@ -6191,7 +7846,9 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                         sp++;
                         goto float_result;
 #else
-                        goto binary_arith_slow;
+                        ir = r >> 1;
+                        sp++;
+                        goto int64_result;
 #endif
                     }
                     /* -0 case */
@@ -6226,6 +7883,13 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                     int v1, v2;
                     v1 = JS_VALUE_GET_INT(op1);
                     v2 = JS_VALUE_GET_INT(op2);
+                    /* exact integer division: avoid the float division
+                       (no FPU or soft float on some targets) */
+                    if (v2 != 0 && (v1 % v2) == 0 && !(v1 == 0 && v2 < 0)) {
+                        ir = (int64_t)v1 / v2;
+                        sp++;
+                        goto int64_result;
+                    }
                     SAVE();
                     val = JS_NewFloat64(ctx, (double)v1 / (double)v2);
                     RESTORE();
@@ -6247,10 +7911,14 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                     int v1, v2, r;
                     v1 = JS_VALUE_GET_INT(op1);
                     v2 = JS_VALUE_GET_INT(op2);
-                    if (unlikely(v1 < 0 || v2 <= 0))
+                    if (unlikely(v2 == 0))
                         goto binary_arith_slow;
+                    /* same sign as the dividend, as in JS */
                     r = v1 % v2;
-                    sp[1] = JS_NewShortInt(r);
+                    if (unlikely(r == 0 && v1 < 0))
+                        sp[1] = ctx->minus_zero;
+                    else
+                        sp[1] = JS_NewShortInt(r);
                     sp++;
                 } else {
                     goto binary_arith_slow;
@@ -6267,6 +7935,16 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
             sp[1] = val;
             sp++;
             BREAK;
+        int64_result:
+            /* integer result which does not fit in a short integer:
+               the slow path would convert the operands to float */
+            SAVE();
+            val = JS_NewInt64(ctx, ir);
+            RESTORE();
+            if (JS_IsException(val))
+                goto exception;
+            sp[0] = val;
+            BREAK;
         CASE(OP_plus):
             {
                 JSValue op1;
@@ -6340,8 +8018,10 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                 op1 = sp[0];
                 if (JS_IsInt(op1)) {
                     v1 = JS_VALUE_GET_INT(op1);
-                    if (unlikely(v1 == JS_SHORTINT_MAX))
-                        goto unary_arith_slow;
+                    if (unlikely(v1 == JS_SHORTINT_MAX)) {
+                        ir = (int64_t)v1 + 1;
+                        goto int64_result;
+                    }
                     sp[0] = JS_NewShortInt(v1 + 1);
                 } else {
                     goto unary_arith_slow;
@@ -6355,8 +8035,10 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                 op1 = sp[0];
                 if (JS_IsInt(op1)) {
                     v1 = JS_VALUE_GET_INT(op1);
-                    if (unlikely(v1 == JS_SHORTINT_MIN))
-                        goto unary_arith_slow;
+                    if (unlikely(v1 == JS_SHORTINT_MIN)) {
+                        ir = (int64_t)v1 - 1;
+                        goto int64_result;
+                    }
                     sp[0] = JS_NewShortInt(v1 - 1);
                 } else {
                 unary_arith_slow:
@@ -6423,7 +8105,9 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                         sp++;
                         goto float_result;
 #else
-                        goto binary_logic_slow;
+                        ir = r;
+                        sp++;
+                        goto int64_result;
 #endif
                     }
                     sp[1] = JS_NewShortInt(r);
@@ -6448,7 +8132,9 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                         sp++;
                         goto float_result;
 #else
-                        goto binary_logic_slow;
+                        ir = r;
+                        sp++;
+                        goto int64_result;
 #endif
                     }
                     sp[1] = JS_NewShortInt(r);
@@ -6548,6 +8234,39 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
             OP_CMP(OP_neq, !=, js_eq_slow(ctx, 1));
             OP_CMP(OP_strict_eq, ==, js_strict_eq_slow(ctx, 0));
             OP_CMP(OP_strict_neq, !=, js_strict_eq_slow(ctx, 1));
+
+            /* compare and OP_if_false */
+#define OP_CMP_IF_FALSE(opcode, binary_op, cmp_opcode)          \
+            CASE(opcode):                                       \
+                {                                               \
+                JSValue op1, op2;                               \
+                op1 = sp[1];                                    \
+                op2 = sp[0];                                    \
+                if (likely(JS_VALUE_IS_BOTH_INT(op1, op2))) {   \
+                    sp += 2;                                    \
+                    /* pc points to OP_if_false */              \
+                    if (JS_VALUE_GET_INT(op1) binary_op JS_VALUE_GET_INT(op2)) \
+                        pc += 5;                                \
+                    else                                        \
+                        pc += 1 + (int32_t)get_u32(pc + 1);     \
+                    POLL_INTERRUPT();                           \
+                } else {                                        \
+                    /* slow case: OP_if_false is executed next */ \
+                    SAVE();                                     \
+                    val = js_relational_slow(ctx, cmp_opcode);  \
+                    RESTORE();                                  \
+                    if (JS_IsException(val))                    \
+                        goto exception;                         \
+                    sp[1] = val;                                \
+                    sp++;                                       \
+                }                                               \
+                }                                               \
+                BREAK;
+
+            OP_CMP_IF_FALSE(OP_lt_if_false, <, OP_lt);
+            OP_CMP_IF_FALSE(OP_lte_if_false, <=, OP_lte);
+            OP_CMP_IF_FALSE(OP_gt_if_false, >, OP_gt);
+            OP_CMP_IF_FALSE(OP_gte_if_false, >=, OP_gte);
         CASE(OP_in):
             SAVE();
             val = js_operator_in(ctx);
@@ -6600,7 +8319,14 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
                 goto exception;
             sp -= 2;
             BREAK;
-        default:
+        /* not generated by the compiler */
+        CASE(OP_invalid):
+        CASE(OP_dup1):
+        CASE(OP_nop):
+        CASE(OP_push_const8):
+        CASE(OP_fclosure8):
+        CASE(OP_push_empty_string):
+        DEFAULT:
             {
                 JSByteArray *byte_code = JS_VALUE_TO_PTR(b->byte_code);
                 SAVE();
@@ -6612,7 +8338,13 @@ JSValue JS_Call(JSContext *ctx, int call_flags)
         }
       restart: ;
     } /* switch */
+#ifdef USE_THREADED_DISPATCH
+    }
+#endif
  done:
+#ifdef DUMP_OPCODE_STATS
+    opcode_stats_end();
+#endif
     ctx->sp = sp;
     ctx->fp = fp;
     ctx->js_call_rec_count--;
@@ -6687,10 +8419,10 @@ static void js_dump_error(JSContext *ctx, JSObject *p)
     if (p->proto != JS_NULL) 
         p1 = JS_VALUE_TO_PTR(p->proto);
     pr = find_own_property(ctx, p1, js_get_atom(ctx, JS_ATOM_name));
-    if (!pr || !JS_IsString(ctx, pr->value))
+    if (!pr || !JS_IsString(ctx, *get_prop_value_ptr(p1, pr)))
         name = js_get_atom(ctx, JS_ATOM_Error);
     else
-        name = pr->value;
+        name = *get_prop_value_ptr(p1, pr);
     js_printf(ctx, "%" JSValue_PRI, name);
     if (p->u.error.message != JS_NULL) {
         js_printf(ctx, ": %" JSValue_PRI, p->u.error.message);
@@ -6733,13 +8465,11 @@ static void js_dump_object(JSContext *ctx, JSObject *p, int flags)
                 int32_t v32;
                 uint32_t u32;
                 double d;
-                JSObject *pbuffer;
-                JSByteArray *arr;
+                uint8_t *buf;
                 JS_PrintValueF(ctx, js_find_class_name(ctx, p->class_id),
                                JS_DUMP_NOQUOTE);
                 js_printf(ctx, "([ ");
-                pbuffer = JS_VALUE_TO_PTR(p->u.typed_array.buffer);
-                arr = JS_VALUE_TO_PTR(pbuffer->u.array_buffer.byte_buffer);
+                buf = js_array_buffer_get_buf(JS_VALUE_TO_PTR(p->u.typed_array.buffer));
                 for(i = 0; i < p->u.typed_array.len; i++) {
                     if (i != 0)
                         js_printf(ctx, ", ");
@@ -6748,34 +8478,34 @@ static void js_dump_object(JSContext *ctx, JSObject *p, int flags)
                     default:
                     case JS_CLASS_UINT8C_ARRAY:
                     case JS_CLASS_UINT8_ARRAY:
-                        u32 = *((uint8_t *)arr->buf + idx);
+                        u32 = *((uint8_t *)buf + idx);
                         js_printf(ctx, "%" PRIu32, u32);
                         break;
                     case JS_CLASS_INT8_ARRAY:
-                        v32 = *((int8_t *)arr->buf + idx);
+                        v32 = *((int8_t *)buf + idx);
                         js_printf(ctx, "%" PRId32, v32);
                         break;
                     case JS_CLASS_INT16_ARRAY:
-                        v32 = *((int16_t *)arr->buf + idx);
+                        v32 = *((int16_t *)buf + idx);
                         js_printf(ctx, "%" PRId32, v32);
                         break;
                     case JS_CLASS_UINT16_ARRAY:
-                        u32 = *((uint16_t *)arr->buf + idx);
+                        u32 = *((uint16_t *)buf + idx);
                         js_printf(ctx, "%" PRIu32, u32);
                         break;
                     case JS_CLASS_INT32_ARRAY:
-                        v32 = *((int32_t *)arr->buf + idx);
+                        v32 = *((int32_t *)buf + idx);
                         js_printf(ctx, "%" PRId32, v32);
                         break;
                     case JS_CLASS_UINT32_ARRAY:
-                        u32 = *((uint32_t *)arr->buf + idx);
+                        u32 = *((uint32_t *)buf + idx);
                         js_printf(ctx, "%" PRIu32, u32);
                         break;
                     case JS_CLASS_FLOAT32_ARRAY:
-                        d = *((float *)arr->buf + idx);
+                        d = *((float *)buf + idx);
                         goto ta_d;
                     case JS_CLASS_FLOAT64_ARRAY:
-                        d = *((double *)arr->buf + idx);
+                        d = *((double *)buf + idx);
                     ta_d:
                         js_dump_float64(ctx, d);
                         break;
@@ -6788,7 +8518,7 @@ static void js_dump_object(JSContext *ctx, JSObject *p, int flags)
                 JSValueArray *arr;
                 BOOL is_first = TRUE;
 
-                arr = JS_VALUE_TO_PTR(p->props);
+                arr = get_prop_table(p);
                 prop_count = JS_VALUE_GET_INT(arr->arr[0]);
                 hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
                 if (p->class_id == JS_CLASS_ARRAY) {
@@ -6819,7 +8549,7 @@ static void js_dump_object(JSContext *ctx, JSObject *p, int flags)
                         if (!(flags & JS_DUMP_RAW) && pr->prop_type == JS_PROP_SPECIAL) {
                             JS_PrintValue(ctx, get_special_prop(ctx, pr->value));
                         } else {
-                            JS_PrintValue(ctx, pr->value);
+                            JS_PrintValue(ctx, *get_prop_value_ptr(p, pr));
                         }
                         is_first = FALSE;
                         j++;
@@ -6972,7 +8702,7 @@ void JS_PrintValueF(JSContext *ctx, JSValue val, int flags)
                 JSString *p = ptr;
                 int sep;
                 sep = p->is_unique ? '\'' : '\"';
-                dump_string(ctx, sep, p->buf, p->len, flags);
+                dump_string(ctx, sep, js_string_buf(p), p->len, flags);
             }
             break;
         case JS_MTAG_VALUE_ARRAY:
@@ -7036,6 +8766,7 @@ static uint32_t val_to_offset(JSContext *ctx, JSValue val)
 
 void JS_DumpMemory(JSContext *ctx, BOOL is_long)
 {
+    JSGCStats *gs = &ctx->gc_stats;
     uint8_t *ptr;
     uint32_t mtag_mem_size[JS_MTAG_COUNT];
     uint32_t mtag_count[JS_MTAG_COUNT];
@@ -7094,6 +8825,14 @@ void JS_DumpMemory(JSContext *ctx, BOOL is_long)
            (unsigned int)(ctx->heap_free - ctx->heap_base),
            (unsigned int)(ctx->stack_top - ctx->heap_base),
            (unsigned int)(ctx->stack_top - (uint8_t *)ctx->sp));
+    js_printf(ctx, "max heap size=%u max stack_size=%u min free size=%u\n",
+              (unsigned int)max_uint32(ctx->heap_size_max, ctx->heap_free - ctx->heap_base),
+              (unsigned int)ctx->stack_size_max,
+              (unsigned int)ctx->free_size_min);
+    js_printf(ctx, "gc count=%u minor=%u reclaimed=%" PRIu64 " pause total=%" PRIu64 "us max=%uus\n",
+              (unsigned int)gs->count, (unsigned int)gs->minor_count,
+              gs->reclaimed_total, gs->pause_total,
+              (unsigned int)gs->pause_max);
 }
 
 static __maybe_unused void JS_DumpUniqueStrings(JSContext *ctx)
@@ -7101,9 +8840,13 @@ static __maybe_unused void JS_DumpUniqueStrings(JSContext *ctx)
     int i;
     JSValueArray *arr;
     
+    if (ctx->unique_strings == JS_NULL)
+        return;
     arr = JS_VALUE_TO_PTR( ctx->unique_strings);
     js_printf(ctx, "%5s %s\n", "N", "UNIQUE_STRING");
-    for(i = 0; i < ctx->unique_strings_len; i++) {
+    for(i = 0; i < arr->size; i++) {
+        if (arr->arr[i] == JS_NULL)
+            continue;
         js_printf(ctx, "%5d ", i);
         JS_PrintValue(ctx, arr->arr[i]);
         js_printf(ctx, "\n");
@@ -7125,6 +8868,47 @@ static __maybe_unused void JS_DumpUniqueStrings(JSContext *ctx)
 }
 #endif
 
+void JS_GetMemoryStats(JSContext *ctx, JSMemoryStats *stats)
+{
+    JSMemBlockStats *tab[JS_MTAG_COUNT];
+    uint8_t *ptr;
+    int mtag, size;
+    
+    memset(stats, 0, sizeof(*stats));
+    tab[JS_MTAG_FREE] = &stats->free_blocks;
+    tab[JS_MTAG_OBJECT] = &stats->objects;
+    tab[JS_MTAG_FLOAT64] = &stats->float64;
+    tab[JS_MTAG_STRING] = &stats->strings;
+    tab[JS_MTAG_FUNCTION_BYTECODE] = &stats->function_bytecode;
+    tab[JS_MTAG_VALUE_ARRAY] = &stats->value_arrays;
+    tab[JS_MTAG_BYTE_ARRAY] = &stats->byte_arrays;
+    tab[JS_MTAG_VARREF] = &stats->var_refs;
+    ptr = ctx->heap_base;
+    while (ptr < ctx->heap_free) {
+        mtag = js_get_mtag(ptr);
+        size = get_mblock_size(ptr);
+        tab[mtag]->count++;
+        tab[mtag]->size += size;
+        ptr += size;
+    }
+    
+    stats->mem_size = ctx->stack_top - ctx->heap_base;
+    stats->heap_size = ctx->heap_free - ctx->heap_base;
+    stats->stack_size = ctx->stack_top - (uint8_t *)ctx->sp;
+    stats->heap_size_max = max_uint32(ctx->heap_size_max, stats->heap_size);
+    stats->stack_size_max = ctx->stack_size_max;
+    stats->free_size_min = ctx->free_size_min;
+    stats->gc = ctx->gc_stats;
+}
+
+void JS_ResetMemoryStats(JSContext *ctx)
+{
+    ctx->heap_size_max = ctx->heap_free - ctx->heap_base;
+    ctx->stack_size_max = ctx->stack_top - (uint8_t *)ctx->stack_bottom;
+    ctx->free_size_min = (uint8_t *)ctx->stack_bottom - ctx->heap_free;
+    memset(&ctx->gc_stats, 0, sizeof(ctx->gc_stats));
+}
+
 void JS_DumpValueF(JSContext *ctx, const char *str,
                    JSValue val, int flags)
 {
@@ -7266,6 +9050,9 @@ typedef struct JSParseState {
        assignment. */
     BOOL is_repl : 8;
     BOOL has_column : 8; /* column debug info is present */
+    /* if true, the nested functions are only scanned and compiled at
+       their first call (JS_EVAL_LAZY) */
+    BOOL is_lazy : 8;
     /* TRUE if the expression result has been dropped (see PF_DROP) */
     BOOL dropped_result : 8;
     JSValue source_str; /* source string or JS_NULL */
@@ -7480,6 +9267,7 @@ static __maybe_unused void dump_byte_code(JSContext *ctx, JSFunctionBytecode *b)
             }
             break;
         case OP_FMT_none_loc:
+            /* also works for the superinstructions */
             idx = (op - OP_get_loc0) % 4;
             goto has_loc;
         case OP_FMT_loc8:
@@ -8382,6 +10170,7 @@ static void pc2line_put_bits_short(JSParseState *s, int n, uint32_t bits)
         js_parse_error_mem(s);
     b = JS_VALUE_TO_PTR(s->cur_func);
     b->pc2line = val1;
+    js_write_barrier(s->ctx, b, val1);
 
     arr = JS_VALUE_TO_PTR(val1);
     p = arr->buf + pos;
@@ -8724,8 +10513,10 @@ static int cpool_add(JSParseState *s, JSValue val)
         js_parse_error_mem(s);
     b = JS_VALUE_TO_PTR(s->cur_func);
     b->cpool = new_cpool;
+    js_write_barrier(s->ctx, b, new_cpool);
     arr = JS_VALUE_TO_PTR(b->cpool);
     arr->arr[s->cpool_len++] = val;
+    js_write_barrier(s->ctx, arr, val);
     return s->cpool_len - 1;
 }
 
@@ -8834,8 +10625,10 @@ static int add_func_ext_var(JSParseState *s, JSValue func, JSValue name, int dec
         js_parse_error_mem(s);
     b = JS_VALUE_TO_PTR(func);
     b->ext_vars = new_ext_vars;
+    js_write_barrier(s->ctx, b, new_ext_vars);
     arr = JS_VALUE_TO_PTR(b->ext_vars);
     arr->arr[2 * b->ext_vars_len] = name;
+    js_write_barrier(s->ctx, arr, name);
     arr->arr[2 * b->ext_vars_len + 1] = JS_NewShortInt(decl);
     b->ext_vars_len++;
     return b->ext_vars_len - 1;
@@ -8865,8 +10658,10 @@ static int add_var(JSParseState *s, JSValue name)
         js_parse_error_mem(s);
     b = JS_VALUE_TO_PTR(s->cur_func);
     b->vars = new_vars;
+    js_write_barrier(s->ctx, b, new_vars);
     arr = JS_VALUE_TO_PTR(b->vars);
     arr->arr[s->local_vars_len++] = name;
+    js_write_barrier(s->ctx, arr, name);
     return s->local_vars_len - 1;
 }
 
@@ -9343,6 +11138,7 @@ static int js_parse_postfix_expr(JSParseState *s, int state, int parse_flags)
             /* save the current bytecode back to the function */
             b = JS_VALUE_TO_PTR(s->cur_func);
             b->byte_code = s->byte_code;
+            js_write_barrier(s->ctx, b, s->byte_code);
             saved_byte_code_len = s->byte_code_len;
             
             /* modify the parser to parse the regexp. This way we
@@ -9420,9 +11216,12 @@ static int js_parse_postfix_expr(JSParseState *s, int state, int parse_flags)
             JSValue name;
             int prop_idx, prop_type, count_pos;
             BOOL has_proto;
+            JSSourcePos source_pos;
             
+            /* the position is used to find the allocation site */
+            source_pos = s->token.source_pos;
             next_token(s);
-            emit_op(s, OP_object);
+            emit_op_pos(s, OP_object, source_pos);
             count_pos = s->byte_code_len;
             emit_u16(s, 0);
 
@@ -9474,13 +11273,17 @@ static int js_parse_postfix_expr(JSParseState *s, int state, int parse_flags)
     case '[':
         {
             uint32_t idx;
+            JSSourcePos source_pos;
             
+            /* the position is used to find the allocation site */
+            source_pos = s->token.source_pos;
             next_token(s);
             /* small regular arrays are created on the stack */
             idx = 0;
             while (s->token.val != ']' && idx < 32) {
                 /* SPEC: we don't accept empty elements */
-                PARSE_CALL_SAVE2(s, 2, js_parse_assign_expr, 0, idx, parse_flags);
+                PARSE_CALL_SAVE3(s, 2, js_parse_assign_expr, 0, idx, parse_flags,
+                                 source_pos);
                 idx++;
                 /* accept trailing comma */
                 if (s->token.val == ',') {
@@ -9490,7 +11293,7 @@ static int js_parse_postfix_expr(JSParseState *s, int state, int parse_flags)
                 }
             }
             
-            emit_op_param(s, OP_array_from, idx, s->pc2line_source_pos);
+            emit_op_param(s, OP_array_from, idx, source_pos);
             
             while (s->token.val != ']') {
                 if (idx >= JS_SHORTINT_MAX)
@@ -10977,8 +12780,9 @@ static void js_parse_function_decl(JSParseState *s,
     
     idx = cpool_add(s, bfunc_ref.val);
     if (is_expr) {
-        /* create the function object */
-        emit_op(s, OP_fclosure);
+        /* create the function object (the position is used to find
+           the allocation site) */
+        emit_op_pos(s, OP_fclosure, b->source_pos);
         emit_u16(s, idx);
     } else {
         idx = define_var(s, &var_kind, func_name_ref.val);
@@ -11130,6 +12934,7 @@ static void js_parse_function(JSParseState *s)
     /* save the bytecode to the function */
     b = JS_VALUE_TO_PTR(s->cur_func);
     b->byte_code = s->byte_code;
+    js_write_barrier(s->ctx, b, s->byte_code);
 }
 
 static void js_parse_program(JSParseState *s)
@@ -11159,6 +12964,7 @@ static void js_parse_program(JSParseState *s)
     /* save the bytecode to the function */
     b = JS_VALUE_TO_PTR(s->cur_func);
     b->byte_code = s->byte_code;
+    js_write_barrier(s->ctx, b, s->byte_code);
 }
 
 #define CVT_VAR_SIZE_MAX 16
@@ -11278,18 +13084,77 @@ static void compute_stack_size_push(JSParseState *s,
     }
 }
 
-static void compute_stack_size(JSParseState *s, JSValue *pfunc)
+/* Superinstructions: the first opcode of some frequent sequences is
+   replaced by an opcode executing the whole sequence. The next
+   opcodes of the sequence are left unchanged, so the jumps to them,
+   the pc2line information and the other bytecode walkers are not
+   modified. No allocation is done. */
+static void fuse_superinstructions(JSFunctionBytecode *b)
 {
-    JSContext *ctx = s->ctx;
-    JSByteArray *explore_arr, *arr;
-    JSFunctionBytecode *b;
-    uint8_t *explore_tab;
-    JSValue *stack_top, explore_arr_val;
-    uint32_t pos;
-    int op, op_len, pos1, n_pop, stack_len;
-    const JSOpCode *oi;
-    JSGCRef explore_arr_val_ref;
-    
+    JSByteArray *arr;
+    uint8_t *tab;
+    int pos, len, op, next_pos, next_op;
+
+    arr = JS_VALUE_TO_PTR(b->byte_code);
+    tab = arr->buf;
+    len = arr->size;
+    for(pos = 0; pos < len; pos = next_pos) {
+        op = tab[pos];
+        next_pos = pos + opcode_info[op].size;
+        if (next_pos >= len)
+            break;
+        next_op = tab[next_pos];
+        switch(op) {
+        case OP_get_loc0:
+        case OP_get_loc1:
+        case OP_get_loc2:
+        case OP_get_loc3:
+            if (next_op == OP_get_field) {
+                tab[pos] = OP_get_loc0_get_field + (op - OP_get_loc0);
+            } else if (next_op == OP_inc && next_pos + 1 < len &&
+                       tab[next_pos + 1] == OP_put_loc0 + (op - OP_get_loc0)) {
+                tab[pos] = OP_inc_loc0 + (op - OP_get_loc0);
+            }
+            break;
+        case OP_get_loc8:
+            if (next_op == OP_inc && next_pos + 2 < len &&
+                tab[next_pos + 1] == OP_put_loc8 &&
+                tab[next_pos + 2] == tab[pos + 1]) {
+                tab[pos] = OP_inc_loc8;
+            }
+            break;
+        case OP_get_arg0:
+        case OP_get_arg1:
+        case OP_get_arg2:
+        case OP_get_arg3:
+            if (next_op == OP_get_field)
+                tab[pos] = OP_get_arg0_get_field + (op - OP_get_arg0);
+            break;
+        case OP_lt:
+        case OP_lte:
+        case OP_gt:
+        case OP_gte:
+            if (next_op == OP_if_false)
+                tab[pos] = OP_lt_if_false + (op - OP_lt);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void compute_stack_size(JSParseState *s, JSValue *pfunc)
+{
+    JSContext *ctx = s->ctx;
+    JSByteArray *explore_arr, *arr;
+    JSFunctionBytecode *b;
+    uint8_t *explore_tab;
+    JSValue *stack_top, explore_arr_val;
+    uint32_t pos;
+    int op, op_len, pos1, n_pop, stack_len;
+    const JSOpCode *oi;
+    JSGCRef explore_arr_val_ref;
+    
     b = JS_VALUE_TO_PTR(*pfunc);
     arr = JS_VALUE_TO_PTR(b->byte_code);
 
@@ -11439,6 +13304,313 @@ static void reset_parse_state(JSParseState *s, uint32_t input_pos,
     s->eval_ret_idx = -1;
 }
 
+/* Lazy compilation (JS_EVAL_LAZY): the body of a nested function is
+   only scanned to find the variables it references from the
+   enclosing functions, so that its closures can be created. It is
+   compiled at its first call by js_compile_lazy_function(). The scan
+   is conservative: a local variable which is not recognized as such
+   only costs an unused variable reference.
+
+   During the scan, the ext_vars of each function scope contain
+   (name, 1) for the local variables and (name, 0) for the other
+   referenced names. The scopes are stacked on the JS stack. */
+
+#define SCAN_VAR_LEVEL    0 /* level of the enclosing 'var' statement */
+#define SCAN_BODY_LEVEL   1 /* nesting level of the function body */
+#define SCAN_FUNC         2 /* function of the scope */
+#define SCAN_ENTRY_SIZE   3
+
+static void scan_add_name(JSParseState *s, JSValue func, JSValue name,
+                          BOOL is_local)
+{
+    JSFunctionBytecode *b;
+    JSValueArray *arr;
+    int idx;
+
+    idx = find_func_ext_var(s, func, name);
+    if (idx < 0) {
+        add_func_ext_var(s, func, name, is_local);
+    } else if (is_local) {
+        b = JS_VALUE_TO_PTR(func);
+        arr = JS_VALUE_TO_PTR(b->ext_vars);
+        arr->arr[2 * idx + 1] = JS_NewShortInt(1);
+    }
+}
+
+/* push the scope of a function whose parameter list starts at the
+   current token. 'func' is JS_NULL for a nested function. Return the
+   number of parameters. The current token is then the '{' of the
+   body. */
+static int scan_push_scope(JSParseState *s, JSValue func, int level,
+                           int var_level)
+{
+    JSContext *ctx = s->ctx;
+    JSFunctionBytecode *b;
+    JSGCRef func_ref;
+    int arg_count, err;
+
+    JS_PUSH_VALUE(ctx, func);
+    err = JS_StackCheck(ctx, SCAN_ENTRY_SIZE);
+    JS_POP_VALUE(ctx, func);
+    if (err)
+        js_parse_error_stack_overflow(s);
+    if (func == JS_NULL) {
+        b = js_alloc_function_bytecode(ctx);
+        if (!b)
+            js_parse_error_mem(s);
+        func = JS_VALUE_FROM_PTR(b);
+    }
+    ctx->sp -= SCAN_ENTRY_SIZE;
+    ctx->sp[SCAN_VAR_LEVEL] = JS_NewShortInt(var_level);
+    ctx->sp[SCAN_BODY_LEVEL] = JS_NewShortInt(level + 1);
+    ctx->sp[SCAN_FUNC] = func;
+
+    js_parse_expect(s, '(');
+    arg_count = 0;
+    while (s->token.val != ')') {
+        if (s->token.val != TOK_IDENT)
+            js_parse_error(s, "missing formal parameter");
+        scan_add_name(s, ctx->sp[SCAN_FUNC], s->token.value, TRUE);
+        arg_count++;
+        next_token(s);
+        if (s->token.val == ')')
+            break;
+        js_parse_expect(s, ',');
+    }
+    next_token(s);
+    js_parse_expect1(s, '{');
+    return arg_count;
+}
+
+/* the names referenced but not defined by a nested function are
+   referenced by the enclosing one */
+static void scan_pop_scope(JSParseState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSFunctionBytecode *b;
+    JSValueArray *arr;
+    int i, len;
+
+    b = JS_VALUE_TO_PTR(ctx->sp[SCAN_FUNC]);
+    len = b->ext_vars_len;
+    for(i = 0; i < len; i++) {
+        b = JS_VALUE_TO_PTR(ctx->sp[SCAN_FUNC]);
+        arr = JS_VALUE_TO_PTR(b->ext_vars);
+        if (arr->arr[2 * i + 1] == JS_NewShortInt(0)) {
+            scan_add_name(s, ctx->sp[SCAN_ENTRY_SIZE + SCAN_FUNC],
+                          arr->arr[2 * i], FALSE);
+        }
+    }
+    ctx->sp += SCAN_ENTRY_SIZE;
+}
+
+/* return the token after the current one without consuming it */
+static int scan_peek_token(JSParseState *s)
+{
+    JSParsePos pos;
+    BOOL got_lf;
+    int tok;
+
+    got_lf = s->got_lf;
+    js_parse_get_pos(s, &pos);
+    next_token(s);
+    tok = s->token.val;
+    js_parse_seek_token(s, &pos);
+    s->got_lf = got_lf;
+    return tok;
+}
+
+/* return TRUE if the current token is the name of a method 'name(...) {'
+   in an object literal */
+static BOOL scan_is_method(JSParseState *s)
+{
+    JSParsePos pos;
+    BOOL got_lf, ret;
+
+    got_lf = s->got_lf;
+    js_parse_get_pos(s, &pos);
+    next_token(s);
+    js_skip_parens(s, NULL);
+    ret = (s->token.val == '{' && !s->got_lf);
+    js_parse_seek_token(s, &pos);
+    s->got_lf = got_lf;
+    return ret;
+}
+
+static BOOL scan_is_name_token(int tok)
+{
+    return (tok == TOK_IDENT || tok == TOK_STRING || tok == TOK_NUMBER ||
+            tok >= TOK_FIRST_KEYWORD);
+}
+
+/* scan the function s->cur_func whose parameter list is at the current
+   position. Its ext_vars are set to the names it references from the
+   enclosing functions. */
+static void js_scan_function(JSParseState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSFunctionBytecode *b;
+    JSValueArray *arr;
+    JSValue *stack_top, *pname;
+    int level, var_level, case_level, tok, prev, prev2, i, j;
+    BOOL is_decl;
+
+    if (JS_StackCheck(ctx, 1))
+        js_parse_error_stack_overflow(s);
+    stack_top = ctx->sp;
+    pname = --ctx->sp;
+    *pname = JS_NULL;
+
+    next_token(s);
+    level = 0;
+    i = scan_push_scope(s, s->cur_func, level, -1);
+    b = JS_VALUE_TO_PTR(s->cur_func);
+    b->arg_count = i;
+    if (b->has_local_func_name)
+        scan_add_name(s, s->cur_func, b->func_name, TRUE);
+
+    var_level = -1;
+    case_level = -1;
+    prev = ')';
+    prev2 = 0;
+    for(;;) {
+        tok = s->token.val;
+        if (prev == '.')
+            goto prop_name;
+        /* end of a 'var' statement by automatic semicolon insertion */
+        if (var_level >= 0 && s->got_lf && scan_is_name_token(tok) &&
+            (!is_regexp_allowed(prev) || prev == '}'))
+            var_level = -1;
+        if (scan_is_name_token(tok) && case_level < 0 &&
+            !(tok == TOK_IDENT && var_level == level && prev == ',') &&
+            (prev == 0 || prev == ';' || prev == '{' || prev == '}' ||
+             prev == ',')) {
+            int next_tok = scan_peek_token(s);
+            if (next_tok == ':')
+                goto prop_name; /* or label */
+            if (prev == '{' || prev == ',') {
+                if (next_tok == '(' &&
+                    (tok == TOK_IDENT || tok == TOK_STRING || tok == TOK_NUMBER) &&
+                    scan_is_method(s)) {
+                    next_token(s);
+                    goto push_scope;
+                }
+                if (tok == TOK_IDENT &&
+                    (s->token.value == js_get_atom(ctx, JS_ATOM_get) ||
+                     s->token.value == js_get_atom(ctx, JS_ATOM_set)) &&
+                    scan_is_name_token(next_tok)) {
+                    /* getter or setter */
+                    next_token(s);
+                    next_token(s);
+                    goto push_scope;
+                }
+            }
+        }
+        switch(tok) {
+        case '(':
+        case '[':
+        case '{':
+            level++;
+            break;
+        case '}':
+            if (level == JS_VALUE_GET_INT(ctx->sp[SCAN_BODY_LEVEL])) {
+                var_level = JS_VALUE_GET_INT(ctx->sp[SCAN_VAR_LEVEL]);
+                if (ctx->sp + SCAN_ENTRY_SIZE == pname)
+                    goto done;
+                scan_pop_scope(s);
+            }
+            /* fall thru */
+        case ')':
+        case ']':
+            level--;
+            if (var_level > level)
+                var_level = -1;
+            break;
+        case TOK_EOF:
+            js_parse_error(s, "expecting '%c'", '}');
+        case ';':
+        case TOK_IN:
+            if (level == var_level)
+                var_level = -1;
+            break;
+        case ':':
+            if (level == case_level)
+                case_level = -1;
+            break;
+        case TOK_VAR:
+            var_level = level;
+            break;
+        case TOK_CASE:
+            case_level = level;
+            break;
+        case TOK_FUNCTION:
+            is_decl = (prev == 0 || prev == ';' || prev == '{' || prev == '}');
+            next_token(s);
+            *pname = JS_NULL;
+            if (s->token.val == TOK_IDENT) {
+                *pname = s->token.value;
+                if (is_decl)
+                    scan_add_name(s, ctx->sp[SCAN_FUNC], *pname, TRUE);
+                next_token(s);
+            }
+            scan_push_scope(s, JS_NULL, level, var_level);
+            /* the name of a function expression is local to it */
+            if (!is_decl && *pname != JS_NULL)
+                scan_add_name(s, ctx->sp[SCAN_FUNC], *pname, TRUE);
+            var_level = -1;
+            case_level = -1;
+            prev2 = prev;
+            prev = ')';
+            continue;
+        push_scope:
+            scan_push_scope(s, JS_NULL, level, var_level);
+            var_level = -1;
+            case_level = -1;
+            prev2 = prev;
+            prev = ')';
+            continue;
+        case TOK_IDENT:
+            if (s->token.value == js_get_atom(ctx, JS_ATOM_arguments))
+                break;
+            if ((var_level == level && (prev == TOK_VAR || prev == ',')) ||
+                (prev == '(' && prev2 == TOK_CATCH)) {
+                is_decl = TRUE;
+            } else if ((prev == TOK_BREAK || prev == TOK_CONTINUE) &&
+                       !s->got_lf) {
+                break; /* label */
+            } else {
+                is_decl = FALSE;
+            }
+            scan_add_name(s, ctx->sp[SCAN_FUNC], s->token.value, is_decl);
+            break;
+        default:
+            break;
+        prop_name:
+            /* a keyword used as property name has no special meaning */
+            tok = TOK_IDENT;
+            break;
+        }
+        prev2 = prev;
+        prev = tok;
+        next_token(s);
+    }
+ done:
+    /* keep the names which are not defined in the function */
+    b = JS_VALUE_TO_PTR(s->cur_func);
+    arr = JS_VALUE_TO_PTR(b->ext_vars);
+    j = 0;
+    for(i = 0; i < b->ext_vars_len; i++) {
+        if (arr->arr[2 * i + 1] == JS_NewShortInt(0)) {
+            arr->arr[2 * j] = arr->arr[2 * i];
+            /* the global type may be patched later */
+            arr->arr[2 * j + 1] = JS_NewShortInt(JS_VARREF_KIND_GLOBAL << 16);
+            j++;
+        }
+    }
+    b->ext_vars_len = j;
+    ctx->sp = stack_top;
+}
+
 static void js_parse_local_functions(JSParseState *s, JSValue *pfunc)
 {
     JSContext *ctx = s->ctx;
@@ -11479,6 +13651,7 @@ static void js_parse_local_functions(JSParseState *s, JSValue *pfunc)
             js_shrink_byte_array(ctx, &b->pc2line, (s->pc2line_bit_len + 7) / 8);
             
             compute_stack_size(s, pfunc);
+            fuse_superinstructions(JS_VALUE_TO_PTR(*pfunc));
         }
 
         b = JS_VALUE_TO_PTR(*pfunc);
@@ -11503,6 +13676,17 @@ static void js_parse_local_functions(JSParseState *s, JSValue *pfunc)
                 s->has_retval = FALSE;
                 
                 JS_PUSH_VALUE(ctx, func);
+                if (s->is_lazy) {
+                    /* only the closure variables are needed now */
+                    js_scan_function(s);
+                    resolve_var_refs(s, &func_ref.val, pfunc);
+                    b1 = JS_VALUE_TO_PTR(func_ref.val);
+                    js_shrink_value_array(ctx, &b1->ext_vars, 2 * b1->ext_vars_len);
+                    b1 = JS_VALUE_TO_PTR(func_ref.val);
+                    b1->cpool = s->source_str;
+                    JS_POP_VALUE(ctx, func);
+                    continue;
+                }
                 js_parse_function(s);
                 
                 /* parse a local function */
@@ -11656,6 +13840,11 @@ static int js_parse_json_value(JSParseState *s, int state, int dummy_param)
         if (*p != '}')
             js_parse_error(s, "expecting '}'");
         p++;
+        /* may trigger a GC */
+        s->buf_pos = p - s->source_buf;
+        if (js_object_share_shape(ctx, *ctx->sp))
+            js_parse_error_mem(s);
+        p = s->source_buf + s->buf_pos;
         PARSE_POP_VAL(s, val);
     } else {
         js_parse_error(s, "unexpected character");
@@ -11688,6 +13877,20 @@ static JSValue JS_Parse2(JSContext *ctx, JSValue source_str,
     JSGCRef top_func_ref, *saved_top_gc_ref;
     uint8_t str_buf[5];
     
+    if ((eval_flags & JS_EVAL_LAZY) && source_str == JS_NULL) {
+        /* the source is kept to compile the functions later */
+        source_str = JS_NewStringLen(ctx, input, input_len);
+        if (JS_IsException(source_str))
+            return JS_EXCEPTION;
+    }
+    if (JS_IsPtr(source_str) &&
+        ((JSString *)JS_VALUE_TO_PTR(source_str))->is_rope) {
+        /* the parser needs a zero terminated string */
+        source_str = js_rope_flatten(ctx, source_str);
+        if (JS_IsException(source_str))
+            return JS_EXCEPTION;
+    }
+
     /* XXX: start gc at the start of parsing ? */
     /* XXX: if the parse state is too large, move it to JSContext */
     s = &parse_state;
@@ -11754,6 +13957,8 @@ static JSValue JS_Parse2(JSContext *ctx, JSValue source_str,
         s->is_eval = TRUE;
         s->has_retval = ((eval_flags & JS_EVAL_RETVAL) != 0);
         s->is_repl = ((eval_flags & JS_EVAL_REPL) != 0);
+        s->is_lazy = ((eval_flags & JS_EVAL_LAZY) != 0 &&
+                      JS_IsPtr(s->source_str));
         
         JS_PUSH_VALUE(ctx, top_func);
         
@@ -11767,78 +13972,250 @@ static JSValue JS_Parse2(JSContext *ctx, JSValue source_str,
     return top_func;
 }
 
-/* warning: it is assumed that input[input_len] = '\0' */
-JSValue JS_Parse(JSContext *ctx, const char *input, size_t input_len,
-                 const char *filename, int eval_flags)
+/* return the index of the variable 'name' in the ext_vars 'val' or -1 */
+static int find_ext_vars_name(JSValue val, JSValue name)
 {
-    return JS_Parse2(ctx, JS_NULL, input, input_len, filename, eval_flags);
-}
+    JSValueArray *arr;
+    int i;
 
-JSValue JS_Run(JSContext *ctx, JSValue val)
-{
-    JSFunctionBytecode *b;
-    JSGCRef val_ref;
-    int err;
-    
-    if (!JS_IsPtr(val))
-        goto fail;
-    b = JS_VALUE_TO_PTR(val);
-    if (b->mtag != JS_MTAG_FUNCTION_BYTECODE) {
-    fail:
-        return JS_ThrowTypeError(ctx, "bytecode function expected");
+    if (val == JS_NULL)
+        return -1;
+    arr = JS_VALUE_TO_PTR(val);
+    for(i = 0; i < arr->size; i += 2) {
+        if (arr->arr[i] == name)
+            return i / 2;
     }
-
-    val = js_closure(ctx, val, NULL);
-    if (JS_IsException(val))
-        return val;
-    JS_PUSH_VALUE(ctx, val);
-    err = JS_StackCheck(ctx, 2);
-    JS_POP_VALUE(ctx, val);
-    if (err)
-        return JS_EXCEPTION;
-    JS_PushArg(ctx, val);
-    JS_PushArg(ctx, JS_NULL);
-    val = JS_Call(ctx, 0);
-    return val;
+    return -1;
 }
 
-/* warning: it is assumed that input[input_len] = '\0' */
-JSValue JS_Eval(JSContext *ctx, const char *input, size_t input_len,
-                const char *filename, int eval_flags)
+/* The closures of a lazily compiled function were created with the
+   closure variables found by js_scan_function(). Renumber the
+   references of the compiled code so that they match. No
+   allocation. */
+static void remap_lazy_ext_vars(JSParseState *s, JSValue func,
+                                JSValue scan_ext_vars)
 {
+    JSFunctionBytecode *b, *b1;
+    JSValueArray *ext_vars, *cpool, *arr;
+    JSByteArray *bc_arr;
     JSValue val;
-    val = JS_Parse(ctx, input, input_len, filename, eval_flags);
-    if (JS_IsException(val))
-        return val;
-    return JS_Run(ctx, val);
-}
-
-/**********************************************************************/
-/* garbage collector */
+    int i, idx, pos, op, decl;
 
-/* return the size in bytes */
-static int get_mblock_size(const void *ptr)
-{
-    int mtag = ((JSMemBlockHeader *)ptr)->mtag;
-    int size;
-    switch(mtag) {
-    case JS_MTAG_OBJECT:
-        {
-            const JSObject *p = ptr;
-            size = offsetof(JSObject, u) + p->extra_size * JSW;
+    b = JS_VALUE_TO_PTR(func);
+    for(i = 0; i < b->ext_vars_len; i++) {
+        ext_vars = JS_VALUE_TO_PTR(b->ext_vars);
+        if (find_ext_vars_name(scan_ext_vars, ext_vars->arr[2 * i]) < 0) {
+            js_parse_error(s, "variable '%"JSValue_PRI"' not found by the lazy compilation",
+                           ext_vars->arr[2 * i]);
         }
-        break;
-    case JS_MTAG_FLOAT64:
-        size = sizeof(JSFloat64);
-        break;
-    case JS_MTAG_STRING:
-        {
-            const JSString *p = ptr;
-            size = sizeof(JSString) + ((p->len + JSW) & ~(JSW - 1));
+    }
+
+    bc_arr = JS_VALUE_TO_PTR(b->byte_code);
+    for(pos = 0; pos < bc_arr->size; pos += opcode_info[op].size) {
+        op = bc_arr->buf[pos];
+        if (opcode_info[op].fmt == OP_FMT_var_ref) {
+            ext_vars = JS_VALUE_TO_PTR(b->ext_vars);
+            idx = get_u16(bc_arr->buf + pos + 1);
+            idx = find_ext_vars_name(scan_ext_vars, ext_vars->arr[2 * idx]);
+            put_u16(bc_arr->buf + pos + 1, idx);
         }
-        break;
-    case JS_MTAG_BYTE_ARRAY:
-        {
+    }
+
+    /* the nested functions reference the closure variables by index */
+    if (b->cpool != JS_NULL) {
+        cpool = JS_VALUE_TO_PTR(b->cpool);
+        for(i = 0; i < cpool->size; i++) {
+            val = cpool->arr[i];
+            if (!JS_IsPtr(val))
+                continue;
+            b1 = JS_VALUE_TO_PTR(val);
+            if (b1->mtag != JS_MTAG_FUNCTION_BYTECODE || b1->ext_vars == JS_NULL)
+                continue;
+            arr = JS_VALUE_TO_PTR(b1->ext_vars);
+            for(idx = 0; idx < arr->size; idx += 2) {
+                decl = JS_VALUE_GET_INT(arr->arr[idx + 1]);
+                if ((decl >> 16) == JS_VARREF_KIND_VAR_REF) {
+                    ext_vars = JS_VALUE_TO_PTR(b->ext_vars);
+                    decl = find_ext_vars_name(scan_ext_vars,
+                                              ext_vars->arr[2 * (decl & 0xffff)]);
+                    arr->arr[idx + 1] = JS_NewShortInt((JS_VARREF_KIND_VAR_REF << 16) | decl);
+                }
+            }
+        }
+    }
+
+    b->ext_vars = scan_ext_vars;
+    js_write_barrier(s->ctx, b, scan_ext_vars);
+    b->ext_vars_len = (scan_ext_vars == JS_NULL) ? 0 :
+        ((JSValueArray *)JS_VALUE_TO_PTR(scan_ext_vars))->size / 2;
+}
+
+/* compile a function parsed with JS_EVAL_LAZY. Return 0 if OK, -1 if
+   exception. */
+static int js_compile_lazy_function(JSContext *ctx, JSValue bfunc)
+{
+    JSParseState parse_state, *s;
+    JSFunctionBytecode *b;
+    JSString *p;
+    JSValue *saved_sp, source_str, scan_ext_vars;
+    JSGCRef bfunc_ref, source_str_ref, scan_ext_vars_ref, *saved_top_gc_ref;
+    int ret;
+
+    b = JS_VALUE_TO_PTR(bfunc);
+    if (JS_IS_ROM_PTR(ctx, b)) {
+        JS_ThrowTypeError(ctx, "cannot compile a function outside of the heap");
+        return -1;
+    }
+    /* the interpreter may be above the stack bottom set by the last
+       C function call */
+    JS_PUSH_VALUE(ctx, bfunc);
+    ret = JS_StackCheck(ctx, 0);
+    JS_POP_VALUE(ctx, bfunc);
+    if (ret)
+        return -1;
+    b = JS_VALUE_TO_PTR(bfunc);
+    source_str = b->cpool;
+    scan_ext_vars = b->ext_vars;
+    JS_PUSH_VALUE(ctx, bfunc);
+    JS_PUSH_VALUE(ctx, source_str);
+    JS_PUSH_VALUE(ctx, scan_ext_vars);
+
+    s = &parse_state;
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    ctx->parse_state = s;
+    p = JS_VALUE_TO_PTR(source_str);
+    s->source_str = source_str;
+    s->buf_len = p->len;
+    s->source_buf = p->buf;
+    s->filename_str = b->filename;
+    s->has_column = b->has_column;
+    s->is_lazy = TRUE;
+    s->top_break = JS_NULL;
+    saved_top_gc_ref = ctx->top_gc_ref;
+    saved_sp = ctx->sp;
+
+    if (setjmp(s->jmp_env)) {
+        JSCStringBuf buf;
+        const char *filename;
+        int line_num, col_num;
+
+        ctx->parse_state = NULL;
+        ctx->top_gc_ref = saved_top_gc_ref;
+        ctx->sp = saved_sp;
+        ctx->stack_bottom = ctx->sp;
+
+        /* the function stays uncompiled */
+        b = JS_VALUE_TO_PTR(bfunc_ref.val);
+        b->byte_code = JS_NULL;
+        b->cpool = source_str_ref.val;
+        b->vars = JS_NULL;
+        b->ext_vars = scan_ext_vars_ref.val;
+        js_write_barrier(ctx, b, b->cpool);
+        js_write_barrier(ctx, b, b->ext_vars);
+        b->pc2line = JS_NULL;
+        b->stack_size = 0;
+
+        line_num = get_line_col(&col_num, s->source_buf, s->token.source_pos);
+        JS_ThrowError(ctx, JS_CLASS_SYNTAX_ERROR, "%s", s->error_msg);
+        b = JS_VALUE_TO_PTR(bfunc_ref.val);
+        filename = JS_ToCString(ctx, b->filename, &buf);
+        build_backtrace(ctx, ctx->current_exception, filename, line_num + 1, col_num + 1, 0);
+        ret = -1;
+        goto done;
+    }
+
+    b->cpool = JS_NULL;
+    b->ext_vars = JS_NULL;
+    b->ext_vars_len = 0;
+    reset_parse_state(s, b->source_pos, bfunc);
+    js_parse_function(s);
+    js_parse_local_functions(s, &bfunc_ref.val);
+    remap_lazy_ext_vars(s, bfunc_ref.val, scan_ext_vars_ref.val);
+    ctx->parse_state = NULL;
+    ret = 0;
+ done:
+    JS_POP_VALUE(ctx, scan_ext_vars);
+    JS_POP_VALUE(ctx, source_str);
+    JS_POP_VALUE(ctx, bfunc);
+    return ret;
+}
+
+/* warning: it is assumed that input[input_len] = '\0' */
+JSValue JS_Parse(JSContext *ctx, const char *input, size_t input_len,
+                 const char *filename, int eval_flags)
+{
+    return JS_Parse2(ctx, JS_NULL, input, input_len, filename, eval_flags);
+}
+
+JSValue JS_Run(JSContext *ctx, JSValue val)
+{
+    JSFunctionBytecode *b;
+    JSGCRef val_ref;
+    int err;
+    
+    if (!JS_IsPtr(val))
+        goto fail;
+    b = JS_VALUE_TO_PTR(val);
+    if (b->mtag != JS_MTAG_FUNCTION_BYTECODE) {
+    fail:
+        return JS_ThrowTypeError(ctx, "bytecode function expected");
+    }
+
+    val = js_closure(ctx, val, NULL);
+    if (JS_IsException(val))
+        return val;
+    JS_PUSH_VALUE(ctx, val);
+    err = JS_StackCheck(ctx, 2);
+    JS_POP_VALUE(ctx, val);
+    if (err)
+        return JS_EXCEPTION;
+    JS_PushArg(ctx, val);
+    JS_PushArg(ctx, JS_NULL);
+    val = JS_Call(ctx, 0);
+    return val;
+}
+
+/* warning: it is assumed that input[input_len] = '\0' */
+JSValue JS_Eval(JSContext *ctx, const char *input, size_t input_len,
+                const char *filename, int eval_flags)
+{
+    JSValue val;
+    val = JS_Parse(ctx, input, input_len, filename, eval_flags);
+    if (JS_IsException(val))
+        return val;
+    return JS_Run(ctx, val);
+}
+
+/**********************************************************************/
+/* garbage collector */
+
+/* return the size in bytes */
+static int get_mblock_size(const void *ptr)
+{
+    int mtag = ((JSMemBlockHeader *)ptr)->mtag;
+    int size;
+    switch(mtag) {
+    case JS_MTAG_OBJECT:
+        {
+            const JSObject *p = ptr;
+            size = offsetof(JSObject, u) + p->extra_size * JSW;
+        }
+        break;
+    case JS_MTAG_FLOAT64:
+        size = sizeof(JSFloat64);
+        break;
+    case JS_MTAG_STRING:
+        {
+            const JSString *p = ptr;
+            if (p->is_rope)
+                size = sizeof(JSString) + sizeof(JSValue);
+            else
+                size = sizeof(JSString) + ((p->len + JSW) & ~(JSW - 1));
+        }
+        break;
+    case JS_MTAG_BYTE_ARRAY:
+        {
             const JSByteArray *p = ptr;
             size = sizeof(JSByteArray) + ((p->size + JSW - 1) & ~(JSW - 1));
         }
@@ -11918,6 +14295,175 @@ JSValue JS_GetRomAtomEntry(const void* table, int index)
     return arr->arr[index];
 }
 
+#ifdef CONFIG_HEAP_PROFILE
+/* heap profiler: allocation site recording */
+
+static uint32_t js_heap_profile_hash(JSValue func_bytecode, int pc)
+{
+    uint32_t h;
+    h = (uint32_t)func_bytecode * 0x9e3779b1 + pc * 31;
+    return (h ^ (h >> 16)) & (JS_HEAP_PROFILE_HASH_SIZE - 1);
+}
+
+/* must be called after the function bytecodes are moved */
+static void js_heap_profile_rehash(JSContext *ctx)
+{
+    JSHeapProfile *hp = ctx->heap_profile;
+    JSHeapProfileSite *hs;
+    uint32_t h;
+    int i;
+
+    memset(hp->hash, 0, sizeof(hp->hash));
+    for(i = 1; i < hp->sites_len; i++) {
+        hs = &hp->sites[i];
+        h = js_heap_profile_hash(hs->func_bytecode, hs->pc);
+        while (hp->hash[h] != 0)
+            h = (h + 1) & (JS_HEAP_PROFILE_HASH_SIZE - 1);
+        hp->hash[h] = i + 1;
+    }
+}
+
+/* the site is the current pc of the innermost JS function */
+static int js_heap_profile_get_site(JSContext *ctx)
+{
+    JSHeapProfile *hp = ctx->heap_profile;
+    JSHeapProfileSite *hs;
+    JSValue *fp, func_bytecode;
+    JSObject *p;
+    uint32_t h;
+    int pc, i;
+
+    func_bytecode = JS_NULL;
+    pc = 0;
+    for(fp = ctx->fp; fp != (JSValue *)ctx->stack_top;
+        fp = VALUE_TO_SP(ctx, fp[FRAME_OFFSET_SAVED_FP])) {
+        if (!JS_IsPtr(fp[FRAME_OFFSET_FUNC_OBJ]))
+            continue;
+        p = JS_VALUE_TO_PTR(fp[FRAME_OFFSET_FUNC_OBJ]);
+        if (p->mtag == JS_MTAG_OBJECT && p->class_id == JS_CLASS_CLOSURE) {
+            func_bytecode = p->u.closure.func_bytecode;
+            pc = max_int(JS_VALUE_GET_INT(fp[FRAME_OFFSET_CUR_PC]) - 1, 0);
+            break;
+        }
+    }
+
+    h = js_heap_profile_hash(func_bytecode, pc);
+    while ((i = hp->hash[h]) != 0) {
+        hs = &hp->sites[i - 1];
+        if (hs->func_bytecode == func_bytecode && hs->pc == pc)
+            return i - 1;
+        h = (h + 1) & (JS_HEAP_PROFILE_HASH_SIZE - 1);
+    }
+    if (hp->sites_len >= JS_HEAP_PROFILE_SITES)
+        return 0;
+    i = hp->sites_len++;
+    hs = &hp->sites[i];
+    hs->func_bytecode = func_bytecode;
+    hs->pc = pc;
+    hp->hash[h] = i + 1;
+    return i;
+}
+
+/* called by js_malloc() for each new block */
+static void js_heap_profile_record(JSContext *ctx, void *ptr)
+{
+    JSHeapProfile *hp = ctx->heap_profile;
+    JSHeapProfileRecord *r;
+    uint32_t offset;
+
+    offset = (uint8_t *)ptr - ctx->heap_base;
+    /* remove the records of the blocks released by js_free() */
+    while (hp->records_len > 0 &&
+           hp->records[hp->records_len - 1].offset >= offset)
+        hp->records_len--;
+    if (hp->records_len >= hp->records_size) {
+        hp->records_lost++;
+        return;
+    }
+    r = &hp->records[hp->records_len++];
+    r->offset = offset;
+    r->site = js_heap_profile_get_site(ctx);
+}
+
+typedef struct {
+    uint32_t pos; /* next record to examine */
+    uint32_t len; /* number of records kept */
+} JSHeapProfileCompactState;
+
+static void js_heap_profile_compact_start(JSContext *ctx,
+                                          JSHeapProfileCompactState *hs)
+{
+    JSHeapProfile *hp = ctx->heap_profile;
+    uint32_t offset, a, b, m;
+
+    /* the blocks below gc_base are not moved */
+    offset = ctx->gc_base - ctx->heap_base;
+    a = 0;
+    b = hp ? hp->records_len : 0;
+    while (a < b) {
+        m = (a + b) >> 1;
+        if (hp->records[m].offset < offset)
+            a = m + 1;
+        else
+            b = m;
+    }
+    hs->pos = a;
+    hs->len = a;
+}
+
+/* 'ptr' is a live block moved to 'new_ptr'. The records of the freed
+   blocks before it are removed. */
+static void js_heap_profile_move(JSContext *ctx, JSHeapProfileCompactState *hs,
+                                 uint8_t *ptr, uint8_t *new_ptr)
+{
+    JSHeapProfile *hp = ctx->heap_profile;
+    uint32_t offset;
+
+    offset = ptr - ctx->heap_base;
+    while (hs->pos < hp->records_len && hp->records[hs->pos].offset < offset)
+        hs->pos++;
+    if (hs->pos < hp->records_len && hp->records[hs->pos].offset == offset) {
+        hp->records[hs->len].offset = new_ptr - ctx->heap_base;
+        hp->records[hs->len].site = hp->records[hs->pos].site;
+        hs->len++;
+        hs->pos++;
+    }
+}
+
+static void js_heap_profile_compact_end(JSContext *ctx,
+                                        JSHeapProfileCompactState *hs)
+{
+    ctx->heap_profile->records_len = hs->len;
+    js_heap_profile_rehash(ctx);
+}
+
+int JS_EnableHeapProfile(JSContext *ctx, void *buf, size_t buf_size)
+{
+    JSHeapProfile *hp;
+
+    if (!buf) {
+        ctx->heap_profile = NULL;
+        return 0;
+    }
+    if (buf_size < sizeof(JSHeapProfile) + 64 * sizeof(JSHeapProfileRecord))
+        return -1;
+    hp = buf;
+    memset(hp, 0, sizeof(*hp));
+    hp->records_size = (buf_size - sizeof(JSHeapProfile)) / sizeof(JSHeapProfileRecord);
+    /* site 0 is used when 'sites' is full */
+    hp->sites[0].func_bytecode = JS_NULL;
+    hp->sites[0].pc = -1;
+    hp->sites_len = 1;
+    ctx->heap_profile = hp;
+    return 0;
+}
+#else
+int JS_EnableHeapProfile(JSContext *ctx, void *buf, size_t buf_size)
+{
+    return -1;
+}
+#endif /* CONFIG_HEAP_PROFILE */
+
 /* gc mark pass */
 
 typedef struct {
@@ -11926,6 +14472,14 @@ typedef struct {
     JSValue *gs_bottom;
     JSValue *gs_top;
     BOOL overflow;
+#ifdef CONFIG_GC_NURSERY
+    int young_refs; /* number of followed references */
+#endif
+#ifdef CONFIG_HEAP_PROFILE
+    /* the references of this block are not followed (see
+       js_heap_profile_retained_size()) */
+    const void *cut_block;
+#endif
 } GCMarkState;
 
 static BOOL mtag_has_references(int mtag)
@@ -11936,6 +14490,13 @@ static BOOL mtag_has_references(int mtag)
             mtag == JS_MTAG_FUNCTION_BYTECODE);
 }
 
+/* true if 'ptr' is in ROM or is not collected by the current GC */
+static inline BOOL gc_is_outside(JSContext *ctx, const void *ptr)
+{
+    return ((uintptr_t)ptr < (uintptr_t)ctx->gc_base ||
+            (uintptr_t)ptr >= (uintptr_t)ctx->stack_top);
+}
+
 static void gc_mark(GCMarkState *s, JSValue val)
 {
     JSContext *ctx = s->ctx;
@@ -11945,13 +14506,19 @@ static void gc_mark(GCMarkState *s, JSValue val)
     if (!JS_IsPtr(val))
         return;
     ptr = JS_VALUE_TO_PTR(val);
-    if (JS_IS_ROM_PTR(ctx, ptr))
+    if (gc_is_outside(ctx, ptr))
         return;
+#ifdef CONFIG_GC_NURSERY
+    s->young_refs++;
+#endif
     mb = ptr;
     if (mb->gc_mark)
         return;
     mb->gc_mark = 1;
-    if (mtag_has_references(mb->mtag)) {
+    if (mb->mtag == JS_MTAG_STRING && ((JSString *)mb)->is_rope) {
+        /* the rope buffer has no references so no recursion */
+        gc_mark(s, *(JSValue *)((JSString *)mb)->buf);
+    } else if (mtag_has_references(mb->mtag)) {
         if (mb->mtag == JS_MTAG_VALUE_ARRAY) {
             /* value array are handled specifically to save stack space */
             if ((s->gsp - s->gs_bottom) < 2) {
@@ -12020,12 +14587,19 @@ static void gc_mark_flush(GCMarkState *s)
                 case JS_CLASS_UINT32_ARRAY:
                 case JS_CLASS_FLOAT32_ARRAY:
                 case JS_CLASS_FLOAT64_ARRAY:
+                case JS_CLASS_DATA_VIEW:
                     gc_mark(s, p->u.typed_array.buffer);
                     break;
                 case JS_CLASS_REGEXP:
                     gc_mark(s, p->u.regexp.source);
                     gc_mark(s, p->u.regexp.byte_code);
                     break;
+                case JS_CLASS_JSON_PARSER:
+                    gc_mark(s, p->u.json_parser.stack);
+                    gc_mark(s, p->u.json_parser.token);
+                    gc_mark(s, p->u.json_parser.callback);
+                    gc_mark(s, p->u.json_parser.result);
+                    break;
                 }
             }
             break;
@@ -12082,21 +14656,87 @@ static void gc_mark_root(GCMarkState *s, JSValue val)
 }
 
 /* return true if the memory block is marked i.e. it won't be freed by the GC */
-static BOOL gc_mb_is_marked(JSValue val)
+static BOOL gc_mb_is_marked(JSContext *ctx, JSValue val)
 {
     JSFreeBlock *b;
     if (!JS_IsPtr(val))
         return FALSE;
     b = (JSFreeBlock *)JS_VALUE_TO_PTR(val);
+    if ((uint8_t *)b < ctx->gc_base && (uint8_t *)b >= ctx->heap_base)
+        return TRUE; /* old block during a minor GC */
     return b->gc_mark;
 }
 
-static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
+#ifdef CONFIG_GC_NURSERY
+/* during a minor GC, the old blocks which may reference young blocks
+   are considered as roots. The ones referencing young blocks are
+   recorded at the bottom of the mark stack area so that
+   gc_compact_heap() only needs to update them. */
+static void gc_mark_old_block(GCMarkState *s, uint8_t *ptr)
 {
-    GCMarkState s_s, *s = &s_s;
+    JSContext *ctx = s->ctx;
+    JSMemBlockHeader *mb = (JSMemBlockHeader *)ptr;
+    JSValue *tab;
+    BOOL is_rope;
+
+    is_rope = (mb->mtag == JS_MTAG_STRING && ((JSString *)mb)->is_rope);
+    /* the unique string table only contains weak references */
+    if (!is_rope &&
+        (!mtag_has_references(mb->mtag) ||
+         JS_VALUE_FROM_PTR(ptr) == ctx->unique_strings))
+        return;
+    s->young_refs = 0;
+    if (is_rope) {
+        /* the rope buffer may be younger than the string (see
+           js_rope_concat()) */
+        gc_mark(s, *(JSValue *)((JSString *)mb)->buf);
+    } else {
+        if (mb->mtag == JS_MTAG_VALUE_ARRAY)
+            *--s->gsp = 0;
+        *--s->gsp = JS_VALUE_FROM_PTR(ptr);
+        gc_mark_flush(s);
+    }
+    if (s->young_refs != 0 && ctx->gc_remembered_len >= 0) {
+        /* keep some space for the mark stack */
+        if ((s->gs_top - s->gs_bottom) < 64) {
+            ctx->gc_remembered_len = -1;
+        } else {
+            tab = (JSValue *)ctx->heap_free;
+            tab[ctx->gc_remembered_len++] = JS_VALUE_FROM_PTR(ptr);
+            s->gs_bottom++;
+        }
+    }
+}
+
+/* only the old blocks of the remembered set are scanned, unless it
+   overflowed */
+static void gc_mark_old_blocks(GCMarkState *s)
+{
+    JSContext *ctx = s->ctx;
+    uint8_t *ptr;
+    int i;
+    
+    ctx->gc_remembered_len = 0;
+    if (ctx->remembered_set_len > JS_REMEMBERED_SET_SIZE) {
+        for(ptr = ctx->heap_base; ptr < ctx->gc_base; ptr += get_mblock_size(ptr))
+            gc_mark_old_block(s, ptr);
+    } else {
+        for(i = 0; i < ctx->remembered_set_len; i++) {
+            ptr = ctx->remembered_set[i];
+            if (ptr < ctx->gc_base)
+                gc_mark_old_block(s, ptr);
+        }
+    }
+}
+#endif
+
+/* mark all the memory blocks reachable from the roots */
+static void gc_mark_roots(GCMarkState *s, BOOL keep_atoms)
+{
+    JSContext *ctx = s->ctx;
     JSValue *sp, *sp_end;
+    JSTempBlock *tb;
 
-    s->ctx = ctx;
     /* initialize the GC stack */
     s->overflow = FALSE;
     s->gs_top = ctx->sp;
@@ -12124,7 +14764,13 @@ static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
         gc_mark_root(s, *sp);
     }
 
+    tb = ctx->temp_blocks;
     for(sp = ctx->sp; sp < (JSValue *)ctx->stack_top; sp++) {
+        if (unlikely((JSValue *)tb == sp)) {
+            sp += tb->len - 1;
+            tb = tb->prev;
+            continue;
+        }
         gc_mark_root(s, *sp);
     }
 
@@ -12147,6 +14793,20 @@ static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
         gc_mark_root(s, ps->byte_code);
     }
 
+#ifdef CONFIG_HEAP_PROFILE
+    if (ctx->heap_profile) {
+        JSHeapProfile *hp = ctx->heap_profile;
+        int i;
+        for(i = 0; i < hp->sites_len; i++)
+            gc_mark_root(s, hp->sites[i].func_bytecode);
+    }
+#endif
+
+#ifdef CONFIG_GC_NURSERY
+    if (ctx->gc_base != ctx->heap_base)
+        gc_mark_old_blocks(s);
+#endif
+
     /* if the mark stack overflowed, need to scan the heap */
     while (s->overflow) {
         uint8_t *ptr;
@@ -12159,7 +14819,14 @@ static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
         while (ptr < ctx->heap_free) {
             size = get_mblock_size(ptr);
             mb = (JSMemBlockHeader *)ptr;
-            if (mb->gc_mark && mtag_has_references(mb->mtag)) {
+            if ((mb->gc_mark ||
+                 (ptr < ctx->gc_base &&
+                  JS_VALUE_FROM_PTR(ptr) != ctx->unique_strings)) &&
+                mtag_has_references(mb->mtag)
+#ifdef CONFIG_HEAP_PROFILE
+                && ptr != s->cut_block
+#endif
+                ) {
                 if (mb->mtag == JS_MTAG_VALUE_ARRAY)
                     *--s->gsp = 0;
                 *--s->gsp = JS_VALUE_FROM_PTR(ptr);
@@ -12168,6 +14835,50 @@ static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
             ptr += size;
         }
     }
+}
+
+/* Called for each live rope string 'p' of 'size' bytes. If 'p' is
+   the only user of its rope buffer and the buffer follows it (see
+   js_rope_concat()), 'p' becomes a flat string and the buffer is
+   freed. Otherwise the free space at the end of the buffer is
+   removed. Return the new size of 'p'. */
+static int gc_trim_rope_buffer(JSContext *ctx, JSString *p, int size)
+{
+    JSByteArray *arr = JS_VALUE_TO_PTR(*(JSValue *)p->buf);
+    JSRopeBuffer *rb = (JSRopeBuffer *)arr->buf;
+    uint32_t new_size, len;
+
+    /* the old blocks are not compacted by a minor GC */
+    if ((uint8_t *)arr < ctx->gc_base)
+        return size;
+    len = p->len;
+    if ((uint8_t *)arr == (uint8_t *)p + size && rb->len == len) {
+        /* the strings sharing a buffer are its extensions, so none
+           remains if 'p' ends it */
+        size += get_mblock_size(arr);
+        memmove(p->buf, rb->buf, len + 1);
+        p->is_rope = FALSE;
+        new_size = sizeof(JSString) + ((len + JSW) & ~(JSW - 1));
+        set_free_block((uint8_t *)p + new_size, size - new_size);
+        return new_size;
+    }
+    new_size = sizeof(JSRopeBuffer) + rb->len + 1;
+    if (new_size < arr->size) {
+        js_shrink(ctx, arr, sizeof(JSByteArray) + new_size);
+        arr->size = new_size;
+    }
+    return size;
+}
+
+static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
+{
+    GCMarkState s_s, *s = &s_s;
+
+    s->ctx = ctx;
+#ifdef CONFIG_HEAP_PROFILE
+    s->cut_block = NULL;
+#endif
+    gc_mark_roots(s, keep_atoms);
 
     /* update the unique string table (its elements are considered as
        weak string references) */
@@ -12175,22 +14886,41 @@ static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
         JSValueArray *arr = JS_VALUE_TO_PTR(ctx->unique_strings);
         int i, j;
 
-        j = 0;
-        for(i = 0; i < arr->size; i++) {
-            if (gc_mb_is_marked(arr->arr[i])) {
-                arr->arr[j++] = arr->arr[i];
+        if (ctx->unique_strings_sorted) {
+            j = 0;
+            for(i = 0; i < arr->size; i++) {
+                if (gc_mb_is_marked(ctx, arr->arr[i])) {
+                    arr->arr[j++] = arr->arr[i];
+                }
             }
-        }
-        ctx->unique_strings_len = j;
-        if (j > 0) {
-            arr->gc_mark = 1;
-            if (j < arr->size) {
+            ctx->unique_strings_len = j;
+            if (j > 0 && j < arr->size) {
                 /* shrink the array */
                 set_free_block(&arr->arr[j], (arr->size - j) * sizeof(JSValue));
                 arr->size = j;
             }
         } else {
-            arr->gc_mark = 0;
+            uint32_t start, mask, k;
+            /* start the scan after an empty slot so that the entries
+               are only moved to slots which are not yet scanned */
+            mask = arr->size - 1;
+            for(start = 0; arr->arr[start] != JS_NULL; start++)
+                continue;
+            for(i = 1; i <= arr->size; i++) {
+                k = (start + i) & mask;
+                while (arr->arr[k] != JS_NULL &&
+                       !gc_mb_is_marked(ctx, arr->arr[k])) {
+                    js_unique_strings_delete(arr, k);
+                    ctx->unique_strings_len--;
+                }
+            }
+        }
+        if (ctx->unique_strings_len > 0) {
+            if ((uint8_t *)arr >= ctx->gc_base)
+                arr->gc_mark = 1;
+        } else {
+            if ((uint8_t *)arr >= ctx->gc_base)
+                arr->gc_mark = 0;
             ctx->unique_strings = JS_NULL;
         }
     }
@@ -12201,10 +14931,39 @@ static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
         JSStringPosCacheEntry *ce;
         for(i = 0; i < JS_STRING_POS_CACHE_SIZE; i++) {
             ce = &ctx->string_pos_cache[i];
-            if (!gc_mb_is_marked(ce->str))
+            if (!gc_mb_is_marked(ctx, ce->str)) {
                 ce->str = JS_NULL;
+                ce->last_use = 0;
+            }
+        }
+    }
+
+#if JS_SHAPE_CACHE_SIZE > 0
+    /* update the weak references in the shape cache */
+    {
+        int i;
+        for(i = 0; i < JS_SHAPE_CACHE_SIZE; i++) {
+            if (!gc_mb_is_marked(ctx, ctx->shape_cache[i]))
+                ctx->shape_cache[i] = JS_NULL;
+        }
+    }
+#endif
+#if JS_REGEXP_CACHE_SIZE > 0
+    /* update the weak references in the regexp cache */
+    {
+        int i;
+        JSRegExpCacheEntry *ce;
+        for(i = 0; i < JS_REGEXP_CACHE_SIZE; i++) {
+            ce = &ctx->regexp_cache[i];
+            if (!gc_mb_is_marked(ctx, ce->source) ||
+                !gc_mb_is_marked(ctx, ce->byte_code)) {
+                ce->source = JS_NULL;
+                ce->byte_code = JS_NULL;
+                ce->last_use = 0;
+            }
         }
     }
+#endif
     
     /* reset the gc marks and mark the free blocks as free */
     {
@@ -12212,18 +14971,23 @@ static void gc_mark_all(JSContext *ctx, BOOL keep_atoms)
         int size;
         JSFreeBlock *b;
 
-        ptr = ctx->heap_base;
+        ptr = ctx->gc_base;
         while (ptr < ctx->heap_free) {
             size = get_mblock_size(ptr);
             b = (JSFreeBlock *)ptr;
             if (b->gc_mark) {
                 b->gc_mark = 0;
+                if (b->mtag == JS_MTAG_STRING && ((JSString *)b)->is_rope)
+                    size = gc_trim_rope_buffer(ctx, (JSString *)b, size);
             } else {
                 JSObject *p = (void *)ptr;
                 /* call the user finalizer if needed */
                 if (p->mtag == JS_MTAG_OBJECT && p->class_id >= JS_CLASS_USER &&
                     ctx->c_finalizer_table[p->class_id - JS_CLASS_USER] != NULL) {
                     ctx->c_finalizer_table[p->class_id - JS_CLASS_USER](ctx, p->u.user.opaque);
+                } else if (p->mtag == JS_MTAG_OBJECT &&
+                           p->class_id == JS_CLASS_ARRAY_BUFFER) {
+                    js_array_buffer_finalizer(ctx, p);
                 }
                 /* merge all the consecutive free blocks */
                 ptr1 = ptr + size;
@@ -12257,7 +15021,7 @@ static void gc_thread_pointer(JSContext *ctx, JSValue *pval)
     if (!JS_IsPtr(val))
         return;
     ptr = JS_VALUE_TO_PTR(val);
-    if (JS_IS_ROM_PTR(ctx, ptr))
+    if (gc_is_outside(ctx, ptr))
         return;
     /* gc_mark = 0 indicates a normal memory block header, gc_mark = 1
        indicates a pointer to another element */
@@ -12285,7 +15049,12 @@ static void gc_update_threaded_pointers(JSContext *ctx,
     }
 }
 
-static void gc_thread_block(JSContext *ctx, void *ptr)
+typedef void JSGCPointerFunc(JSContext *ctx, JSValue *pval, void *opaque);
+
+/* call 'func' for each value of the memory block 'ptr' which may be a
+   pointer */
+static force_inline void gc_iterate_block(JSContext *ctx, void *ptr,
+                                          JSGCPointerFunc *func, void *opaque)
 {
     int mtag;
     
@@ -12294,30 +15063,30 @@ static void gc_thread_block(JSContext *ctx, void *ptr)
     case JS_MTAG_OBJECT:
         {
             JSObject *p = ptr;
-            gc_thread_pointer(ctx, &p->proto);
-            gc_thread_pointer(ctx, &p->props);
+            func(ctx, &p->proto, opaque);
+            func(ctx, &p->props, opaque);
             switch(p->class_id) {
             case JS_CLASS_CLOSURE:
                 {
                     int i;
-                    gc_thread_pointer(ctx, &p->u.closure.func_bytecode);
+                    func(ctx, &p->u.closure.func_bytecode, opaque);
                     for(i = 0; i < p->extra_size - 1; i++)
-                        gc_thread_pointer(ctx, &p->u.closure.var_refs[i]);
+                        func(ctx, &p->u.closure.var_refs[i], opaque);
                 }
                 break;
             case JS_CLASS_C_FUNCTION:
                 if (p->extra_size > 1)
-                    gc_thread_pointer(ctx, &p->u.cfunc.params);
+                    func(ctx, &p->u.cfunc.params, opaque);
                 break;
             case JS_CLASS_ARRAY:
-                gc_thread_pointer(ctx, &p->u.array.tab);
+                func(ctx, &p->u.array.tab, opaque);
                 break;
             case JS_CLASS_ERROR:
-                gc_thread_pointer(ctx, &p->u.error.message);
-                gc_thread_pointer(ctx, &p->u.error.stack);
+                func(ctx, &p->u.error.message, opaque);
+                func(ctx, &p->u.error.stack, opaque);
                 break;
             case JS_CLASS_ARRAY_BUFFER:
-                gc_thread_pointer(ctx, &p->u.array_buffer.byte_buffer);
+                func(ctx, &p->u.array_buffer.byte_buffer, opaque);
                 break;
             case JS_CLASS_UINT8C_ARRAY:
             case JS_CLASS_INT8_ARRAY:
@@ -12328,11 +15097,18 @@ static void gc_thread_block(JSContext *ctx, void *ptr)
             case JS_CLASS_UINT32_ARRAY:
             case JS_CLASS_FLOAT32_ARRAY:
             case JS_CLASS_FLOAT64_ARRAY:
-                gc_thread_pointer(ctx, &p->u.typed_array.buffer);
+            case JS_CLASS_DATA_VIEW:
+                func(ctx, &p->u.typed_array.buffer, opaque);
                 break;
             case JS_CLASS_REGEXP:
-                gc_thread_pointer(ctx, &p->u.regexp.source);
-                gc_thread_pointer(ctx, &p->u.regexp.byte_code);
+                func(ctx, &p->u.regexp.source, opaque);
+                func(ctx, &p->u.regexp.byte_code, opaque);
+                break;
+            case JS_CLASS_JSON_PARSER:
+                func(ctx, &p->u.json_parser.stack, opaque);
+                func(ctx, &p->u.json_parser.token, opaque);
+                func(ctx, &p->u.json_parser.callback, opaque);
+                func(ctx, &p->u.json_parser.result, opaque);
                 break;
             }
         }
@@ -12342,26 +15118,33 @@ static void gc_thread_block(JSContext *ctx, void *ptr)
             JSValueArray *p = ptr;
             int i;
             for(i = 0; i < p->size; i++) {
-                gc_thread_pointer(ctx, &p->arr[i]);
+                func(ctx, &p->arr[i], opaque);
             }
         }
         break;
     case JS_MTAG_VARREF:
         {
             JSVarRef *p = ptr;
-            gc_thread_pointer(ctx, &p->u.value);
+            func(ctx, &p->u.value, opaque);
+        }
+        break;
+    case JS_MTAG_STRING:
+        {
+            JSString *p = ptr;
+            if (p->is_rope)
+                func(ctx, (JSValue *)p->buf, opaque);
         }
         break;
     case JS_MTAG_FUNCTION_BYTECODE:
         {
             JSFunctionBytecode *b = ptr;
-            gc_thread_pointer(ctx, &b->func_name);
-            gc_thread_pointer(ctx, &b->byte_code);
-            gc_thread_pointer(ctx, &b->cpool);
-            gc_thread_pointer(ctx, &b->vars);
-            gc_thread_pointer(ctx, &b->ext_vars);
-            gc_thread_pointer(ctx, &b->filename);
-            gc_thread_pointer(ctx, &b->pc2line);
+            func(ctx, &b->func_name, opaque);
+            func(ctx, &b->byte_code, opaque);
+            func(ctx, &b->cpool, opaque);
+            func(ctx, &b->vars, opaque);
+            func(ctx, &b->ext_vars, opaque);
+            func(ctx, &b->filename, opaque);
+            func(ctx, &b->pc2line, opaque);
         }
         break;
     default:
@@ -12369,12 +15152,26 @@ static void gc_thread_block(JSContext *ctx, void *ptr)
     }
 }
 
+static void gc_thread_pointer1(JSContext *ctx, JSValue *pval, void *opaque)
+{
+    gc_thread_pointer(ctx, pval);
+}
+
+static void gc_thread_block(JSContext *ctx, void *ptr)
+{
+    gc_iterate_block(ctx, ptr, gc_thread_pointer1, NULL);
+}
+
 /* Heap compaction using Jonkers algorithm */
 static void gc_compact_heap(JSContext *ctx)
 {
     uint8_t *ptr, *new_ptr;
     int size;
     JSValue *sp, *sp_end;
+    JSTempBlock *tb;
+#ifdef CONFIG_HEAP_PROFILE
+    JSHeapProfileCompactState hs;
+#endif
     
     /* thread all the external pointers */
     sp_end = ctx->class_proto + 2 * ctx->class_count;
@@ -12389,8 +15186,30 @@ static void gc_compact_heap(JSContext *ctx)
             gc_thread_pointer(ctx, &ce->str);
         }
     }
+#if JS_SHAPE_CACHE_SIZE > 0
+    {
+        int i;
+        for(i = 0; i < JS_SHAPE_CACHE_SIZE; i++)
+            gc_thread_pointer(ctx, &ctx->shape_cache[i]);
+    }
+#endif
+#if JS_REGEXP_CACHE_SIZE > 0
+    {
+        int i;
+        for(i = 0; i < JS_REGEXP_CACHE_SIZE; i++) {
+            gc_thread_pointer(ctx, &ctx->regexp_cache[i].source);
+            gc_thread_pointer(ctx, &ctx->regexp_cache[i].byte_code);
+        }
+    }
+#endif
     
+    tb = ctx->temp_blocks;
     for(sp = ctx->sp; sp < (JSValue *)ctx->stack_top; sp++) {
+        if (unlikely((JSValue *)tb == sp)) {
+            sp += tb->len - 1;
+            tb = tb->prev;
+            continue;
+        }
         gc_thread_pointer(ctx, sp);
     }
 
@@ -12414,9 +15233,42 @@ static void gc_compact_heap(JSContext *ctx)
         gc_thread_pointer(ctx, &ps->byte_code);
     }
 
+#ifdef CONFIG_HEAP_PROFILE
+    if (ctx->heap_profile) {
+        JSHeapProfile *hp = ctx->heap_profile;
+        int i;
+        for(i = 0; i < hp->sites_len; i++)
+            gc_thread_pointer(ctx, &hp->sites[i].func_bytecode);
+    }
+#endif
+
+#ifdef CONFIG_GC_NURSERY
+    /* the old blocks are not moved but may reference young blocks */
+    if (ctx->gc_base != ctx->heap_base) {
+        if (ctx->gc_remembered_len >= 0) {
+            JSValue *tab = (JSValue *)ctx->heap_free;
+            int i;
+            for(i = 0; i < ctx->gc_remembered_len; i++)
+                gc_thread_block(ctx, JS_VALUE_TO_PTR(tab[i]));
+            /* not recorded because it only contains weak references */
+            if (JS_IsPtr(ctx->unique_strings) &&
+                (uint8_t *)JS_VALUE_TO_PTR(ctx->unique_strings) < ctx->gc_base)
+                gc_thread_block(ctx, JS_VALUE_TO_PTR(ctx->unique_strings));
+        } else {
+            ptr = ctx->heap_base;
+            while (ptr < ctx->gc_base) {
+                size = get_mblock_size(ptr);
+                if (js_get_mtag(ptr) != JS_MTAG_FREE)
+                    gc_thread_block(ctx, ptr);
+                ptr += size;
+            }
+        }
+    }
+#endif
+    
     /* pass 1: thread the pointers and update the previous ones */
-    new_ptr = ctx->heap_base;
-    ptr = ctx->heap_base;
+    new_ptr = ctx->gc_base;
+    ptr = ctx->gc_base;
     while (ptr < ctx->heap_free) {
         gc_update_threaded_pointers(ctx, ptr, new_ptr);
         size = get_mblock_size(ptr);
@@ -12427,14 +15279,21 @@ static void gc_compact_heap(JSContext *ctx)
         ptr += size;
     }
     
+#ifdef CONFIG_HEAP_PROFILE
+    js_heap_profile_compact_start(ctx, &hs);
+#endif
     /* pass 2: update the threaded pointers and move the block to its
        final position */
-    new_ptr = ctx->heap_base;
-    ptr = ctx->heap_base;
+    new_ptr = ctx->gc_base;
+    ptr = ctx->gc_base;
     while (ptr < ctx->heap_free) {
         gc_update_threaded_pointers(ctx, ptr, new_ptr);
         size = get_mblock_size(ptr);
         if (js_get_mtag(ptr) != JS_MTAG_FREE) {
+#ifdef CONFIG_HEAP_PROFILE
+            if (ctx->heap_profile)
+                js_heap_profile_move(ctx, &hs, ptr, new_ptr);
+#endif
             if (new_ptr != ptr) {
                 memmove(new_ptr, ptr, size);
             }
@@ -12443,6 +15302,10 @@ static void gc_compact_heap(JSContext *ctx)
         ptr += size;
     }
     ctx->heap_free = new_ptr;
+#ifdef CONFIG_HEAP_PROFILE
+    if (ctx->heap_profile)
+        js_heap_profile_compact_end(ctx, &hs);
+#endif
 
     /* update the source pointer in the parser */
     if (ctx->parse_state) {
@@ -12456,17 +15319,81 @@ static void gc_compact_heap(JSContext *ctx)
     /* rehash the object properties */
     /* XXX: try to do it in the previous pass (add a specific tag ?) */
     ptr = ctx->heap_base;
+#ifdef CONFIG_GC_NURSERY
+    /* only the keys of the young generation may have moved. The old
+       objects which received a young property table or key are in the
+       remembered set. */
+    if (ctx->gc_base != ctx->heap_base &&
+        ctx->remembered_set_len <= JS_REMEMBERED_SET_SIZE) {
+        int i;
+        for(i = 0; i < ctx->remembered_set_len; i++) {
+            ptr = ctx->remembered_set[i];
+            if (ptr < ctx->gc_base && js_get_mtag(ptr) == JS_MTAG_OBJECT &&
+                js_props_has_young_key(ctx, (JSObject *)ptr))
+                js_rehash_props(ctx, (JSObject *)ptr, TRUE);
+        }
+        ptr = ctx->gc_base;
+    }
+#endif
     while (ptr < ctx->heap_free) {
         size = get_mblock_size(ptr);
         if (js_get_mtag(ptr) == JS_MTAG_OBJECT) {
-            js_rehash_props(ctx, (JSObject *)ptr, TRUE);
+#ifdef CONFIG_GC_NURSERY
+            if (ctx->gc_base == ctx->heap_base ||
+                js_props_has_young_key(ctx, (JSObject *)ptr))
+#endif
+                js_rehash_props(ctx, (JSObject *)ptr, TRUE);
         }
         ptr += size;
     }
+#if JS_SHAPE_CACHE_SIZE > 0
+    js_shape_cache_rehash(ctx);
+#endif
+}
+
+static int64_t gc_stats_start(JSContext *ctx)
+{
+    JSGCStats *gs = &ctx->gc_stats;
+    uint32_t heap_size = ctx->heap_free - ctx->heap_base;
+    if (heap_size > ctx->heap_size_max)
+        ctx->heap_size_max = heap_size;
+    gs->reclaimed_last = heap_size; /* updated in gc_stats_end() */
+    if (ctx->clock_func)
+        return ctx->clock_func(ctx, ctx->opaque);
+    else
+        return 0;
+}
+
+static void gc_stats_end(JSContext *ctx, int64_t t0, BOOL is_minor)
+{
+    JSGCStats *gs = &ctx->gc_stats;
+    uint32_t pause;
+    int i;
+    
+    if (is_minor)
+        gs->minor_count++;
+    else
+        gs->count++;
+    gs->reclaimed_last -= ctx->heap_free - ctx->heap_base;
+    gs->reclaimed_total += gs->reclaimed_last;
+    if (ctx->clock_func) {
+        pause = ctx->clock_func(ctx, ctx->opaque) - t0;
+        gs->pause_last = pause;
+        gs->pause_total += pause;
+        if (pause > gs->pause_max)
+            gs->pause_max = pause;
+        for(i = 0; i < JS_GC_PAUSE_HIST_SIZE - 1; i++) {
+            if (pause < ((uint32_t)64 << i))
+                break;
+        }
+        gs->pause_hist[i]++;
+    }
 }
 
 static void JS_GC2(JSContext *ctx, BOOL keep_atoms)
 {
+    int64_t t0;
+
 #ifdef DUMP_GC
     js_printf(ctx, "GC   : heap size=%u/%u stack_size=%u\n",
            (uint32_t)(ctx->heap_free - ctx->heap_base),
@@ -12490,8 +15417,16 @@ static void JS_GC2(JSContext *ctx, BOOL keep_atoms)
         }
     }
 #endif
+#ifdef CONFIG_GC_NURSERY
+    js_clear_remembered_marks(ctx);
+    ctx->remembered_set_len = 0;
+    ctx->gc_full_pending = FALSE;
+#endif
+    t0 = gc_stats_start(ctx);
     gc_mark_all(ctx, keep_atoms);
     gc_compact_heap(ctx);
+    gc_stats_end(ctx, t0, FALSE);
+    ctx->young_start = ctx->heap_free;
 #ifdef DUMP_GC
     js_printf(ctx, "AFTER: heap size=%u/%u stack_size=%u\n",
            (uint32_t)(ctx->heap_free - ctx->heap_base),
@@ -12505,6 +15440,419 @@ void JS_GC(JSContext *ctx)
     JS_GC2(ctx, TRUE);
 }
 
+#ifdef CONFIG_GC_NURSERY
+#ifdef DEBUG_GC
+static void gc_check_young_ref(JSContext *ctx, JSValue *pval, void *opaque)
+{
+    uint8_t *ptr;
+    if (!JS_IsPtr(*pval))
+        return;
+    ptr = JS_VALUE_TO_PTR(*pval);
+    if (ptr >= ctx->young_start && ptr < ctx->heap_free) {
+        js_printf(ctx, "missing write barrier: %s at offset %u references %s at offset %u\n",
+                  get_mtag_name(js_get_mtag(opaque)),
+                  (uint32_t)((uint8_t *)opaque - ctx->heap_base),
+                  get_mtag_name(js_get_mtag(ptr)),
+                  (uint32_t)(ptr - ctx->heap_base));
+        abort();
+    }
+}
+
+/* check that the old blocks referencing young blocks are in the
+   remembered set */
+static void gc_check_remembered_set(JSContext *ctx)
+{
+    uint8_t *ptr;
+    if (ctx->remembered_set_len > JS_REMEMBERED_SET_SIZE)
+        return;
+    for(ptr = ctx->heap_base; ptr < ctx->young_start; ptr += get_mblock_size(ptr)) {
+        if (js_get_mtag(ptr) == JS_MTAG_FREE ||
+            ((JSMemBlockHeader *)ptr)->gc_mark ||
+            JS_VALUE_FROM_PTR(ptr) == ctx->unique_strings)
+            continue;
+        gc_iterate_block(ctx, ptr, gc_check_young_ref, ptr);
+    }
+}
+#endif
+
+/* Minor GC: only the blocks allocated since the previous GC (the
+   young generation) are collected and compacted. The old blocks in
+   which the write barrier recorded a young reference are considered
+   as roots, so the unreachable old blocks are only freed by the next
+   full GC. The surviving young blocks are promoted. */
+static void JS_GCMinor(JSContext *ctx)
+{
+    int64_t t0;
+#ifdef DUMP_GC
+    js_printf(ctx, "GC minor: heap size=%u/%u young=%u remembered=%d\n",
+           (uint32_t)(ctx->heap_free - ctx->heap_base),
+           (uint32_t)(ctx->stack_top - ctx->heap_base),
+           (uint32_t)(ctx->heap_free - ctx->young_start),
+           ctx->remembered_set_len);
+#endif
+#ifdef DEBUG_GC
+    gc_check_remembered_set(ctx);
+#endif
+    js_clear_remembered_marks(ctx);
+    t0 = gc_stats_start(ctx);
+    ctx->gc_base = ctx->young_start;
+    gc_mark_all(ctx, TRUE);
+    gc_compact_heap(ctx);
+    ctx->gc_base = ctx->heap_base;
+    gc_stats_end(ctx, t0, TRUE);
+    ctx->young_start = ctx->heap_free;
+    ctx->remembered_set_len = 0;
+#ifdef DUMP_GC
+    js_printf(ctx, "AFTER: heap size=%u/%u\n",
+           (uint32_t)(ctx->heap_free - ctx->heap_base),
+           (uint32_t)(ctx->stack_top - ctx->heap_base));
+#endif
+}
+#endif
+
+/* Opportunistic collection from the idle part of an event loop, so
+   that fewer collections are triggered by the allocations. It is not
+   incremental: when it runs, it is a complete collection (a minor one
+   if possible) with the same pause as the one it replaces, only moved
+   to a time where it is harmless. It does nothing unless enough
+   memory was allocated since the last GC. Return TRUE if a collection
+   was done. */
+JS_BOOL JS_GCIdle(JSContext *ctx)
+{
+    uint32_t mem_size;
+
+    mem_size = ctx->stack_top - ctx->heap_base;
+    if ((ctx->heap_free - ctx->young_start) < (mem_size >> JS_GC_IDLE_MIN_LOG2))
+        return FALSE;
+#ifdef CONFIG_GC_NURSERY
+    /* a full GC is done when the next allocations would need it */
+    if (((uint8_t *)ctx->stack_bottom - ctx->heap_free) >=
+        (mem_size >> JS_GC_NURSERY_MIN_LOG2)) {
+        JS_GCMinor(ctx);
+        return TRUE;
+    }
+#endif
+    JS_GC(ctx);
+    return TRUE;
+}
+
+#ifdef CONFIG_HEAP_PROFILE
+/* heap profiler: report */
+
+/* number of largest blocks whose retainers are displayed */
+#ifndef JS_HEAP_PROFILE_LARGEST
+#define JS_HEAP_PROFILE_LARGEST 5
+#endif
+/* maximum length of a retainer chain */
+#define JS_HEAP_PROFILE_CHAIN_MAX 10
+
+/* return the site of the block at 'ptr' or -1 if it was not recorded */
+static int js_heap_profile_find_site(JSContext *ctx, const uint8_t *ptr)
+{
+    JSHeapProfile *hp = ctx->heap_profile;
+    uint32_t offset, a, b, m;
+
+    offset = ptr - ctx->heap_base;
+    a = 0;
+    b = hp->records_len;
+    while (a < b) {
+        m = (a + b) >> 1;
+        if (hp->records[m].offset < offset)
+            a = m + 1;
+        else
+            b = m;
+    }
+    if (a < hp->records_len && hp->records[a].offset == offset)
+        return hp->records[a].site;
+    else
+        return -1;
+}
+
+static void js_heap_profile_print_site(JSContext *ctx, int site)
+{
+    JSHeapProfileSite *hs;
+    JSFunctionBytecode *b;
+    JSCStringBuf buf1, buf2;
+    const char *name, *filename;
+    int line_num, col_num;
+
+    if (site < 0) {
+        js_printf(ctx, "<untracked>");
+        return;
+    }
+    hs = &ctx->heap_profile->sites[site];
+    if (site == 0) {
+        js_printf(ctx, "<other sites>");
+    } else if (JS_IsNull(hs->func_bytecode)) {
+        js_printf(ctx, "<native>");
+    } else {
+        b = JS_VALUE_TO_PTR(hs->func_bytecode);
+        name = NULL;
+        if (!JS_IsNull(b->func_name))
+            name = JS_ToCString(ctx, b->func_name, &buf1);
+        if (!name || name[0] == '\0')
+            name = "<anonymous>";
+        filename = JS_ToCString(ctx, b->filename, &buf2);
+        line_num = find_line_col(&col_num, b, hs->pc);
+        js_printf(ctx, "%s (%s:%d)", name, filename, line_num);
+    }
+}
+
+static void js_heap_profile_print_block(JSContext *ctx, uint8_t *ptr)
+{
+    js_printf(ctx, "%-12s ", get_mtag_name(js_get_mtag(ptr)));
+    if (JS_VALUE_FROM_PTR(ptr) == ctx->global_obj)
+        js_printf(ctx, "globalThis");
+    else
+        js_heap_profile_print_site(ctx, js_heap_profile_find_site(ctx, ptr));
+}
+
+/* size of the live blocks which are not reachable from the roots
+   without going through 'block' (whose references are not
+   followed). No memory is allocated. */
+static uint32_t js_heap_profile_unreachable_size(JSContext *ctx, uint8_t *block)
+{
+    GCMarkState s_s, *s = &s_s;
+    JSMemBlockHeader *mb;
+    uint8_t *ptr;
+    uint32_t size, unreachable_size;
+
+#ifdef CONFIG_GC_NURSERY
+    /* the marks are used, so the next minor GC scans all the old
+       blocks */
+    js_clear_remembered_marks(ctx);
+    ctx->remembered_set_len = JS_REMEMBERED_SET_SIZE + 1;
+#endif
+    s->ctx = ctx;
+    s->cut_block = block;
+    if (block)
+        ((JSMemBlockHeader *)block)->gc_mark = 1;
+    /* only referenced by the context but not a root (see gc_mark_all()) */
+    if (JS_IsPtr(ctx->unique_strings))
+        ((JSMemBlockHeader *)JS_VALUE_TO_PTR(ctx->unique_strings))->gc_mark = 1;
+    gc_mark_roots(s, TRUE);
+    unreachable_size = 0;
+    for(ptr = ctx->heap_base; ptr < ctx->heap_free; ptr += size) {
+        size = get_mblock_size(ptr);
+        mb = (JSMemBlockHeader *)ptr;
+        if (!mb->gc_mark && mb->mtag != JS_MTAG_FREE)
+            unreachable_size += size;
+        mb->gc_mark = 0;
+    }
+    return unreachable_size;
+}
+
+/* return a block containing a reference to 'target' which is not in
+   'chain' or NULL if none. The references are searched
+   conservatively, so a retainer may be wrong when a raw word of an
+   object has the value of the reference. */
+static uint8_t *js_heap_profile_find_retainer(JSContext *ctx, const uint8_t *target,
+                                              uint8_t **chain, int chain_len)
+{
+    JSValue val, *pv, *pv_end;
+    uint8_t *ptr;
+    int size, i;
+
+    val = JS_VALUE_FROM_PTR(target);
+    for(ptr = ctx->heap_base; ptr < ctx->heap_free; ptr += size) {
+        size = get_mblock_size(ptr);
+        /* the unique strings are weak references */
+        if (!mtag_has_references(js_get_mtag(ptr)) ||
+            JS_VALUE_FROM_PTR(ptr) == ctx->unique_strings)
+            continue;
+        for(i = 0; i < chain_len; i++) {
+            if (chain[i] == ptr)
+                break;
+        }
+        if (i < chain_len)
+            continue;
+        pv_end = (JSValue *)(ptr + size);
+        for(pv = (JSValue *)(ptr + sizeof(JSWord)); pv < pv_end; pv++) {
+            if (*pv == val)
+                return ptr;
+        }
+    }
+    return NULL;
+}
+
+static void js_heap_profile_dump(JSContext *ctx, int max_sites)
+{
+    JSHeapProfile *hp = ctx->heap_profile;
+    JSHeapProfileSite *hs;
+    uint32_t mtag_size[JS_MTAG_COUNT], mtag_count[JS_MTAG_COUNT];
+    uint32_t tot_size, tot_count, untracked_size, untracked_count;
+    uint32_t size, base_size, retained_size;
+    uint8_t *largest[JS_HEAP_PROFILE_LARGEST], *chain[JS_HEAP_PROFILE_CHAIN_MAX];
+    uint8_t *ptr;
+    int i, j, k, mtag, site, largest_len, chain_len;
+
+    for(i = 0; i < JS_MTAG_COUNT; i++) {
+        mtag_size[i] = 0;
+        mtag_count[i] = 0;
+    }
+    for(i = 0; i < hp->sites_len; i++) {
+        hp->sites[i].size = 0;
+        hp->sites[i].count = 0;
+    }
+    tot_size = 0;
+    tot_count = 0;
+    untracked_size = 0;
+    untracked_count = 0;
+    largest_len = 0;
+
+    /* the records are sorted as the blocks */
+    j = 0;
+    for(ptr = ctx->heap_base; ptr < ctx->heap_free; ptr += size) {
+        size = get_mblock_size(ptr);
+        mtag = js_get_mtag(ptr);
+        if (mtag == JS_MTAG_FREE)
+            continue;
+        mtag_size[mtag] += size;
+        mtag_count[mtag]++;
+        tot_size += size;
+        tot_count++;
+        while (j < hp->records_len &&
+               hp->records[j].offset < (uint8_t *)ptr - ctx->heap_base)
+            j++;
+        if (j < hp->records_len &&
+            hp->records[j].offset == (uint8_t *)ptr - ctx->heap_base) {
+            hs = &hp->sites[hp->records[j].site];
+            hs->size += size;
+            hs->count++;
+        } else {
+            untracked_size += size;
+            untracked_count++;
+        }
+        /* keep the largest blocks sorted by decreasing size */
+        for(k = largest_len; k > 0 && get_mblock_size(largest[k - 1]) < size; k--) {
+            if (k < JS_HEAP_PROFILE_LARGEST)
+                largest[k] = largest[k - 1];
+        }
+        if (k < JS_HEAP_PROFILE_LARGEST) {
+            largest[k] = ptr;
+            if (largest_len < JS_HEAP_PROFILE_LARGEST)
+                largest_len++;
+        }
+    }
+
+    /* merge the sites of the same source line */
+    for(i = 1; i < hp->sites_len; i++) {
+        hs = &hp->sites[i];
+        hs->line_num = 0;
+        if (hs->count != 0 && !JS_IsNull(hs->func_bytecode))
+            hs->line_num = find_line_col(&k, JS_VALUE_TO_PTR(hs->func_bytecode), hs->pc);
+        for(j = 1; j < i; j++) {
+            if (hp->sites[j].count != 0 &&
+                hp->sites[j].func_bytecode == hs->func_bytecode &&
+                hp->sites[j].line_num == hs->line_num) {
+                hp->sites[j].size += hs->size;
+                hp->sites[j].count += hs->count;
+                hs->count = 0;
+                break;
+            }
+        }
+    }
+
+    js_printf(ctx, "heap profile: live=%u bytes in %u blocks, untracked=%u bytes in %u blocks, sites=%d/%d, lost records=%u\n",
+              (unsigned int)tot_size, (unsigned int)tot_count,
+              (unsigned int)untracked_size, (unsigned int)untracked_count,
+              hp->sites_len - 1, JS_HEAP_PROFILE_SITES - 1,
+              (unsigned int)hp->records_lost);
+
+    js_printf(ctx, "%15s %8s %8s %8s\n", "TAG", "COUNT", "SIZE", "RATIO");
+    for(i = 0; i < JS_MTAG_COUNT; i++) {
+        if (mtag_count[i] != 0) {
+            js_printf(ctx, "%15s %8u %8u %7d%%\n",
+                      get_mtag_name(i),
+                      (unsigned int)mtag_count[i],
+                      (unsigned int)mtag_size[i],
+                      (int)js_lrint((double)mtag_size[i] / (double)tot_size * 100.0));
+        }
+    }
+
+    js_printf(ctx, "%8s %8s  %s\n", "SIZE", "COUNT", "SITE");
+    for(i = 0; i < max_sites; i++) {
+        /* select the next largest site */
+        site = -1;
+        for(j = 0; j < hp->sites_len; j++) {
+            hs = &hp->sites[j];
+            if (hs->count != 0 &&
+                (site < 0 || hs->size > hp->sites[site].size))
+                site = j;
+        }
+        if (site < 0)
+            break;
+        hs = &hp->sites[site];
+        js_printf(ctx, "%8u %8u  ", (unsigned int)hs->size, (unsigned int)hs->count);
+        js_heap_profile_print_site(ctx, site);
+        js_printf(ctx, "\n");
+        hs->count = 0;
+    }
+
+    /* the retained size of a block is the size of the blocks which
+       would be freed if it was freed, i.e. the blocks it dominates */
+    js_printf(ctx, "%8s %8s  %s\n", "SIZE", "RETAINED", "LARGEST BLOCKS AND RETAINERS");
+    base_size = js_heap_profile_unreachable_size(ctx, NULL);
+    for(i = 0; i < largest_len; i++) {
+        ptr = largest[i];
+        retained_size = js_heap_profile_unreachable_size(ctx, ptr) - base_size +
+            get_mblock_size(ptr);
+        js_printf(ctx, "%8u %8u  ", (unsigned int)get_mblock_size(ptr),
+                  (unsigned int)retained_size);
+        js_heap_profile_print_block(ctx, ptr);
+        js_printf(ctx, "\n");
+        chain[0] = ptr;
+        chain_len = 1;
+        /* the global object is a root */
+        while (JS_VALUE_FROM_PTR(ptr) != ctx->global_obj) {
+            if (chain_len >= JS_HEAP_PROFILE_CHAIN_MAX) {
+                js_printf(ctx, "%19s<- ...\n", "");
+                break;
+            }
+            ptr = js_heap_profile_find_retainer(ctx, ptr, chain, chain_len);
+            if (!ptr) {
+                js_printf(ctx, "%19s<- <root>\n", "");
+                break;
+            }
+            chain[chain_len++] = ptr;
+            js_printf(ctx, "%19s<- ", "");
+            js_heap_profile_print_block(ctx, ptr);
+            js_printf(ctx, "\n");
+        }
+    }
+}
+
+void JS_DumpHeapProfile(JSContext *ctx, int max_sites,
+                        JSWriteFunc *write_func, void *opaque)
+{
+    JSWriteFunc *write_func1;
+    void *opaque1;
+
+    /* only the live blocks are reported */
+    JS_GC(ctx);
+
+    write_func1 = ctx->write_func;
+    opaque1 = ctx->opaque;
+    if (write_func) {
+        ctx->write_func = write_func;
+        ctx->opaque = opaque;
+    }
+    if (ctx->write_func) {
+        if (ctx->heap_profile)
+            js_heap_profile_dump(ctx, max_sites);
+        else
+            js_printf(ctx, "heap profile not enabled\n");
+    }
+    ctx->write_func = write_func1;
+    ctx->opaque = opaque1;
+}
+#else
+void JS_DumpHeapProfile(JSContext *ctx, int max_sites,
+                        JSWriteFunc *write_func, void *opaque)
+{
+}
+#endif /* CONFIG_HEAP_PROFILE */
+
 /* bytecode saving and loading */
 
 #define JS_BYTECODE_VERSION_32 0x0001
@@ -12526,9 +15874,13 @@ void JS_PrepareBytecode(JSContext *ctx,
         ctx->class_obj[i] = JS_NULL;
     }
     ctx->global_obj = JS_NULL;
+    ctx->job_first = JS_NULL;
+    ctx->job_last = JS_NULL;
 #ifdef DEBUG_GC
     ctx->dummy_block = JS_NULL;
 #endif
+    /* the bytecode loader expects a sorted unique string array */
+    js_sort_unique_strings(ctx);
     
     JS_PUSH_VALUE(ctx, eval_code);
     JS_GC2(ctx, FALSE);
@@ -12747,6 +16099,10 @@ static int gc_compact_heap_64to32(JSContext *ctx)
     int size, size_32;
     uintptr_t new_offset;
     
+#ifdef CONFIG_HEAP_PROFILE
+    /* the offsets of the records are no longer valid */
+    ctx->heap_profile = NULL;
+#endif
     gc_thread_pointer(ctx, &ctx->unique_strings);
 
     /* thread all the external pointers */
@@ -12862,9 +16218,13 @@ int JS_PrepareBytecode64to32(JSContext *ctx,
         ctx->class_obj[i] = JS_NULL;
     }
     ctx->global_obj = JS_NULL;
+    ctx->job_first = JS_NULL;
+    ctx->job_last = JS_NULL;
 #ifdef DEBUG_GC
     ctx->dummy_block = JS_NULL;
 #endif
+    /* the bytecode loader expects a sorted unique string array */
+    js_sort_unique_strings(ctx);
     
     JS_PUSH_VALUE(ctx, eval_code);
 #ifdef JS_USE_SHORT_FLOAT
@@ -12892,6 +16252,59 @@ int JS_PrepareBytecode64to32(JSContext *ctx,
 }
 #endif /* JSW == 8 */
 
+static void dump_bytecode_name(JSContext *ctx, JSValue val,
+                               JSWriteFunc *write_func, void *opaque)
+{
+    JSCStringBuf buf;
+    const char *str;
+    size_t len;
+
+    if (!JS_IsString(ctx, val))
+        return;
+    str = JS_ToCStringLen(ctx, &len, val, &buf);
+    if (!str)
+        return;
+    write_func(opaque, str, len);
+    write_func(opaque, "\n", 1);
+}
+
+int JS_DumpBytecodeNames(JSContext *ctx, JSValue val,
+                         JSWriteFunc *write_func, void *opaque)
+{
+    JSFunctionBytecode *b;
+    JSValueArray *arr;
+    JSValue v;
+    int i;
+
+    if (!JS_IsPtr(val))
+        return -1;
+    b = JS_VALUE_TO_PTR(val);
+    if (b->mtag != JS_MTAG_FUNCTION_BYTECODE)
+        return -1;
+    /* the property names are in the constant pool. No allocation is
+       done because the strings of the bytecode are not ropes. The
+       functions which are not compiled yet (JS_EVAL_LAZY) only
+       reference their source. */
+    if (b->cpool != JS_NULL && b->byte_code != JS_NULL) {
+        arr = JS_VALUE_TO_PTR(b->cpool);
+        for(i = 0; i < arr->size; i++) {
+            v = arr->arr[i];
+            if (JS_IsPtr(v) &&
+                js_get_mtag(JS_VALUE_TO_PTR(v)) == JS_MTAG_FUNCTION_BYTECODE)
+                JS_DumpBytecodeNames(ctx, v, write_func, opaque);
+            else
+                dump_bytecode_name(ctx, v, write_func, opaque);
+        }
+    }
+    /* the global variables are closure variables of the main function */
+    if (b->ext_vars != JS_NULL) {
+        arr = JS_VALUE_TO_PTR(b->ext_vars);
+        for(i = 0; i < arr->size; i += 2)
+            dump_bytecode_name(ctx, arr->arr[i], write_func, opaque);
+    }
+    return 0;
+}
+
 BOOL JS_IsBytecode(const uint8_t *buf, size_t buf_len)
 {
     const JSBytecodeHeader *hdr = (const JSBytecodeHeader *)buf;
@@ -12906,6 +16319,7 @@ typedef struct {
     uint32_t data_offset;    // Offset from start of bytecode data (for ROM table lookup)
     void* rom_collect_buf;   // ROM collection buffer (WASM only, for building ROM table)
     int* rom_collect_count;  // ROM collection count (WASM only)
+    uintptr_t ptr_offset;    // Offset to read the values in the buffer (buf - base)
 } BCRelocState;
 
 /* Enable ROM translation debugging on ESP32 */
@@ -13052,11 +16466,14 @@ static void bc_reloc_value(BCRelocState *s, JSValue *pval)
 #endif
             // CRITICAL FIX: Relocate FIRST to get a valid pointer
             // This allows streaming from position-independent bytecode (base_addr=0)
-            // where val is an offset, not a valid pointer yet
+            // where val is an offset, not a valid pointer yet. The
+            // target address may not be readable yet (e.g. flash
+            // which is written after relocation) so the value is read
+            // from the buffer being relocated.
             val_relocated = val + s->offset;
 
-            // NOW we can safely dereference the relocated pointer
-            p = JS_VALUE_TO_PTR(val_relocated);
+            // NOW we can safely dereference the pointer
+            p = JS_VALUE_TO_PTR(val + s->ptr_offset);
 #ifdef EMSCRIPTEN
             printf("[bc_reloc_value] Got ptr: p=%p, mtag=%d\n", (void*)p, p->mtag);
 #endif
@@ -13073,8 +16490,8 @@ static void bc_reloc_value(BCRelocState *s, JSValue *pval)
 #ifdef EMSCRIPTEN
                     printf("[bc_reloc_value] Searching table %d: arr=%p, size=%d\n", i, (void*)arr1, arr1 ? arr1->size : -1);
 #endif
-                    // Search using relocated value, not original offset
-                    str = find_atom(ctx, &a, arr1, arr1->size, val_relocated);
+                    // Search using the readable value, not original offset
+                    str = find_atom(ctx, &a, arr1, arr1->size, val + s->ptr_offset);
                     if (!JS_IsNull(str)) {
 #ifdef EMSCRIPTEN
                         printf("[bc_reloc_value] Found in ROM atom table, replacing 0x%lx with ROM value 0x%llx\n",
@@ -13185,6 +16602,7 @@ int JS_RelocateBytecode2(JSContext *ctx, JSBytecodeHeader *hdr,
        modified */
     s->ctx = ctx;
     s->offset = new_base_addr - hdr->base_addr;
+    s->ptr_offset = (uintptr_t)buf - hdr->base_addr;
     s->update_atoms = update_atoms;
     s->current_ptr = 0;  // Will be set by JS_RelocateMtag() for each block
     s->data_offset = 0;  // Track position in bytecode data
@@ -13230,11 +16648,12 @@ size_t JS_GetRomTableSize(const JSBytecodeHeader *hdr)
     return 0;  /* v0x0001 or other versions have no ROM table */
 }
 
-/* Relocate the bytecode in 'buf' so that it can be executed
-   later. Return 0 if OK, != 0 if error
+/* Relocate the bytecode in 'buf' so that it can be executed at
+   'load_addr', e.g. the address at which the flash partition it is
+   written to is memory mapped. Return 0 if OK, != 0 if error
    Supports both v0x0001 (legacy) and v0x0002 (with ROM atom translation) */
-int JS_RelocateBytecode(JSContext *ctx,
-                        uint8_t *buf, uint32_t buf_len)
+int JS_RelocateBytecodeTo(JSContext *ctx, uint8_t *buf, uint32_t buf_len,
+                          uintptr_t load_addr)
 {
     uint8_t *data_ptr;
     JSBytecodeHeader *hdr;
@@ -13259,7 +16678,7 @@ int JS_RelocateBytecode(JSContext *ctx,
 
         /* Relocate with update_atoms=0 (ROM translation handles atoms) */
         int result = JS_RelocateBytecode2(ctx, hdr, data_ptr, data_len,
-                                         (uintptr_t)data_ptr, FALSE);
+                                         load_addr + (data_ptr - buf), FALSE);
 
         /* Clear ROM translation table */
         g_rom_translation_table = NULL;
@@ -13272,14 +16691,34 @@ int JS_RelocateBytecode(JSContext *ctx,
         return JS_RelocateBytecode2(ctx, hdr,
                                     data_ptr,
                                     buf_len - sizeof(JSBytecodeHeader),
-                                    (uintptr_t)data_ptr, TRUE);
+                                    load_addr + (data_ptr - buf), TRUE);
     }
 }
 
-/* Load the precompiled bytecode from 'buf'. 'buf' must be allocated
-   as long as the JSContext exists. Use JS_Run() to execute
-   it. warning: the bytecode is not checked so it should come from a
-   trusted source. */
+/* Relocate the bytecode in 'buf' so that it can be executed
+   later. Return 0 if OK, != 0 if error */
+int JS_RelocateBytecode(JSContext *ctx,
+                        uint8_t *buf, uint32_t buf_len)
+{
+    return JS_RelocateBytecodeTo(ctx, buf, buf_len, (uintptr_t)buf);
+}
+
+/* Return TRUE if the bytecode in 'buf' is relocated for its current
+   address, so that it can be given to JS_LoadBytecode() without
+   copy. */
+BOOL JS_IsBytecodeRelocated(const uint8_t *buf, size_t buf_len)
+{
+    const JSBytecodeHeader *hdr = (const JSBytecodeHeader *)buf;
+
+    if (!JS_IsBytecode(buf, buf_len))
+        return FALSE;
+    return hdr->base_addr == (uintptr_t)(hdr + 1) + JS_GetRomTableSize(hdr);
+}
+
+/* Load the precompiled bytecode from 'buf'. 'buf' must be allocated
+   as long as the JSContext exists. Use JS_Run() to execute
+   it. warning: the bytecode is not checked so it should come from a
+   trusted source. */
 JSValue JS_LoadBytecode(JSContext *ctx, const uint8_t *buf)
 {
     const JSBytecodeHeader *hdr = (const JSBytecodeHeader *)buf;
@@ -13310,2448 +16749,5299 @@ JSValue JS_LoadBytecode(JSContext *ctx, const uint8_t *buf)
 }
 
 /**********************************************************************/
-/* runtime */
+/* heap snapshot */
 
-JSValue js_function_constructor(JSContext *ctx, JSValue *this_val,
-                                int argc, JSValue *argv)
-{
-    StringBuffer b_s, *b = &b_s;
-    JSValue val;
-    int i, n;
+#define JS_SNAPSHOT_MAGIC 0xacfc
+/* bit 15 of snapshot version is a 64-bit indicator */
+#define JS_SNAPSHOT_VERSION (0x0002 | ((JSW & 8) << 12))
+
+typedef struct {
+    uint16_t magic; /* JS_SNAPSHOT_MAGIC */
+    uint16_t version;
+    uint16_t class_count;
+    uint8_t n_rom_atom_tables;
+    uint8_t unique_strings_sorted;
+    int32_t unique_strings_len;
+    uint32_t data_len; /* length of the data following the header */
+    uint64_t random_state;
+    /* XXX: add a stdlib checksum */
+    uint32_t stdlib_atom_count;
+    uintptr_t stdlib_table; /* address of the stdlib when it was saved */
+    uintptr_t base_addr; /* address of the data (&ctx->unique_strings) */
+    const JSValueArray *rom_atom_tables[N_ROM_ATOM_TABLES_MAX];
+} JSSnapshotHeader;
+
+typedef struct {
+    /* saved address range and relocation offset of the heap and of
+       the stdlib */
+    uintptr_t heap_start, heap_end, heap_offset;
+    uintptr_t rom_start, rom_end, rom_offset;
+} JSSnapshotRelocState;
+
+/* The saved data is the end of the JSContext structure (JSValue
+   fields and class prototypes) followed by the compacted heap. The
+   pointers to the heap and to the stdlib are relocated when
+   restoring. The other pointers (loaded bytecode) are kept as is, so
+   a snapshot can only be restored by the same executable and with
+   the bytecode loaded at the same address. */
+int JS_SaveSnapshot(JSContext *ctx, JSWriteFunc *write_func, void *opaque)
+{
+    JSSnapshotHeader hdr;
+    uint8_t *ptr, *data;
+    JSObject *p;
+    int i;
     
-    argc &= ~FRAME_CF_CTOR;
-    string_buffer_push(ctx, b, 0);
-    string_buffer_puts(ctx, b, "(function anonymous(");
-    n = argc - 1;
-    for(i = 0; i < n; i++) {
-        if (i != 0) {
-            string_buffer_putc(ctx, b, ',');
-        }
-        if (string_buffer_concat(ctx, b, argv[i]))
-            goto done;
+    if (ctx->fp != (JSValue *)ctx->stack_top || ctx->parse_state ||
+        ctx->top_gc_ref) {
+        JS_ThrowInternalError(ctx, "cannot save a running context");
+        return -1;
     }
-    string_buffer_puts(ctx, b, "\n) {\n");
-    if (n >= 0) {
-        if (string_buffer_concat(ctx, b, argv[n]))
-            goto done;
+    JS_GC(ctx);
+
+    /* the objects referencing C resources cannot be restored */
+    for(ptr = ctx->heap_base; ptr < ctx->heap_free; ptr += get_mblock_size(ptr)) {
+        p = (JSObject *)ptr;
+        if (p->mtag != JS_MTAG_OBJECT)
+            continue;
+        if ((p->class_id >= JS_CLASS_USER &&
+             ctx->c_finalizer_table[p->class_id - JS_CLASS_USER] != NULL) ||
+            (p->class_id == JS_CLASS_ARRAY_BUFFER && p->extra_size > 1 &&
+             p->u.array_buffer.free_func != NULL)) {
+            JS_ThrowTypeError(ctx, "cannot save an object with a finalizer");
+            return -1;
+        }
     }
-    string_buffer_puts(ctx, b, "\n})");
- done:
-    val = string_buffer_pop(ctx, b);
-    if (JS_IsException(val))
-        return val;
-    val = JS_Parse2(ctx, val, NULL, 0, "<input>", JS_EVAL_RETVAL);
-    if (JS_IsException(val))
-        return val;
-    return JS_Run(ctx, val);
+    
+    data = (uint8_t *)&ctx->unique_strings;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = JS_SNAPSHOT_MAGIC;
+    hdr.version = JS_SNAPSHOT_VERSION;
+    hdr.class_count = ctx->class_count;
+    hdr.n_rom_atom_tables = ctx->n_rom_atom_tables;
+    hdr.unique_strings_sorted = ctx->unique_strings_sorted;
+    hdr.unique_strings_len = ctx->unique_strings_len;
+    hdr.data_len = ctx->heap_free - data;
+    hdr.random_state = ctx->random_state;
+    hdr.stdlib_atom_count = ctx->rom_atom_tables[0]->size;
+    hdr.stdlib_table = (uintptr_t)ctx->atom_table;
+    hdr.base_addr = (uintptr_t)data;
+    for(i = 0; i < ctx->n_rom_atom_tables; i++)
+        hdr.rom_atom_tables[i] = ctx->rom_atom_tables[i];
+    write_func(opaque, &hdr, sizeof(hdr));
+    write_func(opaque, data, hdr.data_len);
+    return 0;
 }
 
-JSValue js_function_get_prototype(JSContext *ctx, JSValue *this_val,
-                                  int argc, JSValue *argv)
+static void snapshot_reloc_pointer(JSContext *ctx, JSValue *pval, void *opaque)
 {
-    JSValue obj;
-    JSGCRef obj_ref;
+    JSSnapshotRelocState *s = opaque;
+    JSValue val = *pval;
+    uintptr_t addr;
     
-    if (!JS_IsPtr(*this_val)) {
-        if (JS_VALUE_GET_SPECIAL_TAG(*this_val) != JS_TAG_SHORT_FUNC)
-            goto fail;
-        return JS_UNDEFINED;
-    } else {
-        JSObject *p = JS_VALUE_TO_PTR(*this_val);
-        if (p->mtag != JS_MTAG_OBJECT)
-            goto fail;
-        if (p->class_id == JS_CLASS_CLOSURE) {
-            obj = JS_NewObject(ctx);
-            if (JS_IsException(obj))
-                return obj;
-        } else if (p->class_id == JS_CLASS_C_FUNCTION) {
-            /* for C constructors, the prototype property is already present */
-            return JS_UNDEFINED;
-        } else {
-        fail:
-            return JS_ThrowTypeError(ctx, "not a function");
+    if (!JS_IsPtr(val))
+        return;
+    addr = (uintptr_t)JS_VALUE_TO_PTR(val);
+    if (addr >= s->heap_start && addr < s->heap_end)
+        *pval = val + s->heap_offset;
+    else if (addr >= s->rom_start && addr < s->rom_end)
+        *pval = val + s->rom_offset;
+}
+
+JSContext *JS_RestoreSnapshot(void *mem_start, size_t mem_size,
+                              const JSSTDLibraryDef *stdlib_def,
+                              const uint8_t *buf, size_t buf_len)
+{
+    JSSnapshotHeader hdr;
+    JSContext *ctx;
+    uint8_t *ptr, *data;
+    JSValue *pv, *pv_end;
+    int i;
+    
+    if (buf_len < sizeof(hdr))
+        return NULL;
+    memcpy(&hdr, buf, sizeof(hdr));
+    if (hdr.magic != JS_SNAPSHOT_MAGIC ||
+        hdr.version != JS_SNAPSHOT_VERSION ||
+        hdr.class_count != stdlib_def->class_count ||
+        hdr.stdlib_atom_count != ((const JSValueArray *)(stdlib_def->stdlib_table +
+                                                          stdlib_def->sorted_atoms_offset))->size ||
+        hdr.n_rom_atom_tables < 1 ||
+        hdr.n_rom_atom_tables > N_ROM_ATOM_TABLES_MAX ||
+        hdr.data_len > buf_len - sizeof(hdr))
+        return NULL;
+    
+    ctx = js_init_context(mem_start, mem_size, stdlib_def);
+    data = (uint8_t *)&ctx->unique_strings;
+    if (hdr.data_len < ctx->heap_base - data ||
+        hdr.data_len + ctx->min_free_size > ctx->stack_top - data)
+        return NULL;
+    js_init_rom_atoms(ctx, stdlib_def);
+    for(i = 1; i < hdr.n_rom_atom_tables; i++)
+        ctx->rom_atom_tables[i] = hdr.rom_atom_tables[i];
+    ctx->n_rom_atom_tables = hdr.n_rom_atom_tables;
+    ctx->unique_strings_sorted = hdr.unique_strings_sorted;
+    ctx->unique_strings_len = hdr.unique_strings_len;
+    ctx->random_state = hdr.random_state;
+
+    memcpy(data, buf + sizeof(hdr), hdr.data_len);
+    ctx->heap_free = data + hdr.data_len;
+    ctx->young_start = ctx->heap_free;
+    ctx->free_size_min = ctx->stack_top - ctx->heap_free;
+
+    if ((uintptr_t)data != hdr.base_addr ||
+        (uintptr_t)stdlib_def->stdlib_table != hdr.stdlib_table) {
+        JSSnapshotRelocState ss, *s = &ss;
+        s->heap_start = hdr.base_addr;
+        s->heap_end = hdr.base_addr + hdr.data_len;
+        s->heap_offset = (uintptr_t)data - hdr.base_addr;
+        s->rom_start = hdr.stdlib_table;
+        s->rom_end = hdr.stdlib_table + stdlib_def->stdlib_table_len * sizeof(JSWord);
+        s->rom_offset = (uintptr_t)stdlib_def->stdlib_table - hdr.stdlib_table;
+        
+        pv_end = ctx->class_proto + 2 * ctx->class_count;
+        for(pv = &ctx->unique_strings; pv < pv_end; pv++)
+            snapshot_reloc_pointer(ctx, pv, s);
+        for(ptr = ctx->heap_base; ptr < ctx->heap_free; ptr += get_mblock_size(ptr))
+            gc_iterate_block(ctx, ptr, snapshot_reloc_pointer, s);
+        /* the property hashes depend on the key addresses */
+        for(ptr = ctx->heap_base; ptr < ctx->heap_free; ptr += get_mblock_size(ptr)) {
+            if (js_get_mtag(ptr) == JS_MTAG_OBJECT)
+                js_rehash_props(ctx, (JSObject *)ptr, TRUE);
         }
-        JS_PUSH_VALUE(ctx, obj);
-        JS_DefinePropertyValue(ctx, obj, js_get_atom(ctx, JS_ATOM_constructor),
-                               *this_val);
-        JS_POP_VALUE(ctx, obj);
-        JS_PUSH_VALUE(ctx, obj);
-        JS_DefinePropertyValue(ctx, *this_val, js_get_atom(ctx, JS_ATOM_prototype),
-                               obj);
-        JS_POP_VALUE(ctx, obj);
     }
-    return obj;
+    return ctx;
 }
 
-JSValue js_function_set_prototype(JSContext *ctx, JSValue *this_val,
-                                  int argc, JSValue *argv)
-{
-    if (!JS_IsFunctionObject(ctx, *this_val))
-        return JS_ThrowTypeError(ctx, "not a function");
+/**********************************************************************/
+/* compact bytecode */
 
-    JS_DefinePropertyValue(ctx, *this_val, js_get_atom(ctx, JS_ATOM_prototype),
-                           argv[0]);
-    return JS_UNDEFINED;
-}
+/* Transport format of a compiled function, independent of the word
+   size and of the endianness. It is expanded in the heap by
+   JS_LoadCompactBytecode():
+   
+   - the strings of all the functions are stored once in a table
+     and referenced by index,
+   - the instruction operands of 2 and 4 bytes are varints (zigzag
+     encoded if signed),
+   - the functions are stored in post order without their memory
+     block headers. A function takes its nested functions from the
+     stack of the previously read ones, so no index is needed,
+   - pc2line is already delta coded with exp-Golomb codes, so it is
+     copied as is.
+
+   Layout: magic (2 bytes), version (1 byte), string count, function
+   count, strings (length * 2 + is_unique, then the bytes),
+   functions. */
+
+#define JS_COMPACT_BYTECODE_MAGIC 0xacfd
+#define JS_COMPACT_BYTECODE_VERSION 1
 
-JSValue js_function_get_length_name(JSContext *ctx, JSValue *this_val,
-                                    int argc, JSValue *argv, int is_name)
+typedef enum {
+    CBC_VAL_NULL,
+    CBC_VAL_UNDEFINED,
+    CBC_VAL_INT,
+    CBC_VAL_FLOAT64,
+    CBC_VAL_STRING,
+    CBC_VAL_BYTES, /* regexp bytecode */
+    CBC_VAL_FUNC,
+} CBCValueTagEnum;
+
+typedef struct {
+    JSContext *ctx;
+    JSWriteFunc *write_func;
+    void *opaque;
+    JSValue *pstrings; /* JSValueArray of the unique strings */
+    int string_count;
+    int func_count;
+    int buf_len;
+    uint8_t buf[256];
+} CBCWriteState;
+
+typedef struct {
+    const uint8_t *ptr;
+    const uint8_t *end;
+    BOOL error;
+} CBCReadState;
+
+static BOOL cbc_is_string(JSValue val)
 {
-    JSFunctionBytecode *b;
-    JSValue ret = js_function_get_length_name1(ctx, this_val, is_name, &b);
-    if (JS_IsNull(ret))
-        return JS_ThrowTypeError(ctx, "not a function");
-    return ret;
+    if (JS_IsPtr(val))
+        return js_get_mtag(JS_VALUE_TO_PTR(val)) == JS_MTAG_STRING;
+    return JS_VALUE_GET_SPECIAL_TAG(val) == JS_TAG_STRING_CHAR;
 }
 
-JSValue js_function_toString(JSContext *ctx, JSValue *this_val,
-                             int argc, JSValue *argv)
+static BOOL cbc_is_func(JSValue val)
 {
-    JSValue str, val;
-    JSGCRef str_ref;
+    return JS_IsPtr(val) &&
+        js_get_mtag(JS_VALUE_TO_PTR(val)) == JS_MTAG_FUNCTION_BYTECODE;
+}
 
-    str = js_function_get_length_name(ctx, this_val, 0, NULL, 1);
-    if (JS_IsException(str))
-        return str;
-    JS_PUSH_VALUE(ctx, str);
-    val = JS_NewString(ctx, "function ");
-    JS_POP_VALUE(ctx, str);
-    str = JS_ConcatString(ctx, val, str);
-    JS_PUSH_VALUE(ctx, str);
-    val = JS_NewString(ctx, "() {\n    [native code]\n}");
-    JS_POP_VALUE(ctx, str);
-    return JS_ConcatString(ctx, str, val);
+static BOOL cbc_string_equal(JSValue a, JSValue b)
+{
+    JSString *p1, *p2;
+    
+    if (a == b)
+        return TRUE;
+    if (!JS_IsPtr(a) || !JS_IsPtr(b))
+        return FALSE;
+    p1 = JS_VALUE_TO_PTR(a);
+    p2 = JS_VALUE_TO_PTR(b);
+    return (p1->is_unique == p2->is_unique && p1->len == p2->len &&
+            !memcmp(js_string_buf(p1), js_string_buf(p2), p1->len));
 }
 
-JSValue js_function_call(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv)
+/* return the index of 'val' in the string table or -1. XXX: use a
+   hash table if large scripts are saved on the device */
+static int cbc_find_string(CBCWriteState *s, JSValue val)
 {
+    JSValueArray *arr = JS_VALUE_TO_PTR(*s->pstrings);
     int i;
-    argc = max_int(argc, 1);
-    if (JS_StackCheck(ctx, argc + 1))
-        return JS_EXCEPTION;
-    for(i = 0; i < argc - 1; i++)
-        JS_PushArg(ctx, argv[argc - 1 - i]);
-    JS_PushArg(ctx, *this_val);
-    JS_PushArg(ctx, argv[0]);
-    /* we avoid recursing on the C stack */
-    return JS_NewTailCall(argc - 1);
+    for(i = 0; i < s->string_count; i++) {
+        if (cbc_string_equal(arr->arr[i], val))
+            return i;
+    }
+    return -1;
 }
 
-JSValue js_function_apply(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv)
+/* if 'pstrings' is NULL, only count the string references */
+static void cbc_add_string(CBCWriteState *s, JSValue val)
 {
     JSValueArray *arr;
-    JSObject *p;
-    int len, i;
-    p = js_get_object_class(ctx, argv[1], JS_CLASS_ARRAY);
-    if (!p)
-        return JS_ThrowTypeError(ctx, "not an array");
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    len = p->u.array.len;
-    if (JS_StackCheck(ctx, len + 2))
-        return JS_EXCEPTION;
-    p = JS_VALUE_TO_PTR(argv[1]);
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    for(i = 0; i < len; i++)
-        JS_PushArg(ctx, arr->arr[len - 1 - i]);
-    JS_PushArg(ctx, *this_val);
-    JS_PushArg(ctx, argv[0]);
-    /* we avoid recursing on the C stack */
-    return JS_NewTailCall(len);
+    
+    if (!cbc_is_string(val))
+        return;
+    if (!s->pstrings) {
+        s->string_count++;
+    } else if (cbc_find_string(s, val) < 0) {
+        arr = JS_VALUE_TO_PTR(*s->pstrings);
+        arr->arr[s->string_count++] = val;
+        js_write_barrier(s->ctx, arr, val);
+    }
 }
 
-JSValue js_function_bind(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv)
+static void cbc_add_array_strings(CBCWriteState *s, JSValue val)
 {
-    int arg_count;
     JSValueArray *arr;
     int i;
-    
-    arg_count = max_int(argc - 1, 0);
-    arr = js_alloc_value_array(ctx, 0, 2 + arg_count);
-    if (!arr)
-        return JS_EXCEPTION;
-    /* arr[0] = func, arr[1] = this */
-    arr->arr[0] = *this_val;
-    for(i = 0; i < arg_count + 1; i++)
-        arr->arr[1 + i] = argv[i];
-    return JS_NewCFunctionParams(ctx, JS_CFUNCTION_bound, JS_VALUE_FROM_PTR(arr));
+    if (val == JS_NULL)
+        return;
+    arr = JS_VALUE_TO_PTR(val);
+    for(i = 0; i < arr->size; i++)
+        cbc_add_string(s, arr->arr[i]);
 }
 
-/* XXX: handle constructor case */
-JSValue js_function_bound(JSContext *ctx, JSValue *this_val,
-                          int argc, JSValue *argv, JSValue params)
+/* return -1 if a function is not compiled. No allocation. */
+static int cbc_collect_strings(CBCWriteState *s, JSValue func)
 {
+    JSFunctionBytecode *b = JS_VALUE_TO_PTR(func);
     JSValueArray *arr;
-    JSGCRef params_ref;
-    int i, err, size;
-    
-    arr = JS_VALUE_TO_PTR(params);
-    size = arr->size;
-    JS_PUSH_VALUE(ctx, params);
-    err = JS_StackCheck(ctx, size + argc);
-    JS_POP_VALUE(ctx, params);
-    if (err)
-        return JS_EXCEPTION;
-    arr = JS_VALUE_TO_PTR(params);
-    for(i = argc - 1; i >= 0; i--)
-        JS_PushArg(ctx, argv[i]);
-    for(i = size - 1; i >= 2; i--) {
-        JS_PushArg(ctx, arr->arr[i]);
+    int i;
+
+    if (b->byte_code == JS_NULL)
+        return -1;
+    s->func_count++;
+    cbc_add_string(s, b->func_name);
+    cbc_add_string(s, b->filename);
+    if (b->cpool != JS_NULL) {
+        arr = JS_VALUE_TO_PTR(b->cpool);
+        for(i = 0; i < arr->size; i++) {
+            if (cbc_is_func(arr->arr[i])) {
+                if (cbc_collect_strings(s, arr->arr[i]))
+                    return -1;
+            } else {
+                cbc_add_string(s, arr->arr[i]);
+            }
+        }
     }
-    JS_PushArg(ctx, arr->arr[0]); /* func */
-    JS_PushArg(ctx, arr->arr[1]); /* this_val */
-    /* we avoid recursing on the C stack */
-    return JS_NewTailCall(size - 2 + argc);
+    cbc_add_array_strings(s, b->vars);
+    cbc_add_array_strings(s, b->ext_vars);
+    return 0;
 }
 
-/**********************************************************************/
-
-JSValue js_number_constructor(JSContext *ctx, JSValue *this_val,
-                              int argc, JSValue *argv)
+static void cbc_flush(CBCWriteState *s)
 {
-    double d;
-    if (argc & FRAME_CF_CTOR)
-        return JS_ThrowTypeError(ctx, "number constructor not supported");
-    if (argc == 0) {
-        return JS_NewShortInt(0);
-    } else {
-        if (JS_ToNumber(ctx, &d, argv[0]))
-            return JS_EXCEPTION;
-        return JS_NewFloat64(ctx, d);
+    if (s->buf_len != 0) {
+        s->write_func(s->opaque, s->buf, s->buf_len);
+        s->buf_len = 0;
     }
 }
 
-static int js_thisNumberValue(JSContext *ctx, double *pres, JSValue val)
+static void cbc_put_data(CBCWriteState *s, const uint8_t *buf, size_t len)
 {
-    if (!JS_IsNumber(ctx, val)) {
-        JS_ThrowTypeError(ctx, "not a number");
-        return -1;
+    if (len > sizeof(s->buf) - s->buf_len) {
+        cbc_flush(s);
+        if (len > sizeof(s->buf)) {
+            s->write_func(s->opaque, buf, len);
+            return;
+        }
     }
-    return JS_ToNumber(ctx, pres, val);
+    memcpy(s->buf + s->buf_len, buf, len);
+    s->buf_len += len;
 }
 
-JSValue js_number_toString(JSContext *ctx, JSValue *this_val,
-                           int argc, JSValue *argv)
+static void cbc_put_u8(CBCWriteState *s, uint8_t v)
 {
-    int radix, flags;
-    double d;
-    
-    if (js_thisNumberValue(ctx, &d, *this_val))
-        return JS_EXCEPTION;
-    if (JS_IsUndefined(argv[0])) {
-        radix = 10;
-    } else {
-        if (JS_ToInt32Sat(ctx, &radix, argv[0]))
-            return JS_EXCEPTION;
-        if (radix < 2 || radix > 36)
-            return JS_ThrowRangeError(ctx, "radix must be between 2 and 36");
+    cbc_put_data(s, &v, 1);
+}
+
+static void cbc_put_uvarint(CBCWriteState *s, uint32_t v)
+{
+    uint8_t buf[5];
+    int len = 0;
+    while (v >= 0x80) {
+        buf[len++] = v | 0x80;
+        v >>= 7;
     }
-    /* cannot fail */
-    flags = JS_DTOA_FORMAT_FREE;
-    if (radix != 10)
-        flags |=  JS_DTOA_EXP_DISABLED;
-    return js_dtoa2(ctx, d, radix, 0, flags);
+    buf[len++] = v;
+    cbc_put_data(s, buf, len);
 }
 
-JSValue js_number_toFixed(JSContext *ctx, JSValue *this_val,
-                          int argc, JSValue *argv)
+static void cbc_put_svarint(CBCWriteState *s, int32_t v)
 {
-    int f, flags;
-    double d;
+    cbc_put_uvarint(s, ((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+}
 
-    if (js_thisNumberValue(ctx, &d, *this_val))
-        return JS_EXCEPTION;
-    if (JS_ToInt32Sat(ctx, &f, argv[0]))
-        return JS_EXCEPTION;
-    if (f < 0 || f > 100)
-        return JS_ThrowRangeError(ctx, "invalid number of digits");
-    if (fabs(d) >= 1e21) {
-        flags = JS_DTOA_FORMAT_FREE;
+static void cbc_put_value(CBCWriteState *s, JSValue val)
+{
+    JSByteArray *ba;
+    uint64_t u;
+    double d;
+    int i;
+    
+    if (val == JS_NULL) {
+        cbc_put_u8(s, CBC_VAL_NULL);
+    } else if (val == JS_UNDEFINED) {
+        cbc_put_u8(s, CBC_VAL_UNDEFINED);
+    } else if (JS_IsInt(val)) {
+        cbc_put_u8(s, CBC_VAL_INT);
+        cbc_put_svarint(s, JS_VALUE_GET_INT(val));
+    } else if (cbc_is_string(val)) {
+        cbc_put_u8(s, CBC_VAL_STRING);
+        cbc_put_uvarint(s, cbc_find_string(s, val));
+    } else if (cbc_is_func(val)) {
+        cbc_put_u8(s, CBC_VAL_FUNC);
+    } else if (JS_IsPtr(val) &&
+               js_get_mtag(JS_VALUE_TO_PTR(val)) == JS_MTAG_BYTE_ARRAY) {
+        ba = JS_VALUE_TO_PTR(val);
+        cbc_put_u8(s, CBC_VAL_BYTES);
+        cbc_put_uvarint(s, ba->size);
+        cbc_put_data(s, ba->buf, ba->size);
     } else {
-        flags = JS_DTOA_FORMAT_FRAC;
+        /* no allocation for a number */
+        JS_ToNumber(s->ctx, &d, val);
+        memcpy(&u, &d, sizeof(u));
+        cbc_put_u8(s, CBC_VAL_FLOAT64);
+        for(i = 0; i < 8; i++)
+            cbc_put_u8(s, u >> (i * 8));
     }
-    return js_dtoa2(ctx, d, 10, f, flags);
 }
 
-JSValue js_number_toExponential(JSContext *ctx, JSValue *this_val,
-                                int argc, JSValue *argv)
+/* JS_NULL is stored as 0, otherwise the size + 1 */
+static void cbc_put_value_array(CBCWriteState *s, JSValue val)
 {
-    int f, flags;
-    double d;
+    JSValueArray *arr;
+    int i;
+    
+    if (val == JS_NULL) {
+        cbc_put_uvarint(s, 0);
+        return;
+    }
+    arr = JS_VALUE_TO_PTR(val);
+    cbc_put_uvarint(s, arr->size + 1);
+    for(i = 0; i < arr->size; i++)
+        cbc_put_value(s, arr->arr[i]);
+}
 
-    if (js_thisNumberValue(ctx, &d, *this_val))
-        return JS_EXCEPTION;
-    if (JS_ToInt32Sat(ctx, &f, argv[0]))
-        return JS_EXCEPTION;
-    if (JS_IsUndefined(argv[0]) || !isfinite(d)) {
-        f = 0;
-        flags = JS_DTOA_FORMAT_FREE;
-    } else {
-        if (f < 0 || f > 100)
-            return JS_ThrowRangeError(ctx, "invalid number of digits");
-        f++;
-        flags = JS_DTOA_FORMAT_FIXED;
+static BOOL cbc_is_signed_fmt(int fmt)
+{
+    switch(fmt) {
+    case OP_FMT_i16:
+    case OP_FMT_label16:
+    case OP_FMT_i32:
+    case OP_FMT_label:
+    case OP_FMT_value:
+        return TRUE;
+    default:
+        return FALSE;
     }
-    return js_dtoa2(ctx, d, 10, f, flags | JS_DTOA_EXP_ENABLED);
 }
 
-JSValue js_number_toPrecision(JSContext *ctx, JSValue *this_val,
-                              int argc, JSValue *argv)
+static void cbc_put_byte_code(CBCWriteState *s, JSValue val)
 {
-    int p, flags;
-    double d;
+    JSByteArray *arr = JS_VALUE_TO_PTR(val);
+    const uint8_t *tab = arr->buf;
+    int pos, op, size, fmt;
+    uint32_t v;
 
-    if (js_thisNumberValue(ctx, &d, *this_val))
-        return JS_EXCEPTION;
-    if (JS_IsUndefined(argv[0])) {
-        flags = JS_DTOA_FORMAT_FREE;
-        p = 0;
-    } else {
-        if (JS_ToInt32Sat(ctx, &p, argv[0]))
-            return JS_EXCEPTION;
-        if (!isfinite(d)) {
-            flags = JS_DTOA_FORMAT_FREE;
-        } else {
-            if (p < 1 || p > 100)
-                return JS_ThrowRangeError(ctx, "invalid number of digits");
-            flags = JS_DTOA_FORMAT_FIXED;
+    cbc_put_uvarint(s, arr->size);
+    for(pos = 0; pos < arr->size; pos += size) {
+        op = tab[pos];
+        size = opcode_info[op].size;
+        fmt = opcode_info[op].fmt;
+        cbc_put_u8(s, op);
+        switch(size) {
+        case 2:
+            cbc_put_u8(s, tab[pos + 1]);
+            break;
+        case 3:
+            v = get_u16(tab + pos + 1);
+            if (cbc_is_signed_fmt(fmt))
+                cbc_put_svarint(s, (int16_t)v);
+            else
+                cbc_put_uvarint(s, v);
+            break;
+        case 5:
+            v = get_u32(tab + pos + 1);
+            if (cbc_is_signed_fmt(fmt))
+                cbc_put_svarint(s, v);
+            else
+                cbc_put_uvarint(s, v);
+            break;
+        default:
+            break;
         }
     }
-    return js_dtoa2(ctx, d, 10, p, flags);
 }
 
-JSValue js_number_parseInt(JSContext *ctx, JSValue *this_val,
-                           int argc, JSValue *argv)
+static void cbc_put_function(CBCWriteState *s, JSValue func)
 {
-    int radix;
-    double d;
-    
-    argv[0] = JS_ToString(ctx, argv[0]);
-    if (JS_IsException(argv[0]))
-        return JS_EXCEPTION;
-    if (JS_ToInt32(ctx, &radix, argv[1]))
-        return JS_EXCEPTION;
-    if (radix != 0 && (radix < 2 || radix > 36)) {
-        d = NAN;
+    JSFunctionBytecode *b = JS_VALUE_TO_PTR(func);
+    JSValueArray *arr;
+    JSByteArray *ba;
+    int i, n_funcs;
+
+    /* the nested functions are written first */
+    n_funcs = 0;
+    if (b->cpool != JS_NULL) {
+        arr = JS_VALUE_TO_PTR(b->cpool);
+        for(i = 0; i < arr->size; i++) {
+            if (cbc_is_func(arr->arr[i])) {
+                cbc_put_function(s, arr->arr[i]);
+                n_funcs++;
+            }
+        }
+    }
+    cbc_put_uvarint(s, b->has_column);
+    cbc_put_uvarint(s, b->arg_count);
+    cbc_put_uvarint(s, b->stack_size);
+    cbc_put_value(s, b->func_name);
+    cbc_put_value(s, b->filename);
+    cbc_put_byte_code(s, b->byte_code);
+    cbc_put_uvarint(s, n_funcs);
+    cbc_put_value_array(s, b->cpool);
+    cbc_put_value_array(s, b->vars);
+    cbc_put_value_array(s, b->ext_vars);
+    if (b->pc2line == JS_NULL) {
+        cbc_put_uvarint(s, 0);
     } else {
-        if (js_atod1(ctx, &d, argv[0], radix, JS_ATOD_INT_ONLY))
-            return JS_EXCEPTION;
+        ba = JS_VALUE_TO_PTR(b->pc2line);
+        cbc_put_uvarint(s, ba->size + 1);
+        cbc_put_data(s, ba->buf, ba->size);
     }
-    return JS_NewFloat64(ctx, d);
 }
 
-JSValue js_number_parseFloat(JSContext *ctx, JSValue *this_val,
-                             int argc, JSValue *argv)
+int JS_WriteCompactBytecode(JSContext *ctx, JSValue val,
+                            JSWriteFunc *write_func, void *opaque)
 {
-    double d;
-    
-    argv[0] = JS_ToString(ctx, argv[0]);
-    if (JS_IsException(argv[0]))
-        return JS_EXCEPTION;
-    if (js_atod1(ctx, &d, argv[0], 10, 0))
-        return JS_EXCEPTION;
-    return JS_NewFloat64(ctx, d);
+    CBCWriteState ss, *s = &ss;
+    JSValueArray *arr;
+    JSString *p;
+    JSGCRef val_ref, strings_ref;
+    uint8_t buf[5];
+    const uint8_t *str;
+    int i, len;
+
+    if (!cbc_is_func(val)) {
+        JS_ThrowTypeError(ctx, "not a compiled function");
+        return -1;
+    }
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    s->write_func = write_func;
+    s->opaque = opaque;
+    if (cbc_collect_strings(s, val)) {
+        JS_ThrowTypeError(ctx, "cannot save a function which is not compiled");
+        return -1;
+    }
+
+    /* no allocation after the string table */
+    JS_PUSH_VALUE(ctx, val);
+    s->pstrings = JS_PushGCRef(ctx, &strings_ref);
+    arr = js_alloc_value_array(ctx, 0, max_int(s->string_count, 1));
+    if (!arr) {
+        JS_PopGCRef(ctx, &strings_ref);
+        JS_POP_VALUE(ctx, val);
+        return -1;
+    }
+    *s->pstrings = JS_VALUE_FROM_PTR(arr);
+    s->string_count = 0;
+    s->func_count = 0;
+    cbc_collect_strings(s, val_ref.val);
+
+    cbc_put_u8(s, JS_COMPACT_BYTECODE_MAGIC & 0xff);
+    cbc_put_u8(s, JS_COMPACT_BYTECODE_MAGIC >> 8);
+    cbc_put_u8(s, JS_COMPACT_BYTECODE_VERSION);
+    cbc_put_uvarint(s, s->string_count);
+    cbc_put_uvarint(s, s->func_count);
+    for(i = 0; i < s->string_count; i++) {
+        arr = JS_VALUE_TO_PTR(*s->pstrings);
+        if (JS_IsPtr(arr->arr[i])) {
+            p = JS_VALUE_TO_PTR(arr->arr[i]);
+            str = js_string_buf(p);
+            len = p->len;
+            cbc_put_uvarint(s, len * 2 + p->is_unique);
+        } else {
+            len = get_short_string(buf, arr->arr[i]);
+            str = buf;
+            cbc_put_uvarint(s, len * 2);
+        }
+        cbc_put_data(s, str, len);
+    }
+    cbc_put_function(s, val_ref.val);
+    cbc_flush(s);
+    JS_PopGCRef(ctx, &strings_ref);
+    JS_POP_VALUE(ctx, val);
+    return 0;
 }
 
-/**********************************************************************/
+BOOL JS_IsCompactBytecode(const uint8_t *buf, size_t buf_len)
+{
+    return (buf_len >= 3 &&
+            buf[0] == (JS_COMPACT_BYTECODE_MAGIC & 0xff) &&
+            buf[1] == (JS_COMPACT_BYTECODE_MAGIC >> 8));
+}
 
-JSValue js_boolean_constructor(JSContext *ctx, JSValue *this_val,
-                               int argc, JSValue *argv)
+static const uint8_t *cbc_get_data(CBCReadState *s, uint32_t len)
 {
-    if (argc & FRAME_CF_CTOR)
-        return JS_ThrowTypeError(ctx, "Boolean constructor not supported");
-    return JS_NewBool(JS_ToBool(ctx, argv[0]));
+    const uint8_t *ptr = s->ptr;
+    if (len > s->end - s->ptr) {
+        s->error = TRUE;
+        s->ptr = s->end;
+        return NULL;
+    }
+    s->ptr += len;
+    return ptr;
 }
 
-/**********************************************************************/
+static int cbc_get_u8(CBCReadState *s)
+{
+    if (s->ptr >= s->end) {
+        s->error = TRUE;
+        return 0;
+    }
+    return *s->ptr++;
+}
 
-JSValue js_string_get_length(JSContext *ctx, JSValue *this_val,
-                             int argc, JSValue *argv)
+static uint32_t cbc_get_uvarint(CBCReadState *s)
 {
-    int len;
-    
-    if (!JS_IsString(ctx, *this_val))
-        return JS_ThrowTypeError(ctx, "not a string");
-    len = js_string_len(ctx, *this_val);
-    return JS_NewShortInt(len);
+    uint32_t v = 0;
+    int c, shift;
+    for(shift = 0; shift < 35; shift += 7) {
+        c = cbc_get_u8(s);
+        v |= (uint32_t)(c & 0x7f) << shift;
+        if (!(c & 0x80))
+            return v;
+    }
+    s->error = TRUE;
+    return 0;
 }
 
-JSValue js_string_set_length(JSContext *ctx, JSValue *this_val,
-                            int argc, JSValue *argv)
+static int32_t cbc_get_svarint(CBCReadState *s)
 {
-    return JS_UNDEFINED; /* ignored */
+    uint32_t v = cbc_get_uvarint(s);
+    return (v >> 1) ^ -(v & 1);
 }
 
-JSValue js_string_slice(JSContext *ctx, JSValue *this_val,
-                        int argc, JSValue *argv)
+/* 'pfuncs' contains the stack of the functions read so far. The
+   nested functions of the current function start at 'func_idx'. */
+static JSValue cbc_get_value(JSContext *ctx, CBCReadState *s,
+                             JSValue *pstrings, JSValue *pfuncs,
+                             int *pfunc_idx, int func_end)
 {
-    int len, start, end;
-    
-    *this_val = JS_ToStringCheckObject(ctx, *this_val);
-    if (JS_IsException(*this_val))
-        return JS_EXCEPTION;
-    len = js_string_len(ctx, *this_val);
-    if (JS_ToInt32Clamp(ctx, &start, argv[0], 0, len, len))
-        return JS_EXCEPTION;
-    end = len;
-    if (!JS_IsUndefined(argv[1])) {
-        if (JS_ToInt32Clamp(ctx, &end, argv[1], 0, len, len))
+    JSValueArray *arr;
+    JSByteArray *ba;
+    const uint8_t *data;
+    uint64_t u;
+    uint32_t idx;
+    double d;
+    int i;
+
+    switch(cbc_get_u8(s)) {
+    case CBC_VAL_NULL:
+        return JS_NULL;
+    case CBC_VAL_UNDEFINED:
+        return JS_UNDEFINED;
+    case CBC_VAL_INT:
+        return JS_NewShortInt(cbc_get_svarint(s));
+    case CBC_VAL_FLOAT64:
+        u = 0;
+        for(i = 0; i < 8; i++)
+            u |= (uint64_t)cbc_get_u8(s) << (i * 8);
+        memcpy(&d, &u, sizeof(d));
+        return JS_NewFloat64(ctx, d);
+    case CBC_VAL_STRING:
+        idx = cbc_get_uvarint(s);
+        arr = JS_VALUE_TO_PTR(*pstrings);
+        if (idx >= arr->size)
+            break;
+        return arr->arr[idx];
+    case CBC_VAL_BYTES:
+        idx = cbc_get_uvarint(s);
+        data = cbc_get_data(s, idx);
+        if (!data)
+            break;
+        ba = js_alloc_byte_array(ctx, idx);
+        if (!ba)
             return JS_EXCEPTION;
+        memcpy(ba->buf, data, idx);
+        return JS_VALUE_FROM_PTR(ba);
+    case CBC_VAL_FUNC:
+        if (*pfunc_idx >= func_end)
+            break;
+        arr = JS_VALUE_TO_PTR(*pfuncs);
+        return arr->arr[(*pfunc_idx)++];
+    default:
+        break;
     }
-    return js_sub_string(ctx, *this_val, start, max_int(end, start));
+    s->error = TRUE;
+    return JS_NULL;
 }
 
-JSValue js_string_substring(JSContext *ctx, JSValue *this_val,
-                            int argc, JSValue *argv)
+/* return -1 if exception */
+static int cbc_get_value_array(JSContext *ctx, CBCReadState *s,
+                               JSValue *pfunc, int field_offset,
+                               JSValue *pstrings, JSValue *pfuncs,
+                               int *pfunc_idx, int func_end)
 {
-    int a, b, start, end, len;
+    JSValueArray *arr;
+    JSValue val;
+    uint32_t size, i;
 
-    *this_val = JS_ToStringCheckObject(ctx, *this_val);
-    if (JS_IsException(*this_val))
-        return JS_EXCEPTION;
-    len = js_string_len(ctx, *this_val);
-    if (JS_ToInt32Clamp(ctx, &a, argv[0], 0, len, 0))
-        return JS_EXCEPTION;
-    b = len;
-    if (!JS_IsUndefined(argv[1])) {
-        if (JS_ToInt32Clamp(ctx, &b, argv[1], 0, len, 0))
-            return JS_EXCEPTION;
+    size = cbc_get_uvarint(s);
+    if (size == 0)
+        return 0;
+    size--;
+    if (size > s->end - s->ptr) {
+        /* each value takes at least one byte */
+        s->error = TRUE;
+        return 0;
     }
-    if (a < b) {
-        start = a;
-        end = b;
-    } else {
-        start = b;
-        end = a;
+    arr = js_alloc_value_array(ctx, 0, size);
+    if (!arr)
+        return -1;
+    *(JSValue *)((uint8_t *)JS_VALUE_TO_PTR(*pfunc) + field_offset) =
+        JS_VALUE_FROM_PTR(arr);
+    js_write_barrier(ctx, JS_VALUE_TO_PTR(*pfunc), JS_VALUE_FROM_PTR(arr));
+    for(i = 0; i < size && !s->error; i++) {
+        val = cbc_get_value(ctx, s, pstrings, pfuncs, pfunc_idx, func_end);
+        if (JS_IsException(val))
+            return -1;
+        arr = JS_VALUE_TO_PTR(*(JSValue *)((uint8_t *)JS_VALUE_TO_PTR(*pfunc) +
+                                           field_offset));
+        arr->arr[i] = val;
+        js_write_barrier(ctx, arr, val);
     }
-    return js_sub_string(ctx, *this_val, start, end);
+    return 0;
 }
 
-JSValue js_string_charAt(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv, int magic)
+static void cbc_get_byte_code(CBCReadState *s, uint8_t *tab, uint32_t len)
 {
-    JSValue ret;
-    int idx, c;
-    
-    *this_val = JS_ToStringCheckObject(ctx, *this_val);
-    if (JS_IsException(*this_val))
-        return JS_EXCEPTION;
-    if (JS_ToInt32Sat(ctx, &idx, argv[0]))
-        return JS_EXCEPTION;
-    if (idx < 0)
-        goto ret_undef;
-    c = string_getcp(ctx, *this_val, idx, (magic == magic_codePointAt));
-    if (c == -1) {
-    ret_undef:
-        if (magic == magic_charCodeAt)
-            ret = JS_NewFloat64(ctx, NAN);
-        else if (magic == magic_charAt)
-            ret = js_get_atom(ctx, JS_ATOM_empty);
-        else
-            ret = JS_UNDEFINED;
-    } else {
-        if (magic == magic_charCodeAt || magic == magic_codePointAt)
-            ret = JS_NewShortInt(c);
-        else
-            ret = JS_NewStringChar(c);
-    }
-    //    dump_string_pos_cache(ctx);    
-    return ret;
-}
+    uint32_t pos, v;
+    int op, size;
 
-JSValue js_string_constructor(JSContext *ctx, JSValue *this_val,
-                              int argc, JSValue *argv)
-{
-    if (argc & FRAME_CF_CTOR)
-        return JS_ThrowTypeError(ctx, "string constructor not supported");
-    if (argc <= 0) {
-        return js_get_atom(ctx, JS_ATOM_empty);
-    } else {
-        return JS_ToString(ctx, argv[0]);
+    for(pos = 0; pos < len && !s->error; pos += size) {
+        op = cbc_get_u8(s);
+        if (op >= OP_COUNT)
+            goto fail;
+        size = opcode_info[op].size;
+        if (size > len - pos)
+            goto fail;
+        tab[pos] = op;
+        switch(size) {
+        case 2:
+            tab[pos + 1] = cbc_get_u8(s);
+            break;
+        case 3:
+            if (cbc_is_signed_fmt(opcode_info[op].fmt))
+                v = cbc_get_svarint(s);
+            else
+                v = cbc_get_uvarint(s);
+            put_u16(tab + pos + 1, v);
+            break;
+        case 5:
+            if (cbc_is_signed_fmt(opcode_info[op].fmt))
+                v = cbc_get_svarint(s);
+            else
+                v = cbc_get_uvarint(s);
+            put_u32(tab + pos + 1, v);
+            break;
+        default:
+            break;
+        }
     }
+    return;
+ fail:
+    s->error = TRUE;
 }
 
-JSValue js_string_fromCharCode(JSContext *ctx, JSValue *this_val,
-                               int argc, JSValue *argv, int is_fromCodePoint)
+/* read a function and push it on the 'pfuncs' stack. Return -1 if
+   exception. */
+static int cbc_get_function(JSContext *ctx, CBCReadState *s,
+                            JSValue *pstrings, JSValue *pfuncs,
+                            int *pfunc_count)
 {
-    int i;
-    StringBuffer b_s, *b = &b_s;
+    JSFunctionBytecode *b;
+    JSByteArray *ba;
+    JSValueArray *arr;
+    JSValue val, *pfunc;
+    JSGCRef func_ref;
+    const uint8_t *data;
+    uint32_t flags, arg_count, stack_size, len, n_funcs;
+    int func_idx, ret;
+
+    flags = cbc_get_uvarint(s);
+    arg_count = cbc_get_uvarint(s);
+    stack_size = cbc_get_uvarint(s);
+    if (s->error || arg_count > 0xffff || stack_size > 0xffff)
+        goto fail;
+    b = js_alloc_function_bytecode(ctx);
+    if (!b)
+        return -1;
+    b->has_column = flags & 1;
+    b->arg_count = arg_count;
+    b->stack_size = stack_size;
+    pfunc = JS_PushGCRef(ctx, &func_ref);
+    *pfunc = JS_VALUE_FROM_PTR(b);
+    ret = -1;
+    func_idx = *pfunc_count;
 
-    string_buffer_push(ctx, b, 0);
-    for(i = 0; i < argc; i++) {
-        int c;
-        if (JS_ToInt32(ctx, &c, argv[i]))
-            return JS_EXCEPTION;
-        if (is_fromCodePoint) {
-            if (c < 0 || c > 0x10ffff)
-                return JS_ThrowRangeError(ctx, "invalid code point");
-        } else {
-            c &= 0xffff;
-        }
-        if (string_buffer_putc(ctx, b, c))
-            break;
-    }
-    return string_buffer_pop(ctx, b);
+    val = cbc_get_value(ctx, s, pstrings, pfuncs, &func_idx, func_idx);
+    if (JS_IsException(val))
+        goto done;
+    b = JS_VALUE_TO_PTR(*pfunc);
+    b->func_name = val;
+    js_write_barrier(ctx, b, val);
+    val = cbc_get_value(ctx, s, pstrings, pfuncs, &func_idx, func_idx);
+    if (JS_IsException(val))
+        goto done;
+    b = JS_VALUE_TO_PTR(*pfunc);
+    b->filename = val;
+    js_write_barrier(ctx, b, val);
+
+    len = cbc_get_uvarint(s);
+    if (s->error || len > JS_BYTE_ARRAY_SIZE_MAX)
+        goto fail1;
+    ba = js_alloc_byte_array(ctx, len);
+    if (!ba)
+        goto done;
+    b = JS_VALUE_TO_PTR(*pfunc);
+    b->byte_code = JS_VALUE_FROM_PTR(ba);
+    js_write_barrier(ctx, b, b->byte_code);
+    cbc_get_byte_code(s, ba->buf, len);
+
+    n_funcs = cbc_get_uvarint(s);
+    if (n_funcs > *pfunc_count)
+        goto fail1;
+    func_idx = *pfunc_count - n_funcs;
+    if (cbc_get_value_array(ctx, s, pfunc, offsetof(JSFunctionBytecode, cpool),
+                            pstrings, pfuncs, &func_idx, *pfunc_count))
+        goto done;
+    if (func_idx != *pfunc_count)
+        goto fail1;
+    func_idx = *pfunc_count;
+    if (cbc_get_value_array(ctx, s, pfunc, offsetof(JSFunctionBytecode, vars),
+                            pstrings, pfuncs, &func_idx, func_idx))
+        goto done;
+    if (cbc_get_value_array(ctx, s, pfunc, offsetof(JSFunctionBytecode, ext_vars),
+                            pstrings, pfuncs, &func_idx, func_idx))
+        goto done;
+    b = JS_VALUE_TO_PTR(*pfunc);
+    if (b->ext_vars != JS_NULL) {
+        arr = JS_VALUE_TO_PTR(b->ext_vars);
+        b->ext_vars_len = arr->size / 2;
+    }
+
+    len = cbc_get_uvarint(s);
+    if (len != 0) {
+        len--;
+        data = cbc_get_data(s, len);
+        if (!data)
+            goto fail1;
+        ba = js_alloc_byte_array(ctx, len);
+        if (!ba)
+            goto done;
+        memcpy(ba->buf, data, len);
+        b = JS_VALUE_TO_PTR(*pfunc);
+        b->pc2line = JS_VALUE_FROM_PTR(ba);
+        js_write_barrier(ctx, b, b->pc2line);
+    }
+    if (s->error)
+        goto fail1;
+
+    /* replace the nested functions by this one on the stack */
+    *pfunc_count -= n_funcs;
+    arr = JS_VALUE_TO_PTR(*pfuncs);
+    if (*pfunc_count >= arr->size)
+        goto fail1;
+    arr->arr[(*pfunc_count)++] = *pfunc;
+    js_write_barrier(ctx, arr, *pfunc);
+    ret = 0;
+ done:
+    JS_PopGCRef(ctx, &func_ref);
+    return ret;
+ fail1:
+    JS_PopGCRef(ctx, &func_ref);
+ fail:
+    s->error = TRUE;
+    return 0;
 }
 
-JSValue js_string_concat(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv)
+JSValue JS_LoadCompactBytecode(JSContext *ctx, const uint8_t *buf, size_t buf_len)
 {
-    int i;
-    StringBuffer b_s, *b = &b_s;
-    JSValue r;
-    
-    r = JS_ToStringCheckObject(ctx, *this_val);
-    if (JS_IsException(r))
-        return JS_EXCEPTION;
-    string_buffer_push(ctx, b, 0);
-    if (string_buffer_concat(ctx, b, r))
+    CBCReadState ss, *s = &ss;
+    JSGCRef strings_ref, funcs_ref;
+    JSValue *pstrings, *pfuncs, val, ret;
+    JSValueArray *arr;
+    const uint8_t *str;
+    uint32_t string_count, func_count, len, i;
+    int func_stack_len;
+
+    if (!JS_IsCompactBytecode(buf, buf_len) ||
+        buf[2] != JS_COMPACT_BYTECODE_VERSION)
+        return JS_ThrowSyntaxError(ctx, "invalid compact bytecode");
+    s->ptr = buf + 3;
+    s->end = buf + buf_len;
+    s->error = FALSE;
+    string_count = cbc_get_uvarint(s);
+    func_count = cbc_get_uvarint(s);
+    /* each string or function takes at least one byte */
+    if (s->error || string_count > s->end - s->ptr ||
+        func_count == 0 || func_count > s->end - s->ptr)
+        return JS_ThrowSyntaxError(ctx, "invalid compact bytecode");
+
+    pstrings = JS_PushGCRef(ctx, &strings_ref);
+    pfuncs = JS_PushGCRef(ctx, &funcs_ref);
+    ret = JS_EXCEPTION;
+    arr = js_alloc_value_array(ctx, 0, string_count);
+    if (!arr)
         goto done;
+    *pstrings = JS_VALUE_FROM_PTR(arr);
+    arr = js_alloc_value_array(ctx, 0, func_count);
+    if (!arr)
+        goto done;
+    *pfuncs = JS_VALUE_FROM_PTR(arr);
 
-    for (i = 0; i < argc; i++) {
-        if (string_buffer_concat(ctx, b, argv[i]))
+    for(i = 0; i < string_count; i++) {
+        len = cbc_get_uvarint(s);
+        str = cbc_get_data(s, len >> 1);
+        if (!str)
+            goto fail;
+        val = JS_NewStringLen(ctx, (const char *)str, len >> 1);
+        if ((len & 1) && !JS_IsException(val))
+            val = JS_MakeUniqueString(ctx, val);
+        if (JS_IsException(val))
+            goto done;
+        arr = JS_VALUE_TO_PTR(*pstrings);
+        arr->arr[i] = val;
+        js_write_barrier(ctx, arr, val);
+    }
+
+    func_stack_len = 0;
+    for(i = 0; i < func_count; i++) {
+        if (cbc_get_function(ctx, s, pstrings, pfuncs, &func_stack_len))
             goto done;
+        if (s->error)
+            goto fail;
     }
+    if (func_stack_len != 1 || s->ptr != s->end)
+        goto fail;
+    arr = JS_VALUE_TO_PTR(*pfuncs);
+    ret = arr->arr[0];
  done:
-    return string_buffer_pop(ctx, b);
+    JS_PopGCRef(ctx, &funcs_ref);
+    JS_PopGCRef(ctx, &strings_ref);
+    return ret;
+ fail:
+    JS_ThrowSyntaxError(ctx, "invalid compact bytecode");
+    goto done;
 }
 
-JSValue js_string_indexOf(JSContext *ctx, JSValue *this_val,
-                          int argc, JSValue *argv, int lastIndexOf)
+/**********************************************************************/
+/* job queue and event rings */
+
+#define JS_JOB_NEXT 0
+#define JS_JOB_FUNC 1
+#define JS_JOB_ARGS 2
+
+int JS_EnqueueJob(JSContext *ctx, JSValue func, int argc, JSValue *argv)
 {
-    int i, len, v_len, pos, start, stop, ret, inc, j;
+    JSGCRef func_ref;
+    JSValueArray *job;
+    JSValue val;
+    int i;
 
-    *this_val = JS_ToStringCheckObject(ctx, *this_val);
-    if (JS_IsException(*this_val))
-        return JS_EXCEPTION;
-    argv[0] = JS_ToString(ctx, argv[0]);
-    if (JS_IsException(argv[0]))
-        return JS_EXCEPTION;
-    len = js_string_len(ctx, *this_val);
-    v_len = js_string_len(ctx, argv[0]);
-    if (lastIndexOf) {
-        pos = len - v_len;
-        if (argc > 1) {
-            double d;
-            if (JS_ToNumber(ctx, &d, argv[1]))
-                goto fail;
-            if (!isnan(d)) {
-                if (d <= 0)
-                    pos = 0;
-                else if (d < pos)
-                    pos = d;
-            }
-        }
-        start = pos;
-        stop = 0;
-        inc = -1;
+    JS_PUSH_VALUE(ctx, func);
+    job = js_alloc_value_array(ctx, 0, JS_JOB_ARGS + argc);
+    JS_POP_VALUE(ctx, func);
+    if (!job)
+        return -1;
+    job->arr[JS_JOB_NEXT] = JS_NULL;
+    job->arr[JS_JOB_FUNC] = func;
+    for(i = 0; i < argc; i++)
+        job->arr[JS_JOB_ARGS + i] = argv[i];
+    val = JS_VALUE_FROM_PTR(job);
+    if (ctx->job_last == JS_NULL) {
+        ctx->job_first = val;
     } else {
-        pos = 0;
-        if (argc > 1) {
-            if (JS_ToInt32Clamp(ctx, &pos, argv[1], 0, len, 0))
-                goto fail;
-        }
-        start = pos;
-        stop = len - v_len;
-        inc = 1;
-    }
-    ret = -1;
-    if (len >= v_len && inc * (stop - start) >= 0) {
-        for (i = start;; i += inc) {
-            for(j = 0; j < v_len; j++) {
-                if (string_getc(ctx, *this_val, i + j) != string_getc(ctx, argv[0], j)) {
-                    goto next;
-                }
-            }
-            ret = i;
-            break;
-        next:
-            if (i == stop)
-                break;
-        }
+        JSValueArray *last = JS_VALUE_TO_PTR(ctx->job_last);
+        last->arr[JS_JOB_NEXT] = val;
+        js_write_barrier(ctx, last, val);
     }
-    return JS_NewShortInt(ret);
+    ctx->job_last = val;
+    return 0;
+}
 
-fail:
-    return JS_EXCEPTION;
+/* an event is a 32 bit length followed by the data. A length of
+   JS_EVENT_WRAP tells that the next event is at the start of the
+   buffer. So does a tail equal to 'reset_pos', which is set when the
+   producer restarts an empty ring at the start of the buffer and is
+   cleared by the consumer when it jumps. */
+#define JS_EVENT_WRAP 0xffffffff
+
+static inline uint32_t js_event_size(uint32_t len)
+{
+    return sizeof(uint32_t) + ((len + 3) & ~3);
 }
 
-static int js_string_indexof(JSContext *ctx, JSValue str, JSValue needle,
-                             int start, int str_len, int needle_len)
+void JS_InitEventRing(JSEventRing *r, void *buf, size_t size,
+                      JSEventHandler *handler, void *opaque)
 {
-    int i, j;
-    for(i = start; i <= str_len - needle_len; i++) {
-        for(j = 0; j < needle_len; j++) {
-            if (string_getc(ctx, str, i + j) !=
-                string_getc(ctx, needle, j)) {
-                goto next;
-            }
-            
-        }
-        return i;
-    next: ;
-    }
-    return -1;
+    assert(((uintptr_t)buf & 3) == 0);
+    r->buf = buf;
+    r->size = size & ~3;
+    r->head = 0;
+    r->tail = 0;
+    r->reserve_pos = 0;
+    r->reserve_len = 0;
+    r->reserve_reset = FALSE;
+    r->reset_pos = JS_EVENT_WRAP;
+    r->handler = handler;
+    r->opaque = opaque;
+    r->link = NULL;
 }
 
-/* Note: ascii only */
-JSValue js_string_toLowerCase(JSContext *ctx, JSValue *this_val,
-                              int argc, JSValue *argv, int to_lower)
+void JS_AddEventRing(JSContext *ctx, JSEventRing *r)
 {
-    StringBuffer b_s, *b = &b_s;
-    int i, c, len;
+    JSEventRing *r1;
+    for(r1 = ctx->event_rings; r1 != NULL; r1 = r1->link) {
+        if (r1 == r)
+            return;
+    }
+    r->link = ctx->event_rings;
+    ctx->event_rings = r;
+}
 
-    *this_val = JS_ToStringCheckObject(ctx, *this_val);
-    if (JS_IsException(*this_val))
-        return *this_val;
-    len = js_string_len(ctx, *this_val);
-    string_buffer_push(ctx, b, len);
-    for(i = 0; i < len; i++) {
-        c = string_getc(ctx, *this_val, i);
-        if (to_lower) {
-            if (c >= 'A' && c <= 'Z')
-                c += 'a' - 'A';
-        } else {
-            if (c >= 'a' && c <= 'z')
-                c += 'A' - 'a';
+void JS_RemoveEventRing(JSContext *ctx, JSEventRing *r)
+{
+    JSEventRing **pr;
+    for(pr = &ctx->event_rings; *pr != NULL; pr = &(*pr)->link) {
+        if (*pr == r) {
+            *pr = r->link;
+            r->link = NULL;
+            break;
         }
-        string_buffer_putc(ctx, b, c);
     }
-    return string_buffer_pop(ctx, b);
 }
 
-/* c < 128 */
-static force_inline BOOL unicode_is_space_ascii(uint32_t c)
+uint8_t *JS_ReserveEvent(JSEventRing *r, size_t len)
 {
-    return (c >= 0x0009 && c <= 0x000D) || (c == 0x0020);
+    uint32_t head, tail, size, pos;
+
+    if (len > r->size)
+        return NULL;
+    size = js_event_size(len);
+    head = r->head;
+    r->reserve_reset = FALSE;
+    /* 'reset_pos' is read before the tail: once the consumer has
+       cleared it, the tail is after the jump to the start */
+    if (__atomic_load_n(&r->reset_pos, __ATOMIC_ACQUIRE) != JS_EVENT_WRAP) {
+        /* the consumer has not jumped to the start yet: the events
+           are in [0, head) */
+        tail = 0;
+    } else {
+        tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+        if (head == tail && head != 0) {
+            /* empty ring: restart at the start of the buffer so that
+               the whole ring is available */
+            r->reserve_reset = TRUE;
+            head = 0;
+            tail = 0;
+        }
+    }
+    /* head == tail means empty, so the ring is never completely
+       filled */
+    if (head >= tail) {
+        if (head + size < r->size ||
+            (head + size == r->size && tail != 0))
+            pos = head;
+        else if (size < tail)
+            pos = 0;
+        else
+            return NULL;
+    } else {
+        if (head + size < tail)
+            pos = head;
+        else
+            return NULL;
+    }
+    r->reserve_pos = pos;
+    r->reserve_len = len;
+    return r->buf + pos + sizeof(uint32_t);
 }
 
-static BOOL unicode_is_space_non_ascii(uint32_t c)
+JS_BOOL JS_CommitEvent(JSEventRing *r)
 {
-    return (c == 0x00A0 ||
-            c == 0x1680 ||
-            (c >= 0x2000 && c <= 0x200A) ||
-            (c >= 0x2028 && c <= 0x2029) ||
-            c == 0x202F ||
-            c == 0x205F ||
-            c == 0x3000 ||
-            c == 0xFEFF);
+    uint32_t head, tail, pos, new_head;
+
+    head = r->head;
+    pos = r->reserve_pos;
+    *(uint32_t *)(r->buf + pos) = r->reserve_len;
+    if (r->reserve_reset) {
+        /* the new event may overwrite a marker at 'head' and may end
+           at 'head', so the jump is told outside of the buffer */
+        __atomic_store_n(&r->reset_pos, head, __ATOMIC_RELEASE);
+    } else if (pos != head) {
+        *(uint32_t *)(r->buf + head) = JS_EVENT_WRAP;
+    }
+    new_head = pos + js_event_size(r->reserve_len);
+    if (new_head == r->size)
+        new_head = 0;
+    /* seq_cst so that the tail is read after the head is published:
+       either the consumer sees the new head before waiting or we see
+       that it emptied the ring and must wake it up */
+    __atomic_store_n(&r->head, new_head, __ATOMIC_SEQ_CST);
+    tail = __atomic_load_n(&r->tail, __ATOMIC_SEQ_CST);
+    return (head == tail);
 }
 
-static force_inline BOOL unicode_is_space(uint32_t c)
+int JS_PostEvent(JSEventRing *r, const void *data, size_t len)
 {
-    if (likely(c < 128)) {
-        return unicode_is_space_ascii(c);
-    } else {
-        return unicode_is_space_non_ascii(c);
-    }
+    uint8_t *ptr;
+    ptr = JS_ReserveEvent(r, len);
+    if (!ptr)
+        return -1;
+    memcpy(ptr, data, len);
+    return JS_CommitEvent(r);
 }
 
-JSValue js_string_trim(JSContext *ctx, JSValue *this_val,
-                       int argc, JSValue *argv, int magic)
+/* consumer: return the oldest event or NULL if none */
+static const uint8_t *js_event_peek(JSEventRing *r, uint32_t *plen)
 {
-    int a, b, len;
+    uint32_t head, tail, len;
 
-    *this_val = JS_ToStringCheckObject(ctx, *this_val);
-    if (JS_IsException(*this_val))
-        return *this_val;
-    len = js_string_len(ctx, *this_val);
-    a = 0;
-    b = len;
-    if (magic & 1) {
-        while (a < len && unicode_is_space(string_getc(ctx, *this_val, a)))
-            a++;
+    tail = r->tail;
+    head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    if (tail == __atomic_load_n(&r->reset_pos, __ATOMIC_ACQUIRE)) {
+        /* restarted ring. The tail is stored first so that the
+           producer sees the jump once 'reset_pos' is cleared. */
+        tail = 0;
+        __atomic_store_n(&r->tail, tail, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&r->reset_pos, JS_EVENT_WRAP, __ATOMIC_RELEASE);
+        *plen = *(uint32_t *)r->buf;
+        return r->buf + sizeof(uint32_t);
     }
-    if (magic & 2) {
-        while (b > a && unicode_is_space(string_getc(ctx, *this_val, b - 1)))
-            b--;
+    if (tail == head)
+        return NULL;
+    len = *(uint32_t *)(r->buf + tail);
+    if (len == JS_EVENT_WRAP) {
+        tail = 0;
+        __atomic_store_n(&r->tail, tail, __ATOMIC_SEQ_CST);
+        if (tail == head)
+            return NULL;
+        len = *(uint32_t *)r->buf;
     }
-    return js_sub_string(ctx, *this_val, a, b);
+    *plen = len;
+    return r->buf + tail + sizeof(uint32_t);
 }
 
-JSValue js_string_toString(JSContext *ctx, JSValue *this_val,
-                           int argc, JSValue *argv)
+/* consumer: free the event returned by js_event_peek() */
+static void js_event_consume(JSEventRing *r, uint32_t len)
 {
-    if (!JS_IsString(ctx, *this_val))
-        return JS_ThrowTypeError(ctx, "not a string");
-    return *this_val;
+    uint32_t tail;
+    tail = r->tail + js_event_size(len);
+    if (tail == r->size)
+        tail = 0;
+    /* pairs with JS_CommitEvent() */
+    __atomic_store_n(&r->tail, tail, __ATOMIC_SEQ_CST);
 }
 
-JSValue js_string_repeat(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv)
+JS_BOOL JS_IsJobPending(JSContext *ctx)
 {
-    StringBuffer b_s, *b = &b_s;
-    JSStringCharBuf buf;
-    JSString *p;
-    int n;
-    int64_t len;
-    
-    if (!JS_IsString(ctx, *this_val))
-        return JS_ThrowTypeError(ctx, "not a string");
-    if (JS_ToInt32Sat(ctx, &n, argv[0]))
-        return -1;
-    p = get_string_ptr(ctx, &buf, *this_val);
-    if (n < 0 || (len = (int64_t)n * p->len) > JS_STRING_LEN_MAX)
-        return JS_ThrowRangeError(ctx, "invalid repeat count");
-    if (p->len == 0 || n == 1)
-        return *this_val;
-    if (string_buffer_push(ctx, b, len))
-        return JS_EXCEPTION;
-    while (n-- > 0) {
-        string_buffer_concat_str(ctx, b, *this_val);
+    JSEventRing *r;
+    if (ctx->job_first != JS_NULL)
+        return TRUE;
+    for(r = ctx->event_rings; r != NULL; r = r->link) {
+        if (__atomic_load_n(&r->head, __ATOMIC_SEQ_CST) != r->tail)
+            return TRUE;
     }
-    return string_buffer_pop(ctx, b);
+    return FALSE;
 }
 
-/**********************************************************************/
-
-JSValue js_object_constructor(JSContext *ctx, JSValue *this_val,
-                              int argc, JSValue *argv)
+int JS_RunPendingJobs(JSContext *ctx, int budget)
 {
-    /* XXX: incomplete */
-    argc &= ~FRAME_CF_CTOR;
-    if (argc <= 0) {
-        return JS_NewObject(ctx);
-    } else {
-        return argv[0];
+    JSEventRing *r;
+    JSValueArray *job;
+    JSValue last, ret;
+    JSGCRef last_ref;
+    const uint8_t *data;
+    uint32_t len;
+    int n, i, argc, res;
+    BOOL is_last;
+
+    n = 0;
+    /* the events are handled first so that the jobs they queue are
+       run by the same call */
+    for(r = ctx->event_rings; r != NULL; r = r->link) {
+        while (budget <= 0 || n < budget) {
+            data = js_event_peek(r, &len);
+            if (!data)
+                break;
+            res = r->handler(ctx, r->opaque, data, len);
+            js_event_consume(r, len);
+            n++;
+            if (res < 0)
+                return -1;
+        }
+    }
+
+    /* the jobs queued by the jobs are run by the next call */
+    last = ctx->job_last;
+    JS_PUSH_VALUE(ctx, last);
+    while (ctx->job_first != JS_NULL && (budget <= 0 || n < budget)) {
+        job = JS_VALUE_TO_PTR(ctx->job_first);
+        /* the job is still referenced by the queue during the GC */
+        if (JS_StackCheck(ctx, job->size))
+            goto exception;
+        job = JS_VALUE_TO_PTR(ctx->job_first);
+        is_last = (ctx->job_first == last_ref.val);
+        argc = job->size - JS_JOB_ARGS;
+        for(i = argc - 1; i >= 0; i--)
+            JS_PushArg(ctx, job->arr[JS_JOB_ARGS + i]);
+        JS_PushArg(ctx, job->arr[JS_JOB_FUNC]);
+        JS_PushArg(ctx, JS_NULL); /* this */
+        ctx->job_first = job->arr[JS_JOB_NEXT];
+        if (ctx->job_first == JS_NULL)
+            ctx->job_last = JS_NULL;
+        ret = JS_Call(ctx, argc);
+        n++;
+        if (JS_IsException(ret))
+            goto exception;
+        if (is_last)
+            break;
     }
+    JS_POP_VALUE(ctx, last);
+    return n;
+ exception:
+    JS_POP_VALUE(ctx, last);
+    return -1;
 }
 
-JSValue js_object_defineProperty(JSContext *ctx, JSValue *this_val,
-                                 int argc, JSValue *argv)
+/**********************************************************************/
+/* runtime */
+
+JSValue js_function_constructor(JSContext *ctx, JSValue *this_val,
+                                int argc, JSValue *argv)
 {
-    JSValue *pobj, *pprop, *pdesc;
-    JSValue val, getter, setter;
-    JSGCRef val_ref, getter_ref;
-    int flags;
+    StringBuffer b_s, *b = &b_s;
+    JSValue val;
+    int i, n;
     
-    pobj = &argv[0];
-    pprop = &argv[1];
-    pdesc = &argv[2];
-
-    if (!JS_IsObject(ctx, *pobj))
-        return JS_ThrowTypeErrorNotAnObject(ctx);
-    *pprop = JS_ToPropertyKey(ctx, *pprop);
-    if (JS_IsException(*pprop))
-        return JS_EXCEPTION;
-    val = JS_UNDEFINED;
-    getter = JS_UNDEFINED;
-    setter = JS_UNDEFINED;
-    flags = 0;
-    if (JS_HasProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_value))) {
-        flags |= JS_DEF_PROP_HAS_VALUE;
-        val = JS_GetProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_value));
-        if (JS_IsException(val))
-            return JS_EXCEPTION;
-    }
-    if (JS_HasProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_get))) {
-        flags |= JS_DEF_PROP_HAS_GET;
-        JS_PUSH_VALUE(ctx, val);
-        getter = JS_GetProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_get));
-        JS_POP_VALUE(ctx, val);
-        if (JS_IsException(getter))
-            return JS_EXCEPTION;
-        if (!JS_IsUndefined(getter) && !JS_IsFunction(ctx, getter))
-            goto bad_getset;
-    }
-    if (JS_HasProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_set))) {
-        flags |= JS_DEF_PROP_HAS_SET;
-        JS_PUSH_VALUE(ctx, val);
-        JS_PUSH_VALUE(ctx, getter);
-        setter = JS_GetProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_set));
-        JS_POP_VALUE(ctx, getter);
-        JS_POP_VALUE(ctx, val);
-        if (JS_IsException(setter))
-            return JS_EXCEPTION;
-        if (!JS_IsUndefined(setter) && !JS_IsFunction(ctx, setter)) {
-        bad_getset:
-            return JS_ThrowTypeError(ctx, "invalid getter or setter");
+    argc &= ~FRAME_CF_CTOR;
+    string_buffer_push(ctx, b, 0);
+    string_buffer_puts(ctx, b, "(function anonymous(");
+    n = argc - 1;
+    for(i = 0; i < n; i++) {
+        if (i != 0) {
+            string_buffer_putc(ctx, b, ',');
         }
+        if (string_buffer_concat(ctx, b, argv[i]))
+            goto done;
     }
-    if (flags & (JS_DEF_PROP_HAS_GET | JS_DEF_PROP_HAS_SET)) {
-        if (flags & JS_DEF_PROP_HAS_VALUE)
-            return JS_ThrowTypeError(ctx, "cannot have both value and get/set");
-        val = getter;
+    string_buffer_puts(ctx, b, "\n) {\n");
+    if (n >= 0) {
+        if (string_buffer_concat(ctx, b, argv[n]))
+            goto done;
     }
-    val = JS_DefinePropertyInternal(ctx, *pobj, *pprop, val, setter,
-                                    flags | JS_DEF_PROP_LOOKUP);
+    string_buffer_puts(ctx, b, "\n})");
+ done:
+    val = string_buffer_pop(ctx, b);
     if (JS_IsException(val))
         return val;
-    return *pobj;
+    val = JS_Parse2(ctx, val, NULL, 0, "<input>", JS_EVAL_RETVAL);
+    if (JS_IsException(val))
+        return val;
+    return JS_Run(ctx, val);
 }
 
-JSValue js_object_getPrototypeOf(JSContext *ctx, JSValue *this_val,
-                                 int argc, JSValue *argv)
+JSValue js_function_get_prototype(JSContext *ctx, JSValue *this_val,
+                                  int argc, JSValue *argv)
 {
-    JSObject *p;
-    if (!JS_IsObject(ctx, argv[0]))
-        return JS_ThrowTypeErrorNotAnObject(ctx);
-    p = JS_VALUE_TO_PTR(argv[0]);
-    return p->proto;
+    JSValue obj;
+    JSGCRef obj_ref;
+    
+    if (!JS_IsPtr(*this_val)) {
+        if (JS_VALUE_GET_SPECIAL_TAG(*this_val) != JS_TAG_SHORT_FUNC)
+            goto fail;
+        return JS_UNDEFINED;
+    } else {
+        JSObject *p = JS_VALUE_TO_PTR(*this_val);
+        if (p->mtag != JS_MTAG_OBJECT)
+            goto fail;
+        if (p->class_id == JS_CLASS_CLOSURE) {
+            obj = JS_NewObject(ctx);
+            if (JS_IsException(obj))
+                return obj;
+        } else if (p->class_id == JS_CLASS_C_FUNCTION) {
+            /* for C constructors, the prototype property is already present */
+            return JS_UNDEFINED;
+        } else {
+        fail:
+            return JS_ThrowTypeError(ctx, "not a function");
+        }
+        JS_PUSH_VALUE(ctx, obj);
+        JS_DefinePropertyValue(ctx, obj, js_get_atom(ctx, JS_ATOM_constructor),
+                               *this_val);
+        JS_POP_VALUE(ctx, obj);
+        JS_PUSH_VALUE(ctx, obj);
+        JS_DefinePropertyValue(ctx, *this_val, js_get_atom(ctx, JS_ATOM_prototype),
+                               obj);
+        JS_POP_VALUE(ctx, obj);
+    }
+    return obj;
 }
 
-/* 'obj' must be an object. 'proto' must be JS_NULL or an object */
-static JSValue js_set_prototype_internal(JSContext *ctx, JSValue obj, JSValue proto)
+JSValue js_function_set_prototype(JSContext *ctx, JSValue *this_val,
+                                  int argc, JSValue *argv)
 {
-    JSObject *p, *p1;
+    if (!JS_IsFunctionObject(ctx, *this_val))
+        return JS_ThrowTypeError(ctx, "not a function");
 
-    p = JS_VALUE_TO_PTR(obj);
-    if (p->proto != proto) {
-        if (proto != JS_NULL) {
-            /* check if there is a cycle */
-            p1 = JS_VALUE_TO_PTR(proto);
-            for(;;) {
-                if (p1 == p)
-                    return JS_ThrowTypeError(ctx, "circular prototype chain");
-                if (p1->proto == JS_NULL)
-                    break;
-                p1 = JS_VALUE_TO_PTR(p1->proto);
-            }
-        }
-        
-        p->proto = proto;
-    }
+    JS_DefinePropertyValue(ctx, *this_val, js_get_atom(ctx, JS_ATOM_prototype),
+                           argv[0]);
     return JS_UNDEFINED;
 }
 
-JSValue js_object_setPrototypeOf(JSContext *ctx, JSValue *this_val,
-                                 int argc, JSValue *argv)
+JSValue js_function_get_length_name(JSContext *ctx, JSValue *this_val,
+                                    int argc, JSValue *argv, int is_name)
 {
-    JSValue proto;
-    
-    if (!JS_IsObject(ctx, argv[0]))
-        return JS_ThrowTypeErrorNotAnObject(ctx);
-    proto = argv[1];
-    if (proto != JS_NULL && !JS_IsObject(ctx, proto))
-        return JS_ThrowTypeError(ctx, "not a prototype");
-    if (JS_IsException(js_set_prototype_internal(ctx, argv[0], proto)))
-        return JS_EXCEPTION;
-    return argv[0];
+    JSFunctionBytecode *b;
+    JSValue ret = js_function_get_length_name1(ctx, this_val, is_name, &b);
+    if (JS_IsNull(ret))
+        return JS_ThrowTypeError(ctx, "not a function");
+    return ret;
 }
 
-JSValue js_object_create(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv)
+JSValue js_function_toString(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv)
 {
-    JSValue proto;
-    proto = argv[0];
-    if (proto != JS_NULL && !JS_IsObject(ctx, proto))
-        return JS_ThrowTypeError(ctx, "not a prototype");
-    if (argc >= 2)
-        return JS_ThrowTypeError(ctx, "unsupported additional properties");
-    return JS_NewObjectProtoClass(ctx, proto, JS_CLASS_OBJECT, 0);
-}
+    JSValue str, val;
+    JSGCRef str_ref;
 
-JSValue js_object_keys(JSContext *ctx, JSValue *this_val,
-                       int argc, JSValue *argv)
-{
-    JSObject *p, *pret;
-    JSValue ret, str;
-    JSValueArray *arr, *ret_arr;
-    int array_len, prop_count, hash_mask, alloc_size, i, j, pos;
+    str = js_function_get_length_name(ctx, this_val, 0, NULL, 1);
+    if (JS_IsException(str))
+        return str;
+    JS_PUSH_VALUE(ctx, str);
+    val = JS_NewString(ctx, "function ");
+    JS_POP_VALUE(ctx, str);
+    str = JS_ConcatString(ctx, val, str);
+    JS_PUSH_VALUE(ctx, str);
+    val = JS_NewString(ctx, "() {\n    [native code]\n}");
+    JS_POP_VALUE(ctx, str);
+    return JS_ConcatString(ctx, str, val);
+}
+
+JSValue js_function_call(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv)
+{
+    int i;
+    argc = max_int(argc, 1);
+    if (JS_StackCheck(ctx, argc + 1))
+        return JS_EXCEPTION;
+    for(i = 0; i < argc - 1; i++)
+        JS_PushArg(ctx, argv[argc - 1 - i]);
+    JS_PushArg(ctx, *this_val);
+    JS_PushArg(ctx, argv[0]);
+    /* we avoid recursing on the C stack */
+    return JS_NewTailCall(argc - 1);
+}
+
+JSValue js_function_apply(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv)
+{
+    JSValueArray *arr;
+    JSObject *p;
+    int len, i;
+    p = js_get_object_class(ctx, argv[1], JS_CLASS_ARRAY);
+    if (!p)
+        return JS_ThrowTypeError(ctx, "not an array");
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    len = p->u.array.len;
+    if (JS_StackCheck(ctx, len + 2))
+        return JS_EXCEPTION;
+    p = JS_VALUE_TO_PTR(argv[1]);
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    for(i = 0; i < len; i++)
+        JS_PushArg(ctx, arr->arr[len - 1 - i]);
+    JS_PushArg(ctx, *this_val);
+    JS_PushArg(ctx, argv[0]);
+    /* we avoid recursing on the C stack */
+    return JS_NewTailCall(len);
+}
+
+JSValue js_function_bind(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv)
+{
+    int arg_count;
+    JSValueArray *arr;
+    int i;
+    
+    arg_count = max_int(argc - 1, 0);
+    arr = js_alloc_value_array(ctx, 0, 2 + arg_count);
+    if (!arr)
+        return JS_EXCEPTION;
+    /* arr[0] = func, arr[1] = this */
+    arr->arr[0] = *this_val;
+    for(i = 0; i < arg_count + 1; i++)
+        arr->arr[1 + i] = argv[i];
+    return JS_NewCFunctionParams(ctx, JS_CFUNCTION_bound, JS_VALUE_FROM_PTR(arr));
+}
+
+/* XXX: handle constructor case */
+JSValue js_function_bound(JSContext *ctx, JSValue *this_val,
+                          int argc, JSValue *argv, JSValue params)
+{
+    JSValueArray *arr;
+    JSGCRef params_ref;
+    int i, err, size;
+    
+    arr = JS_VALUE_TO_PTR(params);
+    size = arr->size;
+    JS_PUSH_VALUE(ctx, params);
+    err = JS_StackCheck(ctx, size + argc);
+    JS_POP_VALUE(ctx, params);
+    if (err)
+        return JS_EXCEPTION;
+    arr = JS_VALUE_TO_PTR(params);
+    for(i = argc - 1; i >= 0; i--)
+        JS_PushArg(ctx, argv[i]);
+    for(i = size - 1; i >= 2; i--) {
+        JS_PushArg(ctx, arr->arr[i]);
+    }
+    JS_PushArg(ctx, arr->arr[0]); /* func */
+    JS_PushArg(ctx, arr->arr[1]); /* this_val */
+    /* we avoid recursing on the C stack */
+    return JS_NewTailCall(size - 2 + argc);
+}
+
+/**********************************************************************/
+
+JSValue js_number_constructor(JSContext *ctx, JSValue *this_val,
+                              int argc, JSValue *argv)
+{
+    double d;
+    if (argc & FRAME_CF_CTOR)
+        return JS_ThrowTypeError(ctx, "number constructor not supported");
+    if (argc == 0) {
+        return JS_NewShortInt(0);
+    } else {
+        if (JS_ToNumber(ctx, &d, argv[0]))
+            return JS_EXCEPTION;
+        return JS_NewFloat64(ctx, d);
+    }
+}
+
+static int js_thisNumberValue(JSContext *ctx, double *pres, JSValue val)
+{
+    if (!JS_IsNumber(ctx, val)) {
+        JS_ThrowTypeError(ctx, "not a number");
+        return -1;
+    }
+    return JS_ToNumber(ctx, pres, val);
+}
+
+JSValue js_number_toString(JSContext *ctx, JSValue *this_val,
+                           int argc, JSValue *argv)
+{
+    int radix, flags;
+    double d;
+    
+    if (js_thisNumberValue(ctx, &d, *this_val))
+        return JS_EXCEPTION;
+    if (JS_IsUndefined(argv[0])) {
+        radix = 10;
+    } else {
+        if (JS_ToInt32Sat(ctx, &radix, argv[0]))
+            return JS_EXCEPTION;
+        if (radix < 2 || radix > 36)
+            return JS_ThrowRangeError(ctx, "radix must be between 2 and 36");
+    }
+    /* cannot fail */
+    flags = JS_DTOA_FORMAT_FREE;
+    if (radix != 10)
+        flags |=  JS_DTOA_EXP_DISABLED;
+    return js_dtoa2(ctx, d, radix, 0, flags);
+}
+
+JSValue js_number_toFixed(JSContext *ctx, JSValue *this_val,
+                          int argc, JSValue *argv)
+{
+    int f, flags;
+    double d;
+
+    if (js_thisNumberValue(ctx, &d, *this_val))
+        return JS_EXCEPTION;
+    if (JS_ToInt32Sat(ctx, &f, argv[0]))
+        return JS_EXCEPTION;
+    if (f < 0 || f > 100)
+        return JS_ThrowRangeError(ctx, "invalid number of digits");
+    if (fabs(d) >= 1e21) {
+        flags = JS_DTOA_FORMAT_FREE;
+    } else {
+        flags = JS_DTOA_FORMAT_FRAC;
+    }
+    return js_dtoa2(ctx, d, 10, f, flags);
+}
+
+JSValue js_number_toExponential(JSContext *ctx, JSValue *this_val,
+                                int argc, JSValue *argv)
+{
+    int f, flags;
+    double d;
+
+    if (js_thisNumberValue(ctx, &d, *this_val))
+        return JS_EXCEPTION;
+    if (JS_ToInt32Sat(ctx, &f, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_IsUndefined(argv[0]) || !isfinite(d)) {
+        f = 0;
+        flags = JS_DTOA_FORMAT_FREE;
+    } else {
+        if (f < 0 || f > 100)
+            return JS_ThrowRangeError(ctx, "invalid number of digits");
+        f++;
+        flags = JS_DTOA_FORMAT_FIXED;
+    }
+    return js_dtoa2(ctx, d, 10, f, flags | JS_DTOA_EXP_ENABLED);
+}
+
+JSValue js_number_toPrecision(JSContext *ctx, JSValue *this_val,
+                              int argc, JSValue *argv)
+{
+    int p, flags;
+    double d;
+
+    if (js_thisNumberValue(ctx, &d, *this_val))
+        return JS_EXCEPTION;
+    if (JS_IsUndefined(argv[0])) {
+        flags = JS_DTOA_FORMAT_FREE;
+        p = 0;
+    } else {
+        if (JS_ToInt32Sat(ctx, &p, argv[0]))
+            return JS_EXCEPTION;
+        if (!isfinite(d)) {
+            flags = JS_DTOA_FORMAT_FREE;
+        } else {
+            if (p < 1 || p > 100)
+                return JS_ThrowRangeError(ctx, "invalid number of digits");
+            flags = JS_DTOA_FORMAT_FIXED;
+        }
+    }
+    return js_dtoa2(ctx, d, 10, p, flags);
+}
+
+JSValue js_number_parseInt(JSContext *ctx, JSValue *this_val,
+                           int argc, JSValue *argv)
+{
+    int radix;
+    double d;
+    
+    argv[0] = JS_ToString(ctx, argv[0]);
+    if (JS_IsException(argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &radix, argv[1]))
+        return JS_EXCEPTION;
+    if (radix != 0 && (radix < 2 || radix > 36)) {
+        d = NAN;
+    } else {
+        if (js_atod1(ctx, &d, argv[0], radix, JS_ATOD_INT_ONLY))
+            return JS_EXCEPTION;
+    }
+    return JS_NewFloat64(ctx, d);
+}
+
+JSValue js_number_parseFloat(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv)
+{
+    double d;
+    
+    argv[0] = JS_ToString(ctx, argv[0]);
+    if (JS_IsException(argv[0]))
+        return JS_EXCEPTION;
+    if (js_atod1(ctx, &d, argv[0], 10, 0))
+        return JS_EXCEPTION;
+    return JS_NewFloat64(ctx, d);
+}
+
+/**********************************************************************/
+
+JSValue js_boolean_constructor(JSContext *ctx, JSValue *this_val,
+                               int argc, JSValue *argv)
+{
+    if (argc & FRAME_CF_CTOR)
+        return JS_ThrowTypeError(ctx, "Boolean constructor not supported");
+    return JS_NewBool(JS_ToBool(ctx, argv[0]));
+}
+
+/**********************************************************************/
+
+JSValue js_string_get_length(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv)
+{
+    int len;
+    
+    if (!JS_IsString(ctx, *this_val))
+        return JS_ThrowTypeError(ctx, "not a string");
+    len = js_string_len(ctx, *this_val);
+    return JS_NewShortInt(len);
+}
+
+JSValue js_string_set_length(JSContext *ctx, JSValue *this_val,
+                            int argc, JSValue *argv)
+{
+    return JS_UNDEFINED; /* ignored */
+}
+
+JSValue js_string_slice(JSContext *ctx, JSValue *this_val,
+                        int argc, JSValue *argv)
+{
+    int len, start, end;
+    
+    *this_val = JS_ToStringCheckObject(ctx, *this_val);
+    if (JS_IsException(*this_val))
+        return JS_EXCEPTION;
+    len = js_string_len(ctx, *this_val);
+    if (JS_ToInt32Clamp(ctx, &start, argv[0], 0, len, len))
+        return JS_EXCEPTION;
+    end = len;
+    if (!JS_IsUndefined(argv[1])) {
+        if (JS_ToInt32Clamp(ctx, &end, argv[1], 0, len, len))
+            return JS_EXCEPTION;
+    }
+    return js_sub_string(ctx, *this_val, start, max_int(end, start));
+}
+
+JSValue js_string_substring(JSContext *ctx, JSValue *this_val,
+                            int argc, JSValue *argv)
+{
+    int a, b, start, end, len;
+
+    *this_val = JS_ToStringCheckObject(ctx, *this_val);
+    if (JS_IsException(*this_val))
+        return JS_EXCEPTION;
+    len = js_string_len(ctx, *this_val);
+    if (JS_ToInt32Clamp(ctx, &a, argv[0], 0, len, 0))
+        return JS_EXCEPTION;
+    b = len;
+    if (!JS_IsUndefined(argv[1])) {
+        if (JS_ToInt32Clamp(ctx, &b, argv[1], 0, len, 0))
+            return JS_EXCEPTION;
+    }
+    if (a < b) {
+        start = a;
+        end = b;
+    } else {
+        start = b;
+        end = a;
+    }
+    return js_sub_string(ctx, *this_val, start, end);
+}
+
+JSValue js_string_charAt(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv, int magic)
+{
+    JSValue ret;
+    int idx, c;
+    
+    *this_val = JS_ToStringCheckObject(ctx, *this_val);
+    if (JS_IsException(*this_val))
+        return JS_EXCEPTION;
+    if (JS_ToInt32Sat(ctx, &idx, argv[0]))
+        return JS_EXCEPTION;
+    if (idx < 0)
+        goto ret_undef;
+    c = string_getcp(ctx, *this_val, idx, (magic == magic_codePointAt));
+    if (c == -1) {
+    ret_undef:
+        if (magic == magic_charCodeAt)
+            ret = JS_NewFloat64(ctx, NAN);
+        else if (magic == magic_charAt)
+            ret = js_get_atom(ctx, JS_ATOM_empty);
+        else
+            ret = JS_UNDEFINED;
+    } else {
+        if (magic == magic_charCodeAt || magic == magic_codePointAt)
+            ret = JS_NewShortInt(c);
+        else
+            ret = JS_NewStringChar(c);
+    }
+    //    dump_string_pos_cache(ctx);    
+    return ret;
+}
+
+JSValue js_string_constructor(JSContext *ctx, JSValue *this_val,
+                              int argc, JSValue *argv)
+{
+    if (argc & FRAME_CF_CTOR)
+        return JS_ThrowTypeError(ctx, "string constructor not supported");
+    if (argc <= 0) {
+        return js_get_atom(ctx, JS_ATOM_empty);
+    } else {
+        return JS_ToString(ctx, argv[0]);
+    }
+}
+
+JSValue js_string_fromCharCode(JSContext *ctx, JSValue *this_val,
+                               int argc, JSValue *argv, int is_fromCodePoint)
+{
+    int i;
+    StringBuffer b_s, *b = &b_s;
+
+    string_buffer_push(ctx, b, 0);
+    for(i = 0; i < argc; i++) {
+        int c;
+        if (JS_ToInt32(ctx, &c, argv[i]))
+            return JS_EXCEPTION;
+        if (is_fromCodePoint) {
+            if (c < 0 || c > 0x10ffff)
+                return JS_ThrowRangeError(ctx, "invalid code point");
+        } else {
+            c &= 0xffff;
+        }
+        if (string_buffer_putc(ctx, b, c))
+            break;
+    }
+    return string_buffer_pop(ctx, b);
+}
+
+JSValue js_string_concat(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv)
+{
+    int i;
+    StringBuffer b_s, *b = &b_s;
+    JSValue r;
+    
+    r = JS_ToStringCheckObject(ctx, *this_val);
+    if (JS_IsException(r))
+        return JS_EXCEPTION;
+    string_buffer_push(ctx, b, 0);
+    if (string_buffer_concat(ctx, b, r))
+        goto done;
+
+    for (i = 0; i < argc; i++) {
+        if (string_buffer_concat(ctx, b, argv[i]))
+            goto done;
+    }
+ done:
+    return string_buffer_pop(ctx, b);
+}
+
+JSValue js_string_indexOf(JSContext *ctx, JSValue *this_val,
+                          int argc, JSValue *argv, int lastIndexOf)
+{
+    int i, len, v_len, pos, start, stop, ret, inc, j;
+
+    *this_val = JS_ToStringCheckObject(ctx, *this_val);
+    if (JS_IsException(*this_val))
+        return JS_EXCEPTION;
+    argv[0] = JS_ToString(ctx, argv[0]);
+    if (JS_IsException(argv[0]))
+        return JS_EXCEPTION;
+    len = js_string_len(ctx, *this_val);
+    v_len = js_string_len(ctx, argv[0]);
+    if (lastIndexOf) {
+        pos = len - v_len;
+        if (argc > 1) {
+            double d;
+            if (JS_ToNumber(ctx, &d, argv[1]))
+                goto fail;
+            if (!isnan(d)) {
+                if (d <= 0)
+                    pos = 0;
+                else if (d < pos)
+                    pos = d;
+            }
+        }
+        start = pos;
+        stop = 0;
+        inc = -1;
+    } else {
+        pos = 0;
+        if (argc > 1) {
+            if (JS_ToInt32Clamp(ctx, &pos, argv[1], 0, len, 0))
+                goto fail;
+        }
+        start = pos;
+        stop = len - v_len;
+        inc = 1;
+    }
+    ret = -1;
+    if (len >= v_len && inc * (stop - start) >= 0) {
+        for (i = start;; i += inc) {
+            for(j = 0; j < v_len; j++) {
+                if (string_getc(ctx, *this_val, i + j) != string_getc(ctx, argv[0], j)) {
+                    goto next;
+                }
+            }
+            ret = i;
+            break;
+        next:
+            if (i == stop)
+                break;
+        }
+    }
+    return JS_NewShortInt(ret);
+
+fail:
+    return JS_EXCEPTION;
+}
+
+static int js_string_indexof(JSContext *ctx, JSValue str, JSValue needle,
+                             int start, int str_len, int needle_len)
+{
+    int i, j;
+    for(i = start; i <= str_len - needle_len; i++) {
+        for(j = 0; j < needle_len; j++) {
+            if (string_getc(ctx, str, i + j) !=
+                string_getc(ctx, needle, j)) {
+                goto next;
+            }
+            
+        }
+        return i;
+    next: ;
+    }
+    return -1;
+}
+
+/* Note: ascii only */
+JSValue js_string_toLowerCase(JSContext *ctx, JSValue *this_val,
+                              int argc, JSValue *argv, int to_lower)
+{
+    StringBuffer b_s, *b = &b_s;
+    int i, c, len;
+
+    *this_val = JS_ToStringCheckObject(ctx, *this_val);
+    if (JS_IsException(*this_val))
+        return *this_val;
+    len = js_string_len(ctx, *this_val);
+    string_buffer_push(ctx, b, len);
+    for(i = 0; i < len; i++) {
+        c = string_getc(ctx, *this_val, i);
+        if (to_lower) {
+            if (c >= 'A' && c <= 'Z')
+                c += 'a' - 'A';
+        } else {
+            if (c >= 'a' && c <= 'z')
+                c += 'A' - 'a';
+        }
+        string_buffer_putc(ctx, b, c);
+    }
+    return string_buffer_pop(ctx, b);
+}
+
+/* c < 128 */
+static force_inline BOOL unicode_is_space_ascii(uint32_t c)
+{
+    return (c >= 0x0009 && c <= 0x000D) || (c == 0x0020);
+}
+
+static BOOL unicode_is_space_non_ascii(uint32_t c)
+{
+    return (c == 0x00A0 ||
+            c == 0x1680 ||
+            (c >= 0x2000 && c <= 0x200A) ||
+            (c >= 0x2028 && c <= 0x2029) ||
+            c == 0x202F ||
+            c == 0x205F ||
+            c == 0x3000 ||
+            c == 0xFEFF);
+}
+
+static force_inline BOOL unicode_is_space(uint32_t c)
+{
+    if (likely(c < 128)) {
+        return unicode_is_space_ascii(c);
+    } else {
+        return unicode_is_space_non_ascii(c);
+    }
+}
+
+JSValue js_string_trim(JSContext *ctx, JSValue *this_val,
+                       int argc, JSValue *argv, int magic)
+{
+    int a, b, len;
+
+    *this_val = JS_ToStringCheckObject(ctx, *this_val);
+    if (JS_IsException(*this_val))
+        return *this_val;
+    len = js_string_len(ctx, *this_val);
+    a = 0;
+    b = len;
+    if (magic & 1) {
+        while (a < len && unicode_is_space(string_getc(ctx, *this_val, a)))
+            a++;
+    }
+    if (magic & 2) {
+        while (b > a && unicode_is_space(string_getc(ctx, *this_val, b - 1)))
+            b--;
+    }
+    return js_sub_string(ctx, *this_val, a, b);
+}
+
+JSValue js_string_toString(JSContext *ctx, JSValue *this_val,
+                           int argc, JSValue *argv)
+{
+    if (!JS_IsString(ctx, *this_val))
+        return JS_ThrowTypeError(ctx, "not a string");
+    return *this_val;
+}
+
+JSValue js_string_repeat(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv)
+{
+    StringBuffer b_s, *b = &b_s;
+    JSStringCharBuf buf;
+    JSString *p;
+    int n;
+    int64_t len;
+    
+    if (!JS_IsString(ctx, *this_val))
+        return JS_ThrowTypeError(ctx, "not a string");
+    if (JS_ToInt32Sat(ctx, &n, argv[0]))
+        return -1;
+    p = get_string_ptr(ctx, &buf, *this_val);
+    if (n < 0 || (len = (int64_t)n * p->len) > JS_STRING_LEN_MAX)
+        return JS_ThrowRangeError(ctx, "invalid repeat count");
+    if (p->len == 0 || n == 1)
+        return *this_val;
+    if (string_buffer_push(ctx, b, len))
+        return JS_EXCEPTION;
+    while (n-- > 0) {
+        string_buffer_concat_str(ctx, b, *this_val);
+    }
+    return string_buffer_pop(ctx, b);
+}
+
+/**********************************************************************/
+
+JSValue js_object_constructor(JSContext *ctx, JSValue *this_val,
+                              int argc, JSValue *argv)
+{
+    /* XXX: incomplete */
+    argc &= ~FRAME_CF_CTOR;
+    if (argc <= 0) {
+        return JS_NewObject(ctx);
+    } else {
+        return argv[0];
+    }
+}
+
+JSValue js_object_defineProperty(JSContext *ctx, JSValue *this_val,
+                                 int argc, JSValue *argv)
+{
+    JSValue *pobj, *pprop, *pdesc;
+    JSValue val, getter, setter;
+    JSGCRef val_ref, getter_ref;
+    int flags;
+    
+    pobj = &argv[0];
+    pprop = &argv[1];
+    pdesc = &argv[2];
+
+    if (!JS_IsObject(ctx, *pobj))
+        return JS_ThrowTypeErrorNotAnObject(ctx);
+    *pprop = JS_ToPropertyKey(ctx, *pprop);
+    if (JS_IsException(*pprop))
+        return JS_EXCEPTION;
+    val = JS_UNDEFINED;
+    getter = JS_UNDEFINED;
+    setter = JS_UNDEFINED;
+    flags = 0;
+    if (JS_HasProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_value))) {
+        flags |= JS_DEF_PROP_HAS_VALUE;
+        val = JS_GetProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_value));
+        if (JS_IsException(val))
+            return JS_EXCEPTION;
+    }
+    if (JS_HasProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_get))) {
+        flags |= JS_DEF_PROP_HAS_GET;
+        JS_PUSH_VALUE(ctx, val);
+        getter = JS_GetProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_get));
+        JS_POP_VALUE(ctx, val);
+        if (JS_IsException(getter))
+            return JS_EXCEPTION;
+        if (!JS_IsUndefined(getter) && !JS_IsFunction(ctx, getter))
+            goto bad_getset;
+    }
+    if (JS_HasProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_set))) {
+        flags |= JS_DEF_PROP_HAS_SET;
+        JS_PUSH_VALUE(ctx, val);
+        JS_PUSH_VALUE(ctx, getter);
+        setter = JS_GetProperty(ctx, *pdesc, js_get_atom(ctx, JS_ATOM_set));
+        JS_POP_VALUE(ctx, getter);
+        JS_POP_VALUE(ctx, val);
+        if (JS_IsException(setter))
+            return JS_EXCEPTION;
+        if (!JS_IsUndefined(setter) && !JS_IsFunction(ctx, setter)) {
+        bad_getset:
+            return JS_ThrowTypeError(ctx, "invalid getter or setter");
+        }
+    }
+    if (flags & (JS_DEF_PROP_HAS_GET | JS_DEF_PROP_HAS_SET)) {
+        if (flags & JS_DEF_PROP_HAS_VALUE)
+            return JS_ThrowTypeError(ctx, "cannot have both value and get/set");
+        val = getter;
+    }
+    val = JS_DefinePropertyInternal(ctx, *pobj, *pprop, val, setter,
+                                    flags | JS_DEF_PROP_LOOKUP);
+    if (JS_IsException(val))
+        return val;
+    return *pobj;
+}
+
+JSValue js_object_getPrototypeOf(JSContext *ctx, JSValue *this_val,
+                                 int argc, JSValue *argv)
+{
+    JSObject *p;
+    if (!JS_IsObject(ctx, argv[0]))
+        return JS_ThrowTypeErrorNotAnObject(ctx);
+    p = JS_VALUE_TO_PTR(argv[0]);
+    return p->proto;
+}
+
+/* 'obj' must be an object. 'proto' must be JS_NULL or an object */
+static JSValue js_set_prototype_internal(JSContext *ctx, JSValue obj, JSValue proto)
+{
+    JSObject *p, *p1;
+
+    p = JS_VALUE_TO_PTR(obj);
+    if (p->proto != proto) {
+        if (proto != JS_NULL) {
+            /* check if there is a cycle */
+            p1 = JS_VALUE_TO_PTR(proto);
+            for(;;) {
+                if (p1 == p)
+                    return JS_ThrowTypeError(ctx, "circular prototype chain");
+                if (p1->proto == JS_NULL)
+                    break;
+                p1 = JS_VALUE_TO_PTR(p1->proto);
+            }
+        }
+        
+        p->proto = proto;
+        js_write_barrier(ctx, p, proto);
+    }
+    return JS_UNDEFINED;
+}
+
+JSValue js_object_setPrototypeOf(JSContext *ctx, JSValue *this_val,
+                                 int argc, JSValue *argv)
+{
+    JSValue proto;
+    
+    if (!JS_IsObject(ctx, argv[0]))
+        return JS_ThrowTypeErrorNotAnObject(ctx);
+    proto = argv[1];
+    if (proto != JS_NULL && !JS_IsObject(ctx, proto))
+        return JS_ThrowTypeError(ctx, "not a prototype");
+    if (JS_IsException(js_set_prototype_internal(ctx, argv[0], proto)))
+        return JS_EXCEPTION;
+    return argv[0];
+}
+
+JSValue js_object_create(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv)
+{
+    JSValue proto;
+    proto = argv[0];
+    if (proto != JS_NULL && !JS_IsObject(ctx, proto))
+        return JS_ThrowTypeError(ctx, "not a prototype");
+    if (argc >= 2)
+        return JS_ThrowTypeError(ctx, "unsupported additional properties");
+    return JS_NewObjectProtoClass(ctx, proto, JS_CLASS_OBJECT, 0);
+}
+
+JSValue js_object_keys(JSContext *ctx, JSValue *this_val,
+                       int argc, JSValue *argv)
+{
+    JSObject *p, *pret;
+    JSValue ret, str;
+    JSValueArray *arr, *ret_arr;
+    int array_len, prop_count, hash_mask, alloc_size, i, j, pos;
     JSGCRef ret_ref;
 
-    if (!JS_IsObject(ctx, argv[0]))
-        return JS_ThrowTypeErrorNotAnObject(ctx);
-    p = JS_VALUE_TO_PTR(argv[0]);
+    if (!JS_IsObject(ctx, argv[0]))
+        return JS_ThrowTypeErrorNotAnObject(ctx);
+    p = JS_VALUE_TO_PTR(argv[0]);
+
+    if (p->class_id == JS_CLASS_ARRAY) {
+        array_len = p->u.array.len;
+    } else if (p->class_id >= JS_CLASS_UINT8C_ARRAY && p->class_id <= JS_CLASS_FLOAT64_ARRAY) {
+        array_len = p->u.typed_array.len;
+    } else {
+        array_len = 0;
+    }
+            
+    arr = get_prop_table(p);
+    prop_count = JS_VALUE_GET_INT(arr->arr[0]);
+    hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
+
+    alloc_size = array_len + prop_count;
+    
+    ret = JS_NewArray(ctx, alloc_size);
+    if (JS_IsException(ret))
+        return ret;
+
+    pos = 0;
+    for(i = 0; i < array_len; i++) {
+        JS_PUSH_VALUE(ctx, ret);
+        str = JS_ToString(ctx, JS_NewShortInt(i));
+        JS_POP_VALUE(ctx, ret);
+        if (JS_IsException(str))
+            return str;
+        pret = JS_VALUE_TO_PTR(ret);
+        ret_arr = JS_VALUE_TO_PTR(pret->u.array.tab);
+        ret_arr->arr[pos++] = str;
+        js_write_barrier(ctx, ret_arr, str);
+    }
+    
+    for(i = 0, j = 0; j < prop_count; i++) {
+        JSProperty *pr;
+        p = JS_VALUE_TO_PTR(argv[0]);
+        arr = get_prop_table(p);
+        pr = (JSProperty *)&arr->arr[2 + hash_mask + 1 + 3 * i];
+        /* exclude deleted properties */
+        if (pr->key != JS_UNINITIALIZED) {
+            JS_PUSH_VALUE(ctx, ret);
+            str = JS_ToString(ctx, pr->key);
+            JS_POP_VALUE(ctx, ret);
+            if (JS_IsException(str))
+                return str;
+            pret = JS_VALUE_TO_PTR(ret);
+            ret_arr = JS_VALUE_TO_PTR(pret->u.array.tab);
+            ret_arr->arr[pos++] = str;
+            js_write_barrier(ctx, ret_arr, str);
+            j++;
+        }
+    }
+    pret = JS_VALUE_TO_PTR(ret);
+    pret->u.array.len = pos;
+    return ret;
+}
+
+JSValue js_object_hasOwnProperty(JSContext *ctx, JSValue *this_val,
+                                 int argc, JSValue *argv)
+{
+    JSObject *p;
+    JSValue prop;
+    int array_len, idx;
+    
+    if (JS_IsNull(*this_val) || JS_IsUndefined(*this_val))
+        return JS_ThrowTypeError(ctx, "cannot convert to object");
+    if (!JS_IsObject(ctx, *this_val))
+        return JS_FALSE; /* XXX: could improve for strings */
+    prop = JS_ToPropertyKey(ctx, argv[0]);
+    p = JS_VALUE_TO_PTR(*this_val);
+    if (p->class_id == JS_CLASS_ARRAY) {
+        array_len = p->u.array.len;
+        goto check_array;
+    } else if (p->class_id >= JS_CLASS_UINT8C_ARRAY && p->class_id <= JS_CLASS_FLOAT64_ARRAY) {
+        array_len = p->u.typed_array.len;
+    check_array:
+        if (JS_IsInt(prop)) {
+            idx = JS_VALUE_GET_INT(prop);
+            return JS_NewBool((idx >= 0 && idx < array_len));
+        }
+    }
+    return JS_NewBool((find_own_property(ctx, p, prop) != NULL));
+}
+
+JSValue js_object_toString(JSContext *ctx, JSValue *this_val,
+                           int argc, JSValue *argv)
+{
+    const char *str;
+    char buf[64];
+    /* XXX: not fully compliant */
+    if (JS_IsIntOrShortFloat(*this_val)) {
+        goto number;
+    } else if (!JS_IsPtr(*this_val)) {
+        switch(JS_VALUE_GET_SPECIAL_TAG(*this_val)) {
+        case JS_TAG_NULL:
+            str = "Null";
+            break;
+        case JS_TAG_UNDEFINED:
+            str = "Undefined";
+            break;
+        case JS_TAG_SHORT_FUNC:
+            str = "Function";
+            break;
+        case JS_TAG_BOOL:
+            str = "Boolean";
+            break;
+        case JS_TAG_STRING_CHAR:
+            goto string;
+        default:
+            goto object;
+        }
+    } else {
+        JSObject *p = JS_VALUE_TO_PTR(*this_val);
+        switch(p->mtag) {
+        case JS_MTAG_OBJECT:
+            switch(p->class_id) {
+            case JS_CLASS_ARRAY:
+                str = "Array";
+                break;
+            case JS_CLASS_ERROR:
+                str = "Error";
+                break;
+            case JS_CLASS_CLOSURE:
+            case JS_CLASS_C_FUNCTION:
+                str = "Function";
+                break;
+            default:
+            object:
+                str = "Object";
+                break;
+            }
+            break;
+        case JS_MTAG_STRING:
+        string:
+            str = "String";
+            break;
+        case JS_MTAG_FLOAT64:
+        number:
+            str = "Number";
+            break;
+        default:
+            goto object;
+        }
+    }
+    js_snprintf(buf, sizeof(buf), "[object %s]", str);
+    return JS_NewString(ctx, buf);
+}
+
+/**********************************************************************/
+
+JSValue js_error_constructor(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv, int magic)
+{
+    JSValue obj, msg;
+    JSObject *p;
+    JSGCRef obj_ref;
+    
+    argc &= ~FRAME_CF_CTOR;
+
+    obj = JS_NewObjectProtoClass(ctx, ctx->class_proto[magic], JS_CLASS_ERROR,
+                                 sizeof(JSErrorData));
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_TO_PTR(obj);
+    p->u.error.message = JS_NULL;
+    p->u.error.stack = JS_NULL;
+    
+    if (!JS_IsUndefined(argv[0])) {
+        JS_PUSH_VALUE(ctx, obj);
+        msg = JS_ToString(ctx, argv[0]);
+        JS_POP_VALUE(ctx, obj);
+        if (JS_IsException(msg))
+            return msg;
+        p = JS_VALUE_TO_PTR(obj);
+        p->u.error.message = msg;
+        js_write_barrier(ctx, p, msg);
+    } else {
+        p = JS_VALUE_TO_PTR(obj);
+        p->u.error.message = js_get_atom(ctx, JS_ATOM_empty);
+    }
+    JS_PUSH_VALUE(ctx, obj);
+    build_backtrace(ctx, obj, NULL, 0, 0, 1);
+    JS_POP_VALUE(ctx, obj);
+    return obj;
+}
+
+JSValue js_error_toString(JSContext *ctx, JSValue *this_val,
+                          int argc, JSValue *argv)
+{
+    JSObject *p;
+    JSValue name;
+    StringBuffer b_s, *b = &b_s;
+
+    if (!JS_IsError(ctx, *this_val))
+        return JS_ThrowTypeError(ctx, "not an Error object");
+    name = JS_GetProperty(ctx, *this_val, js_get_atom(ctx, JS_ATOM_name));
+    if (JS_IsException(name))
+        return name;
+    if (JS_IsUndefined(name))
+        name = js_get_atom(ctx, JS_ATOM_Error);
+    else
+        name = JS_ToString(ctx, name);
+    if (JS_IsException(name))
+        return name;
+    string_buffer_push(ctx, b, 0);
+    string_buffer_concat(ctx, b, name);
+    p = JS_VALUE_TO_PTR(*this_val);
+    if (p->u.error.message != JS_NULL) {
+        string_buffer_puts(ctx, b, ": ");
+        p = JS_VALUE_TO_PTR(*this_val);
+        string_buffer_concat(ctx, b, p->u.error.message);
+    }
+    return string_buffer_pop(ctx, b);
+}
+
+JSValue js_error_get_message(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv, int magic)
+{
+    JSObject *p;
+    if (!JS_IsError(ctx, *this_val))
+        return JS_ThrowTypeError(ctx, "not an Error object");
+    p = JS_VALUE_TO_PTR(*this_val);
+    if (magic == 0)
+        return p->u.error.message;
+    else
+        return p->u.error.stack;
+}
+
+/**********************************************************************/
+
+static JSObject *js_get_array(JSContext *ctx, JSValue obj)
+{
+    JSObject *p;
+    p = js_get_object_class(ctx, obj, JS_CLASS_ARRAY);
+    if (!p) {
+        JS_ThrowTypeError(ctx, "not an array");
+        return NULL;
+    }
+    return p;
+}
+
+JSValue js_array_get_length(JSContext *ctx, JSValue *this_val,
+                            int argc, JSValue *argv)
+{
+    JSObject *p;
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    return JS_NewShortInt(p->u.array.len);
+}
+
+static int js_array_resize(JSContext *ctx, JSValue *this_val, int new_len)
+{
+    JSObject *p;
+    int i;
+
+    if (new_len < 0 || new_len > JS_SHORTINT_MAX) {
+        JS_ThrowTypeError(ctx, "invalid array length");
+        return -1;
+    }
+    p = JS_VALUE_TO_PTR(*this_val);
+    if (new_len < p->u.array.len) {
+        JSValueArray *arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        /* shrink the array if the new size is small enough */
+        if (new_len < (arr->size / 2) && arr->size >= 4) {
+            js_shrink_value_array(ctx, &p->u.array.tab, new_len);
+            p = JS_VALUE_TO_PTR(*this_val);
+        } else {
+            for(i = new_len; i < p->u.array.len; i++)
+                arr->arr[i] = JS_UNDEFINED;
+        }
+    } else if (new_len > p->u.array.len) {
+        JSValueArray *arr;
+        JSValue new_tab;
+        new_tab = js_resize_value_array(ctx, p->u.array.tab, new_len);
+        if (JS_IsException(new_tab))
+            return -1;
+        p = JS_VALUE_TO_PTR(*this_val);
+        p->u.array.tab = new_tab;
+        js_write_barrier(ctx, p, new_tab);
+        arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        for(i = p->u.array.len; i < new_len; i++)
+            arr->arr[i] = JS_UNDEFINED;
+    }
+    p->u.array.len = new_len;
+    return 0;
+}
+
+JSValue js_array_set_length(JSContext *ctx, JSValue *this_val,
+                            int argc, JSValue *argv)
+{
+    int new_len;
+
+    if (!js_get_array(ctx, *this_val))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &new_len, argv[0]))
+        return JS_EXCEPTION;
+    if (js_array_resize(ctx, this_val, new_len))
+        return JS_EXCEPTION;
+    return JS_UNDEFINED;
+}
+
+JSValue js_array_constructor(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv)
+{
+    JSValue obj;
+    JSObject *p;
+    int len, i;
+    BOOL has_init;
+    
+    argc &= ~FRAME_CF_CTOR;
+
+    if (argc == 1 && JS_IsNumber(ctx, argv[0])) {
+        /* XXX: we create undefined properties instead of just setting the length */
+        if (JS_ToInt32(ctx, &len, argv[0]))
+            return JS_EXCEPTION;
+        has_init = FALSE;
+    } else {
+        len = argc;
+        has_init = TRUE;
+    }
+    
+    if (len < 0 || len > JS_SHORTINT_MAX)
+        return JS_ThrowRangeError(ctx, "invalid array length");
+    obj = JS_NewArray(ctx, len);
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_TO_PTR(obj);
+    p->u.array.len = len;
+
+    if (has_init) {
+        JSValueArray *arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        for(i = 0; i < argc; i++) {
+            arr->arr[i] = argv[i];
+        }
+    }
+    return obj;
+}
+
+JSValue js_array_push(JSContext *ctx, JSValue *this_val,
+                      int argc, JSValue *argv, int is_unshift)
+{
+    JSObject *p;
+    int new_len, i, from;
+    JSValueArray *arr;
+    JSValue new_tab;
+    
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    from = p->u.array.len;
+    new_len = from + argc;
+    if (new_len > JS_SHORTINT_MAX)
+        return JS_ThrowRangeError(ctx, "invalid array length");
+    new_tab = js_resize_value_array(ctx, p->u.array.tab, new_len);
+    if (JS_IsException(new_tab))
+        return JS_EXCEPTION;
+    p = JS_VALUE_TO_PTR(*this_val);
+    p->u.array.tab = new_tab;
+    js_write_barrier(ctx, p, new_tab);
+    p->u.array.len = new_len;
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    if (is_unshift && argc > 0) {
+        memmove(arr->arr + argc, arr->arr, from * sizeof(JSValue));
+        from = 0;
+    }
+    for(i = 0; i < argc; i++) {
+        arr->arr[from + i] = argv[i];
+        js_write_barrier(ctx, arr, argv[i]);
+    }
+    return JS_NewShortInt(new_len);
+}
+
+JSValue js_array_pop(JSContext *ctx, JSValue *this_val,
+                     int argc, JSValue *argv)
+{
+    JSObject *p;
+    JSValue ret;
+    
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    if (p->u.array.len > 0) {
+        JSValueArray *arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        ret = arr->arr[--p->u.array.len];
+    } else {
+        ret = JS_UNDEFINED;
+    }
+    return ret;
+}
+
+JSValue js_array_shift(JSContext *ctx, JSValue *this_val,
+                       int argc, JSValue *argv)
+{
+    JSObject *p;
+    JSValue ret;
+    
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    if (p->u.array.len > 0) {
+        JSValueArray *arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        ret = arr->arr[0];
+        p->u.array.len--;
+        memmove(arr->arr, arr->arr + 1, p->u.array.len * sizeof(JSValue));
+    } else {
+        ret = JS_UNDEFINED;
+    }
+    return ret;
+}
+
+JSValue js_array_join(JSContext *ctx, JSValue *this_val,
+                      int argc, JSValue *argv)
+{
+    uint32_t i, len;
+    BOOL is_array;
+    JSValue sep, val;
+    JSGCRef sep_ref;
+    JSObject *p;
+    JSValueArray *arr;
+    StringBuffer b_s, *b = &b_s;
+    
+    if (!JS_IsObject(ctx, *this_val))
+        return JS_ThrowTypeErrorNotAnObject(ctx);
+    p = JS_VALUE_TO_PTR(*this_val);
+    is_array = (p->class_id == JS_CLASS_ARRAY);
+    if (is_array) {
+        len = p->u.array.len;
+    } else {
+        if (js_get_length32(ctx, &len, *this_val))
+            return JS_EXCEPTION;
+    }
+
+    if (argc > 0 && !JS_IsUndefined(argv[0])) {
+        sep = JS_ToString(ctx, argv[0]);
+        if (JS_IsException(sep))
+            return sep;
+    } else {
+        sep = JS_NewStringChar(',');
+    }
+    JS_PUSH_VALUE(ctx, sep);
+
+    string_buffer_push(ctx, b, 0);
+    for(i = 0; i < len; i++) {
+        if (i > 0) {
+            if (string_buffer_concat(ctx, b, sep_ref.val))
+                goto exception;
+        }
+        if (is_array) {
+            p = JS_VALUE_TO_PTR(*this_val);
+            arr = JS_VALUE_TO_PTR(p->u.array.tab);
+            if (i < p->u.array.len)
+                val = arr->arr[i];
+            else
+                val = JS_UNDEFINED;
+        } else {
+            val = JS_GetPropertyUint32(ctx, *this_val, i);
+            if (JS_IsException(val))
+                goto exception;
+        }
+        if (!JS_IsUndefined(val) && !JS_IsNull(val)) {
+            if (string_buffer_concat(ctx, b, val))
+                goto exception;
+        }
+    }
+    val = string_buffer_pop(ctx, b);
+    JS_POP_VALUE(ctx, sep);
+    return val;
+
+ exception:
+    string_buffer_pop(ctx, b);
+    JS_POP_VALUE(ctx, sep);
+    return JS_EXCEPTION;
+}
+
+JSValue js_array_toString(JSContext *ctx, JSValue *this_val,
+                          int argc, JSValue *argv)
+{
+    return js_array_join(ctx, this_val, 0, NULL);
+}
+
+JSValue js_array_isArray(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv)
+{
+    JSObject *p;
+    p = js_get_object_class(ctx, argv[0], JS_CLASS_ARRAY);
+    return JS_NewBool(p != NULL);
+}
+
+JSValue js_array_reverse(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv)
+{
+    int len;
+    JSObject *p;
+    JSValueArray *arr;
+
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.array.len;
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    js_reverse_val(arr->arr, len);
+    return *this_val;
+}
+
+JSValue js_array_concat(JSContext *ctx, JSValue *this_val,
+                      int argc, JSValue *argv)
+{
+    JSObject *p;
+    int len, i, j, pos;
+    int64_t len64;
+    JSValue obj, val;
+    JSValueArray *arr, *arr1;
+    
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    /* do a first pass to estimate the length */
+    len64 = p->u.array.len;
+    for(i = 0; i < argc; i++) {
+        p = js_get_object_class(ctx, argv[i], JS_CLASS_ARRAY);
+        if (p) {
+            len64 += p->u.array.len;
+        } else {
+            len64++;
+        }
+    }
+    if (len64 > JS_SHORTINT_MAX)
+        return JS_ThrowTypeError(ctx, "Array loo long");
+    len = len64;
+
+    obj = JS_NewArray(ctx, len);
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_TO_PTR(obj);
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    
+    pos = 0;
+    for(i = -1; i < argc; i++) {
+        val = i == -1 ? *this_val : argv[i];
+        p = js_get_object_class(ctx, val, JS_CLASS_ARRAY);
+        if (p) {
+            arr1 = JS_VALUE_TO_PTR(p->u.array.tab);
+            for(j = 0; j < p->u.array.len; j++)
+                arr->arr[pos + j] = arr1->arr[j];
+            pos += p->u.array.len;
+        } else {
+            arr->arr[pos++] = val;
+        }
+    }
+    return obj;
+}
+
+JSValue js_array_indexOf(JSContext *ctx, JSValue *this_val,
+                         int argc, JSValue *argv, int is_lastIndexOf)
+{
+    JSObject *p;
+    int len, n, res;
+    JSValueArray *arr;
+    
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.array.len;
+    if (is_lastIndexOf) {
+        n = len - 1;
+    } else {
+        n = 0;
+    }
+    if (argc > 1) {
+        if (JS_ToInt32Clamp(ctx, &n, argv[1],
+                            -is_lastIndexOf, len - is_lastIndexOf, len))
+            return JS_EXCEPTION;
+    }
+    /* the array may be modified */
+    p = JS_VALUE_TO_PTR(*this_val);
+    len = p->u.array.len; /* the length may be modified */
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    res = -1;
+    if (is_lastIndexOf) {
+        n = min_int(n, len - 1);
+        for(;n >= 0; n--) {
+            if (js_strict_eq(ctx, argv[0], arr->arr[n])) {
+                res = n;
+                break;
+            }
+        }
+    } else {
+        for(;n < len; n++) {
+            if (js_strict_eq(ctx, argv[0], arr->arr[n])) {
+                res = n;
+                break;
+            }
+        }
+    }
+    return JS_NewShortInt(res);
+}
+
+JSValue js_array_slice(JSContext *ctx, JSValue *this_val,
+                       int argc, JSValue *argv)
+{
+    JSObject *p, *p1;
+    int len, start, final, k;
+    JSValueArray *arr, *arr1;
+    JSValue obj;
+    
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.array.len;
+
+    if (JS_ToInt32Clamp(ctx, &start, argv[0], 0, len, len))
+        return JS_EXCEPTION;
+    final = len;
+    if (!JS_IsUndefined(argv[1])) {
+        if (JS_ToInt32Clamp(ctx, &final, argv[1], 0, len, len))
+            return JS_EXCEPTION;
+    }
+    /* the array may have been modified */
+    p = JS_VALUE_TO_PTR(*this_val);
+    len = p->u.array.len; /* the length may be modified */
+    final = min_int(final, len);
+
+    obj = JS_NewArray(ctx, max_int(final - start, 0));
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_TO_PTR(*this_val);
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    p1 = JS_VALUE_TO_PTR(obj);
+    arr1 = JS_VALUE_TO_PTR(p1->u.array.tab);
+    for(k = start; k < final; k++) {
+        arr1->arr[k - start] = arr->arr[k];
+    }
+    return obj;
+}
+
+JSValue js_array_splice(JSContext *ctx, JSValue *this_val,
+                        int argc, JSValue *argv)
+{
+    JSObject *p, *p1;
+    int start, len, item_count, del_count, new_len, i, ret;
+    JSValueArray *arr, *arr1;
+    JSValue obj;
+    JSGCRef obj_ref;
+    
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.array.len;
+
+    if (JS_ToInt32Clamp(ctx, &start, argv[0], 0, len, len))
+        return JS_EXCEPTION;
+
+    if (argc == 0) {
+        item_count = 0;
+        del_count = 0;
+    } else if (argc == 1) {
+        item_count = 0;
+        del_count = len - start;
+    } else {
+        item_count = argc - 2;
+        if (JS_ToInt32Clamp(ctx, &del_count, argv[1], 0, len - start, 0))
+            return JS_EXCEPTION;
+    }
+    new_len = len + item_count - del_count;
+    
+    obj = JS_NewArray(ctx, del_count);
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_TO_PTR(*this_val);
+    /* handling this case has no practical use */
+    if (p->u.array.len != len)
+        return JS_ThrowTypeError(ctx, "array length was modified");
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    p1 = JS_VALUE_TO_PTR(obj);
+    arr1 = JS_VALUE_TO_PTR(p1->u.array.tab);
+
+    for(i = 0; i < del_count; i++) {
+        arr1->arr[i] = arr->arr[start + i];
+    }
+
+    if (item_count != del_count) {
+        /* resize */
+        if (del_count > item_count) {
+            memmove(arr->arr + start + item_count,
+                    arr->arr + start + del_count,
+                    (len - (start + del_count)) * sizeof(JSValue));
+        }
+        JS_PUSH_VALUE(ctx, obj);
+        ret = js_array_resize(ctx, this_val, new_len);
+        JS_POP_VALUE(ctx, obj);
+        if (ret)
+            return JS_EXCEPTION;
+        p = JS_VALUE_TO_PTR(*this_val);
+        arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        if (del_count < item_count) {
+            memmove(arr->arr + start + item_count,
+                    arr->arr + start + del_count,
+                    (len - (start + del_count)) * sizeof(JSValue));
+        }
+    }
+
+    for(i = 0; i < item_count; i++) {
+        arr->arr[start + i] = argv[2 + i];
+        js_write_barrier(ctx, arr, argv[2 + i]);
+    }
+    
+    return obj;
+}
+
+JSValue js_array_every(JSContext *ctx, JSValue *this_val,
+                       int argc, JSValue *argv, int special)
+{
+    JSObject *p;
+    JSValueArray *arr;
+    JSValue res, ret, val, args[3];
+    JSValue *pfunc, *pthis_arg;
+    JSGCRef val_ref, ret_ref;
+    const JSCFunctionDef *fd;
+    int len, k, n;
+
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.array.len;
+
+    pfunc = &argv[0];
+    pthis_arg = NULL;
+    if (argc > 1)
+        pthis_arg = &argv[1];
+
+    if (!JS_IsFunction(ctx, *pfunc))
+        return JS_ThrowTypeError(ctx, "not a function");
+    
+    switch (special) {
+    case js_special_every:
+        ret = JS_TRUE;
+        break;
+    case js_special_some:
+        ret = JS_FALSE;
+        break;
+    case js_special_map:
+        ret = JS_NewArray(ctx, len);
+        if (JS_IsException(ret))
+            return JS_EXCEPTION;
+        break;
+    case js_special_filter:
+        ret = JS_NewArray(ctx, 0);
+        if (JS_IsException(ret))
+            return JS_EXCEPTION;
+        break;
+    case js_special_forEach:
+    default:
+        ret = JS_UNDEFINED;
+        break;
+    }
+    n = 0;
+    /* e.g. a.map(Math.sqrt): called directly if the element is a number */
+    fd = js_get_typed_cfunction_def(ctx, *pfunc);
+
+    JS_PUSH_VALUE(ctx, ret);
+    for(k = 0; k < len; k++) {
+        if (JS_StackCheck(ctx, 5))
+            goto exception;
+
+        p = JS_VALUE_TO_PTR(*this_val);
+        arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        /* the array length may have been modified by the function call*/
+        if (k >= p->u.array.len)
+            break;
+        val = arr->arr[k];
+        
+        /* arguments in reverse order */
+        args[0] = *this_val;
+        args[1] = JS_NewShortInt(k);
+        args[2] = val;
+        JS_PUSH_VALUE(ctx, val);
+        if (fd && js_typed_cfunction_check_args(ctx, fd, args, 3)) {
+            res = js_call_typed_cfunction(ctx, fd, args, 3);
+        } else {
+            JS_PushArg(ctx, args[0]);
+            JS_PushArg(ctx, args[1]);
+            JS_PushArg(ctx, args[2]); /* arg0 */
+            JS_PushArg(ctx, *pfunc); /* func */
+            JS_PushArg(ctx, pthis_arg ? *pthis_arg : JS_UNDEFINED); /* this */
+            res = JS_Call(ctx, 3);
+        }
+        JS_POP_VALUE(ctx, val);
+        if (JS_IsException(res))
+            goto exception;
+        
+        switch (special) {
+        case js_special_every:
+            if (!JS_ToBool(ctx, res)) {
+                ret_ref.val = JS_FALSE;
+                goto done;
+            }
+            break;
+        case js_special_some:
+            if (JS_ToBool(ctx, res)) {
+                ret_ref.val = JS_TRUE;
+                goto done;
+            }
+            break;
+        case js_special_map:
+            /* Note: same as defineProperty for arrays */
+            res = JS_SetPropertyUint32(ctx, ret_ref.val, k, res);
+            if (JS_IsException(res))
+                goto exception;
+            break;
+        case js_special_filter:
+            if (JS_ToBool(ctx, res)) {
+                res = JS_SetPropertyUint32(ctx, ret_ref.val, n++, val);
+                if (JS_IsException(res))
+                    goto exception;
+            }
+            break;
+        case js_special_forEach:
+        default:
+            break;
+        }
+    }
+done:
+    JS_POP_VALUE(ctx, ret);
+    return ret;
+ exception:
+    ret_ref.val = JS_EXCEPTION;
+    goto done;
+}
+
+JSValue js_array_reduce(JSContext *ctx, JSValue *this_val,
+                        int argc, JSValue *argv, int special)
+{
+    JSObject *p;
+    JSValueArray *arr;
+    JSValue acc, *pfunc, args[4];
+    JSGCRef acc_ref;
+    const JSCFunctionDef *fd;
+    int len, k, k1, ret;
+
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.array.len;
+    pfunc = &argv[0];
+
+    if (!JS_IsFunction(ctx, *pfunc))
+        return JS_ThrowTypeError(ctx, "not a function");
+
+    k = 0;
+    if (argc > 1) {
+        acc = argv[1];
+    } else {
+        if (len == 0)
+            return JS_ThrowTypeError(ctx, "empty array");
+        k1 = (special == js_special_reduceRight) ? len - k - 1 : k;
+        arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        acc = arr->arr[k1];
+        k++;
+    }
+    fd = js_get_typed_cfunction_def(ctx, *pfunc);
+    for (; k < len; k++) {
+        JS_PUSH_VALUE(ctx, acc);
+        ret = JS_StackCheck(ctx, 6);
+        JS_POP_VALUE(ctx, acc);
+        if (ret)
+            return JS_EXCEPTION;
+
+        k1 = (special == js_special_reduceRight) ? len - k - 1 : k;
+        p = JS_VALUE_TO_PTR(*this_val);
+        arr = JS_VALUE_TO_PTR(p->u.array.tab);
+        /* Note: the array length may have been modified, hence the check */
+        if (k1 >= p->u.array.len)
+            break;
+        
+        /* arguments in reverse order */
+        args[0] = *this_val;
+        args[1] = JS_NewShortInt(k1);
+        args[2] = arr->arr[k1];
+        args[3] = acc;
+        if (fd && js_typed_cfunction_check_args(ctx, fd, args, 4)) {
+            /* e.g. a.reduce(Math.imul) */
+            acc = js_call_typed_cfunction(ctx, fd, args, 4);
+        } else {
+            JS_PushArg(ctx, args[0]);
+            JS_PushArg(ctx, args[1]);
+            JS_PushArg(ctx, args[2]);
+            JS_PushArg(ctx, args[3]); /* arg0 */
+            JS_PushArg(ctx, *pfunc); /* func */
+            JS_PushArg(ctx, JS_UNDEFINED); /* this */
+            acc = JS_Call(ctx, 4);
+        }
+        if (JS_IsException(acc))
+            return JS_EXCEPTION;
+    }
+    return acc;
+}
+
+/* heapsort algorithm */
+static void rqsort_idx(size_t nmemb,
+                       int (*cmp)(size_t, size_t, void *),
+                       void (*swap)(size_t, size_t, void *),
+                       void *opaque)
+{
+    size_t i, n, c, r, size;
+
+    size = 1;
+    if (nmemb > 1) {
+        i = (nmemb / 2) * size;
+        n = nmemb * size;
 
-    if (p->class_id == JS_CLASS_ARRAY) {
-        array_len = p->u.array.len;
-    } else if (p->class_id >= JS_CLASS_UINT8C_ARRAY && p->class_id <= JS_CLASS_FLOAT64_ARRAY) {
-        array_len = p->u.typed_array.len;
+        while (i > 0) {
+            i -= size;
+            for (r = i; (c = r * 2 + size) < n; r = c) {
+                if (c < n - size && cmp(c, c + size, opaque) <= 0)
+                    c += size;
+                if (cmp(r, c, opaque) > 0)
+                    break;
+                swap(r, c, opaque);
+            }
+        }
+        for (i = n - size; i > 0; i -= size) {
+            swap(0, i, opaque);
+
+            for (r = 0; (c = r * 2 + size) < i; r = c) {
+                if (c < i - size && cmp(c, c + size, opaque) <= 0)
+                    c += size;
+                if (cmp(r, c, opaque) > 0)
+                    break;
+                swap(r, c, opaque);
+            }
+        }
+    }
+}
+
+/* comparison used by Array.prototype.sort, selected once before sorting */
+typedef enum {
+    JS_SORT_GENERIC, /* user comparator or default string comparison */
+    JS_SORT_INT_STRING, /* default comparison of short integers */
+    JS_SORT_INT_ASC, /* (a, b) => a - b on short integers */
+    JS_SORT_INT_DESC, /* (a, b) => b - a on short integers */
+    JS_SORT_NUM_ASC, /* (a, b) => a - b on numbers */
+    JS_SORT_NUM_DESC, /* (a, b) => b - a on numbers */
+} JSArraySortKindEnum;
+
+typedef struct {
+    JSContext *ctx;
+    BOOL exception;
+    int kind; /* JSArraySortKindEnum */
+    JSValue *parr; /* elements followed by the merge buffer */
+    JSValue *pfunc;
+} JSArraySortContext;
+
+#define JS_SORT_MIN_RUN    16
+#define JS_SORT_STACK_SIZE 64 /* enough for 2^32 elements */
+
+static double js_sort_get_number(JSValue val)
+{
+    if (JS_IsInt(val))
+        return JS_VALUE_GET_INT(val);
+#ifdef JS_USE_SHORT_FLOAT
+    if (JS_IsShortFloat(val))
+        return js_get_short_float(val);
+#endif
+    return ((JSFloat64 *)JS_VALUE_TO_PTR(val))->u.dval;
+}
+
+/* return 1 (resp. -1) if the function is 'function(a, b) { return a
+   - b; }' (resp. 'b - a'), 0 otherwise. */
+static int js_array_sort_get_func_order(JSValue func)
+{
+    JSObject *p;
+    JSFunctionBytecode *b;
+    JSByteArray *bc;
+
+    if (!JS_IsPtr(func))
+        return 0;
+    p = JS_VALUE_TO_PTR(func);
+    if (p->mtag != JS_MTAG_OBJECT || p->class_id != JS_CLASS_CLOSURE)
+        return 0;
+    b = JS_VALUE_TO_PTR(p->u.closure.func_bytecode);
+    if (b->byte_code == JS_NULL)
+        return 0;
+    bc = JS_VALUE_TO_PTR(b->byte_code);
+    if (bc->size != 4 || bc->buf[2] != OP_sub || bc->buf[3] != OP_return)
+        return 0;
+    if (bc->buf[0] == OP_get_arg0 && bc->buf[1] == OP_get_arg1)
+        return 1;
+    else if (bc->buf[0] == OP_get_arg1 && bc->buf[1] == OP_get_arg0)
+        return -1;
+    else
+        return 0;
+}
+
+/* select a comparison which does not call JS code when the elements
+   are all numbers */
+static int js_array_sort_get_kind(JSContext *ctx, JSValue *pfunc,
+                                  const JSValue *tab, int n)
+{
+    BOOL all_int, all_num;
+    int i, order;
+
+    if (pfunc) {
+        order = js_array_sort_get_func_order(*pfunc);
+        if (order == 0)
+            return JS_SORT_GENERIC;
     } else {
-        array_len = 0;
+        order = 0;
     }
-            
-    arr = JS_VALUE_TO_PTR(p->props);
-    prop_count = JS_VALUE_GET_INT(arr->arr[0]);
-    hash_mask = JS_VALUE_GET_INT(arr->arr[1]);
+    all_int = TRUE;
+    all_num = TRUE;
+    for(i = 0; i < n; i++) {
+        if (!JS_IsInt(tab[i])) {
+            all_int = FALSE;
+            if (!JS_IsNumber(ctx, tab[i])) {
+                all_num = FALSE;
+                break;
+            }
+        }
+    }
+    if (order == 0)
+        return all_int ? JS_SORT_INT_STRING : JS_SORT_GENERIC;
+    if (all_int)
+        return order > 0 ? JS_SORT_INT_ASC : JS_SORT_INT_DESC;
+    else if (all_num)
+        return order > 0 ? JS_SORT_NUM_ASC : JS_SORT_NUM_DESC;
+    else
+        return JS_SORT_GENERIC;
+}
 
-    alloc_size = array_len + prop_count;
-    
-    ret = JS_NewArray(ctx, alloc_size);
-    if (JS_IsException(ret))
-        return ret;
+static inline JSValue *js_array_sort_tab(JSArraySortContext *s)
+{
+    JSValueArray *arr = JS_VALUE_TO_PTR(*s->parr);
+    return arr->arr;
+}
 
-    pos = 0;
-    for(i = 0; i < array_len; i++) {
-        JS_PUSH_VALUE(ctx, ret);
-        str = JS_ToString(ctx, JS_NewShortInt(i));
-        JS_POP_VALUE(ctx, ret);
-        if (JS_IsException(str))
-            return str;
-        pret = JS_VALUE_TO_PTR(ret);
-        ret_arr = JS_VALUE_TO_PTR(pret->u.array.tab);
-        ret_arr->arr[pos++] = str;
+/* compare the elements at positions i1 and i2 of the sort array.
+   Return < 0, 0 or > 0. The array may be moved by the GC. */
+static int js_array_sort_cmp(JSArraySortContext *s, int i1, int i2)
+{
+    JSContext *ctx = s->ctx;
+    JSValue *tab, v1, v2;
+    int cmp;
+
+    if (s->exception)
+        return 0;
+
+    tab = js_array_sort_tab(s);
+    v1 = tab[i1];
+    v2 = tab[i2];
+    switch(s->kind) {
+    case JS_SORT_INT_ASC:
+        return (JS_VALUE_GET_INT(v1) > JS_VALUE_GET_INT(v2)) -
+            (JS_VALUE_GET_INT(v1) < JS_VALUE_GET_INT(v2));
+    case JS_SORT_INT_DESC:
+        return (JS_VALUE_GET_INT(v1) < JS_VALUE_GET_INT(v2)) -
+            (JS_VALUE_GET_INT(v1) > JS_VALUE_GET_INT(v2));
+    case JS_SORT_NUM_ASC:
+    case JS_SORT_NUM_DESC:
+        {
+            /* same result as the subtraction: NaN compares as equal */
+            double d1 = js_sort_get_number(v1);
+            double d2 = js_sort_get_number(v2);
+            cmp = (d1 > d2) - (d1 < d2);
+            return s->kind == JS_SORT_NUM_ASC ? cmp : -cmp;
+        }
+    case JS_SORT_INT_STRING:
+        {
+            char buf1[16], buf2[16];
+            if (v1 == v2)
+                return 0;
+            buf1[i32toa(buf1, JS_VALUE_GET_INT(v1))] = '\0';
+            buf2[i32toa(buf2, JS_VALUE_GET_INT(v2))] = '\0';
+            return strcmp(buf1, buf2);
+        }
+    default:
+        break;
+    }
+
+    if (s->pfunc) {
+        JSValue res;
+        /* custom sort function is specified as returning 0 for identical
+         * objects: avoid method call overhead.
+         */
+        if (v1 == v2)
+            return 0;
+        if (JS_StackCheck(ctx, 4))
+            goto exception;
+        tab = js_array_sort_tab(s);
+
+        JS_PushArg(ctx, tab[i2]);
+        JS_PushArg(ctx, tab[i1]); /* arg0 */
+        JS_PushArg(ctx, *s->pfunc); /* func */
+        JS_PushArg(ctx, JS_UNDEFINED); /* this */
+        res = JS_Call(ctx, 2);
+        if (JS_IsException(res))
+            goto exception;
+        if (JS_IsInt(res)) {
+            int val = JS_VALUE_GET_INT(res);
+            cmp = (val > 0) - (val < 0);
+        } else {
+            double val;
+            if (JS_ToNumber(ctx, &val, res))
+                goto exception;
+            cmp = (val > 0) - (val < 0);
+        }
+    } else {
+        JSValue str1, str2;
+        JSGCRef str1_ref;
+
+        str1 = v1;
+        if (!JS_IsString(ctx, str1)) {
+            str1 = JS_ToString(ctx, str1);
+            if (JS_IsException(str1))
+                goto exception;
+        }
+        str2 = js_array_sort_tab(s)[i2];
+        if (!JS_IsString(ctx, str2)) {
+            JS_PUSH_VALUE(ctx, str1);
+            str2 = JS_ToString(ctx, str2);
+            JS_POP_VALUE(ctx, str1);
+            if (JS_IsException(str2))
+                goto exception;
+        }
+        cmp = js_string_compare(ctx, str1, str2);
+    }
+    return cmp;
+ exception:
+    s->exception = TRUE;
+    return 0;
+}
+
+/* return the first position in [lo, hi) whose element is > (or >= if
+   'strict' is false) the element at position 'key' */
+static int js_array_sort_search(JSArraySortContext *s, int key,
+                                int lo, int hi, BOOL strict)
+{
+    int mid;
+    while (lo < hi) {
+        mid = lo + ((hi - lo) >> 1);
+        if (js_array_sort_cmp(s, mid, key) < strict)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* extend the sorted run [lo, hi) to [lo, end) with a binary insertion
+   sort */
+static void js_array_sort_insertion(JSArraySortContext *s, int lo, int hi,
+                                    int end)
+{
+    JSValue *tab;
+    int i, pos;
+
+    for(i = hi; i < end && !s->exception; i++) {
+        pos = js_array_sort_search(s, i, lo, i, TRUE);
+        tab = js_array_sort_tab(s);
+        if (pos != i) {
+            JSValue v = tab[i];
+            memmove(tab + pos + 1, tab + pos, (i - pos) * sizeof(JSValue));
+            tab[pos] = v;
+        }
+    }
+}
+
+/* merge the sorted runs [lo, mid) and [mid, hi) using the buffer at
+   position 'buf' */
+static void js_array_sort_merge(JSArraySortContext *s, int lo, int mid,
+                                int hi, int buf)
+{
+    JSValue *tab;
+    int i, i_end, j, k;
+
+    /* nothing to do if the runs are already in order, which is the
+       common case for almost sorted data */
+    if (js_array_sort_cmp(s, mid - 1, mid) <= 0)
+        return;
+    /* the elements of the first run which are <= the first element of
+       the second one are already in place, and so are the elements of
+       the second run which are >= the last element of the first one */
+    lo = js_array_sort_search(s, mid, lo, mid, TRUE);
+    hi = js_array_sort_search(s, mid - 1, mid, hi, FALSE);
+    if (s->exception)
+        return;
+
+    tab = js_array_sort_tab(s);
+    memcpy(tab + buf, tab + lo, (mid - lo) * sizeof(JSValue));
+    i = buf;
+    i_end = buf + mid - lo;
+    j = mid;
+    k = lo;
+    while (i < i_end && j < hi) {
+        /* take from the first run when equal to keep the sort stable */
+        if (js_array_sort_cmp(s, j, i) < 0) {
+            tab = js_array_sort_tab(s);
+            tab[k++] = tab[j++];
+        } else {
+            tab = js_array_sort_tab(s);
+            tab[k++] = tab[i++];
+        }
+    }
+    tab = js_array_sort_tab(s);
+    memcpy(tab + k, tab + i, (i_end - i) * sizeof(JSValue));
+}
+
+/* merge the runs 'm' and 'm + 1' of the run stack */
+static void js_array_sort_merge_at(JSArraySortContext *s, int *run_base,
+                                   int *run_len, int stack_len, int m, int n)
+{
+    js_array_sort_merge(s, run_base[m], run_base[m + 1],
+                        run_base[m + 1] + run_len[m + 1], n);
+    run_len[m] += run_len[m + 1];
+    if (m == stack_len - 3) {
+        run_base[m + 1] = run_base[m + 2];
+        run_len[m + 1] = run_len[m + 2];
+    }
+}
+
+/* Stable natural merge sort of the 'n' first elements of the sort
+   array (simplified Tim sort): the existing ascending or strictly
+   descending runs are used as is, short runs are extended with an
+   insertion sort and the runs are merged keeping balanced sizes. The
+   positions [n, 2 * n) of the sort array are used as merge buffer. */
+static void js_array_merge_sort(JSArraySortContext *s, int n)
+{
+    int run_base[JS_SORT_STACK_SIZE], run_len[JS_SORT_STACK_SIZE];
+    int stack_len, lo, hi, end, m;
+    JSValue *tab, tmp;
+
+    stack_len = 0;
+    lo = 0;
+    while (lo < n) {
+        /* find the next run */
+        hi = lo + 1;
+        if (hi < n) {
+            if (js_array_sort_cmp(s, hi, lo) < 0) {
+                hi++;
+                while (hi < n && js_array_sort_cmp(s, hi, hi - 1) < 0)
+                    hi++;
+                /* reverse it */
+                tab = js_array_sort_tab(s);
+                for(m = 0; m < (hi - lo) / 2; m++) {
+                    tmp = tab[lo + m];
+                    tab[lo + m] = tab[hi - 1 - m];
+                    tab[hi - 1 - m] = tmp;
+                }
+            } else {
+                hi++;
+                while (hi < n && js_array_sort_cmp(s, hi, hi - 1) >= 0)
+                    hi++;
+            }
+        }
+        end = min_int(n, lo + JS_SORT_MIN_RUN);
+        if (hi < end) {
+            js_array_sort_insertion(s, lo, hi, end);
+            hi = end;
+        }
+        if (s->exception)
+            return;
+        run_base[stack_len] = lo;
+        run_len[stack_len] = hi - lo;
+        stack_len++;
+        lo = hi;
+
+        /* merge the runs until their lengths decrease at least as fast
+           as the Fibonacci sequence */
+        while (stack_len > 1) {
+            m = stack_len - 2;
+            if ((m > 0 && run_len[m - 1] <= run_len[m] + run_len[m + 1]) ||
+                (m > 1 && run_len[m - 2] <= run_len[m - 1] + run_len[m])) {
+                if (run_len[m - 1] < run_len[m + 1])
+                    m--;
+            } else if (run_len[m] > run_len[m + 1]) {
+                break;
+            }
+            js_array_sort_merge_at(s, run_base, run_len, stack_len, m, n);
+            stack_len--;
+            if (s->exception)
+                return;
+        }
     }
     
-    for(i = 0, j = 0; j < prop_count; i++) {
-        JSProperty *pr;
-        p = JS_VALUE_TO_PTR(argv[0]);
-        arr = JS_VALUE_TO_PTR(p->props);
-        pr = (JSProperty *)&arr->arr[2 + hash_mask + 1 + 3 * i];
-        /* exclude deleted properties */
-        if (pr->key != JS_UNINITIALIZED) {
-            JS_PUSH_VALUE(ctx, ret);
-            str = JS_ToString(ctx, pr->key);
-            JS_POP_VALUE(ctx, ret);
-            if (JS_IsException(str))
-                return str;
-            pret = JS_VALUE_TO_PTR(ret);
-            ret_arr = JS_VALUE_TO_PTR(pret->u.array.tab);
-            ret_arr->arr[pos++] = str;
-            j++;
+    while (stack_len > 1) {
+        m = stack_len - 2;
+        if (m > 0 && run_len[m - 1] < run_len[m + 1])
+            m--;
+        js_array_sort_merge_at(s, run_base, run_len, stack_len, m, n);
+        stack_len--;
+        if (s->exception)
+            return;
+    }
+}
+
+JSValue js_array_sort(JSContext *ctx, JSValue *this_val,
+                      int argc, JSValue *argv)
+{
+    JSValue *pfunc = &argv[0];
+    JSObject *p;
+    JSValue tab_val;
+    JSGCRef tab_val_ref;
+    JSValueArray *tab, *arr;
+    int i, len, n;
+    JSArraySortContext ss, *s = &ss;
+    
+    if (!JS_IsUndefined(*pfunc)) {
+        if (!JS_IsFunction(ctx, *pfunc))
+            return JS_ThrowTypeError(ctx, "not a function");
+    } else {
+        pfunc = NULL;
+    }
+    p = js_get_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+
+    /* create a temporary array for sorting: the defined elements
+       followed by the merge buffer */
+    len = p->u.array.len;
+    tab = js_alloc_value_array(ctx, 0, len * 2);
+    if (!tab)
+        return JS_EXCEPTION;
+
+    p = JS_VALUE_TO_PTR(*this_val);
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    n = 0;
+    for(i = 0; i < len; i++) {
+        if (!JS_IsUndefined(arr->arr[i])) {
+            tab->arr[n++] = arr->arr[i];
         }
     }
-    pret = JS_VALUE_TO_PTR(ret);
-    pret->u.array.len = pos;
-    return ret;
+    tab_val = JS_VALUE_FROM_PTR(tab);
+    
+    JS_PUSH_VALUE(ctx, tab_val);
+    s->ctx = ctx;
+    s->exception = FALSE;
+    s->parr = &tab_val_ref.val;
+    s->pfunc = pfunc;
+    s->kind = js_array_sort_get_kind(ctx, pfunc, tab->arr, n);
+    js_array_merge_sort(s, n);
+    JS_POP_VALUE(ctx, tab_val);
+    tab = JS_VALUE_TO_PTR(tab_val);
+    if (s->exception) {
+        js_free(ctx, tab);
+        return JS_EXCEPTION;
+    }
+    
+    p = JS_VALUE_TO_PTR(*this_val);
+    arr = JS_VALUE_TO_PTR(p->u.array.tab);
+    /* XXX: could resize the array in case it was shrank by the compare function */
+    len = min_int(len, p->u.array.len);
+    for(i = 0; i < len; i++) {
+        arr->arr[i] = i < n ? tab->arr[i] : JS_UNDEFINED;
+        js_write_barrier(ctx, arr, arr->arr[i]);
+    }
+    js_free(ctx, tab);
+    return *this_val;
 }
 
-JSValue js_object_hasOwnProperty(JSContext *ctx, JSValue *this_val,
-                                 int argc, JSValue *argv)
+/**********************************************************************/
+
+/* precondition: a and b are not NaN */
+static double js_fmin(double a, double b)
 {
-    JSObject *p;
-    JSValue prop;
-    int array_len, idx;
-    
-    if (JS_IsNull(*this_val) || JS_IsUndefined(*this_val))
-        return JS_ThrowTypeError(ctx, "cannot convert to object");
-    if (!JS_IsObject(ctx, *this_val))
-        return JS_FALSE; /* XXX: could improve for strings */
-    prop = JS_ToPropertyKey(ctx, argv[0]);
-    p = JS_VALUE_TO_PTR(*this_val);
-    if (p->class_id == JS_CLASS_ARRAY) {
-        array_len = p->u.array.len;
-        goto check_array;
-    } else if (p->class_id >= JS_CLASS_UINT8C_ARRAY && p->class_id <= JS_CLASS_FLOAT64_ARRAY) {
-        array_len = p->u.typed_array.len;
-    check_array:
-        if (JS_IsInt(prop)) {
-            idx = JS_VALUE_GET_INT(prop);
-            return JS_NewBool((idx >= 0 && idx < array_len));
-        }
+    if (a == 0 && b == 0) {
+        return uint64_as_float64(float64_as_uint64(a) | float64_as_uint64(b));
+    } else if (a <= b) {
+        return a;
+    } else {
+        return b;
     }
-    return JS_NewBool((find_own_property(ctx, p, prop) != NULL));
 }
 
-JSValue js_object_toString(JSContext *ctx, JSValue *this_val,
-                           int argc, JSValue *argv)
+/* precondition: a and b are not NaN */
+static double js_fmax(double a, double b)
 {
-    const char *str;
-    char buf[64];
-    /* XXX: not fully compliant */
-    if (JS_IsIntOrShortFloat(*this_val)) {
-        goto number;
-    } else if (!JS_IsPtr(*this_val)) {
-        switch(JS_VALUE_GET_SPECIAL_TAG(*this_val)) {
-        case JS_TAG_NULL:
-            str = "Null";
-            break;
-        case JS_TAG_UNDEFINED:
-            str = "Undefined";
-            break;
-        case JS_TAG_SHORT_FUNC:
-            str = "Function";
-            break;
-        case JS_TAG_BOOL:
-            str = "Boolean";
-            break;
-        case JS_TAG_STRING_CHAR:
-            goto string;
-        default:
-            goto object;
+    if (a == 0 && b == 0) {
+        return uint64_as_float64(float64_as_uint64(a) & float64_as_uint64(b));
+    } else if (a >= b) {
+        return a;
+    } else {
+        return b;
+    }
+}
+
+JSValue js_math_min_max(JSContext *ctx, JSValue *this_val,
+                        int argc, JSValue *argv, int magic)
+{
+    BOOL is_max = magic;
+    double r, a;
+    int i;
+
+    if (unlikely(argc == 0)) {
+        return __JS_NewFloat64(ctx, is_max ? -1.0 / 0.0 : 1.0 / 0.0);
+    }
+
+    if (JS_IsInt(argv[0])) {
+        int a1, r1 = JS_VALUE_GET_INT(argv[0]);
+        for(i = 1; i < argc; i++) {
+            if (!JS_IsInt(argv[i])) {
+                r = r1;
+                goto generic_case;
+            }
+            a1 = JS_VALUE_GET_INT(argv[i]);
+            if (is_max)
+                r1 = max_int(r1, a1);
+            else
+                r1 = min_int(r1, a1);
         }
+        return JS_NewShortInt(r1);
     } else {
-        JSObject *p = JS_VALUE_TO_PTR(*this_val);
-        switch(p->mtag) {
-        case JS_MTAG_OBJECT:
-            switch(p->class_id) {
-            case JS_CLASS_ARRAY:
-                str = "Array";
-                break;
-            case JS_CLASS_ERROR:
-                str = "Error";
-                break;
-            case JS_CLASS_CLOSURE:
-            case JS_CLASS_C_FUNCTION:
-                str = "Function";
-                break;
-            default:
-            object:
-                str = "Object";
-                break;
+        if (JS_ToNumber(ctx, &r, argv[0]))
+            return JS_EXCEPTION;
+        i = 1;
+    generic_case:
+        while (i < argc) {
+            if (JS_ToNumber(ctx, &a, argv[i]))
+                return JS_EXCEPTION;
+            if (!isnan(r)) {
+                if (isnan(a)) {
+                    r = a;
+                } else {
+                    if (is_max)
+                        r = js_fmax(r, a);
+                    else
+                        r = js_fmin(r, a);
+                }
             }
-            break;
-        case JS_MTAG_STRING:
-        string:
-            str = "String";
-            break;
-        case JS_MTAG_FLOAT64:
-        number:
-            str = "Number";
-            break;
-        default:
-            goto object;
+            i++;
         }
+        return JS_NewFloat64(ctx, r);
     }
-    js_snprintf(buf, sizeof(buf), "[object %s]", str);
-    return JS_NewString(ctx, buf);
 }
 
-/**********************************************************************/
-
-JSValue js_error_constructor(JSContext *ctx, JSValue *this_val,
-                             int argc, JSValue *argv, int magic)
+double js_math_sign(double a)
 {
-    JSValue obj, msg;
-    JSObject *p;
-    JSGCRef obj_ref;
-    
-    argc &= ~FRAME_CF_CTOR;
+    if (isnan(a) || a == 0.0)
+        return a;
+    if (a < 0)
+        return -1;
+    else
+        return 1;
+}
 
-    obj = JS_NewObjectProtoClass(ctx, ctx->class_proto[magic], JS_CLASS_ERROR,
-                                 sizeof(JSErrorData));
-    if (JS_IsException(obj))
-        return obj;
-    p = JS_VALUE_TO_PTR(obj);
-    p->u.error.message = JS_NULL;
-    p->u.error.stack = JS_NULL;
-    
-    if (!JS_IsUndefined(argv[0])) {
-        JS_PUSH_VALUE(ctx, obj);
-        msg = JS_ToString(ctx, argv[0]);
-        JS_POP_VALUE(ctx, obj);
-        if (JS_IsException(msg))
-            return msg;
-        p = JS_VALUE_TO_PTR(obj);
-        p->u.error.message = msg;
-    } else {
-        p = JS_VALUE_TO_PTR(obj);
-        p->u.error.message = js_get_atom(ctx, JS_ATOM_empty);
-    }
-    JS_PUSH_VALUE(ctx, obj);
-    build_backtrace(ctx, obj, NULL, 0, 0, 1);
-    JS_POP_VALUE(ctx, obj);
-    return obj;
+double js_math_fround(double a)
+{
+    return (float)a;
 }
 
-JSValue js_error_toString(JSContext *ctx, JSValue *this_val,
-                          int argc, JSValue *argv)
+int js_math_imul(int a, int b)
 {
-    JSObject *p;
-    JSValue name;
-    StringBuffer b_s, *b = &b_s;
+    /* purposely ignoring overflow */
+    return (uint32_t)a * (uint32_t)b;
+}
 
-    if (!JS_IsError(ctx, *this_val))
-        return JS_ThrowTypeError(ctx, "not an Error object");
-    name = JS_GetProperty(ctx, *this_val, js_get_atom(ctx, JS_ATOM_name));
-    if (JS_IsException(name))
-        return name;
-    if (JS_IsUndefined(name))
-        name = js_get_atom(ctx, JS_ATOM_Error);
-    else
-        name = JS_ToString(ctx, name);
-    if (JS_IsException(name))
-        return name;
-    string_buffer_push(ctx, b, 0);
-    string_buffer_concat(ctx, b, name);
-    p = JS_VALUE_TO_PTR(*this_val);
-    if (p->u.error.message != JS_NULL) {
-        string_buffer_puts(ctx, b, ": ");
-        p = JS_VALUE_TO_PTR(*this_val);
-        string_buffer_concat(ctx, b, p->u.error.message);
-    }
-    return string_buffer_pop(ctx, b);
+/* non-standard integer and fixed point helpers. They never produce
+   floats, which are emulated in software on the targets without a
+   double precision FPU. */
+
+/* truncated int32 division. Return 0 if b = 0. */
+int js_math_idiv(int a, int b)
+{
+    if (b == 0)
+        return 0;
+    if (b == -1)
+        return -(uint32_t)a; /* avoid INT32_MIN / -1 overflow */
+    return a / b;
 }
 
-JSValue js_error_get_message(JSContext *ctx, JSValue *this_val,
-                             int argc, JSValue *argv, int magic)
+/* (a * b) >> q with a 64 bit intermediate result, truncated to int32
+   as Math.imul() */
+int js_math_fxmul(int a, int b, int q)
 {
-    JSObject *p;
-    if (!JS_IsError(ctx, *this_val))
-        return JS_ThrowTypeError(ctx, "not an Error object");
-    p = JS_VALUE_TO_PTR(*this_val);
-    if (magic == 0)
-        return p->u.error.message;
-    else
-        return p->u.error.stack;
+    return (int64_t)a * b >> (q & 31);
 }
 
-/**********************************************************************/
+/* (a << q) / b with a 64 bit intermediate result. Saturate if b = 0
+   or if the result does not fit in an int32. */
+int js_math_fxdiv(int a, int b, int q)
+{
+    int64_t r;
+    if (b == 0)
+        return a < 0 ? INT32_MIN : INT32_MAX;
+    r = (int64_t)a * ((int64_t)1 << (q & 31)) / b;
+    if (r > INT32_MAX)
+        return INT32_MAX;
+    else if (r < INT32_MIN)
+        return INT32_MIN;
+    return r;
+}
 
-static JSObject *js_get_array(JSContext *ctx, JSValue obj)
+JSValue js_math_clz32(JSContext *ctx, JSValue *this_val,
+                     int argc, JSValue *argv)
 {
-    JSObject *p;
-    p = js_get_object_class(ctx, obj, JS_CLASS_ARRAY);
-    if (!p) {
-        JS_ThrowTypeError(ctx, "not an array");
-        return NULL;
-    }
-    return p;
+    uint32_t a, r;
+
+    if (JS_ToUint32(ctx, &a, argv[0]))
+        return JS_EXCEPTION;
+    if (a == 0)
+        r = 32;
+    else
+        r = clz32(a);
+    return JS_NewInt32(ctx, r);
 }
 
-JSValue js_array_get_length(JSContext *ctx, JSValue *this_val,
-                            int argc, JSValue *argv)
+/* xorshift* random number generator by Marsaglia */
+static uint64_t xorshift64star(uint64_t *pstate)
 {
-    JSObject *p;
-    p = js_get_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
-    return JS_NewShortInt(p->u.array.len);
+    uint64_t x;
+    x = *pstate;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *pstate = x;
+    return x * 0x2545F4914F6CDD1D;
 }
 
-static int js_array_resize(JSContext *ctx, JSValue *this_val, int new_len)
+JSValue js_math_random(JSContext *ctx, JSValue *this_val,
+                       int argc, JSValue *argv)
 {
-    JSObject *p;
-    int i;
+    double d;
+    uint64_t v;
 
-    if (new_len < 0 || new_len > JS_SHORTINT_MAX) {
-        JS_ThrowTypeError(ctx, "invalid array length");
+    v = xorshift64star(&ctx->random_state);
+    /* 1.0 <= u.d < 2 */
+    d = uint64_as_float64(((uint64_t)0x3ff << 52) | (v >> 12));
+    return __JS_NewFloat64(ctx, d - 1.0);
+}
+
+/* typed array */
+
+#define JS_TYPED_ARRAY_COUNT (JS_CLASS_FLOAT64_ARRAY - JS_CLASS_UINT8C_ARRAY + 1)
+
+static uint8_t typed_array_size_log2[JS_TYPED_ARRAY_COUNT] = {
+    0, 0, 0, 1, 1, 2, 2, 2, 3
+};
+
+static int JS_ToIndex(JSContext *ctx, uint64_t *plen, JSValue val)
+{
+    int v;
+    /* XXX: should support 53 bit inteers */
+    if (JS_ToInt32Sat(ctx, &v, val))
+        return -1;
+    if (v < 0 || v > JS_SHORTINT_MAX) {
+        JS_ThrowRangeError(ctx, "invalid array index");
         return -1;
     }
-    p = JS_VALUE_TO_PTR(*this_val);
-    if (new_len < p->u.array.len) {
-        JSValueArray *arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        /* shrink the array if the new size is small enough */
-        if (new_len < (arr->size / 2) && arr->size >= 4) {
-            js_shrink_value_array(ctx, &p->u.array.tab, new_len);
-            p = JS_VALUE_TO_PTR(*this_val);
-        } else {
-            for(i = new_len; i < p->u.array.len; i++)
-                arr->arr[i] = JS_UNDEFINED;
-        }
-    } else if (new_len > p->u.array.len) {
-        JSValueArray *arr;
-        JSValue new_tab;
-        new_tab = js_resize_value_array(ctx, p->u.array.tab, new_len);
-        if (JS_IsException(new_tab))
-            return -1;
-        p = JS_VALUE_TO_PTR(*this_val);
-        p->u.array.tab = new_tab;
-        arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        for(i = p->u.array.len; i < new_len; i++)
-            arr->arr[i] = JS_UNDEFINED;
-    }
-    p->u.array.len = new_len;
+    *plen = v;
     return 0;
 }
 
-JSValue js_array_set_length(JSContext *ctx, JSValue *this_val,
-                            int argc, JSValue *argv)
+JSValue js_array_buffer_alloc(JSContext *ctx, uint64_t len)
 {
-    int new_len;
+    JSByteArray *arr;
+    JSValue buffer, obj;
+    JSGCRef buffer_ref;
+    JSObject *p;
 
-    if (!js_get_array(ctx, *this_val))
-        return JS_EXCEPTION;
-    if (JS_ToInt32(ctx, &new_len, argv[0]))
-        return JS_EXCEPTION;
-    if (js_array_resize(ctx, this_val, new_len))
+    if (len > JS_SHORTINT_MAX)
+        return JS_ThrowRangeError(ctx, "invalid array buffer length");
+    arr = js_alloc_byte_array(ctx, len);
+    if (!arr)
         return JS_EXCEPTION;
-    return JS_UNDEFINED;
+    memset(arr->buf, 0, len);
+    buffer = JS_VALUE_FROM_PTR(arr);
+    JS_PUSH_VALUE(ctx, buffer);
+    obj = JS_NewObjectClass(ctx, JS_CLASS_ARRAY_BUFFER,
+                            offsetof(JSArrayBuffer, buf));
+    JS_POP_VALUE(ctx, buffer);
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_TO_PTR(obj);
+    p->u.array_buffer.byte_buffer = buffer;
+    return obj;
 }
 
-JSValue js_array_constructor(JSContext *ctx, JSValue *this_val,
-                             int argc, JSValue *argv)
+JSValue JS_NewArrayBufferExternal(JSContext *ctx, uint8_t *buf, size_t len,
+                                  JSFreeArrayBufferDataFunc *free_func,
+                                  void *opaque)
 {
     JSValue obj;
     JSObject *p;
-    int len, i;
-    BOOL has_init;
-    
-    argc &= ~FRAME_CF_CTOR;
 
-    if (argc == 1 && JS_IsNumber(ctx, argv[0])) {
-        /* XXX: we create undefined properties instead of just setting the length */
-        if (JS_ToInt32(ctx, &len, argv[0]))
-            return JS_EXCEPTION;
-        has_init = FALSE;
-    } else {
-        len = argc;
-        has_init = TRUE;
-    }
-    
-    if (len < 0 || len > JS_SHORTINT_MAX)
-        return JS_ThrowRangeError(ctx, "invalid array length");
-    obj = JS_NewArray(ctx, len);
+    if (len > JS_SHORTINT_MAX)
+        return JS_ThrowRangeError(ctx, "invalid array buffer length");
+    obj = JS_NewObjectClass(ctx, JS_CLASS_ARRAY_BUFFER, sizeof(JSArrayBuffer));
     if (JS_IsException(obj))
         return obj;
     p = JS_VALUE_TO_PTR(obj);
-    p->u.array.len = len;
-
-    if (has_init) {
-        JSValueArray *arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        for(i = 0; i < argc; i++) {
-            arr->arr[i] = argv[i];
-        }
-    }
+    p->u.array_buffer.byte_buffer = JS_NULL;
+    p->u.array_buffer.buf = buf;
+    p->u.array_buffer.len = len;
+    p->u.array_buffer.free_func = free_func;
+    p->u.array_buffer.opaque = opaque;
     return obj;
 }
 
-JSValue js_array_push(JSContext *ctx, JSValue *this_val,
-                      int argc, JSValue *argv, int is_unshift)
+/* called when an ArrayBuffer object is freed */
+static void js_array_buffer_finalizer(JSContext *ctx, JSObject *p)
 {
-    JSObject *p;
-    int new_len, i, from;
-    JSValueArray *arr;
-    JSValue new_tab;
-    
-    p = js_get_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
-    from = p->u.array.len;
-    new_len = from + argc;
-    if (new_len > JS_SHORTINT_MAX)
-        return JS_ThrowRangeError(ctx, "invalid array length");
-    new_tab = js_resize_value_array(ctx, p->u.array.tab, new_len);
-    if (JS_IsException(new_tab))
-        return JS_EXCEPTION;
-    p = JS_VALUE_TO_PTR(*this_val);
-    p->u.array.tab = new_tab;
-    p->u.array.len = new_len;
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    if (is_unshift && argc > 0) {
-        memmove(arr->arr + argc, arr->arr, from * sizeof(JSValue));
-        from = 0;
-    }
-    for(i = 0; i < argc; i++) {
-        arr->arr[from + i] = argv[i];
+    if (p->extra_size > 1 && p->u.array_buffer.free_func) {
+        p->u.array_buffer.free_func(ctx, p->u.array_buffer.opaque,
+                                    p->u.array_buffer.buf);
     }
-    return JS_NewShortInt(new_len);
 }
 
-JSValue js_array_pop(JSContext *ctx, JSValue *this_val,
-                     int argc, JSValue *argv)
+uint8_t *JS_GetArrayBuffer(JSContext *ctx, size_t *plen, JSValue obj)
 {
-    JSObject *p;
-    JSValue ret;
-    
-    p = js_get_array(ctx, *this_val);
+    JSObject *p = js_get_object_class(ctx, obj, JS_CLASS_ARRAY_BUFFER);
     if (!p)
-        return JS_EXCEPTION;
-    if (p->u.array.len > 0) {
-        JSValueArray *arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        ret = arr->arr[--p->u.array.len];
-    } else {
-        ret = JS_UNDEFINED;
-    }
-    return ret;
+        return NULL;
+    *plen = js_array_buffer_get_len(p);
+    return js_array_buffer_get_buf(p);
 }
 
-JSValue js_array_shift(JSContext *ctx, JSValue *this_val,
-                       int argc, JSValue *argv)
+void *JS_GetTypedArray(JSContext *ctx, size_t *plen, JSValue obj,
+                       int class_id)
 {
     JSObject *p;
-    JSValue ret;
-    
-    p = js_get_array(ctx, *this_val);
+    uint8_t *buf;
+    int size_log2;
+
+    if (class_id < JS_CLASS_UINT8C_ARRAY || class_id > JS_CLASS_FLOAT64_ARRAY)
+        return NULL;
+    p = js_get_object_class(ctx, obj, class_id);
     if (!p)
-        return JS_EXCEPTION;
-    if (p->u.array.len > 0) {
-        JSValueArray *arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        ret = arr->arr[0];
-        p->u.array.len--;
-        memmove(arr->arr, arr->arr + 1, p->u.array.len * sizeof(JSValue));
-    } else {
-        ret = JS_UNDEFINED;
-    }
-    return ret;
+        return NULL;
+    size_log2 = typed_array_size_log2[class_id - JS_CLASS_UINT8C_ARRAY];
+    buf = js_array_buffer_get_buf(JS_VALUE_TO_PTR(p->u.typed_array.buffer));
+    *plen = p->u.typed_array.len;
+    return buf + (p->u.typed_array.offset << size_log2);
 }
-
-JSValue js_array_join(JSContext *ctx, JSValue *this_val,
-                      int argc, JSValue *argv)
-{
-    uint32_t i, len;
-    BOOL is_array;
-    JSValue sep, val;
-    JSGCRef sep_ref;
-    JSObject *p;
-    JSValueArray *arr;
-    StringBuffer b_s, *b = &b_s;
-    
-    if (!JS_IsObject(ctx, *this_val))
-        return JS_ThrowTypeErrorNotAnObject(ctx);
-    p = JS_VALUE_TO_PTR(*this_val);
-    is_array = (p->class_id == JS_CLASS_ARRAY);
-    if (is_array) {
-        len = p->u.array.len;
-    } else {
-        if (js_get_length32(ctx, &len, *this_val))
-            return JS_EXCEPTION;
-    }
-
-    if (argc > 0 && !JS_IsUndefined(argv[0])) {
-        sep = JS_ToString(ctx, argv[0]);
-        if (JS_IsException(sep))
-            return sep;
-    } else {
-        sep = JS_NewStringChar(',');
-    }
-    JS_PUSH_VALUE(ctx, sep);
-
-    string_buffer_push(ctx, b, 0);
-    for(i = 0; i < len; i++) {
-        if (i > 0) {
-            if (string_buffer_concat(ctx, b, sep_ref.val))
-                goto exception;
-        }
-        if (is_array) {
-            p = JS_VALUE_TO_PTR(*this_val);
-            arr = JS_VALUE_TO_PTR(p->u.array.tab);
-            if (i < p->u.array.len)
-                val = arr->arr[i];
-            else
-                val = JS_UNDEFINED;
-        } else {
-            val = JS_GetPropertyUint32(ctx, *this_val, i);
-            if (JS_IsException(val))
-                goto exception;
-        }
-        if (!JS_IsUndefined(val) && !JS_IsNull(val)) {
-            if (string_buffer_concat(ctx, b, val))
-                goto exception;
-        }
-    }
-    val = string_buffer_pop(ctx, b);
-    JS_POP_VALUE(ctx, sep);
-    return val;
-
- exception:
-    string_buffer_pop(ctx, b);
-    JS_POP_VALUE(ctx, sep);
-    return JS_EXCEPTION;
+
+JSValue js_array_buffer_constructor(JSContext *ctx, JSValue *this_val,
+                                    int argc, JSValue *argv)
+{
+    uint64_t len;
+    if (!(argc & FRAME_CF_CTOR))
+        return JS_ThrowTypeError(ctx, "must be called with new");
+    if (JS_ToIndex(ctx, &len, argv[0]))
+        return JS_EXCEPTION;
+    return js_array_buffer_alloc(ctx, len);
 }
 
-JSValue js_array_toString(JSContext *ctx, JSValue *this_val,
-                          int argc, JSValue *argv)
+JSValue js_array_buffer_get_byteLength(JSContext *ctx, JSValue *this_val,
+                                      int argc, JSValue *argv)
 {
-    return js_array_join(ctx, this_val, 0, NULL);
+    JSObject *p = js_get_object_class(ctx, *this_val, JS_CLASS_ARRAY_BUFFER);
+    if (!p)
+        return JS_ThrowTypeError(ctx, "expected an ArrayBuffer");
+    return JS_NewShortInt(js_array_buffer_get_len(p));
 }
 
-JSValue js_array_isArray(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv)
+JSValue js_typed_array_base_constructor(JSContext *ctx, JSValue *this_val,
+                                        int argc, JSValue *argv)
 {
-    JSObject *p;
-    p = js_get_object_class(ctx, argv[0], JS_CLASS_ARRAY);
-    return JS_NewBool(p != NULL);
+    return JS_ThrowTypeError(ctx, "cannot be called");
 }
 
-JSValue js_array_reverse(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv)
+static JSValue js_typed_array_constructor_obj(JSContext *ctx, JSValue *this_val,
+                                              int argc, JSValue *argv, int magic)
 {
-    int len;
+    int i, len;
+    JSValue val, obj;
+    JSGCRef obj_ref;
     JSObject *p;
-    JSValueArray *arr;
+    
+    p = JS_VALUE_TO_PTR(argv[0]);
+    if (p->class_id == JS_CLASS_ARRAY) {
+        len = p->u.array.len;
+    } else if (p->class_id >= JS_CLASS_UINT8C_ARRAY &&
+               p->class_id <= JS_CLASS_FLOAT64_ARRAY) {
+        len = p->u.typed_array.len;
+    } else {
+        return JS_ThrowTypeError(ctx, "unsupported object class");
+    }
+    val = JS_NewShortInt(len);
+    obj = js_typed_array_constructor(ctx, NULL, 1 | FRAME_CF_CTOR, &val, magic);
+    if (JS_IsException(obj))
+        return obj;
 
-    p = js_get_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
-    len = p->u.array.len;
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    js_reverse_val(arr->arr, len);
-    return *this_val;
+    for(i = 0; i < len; i++) {
+        JS_PUSH_VALUE(ctx, obj);
+        val = JS_GetProperty(ctx, argv[0], JS_NewShortInt(i));
+        JS_POP_VALUE(ctx, obj);
+        if (JS_IsException(val))
+            return val;
+        JS_PUSH_VALUE(ctx, obj);
+        val = JS_SetPropertyInternal(ctx, obj, JS_NewShortInt(i), val, FALSE);
+        JS_POP_VALUE(ctx, obj);
+        if (JS_IsException(val))
+            return val;
+    }
+    return obj;
 }
 
-JSValue js_array_concat(JSContext *ctx, JSValue *this_val,
-                      int argc, JSValue *argv)
+JSValue js_typed_array_constructor(JSContext *ctx, JSValue *this_val,
+                                   int argc, JSValue *argv, int magic)
 {
+    int size_log2;
+    uint64_t len, offset, byte_length;
     JSObject *p;
-    int len, i, j, pos;
-    int64_t len64;
-    JSValue obj, val;
-    JSValueArray *arr, *arr1;
+    JSValue buffer, obj;
+    JSGCRef buffer_ref;
     
-    p = js_get_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
-    /* do a first pass to estimate the length */
-    len64 = p->u.array.len;
-    for(i = 0; i < argc; i++) {
-        p = js_get_object_class(ctx, argv[i], JS_CLASS_ARRAY);
-        if (p) {
-            len64 += p->u.array.len;
+    if (!(argc & FRAME_CF_CTOR))
+        return JS_ThrowTypeError(ctx, "must be called with new");
+    size_log2 = typed_array_size_log2[magic - JS_CLASS_UINT8C_ARRAY];
+    if (!JS_IsObject(ctx, argv[0])) {
+        if (JS_ToIndex(ctx, &len, argv[0]))
+            return JS_EXCEPTION;
+        buffer = js_array_buffer_alloc(ctx, len << size_log2);
+        if (JS_IsException(buffer))
+            return JS_EXCEPTION;
+        offset = 0;
+    } else {
+        p = JS_VALUE_TO_PTR(argv[0]);
+        if (p->class_id == JS_CLASS_ARRAY_BUFFER) {
+            /* an external buffer may not be aligned */
+            if (((uintptr_t)js_array_buffer_get_buf(p) &
+                 ((1 << size_log2) - 1)) != 0)
+                return JS_ThrowRangeError(ctx, "unaligned array buffer");
+            byte_length = js_array_buffer_get_len(p);
+            if (JS_ToIndex(ctx, &offset, argv[1]))
+                return JS_EXCEPTION;
+            if ((offset & ((1 << size_log2) - 1)) != 0 ||
+                offset > byte_length)
+                return JS_ThrowRangeError(ctx, "invalid offset");
+            if (JS_IsUndefined(argv[2])) {
+                if ((byte_length & ((1 << size_log2) - 1)) != 0)
+                    goto invalid_length;
+                len = (byte_length - offset) >> size_log2;
+            } else {
+                if (JS_ToIndex(ctx, &len, argv[2]))
+                    return JS_EXCEPTION;
+                if ((offset + (len << size_log2)) > byte_length) {
+            invalid_length:
+                    return JS_ThrowRangeError(ctx, "invalid length");
+                }
+            }
+            buffer = argv[0];
+            offset >>= size_log2;
         } else {
-            len64++;
+            return js_typed_array_constructor_obj(ctx, this_val,
+                                                  argc, argv, magic);
         }
     }
-    if (len64 > JS_SHORTINT_MAX)
-        return JS_ThrowTypeError(ctx, "Array loo long");
-    len = len64;
-
-    obj = JS_NewArray(ctx, len);
+    
+    JS_PUSH_VALUE(ctx, buffer);
+    obj = JS_NewObjectClass(ctx, magic, sizeof(JSTypedArray));
+    JS_POP_VALUE(ctx, buffer);
     if (JS_IsException(obj))
         return obj;
     p = JS_VALUE_TO_PTR(obj);
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    
-    pos = 0;
-    for(i = -1; i < argc; i++) {
-        val = i == -1 ? *this_val : argv[i];
-        p = js_get_object_class(ctx, val, JS_CLASS_ARRAY);
-        if (p) {
-            arr1 = JS_VALUE_TO_PTR(p->u.array.tab);
-            for(j = 0; j < p->u.array.len; j++)
-                arr->arr[pos + j] = arr1->arr[j];
-            pos += p->u.array.len;
-        } else {
-            arr->arr[pos++] = val;
-        }
-    }
+    p->u.typed_array.buffer = buffer;
+    p->u.typed_array.offset = offset;
+    p->u.typed_array.len = len;
     return obj;
 }
 
-JSValue js_array_indexOf(JSContext *ctx, JSValue *this_val,
-                         int argc, JSValue *argv, int is_lastIndexOf)
+static JSObject *get_typed_array(JSContext *ctx, JSValue val)
 {
     JSObject *p;
-    int len, n, res;
-    JSValueArray *arr;
-    
-    p = js_get_array(ctx, *this_val);
+    if (!JS_IsObject(ctx, val))
+        goto fail;
+    p = JS_VALUE_TO_PTR(val);
+    if (!(p->class_id >= JS_CLASS_UINT8C_ARRAY && p->class_id <= JS_CLASS_FLOAT64_ARRAY)) {
+    fail:
+        JS_ThrowTypeError(ctx, "not a TypedArray");
+        return NULL;
+    }
+    return p;
+}
+
+/* return a pointer to the first element of the typed array */
+static uint8_t *js_typed_array_get_buf(JSObject *p)
+{
+    int size_log2;
+    size_log2 = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
+    return js_array_buffer_get_buf(JS_VALUE_TO_PTR(p->u.typed_array.buffer)) +
+        (p->u.typed_array.offset << size_log2);
+}
+
+JSValue js_typed_array_get_length(JSContext *ctx, JSValue *this_val,
+                                  int argc, JSValue *argv, int magic)
+{
+    JSObject *p;
+    int size_log2;
+
+    p = get_typed_array(ctx, *this_val);
     if (!p)
         return JS_EXCEPTION;
-    len = p->u.array.len;
-    if (is_lastIndexOf) {
-        n = len - 1;
-    } else {
-        n = 0;
-    }
-    if (argc > 1) {
-        if (JS_ToInt32Clamp(ctx, &n, argv[1],
-                            -is_lastIndexOf, len - is_lastIndexOf, len))
-            return JS_EXCEPTION;
-    }
-    /* the array may be modified */
-    p = JS_VALUE_TO_PTR(*this_val);
-    len = p->u.array.len; /* the length may be modified */
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    res = -1;
-    if (is_lastIndexOf) {
-        n = min_int(n, len - 1);
-        for(;n >= 0; n--) {
-            if (js_strict_eq(ctx, argv[0], arr->arr[n])) {
-                res = n;
-                break;
-            }
-        }
-    } else {
-        for(;n < len; n++) {
-            if (js_strict_eq(ctx, argv[0], arr->arr[n])) {
-                res = n;
-                break;
-            }
-        }
+    size_log2 = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
+    switch(magic) {
+    default:
+    case 0:
+        return JS_NewShortInt(p->u.typed_array.len);
+    case 1:
+        return JS_NewShortInt(p->u.typed_array.len << size_log2);
+    case 2:
+        return JS_NewShortInt(p->u.typed_array.offset << size_log2);
+    case 3:
+        return p->u.typed_array.buffer;
     }
-    return JS_NewShortInt(res);
 }
 
-JSValue js_array_slice(JSContext *ctx, JSValue *this_val,
-                       int argc, JSValue *argv)
+JSValue js_typed_array_subarray(JSContext *ctx, JSValue *this_val,
+                                int argc, JSValue *argv)
 {
-    JSObject *p, *p1;
-    int len, start, final, k;
-    JSValueArray *arr, *arr1;
+    JSObject *p;
+    int start, final, len;
+    uint32_t offset, count;
     JSValue obj;
     
-    p = js_get_array(ctx, *this_val);
+    p = get_typed_array(ctx, *this_val);
     if (!p)
         return JS_EXCEPTION;
-    len = p->u.array.len;
-
+    len = p->u.typed_array.len;
     if (JS_ToInt32Clamp(ctx, &start, argv[0], 0, len, len))
         return JS_EXCEPTION;
-    final = len;
-    if (!JS_IsUndefined(argv[1])) {
+    if (JS_IsUndefined(argv[1])) {
+        final = len;
+    } else {
         if (JS_ToInt32Clamp(ctx, &final, argv[1], 0, len, len))
             return JS_EXCEPTION;
     }
-    /* the array may have been modified */
     p = JS_VALUE_TO_PTR(*this_val);
-    len = p->u.array.len; /* the length may be modified */
-    final = min_int(final, len);
+    offset = p->u.typed_array.offset + start;
+    count = max_int(final - start, 0);
 
-    obj = JS_NewArray(ctx, max_int(final - start, 0));
+    /* check offset and count */
+    if (offset + count > js_array_buffer_get_len(JS_VALUE_TO_PTR(p->u.typed_array.buffer)))
+        return JS_ThrowRangeError(ctx, "invalid length");
+        
+    obj = JS_NewObjectClass(ctx, p->class_id, sizeof(JSTypedArray));
     if (JS_IsException(obj))
-        return obj;
+        return JS_EXCEPTION;
     p = JS_VALUE_TO_PTR(*this_val);
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    p1 = JS_VALUE_TO_PTR(obj);
-    arr1 = JS_VALUE_TO_PTR(p1->u.array.tab);
-    for(k = start; k < final; k++) {
-        arr1->arr[k - start] = arr->arr[k];
+    {
+        JSObject *p1 = JS_VALUE_TO_PTR(obj);
+        p1->u.typed_array.buffer = p->u.typed_array.buffer;
+        p1->u.typed_array.offset = offset;
+        p1->u.typed_array.len = count;
     }
     return obj;
 }
 
-JSValue js_array_splice(JSContext *ctx, JSValue *this_val,
-                        int argc, JSValue *argv)
+JSValue js_typed_array_set(JSContext *ctx, JSValue *this_val,
+                                int argc, JSValue *argv)
 {
     JSObject *p, *p1;
-    int start, len, item_count, del_count, new_len, i, ret;
-    JSValueArray *arr, *arr1;
-    JSValue obj;
-    JSGCRef obj_ref;
-    
-    p = js_get_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
-    len = p->u.array.len;
+    uint32_t dst_len, src_len, i;
+    int offset;
 
-    if (JS_ToInt32Clamp(ctx, &start, argv[0], 0, len, len))
+    p = get_typed_array(ctx, *this_val);
+    if (!p)
         return JS_EXCEPTION;
-
-    if (argc == 0) {
-        item_count = 0;
-        del_count = 0;
-    } else if (argc == 1) {
-        item_count = 0;
-        del_count = len - start;
-    } else {
-        item_count = argc - 2;
-        if (JS_ToInt32Clamp(ctx, &del_count, argv[1], 0, len - start, 0))
+    if (argc > 1) {
+        if (JS_ToInt32Sat(ctx, &offset, argv[1]))
             return JS_EXCEPTION;
+    } else {
+        offset = 0;
     }
-    new_len = len + item_count - del_count;
-    
-    obj = JS_NewArray(ctx, del_count);
-    if (JS_IsException(obj))
-        return obj;
+    if (offset < 0)
+        goto range_error;
+    if (!JS_IsObject(ctx, argv[0]))
+        return JS_ThrowTypeErrorNotAnObject(ctx);
     p = JS_VALUE_TO_PTR(*this_val);
-    /* handling this case has no practical use */
-    if (p->u.array.len != len)
-        return JS_ThrowTypeError(ctx, "array length was modified");
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    p1 = JS_VALUE_TO_PTR(obj);
-    arr1 = JS_VALUE_TO_PTR(p1->u.array.tab);
-
-    for(i = 0; i < del_count; i++) {
-        arr1->arr[i] = arr->arr[start + i];
-    }
-
-    if (item_count != del_count) {
-        /* resize */
-        if (del_count > item_count) {
-            memmove(arr->arr + start + item_count,
-                    arr->arr + start + del_count,
-                    (len - (start + del_count)) * sizeof(JSValue));
+    dst_len = p->u.typed_array.len;
+    p1 = JS_VALUE_TO_PTR(argv[0]);
+    if (p1->class_id >= JS_CLASS_UINT8C_ARRAY &&
+        p1->class_id <= JS_CLASS_FLOAT64_ARRAY) {
+        src_len = p1->u.typed_array.len;
+        if (src_len > dst_len || offset > dst_len - src_len)
+            goto range_error;
+        if (p1->class_id == p->class_id) {
+            int shift = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
+            /* same type: must copy to preserve float bits */
+            memmove(js_typed_array_get_buf(p) + (offset << shift),
+                    js_typed_array_get_buf(p1), src_len << shift);
+            goto done;
         }
-        JS_PUSH_VALUE(ctx, obj);
-        ret = js_array_resize(ctx, this_val, new_len);
-        JS_POP_VALUE(ctx, obj);
-        if (ret)
+    } else {
+        if (js_get_length32(ctx, (uint32_t *)&src_len, argv[0]))
             return JS_EXCEPTION;
-        p = JS_VALUE_TO_PTR(*this_val);
-        arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        if (del_count < item_count) {
-            memmove(arr->arr + start + item_count,
-                    arr->arr + start + del_count,
-                    (len - (start + del_count)) * sizeof(JSValue));
+        if (src_len > dst_len || offset > dst_len - src_len) {
+        range_error:
+            return JS_ThrowRangeError(ctx, "invalid array length");
         }
     }
-
-    for(i = 0; i < item_count; i++)
-        arr->arr[start + i] = argv[2 + i];
-    
-    return obj;
+    for(i = 0; i < src_len; i++) {
+        JSValue val;
+        val = JS_GetPropertyUint32(ctx, argv[0], i);
+        if (JS_IsException(val))
+            return JS_EXCEPTION;
+        val = JS_SetPropertyUint32(ctx, *this_val, offset + i, val);
+        if (JS_IsException(val))
+            return JS_EXCEPTION;
+    }
+ done:
+    return JS_UNDEFINED;
 }
 
-JSValue js_array_every(JSContext *ctx, JSValue *this_val,
-                       int argc, JSValue *argv, int special)
+static double js_typed_array_get_double(int class_id, const uint8_t *buf,
+                                        uint32_t idx)
+{
+    switch(class_id) {
+    default:
+    case JS_CLASS_UINT8C_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+        return ((const uint8_t *)buf)[idx];
+    case JS_CLASS_INT8_ARRAY:
+        return ((const int8_t *)buf)[idx];
+    case JS_CLASS_INT16_ARRAY:
+        return ((const int16_t *)buf)[idx];
+    case JS_CLASS_UINT16_ARRAY:
+        return ((const uint16_t *)buf)[idx];
+    case JS_CLASS_INT32_ARRAY:
+        return ((const int32_t *)buf)[idx];
+    case JS_CLASS_UINT32_ARRAY:
+        return ((const uint32_t *)buf)[idx];
+    case JS_CLASS_FLOAT32_ARRAY:
+        return ((const float *)buf)[idx];
+    case JS_CLASS_FLOAT64_ARRAY:
+        return ((const double *)buf)[idx];
+    }
+}
+
+JSValue js_typed_array_fill(JSContext *ctx, JSValue *this_val,
+                            int argc, JSValue *argv)
 {
     JSObject *p;
-    JSValueArray *arr;
-    JSValue res, ret, val;
-    JSValue *pfunc, *pthis_arg;
-    JSGCRef val_ref, ret_ref;
-    int len, k, n;
+    int len, start, final, shift, v, i;
+    double d;
+    uint8_t *buf;
+    union {
+        uint16_t u16;
+        uint32_t u32;
+        uint64_t u64;
+        float f;
+        double d;
+    } u;
 
-    p = js_get_array(ctx, *this_val);
+    p = get_typed_array(ctx, *this_val);
     if (!p)
         return JS_EXCEPTION;
-    len = p->u.array.len;
-
-    pfunc = &argv[0];
-    pthis_arg = NULL;
-    if (argc > 1)
-        pthis_arg = &argv[1];
-
-    if (!JS_IsFunction(ctx, *pfunc))
-        return JS_ThrowTypeError(ctx, "not a function");
-    
-    switch (special) {
-    case js_special_every:
-        ret = JS_TRUE;
-        break;
-    case js_special_some:
-        ret = JS_FALSE;
+    len = p->u.typed_array.len;
+    switch(p->class_id) {
+    case JS_CLASS_UINT8C_ARRAY:
+        if (JS_ToUint8Clamp(ctx, &v, argv[0]))
+            return JS_EXCEPTION;
+        u.u32 = v;
         break;
-    case js_special_map:
-        ret = JS_NewArray(ctx, len);
-        if (JS_IsException(ret))
+    case JS_CLASS_FLOAT32_ARRAY:
+        if (JS_ToNumber(ctx, &d, argv[0]))
             return JS_EXCEPTION;
+        u.f = d;
         break;
-    case js_special_filter:
-        ret = JS_NewArray(ctx, 0);
-        if (JS_IsException(ret))
+    case JS_CLASS_FLOAT64_ARRAY:
+        if (JS_ToNumber(ctx, &d, argv[0]))
             return JS_EXCEPTION;
+        u.d = d;
         break;
-    case js_special_forEach:
     default:
-        ret = JS_UNDEFINED;
+        if (JS_ToInt32(ctx, &v, argv[0]))
+            return JS_EXCEPTION;
+        if (p->class_id <= JS_CLASS_UINT16_ARRAY)
+            u.u16 = v;
+        else
+            u.u32 = v;
         break;
     }
-    n = 0;
-
-    JS_PUSH_VALUE(ctx, ret);
-    for(k = 0; k < len; k++) {
-        if (JS_StackCheck(ctx, 5))
-            goto exception;
-
-        p = JS_VALUE_TO_PTR(*this_val);
-        arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        /* the array length may have been modified by the function call*/
-        if (k >= p->u.array.len)
-            break;
-        val = arr->arr[k];
-        
-        JS_PushArg(ctx, *this_val);
-        JS_PushArg(ctx, JS_NewShortInt(k));
-        JS_PushArg(ctx, val); /* arg0 */
-        JS_PushArg(ctx, *pfunc); /* func */
-        JS_PushArg(ctx, pthis_arg ? *pthis_arg : JS_UNDEFINED); /* this */
-        JS_PUSH_VALUE(ctx, val);
-        res = JS_Call(ctx, 3);
-        JS_POP_VALUE(ctx, val);
-        if (JS_IsException(res))
-            goto exception;
-        
-        switch (special) {
-        case js_special_every:
-            if (!JS_ToBool(ctx, res)) {
-                ret_ref.val = JS_FALSE;
-                goto done;
-            }
-            break;
-        case js_special_some:
-            if (JS_ToBool(ctx, res)) {
-                ret_ref.val = JS_TRUE;
-                goto done;
-            }
-            break;
-        case js_special_map:
-            /* Note: same as defineProperty for arrays */
-            res = JS_SetPropertyUint32(ctx, ret_ref.val, k, res);
-            if (JS_IsException(res))
-                goto exception;
-            break;
-        case js_special_filter:
-            if (JS_ToBool(ctx, res)) {
-                res = JS_SetPropertyUint32(ctx, ret_ref.val, n++, val);
-                if (JS_IsException(res))
-                    goto exception;
-            }
-            break;
-        case js_special_forEach:
-        default:
-            break;
-        }
-    }
-done:
-    JS_POP_VALUE(ctx, ret);
-    return ret;
- exception:
-    ret_ref.val = JS_EXCEPTION;
-    goto done;
-}
-
-JSValue js_array_reduce(JSContext *ctx, JSValue *this_val,
-                        int argc, JSValue *argv, int special)
-{
-    JSObject *p;
-    JSValueArray *arr;
-    JSValue acc, *pfunc;
-    JSGCRef acc_ref;
-    int len, k, k1, ret;
-
-    p = js_get_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
-    len = p->u.array.len;
-    pfunc = &argv[0];
-
-    if (!JS_IsFunction(ctx, *pfunc))
-        return JS_ThrowTypeError(ctx, "not a function");
-
-    k = 0;
+    start = 0;
     if (argc > 1) {
-        acc = argv[1];
-    } else {
-        if (len == 0)
-            return JS_ThrowTypeError(ctx, "empty array");
-        k1 = (special == js_special_reduceRight) ? len - k - 1 : k;
-        arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        acc = arr->arr[k1];
-        k++;
+        if (JS_ToInt32Clamp(ctx, &start, argv[1], 0, len, len))
+            return JS_EXCEPTION;
     }
-    for (; k < len; k++) {
-        JS_PUSH_VALUE(ctx, acc);
-        ret = JS_StackCheck(ctx, 6);
-        JS_POP_VALUE(ctx, acc);
-        if (ret)
+    final = len;
+    if (argc > 2 && !JS_IsUndefined(argv[2])) {
+        if (JS_ToInt32Clamp(ctx, &final, argv[2], 0, len, len))
             return JS_EXCEPTION;
+    }
 
-        k1 = (special == js_special_reduceRight) ? len - k - 1 : k;
-        p = JS_VALUE_TO_PTR(*this_val);
-        arr = JS_VALUE_TO_PTR(p->u.array.tab);
-        /* Note: the array length may have been modified, hence the check */
-        if (k1 >= p->u.array.len)
-            break;
-        
-        JS_PushArg(ctx, *this_val);
-        JS_PushArg(ctx, JS_NewShortInt(k1));
-        JS_PushArg(ctx, arr->arr[k1]);
-        JS_PushArg(ctx, acc); /* arg0 */
-        JS_PushArg(ctx, *pfunc); /* func */
-        JS_PushArg(ctx, JS_UNDEFINED); /* this */
-        acc = JS_Call(ctx, 4);
-        if (JS_IsException(acc))
-            return JS_EXCEPTION;
+    p = JS_VALUE_TO_PTR(*this_val);
+    shift = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
+    buf = js_typed_array_get_buf(p);
+    switch(shift) {
+    case 0:
+        if (start < final)
+            memset(buf + start, u.u32, final - start);
+        break;
+    case 1:
+        for(i = start; i < final; i++)
+            ((uint16_t *)buf)[i] = u.u16;
+        break;
+    case 2:
+        for(i = start; i < final; i++)
+            ((uint32_t *)buf)[i] = u.u32;
+        break;
+    case 3:
+        for(i = start; i < final; i++)
+            ((uint64_t *)buf)[i] = u.u64;
+        break;
     }
-    return acc;
+    return *this_val;
 }
 
-/* heapsort algorithm */
-static void rqsort_idx(size_t nmemb,
-                       int (*cmp)(size_t, size_t, void *),
-                       void (*swap)(size_t, size_t, void *),
-                       void *opaque)
+JSValue js_typed_array_copyWithin(JSContext *ctx, JSValue *this_val,
+                                  int argc, JSValue *argv)
 {
-    size_t i, n, c, r, size;
-
-    size = 1;
-    if (nmemb > 1) {
-        i = (nmemb / 2) * size;
-        n = nmemb * size;
-
-        while (i > 0) {
-            i -= size;
-            for (r = i; (c = r * 2 + size) < n; r = c) {
-                if (c < n - size && cmp(c, c + size, opaque) <= 0)
-                    c += size;
-                if (cmp(r, c, opaque) > 0)
-                    break;
-                swap(r, c, opaque);
-            }
-        }
-        for (i = n - size; i > 0; i -= size) {
-            swap(0, i, opaque);
+    JSObject *p;
+    int len, to, from, final, count, shift;
+    uint8_t *buf;
 
-            for (r = 0; (c = r * 2 + size) < i; r = c) {
-                if (c < i - size && cmp(c, c + size, opaque) <= 0)
-                    c += size;
-                if (cmp(r, c, opaque) > 0)
-                    break;
-                swap(r, c, opaque);
-            }
-        }
+    p = get_typed_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.typed_array.len;
+    if (JS_ToInt32Clamp(ctx, &to, argv[0], 0, len, len))
+        return JS_EXCEPTION;
+    if (JS_ToInt32Clamp(ctx, &from, argv[1], 0, len, len))
+        return JS_EXCEPTION;
+    final = len;
+    if (argc > 2 && !JS_IsUndefined(argv[2])) {
+        if (JS_ToInt32Clamp(ctx, &final, argv[2], 0, len, len))
+            return JS_EXCEPTION;
+    }
+    count = min_int(final - from, len - to);
+    if (count > 0) {
+        p = JS_VALUE_TO_PTR(*this_val);
+        shift = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
+        buf = js_typed_array_get_buf(p);
+        memmove(buf + (to << shift), buf + (from << shift), count << shift);
     }
+    return *this_val;
 }
 
-typedef struct {
-    JSContext *ctx;
-    BOOL exception;
-    JSValue *parr;
-    JSValue *pfunc;
-} JSArraySortContext;
-
-/* return -1, 0, 1  */
-static int js_array_sort_cmp(size_t i1, size_t i2, void *opaque)
+/* 'v' is the searched element converted to the element type */
+#define TA_INDEX_OF(type, v)                                            \
+    {                                                                   \
+        const type *tab = (const type *)buf;                            \
+        if (is_lastIndexOf) {                                           \
+            for(; n >= 0; n--) {                                        \
+                if (tab[n] == v)                                        \
+                    return JS_NewShortInt(n);                           \
+            }                                                           \
+        } else {                                                        \
+            for(; n < len; n++) {                                       \
+                if (tab[n] == v)                                        \
+                    return JS_NewShortInt(n);                           \
+            }                                                           \
+        }                                                               \
+    }                                                                   \
+    break
+
+JSValue js_typed_array_indexOf(JSContext *ctx, JSValue *this_val,
+                               int argc, JSValue *argv, int is_lastIndexOf)
 {
-    JSArraySortContext *s = opaque;
-    JSContext *ctx = s->ctx;
-    JSValueArray *arr;
-    int cmp, j1, j2;
-    
-    if (s->exception)
-        return 0;
-
-    arr = JS_VALUE_TO_PTR(*s->parr);
-    if (s->pfunc) {
-        JSValue res;
-        /* custom sort function is specified as returning 0 for identical
-         * objects: avoid method call overhead.
-         */
-        if (arr->arr[2 * i1] == arr->arr[2 * i2])
-            goto cmp_same;
-        if (JS_StackCheck(ctx, 4))
-            goto exception;
-        arr = JS_VALUE_TO_PTR(*s->parr);
+    JSObject *p;
+    int len, n;
+    int64_t v;
+    double d;
+    uint8_t *buf;
 
-        JS_PushArg(ctx, arr->arr[2 * i2]);
-        JS_PushArg(ctx, arr->arr[2 * i1]); /* arg0 */
-        JS_PushArg(ctx, *s->pfunc); /* func */
-        JS_PushArg(ctx, JS_UNDEFINED); /* this */
-        res = JS_Call(ctx, 2);
-        if (JS_IsException(res))
+    p = get_typed_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.typed_array.len;
+    if (is_lastIndexOf) {
+        n = len - 1;
+    } else {
+        n = 0;
+    }
+    if (argc > 1) {
+        if (JS_ToInt32Clamp(ctx, &n, argv[1],
+                            -is_lastIndexOf, len - is_lastIndexOf, len))
             return JS_EXCEPTION;
-        if (JS_IsInt(res)) {
-            int val = JS_VALUE_GET_INT(res);
-            cmp = (val > 0) - (val < 0);
-        } else {
-            double val;
-            if (JS_ToNumber(ctx, &val, res))
-                goto exception;
-            cmp = (val > 0) - (val < 0);
-        }
+    }
+    /* strict equality: only a number can match */
+    if (!JS_IsNumber(ctx, argv[0]))
+        return JS_NewShortInt(-1);
+    JS_ToNumber(ctx, &d, argv[0]);
+    p = JS_VALUE_TO_PTR(*this_val);
+    if (p->class_id < JS_CLASS_FLOAT32_ARRAY) {
+        /* only an integer can match an integer element. The range
+           check also excludes NaN */
+        if (!(d >= -2147483648.0 && d <= 4294967295.0))
+            return JS_NewShortInt(-1);
+        v = d;
+        if (v != d)
+            return JS_NewShortInt(-1);
     } else {
-        JSValue str1, str2;
-        JSGCRef str1_ref;
+        v = 0;
+    }
 
-        str1 = arr->arr[2 * i1];
-        if (!JS_IsString(ctx, str1)) {
-            str1 = JS_ToString(ctx, str1);
-            if (JS_IsException(str1))
-                goto exception;
-            arr = JS_VALUE_TO_PTR(*s->parr);
-        }
-        str2 = arr->arr[2 * i2];
-        if (!JS_IsString(ctx, str2)) {
-            JS_PUSH_VALUE(ctx, str1);
-            str2 = JS_ToString(ctx, str2);
-            JS_POP_VALUE(ctx, str1);
-            if (JS_IsException(str2))
-                goto exception;
-        }
-        cmp = js_string_compare(ctx, str1, str2);
+    buf = js_typed_array_get_buf(p);
+    switch(p->class_id) {
+    default:
+    case JS_CLASS_UINT8C_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+        TA_INDEX_OF(uint8_t, v);
+    case JS_CLASS_INT8_ARRAY:
+        TA_INDEX_OF(int8_t, v);
+    case JS_CLASS_INT16_ARRAY:
+        TA_INDEX_OF(int16_t, v);
+    case JS_CLASS_UINT16_ARRAY:
+        TA_INDEX_OF(uint16_t, v);
+    case JS_CLASS_INT32_ARRAY:
+        TA_INDEX_OF(int32_t, v);
+    case JS_CLASS_UINT32_ARRAY:
+        TA_INDEX_OF(uint32_t, v);
+    case JS_CLASS_FLOAT32_ARRAY:
+        TA_INDEX_OF(float, d);
+    case JS_CLASS_FLOAT64_ARRAY:
+        TA_INDEX_OF(double, d);
+    }
+    return JS_NewShortInt(-1);
+}
+
+#undef TA_INDEX_OF
+
+JSValue js_typed_array_slice(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv)
+{
+    JSObject *p, *p1;
+    int len, start, final, count, shift;
+    JSValue obj, val;
+
+    p = get_typed_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.typed_array.len;
+    if (JS_ToInt32Clamp(ctx, &start, argv[0], 0, len, len))
+        return JS_EXCEPTION;
+    final = len;
+    if (!JS_IsUndefined(argv[1])) {
+        if (JS_ToInt32Clamp(ctx, &final, argv[1], 0, len, len))
+            return JS_EXCEPTION;
     }
-    if (cmp != 0)
-        return cmp;
- cmp_same:
-    /* make sort stable: compare array offsets */
-    arr = JS_VALUE_TO_PTR(*s->parr);
-    j1 = JS_VALUE_GET_INT(arr->arr[2 * i1 + 1]);
-    j2 = JS_VALUE_GET_INT(arr->arr[2 * i2 + 1]);
-    return (j1 > j2) - (j1 < j2);
+    count = max_int(final - start, 0);
 
-exception:
-    s->exception = TRUE;
-    return 0;
+    p = JS_VALUE_TO_PTR(*this_val);
+    val = JS_NewShortInt(count);
+    obj = js_typed_array_constructor(ctx, NULL, 1 | FRAME_CF_CTOR, &val,
+                                     p->class_id);
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_TO_PTR(*this_val);
+    p1 = JS_VALUE_TO_PTR(obj);
+    shift = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
+    memcpy(js_typed_array_get_buf(p1), js_typed_array_get_buf(p) + (start << shift),
+           count << shift);
+    return obj;
 }
 
-static void js_array_sort_swap(size_t i1, size_t i2, void *opaque)
+/* Reductions. The loops are written so that the compiler can
+   vectorize them: the integer sums are computed exactly with 32 bit
+   partial sums over blocks short enough not to overflow. */
+
+#define TA_SUM_BLOCK_LEN 32768
+
+#define TA_SUM_INT(type)                                                \
+    {                                                                   \
+        const type *tab = (const type *)buf;                            \
+        int64_t sum = 0;                                                \
+        uint32_t i, j, n;                                               \
+        for(i = 0; i < len; i += n) {                                   \
+            int32_t s = 0;                                              \
+            n = min_uint32(len - i, TA_SUM_BLOCK_LEN);                  \
+            for(j = 0; j < n; j++)                                      \
+                s += tab[i + j];                                        \
+            sum += s;                                                   \
+        }                                                               \
+        r = sum;                                                        \
+    }                                                                   \
+    break
+
+#define TA_SUM(type, sum_type)                                          \
+    {                                                                   \
+        const type *tab = (const type *)buf;                            \
+        sum_type sum = 0;                                               \
+        uint32_t i;                                                     \
+        for(i = 0; i < len; i++)                                        \
+            sum += tab[i];                                              \
+        r = sum;                                                        \
+    }                                                                   \
+    break
+
+JSValue js_typed_array_sum(JSContext *ctx, JSValue *this_val,
+                           int argc, JSValue *argv)
 {
-    JSArraySortContext *s = opaque;
-    JSValueArray *arr;
-    JSValue tmp, *tab;
-    
-    arr = JS_VALUE_TO_PTR(*s->parr);
-    tab = arr->arr;
-    tmp = tab[2 * i1];
-    tab[2 * i1] = tab[2 * i2];
-    tab[2 * i2] = tmp;
+    JSObject *p;
+    uint32_t len;
+    uint8_t *buf;
+    double r;
 
-    tmp = tab[2 * i1 + 1];
-    tab[2 * i1 + 1] = tab[2 * i2 + 1];
-    tab[2 * i2 + 1] = tmp;
+    p = get_typed_array(ctx, *this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    len = p->u.typed_array.len;
+    buf = js_typed_array_get_buf(p);
+    switch(p->class_id) {
+    default:
+    case JS_CLASS_UINT8C_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+        TA_SUM_INT(uint8_t);
+    case JS_CLASS_INT8_ARRAY:
+        TA_SUM_INT(int8_t);
+    case JS_CLASS_INT16_ARRAY:
+        TA_SUM_INT(int16_t);
+    case JS_CLASS_UINT16_ARRAY:
+        TA_SUM_INT(uint16_t);
+    case JS_CLASS_INT32_ARRAY:
+        TA_SUM(int32_t, int64_t);
+    case JS_CLASS_UINT32_ARRAY:
+        TA_SUM(uint32_t, int64_t);
+    case JS_CLASS_FLOAT32_ARRAY:
+        TA_SUM(float, double);
+    case JS_CLASS_FLOAT64_ARRAY:
+        TA_SUM(double, double);
+    }
+    return JS_NewFloat64(ctx, r);
 }
 
-JSValue js_array_sort(JSContext *ctx, JSValue *this_val,
-                      int argc, JSValue *argv)
+#undef TA_SUM_INT
+#undef TA_SUM
+
+#define TA_MIN_MAX_INT(type)                                            \
+    {                                                                   \
+        const type *tab = (const type *)buf;                            \
+        type m = tab[0];                                                \
+        uint32_t i;                                                     \
+        if (is_max) {                                                   \
+            for(i = 1; i < len; i++)                                    \
+                m = tab[i] > m ? tab[i] : m;                            \
+        } else {                                                        \
+            for(i = 1; i < len; i++)                                    \
+                m = tab[i] < m ? tab[i] : m;                            \
+        }                                                               \
+        r = m;                                                          \
+    }                                                                   \
+    break
+
+/* same result as Math.min() and Math.max() on the elements */
+JSValue js_typed_array_min_max(JSContext *ctx, JSValue *this_val,
+                               int argc, JSValue *argv, int is_max)
 {
-    JSValue *pfunc = &argv[0];
     JSObject *p;
-    JSValue tab_val;
-    JSGCRef tab_val_ref;
-    JSValueArray *tab, *arr;
-    int i, len, n;
-    JSArraySortContext ss, *s = &ss;
-    
-    if (!JS_IsUndefined(*pfunc)) {
-        if (!JS_IsFunction(ctx, *pfunc))
-            return JS_ThrowTypeError(ctx, "not a function");
-    } else {
-        pfunc = NULL;
-    }
-    p = js_get_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
+    uint32_t len, i;
+    uint8_t *buf;
+    double r, a;
 
-    /* create a temporary array for sorting */
-    len = p->u.array.len;
-    tab = js_alloc_value_array(ctx, 0, len * 2);
-    if (!tab)
+    p = get_typed_array(ctx, *this_val);
+    if (!p)
         return JS_EXCEPTION;
-
-    p = JS_VALUE_TO_PTR(*this_val);
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    n = 0;
-    for(i = 0; i < len; i++) {
-        if (!JS_IsUndefined(arr->arr[i])) {
-            tab->arr[2 * n] = arr->arr[i];
-            tab->arr[2 * n + 1] = JS_NewShortInt(i);
-            n++;
+    len = p->u.typed_array.len;
+    if (len == 0)
+        return __JS_NewFloat64(ctx, is_max ? -1.0 / 0.0 : 1.0 / 0.0);
+    buf = js_typed_array_get_buf(p);
+    switch(p->class_id) {
+    default:
+    case JS_CLASS_UINT8C_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+        TA_MIN_MAX_INT(uint8_t);
+    case JS_CLASS_INT8_ARRAY:
+        TA_MIN_MAX_INT(int8_t);
+    case JS_CLASS_INT16_ARRAY:
+        TA_MIN_MAX_INT(int16_t);
+    case JS_CLASS_UINT16_ARRAY:
+        TA_MIN_MAX_INT(uint16_t);
+    case JS_CLASS_INT32_ARRAY:
+        TA_MIN_MAX_INT(int32_t);
+    case JS_CLASS_UINT32_ARRAY:
+        TA_MIN_MAX_INT(uint32_t);
+    case JS_CLASS_FLOAT32_ARRAY:
+    case JS_CLASS_FLOAT64_ARRAY:
+        r = js_typed_array_get_double(p->class_id, buf, 0);
+        for(i = 1; i < len && !isnan(r); i++) {
+            a = js_typed_array_get_double(p->class_id, buf, i);
+            if (isnan(a))
+                r = a;
+            else if (is_max)
+                r = js_fmax(r, a);
+            else
+                r = js_fmin(r, a);
         }
+        break;
     }
-    /* the end of 'tab' is already filled with JS_UNDEFINED */
-    tab_val = JS_VALUE_FROM_PTR(tab);
-    
-    JS_PUSH_VALUE(ctx, tab_val);
-    s->ctx = ctx;
-    s->exception = FALSE;
-    s->parr = &tab_val_ref.val;
-    s->pfunc = pfunc;
-    rqsort_idx(n, js_array_sort_cmp, js_array_sort_swap, s);
-    JS_POP_VALUE(ctx, tab_val);
-    tab = JS_VALUE_TO_PTR(tab_val);
-    if (s->exception) {
-        js_free(ctx, tab);
+    return JS_NewFloat64(ctx, r);
+}
+
+#undef TA_MIN_MAX_INT
+
+/* sum of the products of the elements of two typed arrays of the same
+   length */
+JSValue js_typed_array_dot(JSContext *ctx, JSValue *this_val,
+                           int argc, JSValue *argv)
+{
+    JSObject *p, *p1;
+    uint32_t len, i;
+    const uint8_t *buf, *buf1;
+    double r;
+
+    p = get_typed_array(ctx, *this_val);
+    if (!p)
         return JS_EXCEPTION;
+    p1 = get_typed_array(ctx, argv[0]);
+    if (!p1)
+        return JS_EXCEPTION;
+    len = p->u.typed_array.len;
+    if (p1->u.typed_array.len != len)
+        return JS_ThrowRangeError(ctx, "typed arrays must have the same length");
+    buf = js_typed_array_get_buf(p);
+    buf1 = js_typed_array_get_buf(p1);
+    if (p->class_id == JS_CLASS_INT16_ARRAY &&
+        p1->class_id == JS_CLASS_INT16_ARRAY) {
+        const int16_t *tab = (const int16_t *)buf;
+        const int16_t *tab1 = (const int16_t *)buf1;
+        int64_t sum = 0;
+        for(i = 0; i < len; i++)
+            sum += (int32_t)tab[i] * tab1[i];
+        r = sum;
+    } else if (p->class_id == JS_CLASS_FLOAT32_ARRAY &&
+               p1->class_id == JS_CLASS_FLOAT32_ARRAY) {
+        const float *tab = (const float *)buf;
+        const float *tab1 = (const float *)buf1;
+        double sum = 0;
+        for(i = 0; i < len; i++)
+            sum += (double)tab[i] * tab1[i];
+        r = sum;
+    } else {
+        r = 0;
+        for(i = 0; i < len; i++) {
+            r += js_typed_array_get_double(p->class_id, buf, i) *
+                js_typed_array_get_double(p1->class_id, buf1, i);
+        }
     }
-    
-    p = JS_VALUE_TO_PTR(*this_val);
-    arr = JS_VALUE_TO_PTR(p->u.array.tab);
-    /* XXX: could resize the array in case it was shrank by the compare function */
-    len = min_int(len, p->u.array.len);
-    for(i = 0; i < len; i++) {
-        arr->arr[i] = tab->arr[2 * i];
-    }
-    js_free(ctx, tab);
-    return *this_val;
+    return JS_NewFloat64(ctx, r);
 }
 
-/**********************************************************************/
+/* DataView */
 
-/* precondition: a and b are not NaN */
-static double js_fmin(double a, double b)
+JSValue js_dataview_constructor(JSContext *ctx, JSValue *this_val,
+                                int argc, JSValue *argv)
 {
-    if (a == 0 && b == 0) {
-        return uint64_as_float64(float64_as_uint64(a) | float64_as_uint64(b));
-    } else if (a <= b) {
-        return a;
+    uint64_t offset, len, byte_length;
+    JSObject *p;
+    JSValue obj;
+
+    if (!(argc & FRAME_CF_CTOR))
+        return JS_ThrowTypeError(ctx, "must be called with new");
+    p = js_get_object_class(ctx, argv[0], JS_CLASS_ARRAY_BUFFER);
+    if (!p)
+        return JS_ThrowTypeError(ctx, "expected an ArrayBuffer");
+    byte_length = js_array_buffer_get_len(p);
+    if (JS_ToIndex(ctx, &offset, argv[1]))
+        return JS_EXCEPTION;
+    if (offset > byte_length)
+        return JS_ThrowRangeError(ctx, "invalid offset");
+    if (JS_IsUndefined(argv[2])) {
+        len = byte_length - offset;
     } else {
-        return b;
+        if (JS_ToIndex(ctx, &len, argv[2]))
+            return JS_EXCEPTION;
+        if (offset + len > byte_length)
+            return JS_ThrowRangeError(ctx, "invalid length");
+    }
+    obj = JS_NewObjectClass(ctx, JS_CLASS_DATA_VIEW, sizeof(JSTypedArray));
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_TO_PTR(obj);
+    p->u.typed_array.buffer = argv[0];
+    p->u.typed_array.offset = offset;
+    p->u.typed_array.len = len;
+    return obj;
+}
+
+JSValue js_dataview_get_length(JSContext *ctx, JSValue *this_val,
+                               int argc, JSValue *argv, int magic)
+{
+    JSObject *p;
+
+    p = js_get_object_class(ctx, *this_val, JS_CLASS_DATA_VIEW);
+    if (!p)
+        return JS_ThrowTypeError(ctx, "not a DataView");
+    switch(magic) {
+    default:
+    case 0:
+        return JS_NewShortInt(p->u.typed_array.len);
+    case 1:
+        return JS_NewShortInt(p->u.typed_array.offset);
+    case 2:
+        return p->u.typed_array.buffer;
     }
 }
 
-/* precondition: a and b are not NaN */
-static double js_fmax(double a, double b)
+/* return a pointer to the 'size' bytes at position 'pos_val' in the
+   view or NULL if exception */
+static uint8_t *js_dataview_get_ptr(JSContext *ctx, JSValue *this_val,
+                                    JSValue pos_val, int size)
 {
-    if (a == 0 && b == 0) {
-        return uint64_as_float64(float64_as_uint64(a) & float64_as_uint64(b));
-    } else if (a >= b) {
-        return a;
-    } else {
-        return b;
+    JSObject *p;
+    uint64_t pos;
+
+    if (!js_get_object_class(ctx, *this_val, JS_CLASS_DATA_VIEW)) {
+        JS_ThrowTypeError(ctx, "not a DataView");
+        return NULL;
+    }
+    if (JS_ToIndex(ctx, &pos, pos_val))
+        return NULL;
+    p = JS_VALUE_TO_PTR(*this_val);
+    if (pos + size > p->u.typed_array.len) {
+        JS_ThrowRangeError(ctx, "out of bound");
+        return NULL;
     }
+    return js_array_buffer_get_buf(JS_VALUE_TO_PTR(p->u.typed_array.buffer)) +
+        p->u.typed_array.offset + pos;
 }
 
-JSValue js_math_min_max(JSContext *ctx, JSValue *this_val,
-                        int argc, JSValue *argv, int magic)
+/* 'magic' is the class ID of the corresponding typed array. The
+   default byte order is big endian. */
+JSValue js_dataview_getValue(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv, int magic)
 {
-    BOOL is_max = magic;
-    double r, a;
-    int i;
+    int size_log2;
+    BOOL little_endian;
+    uint8_t *ptr;
+    uint32_t v;
+    uint64_t v64;
 
-    if (unlikely(argc == 0)) {
-        return __JS_NewFloat64(ctx, is_max ? -1.0 / 0.0 : 1.0 / 0.0);
+    size_log2 = typed_array_size_log2[magic - JS_CLASS_UINT8C_ARRAY];
+    little_endian = argc > 1 && JS_ToBool(ctx, argv[1]);
+    ptr = js_dataview_get_ptr(ctx, this_val, argv[0], 1 << size_log2);
+    if (!ptr)
+        return JS_EXCEPTION;
+    switch(magic) {
+    case JS_CLASS_INT8_ARRAY:
+        return JS_NewShortInt((int8_t)*ptr);
+    case JS_CLASS_UINT8_ARRAY:
+        return JS_NewShortInt(*ptr);
+    case JS_CLASS_INT16_ARRAY:
+    case JS_CLASS_UINT16_ARRAY:
+        v = get_u16(ptr);
+        if (!little_endian)
+            v = bswap16(v);
+        if (magic == JS_CLASS_INT16_ARRAY)
+            return JS_NewShortInt((int16_t)v);
+        else
+            return JS_NewShortInt(v);
+    case JS_CLASS_INT32_ARRAY:
+    case JS_CLASS_UINT32_ARRAY:
+    case JS_CLASS_FLOAT32_ARRAY:
+        v = get_u32(ptr);
+        if (!little_endian)
+            v = bswap32(v);
+        if (magic == JS_CLASS_INT32_ARRAY)
+            return JS_NewInt32(ctx, v);
+        else if (magic == JS_CLASS_UINT32_ARRAY)
+            return JS_NewUint32(ctx, v);
+        else
+            return JS_NewFloat64(ctx, uint_as_float(v));
+    default:
+    case JS_CLASS_FLOAT64_ARRAY:
+        v64 = get_u64(ptr);
+        if (!little_endian)
+            v64 = bswap64(v64);
+        return JS_NewFloat64(ctx, uint64_as_float64(v64));
     }
+}
 
-    if (JS_IsInt(argv[0])) {
-        int a1, r1 = JS_VALUE_GET_INT(argv[0]);
-        for(i = 1; i < argc; i++) {
-            if (!JS_IsInt(argv[i])) {
-                r = r1;
-                goto generic_case;
-            }
-            a1 = JS_VALUE_GET_INT(argv[i]);
-            if (is_max)
-                r1 = max_int(r1, a1);
-            else
-                r1 = min_int(r1, a1);
-        }
-        return JS_NewShortInt(r1);
+JSValue js_dataview_setValue(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv, int magic)
+{
+    int size_log2, v;
+    BOOL little_endian;
+    uint8_t *ptr;
+    uint32_t v32;
+    uint64_t v64;
+    double d;
+
+    size_log2 = typed_array_size_log2[magic - JS_CLASS_UINT8C_ARRAY];
+    if (magic == JS_CLASS_FLOAT32_ARRAY || magic == JS_CLASS_FLOAT64_ARRAY) {
+        if (JS_ToNumber(ctx, &d, argv[1]))
+            return JS_EXCEPTION;
+        v = 0;
     } else {
-        if (JS_ToNumber(ctx, &r, argv[0]))
+        if (JS_ToInt32(ctx, &v, argv[1]))
             return JS_EXCEPTION;
-        i = 1;
-    generic_case:
-        while (i < argc) {
-            if (JS_ToNumber(ctx, &a, argv[i]))
-                return JS_EXCEPTION;
-            if (!isnan(r)) {
-                if (isnan(a)) {
-                    r = a;
-                } else {
-                    if (is_max)
-                        r = js_fmax(r, a);
-                    else
-                        r = js_fmin(r, a);
-                }
-            }
-            i++;
-        }
-        return JS_NewFloat64(ctx, r);
+        d = 0;
+    }
+    little_endian = argc > 2 && JS_ToBool(ctx, argv[2]);
+    ptr = js_dataview_get_ptr(ctx, this_val, argv[0], 1 << size_log2);
+    if (!ptr)
+        return JS_EXCEPTION;
+    switch(magic) {
+    case JS_CLASS_INT8_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+        *ptr = v;
+        break;
+    case JS_CLASS_INT16_ARRAY:
+    case JS_CLASS_UINT16_ARRAY:
+        v32 = (uint16_t)v;
+        if (!little_endian)
+            v32 = bswap16(v32);
+        put_u16(ptr, v32);
+        break;
+    case JS_CLASS_INT32_ARRAY:
+    case JS_CLASS_UINT32_ARRAY:
+    case JS_CLASS_FLOAT32_ARRAY:
+        if (magic == JS_CLASS_FLOAT32_ARRAY)
+            v32 = float_as_uint(d);
+        else
+            v32 = v;
+        if (!little_endian)
+            v32 = bswap32(v32);
+        put_u32(ptr, v32);
+        break;
+    default:
+    case JS_CLASS_FLOAT64_ARRAY:
+        v64 = float64_as_uint64(d);
+        if (!little_endian)
+            v64 = bswap64(v64);
+        put_u64(ptr, v64);
+        break;
     }
+    return JS_UNDEFINED;
 }
 
-double js_math_sign(double a)
+/* Date */
+
+JSValue js_date_constructor(JSContext *ctx, JSValue *this_val,
+                            int argc, JSValue *argv)
 {
-    if (isnan(a) || a == 0.0)
-        return a;
-    if (a < 0)
-        return -1;
-    else
-        return 1;
+    return JS_ThrowTypeError(ctx, "only Date.now() is supported");
 }
 
-double js_math_fround(double a)
+/* global */
+
+JSValue js_global_eval(JSContext *ctx, JSValue *this_val,
+                       int argc, JSValue *argv)
 {
-    return (float)a;
+    JSValue val;
+    
+    if (!JS_IsString(ctx, argv[0]))
+        return argv[0];
+    val = JS_Parse2(ctx, argv[0], NULL, 0, "<input>", JS_EVAL_RETVAL);
+    if (JS_IsException(val))
+        return val;
+    return JS_Run(ctx, val);
 }
 
-JSValue js_math_imul(JSContext *ctx, JSValue *this_val,
-                     int argc, JSValue *argv)
+JSValue js_global_isNaN(JSContext *ctx, JSValue *this_val,
+                        int argc, JSValue *argv)
 {
-    int a, b;
-
-    if (JS_ToInt32(ctx, &a, argv[0]))
-        return JS_EXCEPTION;
-    if (JS_ToInt32(ctx, &b, argv[1]))
+    double d;
+    if (unlikely(JS_ToNumber(ctx, &d, argv[0])))
         return JS_EXCEPTION;
-    /* purposely ignoring overflow */
-    return JS_NewInt32(ctx, (uint32_t)a * (uint32_t)b);
+    return JS_NewBool(isnan(d));
 }
 
-JSValue js_math_clz32(JSContext *ctx, JSValue *this_val,
-                     int argc, JSValue *argv)
+JSValue js_global_isFinite(JSContext *ctx, JSValue *this_val,
+                                  int argc, JSValue *argv)
 {
-    uint32_t a, r;
-
-    if (JS_ToUint32(ctx, &a, argv[0]))
+    double d;
+    if (unlikely(JS_ToNumber(ctx, &d, argv[0])))
         return JS_EXCEPTION;
-    if (a == 0)
-        r = 32;
-    else
-        r = clz32(a);
-    return JS_NewInt32(ctx, r);
+    return JS_NewBool(isfinite(d));
 }
 
-JSValue js_math_atan2(JSContext *ctx, JSValue *this_val,
+/* JSON */
+
+JSValue js_json_parse(JSContext *ctx, JSValue *this_val,
                       int argc, JSValue *argv)
 {
-    double y, x;
+    JSValue val;
     
-    if (JS_ToNumber(ctx, &y, argv[0]))
-        return JS_EXCEPTION;
-    if (JS_ToNumber(ctx, &x, argv[1]))
-        return JS_EXCEPTION;
-    return JS_NewFloat64(ctx, js_atan2(y, x));
+    val = JS_ToString(ctx, argv[0]);
+    if (JS_IsException(val))
+        return val;
+    return JS_Parse2(ctx, val, NULL, 0, "<input>", JS_EVAL_JSON);
 }
 
-JSValue js_math_pow(JSContext *ctx, JSValue *this_val,
-                    int argc, JSValue *argv)
+/* Incremental JSON parser. The input is given in chunks of any size
+   (a token may be split between two chunks). Only the path from the
+   root to the current value is kept in the parser stack. If a
+   callback is set, the values at depth 'emit_depth' are given to
+   callback(key, value) instead of being stored in their parent, so
+   that arbitrarily long arrays or objects can be processed with a
+   bounded amount of memory. */
+
+enum {
+    /* the white space is skipped in these states */
+    JSON_PARSER_VALUE,
+    JSON_PARSER_ARRAY_FIRST, /* value or ']' */
+    JSON_PARSER_OBJECT_FIRST, /* key or '}' */
+    JSON_PARSER_KEY,
+    JSON_PARSER_COLON,
+    JSON_PARSER_NEXT, /* ',' or end of the array or object */
+    JSON_PARSER_END,
+    /* tokens */
+    JSON_PARSER_STRING,
+    JSON_PARSER_STRING_ESC, /* after a '\\' */
+    JSON_PARSER_KEY_STRING,
+    JSON_PARSER_KEY_STRING_ESC,
+    JSON_PARSER_NUMBER,
+    JSON_PARSER_LITERAL,
+    JSON_PARSER_ERROR,
+};
+
+static inline JSJSONParser *js_get_json_parser1(JSValue obj)
 {
-    double y, x;
-    
-    if (JS_ToNumber(ctx, &x, argv[0]))
-        return JS_EXCEPTION;
-    if (JS_ToNumber(ctx, &y, argv[1]))
-        return JS_EXCEPTION;
-    return JS_NewFloat64(ctx, js_pow(x, y));
+    JSObject *p = JS_VALUE_TO_PTR(obj);
+    return &p->u.json_parser;
 }
 
-/* xorshift* random number generator by Marsaglia */
-static uint64_t xorshift64star(uint64_t *pstate)
+static JSJSONParser *js_get_json_parser(JSContext *ctx, JSValue obj)
 {
-    uint64_t x;
-    x = *pstate;
-    x ^= x >> 12;
-    x ^= x << 25;
-    x ^= x >> 27;
-    *pstate = x;
-    return x * 0x2545F4914F6CDD1D;
+    JSObject *p;
+    p = js_get_object_class(ctx, obj, JS_CLASS_JSON_PARSER);
+    if (!p) {
+        JS_ThrowTypeError(ctx, "not a JSON parser");
+        return NULL;
+    }
+    return &p->u.json_parser;
 }
 
-JSValue js_math_random(JSContext *ctx, JSValue *this_val,
-                       int argc, JSValue *argv)
+static int js_json_parser_error(JSContext *ctx, JSValue *pobj, const char *msg)
 {
-    double d;
-    uint64_t v;
-
-    v = xorshift64star(&ctx->random_state);
-    /* 1.0 <= u.d < 2 */
-    d = uint64_as_float64(((uint64_t)0x3ff << 52) | (v >> 12));
-    return __JS_NewFloat64(ctx, d - 1.0);
+    JSJSONParser *jp = js_get_json_parser1(*pobj);
+    jp->state = JSON_PARSER_ERROR;
+    JS_ThrowSyntaxError(ctx, "%s at position %u", msg, jp->pos);
+    return -1;
 }
 
-/* typed array */
-
-#define JS_TYPED_ARRAY_COUNT (JS_CLASS_FLOAT64_ARRAY - JS_CLASS_UINT8C_ARRAY + 1)
-
-static uint8_t typed_array_size_log2[JS_TYPED_ARRAY_COUNT] = {
-    0, 0, 0, 1, 1, 2, 2, 2, 3
-};
+/* return the bytes of a string, ArrayBuffer, typed array or DataView or
+   NULL if not supported. No allocation is done. */
+static const uint8_t *js_get_json_chunk(JSContext *ctx, JSStringCharBuf *buf,
+                                        size_t *plen, JSValue val)
+{
+    if (JS_IsString(ctx, val)) {
+        JSString *p = get_string_ptr(ctx, buf, val);
+        *plen = p->len;
+        return js_string_buf(p);
+    } else if (JS_IsPtr(val)) {
+        JSObject *p = JS_VALUE_TO_PTR(val);
+        int size_log2;
+        if (p->mtag != JS_MTAG_OBJECT)
+            return NULL;
+        if (p->class_id == JS_CLASS_ARRAY_BUFFER) {
+            *plen = js_array_buffer_get_len(p);
+            return js_array_buffer_get_buf(p);
+        } else if (p->class_id >= JS_CLASS_UINT8C_ARRAY &&
+                   p->class_id <= JS_CLASS_FLOAT64_ARRAY) {
+            size_log2 = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
+            *plen = p->u.typed_array.len << size_log2;
+            return js_typed_array_get_buf(p);
+        } else if (p->class_id == JS_CLASS_DATA_VIEW) {
+            *plen = p->u.typed_array.len;
+            return js_array_buffer_get_buf(JS_VALUE_TO_PTR(p->u.typed_array.buffer)) +
+                p->u.typed_array.offset;
+        }
+    }
+    return NULL;
+}
 
-static int JS_ToIndex(JSContext *ctx, uint64_t *plen, JSValue val)
+/* append 'len' bytes to the current token. The token is kept zero
+   terminated. */
+static int js_json_parser_add_token(JSContext *ctx, JSValue *pobj,
+                                    JSValue *pchunk, const uint8_t *chunk,
+                                    size_t pos, size_t len)
 {
-    int v;
-    /* XXX: should support 53 bit inteers */
-    if (JS_ToInt32Sat(ctx, &v, val))
-        return -1;
-    if (v < 0 || v > JS_SHORTINT_MAX) {
-        JS_ThrowRangeError(ctx, "invalid array index");
+    JSJSONParser *jp = js_get_json_parser1(*pobj);
+    JSByteArray *arr;
+    JSStringCharBuf cbuf;
+    JSValue token;
+    size_t chunk_len;
+
+    if (len > JS_BYTE_ARRAY_SIZE_MAX - 1 - jp->token_len)
+        return js_json_parser_error(ctx, pobj, "token too long");
+    token = js_resize_byte_array(ctx, jp->token, jp->token_len + len + 1);
+    if (JS_IsException(token))
         return -1;
-    }
-    *plen = v;
+    jp = js_get_json_parser1(*pobj);
+    jp->token = token;
+    js_write_barrier(ctx, JS_VALUE_TO_PTR(*pobj), token);
+    if (pchunk)
+        chunk = js_get_json_chunk(ctx, &cbuf, &chunk_len, *pchunk); /* may have moved */
+    arr = JS_VALUE_TO_PTR(token);
+    memcpy(arr->buf + jp->token_len, chunk + pos, len);
+    jp->token_len += len;
+    arr->buf[jp->token_len] = '\0';
     return 0;
 }
 
-JSValue js_array_buffer_alloc(JSContext *ctx, uint64_t len)
+static JSValue js_json_parser_get_string(JSContext *ctx, JSValue *pobj)
 {
+    JSJSONParser *jp;
     JSByteArray *arr;
-    JSValue buffer, obj;
-    JSGCRef buffer_ref;
-    JSObject *p;
+    const uint8_t *buf;
+    int pos, len, c;
+    size_t clen;
+    StringBuffer b_s, *b = &b_s;
+    const char *msg;
 
-    if (len > JS_SHORTINT_MAX)
-        return JS_ThrowRangeError(ctx, "invalid array buffer length");
-    arr = js_alloc_byte_array(ctx, len);
-    if (!arr)
+    jp = js_get_json_parser1(*pobj);
+    if (string_buffer_push(ctx, b, jp->token_len))
         return JS_EXCEPTION;
-    memset(arr->buf, 0, len);
-    buffer = JS_VALUE_FROM_PTR(arr);
-    JS_PUSH_VALUE(ctx, buffer);
-    obj = JS_NewObjectClass(ctx, JS_CLASS_ARRAY_BUFFER, sizeof(JSArrayBuffer));
-    JS_POP_VALUE(ctx, buffer);
-    if (JS_IsException(obj))
-        return obj;
-    p = JS_VALUE_TO_PTR(obj);
-    p->u.array_buffer.byte_buffer = buffer;
-    return obj;
+    pos = 0;
+    for(;;) {
+        jp = js_get_json_parser1(*pobj); /* may have moved */
+        len = jp->token_len;
+        if (pos >= len)
+            break;
+        arr = JS_VALUE_TO_PTR(jp->token);
+        buf = arr->buf;
+        c = buf[pos++];
+        if (c == '\\') {
+            if (buf[pos] == '\n') {
+                /* ignore escaped newline sequence */
+                pos++;
+                continue;
+            }
+            c = js_parse_escape(buf + pos, &clen);
+            if (c == -1) {
+                msg = "invalid escape sequence";
+                goto fail;
+            } else if (c == -2) {
+                /* ignore invalid escapes */
+                continue;
+            }
+            pos += clen;
+        } else if (c >= 0x80) {
+            pos--;
+            c = unicode_from_utf8(buf + pos, len - pos, &clen);
+            pos += clen;
+            if (c == -1) {
+                msg = "invalid UTF-8 sequence";
+                goto fail;
+            }
+        }
+        if (string_buffer_putc(ctx, b, c))
+            break;
+    }
+    return string_buffer_pop(ctx, b);
+ fail:
+    string_buffer_pop(ctx, b);
+    js_json_parser_error(ctx, pobj, msg);
+    return JS_EXCEPTION;
 }
 
-JSValue js_array_buffer_constructor(JSContext *ctx, JSValue *this_val,
-                                    int argc, JSValue *argv)
+static JSValue js_json_parser_get_number(JSContext *ctx, JSValue *pobj)
 {
-    uint64_t len;
-    if (!(argc & FRAME_CF_CTOR))
-        return JS_ThrowTypeError(ctx, "must be called with new");
-    if (JS_ToIndex(ctx, &len, argv[0]))
+    JSJSONParser *jp;
+    JSByteArray *tmp_arr, *arr;
+    const char *p;
+    double d;
+
+    tmp_arr = js_alloc_byte_array(ctx, sizeof(JSATODTempMem));
+    if (!tmp_arr)
         return JS_EXCEPTION;
-    return js_array_buffer_alloc(ctx, len);
+    jp = js_get_json_parser1(*pobj);
+    arr = JS_VALUE_TO_PTR(jp->token);
+    d = js_atod((const char *)arr->buf, &p, 10, 0,
+                (JSATODTempMem *)tmp_arr->buf);
+    js_free(ctx, tmp_arr);
+    if (isnan(d) || p != (const char *)arr->buf + jp->token_len) {
+        js_json_parser_error(ctx, pobj, "invalid number literal");
+        return JS_EXCEPTION;
+    }
+    return JS_NewFloat64(ctx, d);
 }
 
-JSValue js_array_buffer_get_byteLength(JSContext *ctx, JSValue *this_val,
-                                      int argc, JSValue *argv)
+/* store a complete value in its parent or give it to the callback */
+static int js_json_parser_add_value(JSContext *ctx, JSValue *pobj, JSValue val)
 {
-    JSObject *p = js_get_object_class(ctx, *this_val, JS_CLASS_ARRAY_BUFFER);
-    JSByteArray *arr;
-    if (!p)
-        return JS_ThrowTypeError(ctx, "expected an ArrayBuffer");
-    arr = JS_VALUE_TO_PTR(p->u.array_buffer.byte_buffer);
-    return JS_NewShortInt(arr->size);
+    JSJSONParser *jp;
+    JSValueArray *arr;
+    JSValue key, ret;
+    JSGCRef val_ref;
+    int err;
+
+    jp = js_get_json_parser1(*pobj);
+    if (jp->depth == 0) {
+        jp->result = val;
+        js_write_barrier(ctx, JS_VALUE_TO_PTR(*pobj), val);
+        jp->state = JSON_PARSER_END;
+        return 0;
+    }
+    if (jp->depth == jp->emit_depth && !JS_IsUndefined(jp->callback)) {
+        JS_PUSH_VALUE(ctx, val);
+        err = JS_StackCheck(ctx, 4);
+        JS_POP_VALUE(ctx, val);
+        if (err)
+            return -1;
+        jp = js_get_json_parser1(*pobj);
+        arr = JS_VALUE_TO_PTR(jp->stack);
+        JS_PushArg(ctx, val);
+        JS_PushArg(ctx, arr->arr[2 * jp->depth - 1]);
+        JS_PushArg(ctx, jp->callback);
+        JS_PushArg(ctx, JS_UNDEFINED);
+        ret = JS_Call(ctx, 2);
+    } else {
+        arr = JS_VALUE_TO_PTR(jp->stack);
+        key = arr->arr[2 * jp->depth - 1];
+        if (JS_IsInt(key)) {
+            ret = JS_SetPropertyUint32(ctx, arr->arr[2 * jp->depth - 2],
+                                       JS_VALUE_GET_INT(key), val);
+        } else {
+            ret = JS_DefinePropertyValue(ctx, arr->arr[2 * jp->depth - 2],
+                                         key, val);
+        }
+    }
+    if (JS_IsException(ret))
+        return -1;
+    jp = js_get_json_parser1(*pobj);
+    arr = JS_VALUE_TO_PTR(jp->stack);
+    key = arr->arr[2 * jp->depth - 1];
+    if (JS_IsInt(key))
+        arr->arr[2 * jp->depth - 1] = JS_NewShortInt(JS_VALUE_GET_INT(key) + 1);
+    jp->state = JSON_PARSER_NEXT;
+    return 0;
 }
 
-JSValue js_typed_array_base_constructor(JSContext *ctx, JSValue *this_val,
-                                        int argc, JSValue *argv)
+static int js_json_parser_open(JSContext *ctx, JSValue *pobj, BOOL is_array)
 {
-    return JS_ThrowTypeError(ctx, "cannot be called");
+    JSJSONParser *jp;
+    JSValueArray *arr;
+    JSValue val, stack;
+    JSGCRef val_ref;
+
+    if (is_array)
+        val = JS_NewArray(ctx, 0);
+    else
+        val = JS_NewObject(ctx);
+    if (JS_IsException(val))
+        return -1;
+    jp = js_get_json_parser1(*pobj);
+    if (jp->depth >= JS_VALUE_ARRAY_SIZE_MAX / 2)
+        return js_json_parser_error(ctx, pobj, "too many nested levels");
+    JS_PUSH_VALUE(ctx, val);
+    stack = js_resize_value_array(ctx, jp->stack, 2 * (jp->depth + 1));
+    JS_POP_VALUE(ctx, val);
+    if (JS_IsException(stack))
+        return -1;
+    jp = js_get_json_parser1(*pobj);
+    jp->stack = stack;
+    js_write_barrier(ctx, JS_VALUE_TO_PTR(*pobj), stack);
+    arr = JS_VALUE_TO_PTR(stack);
+    arr->arr[2 * jp->depth] = val;
+    js_write_barrier(ctx, arr, val);
+    arr->arr[2 * jp->depth + 1] = is_array ? JS_NewShortInt(0) : JS_UNDEFINED;
+    jp->depth++;
+    jp->state = is_array ? JSON_PARSER_ARRAY_FIRST : JSON_PARSER_OBJECT_FIRST;
+    return 0;
 }
 
-static JSValue js_typed_array_constructor_obj(JSContext *ctx, JSValue *this_val,
-                                              int argc, JSValue *argv, int magic)
+static int js_json_parser_close(JSContext *ctx, JSValue *pobj)
 {
-    int i, len;
-    JSValue val, obj;
-    JSGCRef obj_ref;
-    JSObject *p;
-    
-    p = JS_VALUE_TO_PTR(argv[0]);
-    if (p->class_id == JS_CLASS_ARRAY) {
-        len = p->u.array.len;
-    } else if (p->class_id >= JS_CLASS_UINT8C_ARRAY &&
-               p->class_id <= JS_CLASS_FLOAT64_ARRAY) {
-        len = p->u.typed_array.len;
-    } else {
-        return JS_ThrowTypeError(ctx, "unsupported object class");
-    }
-    val = JS_NewShortInt(len);
-    obj = js_typed_array_constructor(ctx, NULL, 1 | FRAME_CF_CTOR, &val, magic);
-    if (JS_IsException(obj))
-        return obj;
+    JSJSONParser *jp;
+    JSValueArray *arr;
+    JSValue val;
+    JSGCRef val_ref;
+    BOOL is_array;
+    int err;
 
-    for(i = 0; i < len; i++) {
-        JS_PUSH_VALUE(ctx, obj);
-        val = JS_GetProperty(ctx, argv[0], JS_NewShortInt(i));
-        JS_POP_VALUE(ctx, obj);
-        if (JS_IsException(val))
-            return val;
-        JS_PUSH_VALUE(ctx, obj);
-        val = JS_SetPropertyInternal(ctx, obj, JS_NewShortInt(i), val, FALSE);
-        JS_POP_VALUE(ctx, obj);
-        if (JS_IsException(val))
-            return val;
+    jp = js_get_json_parser1(*pobj);
+    arr = JS_VALUE_TO_PTR(jp->stack);
+    jp->depth--;
+    val = arr->arr[2 * jp->depth];
+    is_array = JS_IsInt(arr->arr[2 * jp->depth + 1]);
+    arr->arr[2 * jp->depth] = JS_UNDEFINED;
+    arr->arr[2 * jp->depth + 1] = JS_UNDEFINED;
+    if (!is_array) {
+        /* may trigger a GC */
+        JS_PUSH_VALUE(ctx, val);
+        err = js_object_share_shape(ctx, val);
+        JS_POP_VALUE(ctx, val);
+        if (err)
+            return -1;
     }
-    return obj;
+    return js_json_parser_add_value(ctx, pobj, val);
 }
 
-JSValue js_typed_array_constructor(JSContext *ctx, JSValue *this_val,
-                                   int argc, JSValue *argv, int magic)
+static BOOL is_json_space(int c)
 {
-    int size_log2;
-    uint64_t len, offset, byte_length;
-    JSObject *p;
-    JSByteArray *arr;
-    JSValue buffer, obj;
-    JSGCRef buffer_ref;
-    
-    if (!(argc & FRAME_CF_CTOR))
-        return JS_ThrowTypeError(ctx, "must be called with new");
-    size_log2 = typed_array_size_log2[magic - JS_CLASS_UINT8C_ARRAY];
-    if (!JS_IsObject(ctx, argv[0])) {
-        if (JS_ToIndex(ctx, &len, argv[0]))
-            return JS_EXCEPTION;
-        buffer = js_array_buffer_alloc(ctx, len << size_log2);
-        if (JS_IsException(buffer))
-            return JS_EXCEPTION;
-        offset = 0;
-    } else {
-        p = JS_VALUE_TO_PTR(argv[0]);
-        if (p->class_id == JS_CLASS_ARRAY_BUFFER) {
-            arr = JS_VALUE_TO_PTR(p->u.array_buffer.byte_buffer);
-            byte_length = arr->size;
-            if (JS_ToIndex(ctx, &offset, argv[1]))
-                return JS_EXCEPTION;
-            if ((offset & ((1 << size_log2) - 1)) != 0 ||
-                offset > byte_length)
-                return JS_ThrowRangeError(ctx, "invalid offset");
-            if (JS_IsUndefined(argv[2])) {
-                if ((byte_length & ((1 << size_log2) - 1)) != 0)
-                    goto invalid_length;
-                len = (byte_length - offset) >> size_log2;
-            } else {
-                if (JS_ToIndex(ctx, &len, argv[2]))
-                    return JS_EXCEPTION;
-                if ((offset + (len << size_log2)) > byte_length) {
-            invalid_length:
-                    return JS_ThrowRangeError(ctx, "invalid length");
-                }
-            }
-            buffer = argv[0];
-            offset >>= size_log2;
-        } else {
-            return js_typed_array_constructor_obj(ctx, this_val,
-                                                  argc, argv, magic);
-        }
-    }
-    
-    JS_PUSH_VALUE(ctx, buffer);
-    obj = JS_NewObjectClass(ctx, magic, sizeof(JSTypedArray));
-    JS_POP_VALUE(ctx, buffer);
-    if (JS_IsException(obj))
-        return obj;
-    p = JS_VALUE_TO_PTR(obj);
-    p->u.typed_array.buffer = buffer;
-    p->u.typed_array.offset = offset;
-    p->u.typed_array.len = len;
-    return obj;
+    return (c == ' ' || c == '\t' || c == '\n' || c == '\r');
 }
 
-static JSObject *get_typed_array(JSContext *ctx, JSValue val)
+static BOOL is_json_number_char(int c)
 {
-    JSObject *p;
-    if (!JS_IsObject(ctx, val))
-        goto fail;
-    p = JS_VALUE_TO_PTR(val);
-    if (!(p->class_id >= JS_CLASS_UINT8C_ARRAY && p->class_id <= JS_CLASS_FLOAT64_ARRAY)) {
-    fail:
-        JS_ThrowTypeError(ctx, "not a TypedArray");
-        return NULL;
-    }
-    return p;
+    return ((c >= '0' && c <= '9') || c == '-' || c == '+' ||
+            c == '.' || c == 'e' || c == 'E');
 }
 
-JSValue js_typed_array_get_length(JSContext *ctx, JSValue *this_val,
-                                  int argc, JSValue *argv, int magic)
+/* complete the pending number or literal */
+static int js_json_parser_end_token(JSContext *ctx, JSValue *pobj)
 {
-    JSObject *p;
-    int size_log2;
+    JSJSONParser *jp = js_get_json_parser1(*pobj);
+    JSByteArray *arr;
+    JSValue val;
+    const char *str;
 
-    p = get_typed_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
-    size_log2 = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
-    switch(magic) {
-    default:
-    case 0:
-        return JS_NewShortInt(p->u.typed_array.len);
-    case 1:
-        return JS_NewShortInt(p->u.typed_array.len << size_log2);
-    case 2:
-        return JS_NewShortInt(p->u.typed_array.offset << size_log2);
-    case 3:
-        return p->u.typed_array.buffer;
+    if (jp->state == JSON_PARSER_NUMBER) {
+        val = js_json_parser_get_number(ctx, pobj);
+        if (JS_IsException(val))
+            return -1;
+    } else {
+        arr = JS_VALUE_TO_PTR(jp->token);
+        str = (const char *)arr->buf;
+        if (!strcmp(str, "true"))
+            val = JS_TRUE;
+        else if (!strcmp(str, "false"))
+            val = JS_FALSE;
+        else if (!strcmp(str, "null"))
+            val = JS_NULL;
+        else
+            return js_json_parser_error(ctx, pobj, "unexpected character");
     }
+    return js_json_parser_add_value(ctx, pobj, val);
 }
 
-JSValue js_typed_array_subarray(JSContext *ctx, JSValue *this_val,
-                                int argc, JSValue *argv)
+/* 'chunk' and 'len' are used if 'pchunk' is NULL. Otherwise the
+   chunk is a string or an array buffer which may move during the
+   parsing. */
+static int js_json_parser_write(JSContext *ctx, JSValue *pobj,
+                                JSValue *pchunk, const uint8_t *chunk,
+                                size_t len)
 {
-    JSObject *p, *p1;
-    JSByteArray *arr;
-    int start, final, len;
-    uint32_t offset, count;
-    JSValue obj;
-    
-    p = get_typed_array(ctx, *this_val);
-    if (!p)
-        return JS_EXCEPTION;
-    len = p->u.typed_array.len;
-    if (JS_ToInt32Clamp(ctx, &start, argv[0], 0, len, len))
-        return JS_EXCEPTION;
-    if (JS_IsUndefined(argv[1])) {
-        final = len;
-    } else {
-        if (JS_ToInt32Clamp(ctx, &final, argv[1], 0, len, len))
-            return JS_EXCEPTION;
+    JSJSONParser *jp;
+    JSStringCharBuf cbuf;
+    JSValue val;
+    size_t pos, pos1, chunk_len;
+    uint32_t base;
+    int c, state;
+
+    jp = js_get_json_parser1(*pobj);
+    if (jp->state == JSON_PARSER_ERROR)
+        return js_json_parser_error(ctx, pobj, "previous error");
+    if (jp->is_busy)
+        return js_json_parser_error(ctx, pobj, "recursive write");
+    jp->is_busy = TRUE;
+    base = jp->pos;
+    if (pchunk)
+        chunk = js_get_json_chunk(ctx, &cbuf, &len, *pchunk);
+    pos = 0;
+    while (pos < len) {
+        jp = js_get_json_parser1(*pobj);
+        jp->pos = base + pos;
+        if (pchunk)
+            chunk = js_get_json_chunk(ctx, &cbuf, &chunk_len, *pchunk);
+        c = chunk[pos];
+        state = jp->state;
+        if (state <= JSON_PARSER_END && is_json_space(c)) {
+            pos++;
+            continue;
+        }
+        switch(state) {
+        case JSON_PARSER_ARRAY_FIRST:
+            if (c == ']') {
+                pos++;
+                if (js_json_parser_close(ctx, pobj))
+                    goto fail;
+                break;
+            }
+            /* fall thru */
+        case JSON_PARSER_VALUE:
+            if (c == '\"') {
+                pos++;
+                jp->token_len = 0;
+                jp->state = JSON_PARSER_STRING;
+            } else if ((c >= '0' && c <= '9') || c == '-') {
+                jp->token_len = 0;
+                jp->state = JSON_PARSER_NUMBER;
+            } else if (c >= 'a' && c <= 'z') {
+                jp->token_len = 0;
+                jp->state = JSON_PARSER_LITERAL;
+            } else if (c == '[' || c == '{') {
+                pos++;
+                if (js_json_parser_open(ctx, pobj, (c == '[')))
+                    goto fail;
+            } else {
+                goto unexpected_char;
+            }
+            break;
+        case JSON_PARSER_OBJECT_FIRST:
+            if (c == '}') {
+                pos++;
+                if (js_json_parser_close(ctx, pobj))
+                    goto fail;
+                break;
+            }
+            /* fall thru */
+        case JSON_PARSER_KEY:
+            if (c != '\"') {
+                js_json_parser_error(ctx, pobj, "expecting '\"'");
+                goto fail;
+            }
+            pos++;
+            jp->token_len = 0;
+            jp->state = JSON_PARSER_KEY_STRING;
+            break;
+        case JSON_PARSER_COLON:
+            if (c != ':') {
+                js_json_parser_error(ctx, pobj, "expecting ':'");
+                goto fail;
+            }
+            pos++;
+            jp->state = JSON_PARSER_VALUE;
+            break;
+        case JSON_PARSER_NEXT:
+            {
+                JSValueArray *arr = JS_VALUE_TO_PTR(jp->stack);
+                BOOL is_array = JS_IsInt(arr->arr[2 * jp->depth - 1]);
+                if (c == ',') {
+                    pos++;
+                    jp->state = is_array ? JSON_PARSER_VALUE : JSON_PARSER_KEY;
+                } else if (c == (is_array ? ']' : '}')) {
+                    pos++;
+                    if (js_json_parser_close(ctx, pobj))
+                        goto fail;
+                } else {
+                    js_json_parser_error(ctx, pobj, is_array ?
+                                         "expecting ']'" : "expecting '}'");
+                    goto fail;
+                }
+            }
+            break;
+        case JSON_PARSER_STRING:
+        case JSON_PARSER_KEY_STRING:
+            pos1 = pos;
+            while (pos < len) {
+                c = chunk[pos];
+                if (c == '\"' || c == '\\' || c == '\0' ||
+                    c == '\n' || c == '\r')
+                    break;
+                pos++;
+            }
+            if (pos > pos1 &&
+                js_json_parser_add_token(ctx, pobj, pchunk, chunk, pos1, pos - pos1))
+                goto fail;
+            if (pos >= len)
+                break;
+            if (c == '\\') {
+                /* the escape sequence is decoded at the end of the string */
+                if (js_json_parser_add_token(ctx, pobj, pchunk, chunk, pos, 1))
+                    goto fail;
+                pos++;
+                jp = js_get_json_parser1(*pobj);
+                jp->state = state + 1;
+            } else if (c == '\"') {
+                pos++;
+                val = js_json_parser_get_string(ctx, pobj);
+                if (JS_IsException(val))
+                    goto fail;
+                if (state == JSON_PARSER_STRING) {
+                    if (js_json_parser_add_value(ctx, pobj, val))
+                        goto fail;
+                } else {
+                    val = JS_ToPropertyKey(ctx, val);
+                    if (JS_IsException(val))
+                        goto fail;
+                    jp = js_get_json_parser1(*pobj);
+                    ((JSValueArray *)JS_VALUE_TO_PTR(jp->stack))->arr[2 * jp->depth - 1] = val;
+                    js_write_barrier(ctx, JS_VALUE_TO_PTR(jp->stack), val);
+                    jp->state = JSON_PARSER_COLON;
+                }
+            } else {
+                jp = js_get_json_parser1(*pobj);
+                jp->pos = base + pos;
+                js_json_parser_error(ctx, pobj, "unexpected end of string");
+                goto fail;
+            }
+            break;
+        case JSON_PARSER_STRING_ESC:
+        case JSON_PARSER_KEY_STRING_ESC:
+            if (js_json_parser_add_token(ctx, pobj, pchunk, chunk, pos, 1))
+                goto fail;
+            pos++;
+            jp = js_get_json_parser1(*pobj);
+            jp->state = state - 1;
+            break;
+        case JSON_PARSER_NUMBER:
+        case JSON_PARSER_LITERAL:
+            pos1 = pos;
+            while (pos < len) {
+                c = chunk[pos];
+                if (state == JSON_PARSER_NUMBER ? !is_json_number_char(c) :
+                    !(c >= 'a' && c <= 'z'))
+                    break;
+                pos++;
+            }
+            if (pos > pos1 &&
+                js_json_parser_add_token(ctx, pobj, pchunk, chunk, pos1, pos - pos1))
+                goto fail;
+            /* the token may continue in the next chunk */
+            if (pos < len) {
+                if (js_json_parser_end_token(ctx, pobj))
+                    goto fail;
+            }
+            break;
+        default:
+        unexpected_char:
+            js_json_parser_error(ctx, pobj, "unexpected character");
+            goto fail;
+        }
     }
-    p = JS_VALUE_TO_PTR(*this_val);
-    offset = p->u.typed_array.offset + start;
-    count = max_int(final - start, 0);
-
-    /* check offset and count */
-    p1 = JS_VALUE_TO_PTR(p->u.typed_array.buffer);
-    arr = JS_VALUE_TO_PTR(p1->u.array_buffer.byte_buffer);
-    if (offset + count > arr->size)
-        return JS_ThrowRangeError(ctx, "invalid length");
-        
-    obj = JS_NewObjectClass(ctx, p->class_id, sizeof(JSTypedArray));
-    if (JS_IsException(obj))
-        return JS_EXCEPTION;
-    p = JS_VALUE_TO_PTR(*this_val);
-    p1 = JS_VALUE_TO_PTR(obj);
-    p1->u.typed_array.buffer = p->u.typed_array.buffer;
-    p1->u.typed_array.offset = offset;
-    p1->u.typed_array.len = count;
-    return obj;
+    jp = js_get_json_parser1(*pobj);
+    jp->pos = base + pos;
+    jp->is_busy = FALSE;
+    return 0;
+ fail:
+    jp = js_get_json_parser1(*pobj);
+    jp->state = JSON_PARSER_ERROR;
+    jp->is_busy = FALSE;
+    return -1;
 }
 
-JSValue js_typed_array_set(JSContext *ctx, JSValue *this_val,
-                                int argc, JSValue *argv)
+static JSValue js_json_parser_end(JSContext *ctx, JSValue *pobj)
 {
-    JSObject *p, *p1;
-    uint32_t dst_len, src_len, i;
-    int offset;
+    JSJSONParser *jp;
+    JSValue res;
 
-    p = get_typed_array(ctx, *this_val);
-    if (!p)
+    jp = js_get_json_parser1(*pobj);
+    if (jp->is_busy) {
+        js_json_parser_error(ctx, pobj, "recursive end");
         return JS_EXCEPTION;
-    if (argc > 1) {
-        if (JS_ToInt32Sat(ctx, &offset, argv[1]))
-            return JS_EXCEPTION;
-    } else {
-        offset = 0;
     }
-    if (offset < 0)
-        goto range_error;
-    if (!JS_IsObject(ctx, argv[0]))
-        return JS_ThrowTypeErrorNotAnObject(ctx);
-    p = JS_VALUE_TO_PTR(*this_val);
-    dst_len = p->u.typed_array.len;
-    p1 = JS_VALUE_TO_PTR(argv[0]);
-    if (p1->class_id >= JS_CLASS_UINT8C_ARRAY &&
-        p1->class_id <= JS_CLASS_FLOAT64_ARRAY) {
-        src_len = p1->u.typed_array.len;
-        if (src_len > dst_len || offset > dst_len - src_len)
-            goto range_error;
-        if (p1->class_id == p->class_id) {
-            JSObject *src_buffer, *dst_buffer;
-            JSByteArray *src_arr, *dst_arr;
-            int shift = typed_array_size_log2[p->class_id - JS_CLASS_UINT8C_ARRAY];
-            dst_buffer = JS_VALUE_TO_PTR(p->u.typed_array.buffer);
-            dst_arr = JS_VALUE_TO_PTR(dst_buffer->u.array_buffer.byte_buffer);
-            src_buffer = JS_VALUE_TO_PTR(p1->u.typed_array.buffer);
-            src_arr = JS_VALUE_TO_PTR(src_buffer->u.array_buffer.byte_buffer);
-            /* same type: must copy to preserve float bits */
-            memmove(dst_arr->buf + ((p->u.typed_array.offset + offset) << shift),
-                    src_arr->buf + (p1->u.typed_array.offset << shift),
-                    src_len << shift);
+    if (jp->state == JSON_PARSER_NUMBER || jp->state == JSON_PARSER_LITERAL) {
+        if (js_json_parser_end_token(ctx, pobj)) {
+            res = JS_EXCEPTION;
             goto done;
         }
-    } else {
-        if (js_get_length32(ctx, (uint32_t *)&src_len, argv[0]))
-            return JS_EXCEPTION;
-        if (src_len > dst_len || offset > dst_len - src_len) {
-        range_error:
-            return JS_ThrowRangeError(ctx, "invalid array length");
-        }
+        jp = js_get_json_parser1(*pobj);
     }
-    for(i = 0; i < src_len; i++) {
-        JSValue val;
-        val = JS_GetPropertyUint32(ctx, argv[0], i);
-        if (JS_IsException(val))
-            return JS_EXCEPTION;
-        val = JS_SetPropertyUint32(ctx, *this_val, offset + i, val);
-        if (JS_IsException(val))
-            return JS_EXCEPTION;
+    if (jp->state != JSON_PARSER_END) {
+        if (jp->state != JSON_PARSER_ERROR)
+            js_json_parser_error(ctx, pobj, "unexpected end of input");
+        else
+            js_json_parser_error(ctx, pobj, "previous error");
+        res = JS_EXCEPTION;
+    } else {
+        res = jp->result;
     }
  done:
-    return JS_UNDEFINED;
+    /* the parser can be reused, also after an error */
+    jp = js_get_json_parser1(*pobj);
+    jp->result = JS_UNDEFINED;
+    jp->stack = JS_NULL;
+    jp->token = JS_NULL;
+    jp->state = JSON_PARSER_VALUE;
+    jp->depth = 0;
+    jp->token_len = 0;
+    jp->pos = 0;
+    return res;
 }
 
-/* Date */
-
-JSValue js_date_constructor(JSContext *ctx, JSValue *this_val,
-                            int argc, JSValue *argv)
+JSValue JS_NewJSONParser(JSContext *ctx, JSValue callback, int emit_depth)
 {
-    return JS_ThrowTypeError(ctx, "only Date.now() is supported");
-}
+    JSJSONParser *jp;
+    JSValue obj;
+    JSGCRef callback_ref;
 
-/* global */
+    if (!JS_IsUndefined(callback) && !JS_IsFunction(ctx, callback))
+        return JS_ThrowTypeError(ctx, "not a function");
+    if (emit_depth < 1 || emit_depth > 0xffff)
+        return JS_ThrowRangeError(ctx, "invalid depth");
+    JS_PUSH_VALUE(ctx, callback);
+    obj = JS_NewObjectClass(ctx, JS_CLASS_JSON_PARSER, sizeof(JSJSONParser));
+    JS_POP_VALUE(ctx, callback);
+    if (JS_IsException(obj))
+        return obj;
+    jp = js_get_json_parser1(obj);
+    jp->stack = JS_NULL;
+    jp->token = JS_NULL;
+    jp->callback = callback;
+    jp->result = JS_UNDEFINED;
+    jp->state = JSON_PARSER_VALUE;
+    jp->is_busy = FALSE;
+    jp->emit_depth = emit_depth;
+    jp->depth = 0;
+    jp->token_len = 0;
+    jp->pos = 0;
+    return obj;
+}
 
-JSValue js_global_eval(JSContext *ctx, JSValue *this_val,
-                       int argc, JSValue *argv)
+int JS_WriteJSONParser(JSContext *ctx, JSValue parser, const uint8_t *buf,
+                       size_t len)
 {
-    JSValue val;
-    
-    if (!JS_IsString(ctx, argv[0]))
-        return argv[0];
-    val = JS_Parse2(ctx, argv[0], NULL, 0, "<input>", JS_EVAL_RETVAL);
-    if (JS_IsException(val))
-        return val;
-    return JS_Run(ctx, val);
+    JSGCRef parser_ref;
+    int ret;
+
+    if (!js_get_json_parser(ctx, parser))
+        return -1;
+    JS_PUSH_VALUE(ctx, parser);
+    ret = js_json_parser_write(ctx, &parser_ref.val, NULL, buf, len);
+    JS_POP_VALUE(ctx, parser);
+    return ret;
 }
 
-JSValue js_global_isNaN(JSContext *ctx, JSValue *this_val,
-                        int argc, JSValue *argv)
+JSValue JS_EndJSONParser(JSContext *ctx, JSValue parser)
 {
-    double d;
-    if (unlikely(JS_ToNumber(ctx, &d, argv[0])))
+    JSGCRef parser_ref;
+    JSValue ret;
+
+    if (!js_get_json_parser(ctx, parser))
         return JS_EXCEPTION;
-    return JS_NewBool(isnan(d));
+    JS_PUSH_VALUE(ctx, parser);
+    ret = js_json_parser_end(ctx, &parser_ref.val);
+    JS_POP_VALUE(ctx, parser);
+    return ret;
 }
 
-JSValue js_global_isFinite(JSContext *ctx, JSValue *this_val,
-                                  int argc, JSValue *argv)
+JSValue js_json_parser_constructor(JSContext *ctx, JSValue *this_val,
+                                   int argc, JSValue *argv)
 {
-    double d;
-    if (unlikely(JS_ToNumber(ctx, &d, argv[0])))
-        return JS_EXCEPTION;
-    return JS_NewBool(isfinite(d));
+    int depth;
+
+    argc &= ~FRAME_CF_CTOR;
+    depth = 1;
+    if (!JS_IsUndefined(argv[1])) {
+        if (JS_ToInt32Sat(ctx, &depth, argv[1]))
+            return JS_EXCEPTION;
+    }
+    return JS_NewJSONParser(ctx, argv[0], depth);
 }
 
-/* JSON */
+JSValue js_json_parser_write_chunk(JSContext *ctx, JSValue *this_val,
+                                   int argc, JSValue *argv)
+{
+    JSStringCharBuf cbuf;
+    size_t len;
 
-JSValue js_json_parse(JSContext *ctx, JSValue *this_val,
-                      int argc, JSValue *argv)
+    if (!js_get_json_parser(ctx, *this_val))
+        return JS_EXCEPTION;
+    if (!js_get_json_chunk(ctx, &cbuf, &len, argv[0])) {
+        argv[0] = JS_ToString(ctx, argv[0]);
+        if (JS_IsException(argv[0]))
+            return JS_EXCEPTION;
+    }
+    if (js_json_parser_write(ctx, this_val, &argv[0], NULL, 0))
+        return JS_EXCEPTION;
+    return JS_UNDEFINED;
+}
+
+JSValue js_json_parser_end_input(JSContext *ctx, JSValue *this_val,
+                                 int argc, JSValue *argv)
 {
-    JSValue val;
-    
-    val = JS_ToString(ctx, argv[0]);
-    if (JS_IsException(val))
-        return val;
-    return JS_Parse2(ctx, val, NULL, 0, "<input>", JS_EVAL_JSON);
+    if (!js_get_json_parser(ctx, *this_val))
+        return JS_EXCEPTION;
+    return js_json_parser_end(ctx, this_val);
 }
 
 static int js_to_quoted_string(JSContext *ctx, StringBuffer *b, JSValue str)
@@ -15771,7 +22061,7 @@ static int js_to_quoted_string(JSContext *ctx, StringBuffer *b, JSValue str)
         p = get_string_ptr(ctx, &buf, str_ref.val);
         if (i >= p->len)
             break;
-        c = utf8_get(p->buf + i, &clen);
+        c = utf8_get(js_string_buf(p) + i, &clen);
         i += clen;
 
         switch(c) {
@@ -15827,11 +22117,11 @@ static int check_circular_ref(JSContext *ctx, JSValue *stack_top, JSValue val)
 }
 
 /* XXX: no space nor replacer */
-JSValue js_json_stringify(JSContext *ctx, JSValue *this_val,
-                          int argc, JSValue *argv)
+/* 'b' must be pushed. It is popped by this function. */
+static JSValue js_json_stringify_internal(JSContext *ctx, StringBuffer *b,
+                                          JSValue *pval)
 {
     JSValue obj, *stack_top;
-    StringBuffer b_s, *b = &b_s;
     int idx, ret;
     
 #if 0
@@ -15846,7 +22136,6 @@ JSValue js_json_stringify(JSContext *ctx, JSValue *this_val,
         *pspace = js_get_atom(ctx, JS_ATOM_empty);
     }
 #endif
-    string_buffer_push(ctx, b, 0);
     stack_top = ctx->sp;
 
     ret = JS_StackCheck(ctx, JSON_REC_SIZE);
@@ -15854,7 +22143,7 @@ JSValue js_json_stringify(JSContext *ctx, JSValue *this_val,
         goto fail;
     *--ctx->sp = JS_NULL; /* keys */
     *--ctx->sp = JS_NewShortInt(0); /* prop index */
-    *--ctx->sp = argv[0]; /* object */
+    *--ctx->sp = *pval; /* object */
     
     while (ctx->sp < stack_top) {
         obj = ctx->sp[0];
@@ -15974,6 +22263,66 @@ JSValue js_json_stringify(JSContext *ctx, JSValue *this_val,
     return JS_EXCEPTION;
 }
 
+JSValue js_json_stringify(JSContext *ctx, JSValue *this_val,
+                          int argc, JSValue *argv)
+{
+    StringBuffer b_s, *b = &b_s;
+
+    string_buffer_push(ctx, b, 0);
+    return js_json_stringify_internal(ctx, b, &argv[0]);
+}
+
+#define JSON_SINK_BUF_SIZE 64
+
+/* groups the small writes done during the serialization */
+typedef struct {
+    JSWriteFunc *write_func;
+    void *opaque;
+    size_t len;
+    uint8_t buf[JSON_SINK_BUF_SIZE];
+} JSONSinkBuf;
+
+static void json_sink_flush(JSONSinkBuf *s)
+{
+    if (s->len != 0) {
+        s->write_func(s->opaque, s->buf, s->len);
+        s->len = 0;
+    }
+}
+
+static void json_sink_write(void *opaque, const void *buf, size_t len)
+{
+    JSONSinkBuf *s = opaque;
+    if (s->len + len > JSON_SINK_BUF_SIZE) {
+        json_sink_flush(s);
+        if (len >= JSON_SINK_BUF_SIZE) {
+            s->write_func(s->opaque, buf, len);
+            return;
+        }
+    }
+    memcpy(s->buf + s->len, buf, len);
+    s->len += len;
+}
+
+int JS_StringifyToSink(JSContext *ctx, JSValue val, JSWriteFunc *write_func,
+                       void *opaque)
+{
+    StringBuffer b_s, *b = &b_s;
+    JSONSinkBuf sink;
+    JSGCRef val_ref;
+    JSValue ret;
+
+    sink.write_func = write_func;
+    sink.opaque = opaque;
+    sink.len = 0;
+    JS_PUSH_VALUE(ctx, val);
+    string_buffer_push_sink(ctx, b, json_sink_write, &sink);
+    ret = js_json_stringify_internal(ctx, b, &val_ref.val);
+    JS_POP_VALUE(ctx, val);
+    json_sink_flush(&sink);
+    return JS_IsException(ret) ? -1 : 0;
+}
+
 /**********************************************************************/
 /* regexp */
 
@@ -16138,6 +22487,20 @@ static __maybe_unused void lre_dump_bytecode(const uint8_t *buf,
             val = buf[pos + 1];
             printf(" r%u", val);
             break;
+        case REOP_prefix:
+            {
+                int n, i;
+                n = buf[pos + 1];
+                len += n;
+                for(i = 0; i < n; i++) {
+                    val = buf[pos + 2 + i];
+                    if (val >= ' ' && val <= 126)
+                        printf(" '%c'", val);
+                    else
+                        printf(" 0x%2x", val);
+                }
+            }
+            break;
         case REOP_range8:
             {
                 int n, i;
@@ -17042,10 +23405,11 @@ static int re_parse_alternative(JSParseState *s, int state, int dummy_param)
             (n1 = re_is_char(arr->buf, last_term_start, term_start)) > 0 &&
             (n2 = re_is_char(arr->buf, term_start, s->byte_code_len)) > 0 &&
             (n1 + n2) <= 4) {
+            /* remove the opcode of the second character */
+            for(i = 0; i < n2; i++)
+                arr->buf[last_term_start + 1 + n1 + i] = arr->buf[last_term_start + 1 + n1 + 1 + i];
             n1 += n2;
             arr->buf[last_term_start] = REOP_char1 + n1 - 1;
-            for(i = 0; i < n2; i++)
-                arr->buf[last_term_start + n1 + i] = arr->buf[last_term_start + n1 + i + 1];
             s->byte_code_len--;
         } else {
             last_term_start = term_start;
@@ -17148,6 +23512,49 @@ static int re_compute_register_count(JSParseState *s, uint8_t *bc_buf, int bc_bu
     return stack_size_max;
 }
 
+#define RE_PREFIX_LEN_MAX 16
+
+/* If every match starts with a literal string, insert a 'prefix'
+   opcode before the loop which tries each start position, so that
+   the positions which cannot match are skipped with memchr(). */
+static void re_emit_prefix(JSParseState *s)
+{
+    JSByteArray *arr;
+    uint8_t *buf, prefix[RE_PREFIX_LEN_MAX];
+    int pos, n, len, i, loop_pos;
+
+    loop_pos = RE_HEADER_LEN;
+    /* skip the loop and the capture starts */
+    pos = loop_pos + 5 + 1 + 5;
+    arr = JS_VALUE_TO_PTR(s->byte_code);
+    buf = arr->buf;
+    while (buf[pos] == REOP_save_start)
+        pos += 2;
+    n = 0;
+    while (buf[pos] >= REOP_char1 && buf[pos] <= REOP_char4) {
+        len = buf[pos] - REOP_char1 + 1;
+        if (n + len > RE_PREFIX_LEN_MAX)
+            break;
+        memcpy(prefix + n, buf + pos + 1, len);
+        n += len;
+        pos += 1 + len;
+    }
+    if (n == 0)
+        return;
+    len = 2 + n;
+    for(i = 0; i < len; i++)
+        emit_u8(s, 0);
+    arr = JS_VALUE_TO_PTR(s->byte_code);
+    buf = arr->buf;
+    memmove(buf + loop_pos + len, buf + loop_pos,
+            s->byte_code_len - len - loop_pos);
+    buf[loop_pos] = REOP_prefix;
+    buf[loop_pos + 1] = n;
+    memcpy(buf + loop_pos + 2, prefix, n);
+    /* the loop goes back to the prefix search */
+    put_u32(buf + loop_pos + len + 5 + 1 + 1, -(5 + 1 + 5 + len));
+}
+
 /* return a JSByteArray. 'source' must be a string */
 static JSValue js_parse_regexp(JSParseState *s, int re_flags)
 {
@@ -17187,6 +23594,9 @@ static JSValue js_parse_regexp(JSParseState *s, int re_flags)
         re_compute_register_count(s, arr->buf + RE_HEADER_LEN,
                                   s->byte_code_len - RE_HEADER_LEN);
     arr->buf[RE_HEADER_REGISTER_COUNT] = register_count;
+
+    if (!(re_flags & LRE_FLAG_STICKY))
+        re_emit_prefix(s);
     
     js_shrink_byte_array(s->ctx, &s->byte_code, s->byte_code_len);
 
@@ -17277,7 +23687,7 @@ static int lre_exec(JSContext *ctx, JSValue capture_buf,
     capture_count = lre_get_capture_count(pc);
     pc += RE_HEADER_LEN;
     ps = JS_VALUE_TO_PTR(str);
-    cbuf = ps->buf;
+    cbuf = js_string_buf(ps);
     cbuf_end = cbuf + ps->len;
     cptr = cbuf + cindex;
 
@@ -17309,7 +23719,7 @@ static int lre_exec(JSContext *ctx, JSValue capture_buf,
             arr = JS_VALUE_TO_PTR(byte_code);      \
             pc = arr->buf + saved_pc;                   \
             ps = JS_VALUE_TO_PTR(str);             \
-            cbuf = ps->buf;                             \
+            cbuf = js_string_buf(ps);                             \
             cbuf_end = cbuf + ps->len;                  \
             cptr = cbuf + saved_cptr;                   \
             arr = JS_VALUE_TO_PTR(capture_buf);    \
@@ -17340,7 +23750,7 @@ static int lre_exec(JSContext *ctx, JSValue capture_buf,
             arr = JS_VALUE_TO_PTR(byte_code);      \
             pc = arr->buf + saved_pc;                   \
             ps = JS_VALUE_TO_PTR(str);             \
-            cbuf = ps->buf;                             \
+            cbuf = js_string_buf(ps);                             \
             cbuf_end = cbuf + ps->len;                  \
             cptr = cbuf + saved_cptr;                   \
             arr = JS_VALUE_TO_PTR(capture_buf);    \
@@ -17514,6 +23924,25 @@ static int lre_exec(JSContext *ctx, JSValue capture_buf,
             pc += 4;
             cptr += 4;
             break;
+        case REOP_prefix:
+            {
+                const uint8_t *p;
+                /* go to the next position starting with the prefix */
+                val = pc[0];
+                for(;;) {
+                    if ((cbuf_end - cptr) < val)
+                        goto no_match;
+                    p = memchr(cptr, pc[1], cbuf_end - cptr - val + 1);
+                    if (!p)
+                        goto no_match;
+                    cptr = p;
+                    if (!memcmp(p + 1, pc + 2, val - 1))
+                        break;
+                    cptr++;
+                }
+                pc += 1 + val;
+            }
+            break;
         case REOP_split_goto_first:
         case REOP_split_next_first:
             {
@@ -17873,9 +24302,51 @@ static size_t js_parse_regexp_flags(int *pre_flags, const uint8_t *buf)
 }
 
 /* pattern and flags must be strings */
+#if JS_REGEXP_CACHE_SIZE > 0
+/* return JS_NULL if not found */
+static JSValue js_regexp_cache_find(JSContext *ctx, JSValue pattern, int re_flags)
+{
+    JSRegExpCacheEntry *ce;
+    JSByteArray *arr;
+    int i;
+
+    for(i = 0; i < JS_REGEXP_CACHE_SIZE; i++) {
+        ce = &ctx->regexp_cache[i];
+        if (ce->byte_code == JS_NULL)
+            continue;
+        arr = JS_VALUE_TO_PTR(ce->byte_code);
+        if (lre_get_flags(arr->buf) == re_flags &&
+            js_string_eq(ctx, ce->source, pattern)) {
+            ce->last_use = ++ctx->regexp_cache_clock;
+            return ce->byte_code;
+        }
+    }
+    return JS_NULL;
+}
+
+static void js_regexp_cache_add(JSContext *ctx, JSValue pattern, JSValue byte_code)
+{
+    JSRegExpCacheEntry *ce;
+    int i;
+
+    /* replace the least recently used entry. The empty entries have
+       last_use = 0. */
+    ce = &ctx->regexp_cache[0];
+    for(i = 1; i < JS_REGEXP_CACHE_SIZE; i++) {
+        if (ctx->regexp_cache[i].last_use < ce->last_use)
+            ce = &ctx->regexp_cache[i];
+    }
+    ce->source = pattern;
+    ce->byte_code = byte_code;
+    ce->last_use = ++ctx->regexp_cache_clock;
+}
+#endif
+
 static JSValue js_compile_regexp(JSContext *ctx, JSValue pattern, JSValue flags)
 {
     int re_flags;
+    JSValue byte_code;
+    JSGCRef pattern_ref;
     
     re_flags = 0;
     if (!JS_IsUndefined(flags)) {
@@ -17883,13 +24354,26 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValue pattern, JSValue flags)
         JSStringCharBuf buf;
         size_t len;
         ps = get_string_ptr(ctx, &buf, flags);
-        len = js_parse_regexp_flags(&re_flags, ps->buf);
+        len = js_parse_regexp_flags(&re_flags, js_string_buf(ps));
         if (len != ps->len)
             return JS_ThrowSyntaxError(ctx, "invalid regular expression flags");
     }
 
-    return JS_Parse2(ctx, pattern, NULL, 0, "<regexp>",
-                     JS_EVAL_REGEXP | (re_flags << JS_EVAL_REGEXP_FLAGS_SHIFT));
+#if JS_REGEXP_CACHE_SIZE > 0
+    /* the byte code is never modified so it can be shared */
+    byte_code = js_regexp_cache_find(ctx, pattern, re_flags);
+    if (byte_code != JS_NULL)
+        return byte_code;
+#endif
+    JS_PUSH_VALUE(ctx, pattern);
+    byte_code = JS_Parse2(ctx, pattern, NULL, 0, "<regexp>",
+                          JS_EVAL_REGEXP | (re_flags << JS_EVAL_REGEXP_FLAGS_SHIFT));
+    JS_POP_VALUE(ctx, pattern);
+#if JS_REGEXP_CACHE_SIZE > 0
+    if (!JS_IsException(byte_code))
+        js_regexp_cache_add(ctx, pattern, byte_code);
+#endif
+    return byte_code;
 }
 
 static JSRegExp *js_get_regexp(JSContext *ctx, JSValue obj)
@@ -18152,6 +24636,7 @@ JSValue js_regexp_exec(JSContext *ctx, JSValue *this_val,
                     p = JS_VALUE_TO_PTR(obj);
                     arr = JS_VALUE_TO_PTR(p->u.array.tab);
                     arr->arr[i] = val;
+                    js_write_barrier(ctx, arr, val);
                 }
             }
         }
@@ -18220,12 +24705,12 @@ static int js_string_concat_subst(JSContext *ctx, StringBuffer *b,
     for(;;) {
         p = get_string_ptr(ctx, &buf_rep, *rep);
         j = i;
-        while (j < rep_len && p->buf[j] != '$')
+        while (j < rep_len && js_string_buf(p)[j] != '$')
             j++;
         if (j + 1 >= rep_len)
             break;
         j0 = j++; /* j0 = position of '$' */
-        c = p->buf[j++];
+        c = js_string_buf(p)[j++];
         string_buffer_concat_utf8(ctx, b, *rep, 2 * i, 2 * j0);
         if (c == '$') {
             string_buffer_putc(ctx, b, '$');
@@ -18242,7 +24727,7 @@ static int js_string_concat_subst(JSContext *ctx, StringBuffer *b,
         } else if (c >= '0' && c <= '9') {
             k = c - '0';
             if (j < rep_len) {
-                c = p->buf[j];
+                c = js_string_buf(p)[j];
                 if (c >= '0' && c <= '9') {
                     k = k * 10 + c - '0';
                     j++;
@@ -99,6 +99,7 @@ typedef enum {
     JS_CLASS_STRING,
     JS_CLASS_DATE,
     JS_CLASS_REGEXP,
+    JS_CLASS_JSON_PARSER,
 
     JS_CLASS_ERROR,
     JS_CLASS_EVAL_ERROR,
@@ -111,6 +112,7 @@ typedef enum {
 
     JS_CLASS_ARRAY_BUFFER,
     JS_CLASS_TYPED_ARRAY,
+    JS_CLASS_DATA_VIEW,
 
     JS_CLASS_UINT8C_ARRAY,
     JS_CLASS_INT8_ARRAY,
@@ -216,6 +218,9 @@ void *JS_GetOpaque(JSContext *ctx, JSValue val);
 typedef JSValue JSCFunction(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 /* no JS function call be called from a C finalizer */
 typedef void (*JSCFinalizer)(JSContext *ctx, void *opaque);
+/* called when an external array buffer is garbage collected. No JS
+   function can be called from it. */
+typedef void JSFreeArrayBufferDataFunc(JSContext *ctx, void *opaque, void *ptr);
 
 typedef enum JSCFunctionDefEnum {  /* XXX: should rename for namespace isolation */
     JS_CFUNC_generic,
@@ -223,7 +228,14 @@ typedef enum JSCFunctionDefEnum {  /* XXX: should rename for namespace isolation
     JS_CFUNC_constructor,
     JS_CFUNC_constructor_magic,
     JS_CFUNC_generic_params,
+    /* typed signatures: the arguments are converted before the call
+       and the C function cannot throw. When all the arguments are
+       numbers, the interpreter calls them without creating a frame. */
     JS_CFUNC_f_f,
+    JS_CFUNC_f_ff,
+    JS_CFUNC_i_ii,
+    JS_CFUNC_i_iii,
+    JS_CFUNC_v_iii,
 } JSCFunctionDefEnum;
 
 typedef union JSCFunctionType {
@@ -233,6 +245,10 @@ typedef union JSCFunctionType {
     JSValue (*constructor_magic)(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv, int magic);
     JSValue (*generic_params)(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv, JSValue params);
     double (*f_f)(double f);
+    double (*f_ff)(double f1, double f2);
+    int (*i_ii)(int a1, int a2);
+    int (*i_iii)(int a1, int a2, int a3);
+    void (*v_iii)(int a1, int a2, int a3);
 } JSCFunctionType;
 
 typedef struct JSCFunctionDef {
@@ -252,6 +268,13 @@ typedef struct {
     uint32_t sorted_atoms_offset;
     uint32_t global_object_offset;
     uint32_t class_count;
+    /* optional perfect hash of the sorted atom table: (1 <<
+       atom_bucket_bits) bucket displacements followed by (1 <<
+       atom_hash_bits) indexes in the sorted atom table (0xffff =
+       empty slot). NULL if not present. */
+    const uint16_t *atom_hash_table;
+    uint32_t atom_hash_bits;
+    uint32_t atom_bucket_bits;
 } JSSTDLibraryDef;
 
 typedef void JSWriteFunc(void *opaque, const void *buf, size_t buf_len);
@@ -264,6 +287,17 @@ JSContext *JS_NewContext(void *mem_start, size_t mem_size, const JSSTDLibraryDef
    the embedded version */
 JSContext *JS_NewContext2(void *mem_start, size_t mem_size, const JSSTDLibraryDef *stdlib_def, JS_BOOL prepare_compilation);
 void JS_FreeContext(JSContext *ctx);
+
+/* host state attached to a context (e.g. the timer queue). 'func' is
+   called by JS_FreeContext() before the user C finalizers. */
+typedef struct JSContextFreeHook {
+    void (*func)(JSContext *ctx, struct JSContextFreeHook *hook);
+    struct JSContextFreeHook *link; /* next hook of the context */
+} JSContextFreeHook;
+
+/* Does nothing if the hook is already attached to 'ctx' */
+void JS_AddContextFreeHook(JSContext *ctx, JSContextFreeHook *hook);
+void JS_RemoveContextFreeHook(JSContext *ctx, JSContextFreeHook *hook);
 void JS_SetContextOpaque(JSContext *ctx, void *opaque);
 void JS_SetInterruptHandler(JSContext *ctx, JSInterruptHandler *interrupt_handler);
 void JS_SetRandomSeed(JSContext *ctx, uint64_t seed);
@@ -294,6 +328,7 @@ JSValue JS_NewCFunctionParams(JSContext *ctx, int func_idx, JSValue params);
 #define JS_EVAL_STRIP_COL (1 << 2) /* strip column number debug information (save memory) */
 #define JS_EVAL_JSON      (1 << 3) /* parse as JSON and return the object */
 #define JS_EVAL_REGEXP    (1 << 4) /* internal use */
+#define JS_EVAL_LAZY      (1 << 5) /* compile the nested functions at their first call (save memory) */
 #define JS_EVAL_REGEXP_FLAGS_SHIFT 8  /* internal use */
 JSValue JS_Parse(JSContext *ctx, const char *input, size_t input_len,
                  const char *filename, int eval_flags);
@@ -301,16 +336,61 @@ JSValue JS_Run(JSContext *ctx, JSValue val);
 JSValue JS_Eval(JSContext *ctx, const char *input, size_t input_len,
                 const char *filename, int eval_flags);
 void JS_GC(JSContext *ctx);
+/* opportunistic GC to call when the application is idle: do a
+   complete collection if enough memory was allocated since the last
+   one. It is not incremental. Return TRUE if a collection was done. */
+JS_BOOL JS_GCIdle(JSContext *ctx);
 JSValue JS_NewStringLen(JSContext *ctx, const char *buf, size_t buf_len);
 JSValue JS_NewString(JSContext *ctx, const char *buf);
 const char *JS_ToCStringLen(JSContext *ctx, size_t *plen, JSValue val, JSCStringBuf *buf);
 const char *JS_ToCString(JSContext *ctx, JSValue val, JSCStringBuf *buf);
+/* Scratch memory for the C functions, taken from the free area below
+   the stack. It is not moved by the GC and is freed when the C
+   function returns. Return NULL if exception. */
+void *JS_TempAlloc(JSContext *ctx, size_t size);
+/* zero terminated copy of JS_ToString(val) allocated with
+   JS_TempAlloc(). Contrary to JS_ToCString(), the pointer stays valid
+   after other allocations. */
+const char *JS_ToTempCString(JSContext *ctx, size_t *plen, JSValue val);
 JSValue JS_ToString(JSContext *ctx, JSValue val);
 int JS_ToInt32(JSContext *ctx, int *pres, JSValue val);
 int JS_ToUint32(JSContext *ctx, uint32_t *pres, JSValue val);
 int JS_ToInt32Sat(JSContext *ctx, int *pres, JSValue val);
 int JS_ToNumber(JSContext *ctx, double *pres, JSValue val);
 
+/* Serialize 'val' as JSON.stringify(val) would and send the text to
+   'write_func' in pieces. The text is not accumulated in the JS
+   heap. Return -1 in case of exception (the text may then be
+   truncated). */
+int JS_StringifyToSink(JSContext *ctx, JSValue val, JSWriteFunc *write_func,
+                       void *opaque);
+/* Incremental JSON parser. The text can be given in chunks of any
+   size. If 'callback' is a function, the values at depth 'emit_depth'
+   (>= 1) are passed to callback(key, value) instead of being stored
+   in their parent. */
+JSValue JS_NewJSONParser(JSContext *ctx, JSValue callback, int emit_depth);
+/* return -1 in case of exception */
+int JS_WriteJSONParser(JSContext *ctx, JSValue parser, const uint8_t *buf,
+                       size_t len);
+/* return the parsed value. The parser is then reset, also in case of
+   exception, and can be reused for a new document. */
+JSValue JS_EndJSONParser(JSContext *ctx, JSValue parser);
+
+/* Return an ArrayBuffer whose data is 'buf'. The memory is not
+   copied and must stay valid until 'free_func' (which may be NULL) is
+   called. For typed arrays, 'buf' must be aligned on the element
+   size. */
+JSValue JS_NewArrayBufferExternal(JSContext *ctx, uint8_t *buf, size_t len,
+                                  JSFreeArrayBufferDataFunc *free_func,
+                                  void *opaque);
+/* return NULL if 'obj' is not an ArrayBuffer */
+uint8_t *JS_GetArrayBuffer(JSContext *ctx, size_t *plen, JSValue obj);
+/* return NULL if 'obj' is not a typed array of class 'class_id'
+   (e.g. JS_CLASS_FLOAT32_ARRAY). '*plen' is the number of elements. The
+   pointer is only valid until the next JS allocation. */
+void *JS_GetTypedArray(JSContext *ctx, size_t *plen, JSValue obj,
+                       int class_id);
+
 JSValue JS_GetException(JSContext *ctx);
 int JS_StackCheck(JSContext *ctx, uint32_t len);
 void JS_PushArg(JSContext *ctx, JSValue val);
@@ -318,6 +398,61 @@ void JS_PushArg(JSContext *ctx, JSValue val);
                                              C constructors */
 JSValue JS_Call(JSContext *ctx, int call_flags);
 
+/* Job queue. 'func' is called with 'argc' arguments from 'argv' and
+   'this' set to null by JS_RunPendingJobs(). 'argv' must point to GC
+   roots (e.g. the arguments of a C function). Return -1 if
+   exception. */
+int JS_EnqueueJob(JSContext *ctx, JSValue func, int argc, JSValue *argv);
+/* Run the pending events of the rings added with JS_AddEventRing()
+   then the jobs queued before the call, at most 'budget' in total
+   (no limit if budget <= 0). Return the number of jobs and events
+   processed or -1 if exception. */
+int JS_RunPendingJobs(JSContext *ctx, int budget);
+/* TRUE if a job or an event is waiting */
+JS_BOOL JS_IsJobPending(JSContext *ctx);
+
+/* Single producer, single consumer ring of variable size
+   events. The producer (another task or an interrupt handler) only
+   calls JS_PostEvent() or JS_ReserveEvent() / JS_CommitEvent() and
+   never accesses the JSContext. The consumer is the task running the
+   context: the events are given to 'handler' by JS_RunPendingJobs(),
+   'data' is only valid during the call. 'handler' returns -1 if
+   exception. */
+typedef int JSEventHandler(JSContext *ctx, void *opaque,
+                           const uint8_t *data, size_t len);
+
+typedef struct JSEventRing {
+    uint8_t *buf;
+    uint32_t size;
+    uint32_t head; /* only written by the producer */
+    uint32_t tail; /* only written by the consumer */
+    uint32_t reserve_pos; /* producer state between Reserve and Commit */
+    uint32_t reserve_len;
+    JS_BOOL reserve_reset;
+    uint32_t reset_pos; /* set by the producer, cleared by the consumer */
+    JSEventHandler *handler;
+    void *opaque;
+    struct JSEventRing *link; /* next ring of the context */
+} JSEventRing;
+
+/* 'buf' must be 32 bit aligned. An event uses its length rounded up
+   to 4 bytes plus 4 bytes. */
+void JS_InitEventRing(JSEventRing *r, void *buf, size_t size,
+                      JSEventHandler *handler, void *opaque);
+/* Does nothing if the ring is already attached to 'ctx' */
+void JS_AddEventRing(JSContext *ctx, JSEventRing *r);
+void JS_RemoveEventRing(JSContext *ctx, JSEventRing *r);
+/* producer: return a pointer to 'len' bytes to fill before calling
+   JS_CommitEvent() or NULL if the ring is full */
+uint8_t *JS_ReserveEvent(JSEventRing *r, size_t len);
+/* producer: publish the reserved event. Return TRUE if the ring was
+   empty, i.e. the consumer task may be waiting and should be woken
+   up. */
+JS_BOOL JS_CommitEvent(JSEventRing *r);
+/* producer: copy and publish an event. Return -1 if the ring is full,
+   otherwise the result of JS_CommitEvent() */
+int JS_PostEvent(JSEventRing *r, const void *data, size_t len);
+
 #define JS_BYTECODE_MAGIC   0xacfb
 #define JS_BYTECODE_VERSION_32_V1  0x0001  /* Original 32-bit bytecode */
 #define JS_BYTECODE_VERSION_32_V2  0x0002  /* With ROM atom translation table */
@@ -374,18 +509,68 @@ size_t JS_GetRomTableSize(const JSBytecodeHeader *hdr);
    later. Return 0 if OK, != 0 if error */
 int JS_RelocateBytecode(JSContext *ctx,
                         uint8_t *buf, uint32_t buf_len);
+/* Same as JS_RelocateBytecode() but the bytecode is relocated so
+   that it can be executed at 'load_addr' once copied there (e.g. to
+   the mapped address of the flash area it is written to). Only
+   'buf' is accessed, so 'load_addr' need not be readable yet. */
+int JS_RelocateBytecodeTo(JSContext *ctx, uint8_t *buf, uint32_t buf_len,
+                          uintptr_t load_addr);
+/* Return TRUE if the bytecode in 'buf' is relocated for its current
+   address so that JS_LoadBytecode() can execute it in place */
+JS_BOOL JS_IsBytecodeRelocated(const uint8_t *buf, size_t buf_len);
 /* Load the precompiled bytecode from 'buf'. 'buf' must be allocated
    as long as the JSContext exists. Use JS_Run() to execute
    it. warning: the bytecode is not checked so it should come from a
    trusted source. */
 JSValue JS_LoadBytecode(JSContext *ctx, const uint8_t *buf);
+/* Write with 'write_func' the strings referenced by the compiled
+   function 'val' (returned by JS_Parse() or JS_LoadBytecode()) and by
+   its nested functions, one per line: property names, global
+   variable names and string literals. A string may be written
+   several times. Return -1 if 'val' is not a compiled function. */
+int JS_DumpBytecodeNames(JSContext *ctx, JSValue val,
+                         JSWriteFunc *write_func, void *opaque);
+
+/* Write the compiled function 'val' (returned by JS_Parse()) with
+   'write_func' in the compact transport format: it does not depend
+   on the word size and is smaller than the saved bytecode but must
+   be loaded in the heap. May trigger a GC. Return 0 if OK, -1 if
+   exception. */
+int JS_WriteCompactBytecode(JSContext *ctx, JSValue val,
+                            JSWriteFunc *write_func, void *opaque);
+JS_BOOL JS_IsCompactBytecode(const uint8_t *buf, size_t buf_len);
+/* Expand the compact bytecode of 'buf' in the heap. 'buf' can be
+   freed after the call. Use JS_Run() to execute it. warning: only
+   the format is checked, not the bytecode itself, so it should come
+   from a trusted source. */
+JSValue JS_LoadCompactBytecode(JSContext *ctx, const uint8_t *buf, size_t buf_len);
+
+/* Save the state of a context which is not running JS code with
+   'write_func'. The objects referenced only from C (JSGCRef) are not
+   restored. Return 0 if OK, -1 if exception (objects with a
+   finalizer cannot be saved). */
+int JS_SaveSnapshot(JSContext *ctx, JSWriteFunc *write_func, void *opaque);
+/* Create a context in 'mem_start' from a snapshot saved by the same
+   executable with the same stdlib. 'buf' can be freed afterwards and
+   'mem_size' may differ from the saved context. Return NULL if the
+   snapshot is invalid or does not fit. The context settings
+   (opaque, log function, handlers) must be set again. */
+JSContext *JS_RestoreSnapshot(void *mem_start, size_t mem_size,
+                              const JSSTDLibraryDef *stdlib_def,
+                              const uint8_t *buf, size_t buf_len);
 
 /* debug functions */
 void JS_SetLogFunc(JSContext *ctx, JSWriteFunc *write_func);
 void JS_PrintValue(JSContext *ctx, JSValue val);
 
-/* timer processing - call periodically to execute scheduled timers */
+/* timer processing (mqjs_timer.c) - call periodically to execute the
+   pending jobs and events (see JS_RunPendingJobs()) and the expired
+   timers. Return the delay in ms until the next deadline (0 if jobs
+   are pending), -1 if nothing is pending or -2 if a callback raised
+   an exception (available with JS_GetException()). */
 int64_t JS_ProcessTimers(JSContext *ctx);
+/* delay in ms until the next deadline or -1 if no timer is pending */
+int64_t JS_GetNextTimerDelay(JSContext *ctx);
 #define JS_DUMP_LONG      (1 << 0) /* display object/array content */
 #define JS_DUMP_NOQUOTE   (1 << 1) /* strings: no quote for identifiers */
 /* for low level dumps: don't dump special properties and use specific
@@ -399,6 +584,95 @@ void JS_DumpValue(JSContext *ctx, const char *str,
                   JSValue val);
 void JS_DumpMemory(JSContext *ctx, JS_BOOL is_long);
 
+/* memory and GC statistics */
+
+/* return a monotonic time in microseconds */
+typedef int64_t JSClockFunc(JSContext *ctx, void *opaque);
+
+/* the GC pauses are only measured if a clock function is set */
+void JS_SetClockFunc(JSContext *ctx, JSClockFunc *clock_func);
+
+#define JS_GC_PAUSE_HIST_SIZE 8
+
+typedef struct {
+    uint32_t count; /* number of full collections */
+    uint32_t minor_count; /* number of minor collections */
+    uint64_t reclaimed_total; /* bytes freed by all the collections */
+    uint32_t reclaimed_last; /* bytes freed by the last collection */
+    uint64_t pause_total; /* total pause time in microseconds */
+    uint32_t pause_max;
+    uint32_t pause_last;
+    /* pause_hist[i] is the number of pauses shorter than 2^(i+6)
+       microseconds, the last entry counts all the longer pauses */
+    uint32_t pause_hist[JS_GC_PAUSE_HIST_SIZE];
+} JSGCStats;
+
+typedef struct {
+    uint32_t count;
+    uint32_t size; /* in bytes */
+} JSMemBlockStats;
+
+typedef struct {
+    uint32_t mem_size; /* memory shared by the heap and the stack */
+    uint32_t heap_size;
+    uint32_t stack_size;
+    uint32_t heap_size_max; /* high-water mark of the heap size */
+    uint32_t stack_size_max; /* high-water mark of the stack size */
+    /* low-water mark of the free memory between the heap and the stack */
+    uint32_t free_size_min;
+    /* blocks currently in the heap */
+    JSMemBlockStats free_blocks;
+    JSMemBlockStats objects;
+    JSMemBlockStats float64;
+    JSMemBlockStats strings;
+    JSMemBlockStats function_bytecode;
+    JSMemBlockStats value_arrays;
+    JSMemBlockStats byte_arrays;
+    JSMemBlockStats var_refs;
+    JSGCStats gc;
+} JSMemoryStats;
+
+/* scan the heap (no allocation is done) */
+void JS_GetMemoryStats(JSContext *ctx, JSMemoryStats *stats);
+/* restart the high-water marks from the current sizes and clear the
+   GC statistics, e.g. to measure a single benchmark */
+void JS_ResetMemoryStats(JSContext *ctx);
+
+/* stack sampling (profiler) */
+
+typedef struct {
+    const char *func_name; /* NULL if anonymous */
+    const char *filename; /* NULL if native function */
+    int line_num; /* 0 if unknown */
+    int col_num; /* 0 if unknown */
+    JSCStringBuf func_name_buf;
+    JSCStringBuf filename_buf;
+} JSStackFrame;
+
+/* Fill 'tab' with at most 'max_frames' frames of the current call
+   stack, starting from the innermost one. Return the number of
+   frames. No allocation is done so it can be called from the
+   interrupt handler. The strings are only valid until the next
+   memory allocation. */
+int JS_GetStackFrames(JSContext *ctx, JSStackFrame *tab, int max_frames);
+
+/* heap profiler (only available with CONFIG_HEAP_PROFILE) */
+
+/* Record the allocation site (innermost JS function and line) of
+   each new memory block in 'buf' (pointer aligned, at least a few kB,
+   outside the JS heap). 'buf' = NULL stops the profiling. Return -1
+   if the profiler is not available or 'buf' is too small. The
+   functions of the allocation sites are kept alive until the
+   profiling is stopped. */
+int JS_EnableHeapProfile(JSContext *ctx, void *buf, size_t buf_size);
+/* Run a full GC, then print the live bytes per memory tag, the
+   'max_sites' allocation sites using the most memory and, for the
+   largest blocks, their retained size and a chain of blocks
+   referencing them up to a root. 'write_func' = NULL uses the log
+   function. */
+void JS_DumpHeapProfile(JSContext *ctx, int max_sites,
+                        JSWriteFunc *write_func, void *opaque);
+
 /* Bytecode relocation helpers - expose internal memory block information */
 
 /* Get size of a memory block in bytes */
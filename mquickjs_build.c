@@ -77,7 +77,11 @@ typedef struct {
     int cur_offset;
     int sorted_atom_table_offset;
     int global_object_offset;
+    int atom_hash_bits; /* 0 if no atom hash table */
+    int atom_bucket_bits;
     struct list_head class_list;
+    BOOL strip_unused; /* only keep the properties in used_names */
+    AtomList used_names;
 } BuildContext;
 
 static const char *atoms[] = {
@@ -225,6 +229,79 @@ static int add_atom(AtomList *s, const char *str)
     return s->count - 1;
 }
 
+static BOOL is_predefined_atom(const char *str)
+{
+    int i;
+    for(i = 0; i < countof(atoms); i++) {
+        if (!strcmp(str, atoms[i]))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/* With '-u', a property is kept if its name is used by the
+   application. The properties whose name is a predefined atom are
+   kept because the engine accesses them implicitly (e.g. toString()
+   in conversions). The classes with a constructor are always kept
+   because the engine needs their prototype to create objects
+   (literals, exceptions...), but their properties are stripped
+   too. */
+static BOOL is_prop_used(BuildContext *s, const JSPropDef *d)
+{
+    if (!s->strip_unused)
+        return TRUE;
+    if (find_atom(&s->used_names, d->name) >= 0 ||
+        is_predefined_atom(d->name))
+        return TRUE;
+    if (d->def_type == JS_DEF_CLASS && d->u.class1->func_name)
+        return TRUE;
+    return FALSE;
+}
+
+/* return a copy of 'props_def' without the unused properties */
+static JSPropDef *strip_props(BuildContext *s, const JSPropDef *props_def)
+{
+    const JSPropDef *d;
+    JSPropDef *tab;
+    int n;
+
+    n = 0;
+    for(d = props_def; d->def_type != JS_DEF_END; d++)
+        n++;
+    tab = malloc(sizeof(tab[0]) * (n + 1));
+    n = 0;
+    for(d = props_def; d->def_type != JS_DEF_END; d++) {
+        if (is_prop_used(s, d))
+            tab[n++] = *d;
+    }
+    tab[n] = *d; /* JS_DEF_END */
+    return tab;
+}
+
+/* load the names used by the application, one per line (output of
+   "mqjs --dump-names") */
+static void load_used_names(BuildContext *s, const char *filename)
+{
+    FILE *f;
+    char line[1024];
+    size_t len;
+
+    f = fopen(filename, "r");
+    if (!f) {
+        perror(filename);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), f)) {
+        len = strlen(line);
+        if (len > 0 && line[len - 1] == '\n')
+            line[--len] = '\0';
+        if (len > 0 && find_atom(&s->used_names, line) < 0)
+            add_atom(&s->used_names, line);
+    }
+    fclose(f);
+    s->strip_unused = TRUE;
+}
+
 static int add_cfunc(CFuncList *s, const char *name, int length, const char *magic, const char *cproto_name, const char *cfunc_name)
 {
     int i;
@@ -337,6 +414,129 @@ static void dump_atoms(BuildContext *ctx)
     free(sorted_atoms);
 }
 
+typedef struct {
+    int bucket;
+    int count;
+} AtomBucket;
+
+static int atom_bucket_cmp(const void *p1, const void *p2)
+{
+    const AtomBucket *b1 = (const AtomBucket *)p1;
+    const AtomBucket *b2 = (const AtomBucket *)p2;
+    if (b1->count != b2->count)
+        return b2->count - b1->count;
+    return b1->bucket - b2->bucket;
+}
+
+/* Build a perfect hash of the sorted atom table with the "hash and
+   displace" method: the atoms are dispatched in buckets with the low
+   bits of their hash, then for each bucket (largest first) a
+   displacement is searched so that all its atoms land on free slots.
+   A lookup then costs one hash computation and a single string
+   comparison. */
+static void dump_atom_hash_table(BuildContext *ctx)
+{
+    AtomList *s = &ctx->atom_list;
+    AtomDef *sorted_atoms;
+    AtomBucket *buckets;
+    uint32_t *hashes, d;
+    uint16_t *disp, *slots;
+    int i, j, k, n, hash_bits, bucket_bits, hash_size, bucket_count;
+    int bucket_mask, b;
+
+    n = s->count;
+    ctx->atom_hash_bits = 0;
+    if (n == 0 || n >= 0xffff)
+        return;
+    /* load factor <= 0.8 and about 4 atoms per bucket */
+    hash_bits = 4;
+    while ((1 << hash_bits) * 4 < n * 5)
+        hash_bits++;
+    bucket_bits = 0;
+    while ((1 << bucket_bits) * 4 < n)
+        bucket_bits++;
+    hash_size = 1 << hash_bits;
+    bucket_count = 1 << bucket_bits;
+    bucket_mask = bucket_count - 1;
+
+    sorted_atoms = malloc(sizeof(sorted_atoms[0]) * n);
+    memcpy(sorted_atoms, s->tab, sizeof(sorted_atoms[0]) * n);
+    qsort(sorted_atoms, n, sizeof(sorted_atoms[0]), atom_cmp);
+    hashes = malloc(sizeof(hashes[0]) * n);
+    for(i = 0; i < n; i++) {
+        hashes[i] = hash_string8((const uint8_t *)sorted_atoms[i].str,
+                                 strlen(sorted_atoms[i].str));
+    }
+    buckets = malloc(sizeof(buckets[0]) * bucket_count);
+    for(i = 0; i < bucket_count; i++) {
+        buckets[i].bucket = i;
+        buckets[i].count = 0;
+    }
+    for(i = 0; i < n; i++)
+        buckets[hashes[i] & bucket_mask].count++;
+    qsort(buckets, bucket_count, sizeof(buckets[0]), atom_bucket_cmp);
+
+    disp = malloc(sizeof(disp[0]) * bucket_count);
+    memset(disp, 0, sizeof(disp[0]) * bucket_count);
+    slots = malloc(sizeof(slots[0]) * hash_size);
+    for(i = 0; i < hash_size; i++)
+        slots[i] = 0xffff;
+
+    for(k = 0; k < bucket_count && buckets[k].count != 0; k++) {
+        b = buckets[k].bucket;
+        for(d = 0; d < 0x10000; d++) {
+            /* try to place all the atoms of the bucket */
+            for(i = 0; i < n; i++) {
+                uint32_t slot;
+                if ((hashes[i] & bucket_mask) != b)
+                    continue;
+                slot = atom_hash_slot(hashes[i], d, hash_bits);
+                if (slots[slot] != 0xffff)
+                    break;
+                slots[slot] = i;
+            }
+            if (i == n)
+                break;
+            /* failed: remove the atoms placed with this displacement */
+            for(j = 0; j < i; j++) {
+                uint32_t slot;
+                if ((hashes[j] & bucket_mask) != b)
+                    continue;
+                slot = atom_hash_slot(hashes[j], d, hash_bits);
+                slots[slot] = 0xffff;
+            }
+        }
+        if (d == 0x10000) {
+            fprintf(stderr, "warning: could not build the atom hash table\n");
+            goto done;
+        }
+        disp[b] = d;
+    }
+
+    printf("static const uint16_t js_atom_hash_table[] = {\n");
+    printf("  /* bucket displacements */\n");
+    for(i = 0; i < bucket_count; i++) {
+        printf("%s%u,", (i % 16) == 0 ? "  " : " ", disp[i]);
+        if ((i % 16) == 15 || i == bucket_count - 1)
+            printf("\n");
+    }
+    printf("  /* sorted atom table index of each slot */\n");
+    for(i = 0; i < hash_size; i++) {
+        printf("%s%u,", (i % 16) == 0 ? "  " : " ", slots[i]);
+        if ((i % 16) == 15 || i == hash_size - 1)
+            printf("\n");
+    }
+    printf("};\n\n");
+    ctx->atom_hash_bits = hash_bits;
+    ctx->atom_bucket_bits = bucket_bits;
+ done:
+    free(slots);
+    free(disp);
+    free(buckets);
+    free(hashes);
+    free(sorted_atoms);
+}
+
 static int define_value(BuildContext *s, const JSPropDef *d);
 
 static uint32_t dump_atom(BuildContext *s, const char *str, BOOL value_only)
@@ -434,12 +634,18 @@ static int define_props(BuildContext *s, const JSPropDef *props_def,
     const JSPropDef *d;
     uint32_t *prop_hash;
     BOOL is_global_object = (props_kind == PROPS_KIND_GLOBAL);
+    JSPropDef *stripped_props;
     static const JSPropDef dummy_props[] = {
         { JS_DEF_END },
     };
 
     if (!props_def)
         props_def = dummy_props;
+    stripped_props = NULL;
+    if (s->strip_unused) {
+        stripped_props = strip_props(s, props_def);
+        props_def = stripped_props;
+    }
     
     n_props = 0;
     for(d = props_def; d->def_type != JS_DEF_END; d++) {
@@ -593,6 +799,7 @@ static int define_props(BuildContext *s, const JSPropDef *props_def,
 
     free(prop_hash);
     free(ident_tab);
+    free(stripped_props);
     return props_ident;
 }
 
@@ -790,6 +997,8 @@ static void define_atoms_props(BuildContext *s, const JSPropDef *props_def, JSPr
 {
     const JSPropDef *d;
     for(d = props_def; d->def_type != JS_DEF_END; d++) {
+        if (!is_prop_used(s, d))
+            continue;
         add_atom(&s->atom_list, d->name);
         switch(d->def_type) {
         case JS_DEF_PROP_STRING:
@@ -819,13 +1028,15 @@ static void define_atoms_props(BuildContext *s, const JSPropDef *props_def, JSPr
 
 static int usage(const char *name)
 {
-    fprintf(stderr, "usage: %s {-m32 | -m64} [-a]\n", name);
+    fprintf(stderr, "usage: %s {-m32 | -m64} [-a] [-u names_file]\n", name);
     fprintf(stderr,
             "    create a ROM file for the mquickjs standard library\n"
             "--help       list options\n"
             "-m32         force generation for a 32 bit target\n"
             "-m64         force generation for a 64 bit target\n"
             "-a           generate the mquickjs_atom.h header\n"
+            "-u FILE      only keep the properties whose name is listed in FILE\n"
+            "             (generated by 'mqjs --dump-names')\n"
             );
     return 1;
 }
@@ -837,6 +1048,7 @@ int build_atoms(const char *stdlib_name, const JSPropDef *global_obj,
     unsigned jsw;
     BuildContext ss, *s = &ss;
     BOOL build_atom_defines = FALSE;
+    const char *used_names_filename = NULL;
     
 #if INTPTR_MAX >= INT64_MAX
     jsw = 8;
@@ -850,6 +1062,8 @@ int build_atoms(const char *stdlib_name, const JSPropDef *global_obj,
             jsw = 4;
         } else if (!strcmp(argv[i], "-a")) {
             build_atom_defines = TRUE;
+        } else if (!strcmp(argv[i], "-u") && i + 1 < argc) {
+            used_names_filename = argv[++i];
         } else if (!strcmp(argv[i], "--help")) {
             return usage(argv[0]);
         } else {
@@ -867,6 +1081,8 @@ int build_atoms(const char *stdlib_name, const JSPropDef *global_obj,
     
     memset(s, 0, sizeof(*s));
     init_list_head(&s->class_list);
+    if (used_names_filename)
+        load_used_names(s, used_names_filename);
 
     /* add the predefined atoms (they have a corresponding define) */
     for(i = 0; i < countof(atoms); i++) {
@@ -907,6 +1123,8 @@ int build_atoms(const char *stdlib_name, const JSPropDef *global_obj,
 
     printf("};\n\n");
 
+    dump_atom_hash_table(s);
+
     dump_cfuncs(s);
     
     printf("#ifndef JS_CLASS_COUNT\n"
@@ -926,6 +1144,11 @@ int build_atoms(const char *stdlib_name, const JSPropDef *global_obj,
     printf("  %d,\n", s->sorted_atom_table_offset);
     printf("  %d,\n", s->global_object_offset);
     printf("  JS_CLASS_COUNT,\n");
+    if (s->atom_hash_bits != 0) {
+        printf("  js_atom_hash_table,\n");
+        printf("  %d,\n", s->atom_hash_bits);
+        printf("  %d,\n", s->atom_bucket_bits);
+    }
     printf("};\n\n");
 
     return 0;
@@ -203,6 +203,26 @@ DEF(       put_arg0, 1, 1, 0, none_arg)  /* must follow get_arg */
 DEF(       put_arg1, 1, 1, 0, none_arg)
 DEF(       put_arg2, 1, 1, 0, none_arg)
 DEF(       put_arg3, 1, 1, 0, none_arg)
+/* superinstructions generated by fuse_superinstructions(). They have
+   the same size, format and stack effect as the first opcode of the
+   sequence they replace. The order is used by dump_byte_code(). */
+DEF(get_loc0_get_field, 1, 0, 1, none_loc) /* must follow put_arg3 */
+DEF(get_loc1_get_field, 1, 0, 1, none_loc)
+DEF(get_loc2_get_field, 1, 0, 1, none_loc)
+DEF(get_loc3_get_field, 1, 0, 1, none_loc)
+DEF(       inc_loc0, 1, 0, 1, none_loc) /* get_loc inc put_loc */
+DEF(       inc_loc1, 1, 0, 1, none_loc)
+DEF(       inc_loc2, 1, 0, 1, none_loc)
+DEF(       inc_loc3, 1, 0, 1, none_loc)
+DEF(get_arg0_get_field, 1, 0, 1, none_arg)
+DEF(get_arg1_get_field, 1, 0, 1, none_arg)
+DEF(get_arg2_get_field, 1, 0, 1, none_arg)
+DEF(get_arg3_get_field, 1, 0, 1, none_arg)
+DEF(       inc_loc8, 2, 0, 1, loc8)
+DEF(    lt_if_false, 1, 2, 1, none) /* same order as lt, lte, gt, gte */
+DEF(   lte_if_false, 1, 2, 1, none)
+DEF(    gt_if_false, 1, 2, 1, none)
+DEF(   gte_if_false, 1, 2, 1, none)
 #if 0
 DEF(      if_false8, 2, 1, 0, label8)
 DEF(       if_true8, 2, 1, 0, label8) /* must come after if_false8 */
@@ -260,5 +280,6 @@ REDEF(lookahead, 5)
 REDEF(negative_lookahead, 5) /* must come after */
 REDEF(set_char_pos, 2) /* store the character position to a register */
 REDEF(check_advance, 2) /* check that the register is different from the character position */
+REDEF(prefix, 2) /* variable length: skip to the next occurrence of a literal string */
 
 #endif /* REDEF */
@@ -211,14 +211,12 @@ JSValue js_math_min_max(JSContext *ctx, JSValue *this_val,
                         int argc, JSValue *argv, int magic);
 double js_math_sign(double a);
 double js_math_fround(double a);
-JSValue js_math_imul(JSContext *ctx, JSValue *this_val,
-                     int argc, JSValue *argv);
+int js_math_imul(int a, int b);
+int js_math_idiv(int a, int b);
+int js_math_fxmul(int a, int b, int q);
+int js_math_fxdiv(int a, int b, int q);
 JSValue js_math_clz32(JSContext *ctx, JSValue *this_val,
                       int argc, JSValue *argv);
-JSValue js_math_atan2(JSContext *ctx, JSValue *this_val,
-                      int argc, JSValue *argv);
-JSValue js_math_pow(JSContext *ctx, JSValue *this_val,
-                    int argc, JSValue *argv);
 JSValue js_math_random(JSContext *ctx, JSValue *this_val,
                        int argc, JSValue *argv);
 
@@ -236,6 +234,28 @@ JSValue js_typed_array_subarray(JSContext *ctx, JSValue *this_val,
                                 int argc, JSValue *argv);
 JSValue js_typed_array_set(JSContext *ctx, JSValue *this_val,
                            int argc, JSValue *argv);
+JSValue js_typed_array_fill(JSContext *ctx, JSValue *this_val,
+                            int argc, JSValue *argv);
+JSValue js_typed_array_copyWithin(JSContext *ctx, JSValue *this_val,
+                                  int argc, JSValue *argv);
+JSValue js_typed_array_indexOf(JSContext *ctx, JSValue *this_val,
+                               int argc, JSValue *argv, int is_lastIndexOf);
+JSValue js_typed_array_slice(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv);
+JSValue js_typed_array_sum(JSContext *ctx, JSValue *this_val,
+                           int argc, JSValue *argv);
+JSValue js_typed_array_min_max(JSContext *ctx, JSValue *this_val,
+                               int argc, JSValue *argv, int is_max);
+JSValue js_typed_array_dot(JSContext *ctx, JSValue *this_val,
+                           int argc, JSValue *argv);
+JSValue js_dataview_constructor(JSContext *ctx, JSValue *this_val,
+                                int argc, JSValue *argv);
+JSValue js_dataview_get_length(JSContext *ctx, JSValue *this_val,
+                               int argc, JSValue *argv, int magic);
+JSValue js_dataview_getValue(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv, int magic);
+JSValue js_dataview_setValue(JSContext *ctx, JSValue *this_val,
+                             int argc, JSValue *argv, int magic);
 
 JSValue js_date_constructor(JSContext *ctx, JSValue *this_val,
                             int argc, JSValue *argv);
@@ -251,6 +271,12 @@ JSValue js_json_parse(JSContext *ctx, JSValue *this_val,
                       int argc, JSValue *argv);
 JSValue js_json_stringify(JSContext *ctx, JSValue *this_val,
                           int argc, JSValue *argv);
+JSValue js_json_parser_constructor(JSContext *ctx, JSValue *this_val,
+                                   int argc, JSValue *argv);
+JSValue js_json_parser_write_chunk(JSContext *ctx, JSValue *this_val,
+                                   int argc, JSValue *argv);
+JSValue js_json_parser_end_input(JSContext *ctx, JSValue *this_val,
+                                 int argc, JSValue *argv);
 
 JSValue js_regexp_constructor(JSContext *ctx, JSValue *this_val,
                               int argc, JSValue *argv);
@@ -53,7 +53,7 @@ JSValue js_gc(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
 }
 
 // Load and evaluate a JavaScript file from LittleFS
-// Supports both source (.js) and pre-compiled bytecode (.jsc)
+// Supports source (.js), pre-compiled bytecode (.jsc) and compact bytecode
 JSValue js_load(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
     (void)this_val;
 #ifdef EMSCRIPTEN
@@ -89,6 +89,13 @@ JSValue js_load(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
         // Note: buf must remain allocated as long as the bytecode is used
         // In a production system, you'd track this and free it when the context is destroyed
         // For now, this is a memory leak but bytecode is typically loaded once at startup
+    } else if (JS_IsCompactBytecode(buf, buf_len)) {
+        // Compact bytecode (OTA transport format): expanded in the
+        // heap, so the file buffer is not needed after loading
+        ret = JS_LoadCompactBytecode(ctx, buf, buf_len);
+        free(buf);
+        if (!JS_IsException(ret))
+            ret = JS_Run(ctx, ret);
     } else {
         // Source code: parse and evaluate (requires full source in memory)
         ret = JS_Eval(ctx, (const char *)buf, buf_len, filename, 0);
@@ -100,55 +107,13 @@ JSValue js_load(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
 #endif
 }
 
-// Timer support (from mqjs.c)
-typedef struct {
-    bool allocated;
-    JSGCRef func;
-    int64_t timeout; /* in ms */
-} JSTimer;
-
-#define MAX_TIMERS 16
-static JSTimer js_timer_list[MAX_TIMERS];
+// setTimeout(), setInterval() and clearTimeout() are in mqjs_timer.c
+#include "mqjs_timer.h"
 
-JSValue js_setTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
-    (void)this_val;
-    JSTimer *th;
-    int delay, i;
-    JSValue *pfunc;
-
-    if (!JS_IsFunction(ctx, argv[0]))
-        return JS_ThrowTypeError(ctx, "not a function");
-    if (JS_ToInt32(ctx, &delay, argv[1]))
-        return JS_EXCEPTION;
-    for(i = 0; i < MAX_TIMERS; i++) {
-        th = &js_timer_list[i];
-        if (!th->allocated) {
-            pfunc = JS_AddGCRef(ctx, &th->func);
-            *pfunc = argv[0];
-            th->timeout = get_time_ms() + delay;
-            th->allocated = true;
-            return JS_NewInt32(ctx, i);
-        }
-    }
-    return JS_ThrowInternalError(ctx, "too many timers");
-}
-
-JSValue js_clearTimeout(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
-    (void)this_val;
-    int timer_id;
-    JSTimer *th;
-
-    if (JS_ToInt32(ctx, &timer_id, argv[0]))
-        return JS_EXCEPTION;
-    if (timer_id >= 0 && timer_id < MAX_TIMERS) {
-        th = &js_timer_list[timer_id];
-        if (th->allocated) {
-            JS_DeleteGCRef(ctx, &th->func);
-            th->allocated = false;
-        }
-    }
-    return JS_UNDEFINED;
-}
+// performance.memory(), resetMemory(), heapProfile() and heapReport() are
+// in mqjs_perf.c. Install js_perf_clock_us() with JS_SetClockFunc() after
+// JS_NewContext() to get the GC pause statistics.
+#include "mqjs_perf.h"
 
 JSValue js_date_now(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv) {
     (void)this_val;
@@ -232,18 +197,30 @@ JSValue js_loadMapped(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv
             "data at partition '%s' offset %d is not valid bytecode", partition, offset);
     }
 
-    // Relocate bytecode in-place (it's in flash, read-only)
-    // Note: This modifies a temporary buffer, not the flash
-    uint8_t* relocatable_copy = (uint8_t*)malloc(mapped->size);
+    // Bytecode relocated to its mapped address when it was written
+    // (see JS_RelocateBytecodeTo()) is executed in place from flash
+    if (JS_IsBytecodeRelocated(mapped->data, mapped->size)) {
+        JSValue ret = JS_LoadBytecode(ctx, mapped->data);
+        // Note: the mapping must stay valid for the lifetime of the loaded code
+        if (JS_IsException(ret))
+            file_hw_munmap(mapped);
+        return ret;
+    }
+
+    // Otherwise relocate a RAM copy (flash is read-only)
+    ESP_LOGW("js_stdlib", "bytecode at '%s' offset %d is not relocated for 0x%lx, copying %zu bytes to RAM",
+             partition, offset, (uint32_t)mapped->data, mapped->size);
+    size_t copy_size = mapped->size;
+    uint8_t* relocatable_copy = (uint8_t*)malloc(copy_size);
     if (!relocatable_copy) {
         file_hw_munmap(mapped);
         return JS_ThrowOutOfMemory(ctx);
     }
 
-    memcpy(relocatable_copy, mapped->data, mapped->size);
+    memcpy(relocatable_copy, mapped->data, copy_size);
     file_hw_munmap(mapped);  // Unmap original
 
-    if (JS_RelocateBytecode(ctx, relocatable_copy, mapped->size) != 0) {
+    if (JS_RelocateBytecode(ctx, relocatable_copy, copy_size) != 0) {
         free(relocatable_copy);
         return JS_ThrowError(ctx, JS_CLASS_ERROR, "failed to relocate bytecode");
     }
@@ -319,12 +296,12 @@ JSValue js_loadUserBytecode(JSContext *ctx, JSValue *this_val, int argc, JSValue
     const JSBytecodeHeader* hdr = (const JSBytecodeHeader*)mapped->data;
 
     uint32_t current_virtual_addr = (uint32_t)mapped->data;
-    uint32_t expected_base_addr = current_virtual_addr + sizeof(JSBytecodeHeader);
 
-    if (hdr->base_addr != expected_base_addr) {
+    if (!JS_IsBytecodeRelocated(mapped->data, mapped->size)) {
         ESP_LOGE("js_stdlib", "Bytecode relocation mismatch for '%s'", name);
         ESP_LOGE("js_stdlib", "Expected base_addr: 0x%lx, got: 0x%lx",
-                 expected_base_addr, (uint32_t)hdr->base_addr);
+                 (uint32_t)(current_virtual_addr + sizeof(JSBytecodeHeader) + JS_GetRomTableSize(hdr)),
+                 (uint32_t)hdr->base_addr);
         ESP_LOGE("js_stdlib", "Current virtual addr: 0x%lx", current_virtual_addr);
         ESP_LOGE("js_stdlib", "This can happen after firmware update. Please re-upload bytecode.");
 
@@ -349,50 +326,45 @@ JSValue js_loadUserBytecode(JSContext *ctx, JSValue *this_val, int argc, JSValue
 #endif
 }
 
-// Process timers - call this periodically from your main loop
-// Returns the number of milliseconds until the next timer needs to run
-int64_t JS_ProcessTimers(JSContext *ctx) {
-    int64_t min_delay = 1000;
-    int64_t cur_time = get_time_ms();
-    bool has_timer = false;
-
-    for(int i = 0; i < MAX_TIMERS; i++) {
-        JSTimer *th = &js_timer_list[i];
-        if (th->allocated) {
-            has_timer = true;
-            int64_t delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                // Timer expired - execute it (following mqjs.c pattern)
-                JSValue ret;
-                JS_PushArg(ctx, th->func.val); /* func */
-                JS_PushArg(ctx, JS_NULL); /* this */
-
-                // Clean up timer before calling (in case timer re-schedules itself)
-                JS_DeleteGCRef(ctx, &th->func);
-                th->allocated = false;
-
-                ret = JS_Call(ctx, 0);
-                if (JS_IsException(ret)) {
-                    // Log exception but don't exit (unlike mqjs.c which exits)
-                    JSValue exception = JS_GetException(ctx);
-                    (void)exception; // Could log this
-                }
-                min_delay = 0;
-                break;
-            } else if (delay < min_delay) {
-                min_delay = delay;
-            }
-        }
-    }
-
-    return has_timer ? min_delay : -1;
-}
+// JS_ProcessTimers() is provided by mqjs_timer.c
 
 // Forward declarations for LED functions (defined in freebutton_led.c)
 JSValue js_freebutton_led_count(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_led_on(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_led_off(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
 JSValue js_freebutton_led_setColor(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
-
-// Include the generated FreeButton stdlib (with LED bindings)
+JSValue js_freebutton_led_show(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+
+// Forward declarations for button functions (defined in freebutton_button.c)
+JSValue js_freebutton_button_count(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_button_setLabel(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_button_setTopLabel(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_button_onClick(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_button_onLongPress(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_button_onRelease(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+
+// Forward declarations for sensor functions (defined in freebutton_sensor.c)
+JSValue js_freebutton_sensor_count(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_getValue(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_getType(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_getInfo(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_getAll(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_onChange(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_readInto(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_startSampling(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_drain(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_sensor_stopSampling(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+
+// Forward declarations for MQTT functions (defined in freebutton_mqtt.c)
+JSValue js_freebutton_mqtt_getBrokerCount(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_getBrokerName(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_isConnected(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_publish(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_publishJSON(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_subscribe(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_unsubscribe(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_onConnect(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+JSValue js_freebutton_mqtt_onDisconnect(JSContext *ctx, JSValue *this_val, int argc, JSValue *argv);
+
+// Include the generated FreeButton stdlib (with LED, button, sensor and MQTT bindings)
 #include "freebutton_stdlib.h"
@@ -0,0 +1,2810 @@
+/* this file is automatically generated - do not edit */
+
+#include "mquickjs_priv.h"
+
+static const uint64_t __attribute((aligned(64))) js_stdlib_table[] = {
+  /* atom_table */
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "null" (offset=0) */
+  0x000000006c6c756e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "false" (offset=2) */
+  0x00000065736c6166,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "true" (offset=4) */
+  0x0000000065757274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "if" (offset=6) */
+  0x0000000000006669,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "else" (offset=8) */
+  0x0000000065736c65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "return" (offset=10) */
+  0x00006e7275746572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "var" (offset=12) */
+  0x0000000000726176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "this" (offset=14) */
+  0x0000000073696874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "delete" (offset=16) */
+  0x00006574656c6564,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "void" (offset=18) */
+  0x0000000064696f76,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "typeof" (offset=20) */
+  0x0000666f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "new" (offset=22) */
+  0x000000000077656e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "in" (offset=24) */
+  0x0000000000006e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "instanceof" (offset=26) */
+  0x65636e6174736e69,
+  0x000000000000666f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "do" (offset=29) */
+  0x0000000000006f64,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "while" (offset=31) */
+  0x000000656c696877,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "for" (offset=33) */
+  0x0000000000726f66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "break" (offset=35) */
+  0x0000006b61657262,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "continue" (offset=37) */
+  0x65756e69746e6f63,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "switch" (offset=40) */
+  0x0000686374697773,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "case" (offset=42) */
+  0x0000000065736163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "default" (offset=44) */
+  0x00746c7561666564,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "throw" (offset=46) */
+  0x000000776f726874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "try" (offset=48) */
+  0x0000000000797274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "catch" (offset=50) */
+  0x0000006863746163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "finally" (offset=52) */
+  0x00796c6c616e6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "function" (offset=54) */
+  0x6e6f6974636e7566,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "debugger" (offset=57) */
+  0x7265676775626564,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "with" (offset=60) */
+  0x0000000068746977,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "class" (offset=62) */
+  0x0000007373616c63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "const" (offset=64) */
+  0x00000074736e6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "enum" (offset=66) */
+  0x000000006d756e65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "export" (offset=68) */
+  0x000074726f707865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "extends" (offset=70) */
+  0x0073646e65747865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "import" (offset=72) */
+  0x000074726f706d69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "super" (offset=74) */
+  0x0000007265707573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "implements" (offset=76) */
+  0x6e656d656c706d69,
+  0x0000000000007374,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "interface" (offset=79) */
+  0x6361667265746e69,
+  0x0000000000000065,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "let" (offset=82) */
+  0x000000000074656c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "package" (offset=84) */
+  0x006567616b636170,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "private" (offset=86) */
+  0x0065746176697270,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "protected" (offset=88) */
+  0x65746365746f7270,
+  0x0000000000000064,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "public" (offset=91) */
+  0x000063696c627570,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "static" (offset=93) */
+  0x0000636974617473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "yield" (offset=95) */
+  0x000000646c656979,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (0 << (JS_MTAG_BITS + 3)), /* "" (offset=97) */
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "toString" (offset=99) */
+  0x676e697274536f74,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "valueOf" (offset=102) */
+  0x00664f65756c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "number" (offset=104) */
+  0x00007265626d756e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "object" (offset=106) */
+  0x00007463656a626f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "undefined" (offset=108) */
+  0x656e696665646e75,
+  0x0000000000000064,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "string" (offset=111) */
+  0x0000676e69727473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "boolean" (offset=113) */
+  0x006e61656c6f6f62,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "<ret>" (offset=115) */
+  0x0000003e7465723c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "<eval>" (offset=117) */
+  0x00003e6c6176653c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "eval" (offset=119) */
+  0x000000006c617665,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "arguments" (offset=121) */
+  0x746e656d75677261,
+  0x0000000000000073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "value" (offset=124) */
+  0x00000065756c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "get" (offset=126) */
+  0x0000000000746567,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "set" (offset=128) */
+  0x0000000000746573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "prototype" (offset=130) */
+  0x7079746f746f7270,
+  0x0000000000000065,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "constructor" (offset=133) */
+  0x63757274736e6f63,
+  0x0000000000726f74,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "length" (offset=136) */
+  0x00006874676e656c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "target" (offset=138) */
+  0x0000746567726174,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "of" (offset=140) */
+  0x000000000000666f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "NaN" (offset=142) */
+  0x00000000004e614e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "Infinity" (offset=144) */
+  0x7974696e69666e49,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (1 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "-Infinity" (offset=147) */
+  0x74696e69666e492d,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "name" (offset=150) */
+  0x00000000656d616e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "Error" (offset=152) */
+  0x000000726f727245,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "__proto__" (offset=154) */
+  0x5f6f746f72705f5f,
+  0x000000000000005f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "index" (offset=157) */
+  0x0000007865646e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "input" (offset=159) */
+  0x0000007475706e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "bound" (offset=161) */
+  0x000000646e756f62,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "Object" (offset=163) */
+  0x00007463656a624f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "defineProperty" (offset=165) */
+  0x7250656e69666564,
+  0x000079747265706f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "getPrototypeOf" (offset=168) */
+  0x6f746f7250746567,
+  0x0000664f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "setPrototypeOf" (offset=171) */
+  0x6f746f7250746573,
+  0x0000664f65707974,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "create" (offset=174) */
+  0x0000657461657263,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "keys" (offset=176) */
+  0x000000007379656b,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "hasOwnProperty" (offset=178) */
+  0x72506e774f736168,
+  0x000079747265706f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "Function" (offset=181) */
+  0x6e6f6974636e7546,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "get prototype" (offset=184) */
+  0x746f727020746567,
+  0x000000657079746f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "set prototype" (offset=187) */
+  0x746f727020746573,
+  0x000000657079746f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "call" (offset=190) */
+  0x000000006c6c6163,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "apply" (offset=192) */
+  0x000000796c707061,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "bind" (offset=194) */
+  0x00000000646e6962,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get length" (offset=196) */
+  0x676e656c20746567,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "get name" (offset=199) */
+  0x656d616e20746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "Number" (offset=202) */
+  0x00007265626d754e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "parseInt" (offset=204) */
+  0x746e496573726170,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "parseFloat" (offset=207) */
+  0x6f6c466573726170,
+  0x0000000000007461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "toExponential" (offset=210) */
+  0x656e6f7078456f74,
+  0x0000006c6169746e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "toFixed" (offset=213) */
+  0x0064657869466f74,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toPrecision" (offset=215) */
+  0x7369636572506f74,
+  0x00000000006e6f69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "Boolean" (offset=218) */
+  0x006e61656c6f6f42,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "String" (offset=220) */
+  0x0000676e69727453,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "fromCharCode" (offset=222) */
+  0x726168436d6f7266,
+  0x0000000065646f43,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "fromCodePoint" (offset=225) */
+  0x65646f436d6f7266,
+  0x000000746e696f50,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "set length" (offset=228) */
+  0x676e656c20746573,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "charAt" (offset=231) */
+  0x0000744172616863,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "charCodeAt" (offset=233) */
+  0x65646f4372616863,
+  0x0000000000007441,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "codePointAt" (offset=236) */
+  0x6e696f5065646f63,
+  0x0000000000744174,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "slice" (offset=239) */
+  0x0000006563696c73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "substring" (offset=241) */
+  0x6e69727473627573,
+  0x0000000000000067,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "concat" (offset=244) */
+  0x00007461636e6f63,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "indexOf" (offset=246) */
+  0x00664f7865646e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "lastIndexOf" (offset=248) */
+  0x65646e497473616c,
+  0x0000000000664f78,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "match" (offset=251) */
+  0x000000686374616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "replace" (offset=253) */
+  0x006563616c706572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "replaceAll" (offset=255) */
+  0x416563616c706572,
+  0x0000000000006c6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "search" (offset=258) */
+  0x0000686372616573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "split" (offset=260) */
+  0x00000074696c7073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toLowerCase" (offset=262) */
+  0x437265776f4c6f74,
+  0x0000000000657361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "toUpperCase" (offset=265) */
+  0x4372657070556f74,
+  0x0000000000657361,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "trim" (offset=268) */
+  0x000000006d697274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "trimEnd" (offset=270) */
+  0x00646e456d697274,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "trimStart" (offset=272) */
+  0x726174536d697274,
+  0x0000000000000074,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "repeat" (offset=275) */
+  0x0000746165706572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "Array" (offset=277) */
+  0x0000007961727241,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "isArray" (offset=279) */
+  0x0079617272417369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "push" (offset=281) */
+  0x0000000068737570,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pop" (offset=283) */
+  0x0000000000706f70,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "join" (offset=285) */
+  0x000000006e696f6a,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "reverse" (offset=287) */
+  0x0065737265766572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "shift" (offset=289) */
+  0x0000007466696873,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "splice" (offset=291) */
+  0x00006563696c7073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "unshift" (offset=293) */
+  0x0074666968736e75,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "every" (offset=295) */
+  0x0000007972657665,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "some" (offset=297) */
+  0x00000000656d6f73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "forEach" (offset=299) */
+  0x0068636145726f66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "map" (offset=301) */
+  0x000000000070616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "filter" (offset=303) */
+  0x00007265746c6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "reduce" (offset=305) */
+  0x0000656375646572,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "reduceRight" (offset=307) */
+  0x6952656375646572,
+  0x0000000000746867,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sort" (offset=310) */
+  0x0000000074726f73,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Math" (offset=312) */
+  0x000000006874614d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "min" (offset=314) */
+  0x00000000006e696d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "max" (offset=316) */
+  0x000000000078616d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "floor" (offset=318) */
+  0x000000726f6f6c66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "ceil" (offset=320) */
+  0x000000006c696563,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "round" (offset=322) */
+  0x000000646e756f72,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "sqrt" (offset=324) */
+  0x0000000074727173,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "PI" (offset=326) */
+  0x0000000000004950,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "atan2" (offset=328) */
+  0x000000326e617461,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "log" (offset=330) */
+  0x0000000000676f6c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "pow" (offset=332) */
+  0x0000000000776f70,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "imul" (offset=334) */
+  0x000000006c756d69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "fround" (offset=336) */
+  0x0000646e756f7266,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "idiv" (offset=338) */
+  0x0000000076696469,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "fxmul" (offset=340) */
+  0x0000006c756d7866,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "fxdiv" (offset=342) */
+  0x0000007669647866,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "Date" (offset=344) */
+  0x0000000065746144,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "now" (offset=346) */
+  0x0000000000776f6e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "JSON" (offset=348) */
+  0x000000004e4f534a,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "parse" (offset=350) */
+  0x0000006573726170,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "stringify" (offset=352) */
+  0x6669676e69727473,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "JSONParser" (offset=355) */
+  0x737261504e4f534a,
+  0x0000000000007265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "write" (offset=358) */
+  0x0000006574697277,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "end" (offset=360) */
+  0x0000000000646e65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "RegExp" (offset=362) */
+  0x0000707845676552,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "lastIndex" (offset=364) */
+  0x65646e497473616c,
+  0x0000000000000078,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "get lastIndex" (offset=367) */
+  0x7473616c20746567,
+  0x0000007865646e49,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "set lastIndex" (offset=370) */
+  0x7473616c20746573,
+  0x0000007865646e49,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "flags" (offset=373) */
+  0x0000007367616c66,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get flags" (offset=375) */
+  0x67616c6620746567,
+  0x0000000000000073,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "exec" (offset=378) */
+  0x0000000063657865,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "test" (offset=380) */
+  0x0000000074736574,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "message" (offset=382) */
+  0x006567617373656d,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "get message" (offset=384) */
+  0x7373656d20746567,
+  0x0000000000656761,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "stack" (offset=387) */
+  0x0000006b63617473,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "get stack" (offset=389) */
+  0x6361747320746567,
+  0x000000000000006b,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "EvalError" (offset=392) */
+  0x6f7272456c617645,
+  0x0000000000000072,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "RangeError" (offset=395) */
+  0x72724565676e6152,
+  0x000000000000726f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "ReferenceError" (offset=398) */
+  0x636e657265666552,
+  0x0000726f72724565,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "SyntaxError" (offset=401) */
+  0x72457861746e7953,
+  0x0000000000726f72,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "TypeError" (offset=404) */
+  0x6f72724565707954,
+  0x0000000000000072,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "URIError" (offset=407) */
+  0x726f727245495255,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "InternalError" (offset=410) */
+  0x6c616e7265746e49,
+  0x000000726f727245,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "ArrayBuffer" (offset=413) */
+  0x6675427961727241,
+  0x0000000000726566,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteLength" (offset=416) */
+  0x676e654c65747962,
+  0x0000000000006874,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteLength" (offset=419) */
+  0x6574796220746567,
+  0x00006874676e654c,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "Uint8ClampedArray" (offset=422) */
+  0x616c4338746e6955,
+  0x617272416465706d,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "TypedArray" (offset=426) */
+  0x7272416465707954,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "byteOffset" (offset=429) */
+  0x7366664f65747962,
+  0x0000000000007465,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (14 << (JS_MTAG_BITS + 3)), /* "get byteOffset" (offset=432) */
+  0x6574796220746567,
+  0x000074657366664f,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (6 << (JS_MTAG_BITS + 3)), /* "buffer" (offset=435) */
+  0x0000726566667562,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "get buffer" (offset=437) */
+  0x6666756220746567,
+  0x0000000000007265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "subarray" (offset=440) */
+  0x7961727261627573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (4 << (JS_MTAG_BITS + 3)), /* "fill" (offset=443) */
+  0x000000006c6c6966,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "copyWithin" (offset=445) */
+  0x6874695779706f63,
+  0x0000000000006e69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "sum" (offset=448) */
+  0x00000000006d7573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (3 << (JS_MTAG_BITS + 3)), /* "dot" (offset=450) */
+  0x0000000000746f64,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (17 << (JS_MTAG_BITS + 3)), /* "BYTES_PER_ELEMENT" (offset=452) */
+  0x45505f5345545942,
+  0x4e454d454c455f52,
+  0x0000000000000054,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "Int8Array" (offset=456) */
+  0x6172724138746e49,
+  0x0000000000000079,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Uint8Array" (offset=459) */
+  0x72724138746e6955,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int16Array" (offset=462) */
+  0x7272413631746e49,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint16Array" (offset=465) */
+  0x72413631746e6955,
+  0x0000000000796172,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "Int32Array" (offset=468) */
+  0x7272413233746e49,
+  0x0000000000007961,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "Uint32Array" (offset=471) */
+  0x72413233746e6955,
+  0x0000000000796172,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float32Array" (offset=474) */
+  0x41323374616f6c46,
+  0x0000000079617272,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "Float64Array" (offset=477) */
+  0x41343674616f6c46,
+  0x0000000079617272,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "DataView" (offset=480) */
+  0x7765695661746144,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "getInt8" (offset=483) */
+  0x0038746e49746567,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (7 << (JS_MTAG_BITS + 3)), /* "setInt8" (offset=485) */
+  0x0038746e49746573,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getUint8" (offset=487) */
+  0x38746e6955746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setUint8" (offset=490) */
+  0x38746e6955746573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getInt16" (offset=493) */
+  0x3631746e49746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "setInt16" (offset=496) */
+  0x3631746e49746573,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "getUint16" (offset=499) */
+  0x31746e6955746567,
+  0x0000000000000036,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "setUint16" (offset=502) */
+  0x31746e6955746573,
+  0x0000000000000036,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (8 << (JS_MTAG_BITS + 3)), /* "getInt32" (offset=505) */
+  0x3233746e49746567,
+  0x0000000000000000,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "getUint32" (offset=508) */
+  0x33746e6955746567,
+  0x0000000000000032,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (9 << (JS_MTAG_BITS + 3)), /* "setUint32" (offset=511) */
+  0x33746e6955746573,
+  0x0000000000000032,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getFloat32" (offset=514) */
+  0x74616f6c46746567,
+  0x0000000000003233,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setFloat32" (offset=517) */
+  0x74616f6c46746573,
+  0x0000000000003233,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "getFloat64" (offset=520) */
+  0x74616f6c46746567,
+  0x0000000000003436,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setFloat64" (offset=523) */
+  0x74616f6c46746573,
+  0x0000000000003436,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (5 << (JS_MTAG_BITS + 3)), /* "isNaN" (offset=526) */
+  0x0000004e614e7369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "globalThis" (offset=528) */
+  0x68546c61626f6c67,
+  0x0000000000007369,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "performance" (offset=531) */
+  0x616d726f66726570,
+  0x000000000065636e,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "heapProfile" (offset=534) */
+  0x666f725070616568,
+  0x0000000000656c69,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "heapReport" (offset=537) */
+  0x6f70655270616568,
+  0x0000000000007472,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (2 << (JS_MTAG_BITS + 3)), /* "gc" (offset=540) */
+  0x0000000000006367,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (10 << (JS_MTAG_BITS + 3)), /* "setTimeout" (offset=542) */
+  0x6f656d6954746573,
+  0x0000000000007475,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (12 << (JS_MTAG_BITS + 3)), /* "clearTimeout" (offset=545) */
+  0x6d69547261656c63,
+  0x0000000074756f65,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "setInterval" (offset=548) */
+  0x7265746e49746573,
+  0x00000000006c6176,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (13 << (JS_MTAG_BITS + 3)), /* "clearInterval" (offset=551) */
+  0x746e497261656c63,
+  0x0000006c61767265,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "startWorker" (offset=554) */
+  0x726f577472617473,
+  0x000000000072656b,
+  (JS_MTAG_STRING << 1) | (1 << JS_MTAG_BITS) | (1 << (JS_MTAG_BITS + 1)) | (0 << (JS_MTAG_BITS + 2)) | (11 << (JS_MTAG_BITS + 3)), /* "postMessage" (offset=557) */
+  0x7373654d74736f70,
+  0x0000000000656761,
+
+  /* sorted atom table (offset=560) */
+  JS_VALUE_ARRAY_HEADER(230),
+  JS_ROM_VALUE(97), /* empty */
+  JS_ROM_VALUE(147), /* _Infinity */
+  JS_ROM_VALUE(117), /* _eval_ */
+  JS_ROM_VALUE(115), /* _ret_ */
+  JS_ROM_VALUE(277), /* Array */
+  JS_ROM_VALUE(413), /* ArrayBuffer */
+  JS_ROM_VALUE(452), /* BYTES_PER_ELEMENT */
+  JS_ROM_VALUE(218), /* Boolean */
+  JS_ROM_VALUE(480), /* DataView */
+  JS_ROM_VALUE(344), /* Date */
+  JS_ROM_VALUE(152), /* Error */
+  JS_ROM_VALUE(392), /* EvalError */
+  JS_ROM_VALUE(474), /* Float32Array */
+  JS_ROM_VALUE(477), /* Float64Array */
+  JS_ROM_VALUE(181), /* Function */
+  JS_ROM_VALUE(144), /* Infinity */
+  JS_ROM_VALUE(462), /* Int16Array */
+  JS_ROM_VALUE(468), /* Int32Array */
+  JS_ROM_VALUE(456), /* Int8Array */
+  JS_ROM_VALUE(410), /* InternalError */
+  JS_ROM_VALUE(348), /* JSON */
+  JS_ROM_VALUE(355), /* JSONParser */
+  JS_ROM_VALUE(312), /* Math */
+  JS_ROM_VALUE(142), /* NaN */
+  JS_ROM_VALUE(202), /* Number */
+  JS_ROM_VALUE(163), /* Object */
+  JS_ROM_VALUE(326), /* PI */
+  JS_ROM_VALUE(395), /* RangeError */
+  JS_ROM_VALUE(398), /* ReferenceError */
+  JS_ROM_VALUE(362), /* RegExp */
+  JS_ROM_VALUE(220), /* String */
+  JS_ROM_VALUE(401), /* SyntaxError */
+  JS_ROM_VALUE(404), /* TypeError */
+  JS_ROM_VALUE(426), /* TypedArray */
+  JS_ROM_VALUE(407), /* URIError */
+  JS_ROM_VALUE(465), /* Uint16Array */
+  JS_ROM_VALUE(471), /* Uint32Array */
+  JS_ROM_VALUE(459), /* Uint8Array */
+  JS_ROM_VALUE(422), /* Uint8ClampedArray */
+  JS_ROM_VALUE(154), /* __proto__ */
+  JS_ROM_VALUE(192), /* apply */
+  JS_ROM_VALUE(121), /* arguments */
+  JS_ROM_VALUE(328), /* atan2 */
+  JS_ROM_VALUE(194), /* bind */
+  JS_ROM_VALUE(113), /* boolean */
+  JS_ROM_VALUE(161), /* bound */
+  JS_ROM_VALUE(35), /* break */
+  JS_ROM_VALUE(435), /* buffer */
+  JS_ROM_VALUE(416), /* byteLength */
+  JS_ROM_VALUE(429), /* byteOffset */
+  JS_ROM_VALUE(190), /* call */
+  JS_ROM_VALUE(42), /* case */
+  JS_ROM_VALUE(50), /* catch */
+  JS_ROM_VALUE(320), /* ceil */
+  JS_ROM_VALUE(231), /* charAt */
+  JS_ROM_VALUE(233), /* charCodeAt */
+  JS_ROM_VALUE(62), /* class */
+  JS_ROM_VALUE(551), /* clearInterval */
+  JS_ROM_VALUE(545), /* clearTimeout */
+  JS_ROM_VALUE(236), /* codePointAt */
+  JS_ROM_VALUE(244), /* concat */
+  JS_ROM_VALUE(64), /* const */
+  JS_ROM_VALUE(133), /* constructor */
+  JS_ROM_VALUE(37), /* continue */
+  JS_ROM_VALUE(445), /* copyWithin */
+  JS_ROM_VALUE(174), /* create */
+  JS_ROM_VALUE(57), /* debugger */
+  JS_ROM_VALUE(44), /* default */
+  JS_ROM_VALUE(165), /* defineProperty */
+  JS_ROM_VALUE(16), /* delete */
+  JS_ROM_VALUE(29), /* do */
+  JS_ROM_VALUE(450), /* dot */
+  JS_ROM_VALUE(8), /* else */
+  JS_ROM_VALUE(360), /* end */
+  JS_ROM_VALUE(66), /* enum */
+  JS_ROM_VALUE(119), /* eval */
+  JS_ROM_VALUE(295), /* every */
+  JS_ROM_VALUE(378), /* exec */
+  JS_ROM_VALUE(68), /* export */
+  JS_ROM_VALUE(70), /* extends */
+  JS_ROM_VALUE(2), /* false */
+  JS_ROM_VALUE(443), /* fill */
+  JS_ROM_VALUE(303), /* filter */
+  JS_ROM_VALUE(52), /* finally */
+  JS_ROM_VALUE(373), /* flags */
+  JS_ROM_VALUE(318), /* floor */
+  JS_ROM_VALUE(33), /* for */
+  JS_ROM_VALUE(299), /* forEach */
+  JS_ROM_VALUE(222), /* fromCharCode */
+  JS_ROM_VALUE(225), /* fromCodePoint */
+  JS_ROM_VALUE(336), /* fround */
+  JS_ROM_VALUE(54), /* function */
+  JS_ROM_VALUE(342), /* fxdiv */
+  JS_ROM_VALUE(340), /* fxmul */
+  JS_ROM_VALUE(540), /* gc */
+  JS_ROM_VALUE(126), /* get */
+  JS_ROM_VALUE(437), /* get buffer */
+  JS_ROM_VALUE(419), /* get byteLength */
+  JS_ROM_VALUE(432), /* get byteOffset */
+  JS_ROM_VALUE(375), /* get flags */
+  JS_ROM_VALUE(367), /* get lastIndex */
+  JS_ROM_VALUE(196), /* get length */
+  JS_ROM_VALUE(384), /* get message */
+  JS_ROM_VALUE(199), /* get name */
+  JS_ROM_VALUE(184), /* get prototype */
+  JS_ROM_VALUE(389), /* get stack */
+  JS_ROM_VALUE(514), /* getFloat32 */
+  JS_ROM_VALUE(520), /* getFloat64 */
+  JS_ROM_VALUE(493), /* getInt16 */
+  JS_ROM_VALUE(505), /* getInt32 */
+  JS_ROM_VALUE(483), /* getInt8 */
+  JS_ROM_VALUE(168), /* getPrototypeOf */
+  JS_ROM_VALUE(499), /* getUint16 */
+  JS_ROM_VALUE(508), /* getUint32 */
+  JS_ROM_VALUE(487), /* getUint8 */
+  JS_ROM_VALUE(528), /* globalThis */
+  JS_ROM_VALUE(178), /* hasOwnProperty */
+  JS_ROM_VALUE(534), /* heapProfile */
+  JS_ROM_VALUE(537), /* heapReport */
+  JS_ROM_VALUE(338), /* idiv */
+  JS_ROM_VALUE(6), /* if */
+  JS_ROM_VALUE(76), /* implements */
+  JS_ROM_VALUE(72), /* import */
+  JS_ROM_VALUE(334), /* imul */
+  JS_ROM_VALUE(24), /* in */
+  JS_ROM_VALUE(157), /* index */
+  JS_ROM_VALUE(246), /* indexOf */
+  JS_ROM_VALUE(159), /* input */
+  JS_ROM_VALUE(26), /* instanceof */
+  JS_ROM_VALUE(79), /* interface */
+  JS_ROM_VALUE(279), /* isArray */
+  JS_ROM_VALUE(526), /* isNaN */
+  JS_ROM_VALUE(285), /* join */
+  JS_ROM_VALUE(176), /* keys */
+  JS_ROM_VALUE(364), /* lastIndex */
+  JS_ROM_VALUE(248), /* lastIndexOf */
+  JS_ROM_VALUE(136), /* length */
+  JS_ROM_VALUE(82), /* let */
+  JS_ROM_VALUE(330), /* log */
+  JS_ROM_VALUE(301), /* map */
+  JS_ROM_VALUE(251), /* match */
+  JS_ROM_VALUE(316), /* max */
+  JS_ROM_VALUE(382), /* message */
+  JS_ROM_VALUE(314), /* min */
+  JS_ROM_VALUE(150), /* name */
+  JS_ROM_VALUE(22), /* new */
+  JS_ROM_VALUE(346), /* now */
+  JS_ROM_VALUE(0), /* null */
+  JS_ROM_VALUE(104), /* number */
+  JS_ROM_VALUE(106), /* object */
+  JS_ROM_VALUE(140), /* of */
+  JS_ROM_VALUE(84), /* package */
+  JS_ROM_VALUE(350), /* parse */
+  JS_ROM_VALUE(207), /* parseFloat */
+  JS_ROM_VALUE(204), /* parseInt */
+  JS_ROM_VALUE(531), /* performance */
+  JS_ROM_VALUE(283), /* pop */
+  JS_ROM_VALUE(557), /* postMessage */
+  JS_ROM_VALUE(332), /* pow */
+  JS_ROM_VALUE(86), /* private */
+  JS_ROM_VALUE(88), /* protected */
+  JS_ROM_VALUE(130), /* prototype */
+  JS_ROM_VALUE(91), /* public */
+  JS_ROM_VALUE(281), /* push */
+  JS_ROM_VALUE(305), /* reduce */
+  JS_ROM_VALUE(307), /* reduceRight */
+  JS_ROM_VALUE(275), /* repeat */
+  JS_ROM_VALUE(253), /* replace */
+  JS_ROM_VALUE(255), /* replaceAll */
+  JS_ROM_VALUE(10), /* return */
+  JS_ROM_VALUE(287), /* reverse */
+  JS_ROM_VALUE(322), /* round */
+  JS_ROM_VALUE(258), /* search */
+  JS_ROM_VALUE(128), /* set */
+  JS_ROM_VALUE(370), /* set lastIndex */
+  JS_ROM_VALUE(228), /* set length */
+  JS_ROM_VALUE(187), /* set prototype */
+  JS_ROM_VALUE(517), /* setFloat32 */
+  JS_ROM_VALUE(523), /* setFloat64 */
+  JS_ROM_VALUE(496), /* setInt16 */
+  JS_ROM_VALUE(485), /* setInt8 */
+  JS_ROM_VALUE(548), /* setInterval */
+  JS_ROM_VALUE(171), /* setPrototypeOf */
+  JS_ROM_VALUE(542), /* setTimeout */
+  JS_ROM_VALUE(502), /* setUint16 */
+  JS_ROM_VALUE(511), /* setUint32 */
+  JS_ROM_VALUE(490), /* setUint8 */
+  JS_ROM_VALUE(289), /* shift */
+  JS_ROM_VALUE(239), /* slice */
+  JS_ROM_VALUE(297), /* some */
+  JS_ROM_VALUE(310), /* sort */
+  JS_ROM_VALUE(291), /* splice */
+  JS_ROM_VALUE(260), /* split */
+  JS_ROM_VALUE(324), /* sqrt */
+  JS_ROM_VALUE(387), /* stack */
+  JS_ROM_VALUE(554), /* startWorker */
+  JS_ROM_VALUE(93), /* static */
+  JS_ROM_VALUE(111), /* string */
+  JS_ROM_VALUE(352), /* stringify */
+  JS_ROM_VALUE(440), /* subarray */
+  JS_ROM_VALUE(241), /* substring */
+  JS_ROM_VALUE(448), /* sum */
+  JS_ROM_VALUE(74), /* super */
+  JS_ROM_VALUE(40), /* switch */
+  JS_ROM_VALUE(138), /* target */
+  JS_ROM_VALUE(380), /* test */
+  JS_ROM_VALUE(14), /* this */
+  JS_ROM_VALUE(46), /* throw */
+  JS_ROM_VALUE(210), /* toExponential */
+  JS_ROM_VALUE(213), /* toFixed */
+  JS_ROM_VALUE(262), /* toLowerCase */
+  JS_ROM_VALUE(215), /* toPrecision */
+  JS_ROM_VALUE(99), /* toString */
+  JS_ROM_VALUE(265), /* toUpperCase */
+  JS_ROM_VALUE(268), /* trim */
+  JS_ROM_VALUE(270), /* trimEnd */
+  JS_ROM_VALUE(272), /* trimStart */
+  JS_ROM_VALUE(4), /* true */
+  JS_ROM_VALUE(48), /* try */
+  JS_ROM_VALUE(20), /* typeof */
+  JS_ROM_VALUE(108), /* undefined */
+  JS_ROM_VALUE(293), /* unshift */
+  JS_ROM_VALUE(124), /* value */
+  JS_ROM_VALUE(102), /* valueOf */
+  JS_ROM_VALUE(12), /* var */
+  JS_ROM_VALUE(18), /* void */
+  JS_ROM_VALUE(31), /* while */
+  JS_ROM_VALUE(60), /* with */
+  JS_ROM_VALUE(358), /* write */
+  JS_ROM_VALUE(95), /* yield */
+
+  /* properties (offset=791) */
+  JS_VALUE_ARRAY_HEADER(24),
+  6 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  6 << 1,
+  18 << 1,
+  12 << 1,
+  21 << 1,
+  JS_ROM_VALUE(165) /* defineProperty */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 2),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(168) /* getPrototypeOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 3),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(171) /* setPrototypeOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 4),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(174) /* create */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 5),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(176) /* keys */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 6),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_OBJECT << 1,
+  (15 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=816) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  4 << 1,
+  JS_ROM_VALUE(178) /* hasOwnProperty */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 7),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 8),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_OBJECT - 1) << 1,
+  (7 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=830) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(791),
+  1,
+  JS_ROM_VALUE(816),
+  JS_NULL,
+
+  /* properties (offset=835) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_CLOSURE << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=842) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 10),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 11),
+
+  /* getset (offset=845) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 12),
+  JS_UNDEFINED,
+
+  /* getset (offset=848) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 13),
+  JS_UNDEFINED,
+
+  /* properties (offset=851) */
+  JS_VALUE_ARRAY_HEADER(30),
+  8 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  27 << 1,
+  21 << 1,
+  18 << 1,
+  24 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_ROM_VALUE(842),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(190) /* call */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 14),
+  (6 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(192) /* apply */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 15),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(194) /* bind */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 16),
+  (9 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 17),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(845),
+  (12 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(848),
+  (15 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_CLOSURE - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=882) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(835),
+  9,
+  JS_ROM_VALUE(851),
+  JS_NULL,
+
+  /* float64 (offset=887) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff8000000000000,
+
+  /* properties (offset=889) */
+  JS_VALUE_ARRAY_HEADER(16),
+  4 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  7 << 1,
+  13 << 1,
+  JS_ROM_VALUE(204) /* parseInt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 19),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(207) /* parseFloat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 20),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(142) /* NaN */,
+  JS_ROM_VALUE(887),
+  (4 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_NUMBER << 1,
+  (10 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=906) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  18 << 1,
+  0 << 1,
+  15 << 1,
+  6 << 1,
+  JS_ROM_VALUE(210) /* toExponential */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 21),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(213) /* toFixed */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 22),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(215) /* toPrecision */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 23),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 24),
+  (12 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_NUMBER - 1) << 1,
+  (9 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=928) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(889),
+  18,
+  JS_ROM_VALUE(906),
+  JS_NULL,
+
+  /* properties (offset=933) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_BOOLEAN << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=940) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_BOOLEAN - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=947) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(933),
+  25,
+  JS_ROM_VALUE(940),
+  JS_NULL,
+
+  /* properties (offset=952) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  7 << 1,
+  10 << 1,
+  JS_ROM_VALUE(222) /* fromCharCode */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 27),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(225) /* fromCodePoint */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 28),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_STRING << 1,
+  (4 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=966) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 29),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 30),
+
+  /* properties (offset=969) */
+  JS_VALUE_ARRAY_HEADER(76),
+  22 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  55 << 1,
+  64 << 1,
+  70 << 1,
+  46 << 1,
+  73 << 1,
+  58 << 1,
+  43 << 1,
+  61 << 1,
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(966),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(231) /* charAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 31),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(233) /* charCodeAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 32),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(236) /* codePointAt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 33),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(239) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 34),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(241) /* substring */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 35),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(244) /* concat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 36),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(246) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 37),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(248) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 38),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(251) /* match */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 39),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(253) /* replace */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 40),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(255) /* replaceAll */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 41),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(258) /* search */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 42),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(260) /* split */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 43),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(262) /* toLowerCase */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 44),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(265) /* toUpperCase */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 45),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(268) /* trim */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 46),
+  (49 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(270) /* trimEnd */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 47),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(272) /* trimStart */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 48),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 49),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(275) /* repeat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 50),
+  (67 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_STRING - 1) << 1,
+  (40 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1046) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(952),
+  26,
+  JS_ROM_VALUE(969),
+  JS_NULL,
+
+  /* properties (offset=1051) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(279) /* isArray */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 52),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1061) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 53),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 54),
+
+  /* properties (offset=1064) */
+  JS_VALUE_ARRAY_HEADER(79),
+  23 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  70 << 1,
+  46 << 1,
+  67 << 1,
+  0 << 1,
+  76 << 1,
+  10 << 1,
+  61 << 1,
+  73 << 1,
+  JS_ROM_VALUE(244) /* concat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 55),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1061),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(281) /* push */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 56),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(283) /* pop */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 57),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(285) /* join */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 58),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 59),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(287) /* reverse */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 60),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(289) /* shift */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 61),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(239) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 62),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(291) /* splice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 63),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(293) /* unshift */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 64),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(246) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 65),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(248) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 66),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(295) /* every */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 67),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(297) /* some */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 68),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(299) /* forEach */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 69),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(301) /* map */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 70),
+  (40 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(303) /* filter */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 71),
+  (49 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(305) /* reduce */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 72),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(307) /* reduceRight */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 73),
+  (55 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(305) /* reduce */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 72),
+  (64 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(310) /* sort */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 74),
+  (43 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ARRAY - 1) << 1,
+  (58 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1144) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1051),
+  51,
+  JS_ROM_VALUE(1064),
+  JS_NULL,
+
+  /* float64 (offset=1149) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x400921fb54442d18,
+
+  /* properties (offset=1151) */
+  JS_VALUE_ARRAY_HEADER(55),
+  15 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  0 << 1,
+  43 << 1,
+  0 << 1,
+  46 << 1,
+  0 << 1,
+  49 << 1,
+  0 << 1,
+  52 << 1,
+  JS_ROM_VALUE(314) /* min */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 75),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(316) /* max */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 76),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(318) /* floor */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 77),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(320) /* ceil */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 78),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(322) /* round */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 79),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(324) /* sqrt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 80),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(326) /* PI */,
+  JS_ROM_VALUE(1149),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(328) /* atan2 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 81),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(330) /* log */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 82),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(332) /* pow */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 83),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(334) /* imul */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 84),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(336) /* fround */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 85),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(338) /* idiv */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 86),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(340) /* fxmul */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 87),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(342) /* fxdiv */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 88),
+  (40 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=1207) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1151),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=1212) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(346) /* now */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 90),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_DATE << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1222) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_DATE - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1229) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1212),
+  89,
+  JS_ROM_VALUE(1222),
+  JS_NULL,
+
+  /* properties (offset=1234) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(350) /* parse */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 91),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(352) /* stringify */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 92),
+  (3 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=1244) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1234),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* properties (offset=1249) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_JSON_PARSER << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1256) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  7 << 1,
+  JS_ROM_VALUE(358) /* write */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 94),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(360) /* end */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 95),
+  (4 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_JSON_PARSER - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1270) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1249),
+  93,
+  JS_ROM_VALUE(1256),
+  JS_NULL,
+
+  /* properties (offset=1275) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_REGEXP << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1282) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 97),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 98),
+
+  /* getset (offset=1285) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 99),
+  JS_UNDEFINED,
+
+  /* properties (offset=1288) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  18 << 1,
+  15 << 1,
+  0 << 1,
+  12 << 1,
+  JS_ROM_VALUE(364) /* lastIndex */,
+  JS_ROM_VALUE(1282),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(373) /* flags */,
+  JS_ROM_VALUE(1285),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(378) /* exec */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 100),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(380) /* test */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 101),
+  (6 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_REGEXP - 1) << 1,
+  (9 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1310) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1275),
+  96,
+  JS_ROM_VALUE(1288),
+  JS_NULL,
+
+  /* properties (offset=1315) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1322) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 103),
+  JS_UNDEFINED,
+
+  /* getset (offset=1325) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 104),
+  JS_UNDEFINED,
+
+  /* properties (offset=1328) */
+  JS_VALUE_ARRAY_HEADER(21),
+  5 << 1, /* n_props */
+  3 << 1, /* hash_mask */
+  18 << 1,
+  0 << 1,
+  15 << 1,
+  12 << 1,
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 105),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(152) /* Error */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(382) /* message */,
+  JS_ROM_VALUE(1322),
+  (9 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(387) /* stack */,
+  JS_ROM_VALUE(1325),
+  (6 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ERROR - 1) << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1350) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1315),
+  102,
+  JS_ROM_VALUE(1328),
+  JS_NULL,
+
+  /* properties (offset=1355) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_EVAL_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1362) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(392) /* EvalError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_EVAL_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1372) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1355),
+  106,
+  JS_ROM_VALUE(1362),
+  JS_ROM_VALUE(1350),
+
+  /* properties (offset=1377) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_RANGE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1384) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(395) /* RangeError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_RANGE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1394) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1377),
+  107,
+  JS_ROM_VALUE(1384),
+  JS_ROM_VALUE(1350),
+
+  /* properties (offset=1399) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_REFERENCE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1406) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(398) /* ReferenceError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_REFERENCE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1416) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1399),
+  108,
+  JS_ROM_VALUE(1406),
+  JS_ROM_VALUE(1350),
+
+  /* properties (offset=1421) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_SYNTAX_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1428) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(401) /* SyntaxError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_SYNTAX_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1438) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1421),
+  109,
+  JS_ROM_VALUE(1428),
+  JS_ROM_VALUE(1350),
+
+  /* properties (offset=1443) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_TYPE_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1450) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(404) /* TypeError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_TYPE_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1460) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1443),
+  110,
+  JS_ROM_VALUE(1450),
+  JS_ROM_VALUE(1350),
+
+  /* properties (offset=1465) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_URI_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1472) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(407) /* URIError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_URI_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1482) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1465),
+  111,
+  JS_ROM_VALUE(1472),
+  JS_ROM_VALUE(1350),
+
+  /* properties (offset=1487) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INTERNAL_ERROR << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1494) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(150) /* name */,
+  JS_ROM_VALUE(410) /* InternalError */,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INTERNAL_ERROR - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1504) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1487),
+  112,
+  JS_ROM_VALUE(1494),
+  JS_ROM_VALUE(1350),
+
+  /* properties (offset=1509) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_ARRAY_BUFFER << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1516) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 114),
+  JS_UNDEFINED,
+
+  /* properties (offset=1519) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(416) /* byteLength */,
+  JS_ROM_VALUE(1516),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_ARRAY_BUFFER - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1529) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1509),
+  113,
+  JS_ROM_VALUE(1519),
+  JS_NULL,
+
+  /* properties (offset=1534) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_TYPED_ARRAY << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1541) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 116),
+  JS_UNDEFINED,
+
+  /* getset (offset=1544) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 117),
+  JS_UNDEFINED,
+
+  /* getset (offset=1547) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 118),
+  JS_UNDEFINED,
+
+  /* getset (offset=1550) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 119),
+  JS_UNDEFINED,
+
+  /* properties (offset=1553) */
+  JS_VALUE_ARRAY_HEADER(64),
+  18 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  0 << 1,
+  49 << 1,
+  34 << 1,
+  58 << 1,
+  61 << 1,
+  55 << 1,
+  46 << 1,
+  40 << 1,
+  JS_ROM_VALUE(136) /* length */,
+  JS_ROM_VALUE(1541),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(416) /* byteLength */,
+  JS_ROM_VALUE(1544),
+  (10 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(429) /* byteOffset */,
+  JS_ROM_VALUE(1547),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(435) /* buffer */,
+  JS_ROM_VALUE(1550),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(285) /* join */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 58),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(99) /* toString */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 59),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(440) /* subarray */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 120),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(128) /* set */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 121),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(443) /* fill */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 122),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(445) /* copyWithin */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 123),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(246) /* indexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 124),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(248) /* lastIndexOf */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 125),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(239) /* slice */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 126),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(448) /* sum */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 127),
+  (43 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(314) /* min */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 128),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(316) /* max */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 129),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(450) /* dot */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 130),
+  (52 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_TYPED_ARRAY - 1) << 1,
+  (37 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1618) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1534),
+  115,
+  JS_ROM_VALUE(1553),
+  JS_NULL,
+
+  /* properties (offset=1623) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT8C_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1633) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT8C_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1643) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1623),
+  131,
+  JS_ROM_VALUE(1633),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1648) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT8_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1658) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT8_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1668) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1648),
+  132,
+  JS_ROM_VALUE(1658),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1673) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT8_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1683) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  1 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT8_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1693) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1673),
+  133,
+  JS_ROM_VALUE(1683),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1698) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT16_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1708) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT16_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1718) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1698),
+  134,
+  JS_ROM_VALUE(1708),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1723) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT16_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1733) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  2 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT16_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1743) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1723),
+  135,
+  JS_ROM_VALUE(1733),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1748) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_INT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1758) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_INT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1768) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1748),
+  136,
+  JS_ROM_VALUE(1758),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1773) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_UINT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1783) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_UINT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1793) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1773),
+  137,
+  JS_ROM_VALUE(1783),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1798) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_FLOAT32_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1808) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  4 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_FLOAT32_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1818) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1798),
+  138,
+  JS_ROM_VALUE(1808),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1823) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  8 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_FLOAT64_ARRAY << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* properties (offset=1833) */
+  JS_VALUE_ARRAY_HEADER(9),
+  2 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  6 << 1,
+  JS_ROM_VALUE(452) /* BYTES_PER_ELEMENT */,
+  8 << 1,
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_FLOAT64_ARRAY - 1) << 1,
+  (3 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1843) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1823),
+  139,
+  JS_ROM_VALUE(1833),
+  JS_ROM_VALUE(1618),
+
+  /* properties (offset=1848) */
+  JS_VALUE_ARRAY_HEADER(6),
+  1 << 1, /* n_props */
+  0 << 1, /* hash_mask */
+  3 << 1,
+  JS_ROM_VALUE(130) /* prototype */,
+  JS_CLASS_DATA_VIEW << 1,
+  (0 << 1) | (JS_PROP_SPECIAL << 30),
+  /* getset (offset=1855) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 141),
+  JS_UNDEFINED,
+
+  /* getset (offset=1858) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 142),
+  JS_UNDEFINED,
+
+  /* getset (offset=1861) */
+  JS_VALUE_ARRAY_HEADER(2),
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 143),
+  JS_UNDEFINED,
+
+  /* properties (offset=1864) */
+  JS_VALUE_ARRAY_HEADER(67),
+  19 << 1, /* n_props */
+  7 << 1, /* hash_mask */
+  43 << 1,
+  58 << 1,
+  61 << 1,
+  52 << 1,
+  64 << 1,
+  46 << 1,
+  49 << 1,
+  40 << 1,
+  JS_ROM_VALUE(416) /* byteLength */,
+  JS_ROM_VALUE(1855),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(429) /* byteOffset */,
+  JS_ROM_VALUE(1858),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(435) /* buffer */,
+  JS_ROM_VALUE(1861),
+  (0 << 1) | (JS_PROP_GETSET << 30),
+  JS_ROM_VALUE(483) /* getInt8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 144),
+  (16 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(485) /* setInt8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 145),
+  (13 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(487) /* getUint8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 146),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(490) /* setUint8 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 147),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(493) /* getInt16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 148),
+  (22 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(496) /* setInt16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 149),
+  (10 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(499) /* getUint16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 150),
+  (19 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(502) /* setUint16 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 151),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(505) /* getInt32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 152),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(508) /* getUint32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 153),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(511) /* setUint32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 154),
+  (25 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(514) /* getFloat32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 155),
+  (28 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(517) /* setFloat32 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 156),
+  (31 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(520) /* getFloat64 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 157),
+  (34 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(523) /* setFloat64 */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 158),
+  (37 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(133) /* constructor */,
+  (uint32_t)(-JS_CLASS_DATA_VIEW - 1) << 1,
+  (55 << 1) | (JS_PROP_SPECIAL << 30),
+  /* class (offset=1932) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1848),
+  140,
+  JS_ROM_VALUE(1864),
+  JS_NULL,
+
+  /* float64 (offset=1937) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff0000000000000,
+
+  /* float64 (offset=1939) */
+  JS_MB_HEADER_DEF(JS_MTAG_FLOAT64),
+  0x7ff8000000000000,
+
+  /* properties (offset=1941) */
+  JS_VALUE_ARRAY_HEADER(13),
+  3 << 1, /* n_props */
+  1 << 1, /* hash_mask */
+  10 << 1,
+  7 << 1,
+  JS_ROM_VALUE(346) /* now */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 159),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(534) /* heapProfile */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 160),
+  (4 << 1) | (JS_PROP_NORMAL << 30),
+  JS_ROM_VALUE(537) /* heapReport */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 161),
+  (0 << 1) | (JS_PROP_NORMAL << 30),
+  /* class (offset=1955) */
+  JS_MB_HEADER_DEF(JS_MTAG_OBJECT),
+  JS_ROM_VALUE(1941),
+  -1,
+  JS_NULL,
+  JS_NULL,
+
+  /* global object properties (offset=1960) */
+  JS_VALUE_ARRAY_HEADER(92),
+  JS_ROM_VALUE(163) /* Object */,
+  JS_ROM_VALUE(830),
+  JS_ROM_VALUE(181) /* Function */,
+  JS_ROM_VALUE(882),
+  JS_ROM_VALUE(202) /* Number */,
+  JS_ROM_VALUE(928),
+  JS_ROM_VALUE(218) /* Boolean */,
+  JS_ROM_VALUE(947),
+  JS_ROM_VALUE(220) /* String */,
+  JS_ROM_VALUE(1046),
+  JS_ROM_VALUE(277) /* Array */,
+  JS_ROM_VALUE(1144),
+  JS_ROM_VALUE(312) /* Math */,
+  JS_ROM_VALUE(1207),
+  JS_ROM_VALUE(344) /* Date */,
+  JS_ROM_VALUE(1229),
+  JS_ROM_VALUE(348) /* JSON */,
+  JS_ROM_VALUE(1244),
+  JS_ROM_VALUE(355) /* JSONParser */,
+  JS_ROM_VALUE(1270),
+  JS_ROM_VALUE(362) /* RegExp */,
+  JS_ROM_VALUE(1310),
+  JS_ROM_VALUE(152) /* Error */,
+  JS_ROM_VALUE(1350),
+  JS_ROM_VALUE(392) /* EvalError */,
+  JS_ROM_VALUE(1372),
+  JS_ROM_VALUE(395) /* RangeError */,
+  JS_ROM_VALUE(1394),
+  JS_ROM_VALUE(398) /* ReferenceError */,
+  JS_ROM_VALUE(1416),
+  JS_ROM_VALUE(401) /* SyntaxError */,
+  JS_ROM_VALUE(1438),
+  JS_ROM_VALUE(404) /* TypeError */,
+  JS_ROM_VALUE(1460),
+  JS_ROM_VALUE(407) /* URIError */,
+  JS_ROM_VALUE(1482),
+  JS_ROM_VALUE(410) /* InternalError */,
+  JS_ROM_VALUE(1504),
+  JS_ROM_VALUE(413) /* ArrayBuffer */,
+  JS_ROM_VALUE(1529),
+  JS_ROM_VALUE(422) /* Uint8ClampedArray */,
+  JS_ROM_VALUE(1643),
+  JS_ROM_VALUE(456) /* Int8Array */,
+  JS_ROM_VALUE(1668),
+  JS_ROM_VALUE(459) /* Uint8Array */,
+  JS_ROM_VALUE(1693),
+  JS_ROM_VALUE(462) /* Int16Array */,
+  JS_ROM_VALUE(1718),
+  JS_ROM_VALUE(465) /* Uint16Array */,
+  JS_ROM_VALUE(1743),
+  JS_ROM_VALUE(468) /* Int32Array */,
+  JS_ROM_VALUE(1768),
+  JS_ROM_VALUE(471) /* Uint32Array */,
+  JS_ROM_VALUE(1793),
+  JS_ROM_VALUE(474) /* Float32Array */,
+  JS_ROM_VALUE(1818),
+  JS_ROM_VALUE(477) /* Float64Array */,
+  JS_ROM_VALUE(1843),
+  JS_ROM_VALUE(480) /* DataView */,
+  JS_ROM_VALUE(1932),
+  JS_ROM_VALUE(204) /* parseInt */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 19),
+  JS_ROM_VALUE(207) /* parseFloat */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 20),
+  JS_ROM_VALUE(119) /* eval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 162),
+  JS_ROM_VALUE(526) /* isNaN */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 163),
+  JS_ROM_VALUE(144) /* Infinity */,
+  JS_ROM_VALUE(1937),
+  JS_ROM_VALUE(142) /* NaN */,
+  JS_ROM_VALUE(1939),
+  JS_ROM_VALUE(108) /* undefined */,
+  JS_UNDEFINED,
+  JS_ROM_VALUE(528) /* globalThis */,
+  JS_NULL,
+  JS_ROM_VALUE(531) /* performance */,
+  JS_ROM_VALUE(1955),
+  JS_ROM_VALUE(540) /* gc */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 164),
+  JS_ROM_VALUE(542) /* setTimeout */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 165),
+  JS_ROM_VALUE(545) /* clearTimeout */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 166),
+  JS_ROM_VALUE(548) /* setInterval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 167),
+  JS_ROM_VALUE(551) /* clearInterval */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 168),
+  JS_ROM_VALUE(554) /* startWorker */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 169),
+  JS_ROM_VALUE(557) /* postMessage */,
+  JS_VALUE_MAKE_SPECIAL(JS_TAG_SHORT_FUNC, 170),
+};
+
+static const uint16_t js_atom_hash_table[] = {
+  /* bucket displacements */
+  3, 2, 2, 0, 0, 5, 1, 1, 1, 0, 0, 1, 1, 0, 0, 3,
+  4, 3, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, 2, 2, 0,
+  0, 1, 0, 3, 0, 9, 0, 5, 1, 3, 0, 5, 0, 2, 4, 1,
+  4, 2, 5, 2, 0, 0, 4, 4, 5, 5, 4, 0, 2, 5, 0, 0,
+  /* sorted atom table index of each slot */
+  65535, 65535, 65535, 102, 61, 65535, 27, 145, 65535, 23, 65535, 65535, 10, 227, 65535, 65535,
+  65535, 65535, 177, 65535, 65535, 65535, 65535, 65535, 134, 24, 143, 65535, 169, 167, 65535, 65535,
+  20, 200, 65535, 65535, 66, 45, 65535, 65535, 166, 65535, 65535, 65535, 65535, 65535, 65535, 226,
+  65535, 65535, 29, 65535, 65535, 65535, 159, 65535, 65535, 65535, 58, 65535, 110, 65535, 95, 65535,
+  65535, 93, 136, 65535, 68, 125, 65535, 65535, 65535, 65535, 65535, 65535, 123, 196, 65535, 82,
+  188, 65535, 65535, 65535, 65, 65535, 65535, 126, 183, 220, 65535, 65535, 135, 8, 163, 0,
+  65535, 129, 19, 120, 65535, 65535, 65535, 100, 65535, 65535, 121, 73, 150, 205, 147, 140,
+  219, 65535, 98, 65535, 65535, 28, 7, 197, 65535, 225, 113, 65535, 65535, 117, 65535, 170,
+  65535, 65535, 65535, 214, 112, 65535, 189, 59, 65535, 65535, 65535, 65535, 65535, 6, 111, 65535,
+  65535, 65535, 65535, 171, 86, 37, 138, 60, 76, 154, 141, 65535, 65535, 65535, 65535, 179,
+  194, 162, 65535, 221, 65535, 65535, 65535, 65535, 9, 65535, 190, 65535, 65535, 78, 65535, 65535,
+  65535, 65535, 146, 65535, 118, 79, 65535, 119, 52, 14, 228, 149, 65535, 67, 12, 65535,
+  88, 191, 42, 65535, 65535, 184, 91, 65535, 217, 65535, 207, 65535, 65535, 34, 161, 99,
+  16, 215, 65535, 124, 97, 36, 65535, 168, 65535, 193, 114, 65535, 176, 65535, 65535, 47,
+  65535, 65535, 65535, 65535, 65535, 174, 65535, 84, 65535, 26, 65535, 41, 87, 208, 65535, 54,
+  65535, 65535, 89, 22, 172, 65535, 65535, 229, 65535, 224, 65535, 65535, 212, 65535, 216, 218,
+  107, 65535, 65535, 65535, 65535, 132, 65535, 65535, 65535, 51, 116, 74, 65535, 65535, 65535, 202,
+  38, 65535, 128, 65535, 160, 65535, 65535, 65535, 65535, 148, 115, 65535, 71, 65535, 65535, 65535,
+  65535, 122, 65535, 65535, 2, 142, 11, 39, 65535, 65535, 65535, 65535, 65535, 43, 48, 101,
+  65535, 65535, 178, 65535, 65535, 65535, 153, 65535, 139, 32, 65535, 65535, 35, 65535, 65535, 64,
+  198, 65535, 65535, 31, 104, 206, 65535, 65535, 65535, 109, 65535, 65535, 65535, 92, 65535, 164,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 187, 65535, 185, 53, 223, 65535, 21, 56, 65535,
+  144, 105, 65535, 65535, 65535, 158, 44, 65535, 65535, 65535, 65535, 65535, 209, 65535, 65535, 46,
+  182, 15, 65535, 65535, 65535, 65535, 65535, 65535, 186, 5, 65535, 75, 157, 151, 65535, 65535,
+  199, 13, 213, 40, 65535, 65535, 65535, 65535, 133, 65535, 65535, 180, 65535, 203, 65535, 65535,
+  65535, 65535, 85, 65535, 65535, 204, 65535, 83, 65535, 65535, 3, 210, 137, 173, 65535, 65535,
+  65535, 65535, 175, 1, 65535, 65535, 65535, 65535, 65535, 49, 57, 65535, 152, 65535, 131, 65535,
+  211, 65535, 130, 90, 25, 70, 156, 181, 65535, 106, 65535, 65535, 155, 65535, 65535, 65535,
+  65535, 65535, 4, 65535, 222, 65535, 65535, 65535, 65535, 55, 201, 65535, 63, 65535, 69, 65535,
+  65535, 127, 65535, 65535, 65535, 30, 65535, 65535, 65535, 77, 65535, 195, 165, 65535, 108, 65535,
+  96, 65535, 65535, 65535, 65535, 94, 65535, 17, 62, 18, 65535, 65535, 65535, 65535, 81, 103,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 33, 65535, 65535, 72, 65535, 50, 65535, 192, 80,
+};
+
+static const JSCFunctionDef js_c_function_table[] = {
+  { { .generic_params = js_function_bound },
+    JS_ROM_VALUE(161) /* bound */,
+    JS_CFUNC_generic_params, 0, 0 },
+  { { .constructor = js_object_constructor },
+    JS_ROM_VALUE(163) /* Object */,
+    JS_CFUNC_constructor, 1, JS_CLASS_OBJECT },
+  { { .generic = js_object_defineProperty },
+    JS_ROM_VALUE(165) /* defineProperty */,
+    JS_CFUNC_generic, 3, 0 },
+  { { .generic = js_object_getPrototypeOf },
+    JS_ROM_VALUE(168) /* getPrototypeOf */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_setPrototypeOf },
+    JS_ROM_VALUE(171) /* setPrototypeOf */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_object_create },
+    JS_ROM_VALUE(174) /* create */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_object_keys },
+    JS_ROM_VALUE(176) /* keys */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_hasOwnProperty },
+    JS_ROM_VALUE(178) /* hasOwnProperty */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_object_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_function_constructor },
+    JS_ROM_VALUE(181) /* Function */,
+    JS_CFUNC_constructor, 1, JS_CLASS_CLOSURE },
+  { { .generic = js_function_get_prototype },
+    JS_ROM_VALUE(184) /* get prototype */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_function_set_prototype },
+    JS_ROM_VALUE(187) /* set prototype */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_function_get_length_name },
+    JS_ROM_VALUE(196) /* get length */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_function_get_length_name },
+    JS_ROM_VALUE(199) /* get name */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_function_call },
+    JS_ROM_VALUE(190) /* call */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_function_apply },
+    JS_ROM_VALUE(192) /* apply */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_function_bind },
+    JS_ROM_VALUE(194) /* bind */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_function_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_number_constructor },
+    JS_ROM_VALUE(202) /* Number */,
+    JS_CFUNC_constructor, 1, JS_CLASS_NUMBER },
+  { { .generic = js_number_parseInt },
+    JS_ROM_VALUE(204) /* parseInt */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_number_parseFloat },
+    JS_ROM_VALUE(207) /* parseFloat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toExponential },
+    JS_ROM_VALUE(210) /* toExponential */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toFixed },
+    JS_ROM_VALUE(213) /* toFixed */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toPrecision },
+    JS_ROM_VALUE(215) /* toPrecision */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_number_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor = js_boolean_constructor },
+    JS_ROM_VALUE(218) /* Boolean */,
+    JS_CFUNC_constructor, 1, JS_CLASS_BOOLEAN },
+  { { .constructor = js_string_constructor },
+    JS_ROM_VALUE(220) /* String */,
+    JS_CFUNC_constructor, 1, JS_CLASS_STRING },
+  { { .generic_magic = js_string_fromCharCode },
+    JS_ROM_VALUE(222) /* fromCharCode */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_string_fromCharCode },
+    JS_ROM_VALUE(225) /* fromCodePoint */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_string_get_length },
+    JS_ROM_VALUE(196) /* get length */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_string_set_length },
+    JS_ROM_VALUE(228) /* set length */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(231) /* charAt */,
+    JS_CFUNC_generic_magic, 1, magic_charAt },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(233) /* charCodeAt */,
+    JS_CFUNC_generic_magic, 1, magic_charCodeAt },
+  { { .generic_magic = js_string_charAt },
+    JS_ROM_VALUE(236) /* codePointAt */,
+    JS_CFUNC_generic_magic, 1, magic_codePointAt },
+  { { .generic = js_string_slice },
+    JS_ROM_VALUE(239) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_string_substring },
+    JS_ROM_VALUE(241) /* substring */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_string_concat },
+    JS_ROM_VALUE(244) /* concat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_indexOf },
+    JS_ROM_VALUE(246) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_string_indexOf },
+    JS_ROM_VALUE(248) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_string_match },
+    JS_ROM_VALUE(251) /* match */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_string_replace },
+    JS_ROM_VALUE(253) /* replace */,
+    JS_CFUNC_generic_magic, 2, 0 },
+  { { .generic_magic = js_string_replace },
+    JS_ROM_VALUE(255) /* replaceAll */,
+    JS_CFUNC_generic_magic, 2, 1 },
+  { { .generic = js_string_search },
+    JS_ROM_VALUE(258) /* search */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_string_split },
+    JS_ROM_VALUE(260) /* split */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_string_toLowerCase },
+    JS_ROM_VALUE(262) /* toLowerCase */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_string_toLowerCase },
+    JS_ROM_VALUE(265) /* toUpperCase */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(268) /* trim */,
+    JS_CFUNC_generic_magic, 0, 3 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(270) /* trimEnd */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_string_trim },
+    JS_ROM_VALUE(272) /* trimStart */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_string_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_string_repeat },
+    JS_ROM_VALUE(275) /* repeat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor = js_array_constructor },
+    JS_ROM_VALUE(277) /* Array */,
+    JS_CFUNC_constructor, 1, JS_CLASS_ARRAY },
+  { { .generic = js_array_isArray },
+    JS_ROM_VALUE(279) /* isArray */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_get_length },
+    JS_ROM_VALUE(196) /* get length */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_set_length },
+    JS_ROM_VALUE(228) /* set length */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_concat },
+    JS_ROM_VALUE(244) /* concat */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_array_push },
+    JS_ROM_VALUE(281) /* push */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic = js_array_pop },
+    JS_ROM_VALUE(283) /* pop */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_join },
+    JS_ROM_VALUE(285) /* join */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_array_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_reverse },
+    JS_ROM_VALUE(287) /* reverse */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_shift },
+    JS_ROM_VALUE(289) /* shift */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_array_slice },
+    JS_ROM_VALUE(239) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_array_splice },
+    JS_ROM_VALUE(291) /* splice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_array_push },
+    JS_ROM_VALUE(293) /* unshift */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic_magic = js_array_indexOf },
+    JS_ROM_VALUE(246) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_array_indexOf },
+    JS_ROM_VALUE(248) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(295) /* every */,
+    JS_CFUNC_generic_magic, 1, js_special_every },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(297) /* some */,
+    JS_CFUNC_generic_magic, 1, js_special_some },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(299) /* forEach */,
+    JS_CFUNC_generic_magic, 1, js_special_forEach },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(301) /* map */,
+    JS_CFUNC_generic_magic, 1, js_special_map },
+  { { .generic_magic = js_array_every },
+    JS_ROM_VALUE(303) /* filter */,
+    JS_CFUNC_generic_magic, 1, js_special_filter },
+  { { .generic_magic = js_array_reduce },
+    JS_ROM_VALUE(305) /* reduce */,
+    JS_CFUNC_generic_magic, 1, js_special_reduce },
+  { { .generic_magic = js_array_reduce },
+    JS_ROM_VALUE(307) /* reduceRight */,
+    JS_CFUNC_generic_magic, 1, js_special_reduceRight },
+  { { .generic = js_array_sort },
+    JS_ROM_VALUE(310) /* sort */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic_magic = js_math_min_max },
+    JS_ROM_VALUE(314) /* min */,
+    JS_CFUNC_generic_magic, 2, 0 },
+  { { .generic_magic = js_math_min_max },
+    JS_ROM_VALUE(316) /* max */,
+    JS_CFUNC_generic_magic, 2, 1 },
+  { { .f_f = js_floor },
+    JS_ROM_VALUE(318) /* floor */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_ceil },
+    JS_ROM_VALUE(320) /* ceil */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_round_inf },
+    JS_ROM_VALUE(322) /* round */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_f = js_sqrt },
+    JS_ROM_VALUE(324) /* sqrt */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_ff = js_atan2 },
+    JS_ROM_VALUE(328) /* atan2 */,
+    JS_CFUNC_f_ff, 2, 0 },
+  { { .f_f = js_log },
+    JS_ROM_VALUE(330) /* log */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .f_ff = js_pow },
+    JS_ROM_VALUE(332) /* pow */,
+    JS_CFUNC_f_ff, 2, 0 },
+  { { .i_ii = js_math_imul },
+    JS_ROM_VALUE(334) /* imul */,
+    JS_CFUNC_i_ii, 2, 0 },
+  { { .f_f = js_math_fround },
+    JS_ROM_VALUE(336) /* fround */,
+    JS_CFUNC_f_f, 1, 0 },
+  { { .i_ii = js_math_idiv },
+    JS_ROM_VALUE(338) /* idiv */,
+    JS_CFUNC_i_ii, 2, 0 },
+  { { .i_iii = js_math_fxmul },
+    JS_ROM_VALUE(340) /* fxmul */,
+    JS_CFUNC_i_iii, 3, 0 },
+  { { .i_iii = js_math_fxdiv },
+    JS_ROM_VALUE(342) /* fxdiv */,
+    JS_CFUNC_i_iii, 3, 0 },
+  { { .constructor = js_date_constructor },
+    JS_ROM_VALUE(344) /* Date */,
+    JS_CFUNC_constructor, 7, JS_CLASS_DATE },
+  { { .generic = js_date_now },
+    JS_ROM_VALUE(346) /* now */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_json_parse },
+    JS_ROM_VALUE(350) /* parse */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_json_stringify },
+    JS_ROM_VALUE(352) /* stringify */,
+    JS_CFUNC_generic, 3, 0 },
+  { { .constructor = js_json_parser_constructor },
+    JS_ROM_VALUE(355) /* JSONParser */,
+    JS_CFUNC_constructor, 2, JS_CLASS_JSON_PARSER },
+  { { .generic = js_json_parser_write_chunk },
+    JS_ROM_VALUE(358) /* write */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_json_parser_end_input },
+    JS_ROM_VALUE(360) /* end */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_regexp_constructor },
+    JS_ROM_VALUE(362) /* RegExp */,
+    JS_CFUNC_constructor, 2, JS_CLASS_REGEXP },
+  { { .generic = js_regexp_get_lastIndex },
+    JS_ROM_VALUE(367) /* get lastIndex */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_regexp_set_lastIndex },
+    JS_ROM_VALUE(370) /* set lastIndex */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_regexp_get_flags },
+    JS_ROM_VALUE(375) /* get flags */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic_magic = js_regexp_exec },
+    JS_ROM_VALUE(378) /* exec */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_regexp_exec },
+    JS_ROM_VALUE(380) /* test */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(152) /* Error */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_ERROR },
+  { { .generic_magic = js_error_get_message },
+    JS_ROM_VALUE(384) /* get message */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_error_get_message },
+    JS_ROM_VALUE(389) /* get stack */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_error_toString },
+    JS_ROM_VALUE(99) /* toString */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(392) /* EvalError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_EVAL_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(395) /* RangeError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_RANGE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(398) /* ReferenceError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_REFERENCE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(401) /* SyntaxError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_SYNTAX_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(404) /* TypeError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_TYPE_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(407) /* URIError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_URI_ERROR },
+  { { .constructor_magic = js_error_constructor },
+    JS_ROM_VALUE(410) /* InternalError */,
+    JS_CFUNC_constructor_magic, 1, JS_CLASS_INTERNAL_ERROR },
+  { { .constructor = js_array_buffer_constructor },
+    JS_ROM_VALUE(413) /* ArrayBuffer */,
+    JS_CFUNC_constructor, 1, JS_CLASS_ARRAY_BUFFER },
+  { { .generic = js_array_buffer_get_byteLength },
+    JS_ROM_VALUE(419) /* get byteLength */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .constructor = js_typed_array_base_constructor },
+    JS_ROM_VALUE(426) /* TypedArray */,
+    JS_CFUNC_constructor, 0, JS_CLASS_TYPED_ARRAY },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(196) /* get length */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(419) /* get byteLength */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(432) /* get byteOffset */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_typed_array_get_length },
+    JS_ROM_VALUE(437) /* get buffer */,
+    JS_CFUNC_generic_magic, 0, 3 },
+  { { .generic = js_typed_array_subarray },
+    JS_ROM_VALUE(440) /* subarray */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_typed_array_set },
+    JS_ROM_VALUE(128) /* set */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_typed_array_fill },
+    JS_ROM_VALUE(443) /* fill */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_typed_array_copyWithin },
+    JS_ROM_VALUE(445) /* copyWithin */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic_magic = js_typed_array_indexOf },
+    JS_ROM_VALUE(246) /* indexOf */,
+    JS_CFUNC_generic_magic, 1, 0 },
+  { { .generic_magic = js_typed_array_indexOf },
+    JS_ROM_VALUE(248) /* lastIndexOf */,
+    JS_CFUNC_generic_magic, 1, 1 },
+  { { .generic = js_typed_array_slice },
+    JS_ROM_VALUE(239) /* slice */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_typed_array_sum },
+    JS_ROM_VALUE(448) /* sum */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic_magic = js_typed_array_min_max },
+    JS_ROM_VALUE(314) /* min */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_typed_array_min_max },
+    JS_ROM_VALUE(316) /* max */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic = js_typed_array_dot },
+    JS_ROM_VALUE(450) /* dot */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(422) /* Uint8ClampedArray */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT8C_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(456) /* Int8Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT8_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(459) /* Uint8Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT8_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(462) /* Int16Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT16_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(465) /* Uint16Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT16_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(468) /* Int32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_INT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(471) /* Uint32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_UINT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(474) /* Float32Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_FLOAT32_ARRAY },
+  { { .constructor_magic = js_typed_array_constructor },
+    JS_ROM_VALUE(477) /* Float64Array */,
+    JS_CFUNC_constructor_magic, 3, JS_CLASS_FLOAT64_ARRAY },
+  { { .constructor = js_dataview_constructor },
+    JS_ROM_VALUE(480) /* DataView */,
+    JS_CFUNC_constructor, 3, JS_CLASS_DATA_VIEW },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(419) /* get byteLength */,
+    JS_CFUNC_generic_magic, 0, 0 },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(432) /* get byteOffset */,
+    JS_CFUNC_generic_magic, 0, 1 },
+  { { .generic_magic = js_dataview_get_length },
+    JS_ROM_VALUE(437) /* get buffer */,
+    JS_CFUNC_generic_magic, 0, 2 },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(483) /* getInt8 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT8_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(485) /* setInt8 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT8_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(487) /* getUint8 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT8_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(490) /* setUint8 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT8_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(493) /* getInt16 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT16_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(496) /* setInt16 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_INT16_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(499) /* getUint16 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT16_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(502) /* setUint16 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT16_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(505) /* getInt32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_INT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(508) /* getUint32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_UINT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(511) /* setUint32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_UINT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(514) /* getFloat32 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_FLOAT32_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(517) /* setFloat32 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_FLOAT32_ARRAY },
+  { { .generic_magic = js_dataview_getValue },
+    JS_ROM_VALUE(520) /* getFloat64 */,
+    JS_CFUNC_generic_magic, 1, JS_CLASS_FLOAT64_ARRAY },
+  { { .generic_magic = js_dataview_setValue },
+    JS_ROM_VALUE(523) /* setFloat64 */,
+    JS_CFUNC_generic_magic, 2, JS_CLASS_FLOAT64_ARRAY },
+  { { .generic = js_performance_now },
+    JS_ROM_VALUE(346) /* now */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_performance_heapProfile },
+    JS_ROM_VALUE(534) /* heapProfile */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_performance_heapReport },
+    JS_ROM_VALUE(537) /* heapReport */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_global_eval },
+    JS_ROM_VALUE(119) /* eval */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_global_isNaN },
+    JS_ROM_VALUE(526) /* isNaN */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_gc },
+    JS_ROM_VALUE(540) /* gc */,
+    JS_CFUNC_generic, 0, 0 },
+  { { .generic = js_setTimeout },
+    JS_ROM_VALUE(542) /* setTimeout */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_clearTimeout },
+    JS_ROM_VALUE(545) /* clearTimeout */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_setInterval },
+    JS_ROM_VALUE(548) /* setInterval */,
+    JS_CFUNC_generic, 2, 0 },
+  { { .generic = js_clearTimeout },
+    JS_ROM_VALUE(551) /* clearInterval */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_startWorker },
+    JS_ROM_VALUE(554) /* startWorker */,
+    JS_CFUNC_generic, 1, 0 },
+  { { .generic = js_postMessage },
+    JS_ROM_VALUE(557) /* postMessage */,
+    JS_CFUNC_generic, 1, 0 },
+};
+
+#ifndef JS_CLASS_COUNT
+#define JS_CLASS_COUNT JS_CLASS_USER /* total number of classes */
+#endif
+
+static const JSCFinalizer js_c_finalizer_table[JS_CLASS_COUNT - JS_CLASS_USER] = {
+};
+
+const JSSTDLibraryDef js_stdlib = {
+  js_stdlib_table,
+  js_c_function_table,
+  js_c_finalizer_table,
+  2053,
+  64,
+  560,
+  1960,
+  JS_CLASS_COUNT,
+  js_atom_hash_table,
+  9,
+  6,
+};
+
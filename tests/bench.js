@@ -0,0 +1,257 @@
+/*
+ * Benchmark suite with machine-readable results
+ *
+ * usage: mqjs [--memory-limit 64k] tests/bench.js [-d duration_ms] [test...]
+ *
+ * The workloads are sized to run in a 64 KB heap, like on the
+ * ESP32. On the board, the script is run from the REPL with
+ * load("/bench.js"). One JSON object is printed per test:
+ *
+ *   {"name":"json_mqtt","ops_per_sec":1234.5,"gc_count":2,
+ *    "gc_minor_count":35,"gc_pause_max":120,"heap_peak":23456}
+ *
+ * gc_pause_max is in microseconds. The GC fields are null if the
+ * runtime does not provide performance.memory(). Use
+ * tests/bench_compare.js to compare two result sets.
+ */
+
+if (typeof console == "undefined") {
+    var console = { log: print };
+}
+
+var get_clock;
+if (typeof performance != "undefined")
+    get_clock = performance.now;
+else
+    get_clock = Date.now;
+
+var has_memory_stats = (typeof performance != "undefined" &&
+                        typeof performance.memory == "function");
+
+var global_res; /* to be sure the code is not optimized */
+
+/* each test returns the number of operations done */
+
+/* integer and float iteration count of the mandelbrot set */
+function mandelbrot(n)
+{
+    var x1, y1, i, x, y, t, cx, cy, w, h, sum, k;
+    w = 16;
+    h = 8;
+    sum = 0;
+    for(k = 0; k < n; k++) {
+        for(y1 = 0; y1 < h; y1++) {
+            for(x1 = 0; x1 < w; x1++) {
+                cx = (x1 - w * 0.75) * 2.5 / w;
+                cy = (y1 - h * 0.5) * 2.5 / w;
+                x = 0;
+                y = 0;
+                for(i = 0; i < 50 && x * x + y * y < 4; i++) {
+                    t = x * x - y * y + cx;
+                    y = 2 * x * y + cy;
+                    x = t;
+                }
+                sum += i;
+            }
+        }
+    }
+    global_res = sum;
+    return n * w * h;
+}
+
+/* MQTT style JSON payload round trip */
+function json_mqtt(n)
+{
+    var i, j, msg, str, obj, sum;
+    sum = 0;
+    for(i = 0; i < n; i++) {
+        msg = {
+            topic: "home/livingroom/sensor",
+            ts: 1700000000 + i,
+            battery: 87,
+            online: true,
+            readings: [],
+        };
+        for(j = 0; j < 4; j++) {
+            msg.readings.push({ id: j, value: 21.5 + j * 0.25, unit: "C" });
+        }
+        str = JSON.stringify(msg);
+        obj = JSON.parse(str);
+        if (obj.readings.length != 4 || obj.topic != msg.topic)
+            throw Error("json_mqtt");
+        sum += obj.readings[3].value + str.length;
+    }
+    global_res = sum;
+    return n;
+}
+
+/* FIR filter and RMS on int16 samples, as done on a microphone or
+   ADC buffer */
+function dsp_fir(n)
+{
+    var len = 256, taps = 16;
+    var samples = new Int16Array(len);
+    var coefs = new Float32Array(taps);
+    var out = new Float32Array(len);
+    var i, j, k, acc, rms;
+
+    for(i = 0; i < len; i++)
+        samples[i] = ((i * 7919) & 0xfff) - 2048;
+    for(j = 0; j < taps; j++)
+        coefs[j] = 1 / taps;
+    rms = 0;
+    for(k = 0; k < n; k++) {
+        for(i = taps; i < len; i++) {
+            acc = 0;
+            for(j = 0; j < taps; j++)
+                acc += samples[i - j] * coefs[j];
+            out[i] = acc;
+        }
+        acc = 0;
+        for(i = 0; i < len; i++)
+            acc += out[i] * out[i];
+        rms += Math.sqrt(acc / len);
+    }
+    global_res = rms;
+    return n * (len - taps);
+}
+
+/* short lived objects, arrays and strings */
+function gc_alloc(n)
+{
+    var i, j, a, live;
+    live = [];
+    for(i = 0; i < n; i++) {
+        a = [];
+        for(j = 0; j < 8; j++)
+            a.push({ x: i, y: j, s: "v" + j });
+        /* keep a few objects alive to exercise the old generation */
+        live[i & 15] = a;
+    }
+    global_res = live;
+    return n * 8;
+}
+
+/* many timers firing at the same time, each rescheduling itself
+   and cancelling a pending interval */
+function timer_storm(n, done)
+{
+    var started, fired = 0, i, dummy;
+
+    function tick() {
+        dummy = setInterval(tick, 1000);
+        clearTimeout(dummy);
+        fired++;
+        if (started < n) {
+            started++;
+            setTimeout(tick, 0);
+        } else if (fired == started) {
+            done(fired);
+        }
+    }
+    started = Math.min(n, 32);
+    for(i = 0; i < started; i++)
+        setTimeout(tick, 0);
+}
+timer_storm.async = true;
+
+var test_list = [
+    mandelbrot,
+    json_mqtt,
+    dsp_fir,
+    gc_alloc,
+    timer_storm,
+];
+
+var duration = 500; /* ms per test */
+
+function log_result(name, ops, ti)
+{
+    var r, m;
+    r = { name: name,
+          ops_per_sec: Math.round(ops * 10000 / ti) / 10,
+          gc_count: null,
+          gc_minor_count: null,
+          gc_pause_max: null,
+          heap_peak: null };
+    if (has_memory_stats) {
+        m = performance.memory();
+        r.gc_count = m.gcCount;
+        r.gc_minor_count = m.gcMinorCount;
+        r.gc_pause_max = m.gcPauseMax;
+        r.heap_peak = m.heapSizeMax;
+    }
+    console.log(JSON.stringify(r));
+}
+
+/* call f(n, done) with an increasing 'n' until it ran for 'duration'
+   ms, then call done() */
+function bench(f, done)
+{
+    var n = 1, total_ops = 0, total_ti = 0, t0;
+
+    function run_once(ops) {
+        var ti = get_clock() - t0;
+        if (ops < 0)
+            throw Error(f.name + ": test failure");
+        total_ops += ops;
+        total_ti += ti;
+        if (total_ti < duration) {
+            /* aim for about ten runs */
+            if (ti < duration / 10)
+                n *= 2;
+            start();
+        } else {
+            log_result(f.name, total_ops, total_ti);
+            done();
+        }
+    }
+
+    function start() {
+        t0 = get_clock();
+        if (f.async)
+            f(n, run_once);
+        else
+            run_once(f(n));
+    }
+
+    if (typeof gc == "function")
+        gc();
+    if (has_memory_stats)
+        performance.resetMemory();
+    start();
+}
+
+function main(argv)
+{
+    var tests = [], i, j, name, found;
+
+    for(i = 0; i < argv.length;) {
+        name = argv[i++];
+        if (name == "-d") {
+            duration = +argv[i++];
+            continue;
+        }
+        found = false;
+        for(j = 0; j < test_list.length; j++) {
+            if (test_list[j].name == name) {
+                tests.push(test_list[j]);
+                found = true;
+            }
+        }
+        if (!found)
+            throw Error("unknown test: " + name);
+    }
+    if (tests.length == 0)
+        tests = test_list;
+
+    i = 0;
+    function next() {
+        if (i < tests.length)
+            bench(tests[i++], next);
+    }
+    next();
+}
+
+/* scriptArgs[0] is the script name */
+main(typeof scriptArgs == "undefined" ? [] : scriptArgs.slice(1));
@@ -0,0 +1,93 @@
+/*
+ * Compare two benchmark result sets (see tests/bench.js)
+ *
+ * usage: mqjs tests/bench_compare.js [-t threshold] ref_file new_file
+ *
+ * ref_file and new_file contain the output of tests/bench.js or
+ * 'tests/microbench.js -j' (one JSON object per line), e.g.:
+ *
+ *   mqjs tests/bench_compare.js bench-ref.json bench-new.json
+ *
+ * A test regresses if its ops_per_sec drops or its heap_peak grows by
+ * more than 'threshold' percent (default 10). The script throws an
+ * error, so that mqjs exits with a non zero status, if any test
+ * regressed.
+ */
+
+if (typeof console == "undefined") {
+    var console = { log: print };
+}
+
+function pad_left(str, n) {
+    str += "";
+    while (str.length < n)
+        str = " " + str;
+    return str;
+}
+
+function parse_results(str)
+{
+    var lines, i, line, r, res;
+    res = {};
+    lines = str.split("\n");
+    for(i = 0; i < lines.length; i++) {
+        line = lines[i];
+        if (line.length == 0 || line[0] != "{")
+            continue;
+        r = JSON.parse(line);
+        res[r.name] = r;
+    }
+    return res;
+}
+
+function percent(ref, val)
+{
+    return (val - ref) * 100 / ref;
+}
+
+function main(argv)
+{
+    var threshold = 10, i, ref, res, name, r0, r1, d_ops, d_heap, status;
+    var regressions = 0;
+
+    i = 0;
+    if (argv[i] == "-t") {
+        threshold = +argv[i + 1];
+        i += 2;
+    }
+    if (argv.length - i != 2)
+        throw Error("usage: bench_compare.js [-t threshold] ref_file new_file");
+    ref = parse_results(readFile(argv[i]));
+    res = parse_results(readFile(argv[i + 1]));
+
+    console.log(pad_left("TEST", 22) + pad_left("REF (ops/s)", 14) +
+                pad_left("NEW (ops/s)", 14) + pad_left("OPS (%)", 9) +
+                pad_left("HEAP (%)", 9));
+    for(name in res) {
+        r1 = res[name];
+        r0 = ref[name];
+        if (!r0)
+            continue;
+        d_ops = percent(r0.ops_per_sec, r1.ops_per_sec);
+        status = "";
+        if (d_ops < -threshold)
+            status = " slower";
+        d_heap = 0;
+        if (r0.heap_peak && r1.heap_peak) {
+            d_heap = percent(r0.heap_peak, r1.heap_peak);
+            if (d_heap > threshold)
+                status += " heap";
+        }
+        if (status != "")
+            regressions++;
+        console.log(pad_left(name, 22) + pad_left(r0.ops_per_sec.toFixed(1), 14) +
+                    pad_left(r1.ops_per_sec.toFixed(1), 14) +
+                    pad_left(d_ops.toFixed(1), 9) +
+                    pad_left(d_heap.toFixed(1), 9) + status);
+    }
+    if (regressions != 0)
+        throw Error(regressions + " regression(s) above " + threshold + "%");
+}
+
+/* scriptArgs[0] is the script name */
+main(scriptArgs.slice(1));
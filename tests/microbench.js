@@ -50,6 +50,7 @@ function pad_center(str, n) {
 
 var ref_data;
 var log_data;
+var json_output = false; /* one JSON object per test, see tests/bench.js */
 
 var heads  = [ "TEST", "N", "TIME (ns)", "REF (ns)", "SCORE (%)" ];
 var widths = [    22,   10,          9,     9,       9 ];
@@ -91,6 +92,25 @@ if (typeof performance != "undefined")
 else
     get_clock = Date.now;
 
+function log_json(text, ti) {
+    var r, m;
+    r = { name: text,
+          ops_per_sec: Math.round(1e10 / ti) / 10,
+          gc_count: null,
+          gc_minor_count: null,
+          gc_pause_max: null,
+          heap_peak: null };
+    if (typeof performance != "undefined" &&
+        typeof performance.memory == "function") {
+        m = performance.memory();
+        r.gc_count = m.gcCount;
+        r.gc_minor_count = m.gcMinorCount;
+        r.gc_pause_max = m.gcPauseMax;
+        r.heap_peak = m.heapSizeMax;
+    }
+    console.log(JSON.stringify(r));
+}
+
 function log_one(text, n, ti) {
     var ref;
 
@@ -102,6 +122,10 @@ function log_one(text, n, ti) {
     // XXX
     //    ti = Math.round(ti * 100) / 100;
     log_data[text] = ti;
+    if (json_output) {
+        log_json(text, ti);
+        return;
+    }
     if (typeof ref === "number") {
         log_line(text, n, ti, ref, ti * 100 / ref);
         total_score += ti * 100 / ref;
@@ -118,6 +142,11 @@ function bench(f, text)
     var i, j, n, t, t1, ti, nb_its, ref, ti_n, ti_n1, min_ti;
 
     nb_its = n = 1;
+    if (json_output && typeof performance != "undefined" &&
+        typeof performance.resetMemory == "function") {
+        gc();
+        performance.resetMemory();
+    }
     if (f.bench) {
         ti_n = f(text);
     } else {
@@ -1080,6 +1109,10 @@ function main(argc, argv, g)
     
     for (i = 1; i < argc;) {
         name = argv[i++];
+        if (name == "-j") {
+            json_output = true;
+            continue;
+        }
         if (name == "-a") {
             sort_bench.verbose = true;
             continue;
@@ -1114,7 +1147,8 @@ function main(argc, argv, g)
 
     ref_data = load_result("microbench.txt");
     log_data = {};
-    log_line.apply(null, heads);
+    if (!json_output)
+        log_line.apply(null, heads);
     n = 0;
 
     for(i = 0; i < tests.length; i++) {
@@ -1123,6 +1157,8 @@ function main(argc, argv, g)
         if (ref_data && ref_data[f.name])
             n++;
     }
+    if (json_output)
+        return;
     if (ref_data)
         log_line("total", "", total[2], total[3], total_score * 100 / total_scale);
     else
@@ -180,6 +180,60 @@ function test_enum()
     assert(tab.toString(), "x,y,z", "keys");
 }
 
+function test_object_shape()
+{
+    var tab, a, b, i, s;
+
+    /* objects built with the same keys share their property table */
+    tab = [];
+    for(i = 0; i < 100; i++)
+        tab.push({ id: i, value: i * 2, ts: "t" + i });
+    gc();
+    for(i = 0; i < 100; i++) {
+        assert(tab[i].id, i);
+        assert(tab[i].value, i * 2);
+        assert(tab[i].ts, "t" + i);
+    }
+    a = tab[3];
+    a.value = -1;
+    assert(a.value, -1);
+    assert(tab[4].value, 8);
+    assert(Object.keys(a).toString(), "id,value,ts");
+    assert(JSON.stringify(a), '{"id":3,"value":-1,"ts":"t3"}');
+    s = "";
+    for(i in a)
+        s += i;
+    assert(s, "idvaluets");
+    assert(a.hasOwnProperty("ts"), true);
+    assert(a.hasOwnProperty("x"), false);
+    
+    /* modifications of the property list */
+    a.x = 1;
+    assert(a.x, 1);
+    assert(a.id, 3);
+    assert(tab[4].x, undefined);
+    b = tab[5];
+    delete b.value;
+    assert(b.hasOwnProperty("value"), false);
+    assert(Object.keys(b).toString(), "id,ts");
+    assert(tab[6].value, 12);
+    /* deleting a missing key keeps the shape */
+    b = { a: 0x3fffffff, b: 2, c: 3 };
+    assert(delete b.zz, true);
+    assert(Object.keys(b).toString(), "a,b,c");
+    assert(delete tab[9].zz, true);
+    assert(tab[9].ts, "t9");
+    Object.defineProperty(tab[7], "id", { value: 77 });
+    assert(tab[7].id, 77);
+    assert(tab[8].id, 8);
+
+    tab = JSON.parse('[{"x":1,"y":2},{"x":3,"y":4}]');
+    tab[0].x = 5;
+    assert(tab[0].x, 5);
+    assert(tab[1].x, 3);
+    assert(tab[1].y, 4);
+}
+
 function test_array()
 {
     var a, err, i, log;
@@ -315,6 +369,102 @@ function test_array()
     assert(a.toString(), "a0,a1,a2,b0,b1,z0,z1,,");
 }
 
+function test_array_sort()
+{
+    var a, b, i, n, seed, err;
+
+    function rand() {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed >> 8;
+    }
+    function check_sorted(a, cmp) {
+        var i;
+        for(i = 1; i < a.length; i++) {
+            if (cmp(a[i - 1], a[i]) > 0)
+                return false;
+        }
+        return true;
+    }
+    function num_cmp(a, b) { return a - b; }
+    function num_rcmp(a, b) { return b - a; }
+    function str_cmp(a, b) { a = String(a); b = String(b); return (a > b) - (a < b); }
+
+    /* default comparison of integers */
+    a = [10, 9, 1, -5, 100, 0, -10];
+    a.sort();
+    assert(a.toString(), "-10,-5,0,1,10,100,9");
+
+    /* numeric comparators on integers and floats */
+    a = [3, -1, 2.5, 1e10, -0.5, 7];
+    a.sort(num_cmp);
+    assert(a.toString(), "-1,-0.5,2.5,3,7,10000000000");
+    a.sort(num_rcmp);
+    assert(a.toString(), "10000000000,7,3,2.5,-0.5,-1");
+    a = [3, NaN, 1];
+    a.sort(function(x, y) { return x - y; });
+    assert(a.length, 3);
+    /* mixed types use the generic path */
+    a = [3, "10", 2];
+    a.sort(num_cmp);
+    assert(a.toString(), "2,3,10");
+
+    /* random, almost sorted and descending data */
+    seed = 1;
+    for(n = 0; n < 300; n += 37) {
+        a = [];
+        for(i = 0; i < n; i++)
+            a.push(rand() % 100);
+        b = a.slice();
+        b.sort(num_cmp);
+        assert(check_sorted(b, num_cmp), true);
+        b = a.slice();
+        b.sort(function(x, y) { return y < x ? -1 : y > x ? 1 : 0; });
+        assert(check_sorted(b, num_rcmp), true);
+        b = a.slice();
+        b.sort();
+        assert(check_sorted(b, str_cmp), true);
+        b = a.slice();
+        for(i = 0; i < n; i++)
+            b[i] = a[i] / 4;
+        b.sort(num_cmp);
+        assert(check_sorted(b, num_cmp), true);
+    }
+    a = [];
+    for(i = 0; i < 1000; i++)
+        a.push(i);
+    a[100] = 5000;
+    a[900] = -1;
+    a.sort(num_cmp);
+    assert(check_sorted(a, num_cmp), true);
+    assert(a[0] === -1 && a[999] === 5000, true);
+    a = [];
+    for(i = 0; i < 500; i++)
+        a.push(500 - i);
+    a.sort(num_cmp);
+    assert(a[0] === 1 && a[499] === 500 && check_sorted(a, num_cmp), true);
+
+    /* stability across merged runs */
+    a = [];
+    for(i = 0; i < 200; i++)
+        a.push({ k: (i * 7) % 5, i: i });
+    a.sort(function(x, y) { return x.k - y.k; });
+    for(i = 1; i < a.length; i++) {
+        assert(a[i - 1].k < a[i].k ||
+               (a[i - 1].k == a[i].k && a[i - 1].i < a[i].i), true);
+    }
+
+    /* exception in the comparator */
+    a = [3, 2, 1];
+    err = null;
+    try {
+        a.sort(function(x, y) { throw "cmp"; });
+    } catch (e) {
+        err = e;
+    }
+    assert(err, "cmp");
+    assert(a.toString(), "3,2,1");
+}
+
 /* non standard array behaviors */
 function test_array_ext()
 {
@@ -332,6 +482,119 @@ function test_array_ext()
     assert_throws(TypeError, function () { a["-Infinity"] = 1; } );
 }
 
+function test_unique_strings()
+{
+    var o, i, j, keys, s;
+
+    /* many distinct atoms so that the RAM atom table is resized and
+       the dead ones are removed by the GC */
+    for(j = 0; j < 3; j++) {
+        o = {};
+        for(i = 0; i < 500; i++)
+            o["k" + j + "_" + i] = i;
+        gc();
+        for(i = 0; i < 500; i++)
+            assert(o["k" + j + "_" + i], i);
+        s = JSON.stringify(o);
+        o = JSON.parse(s);
+        assert(o["k" + j + "_499"], 499);
+        keys = Object.keys(o);
+        assert(keys.length, 500);
+        assert(keys[10], "k" + j + "_10");
+    }
+    /* stdlib atoms */
+    o = JSON.parse('{"length":1,"prototype":2,"toString":3}');
+    assert(o.length + o.prototype + o.toString, 6);
+    assert(Object.keys(o).toString(), "length,prototype,toString");
+}
+
+function test_gc_generations()
+{
+    var live, keep, i, j, s, n;
+
+    live = [];
+    for(i = 0; i < 200; i++)
+        live.push({ id: i, name: "n" + i });
+    gc(); /* 'live' is now in the old generation */
+    keep = {};
+    for(j = 0; j < 20000; j++) {
+        s = "tmp" + j;
+        if ((j % 97) == 0) {
+            /* references from old objects to young ones */
+            live[j % 200].name = s;
+            keep["k" + (j % 30)] = [s, j];
+        }
+    }
+    for(i = 0; i < 200; i++)
+        assert(live[i].name.substring(0, 1) == "n" || live[i].name.substring(0, 3) == "tmp", true);
+    assert(live[0].name, "tmp19400");
+    n = 0;
+    for(i in keep) {
+        assert(keep[i][0], "tmp" + keep[i][1]);
+        n++;
+    }
+    assert(n, 30);
+
+    /* more modified old blocks than the write barrier can record */
+    for(i = 0; i < 200; i++)
+        live[i].tag = [i, "t" + i];
+    for(j = 0; j < 20000; j++)
+        s = [j, "tmp" + j];
+    for(i = 0; i < 200; i++)
+        assert(live[i].tag[1], "t" + i);
+
+    /* old array elements and closure variables */
+    keep = function () {
+        var v = null;
+        return function (x) { if (x) v = x; return v; };
+    }();
+    gc();
+    keep({ a: "young" });
+    live[5] = { b: "young" };
+    for(j = 0; j < 20000; j++)
+        s = { v: "tmp" + j };
+    assert(keep().a, "young");
+    assert(live[5].b, "young");
+}
+
+function test_heap_profile()
+{
+    var keep, report, i, site, alloc_line;
+
+    /* only available with CONFIG_HEAP_PROFILE */
+    if (typeof performance == "undefined" ||
+        typeof performance.heapProfile != "function")
+        return;
+    try {
+        performance.heapProfile(true);
+    } catch(e) {
+        return;
+    }
+    function heap_profile_alloc(n) {
+        var a = [];
+        for(i = 0; i < n; i++)
+            a.push({ id: i, name: "p" + i });
+        return a;
+    }
+    function heap_profile_empty() {
+        var n = 0;
+        return [];
+    }
+    /* line of the empty array literal */
+    alloc_line = Number(/:(\d+):/.exec(new Error().stack)[1]) - 3;
+    keep = { list: heap_profile_alloc(300), empty: [] };
+    for(i = 0; i < 50; i++)
+        keep.empty.push(heap_profile_empty());
+    report = performance.heapReport(10);
+    performance.heapProfile(false);
+    /* the site using the most memory comes first */
+    assert(report.indexOf("heap_profile_alloc") > report.indexOf("SITE"), true);
+    site = report.substring(report.indexOf("heap_profile_empty ("));
+    site = site.substring(0, site.indexOf(")"));
+    assert(site.substring(site.lastIndexOf(":") + 1), String(alloc_line));
+    assert(report.indexOf("<root>") > report.indexOf("RETAINED"), true);
+}
+
 function test_string()
 {
     var a;
@@ -449,6 +712,63 @@ function test_string2()
     assert("\u{101234}" < "\udbc5", true);
 
     assert("\u{101233}" < "\u{101234}", true);
+
+    /* interleaved indexed accesses (string position cache) */
+    var s1 = "é€".repeat(50), s2 = "\u{101234}a".repeat(50);
+    var t1 = [ "é", "€" ], t2 = [ "\udbc4", "\ude34", "a" ];
+    for(var i = 0; i < 100; i++) {
+        assert(s1[i] + s2[i] + s1[99 - i],
+               t1[i % 2] + t2[i % 3] + t1[(99 - i) % 2], "pos cache");
+    }
+}
+
+/* long strings built by concatenation */
+function test_rope_string()
+{
+    var s, a, b, c, i, o;
+
+    s = "";
+    for(i = 0; i < 1000; i++)
+        s += "é" + i + ",";
+    assert(s.length, 4890);
+    assert(s.slice(0, 9), "é0,é1,é2,");
+    assert(s.slice(-5), "é999,");
+    assert(s.indexOf("é500,"), 2390);
+
+    /* strings sharing the same characters */
+    a = "x".repeat(100);
+    b = a + "b";
+    c = a + "c";
+    assert(b.length, 101);
+    assert(b[100] + c[100], "bc");
+    assert(b < c, true);
+    assert(a + a, "x".repeat(200));
+    b += "bb";
+    assert(c + b.slice(100), a + "cbbb");
+
+    assert("x".repeat(70) + "\udbc4" + "\u{de34}", "x".repeat(70) + "\u{101234}");
+    assert(+("1".repeat(70) + "0"), 1.111111111111111e70);
+    assert((1, eval)("'" + a + "'" + " + 1"), a + "1");
+    assert(JSON.parse("[" + "1,".repeat(40) + "2]").length, 41);
+
+    o = {};
+    o[a + "k"] = 1;
+    assert(o["x".repeat(100) + "k"], 1);
+    assert(Object.keys(o)[0], a + "k");
+
+    /* the GC makes the strings flat or trims their buffer */
+    o = [];
+    for(i = 0; i < 10; i++)
+        o.push(a + i);
+    b = a + "1";
+    c = b + "2";
+    gc();
+    assert(o[9], "x".repeat(100) + "9");
+    assert(b + "3", a + "13");
+    assert(c + "3", a + "123");
+    c += "4";
+    gc();
+    assert(c.slice(99), "x124");
 }
 
 function test_math()
@@ -459,6 +779,28 @@ function test_math()
     assert(Math.ceil(a), 2);
     assert(Math.imul(0x12345678, 123), -1088058456);
     assert(Math.fround(0.1), 0.10000000149011612);
+
+    /* typed C functions, with and without the fast path */
+    a = { valueOf: function() { return 3; } };
+    assert(Math.pow(2, 10), 1024);
+    assert(Math.pow(a, 2), 9);
+    assert(Math.pow(2, 3, 4), 8);
+    assert(Math.pow(2), NaN);
+    assert(Math.atan2(1, 1), Math.PI / 4);
+    assert(Math.imul(a, 0x40000000), -1073741824);
+    assert(Math.imul(2.9, "3"), 6);
+    assert([1, 4, 9].map(Math.sqrt).join(), "1,2,3");
+    assert([4, "9", a].map(Math.pow).join(), "1,9,9");
+    assert([1, 2, 3].reduce(Math.imul), 6);
+    assert([0.2, 0.7].some(Math.round), true);
+    assert_throws(TypeError, function() { Math.sqrt({ valueOf: function() { throw TypeError(); } }); });
+    assert_throws(TypeError, function() { Math.pow(2, { valueOf: function() { throw TypeError(); } }); });
+
+    assert(Math.idiv(-7, 2), -3);
+    assert(Math.idiv(1, 0), 0);
+    assert(Math.fxmul(3 << 16, 1 << 15, 16), 3 << 15);
+    assert(Math.fxdiv(-1, 2, 16), -(1 << 15));
+    assert(Math.fxdiv(1, 0, 16), 0x7fffffff);
 }
 
 function test_number()
@@ -486,6 +828,19 @@ function test_number()
     assert((1.125).toFixed(2), "1.13");
     assert((-1.125).toFixed(2), "-1.13");
     assert((-1e-10).toFixed(0), "-0");
+
+    assert(String(0.1 + 0.2), "0.30000000000000004");
+    assert(String(-23.75), "-23.75");
+    assert(String(1013.25), "1013.25");
+    assert(String(0.000001), "0.000001");
+    assert(String(1.5e-7), "1.5e-7");
+    assert(String(123e-20), "1.23e-18");
+    assert(String(2 ** 53), "9007199254740992");
+    assert(String(2 ** 60), "1152921504606847000");
+    assert(String(1e21), "1e+21");
+    assert(String(5e-324), "5e-324");
+    assert(String(-1e-300), "-1e-300");
+    assert(JSON.stringify([1.5, -0, 4294967296.5]), "[1.5,0,4294967296.5]");
 }
 
 function test_global_eval()
@@ -570,6 +925,177 @@ function test_typed_array()
     assert(a.toString(), "2,3");
 }
 
+function test_typed_array_kernels()
+{
+    var a, b;
+
+    a = new Uint8Array(6);
+    assert(a.fill(300, 1, -1), a);
+    assert(a.toString(), "0,44,44,44,44,0");
+    a = new Uint8ClampedArray(2);
+    assert(a.fill(300).toString(), "255,255");
+    a = new Float64Array(3);
+    assert(a.fill(2.5, 1).toString(), "0,2.5,2.5");
+
+    a = new Int32Array([1, 2, 3, 4, 5]);
+    assert(a.copyWithin(0, 3).toString(), "4,5,3,4,5");
+    assert(a.copyWithin(1, 0, 2).toString(), "4,4,5,4,5");
+    a = new Uint8Array([1, 2, 3, 4, 5]).subarray(1, 4);
+    assert(a.copyWithin(-1, 0).toString(), "2,3,2");
+
+    a = new Int16Array([1, -2, 3, 4, -2]);
+    assert(a.indexOf(-2), 1);
+    assert(a.indexOf(-2, 2), 4);
+    assert(a.lastIndexOf(-2), 4);
+    assert(a.lastIndexOf(-2, -2), 1);
+    assert(a.indexOf(3.5), -1);
+    assert(a.indexOf("3"), -1);
+    assert(a.indexOf(65539), -1);
+    a = new Float32Array([1.5, NaN, -0]);
+    assert(a.indexOf(0), 2);
+    assert(a.indexOf(NaN), -1);
+    assert(a.indexOf(1.5), 0);
+
+    a = new Int16Array([1, 2, 3, 4]);
+    b = a.slice(1, 3);
+    assert(b instanceof Int16Array, true);
+    assert(b.toString(), "2,3");
+    b[0] = 10;
+    assert(a[1], 2);
+    assert(a.slice(-1).toString(), "4");
+    assert(a.slice(3, 1).length, 0);
+
+    a = new Int16Array([1, -2, 32767, -32768]);
+    assert(a.sum(), -2);
+    assert(a.min(), -32768);
+    assert(a.max(), 32767);
+    assert(a.dot(a), 1 + 4 + 32767 * 32767 + 32768 * 32768);
+    a = new Int16Array(70000);
+    a.fill(-32768);
+    assert(a.sum(), -32768 * 70000);
+    assert(a.dot(a), 32768 * 32768 * 70000);
+    a = new Float32Array([0.5, -1, 2]);
+    assert(a.sum(), 1.5);
+    assert(a.min(), -1);
+    assert(a.max(), 2);
+    assert(a.dot(new Float32Array([2, 1, 0.25])), 0.5);
+    assert(new Float32Array([1, NaN]).max(), NaN);
+    assert(new Uint32Array([4294967295, 1]).sum(), 4294967296);
+    assert(new Int8Array(0).min(), Infinity);
+    assert(new Int8Array(0).max(), -Infinity);
+    assert(new Int8Array(0).sum(), 0);
+    assert(new Int8Array([1, 2]).dot(new Float64Array([0.5, 0.25])), 1);
+    assert_throws(RangeError, function () { a.dot(new Float32Array(1)); });
+    assert_throws(TypeError, function () { a.dot([1, 2, 3]); });
+}
+
+function test_dataview()
+{
+    var buffer, dv, a;
+
+    buffer = new ArrayBuffer(16);
+    dv = new DataView(buffer, 2, 12);
+    assert(dv.buffer, buffer);
+    assert(dv.byteOffset, 2);
+    assert(dv.byteLength, 12);
+    assert(new DataView(buffer, 4).byteLength, 12);
+
+    dv.setUint16(0, 0x1234);
+    dv.setInt16(2, -2, true);
+    dv.setUint32(4, 0xdeadbeef);
+    dv.setInt8(8, -1);
+    dv.setUint8(9, 257);
+    a = new Uint8Array(buffer);
+    assert(a.toString(), "0,0,18,52,254,255,222,173,190,239,255,1,0,0,0,0");
+    assert(dv.getUint16(0), 0x1234);
+    assert(dv.getUint16(0, true), 0x3412);
+    assert(dv.getInt16(2, true), -2);
+    assert(dv.getUint32(4), 0xdeadbeef);
+    assert(dv.getInt32(4), 0xdeadbeef | 0);
+    assert(dv.getInt8(8), -1);
+    assert(dv.getUint8(8), 255);
+    assert(dv.getUint8(9), 1);
+
+    /* unaligned floats */
+    dv.setFloat32(1, 1.5);
+    assert(dv.getFloat32(1), 1.5);
+    dv.setFloat64(3, -0.1, true);
+    assert(dv.getFloat64(3, true), -0.1);
+    assert(new DataView(buffer).getFloat64(5, true), -0.1);
+
+    assert_throws(RangeError, function () { dv.getUint32(9); });
+    assert_throws(RangeError, function () { dv.setUint8(12, 0); });
+    assert_throws(RangeError, function () { dv.getInt8(-1); });
+    assert_throws(RangeError, function () { new DataView(buffer, 17); });
+    assert_throws(RangeError, function () { new DataView(buffer, 8, 9); });
+    assert_throws(TypeError, function () { new DataView(a); });
+
+    /* JSONParser accepts a DataView */
+    a = new Uint8Array([32, 91, 49, 44, 50, 93, 32]);
+    var p = new JSONParser();
+    p.write(new DataView(a.buffer, 1, 5));
+    assert(JSON.stringify(p.end()), "[1,2]");
+}
+
+function test_timers()
+{
+    var log = [], n = 0, fired = false, t1, t2, id;
+
+    /* equal deadlines run in scheduling order, timers created by a
+       callback run after the already expired ones */
+    setTimeout(function() {
+        log.push("a");
+        setTimeout(function() { log.push("d"); }, 0);
+    }, 0);
+    setTimeout(function() { log.push("b"); }, 0);
+    setTimeout(function() { log.push("c"); }, 0);
+
+    /* a stale id must not cancel the timer which reused its slot */
+    t1 = setTimeout(function() { throw Error("cleared timer"); }, 0);
+    clearTimeout(t1);
+    t2 = setTimeout(function() { fired = true; }, 0);
+    assert(t1 !== t2, true);
+    clearTimeout(t1);
+
+    id = setInterval(function() {
+        n++;
+        if (n == 3) {
+            clearInterval(id);
+            setTimeout(function() {
+                assert(n, 3);
+                assert(log.join(""), "abcd");
+                assert(fired, true);
+            }, 5);
+        }
+    }, 1);
+}
+
+function test_worker()
+{
+    var reply = null, start, poll;
+
+    if (typeof startWorker !== "function")
+        return;
+    /* the messages are copied as JSON in both directions */
+    startWorker("globalThis.onmessage = function(m) { postMessage({ y: m.x * 2, s: m.s + '!' }); };");
+    globalThis.onmessage = function(m) { reply = m; };
+    postMessage({ x: 21, s: "\u00e9t\u00e9" });
+
+    start = performance.now();
+    poll = function() {
+        if (reply) {
+            assert(reply.y, 42);
+            assert(reply.s, "\u00e9t\u00e9!");
+            globalThis.onmessage = undefined;
+        } else if (performance.now() - start > 5000) {
+            throw Error("no reply from the worker");
+        } else {
+            setTimeout(poll, 1);
+        }
+    };
+    setTimeout(poll, 1);
+}
+
 function repeat(a, n)
 {
     return a.repeat(n);
@@ -659,6 +1185,61 @@ function test_json()
 //    assert_json_error('\n{ "a": @x }"');
 }
 
+function test_json_parser()
+{
+    var p, s, i, n, r, keys, vals, u;
+
+    s = '{"a": [1, -2.5e3, true, false, null], "b\\n\\u00e9": {"c": "x\\"y\\\\"},' +
+        ' "d": "héllo😀", "e": [], "f": {} }';
+    r = JSON.stringify(JSON.parse(s));
+    p = new JSONParser();
+    /* the tokens are split at every possible position */
+    for(n = 1; n <= 4; n++) {
+        for(i = 0; i < s.length; i += n)
+            p.write(s.substring(i, i + n));
+        assert(JSON.stringify(p.end()), r);
+    }
+    p.write("12");
+    p.write("34");
+    assert(p.end(), 1234);
+
+    u = new Uint8Array([0x5b, 0x31, 0x2c, 0x22, 0xc3, 0xa9, 0x22, 0x5d]);
+    p.write(u.subarray(0, 5));
+    p.write(u.subarray(5));
+    assert(JSON.stringify(p.end()), '[1,"é"]');
+
+    /* streaming mode */
+    keys = [];
+    vals = [];
+    p = new JSONParser(function (k, v) {
+        keys.push(k);
+        vals.push(JSON.stringify(v));
+    }, 2);
+    p.write('{"items": [1, {"x": 2}, [3]');
+    p.write(', 4], "n": 5}');
+    assert(JSON.stringify(p.end()), '{"items":[],"n":5}');
+    assert(keys.join(), "0,1,2,3");
+    assert(vals.join(" "), '1 {"x":2} [3] 4');
+
+    p = new JSONParser();
+    assert_throws(SyntaxError, function () { p.write("[1,,2]"); });
+    /* the parser is unusable after an error until end() */
+    assert_throws(SyntaxError, function () { p.write("1"); });
+    assert_throws(SyntaxError, function () { p.end(); });
+    p.write("[1,2]");
+    assert(JSON.stringify(p.end()), "[1,2]");
+    p = new JSONParser();
+    p.write("[1");
+    assert_throws(SyntaxError, function () { p.end(); });
+    p = new JSONParser();
+    p.write("tru");
+    assert_throws(SyntaxError, function () { p.end(); });
+    p.write("true");
+    assert(p.end(), true);
+    p = new JSONParser(function (k, v) { p.write("1"); });
+    assert_throws(SyntaxError, function () { p.write("[1]"); });
+}
+
 function test_large_eval_parse_stack()
 {
     var n = 1000;
@@ -676,7 +1257,7 @@ function test_large_eval_parse_stack()
 
 function test_regexp()
 {
-    var a, str, n;
+    var a, b, str, n;
 
     str = "abbbbbc";
     a = /(b+)c/.exec(str);
@@ -724,6 +1305,25 @@ function test_regexp()
     a = /()*?a/.exec(",");
     assert(a, null);
 
+    /* literal prefix search */
+    a = /(ab)c/.exec("xxabxabcabc");
+    assert(a.index === 5 && a[1] === "ab");
+    assert(/aé/.exec("aaéaé").index, 1);
+    assert(/abc/.exec("abab"), null);
+    assert("a.b.c".replace(/\./g, "-"), "a-b-c");
+    a = /an/g;
+    a.exec("banana");
+    assert(a.exec("banana").index, 3);
+
+    /* the byte code may come from the cache */
+    a = new RegExp("a[bc]", "g");
+    b = new RegExp("a[bc]");
+    assert(b.flags, "");
+    assert(a.exec("xacab")[0], "ac");
+    assert(b.exec("xacab")[0], "ac");
+    assert(a.exec("xacab")[0], "ab");
+    assert(new RegExp("a[bc]", "g").lastIndex, 0);
+
     /* test \b escape */
     assert(/[\q{a\b}]/.test("a\b"), true);
     assert(/[\b]/.test("\b"), true);
@@ -859,17 +1459,28 @@ function test_line_column_numbers()
 }
 
 test();
+test_object_shape();
+test_unique_strings();
+test_gc_generations();
+test_heap_profile();
 test_string();
 test_string2();
+test_rope_string();
 test_array();
+test_array_sort();
 test_array_ext();
 test_enum();
 test_function();
 test_number();
 test_math();
 test_typed_array();
+test_typed_array_kernels();
+test_dataview();
+test_timers();
+test_worker();
 test_global_eval();
 test_json();
+test_json_parser();
 test_regexp();
 test_line_column_numbers();
 test_large_eval_parse_stack();
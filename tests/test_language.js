@@ -148,8 +148,20 @@ function test_op1()
     /* 31 bit overflow */
     a = 0x3fffffff;
     assert(a + 1, 0x40000000);
+    assert(a * 4, 0xfffffffc);
+    a++;
+    assert(a, 0x40000000);
     a = -0x40000000;
     assert(-a, 0x40000000);
+    assert(a - 1, -0x40000001);
+    assert(a / -1, 0x40000000);
+
+    /* integer division and modulo */
+    assert(-12 / 4, -3);
+    assert(1/(0 / -4), -Infinity);
+    assert(-7 % 3, -1);
+    assert(7 % -3, 1);
+    assert(1/(-6 % 3), -Infinity);
 }
 
 function test_cvt()
@@ -374,6 +374,55 @@ function test_try_catch8()
     assert(s, "xafyaf");
 }
 
+function test_superinstructions()
+{
+    var i, s, o, a, b, c, d, e;
+    /* inc_loc slow cases */
+    i = 0.5;
+    i++;
+    assert(i, 1.5);
+    i = 0x3fffffff;
+    i++;
+    assert(i, 0x40000000);
+    i = "1";
+    i++;
+    assert(i, 2);
+    /* inc_loc8 */
+    a = b = c = d = e = 0;
+    for(i = 0; i < 3; i++) {
+        e++;
+    }
+    assert(e, 3);
+    e = 1.5;
+    e++;
+    assert(e, 2.5);
+    /* compare and branch with non integer operands */
+    s = 0;
+    for(i = 0; i < 2.5; i++)
+        s++;
+    assert(s, 3);
+    s = 0;
+    for(i = "a"; i < "aaaa"; i += "a")
+        s++;
+    assert(s, 3);
+    s = 0;
+    for(i = 10; i >= 0; i -= 5)
+        s++;
+    assert(s, 3);
+    /* get_loc + get_field */
+    o = { x: 1 };
+    assert(o.x, 1);
+    o = "abc";
+    assert(o.length, 3);
+    o = null;
+    try {
+        o.x;
+        assert(false);
+    } catch(err) {
+        assert(err instanceof TypeError);
+    }
+}
+
 test_while();
 test_while_break();
 test_do_while();
@@ -393,3 +442,4 @@ test_try_catch5();
 test_try_catch6();
 test_try_catch7();
 test_try_catch8();
+test_superinstructions();